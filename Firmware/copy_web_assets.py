@@ -1,3 +1,4 @@
+import hashlib
 import os
 import shutil
 from pathlib import Path
@@ -7,6 +8,8 @@ Import("env")
 # --- CONFIGURATION ---
 NUXT_OUTPUT_DIR = Path("extras/WebPortal/.output/public")
 DATA_DIR = Path("data/web")
+MANIFEST_FILE = DATA_DIR / "etags.txt" # WEB_ASSETS_MANIFEST of config.hpp
+HASH_LENGTH = 16 # hex digits of the SHA-256 kept in the ETags
 
 COLOR = {
     "RED": "31",
@@ -46,6 +49,7 @@ def copy_web_assets(*args, **kwargs):
     # 3. Walk and copy intelligently
     total_size = 0
     file_count = 0
+    etags = []
 
     for root, dirs, files in os.walk(NUXT_OUTPUT_DIR):
         # Create the subfolder structure in /data
@@ -74,8 +78,15 @@ def copy_web_assets(*args, **kwargs):
             
             total_size += dest_file.stat().st_size
             file_count += 1
+            etags.append((f"/{dest_file.relative_to(DATA_DIR).as_posix()}", hashlib.sha256(dest_file.read_bytes()).hexdigest()[:HASH_LENGTH]))
             # print(f"   ✅ Copied : {file}")
 
+    # 4. Content hashes of the files, sent as ETags by the web server (a 304 when the browser has the same file)
+    with open(MANIFEST_FILE, "w", newline="\n") as manifest:
+        for path, digest in sorted(etags):
+            manifest.write(f"{path} {digest}\n")
+    print(f"Wrote {len(etags)} content hashes to '{MANIFEST_FILE}'.")
+
     # Convert to MB for display
     size_mb = total_size / (1024 * 1024)
     print(f"Done! {file_count} files copied to '/data'.")
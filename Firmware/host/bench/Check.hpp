@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdio>
+
+/**
+ * Self-checks of the host benches : a failed check is reported on stderr and counted, and the bench returns
+ * check_exit_code() from main(), so ctest sees the failure.
+ */
+
+/// @brief Number of failed checks
+inline int check_failures = 0;
+
+/**
+ * @brief Count a check that doesn't hold.
+ * @param condition What must hold.
+ * @param what Short description of the check, printed when it fails.
+ */
+inline void check(bool condition, const char* what)
+{
+    if (condition) return;
+    fprintf(stderr, "check failed : %s\n", what);
+    check_failures++;
+}
+
+/**
+ * @brief Exit code of a bench : 2 if any check failed, 0 otherwise.
+ */
+inline int check_exit_code()
+{
+    return check_failures != 0 ? 2 : 0;
+}
@@ -0,0 +1,419 @@
+/**
+ * IMA-ADPCM decoder (audio/Adpcm.hpp) and streamed playback (audio/StreamProvider.hpp).
+ *
+ * - bit exactness : Adpcm::DecodeBlock against a straightforward decoder written from the IMA specification,
+ *   on encoded signals (sweep, noise, silence, full scale square, data/test.wav) and on random blocks
+ * - encoder quality : SNR of each encoded signal
+ * - streaming : PCM and IMA-ADPCM files written to a temporary folder and played through StreamProvider
+ *   (paced at 20x real time), output compared sample by sample with a direct decode
+ * - throughput : decoded samples per us and cycles per sample (rdtsc, x86 only)
+ *
+ * Exits with 2 if a check fails.
+ *
+ * Usage : bench_adpcm [--json] [--wav file]
+ */
+#include "audio/Adpcm.hpp"
+#include "audio/StreamProvider.hpp"
+#include "audio/Wav.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+constexpr uint32_t SEED = 0x360;
+constexpr size_t BLOCK_ALIGN = Adpcm::DEFAULT_BLOCK_ALIGN;
+constexpr size_t SAMPLES_PER_BLOCK = Adpcm::SamplesPerBlock(BLOCK_ALIGN);
+constexpr size_t MIX_BLOCK = 512;
+
+static inline uint64_t read_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/** REFERENCE DECODER (IMA ADPCM specification, one nibble at a time) **/
+
+namespace Reference
+{
+    static const int step_table[89] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+        50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+        337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+        2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+        15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+    };
+    static const int index_table[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+    static int16_t decode_nibble(int nibble, int& predictor, int& index)
+    {
+        int step = step_table[index];
+        int sign = nibble & 8;
+        int delta = nibble & 7;
+        int diff = step >> 3;
+        if (delta & 4) diff += step;
+        if (delta & 2) diff += step >> 1;
+        if (delta & 1) diff += step >> 2;
+        if (sign) predictor -= diff;
+        else predictor += diff;
+        if (predictor > 32767) predictor = 32767;
+        else if (predictor < -32768) predictor = -32768;
+        index += index_table[delta];
+        if (index < 0) index = 0;
+        else if (index > 88) index = 88;
+        return static_cast<int16_t>(predictor);
+    }
+
+    static void decode_block(const uint8_t* block, size_t block_align, int16_t* out)
+    {
+        int predictor = static_cast<int16_t>(block[0] | (block[1] << 8));
+        int index = block[2];
+        if (index > 88) index = 88;
+        size_t n = 0;
+        out[n++] = static_cast<int16_t>(predictor);
+        for (size_t i = 4; i < block_align; i++)
+        {
+            out[n++] = decode_nibble(block[i] & 0x0F, predictor, index);
+            out[n++] = decode_nibble(block[i] >> 4, predictor, index);
+        }
+    }
+}
+
+/** SIGNALS **/
+
+struct Signal
+{
+    std::string name;
+    std::vector<int16_t> samples;
+};
+
+static std::vector<Signal> make_signals(const char* wav_path)
+{
+    constexpr size_t LENGTH = SPEAKER_SAMPLE_RATE_HZ * 4; // 4 seconds
+    std::mt19937 rng(SEED);
+    std::vector<Signal> signals;
+
+    Signal sweep{ "sweep_50_10000hz" };
+    double phase = 0.0;
+    for (size_t i = 0; i < LENGTH; i++)
+    {
+        double f = 50.0 * std::pow(200.0, static_cast<double>(i) / LENGTH);
+        phase += 2.0 * M_PI * f / SPEAKER_SAMPLE_RATE_HZ;
+        sweep.samples.push_back(static_cast<int16_t>(20000.0 * std::sin(phase)));
+    }
+    signals.push_back(sweep);
+
+    Signal noise{ "white_noise" };
+    std::normal_distribution<double> gauss(0.0, 6000.0);
+    for (size_t i = 0; i < LENGTH; i++)
+        noise.samples.push_back(static_cast<int16_t>(std::max(-32768.0, std::min(32767.0, gauss(rng)))));
+    signals.push_back(noise);
+
+    signals.push_back({ "silence", std::vector<int16_t>(LENGTH, 0) });
+
+    Signal square{ "square_full_scale" };
+    for (size_t i = 0; i < LENGTH; i++) square.samples.push_back((i / 50) & 1 ? 32767 : -32768);
+    signals.push_back(square);
+
+    FILE* file = fopen(wav_path, "rb");
+    Wav::Info info;
+    if (file != nullptr && Wav::ReadHeader(file, info) == Status::Ok && info.format == Wav::Format::PCM && info.channels == 1)
+    {
+        Signal asset{ "asset_" + std::string(strrchr(wav_path, '/') ? strrchr(wav_path, '/') + 1 : wav_path) };
+        asset.samples.resize(info.data_size / 2);
+        asset.samples.resize(fread(asset.samples.data(), 2, asset.samples.size(), file));
+        signals.push_back(asset);
+    }
+    if (file != nullptr) fclose(file);
+    return signals;
+}
+
+static std::vector<uint8_t> encode(const std::vector<int16_t>& samples)
+{
+    size_t blocks = (samples.size() + SAMPLES_PER_BLOCK - 1) / SAMPLES_PER_BLOCK;
+    std::vector<int16_t> padded(samples);
+    padded.resize(blocks * SAMPLES_PER_BLOCK, samples.empty() ? 0 : samples.back());
+    std::vector<uint8_t> data(blocks * BLOCK_ALIGN);
+    uint8_t index = 0;
+    for (size_t b = 0; b < blocks; b++)
+        Adpcm::EncodeBlock(padded.data() + b * SAMPLES_PER_BLOCK, data.data() + b * BLOCK_ALIGN, BLOCK_ALIGN, index);
+    return data;
+}
+
+template <typename Decoder>
+static std::vector<int16_t> decode(const std::vector<uint8_t>& data, Decoder&& decoder)
+{
+    std::vector<int16_t> samples(data.size() / BLOCK_ALIGN * SAMPLES_PER_BLOCK);
+    for (size_t b = 0; b < data.size() / BLOCK_ALIGN; b++)
+        decoder(data.data() + b * BLOCK_ALIGN, samples.data() + b * SAMPLES_PER_BLOCK);
+    return samples;
+}
+
+static double snr_db(const std::vector<int16_t>& reference, const std::vector<int16_t>& decoded)
+{
+    double signal = 0.0, noise = 0.0;
+    for (size_t i = 0; i < reference.size(); i++)
+    {
+        double error = static_cast<double>(reference[i]) - decoded[i];
+        signal += static_cast<double>(reference[i]) * reference[i];
+        noise += error * error;
+    }
+    if (signal == 0.0) return noise == 0.0 ? INFINITY : -INFINITY;
+    return noise > 0.0 ? 10 * std::log10(signal / noise) : INFINITY;
+}
+
+/** STREAMING **/
+
+static bool write_wav(const std::string& path, const std::vector<int16_t>& samples, bool adpcm)
+{
+    Wav::Info info = {};
+    info.channels = 1;
+    info.sample_rate = SPEAKER_SAMPLE_RATE_HZ;
+    info.sample_count = static_cast<uint32_t>(samples.size());
+    std::vector<uint8_t> data;
+    if (adpcm)
+    {
+        info.format = Wav::Format::ImaAdpcm;
+        info.block_align = BLOCK_ALIGN;
+        info.samples_per_block = SAMPLES_PER_BLOCK;
+        data = encode(samples);
+    }
+    else
+    {
+        info.format = Wav::Format::PCM;
+        info.block_align = 2;
+        info.samples_per_block = 1;
+        data.resize(samples.size() * 2);
+        memcpy(data.data(), samples.data(), data.size());
+    }
+    info.data_size = static_cast<uint32_t>(data.size());
+
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr) return false;
+    bool ok = Wav::WriteHeader(file, info) == Status::Ok && fwrite(data.data(), 1, data.size(), file) == data.size();
+    fclose(file);
+    return ok;
+}
+
+struct StreamCheck
+{
+    std::string name;
+    size_t samples;
+    size_t mismatches;
+    StreamProvider::Stats stats;
+    bool ok;
+};
+
+static StreamCheck check_stream(const std::string& name, const std::string& path, const std::vector<int16_t>& expected)
+{
+    StreamCheck check{ name, 0, 0, {}, false };
+    StreamProvider* provider = new StreamProvider();
+    if (provider->open(path.c_str()) != Status::Ok)
+    {
+        delete provider;
+        return check;
+    }
+
+    // paced at 20x real time, so the loader always has time to read the next chunk
+    const auto period = std::chrono::microseconds(MIX_BLOCK * 1'000'000 / SPEAKER_SAMPLE_RATE_HZ / 20);
+    std::vector<int16_t> played;
+    Speaker::Sample buffer[MIX_BLOCK];
+    while (provider->provideSamples(buffer, MIX_BLOCK))
+    {
+        played.insert(played.end(), buffer, buffer + MIX_BLOCK);
+        std::this_thread::sleep_for(period);
+    }
+    check.stats = provider->getStats();
+    delete provider;
+
+    check.samples = std::min(played.size(), expected.size());
+    for (size_t i = 0; i < check.samples; i++) check.mismatches += played[i] != expected[i];
+    // the last buffer is padded with silence
+    bool padding_silent = true;
+    for (size_t i = expected.size(); i < played.size(); i++) padding_silent &= played[i] == 0;
+    check.ok = played.size() >= expected.size() && played.size() < expected.size() + MIX_BLOCK && check.mismatches == 0 &&
+               padding_silent && check.stats.underruns == 0;
+    return check;
+}
+
+/** THROUGHPUT **/
+
+struct Throughput
+{
+    std::string name;
+    double samples_per_us;
+    double cycles_per_sample;
+};
+
+template <typename F>
+static Throughput measure(const std::string& name, size_t samples_per_run, F&& run)
+{
+    constexpr int RUNS = 50;
+    run(); // warm up
+    auto start = std::chrono::steady_clock::now();
+    uint64_t start_cycles = read_cycles();
+    for (int i = 0; i < RUNS; i++) run();
+    uint64_t cycles = read_cycles() - start_cycles;
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    double samples = static_cast<double>(samples_per_run) * RUNS;
+    return { name, samples / us, cycles / samples };
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    const char* wav_path = FIRMWARE_DATA_DIR "/test.wav";
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--wav") == 0 && i + 1 < argc) wav_path = argv[++i];
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--wav file]\n", argv[0]);
+            return 1;
+        }
+    }
+    bool failed = false;
+
+    // Bit exactness and encoder quality on signals
+    struct SignalResult { std::string name; size_t samples; size_t mismatches; double snr_db; };
+    std::vector<SignalResult> signalResults;
+    std::vector<Signal> signals = make_signals(wav_path);
+    for (const Signal& signal : signals)
+    {
+        std::vector<uint8_t> data = encode(signal.samples);
+        std::vector<int16_t> decoded = decode(data, [](const uint8_t* in, int16_t* out) { Adpcm::DecodeBlock(in, out, BLOCK_ALIGN); });
+        std::vector<int16_t> reference = decode(data, [](const uint8_t* in, int16_t* out) { Reference::decode_block(in, BLOCK_ALIGN, out); });
+        size_t mismatches = 0;
+        for (size_t i = 0; i < decoded.size(); i++) mismatches += decoded[i] != reference[i];
+        decoded.resize(signal.samples.size());
+        signalResults.push_back({ signal.name, signal.samples.size(), mismatches, snr_db(signal.samples, decoded) });
+        failed |= mismatches != 0;
+    }
+
+    // Bit exactness on random blocks (any code sequence, any header, step index saturation)
+    size_t randomBlocks = 20000, randomMismatches = 0;
+    {
+        std::mt19937 rng(SEED);
+        std::vector<uint8_t> block(BLOCK_ALIGN);
+        std::vector<int16_t> out(SAMPLES_PER_BLOCK), ref(SAMPLES_PER_BLOCK);
+        for (size_t b = 0; b < randomBlocks; b++)
+        {
+            for (uint8_t& byte : block) byte = static_cast<uint8_t>(rng());
+            if (b % 2) block[2] = static_cast<uint8_t>(rng() % 89); // half with valid step indexes
+            Adpcm::DecodeBlock(block.data(), out.data(), BLOCK_ALIGN);
+            Reference::decode_block(block.data(), BLOCK_ALIGN, ref.data());
+            randomMismatches += memcmp(out.data(), ref.data(), out.size() * sizeof(int16_t)) != 0;
+        }
+        failed |= randomMismatches != 0;
+    }
+
+    // Streaming through StreamProvider
+    std::vector<StreamCheck> streamChecks;
+    {
+        char dir_template[] = "/tmp/bench_adpcm_XXXXXX";
+        const char* dir = mkdtemp(dir_template);
+        const Signal& signal = signals.back(); // the asset if found, the square otherwise
+        std::string pcm_path = std::string(dir ? dir : "/tmp") + "/stream_pcm.wav";
+        std::string adpcm_path = std::string(dir ? dir : "/tmp") + "/stream_adpcm.wav";
+        write_wav(pcm_path, signal.samples, false);
+        write_wav(adpcm_path, signal.samples, true);
+
+        std::vector<uint8_t> data = encode(signal.samples);
+        std::vector<int16_t> decoded = decode(data, [](const uint8_t* in, int16_t* out) { Adpcm::DecodeBlock(in, out, BLOCK_ALIGN); });
+        decoded.resize(signal.samples.size());
+
+        streamChecks.push_back(check_stream("stream_pcm", pcm_path, signal.samples));
+        streamChecks.push_back(check_stream("stream_adpcm", adpcm_path, decoded));
+        for (const StreamCheck& check : streamChecks) failed |= !check.ok;
+
+        remove(pcm_path.c_str());
+        remove(adpcm_path.c_str());
+        if (dir) remove(dir);
+    }
+
+    // Throughput
+    std::vector<Throughput> throughputs;
+    {
+        const std::vector<int16_t>& samples = signals[0].samples;
+        std::vector<uint8_t> data = encode(samples);
+        std::vector<int16_t> out(data.size() / BLOCK_ALIGN * SAMPLES_PER_BLOCK);
+        volatile int16_t sink = 0;
+        throughputs.push_back(measure("decode_block", out.size(), [&]() {
+            for (size_t b = 0; b < data.size() / BLOCK_ALIGN; b++)
+                Adpcm::DecodeBlock(data.data() + b * BLOCK_ALIGN, out.data() + b * SAMPLES_PER_BLOCK, BLOCK_ALIGN);
+            sink = out[sink & 1023];
+        }));
+        throughputs.push_back(measure("decode_reference", out.size(), [&]() {
+            for (size_t b = 0; b < data.size() / BLOCK_ALIGN; b++)
+                Reference::decode_block(data.data() + b * BLOCK_ALIGN, BLOCK_ALIGN, out.data() + b * SAMPLES_PER_BLOCK);
+            sink = out[sink & 1023];
+        }));
+        std::vector<uint8_t> encoded(data.size());
+        throughputs.push_back(measure("encode_block", out.size(), [&]() {
+            uint8_t index = 0;
+            for (size_t b = 0; b + 1 < data.size() / BLOCK_ALIGN; b++)
+                Adpcm::EncodeBlock(samples.data() + b * SAMPLES_PER_BLOCK, encoded.data() + b * BLOCK_ALIGN, BLOCK_ALIGN, index);
+            sink = encoded[sink & 1023];
+        }));
+    }
+
+    double realtime_share = 0.0; // share of one core needed to decode in real time
+    for (const Throughput& t : throughputs)
+        if (t.name == "decode_block") realtime_share = SPEAKER_SAMPLE_RATE_HZ / (t.samples_per_us * 1e6);
+
+    if (json)
+    {
+        printf("{\"block_align\": %zu, \"failed\": %s, \"random_blocks\": %zu, \"random_mismatches\": %zu,\n \"signals\": [\n",
+               BLOCK_ALIGN, failed ? "true" : "false", randomBlocks, randomMismatches);
+        for (size_t i = 0; i < signalResults.size(); i++)
+        {
+            const SignalResult& r = signalResults[i];
+            printf("  {\"name\": \"%s\", \"samples\": %zu, \"mismatches\": %zu, \"snr_db\": %.2f}%s\n", r.name.c_str(), r.samples,
+                   r.mismatches, std::isfinite(r.snr_db) ? r.snr_db : 999.0, i + 1 < signalResults.size() ? "," : "");
+        }
+        printf(" ],\n \"streams\": [\n");
+        for (size_t i = 0; i < streamChecks.size(); i++)
+        {
+            const StreamCheck& c = streamChecks[i];
+            printf("  {\"name\": \"%s\", \"samples\": %zu, \"mismatches\": %zu, \"chunks_read\": %u, \"underruns\": %u, \"max_read_us\": %u, \"ok\": %s}%s\n",
+                   c.name.c_str(), c.samples, c.mismatches, c.stats.chunks_read, c.stats.underruns, c.stats.max_read_us,
+                   c.ok ? "true" : "false", i + 1 < streamChecks.size() ? "," : "");
+        }
+        printf(" ],\n \"throughput\": [\n");
+        for (size_t i = 0; i < throughputs.size(); i++)
+            printf("  {\"name\": \"%s\", \"samples_per_us\": %.2f, \"cycles_per_sample\": %.2f}%s\n", throughputs[i].name.c_str(),
+                   throughputs[i].samples_per_us, throughputs[i].cycles_per_sample, i + 1 < throughputs.size() ? "," : "");
+        printf(" ]}\n");
+    }
+    else
+    {
+        printf("IMA-ADPCM, %zu bytes blocks (%zu samples)\n\n", BLOCK_ALIGN, SAMPLES_PER_BLOCK);
+        printf("%-22s %9s %16s %9s\n", "signal", "samples", "vs reference", "SNR");
+        for (const SignalResult& r : signalResults)
+            printf("%-22s %9zu %11zu diff %6.1f dB\n", r.name.c_str(), r.samples, r.mismatches, r.snr_db);
+        printf("%-22s %9zu %11zu diff\n", "random_blocks", randomBlocks, randomMismatches);
+
+        printf("\n%-14s %9s %11s %12s %10s %12s %5s\n", "stream", "samples", "mismatches", "chunks read", "underruns", "max read us", "");
+        for (const StreamCheck& c : streamChecks)
+            printf("%-14s %9zu %11zu %12u %10u %12u %5s\n", c.name.c_str(), c.samples, c.mismatches, c.stats.chunks_read,
+                   c.stats.underruns, c.stats.max_read_us, c.ok ? "ok" : "FAIL");
+
+        printf("\n%-18s %14s %12s\n", "throughput", "samples/us", "cycles/smp");
+        for (const Throughput& t : throughputs)
+            printf("%-18s %14.2f %12.2f\n", t.name.c_str(), t.samples_per_us, t.cycles_per_sample);
+        printf("\nreal-time decoding at %d Hz uses %.3f%% of a host core\n", SPEAKER_SAMPLE_RATE_HZ, realtime_share * 100);
+        printf("checks : %s\n", failed ? "FAILED" : "ok");
+    }
+    return failed ? 2 : 0;
+}
@@ -0,0 +1,386 @@
+/**
+ * Compressed animations (ui/AnimationCodec.hpp) against the raw frames they replace.
+ *
+ * - round trip : synthetic sequences (moving shapes, noise, blank and full frames, odd sizes) encoded with several key
+ *   frame intervals, then decoded in order and at random positions, must give the frames back ; corrupted and truncated
+ *   files must be refused or decoded without going out of bounds
+ * - assets : the animations of ui/Animations.hpp played by the Animation widget must paint the same screen as the
+ *   previous Draw::Blit() of the same frames stored row by row, and must encode again to the same frames
+ * - size : bytes of every asset against the raw frames and against key frames only
+ * - timing : us per frame played (decode and draw) against the previous Draw::Blit() of raw frames
+ *
+ * Exits with 2 if a check fails.
+ *
+ * Usage : bench_animation [--json]
+ */
+#include "common/config.hpp"
+#include "drivers/ScreenDriver.hpp"
+#include "ui/AnimationCodec.hpp"
+#include "ui/Animations.hpp"
+#include "ui/Draw.hpp"
+#include "ui/widgets/animation.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t SEED = 0x360;
+constexpr size_t SCREEN_SIZE = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
+
+struct Asset
+{
+    const char* name;
+    const uint8_t* data;
+    size_t size;
+};
+
+static const Asset ASSETS[] = {
+    { "PhoneQRSpawn", Animation::PhoneQRSpawn, sizeof(Animation::PhoneQRSpawn) },
+    { "PhoneQRScan", Animation::PhoneQRScan, sizeof(Animation::PhoneQRScan) },
+    { "PhoneQRConnected", Animation::PhoneQRConnected, sizeof(Animation::PhoneQRConnected) },
+};
+
+/** HELPERS **/
+
+/// @brief Every frame of an animation, decoded in order (empty if it can't be decoded)
+static std::vector<uint8_t> decode_all(const uint8_t* data, size_t size)
+{
+    AnimationCodec::Decoder decoder;
+    if (decoder.open(data, size) != Status::Ok) return {};
+    const AnimationCodec::Header& header = decoder.getHeader();
+    size_t frame_size = AnimationCodec::FrameSize(header.width, header.height);
+    std::vector<uint8_t> frames(frame_size * header.frame_count);
+    for (uint8_t i = 0; i < header.frame_count; i++)
+    {
+        if (decoder.seek(i) != Status::Ok) return {};
+        memcpy(&frames[i * frame_size], decoder.getFrame(), frame_size);
+    }
+    return frames;
+}
+
+/// @brief Inverse of AnimationCodec::RowsToPages() : the format of the previous assets
+static std::vector<uint8_t> pages_to_rows(const uint8_t* pages, uint8_t width, uint8_t height)
+{
+    std::vector<uint8_t> rows((width * height + 7) / 8, 0);
+    for (uint16_t y = 0; y < height; y++)
+    {
+        for (uint16_t x = 0; x < width; x++)
+        {
+            if (pages[(y / 8) * width + x] & (1 << (y % 8)))
+            {
+                uint32_t bit = y * width + x;
+                rows[bit / 8] |= 0x80 >> (bit % 8);
+            }
+        }
+    }
+    return rows;
+}
+
+static void fill_background(uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    for (size_t i = 0; i < SCREEN_SIZE; i++) ScreenDriver::info.data[i] = rng();
+}
+
+/** ROUND TRIP **/
+
+struct RoundTrip
+{
+    uint32_t sequences;
+    uint32_t frames;
+    uint32_t mismatches;
+    uint32_t seek_mismatches;
+    uint32_t corrupted;
+    uint32_t asset_mismatches;
+    uint32_t draw_mismatches;
+};
+
+/// @brief Frames of a synthetic sequence, in the screen buffer format
+static std::vector<uint8_t> make_sequence(std::mt19937& rng, uint8_t width, uint8_t height, uint8_t count, int kind)
+{
+    size_t frame_size = AnimationCodec::FrameSize(width, height);
+    std::vector<uint8_t> frames(frame_size * count, 0);
+    auto set = [&](uint8_t f, int x, int y) {
+        if (x >= 0 && x < width && y >= 0 && y < height) frames[f * frame_size + (y / 8) * width + x] |= 1 << (y % 8);
+    };
+    for (uint8_t f = 0; f < count; f++)
+    {
+        switch (kind)
+        {
+        case 0: // moving box
+            for (int y = 0; y < height / 3; y++)
+                for (int x = 0; x < width / 3; x++) set(f, x + f % width, y + (f * 3) % height);
+            break;
+        case 1: // noise
+            for (int y = 0; y < height; y++)
+                for (int x = 0; x < width; x++)
+                    if (rng() & 1) set(f, x, y);
+            break;
+        case 2: // blank
+            break;
+        case 3: // full
+            for (int y = 0; y < height; y++)
+                for (int x = 0; x < width; x++) set(f, x, y);
+            break;
+        default: // previous frame with a few pixels flipped
+            if (f > 0) memcpy(&frames[f * frame_size], &frames[(f - 1) * frame_size], frame_size);
+            for (int n = 0; n < 20; n++)
+            {
+                int x = rng() % width, y = rng() % height;
+                frames[f * frame_size + (y / 8) * width + x] ^= 1 << (y % 8);
+            }
+            break;
+        }
+    }
+    return frames;
+}
+
+static void round_trip_sequences(RoundTrip& result)
+{
+    std::mt19937 rng(SEED);
+    for (uint32_t n = 0; n < 400; n++)
+    {
+        uint8_t width = 1 + rng() % SCREEN_WIDTH;
+        uint8_t height = 1 + rng() % SCREEN_HEIGHT;
+        uint8_t count = 1 + rng() % 40;
+        int kind = n % 5;
+        uint8_t keyframe_interval = (n / 5) % 4 == 0 ? 0 : 1 + rng() % 10;
+        std::vector<uint8_t> frames = make_sequence(rng, width, height, count, kind);
+
+        std::vector<uint8_t> animation;
+        if (AnimationCodec::Encode(frames.data(), width, height, count, keyframe_interval, animation) != Status::Ok ||
+            decode_all(animation.data(), animation.size()) != frames)
+        {
+            if (result.mismatches++ == 0) fprintf(stderr, "round trip : sequence %u (%ux%u, kind %d) differs\n", n, width, height, kind);
+            continue;
+        }
+        result.sequences++;
+        result.frames += count;
+
+        // random positions : backwards, skipping frames, staying on a frame
+        AnimationCodec::Decoder decoder;
+        decoder.open(animation.data(), animation.size());
+        size_t frame_size = AnimationCodec::FrameSize(width, height);
+        for (int s = 0; s < 50; s++)
+        {
+            uint8_t index = rng() % count;
+            if (decoder.seek(index) != Status::Ok || memcmp(decoder.getFrame(), &frames[index * frame_size], frame_size) != 0)
+            {
+                if (result.seek_mismatches++ == 0) fprintf(stderr, "round trip : seek %u in sequence %u differs\n", index, n);
+            }
+        }
+
+        // corrupted copies : must not crash (the address sanitizer or valgrind catch out of bounds reads)
+        for (int c = 0; c < 20; c++)
+        {
+            std::vector<uint8_t> corrupted = animation;
+            if (c % 2 == 0) corrupted.resize(rng() % corrupted.size());
+            else corrupted[rng() % corrupted.size()] ^= 1 << (rng() % 8);
+            AnimationCodec::Decoder bad;
+            if (bad.open(corrupted.data(), corrupted.size()) == Status::Ok)
+            {
+                for (uint8_t i = 0; i < bad.getHeader().frame_count; i++) bad.seek(i);
+            }
+            result.corrupted++;
+        }
+    }
+}
+
+static void round_trip_assets(RoundTrip& result)
+{
+    uint8_t expected[SCREEN_SIZE];
+    for (const Asset& asset : ASSETS)
+    {
+        AnimationCodec::Header header;
+        std::vector<uint8_t> frames = decode_all(asset.data, asset.size);
+        if (AnimationCodec::ParseHeader(asset.data, asset.size, header) != Status::Ok || frames.empty())
+        {
+            fprintf(stderr, "assets : %s can't be decoded\n", asset.name);
+            result.asset_mismatches++;
+            continue;
+        }
+
+        std::vector<uint8_t> encoded;
+        AnimationCodec::Encode(frames.data(), header.width, header.height, header.frame_count, 0, encoded);
+        if (decode_all(encoded.data(), encoded.size()) != frames)
+        {
+            fprintf(stderr, "assets : %s differs once encoded again\n", asset.name);
+            result.asset_mismatches++;
+        }
+
+        // the widget against the previous Blit of raw frames, opaque and transparent, at a few positions
+        size_t frame_size = AnimationCodec::FrameSize(header.width, header.height);
+        for (bool transparent : { false, true })
+        {
+            for (uint8_t x : { 0, 13, 64 })
+            {
+                for (uint8_t y : { 0, 0, 3 })
+                {
+                    UIWidgets::Animation widget(asset.data, asset.size, x, y, transparent, false);
+                    for (uint8_t i = 0; i < header.frame_count; i++)
+                    {
+                        std::vector<uint8_t> rows = pages_to_rows(&frames[i * frame_size], header.width, header.height);
+                        fill_background(i);
+                        Draw::Blit<true>(x, y, header.width, header.height, rows.data(), ScreenDriver::COLOR_WHITE, transparent);
+                        memcpy(expected, ScreenDriver::info.data, SCREEN_SIZE);
+
+                        fill_background(i);
+                        widget.render();
+                        widget.update();
+                        if (memcmp(expected, ScreenDriver::info.data, SCREEN_SIZE) != 0 && result.draw_mismatches++ == 0)
+                        {
+                            fprintf(stderr, "assets : frame %u of %s at %u, %u differs from Draw::Blit\n", i, asset.name, x, y);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/** SIZE AND TIMING **/
+
+struct AssetReport
+{
+    std::string name;
+    uint32_t frames;
+    uint32_t width;
+    uint32_t height;
+    size_t raw_bytes;
+    size_t key_only_bytes;
+    size_t bytes;
+    uint32_t key_frames;
+    double blit_us;
+    double decode_us;
+    double play_us;
+};
+
+static AssetReport report_asset(const Asset& asset)
+{
+    AnimationCodec::Header header;
+    AnimationCodec::ParseHeader(asset.data, asset.size, header);
+    std::vector<uint8_t> frames = decode_all(asset.data, asset.size);
+    size_t frame_size = AnimationCodec::FrameSize(header.width, header.height);
+
+    AssetReport report{ asset.name, header.frame_count, header.width, header.height };
+    report.raw_bytes = header.width * header.height / 8 * header.frame_count;
+    report.bytes = asset.size;
+    std::vector<uint8_t> key_only;
+    AnimationCodec::Encode(frames.data(), header.width, header.height, header.frame_count, 1, key_only);
+    report.key_only_bytes = key_only.size();
+    for (uint8_t i = 0; i < header.frame_count; i++)
+    {
+        uint32_t offset;
+        memcpy(&offset, asset.data + AnimationCodec::HEADER_SIZE + 4 * i, 4);
+        report.key_frames += asset.data[offset] == AnimationCodec::FRAME_KEY;
+    }
+
+    std::vector<std::vector<uint8_t>> rows;
+    for (uint8_t i = 0; i < header.frame_count; i++) rows.push_back(pages_to_rows(&frames[i * frame_size], header.width, header.height));
+
+    // best of a few runs, each one plays the animation 200 times
+    constexpr uint32_t LOOPS = 200;
+    auto best_us = [&](auto&& body) {
+        double best = 1e9;
+        for (int run = 0; run < 5; run++)
+        {
+            Clock::time_point start = Clock::now();
+            for (uint32_t loop = 0; loop < LOOPS; loop++) body();
+            best = std::min(best, std::chrono::duration<double, std::micro>(Clock::now() - start).count() / (LOOPS * header.frame_count));
+        }
+        return best;
+    };
+
+    report.blit_us = best_us([&] {
+        for (uint8_t i = 0; i < header.frame_count; i++) Draw::Blit<true>(0, 0, header.width, header.height, rows[i].data());
+    });
+
+    AnimationCodec::Decoder decoder;
+    decoder.open(asset.data, asset.size);
+    report.decode_us = best_us([&] {
+        for (uint8_t i = 0; i < header.frame_count; i++) decoder.seek(i);
+    });
+
+    UIWidgets::Animation widget(asset.data, asset.size, 0, 0, false, true);
+    report.play_us = best_us([&] {
+        for (uint8_t i = 0; i < header.frame_count; i++)
+        {
+            widget.render();
+            widget.update();
+        }
+    });
+    return report;
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (ScreenDriver::Init() != Status::Ok)
+    {
+        fprintf(stderr, "Failed to init the screen driver\n");
+        return 1;
+    }
+
+    RoundTrip round_trip = {};
+    round_trip_sequences(round_trip);
+    round_trip_assets(round_trip);
+    bool failed = round_trip.mismatches > 0 || round_trip.seek_mismatches > 0 || round_trip.asset_mismatches > 0 ||
+                  round_trip.draw_mismatches > 0;
+
+    std::vector<AssetReport> reports;
+    for (const Asset& asset : ASSETS) reports.push_back(report_asset(asset));
+
+    if (json)
+    {
+        printf("{\"round_trip\": {\"sequences\": %u, \"frames\": %u, \"mismatches\": %u, \"seek_mismatches\": %u, "
+               "\"corrupted\": %u, \"asset_mismatches\": %u, \"draw_mismatches\": %u},\n",
+               round_trip.sequences, round_trip.frames, round_trip.mismatches, round_trip.seek_mismatches, round_trip.corrupted,
+               round_trip.asset_mismatches, round_trip.draw_mismatches);
+        printf(" \"assets\": [\n");
+        for (size_t i = 0; i < reports.size(); i++)
+        {
+            const AssetReport& r = reports[i];
+            printf("  {\"name\": \"%s\", \"frames\": %u, \"width\": %u, \"height\": %u, \"raw_bytes\": %zu, \"key_only_bytes\": %zu, "
+                   "\"bytes\": %zu, \"key_frames\": %u, \"blit_us\": %.3f, \"decode_us\": %.3f, \"play_us\": %.3f}%s\n",
+                   r.name.c_str(), r.frames, r.width, r.height, r.raw_bytes, r.key_only_bytes, r.bytes, r.key_frames, r.blit_us,
+                   r.decode_us, r.play_us, i + 1 < reports.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("round trip : %u sequences (%u frames) %s, seeks %s, %u corrupted files survived ; assets %s, drawing %s\n\n",
+               round_trip.sequences, round_trip.frames, round_trip.mismatches ? "FAILED" : "ok",
+               round_trip.seek_mismatches ? "FAILED" : "ok", round_trip.corrupted, round_trip.asset_mismatches ? "FAILED" : "ok",
+               round_trip.draw_mismatches ? "FAILED" : "ok");
+        printf("%-17s %6s %6s %9s %9s %8s %6s %9s %9s %9s\n", "asset", "frames", "keys", "raw", "keys only", "bytes", "ratio",
+               "blit us", "decode us", "play us");
+        size_t raw_total = 0, total = 0;
+        for (const AssetReport& r : reports)
+        {
+            printf("%-17s %6u %6u %9zu %9zu %8zu %5.1fx %9.2f %9.2f %9.2f\n", r.name.c_str(), r.frames, r.key_frames, r.raw_bytes,
+                   r.key_only_bytes, r.bytes, static_cast<double>(r.raw_bytes) / r.bytes, r.blit_us, r.decode_us, r.play_us);
+            raw_total += r.raw_bytes;
+            total += r.bytes;
+        }
+        printf("%-17s %6s %6s %9zu %9s %8zu %5.1fx\n", "total", "", "", raw_total, "", total, static_cast<double>(raw_total) / total);
+        printf("\nblit : previous Draw::Blit() of a raw frame, decode : one frame decoded, play : Animation::render() + update()\n");
+    }
+
+    return failed ? 2 : 0;
+}
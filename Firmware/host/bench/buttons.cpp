@@ -0,0 +1,529 @@
+/**
+ * Button input (ui/ButtonDebouncer.hpp, common/SpscQueue.hpp) : debouncing checks on synthetic bounce traces, and
+ * wakeups / latency of the event driven menus task against the previous polling.
+ *
+ * - cases : hand written traces (clean and bouncy presses, glitches, missed edges, long press, double clicks)
+ *           and the exact events they must give
+ * - session : a random session (fixed seed) of clicks, long presses, double clicks and glitches, every transition
+ *             bouncing for up to BOUNCE_MAX_US. The edges go through the SpscQueue and the debouncer like in
+ *             Button::Process(), the task sleeping until the next edge or deadline, and the events are checked
+ *             against the actions of the session
+ * - legacy : the same session seen by the previous buttons task (level polled every 50 ms, no debouncing) and
+ *            menus task (a cycle every SCREEN_REFRESH_RATE ms)
+ * - queue : SpscQueue between two threads, order and drop counter checked
+ *
+ * Latency is the time from the first edge of a press / release to the cycle handling its event (LongPressed :
+ * from BTN_LONG_PRESS_MS after the press), wakeups count the times the tasks of the brain core run.
+ * The tool exits with 2 on any event mismatch, queue error, or if the event driven input isn't faster.
+ *
+ * Usage : bench_buttons [--json] [--actions count]
+ */
+#include "ui/ButtonDebouncer.hpp"
+#include "common/SpscQueue.hpp"
+#include "common/config.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Event = ButtonDebouncer::Event;
+using Output = ButtonDebouncer::Output;
+
+constexpr uint32_t SEED = 0x360;
+constexpr int64_t MS = 1000;
+constexpr int64_t BOUNCE_MAX_US = 3000;    // contact bounce of the tactile switches
+constexpr int64_t WAKE_LATENCY_US = 50;    // GPIO interrupt to the menus task running
+constexpr uint32_t ANIMATION_FRAMES = 16;  // MenuList easing after a press (0.75^16 < ANIMATION_SNAP)
+constexpr int64_t LEGACY_POLL_MS = 50;     // previous BTN_POLL_INT_MS
+
+struct Edge
+{
+    bool level;
+    int64_t time_us;
+};
+
+static const char* event_name(Event event)
+{
+    switch (event)
+    {
+        case Event::Pressed: return "Pressed";
+        case Event::Released: return "Released";
+        case Event::Clicked: return "Clicked";
+        case Event::LongPressed: return "LongPressed";
+        case Event::Repeat: return "Repeat";
+        case Event::DoubleClicked: return "DoubleClicked";
+    }
+    return "?";
+}
+
+/// @brief Feed a trace to a debouncer (events due before each edge first, like Button::Process()), then run it to `end_us`
+static std::vector<Output> run_trace(const std::vector<Edge>& edges, int64_t end_us, bool start_level = false)
+{
+    ButtonDebouncer debouncer;
+    debouncer.reset(start_level, 0);
+    std::vector<Output> outputs;
+    Output output;
+    for (const Edge& edge : edges)
+    {
+        while (debouncer.poll(edge.time_us, output)) outputs.push_back(output);
+        debouncer.edge(edge.level, edge.time_us);
+    }
+    while (debouncer.poll(end_us, output)) outputs.push_back(output);
+    return outputs;
+}
+
+static bool same_outputs(const std::vector<Output>& got, const std::vector<Output>& expected, const char* name)
+{
+    bool same = got.size() == expected.size();
+    for (size_t i = 0; same && i < got.size(); i++)
+    {
+        same = got[i].event == expected[i].event && got[i].time_us == expected[i].time_us;
+    }
+    if (same) return true;
+
+    fprintf(stderr, "%s : events differ\n  expected :", name);
+    for (const Output& o : expected) fprintf(stderr, " %s@%lld", event_name(o.event), static_cast<long long>(o.time_us));
+    fprintf(stderr, "\n  got      :");
+    for (const Output& o : got) fprintf(stderr, " %s@%lld", event_name(o.event), static_cast<long long>(o.time_us));
+    fprintf(stderr, "\n");
+    return false;
+}
+
+/// @brief Edges of a transition to `level` at `time_us`, bouncing `bounces` times within `bounce_us`
+static void add_transition(std::vector<Edge>& edges, bool level, int64_t time_us, int bounces, int64_t bounce_us,
+                           std::mt19937& rng)
+{
+    edges.push_back({ level, time_us });
+    if (bounces == 0) return;
+
+    std::vector<int64_t> times;
+    std::uniform_int_distribution<int64_t> offset(1, bounce_us);
+    for (int i = 0; i < bounces * 2; i++) times.push_back(time_us + offset(rng));
+    std::sort(times.begin(), times.end());
+    times.erase(std::unique(times.begin(), times.end()), times.end());
+    if (times.size() % 2 != 0) times.pop_back(); // always ends on `level`
+    for (size_t i = 0; i < times.size(); i++) edges.push_back({ i % 2 == 0 ? !level : level, times[i] });
+}
+
+/// CASES
+
+static int run_cases()
+{
+    const int64_t LONG = BTN_LONG_PRESS_MS * MS;
+    const int64_t REPEAT = BTN_REPEAT_INT_MS * MS;
+    int failures = 0;
+    auto check = [&](const char* name, const std::vector<Edge>& edges, int64_t end_us, const std::vector<Output>& expected,
+                     bool start_level = false) {
+        if (!same_outputs(run_trace(edges, end_us, start_level), expected, name)) failures++;
+    };
+
+    check("clean click", { { true, 1000 }, { false, 101000 } }, 1 * 1000 * MS,
+          { { Event::Pressed, 1000 }, { Event::Released, 101000 }, { Event::Clicked, 101000 } });
+
+    check("bouncy click",
+          { { true, 1000 }, { false, 1200 }, { true, 1300 }, { false, 2500 }, { true, 2600 },
+            { false, 101000 }, { true, 101050 }, { false, 101900 } },
+          1 * 1000 * MS, { { Event::Pressed, 1000 }, { Event::Released, 101000 }, { Event::Clicked, 101000 } });
+
+    check("glitch", { { true, 1000 }, { false, 1500 }, { true, 30000 }, { false, 30000 + BTN_DEBOUNCE_MS * MS - 1 } },
+          1 * 1000 * MS, {});
+
+    check("glitch while held", { { true, 1000 }, { false, 50000 }, { true, 50400 }, { false, 200000 } }, 1 * 1000 * MS,
+          { { Event::Pressed, 1000 }, { Event::Released, 200000 }, { Event::Clicked, 200000 } });
+
+    check("missed edge", { { true, 1000 }, { true, 1400 }, { false, 90000 }, { false, 90300 } }, 1 * 1000 * MS,
+          { { Event::Pressed, 1000 }, { Event::Released, 90000 }, { Event::Clicked, 90000 } });
+
+    check("long press",
+          { { true, 0 }, { false, 200 }, { true, 400 }, { false, LONG + 2 * REPEAT + 10 * MS } }, 2 * 1000 * MS,
+          { { Event::Pressed, 0 }, { Event::LongPressed, LONG }, { Event::Repeat, LONG + REPEAT },
+            { Event::Repeat, LONG + 2 * REPEAT }, { Event::Released, LONG + 2 * REPEAT + 10 * MS } });
+
+    check("release just before the long press", { { true, 0 }, { false, LONG - 100 }, { true, LONG - 50 }, { false, LONG + 200 } },
+          1 * 1000 * MS, { { Event::Pressed, 0 }, { Event::Released, LONG - 100 }, { Event::Clicked, LONG - 100 } });
+
+    check("double click",
+          { { true, 0 }, { false, 80 * MS }, { true, 200 * MS }, { false, 290 * MS } }, 1 * 1000 * MS,
+          { { Event::Pressed, 0 }, { Event::Released, 80 * MS }, { Event::Clicked, 80 * MS },
+            { Event::Pressed, 200 * MS }, { Event::Released, 290 * MS }, { Event::Clicked, 290 * MS },
+            { Event::DoubleClicked, 290 * MS } });
+
+    check("triple click",
+          { { true, 0 }, { false, 80 * MS }, { true, 200 * MS }, { false, 290 * MS }, { true, 400 * MS }, { false, 480 * MS } },
+          1 * 1000 * MS,
+          { { Event::Pressed, 0 }, { Event::Released, 80 * MS }, { Event::Clicked, 80 * MS },
+            { Event::Pressed, 200 * MS }, { Event::Released, 290 * MS }, { Event::Clicked, 290 * MS },
+            { Event::DoubleClicked, 290 * MS }, { Event::Pressed, 400 * MS }, { Event::Released, 480 * MS },
+            { Event::Clicked, 480 * MS } });
+
+    check("slow second click",
+          { { true, 0 }, { false, 80 * MS }, { true, 80 * MS + BTN_DOUBLE_CLICK_MS * MS + 1 }, { false, 600 * MS } },
+          1 * 1000 * MS,
+          { { Event::Pressed, 0 }, { Event::Released, 80 * MS }, { Event::Clicked, 80 * MS },
+            { Event::Pressed, 80 * MS + BTN_DOUBLE_CLICK_MS * MS + 1 }, { Event::Released, 600 * MS }, { Event::Clicked, 600 * MS } });
+
+    check("held at reset", { { false, 500 * MS }, { true, 900 * MS }, { false, 950 * MS } }, 2 * 1000 * MS,
+          { { Event::Pressed, 900 * MS }, { Event::Released, 950 * MS }, { Event::Clicked, 950 * MS } }, true);
+
+    return failures;
+}
+
+/// SESSION
+
+struct Session
+{
+    std::vector<Edge> edges;
+    std::vector<Output> expected;
+    int64_t end_us;
+};
+
+static Session make_session(uint32_t actions, std::mt19937& rng)
+{
+    const int64_t LONG = BTN_LONG_PRESS_MS * MS;
+    const int64_t REPEAT = BTN_REPEAT_INT_MS * MS;
+    Session session;
+    std::uniform_int_distribution<int> kind(0, 9);
+    std::uniform_int_distribution<int> bounces(0, 6);
+    auto range = [&](int64_t min, int64_t max) { return std::uniform_int_distribution<int64_t>(min, max)(rng); };
+
+    auto press = [&](int64_t at, int64_t hold) {
+        add_transition(session.edges, true, at, bounces(rng), BOUNCE_MAX_US, rng);
+        add_transition(session.edges, false, at + hold, bounces(rng), BOUNCE_MAX_US, rng);
+    };
+
+    int64_t t = 500 * MS;
+    for (uint32_t i = 0; i < actions; i++)
+    {
+        int k = kind(rng);
+        if (k < 5) // click
+        {
+            int64_t hold = range(60 * MS, 250 * MS);
+            press(t, hold);
+            session.expected.push_back({ Event::Pressed, t });
+            session.expected.push_back({ Event::Released, t + hold });
+            session.expected.push_back({ Event::Clicked, t + hold });
+            t += hold;
+        }
+        else if (k < 7) // long press
+        {
+            int64_t hold = range(LONG + 20 * MS, 1500 * MS);
+            press(t, hold);
+            session.expected.push_back({ Event::Pressed, t });
+            session.expected.push_back({ Event::LongPressed, t + LONG });
+            for (int64_t r = t + LONG + REPEAT; r < t + hold; r += REPEAT) session.expected.push_back({ Event::Repeat, r });
+            session.expected.push_back({ Event::Released, t + hold });
+            t += hold;
+        }
+        else if (k < 9) // double click
+        {
+            int64_t hold1 = range(60 * MS, 150 * MS);
+            int64_t gap = range(60 * MS, BTN_DOUBLE_CLICK_MS * MS - 20 * MS);
+            int64_t hold2 = range(60 * MS, 150 * MS);
+            press(t, hold1);
+            press(t + hold1 + gap, hold2);
+            int64_t second = t + hold1 + gap;
+            session.expected.push_back({ Event::Pressed, t });
+            session.expected.push_back({ Event::Released, t + hold1 });
+            session.expected.push_back({ Event::Clicked, t + hold1 });
+            session.expected.push_back({ Event::Pressed, second });
+            session.expected.push_back({ Event::Released, second + hold2 });
+            session.expected.push_back({ Event::Clicked, second + hold2 });
+            session.expected.push_back({ Event::DoubleClicked, second + hold2 });
+            t = second + hold2;
+        }
+        else // glitch (shorter than the debounce delay, no event)
+        {
+            int64_t width = range(20, BTN_DEBOUNCE_MS * MS / 2);
+            session.edges.push_back({ true, t });
+            session.edges.push_back({ false, t + width });
+            t += width;
+        }
+        // idle, longer than the double click window so actions stay apart
+        t += range((BTN_DOUBLE_CLICK_MS + 50) * MS, 3000 * MS);
+    }
+    session.end_us = t;
+    return session;
+}
+
+struct Latency
+{
+    std::vector<double> samples_ms;
+
+    void add(int64_t us) { samples_ms.push_back(us / 1000.0); }
+    double mean() const
+    {
+        double sum = 0.0;
+        for (double s : samples_ms) sum += s;
+        return samples_ms.empty() ? 0.0 : sum / samples_ms.size();
+    }
+    double percentile(double p) const
+    {
+        if (samples_ms.empty()) return 0.0;
+        std::vector<double> sorted = samples_ms;
+        std::sort(sorted.begin(), sorted.end());
+        return sorted[std::min(sorted.size() - 1, static_cast<size_t>(p * sorted.size()))];
+    }
+    double max() const { return samples_ms.empty() ? 0.0 : *std::max_element(samples_ms.begin(), samples_ms.end()); }
+};
+
+struct ModelResult
+{
+    uint64_t wakeups = 0;
+    Latency click;
+    Latency long_press;
+    uint32_t wrong_events = 0; // legacy : handled presses that don't match the session
+};
+
+/// @brief The menus task of Menus.cpp : edges through the queue, sleeping until the next edge, deadline or frame
+static ModelResult run_event_driven(const Session& session, std::vector<Output>& outputs)
+{
+    ModelResult result;
+    SpscQueue<Edge, BTN_EDGE_QUEUE_SIZE> queue;
+    ButtonDebouncer debouncer;
+    debouncer.reset(false, 0);
+    const int64_t frame_us = SCREEN_REFRESH_RATE * MS;
+
+    size_t next_edge = 0;
+    bool armed = true; // the interrupt notifies the task (not while bouncing, see Button.cpp)
+    uint32_t frames_left = 0;
+    int64_t next_frame_us = 0;
+    int64_t now_us = 0;
+    while (true)
+    {
+        // next wake up : an edge (through the interrupt), a debouncer deadline or an animation frame
+        int64_t wake_us = debouncer.deadline();
+        if (armed && next_edge < session.edges.size()) wake_us = std::min(wake_us, session.edges[next_edge].time_us + WAKE_LATENCY_US);
+        if (frames_left > 0) wake_us = std::min(wake_us, next_frame_us);
+        if (wake_us == ButtonDebouncer::NO_DEADLINE) break;
+        now_us = std::max(now_us, wake_us);
+        result.wakeups++;
+
+        // the interrupt queued every edge up to now
+        while (next_edge < session.edges.size() && session.edges[next_edge].time_us <= now_us)
+        {
+            if (!queue.push(session.edges[next_edge])) fprintf(stderr, "edge queue full\n");
+            next_edge++;
+        }
+
+        Edge edge;
+        Output output;
+        std::vector<Output> events;
+        while (queue.pop(edge))
+        {
+            while (debouncer.poll(edge.time_us, output)) events.push_back(output);
+            debouncer.edge(edge.level, edge.time_us);
+        }
+        while (debouncer.poll(now_us, output)) events.push_back(output);
+        armed = !debouncer.isBouncing();
+
+        for (const Output& event : events)
+        {
+            outputs.push_back(event);
+            if (event.event == Event::Clicked) result.click.add(now_us - event.time_us);
+            else if (event.event == Event::LongPressed) result.long_press.add(now_us - event.time_us);
+            else continue;
+            // the menu animates after handling it
+            frames_left = ANIMATION_FRAMES;
+            next_frame_us = now_us + frame_us;
+        }
+
+        if (frames_left > 0 && now_us >= next_frame_us)
+        {
+            frames_left--;
+            next_frame_us += frame_us;
+        }
+    }
+    return result;
+}
+
+/// @brief The previous Button::update_task (no debouncing) and the menus task running every SCREEN_REFRESH_RATE ms
+static ModelResult run_legacy(const Session& session, std::mt19937& rng)
+{
+    ModelResult result;
+    const int64_t poll_us = LEGACY_POLL_MS * MS;
+    const int64_t frame_us = SCREEN_REFRESH_RATE * MS;
+    const int64_t poll_phase = std::uniform_int_distribution<int64_t>(0, poll_us - 1)(rng);
+    const int64_t frame_phase = std::uniform_int_distribution<int64_t>(0, frame_us - 1)(rng);
+    const int64_t MATCH_WINDOW_US = 2 * poll_us + BOUNCE_MAX_US; // long presses count from the first poll seeing the press
+    auto next_frame = [&](int64_t t) { return frame_phase + ((t - frame_phase + frame_us - 1) / frame_us) * frame_us; };
+
+    // intended clicks and long presses, to date and check what the polling saw
+    std::vector<Output> intended;
+    for (const Output& o : session.expected)
+    {
+        if (o.event == Event::Clicked || o.event == Event::LongPressed) intended.push_back(o);
+    }
+
+    size_t edge = 0;
+    bool level = false, state = false, long_pressed = false;
+    int64_t last_press = 0;
+    size_t matched = 0;
+    for (int64_t t = poll_phase; t <= session.end_us; t += poll_us)
+    {
+        while (edge < session.edges.size() && session.edges[edge].time_us <= t) level = session.edges[edge++].level;
+
+        Event event;
+        bool fired = false;
+        if (level && !state) last_press = t;
+        else if (!level && state)
+        {
+            fired = !long_pressed;
+            event = Event::Clicked;
+            long_pressed = false;
+        }
+        else if (state && t - last_press > BTN_LONG_PRESS_MS * MS && !long_pressed)
+        {
+            fired = true;
+            event = Event::LongPressed;
+            long_pressed = true;
+        }
+        state = level;
+        long_pressed &= state;
+        if (!fired) continue;
+
+        // the menus see it at their next cycle
+        int64_t shown_us = next_frame(t);
+        // presses the polling missed (too short) are left behind
+        while (matched < intended.size() && intended[matched].time_us < t - MATCH_WINDOW_US) matched++;
+        if (matched < intended.size() && intended[matched].event == event && intended[matched].time_us <= t)
+        {
+            Latency& latency = event == Event::Clicked ? result.click : result.long_press;
+            latency.add(shown_us - intended[matched].time_us);
+            matched++;
+        }
+        else
+        {
+            result.wrong_events++;
+        }
+    }
+    uint32_t recognized = result.click.samples_ms.size() + result.long_press.samples_ms.size();
+    result.wrong_events += intended.size() - recognized; // missed presses (too short for the polling)
+    result.wakeups = session.end_us / poll_us + session.end_us / frame_us;
+    return result;
+}
+
+/// QUEUE
+
+static bool run_queue(double& items_per_s)
+{
+    constexpr uint32_t ITEMS = 2'000'000;
+    static SpscQueue<uint32_t, 64> queue;
+
+    // full queue : the push is refused and counted, the queued items are kept in order
+    bool ok = true;
+    for (uint32_t i = 0; i < queue.CAPACITY; i++) ok &= queue.push(i);
+    ok &= !queue.push(UINT32_MAX) && queue.dropped() == 1 && queue.size() == queue.CAPACITY;
+    uint32_t item;
+    for (uint32_t i = 0; i < queue.CAPACITY; i++) ok &= queue.pop(item) && item == i;
+    ok &= !queue.pop(item) && queue.empty();
+    if (!ok) fprintf(stderr, "queue : full queue check failed\n");
+
+    // two threads, the producer retrying refused pushes
+    uint32_t errors = 0;
+    auto start = std::chrono::steady_clock::now();
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < ITEMS; i++)
+        {
+            while (!queue.push(i)) std::this_thread::yield();
+        }
+    });
+    std::thread consumer([&]() {
+        uint32_t value;
+        for (uint32_t expected = 0; expected < ITEMS;)
+        {
+            if (!queue.pop(value))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            if (value != expected) errors++;
+            expected++;
+        }
+    });
+    producer.join();
+    consumer.join();
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    items_per_s = ITEMS / us * 1e6;
+
+    if (errors != 0 || !queue.empty())
+    {
+        fprintf(stderr, "queue : %u items out of order, %zu left\n", errors, queue.size());
+        ok = false;
+    }
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    uint32_t actions = 2000;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--actions") == 0 && i + 1 < argc) actions = strtoul(argv[++i], nullptr, 10);
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--actions count]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    int case_failures = run_cases();
+
+    std::mt19937 rng(SEED);
+    Session session = make_session(actions, rng);
+    std::vector<Output> outputs;
+    ModelResult events = run_event_driven(session, outputs);
+    bool session_ok = same_outputs(outputs, session.expected, "session");
+    ModelResult legacy = run_legacy(session, rng);
+
+    double items_per_s = 0.0;
+    bool queue_ok = run_queue(items_per_s);
+
+    double seconds = session.end_us / 1e6;
+    bool faster = events.click.mean() < legacy.click.mean() && events.long_press.mean() < legacy.long_press.mean() &&
+                  events.wakeups < legacy.wakeups;
+    bool failed = case_failures != 0 || !session_ok || !queue_ok || !faster;
+
+    if (json)
+    {
+        printf("{\"cases_failed\": %d, \"session_ok\": %s, \"queue_ok\": %s, \"actions\": %u, \"edges\": %zu, \"seconds\": %.1f,\n",
+               case_failures, session_ok ? "true" : "false", queue_ok ? "true" : "false", actions, session.edges.size(), seconds);
+        printf(" \"queue_items_per_s\": %.0f, \"models\": [\n", items_per_s);
+        const ModelResult* models[] = { &legacy, &events };
+        const char* names[] = { "polling", "event_driven" };
+        for (int i = 0; i < 2; i++)
+        {
+            const ModelResult& m = *models[i];
+            printf("  {\"name\": \"%s\", \"wakeups_per_s\": %.2f, \"click_latency_ms\": {\"mean\": %.2f, \"p99\": %.2f, \"max\": %.2f}, "
+                   "\"long_press_latency_ms\": {\"mean\": %.2f, \"max\": %.2f}, \"wrong_events\": %u}%s\n",
+                   names[i], m.wakeups / seconds, m.click.mean(), m.click.percentile(0.99), m.click.max(),
+                   m.long_press.mean(), m.long_press.max(), m.wrong_events, i == 0 ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("cases          : %s (%d failed)\n", case_failures == 0 ? "ok" : "FAILED", case_failures);
+        printf("session        : %s (%u actions, %zu edges, %.0f s)\n", session_ok ? "ok" : "FAILED", actions,
+               session.edges.size(), seconds);
+        printf("queue          : %s (%.2f M items/s between two threads)\n\n", queue_ok ? "ok" : "FAILED", items_per_s / 1e6);
+        printf("%-14s %10s %28s %22s %8s\n", "model", "wakeups/s", "click ms (mean/p99/max)", "long ms (mean/max)", "wrong");
+        const ModelResult* models[] = { &legacy, &events };
+        const char* names[] = { "polling", "event driven" };
+        for (int i = 0; i < 2; i++)
+        {
+            const ModelResult& m = *models[i];
+            printf("%-14s %10.2f %12.2f /%6.2f /%6.2f %13.2f /%6.2f %8u\n", names[i], m.wakeups / seconds, m.click.mean(),
+                   m.click.percentile(0.99), m.click.max(), m.long_press.mean(), m.long_press.max(), m.wrong_events);
+        }
+        if (!faster) printf("\nevent driven input isn't faster than polling : FAILED\n");
+    }
+
+    return failed ? 2 : 0;
+}
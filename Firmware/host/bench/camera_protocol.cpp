@@ -0,0 +1,492 @@
+/**
+ * Camera frames over the protocol (network/protocol/CameraFrames.hpp) : chunking and reassembly checks, timestamps and
+ * control ticks ordering, then the throughput of a stream client over a loopback socket.
+ *
+ * - checks : chunk sizes asked by clients, nearest tick rounding, every frame size around the chunk size cut into
+ *            ceil(size / chunk) event messages that a client reassembles intact
+ * - ordering : protocol clients of a CameraStream fed by a synthetic 25 fps sensor, each on its own loopback socket
+ *              (socketpair, WebSocket binary frames like esp_http_server sends them). A reference client reassembles
+ *              the frames and checks every byte, the sequence, capture time and tick order, and that each tick is the
+ *              one of a simulated 200 Hz control loop (with jitter) nearest to the capture
+ * - throughput : the capture as fast as the client takes frames, one client for each chunk size, and the MJPEG
+ *                multipart stream (the port 90 server) on the same loopback for reference. Reports MB/s, frames and
+ *                messages per second and the framing overhead
+ *
+ * The tool exits with 2 if a check fails, if a frame is corrupted, abandoned, out of order or stamped with a wrong
+ * tick, or if an ordering client gets less than 90% of CAMERA_FRAME_RATE.
+ *
+ * Usage : bench_camera_protocol [--json] [--seconds s]
+ */
+#include "network/protocol/CameraFrames.hpp"
+#include "Check.hpp"
+#include <esp_timer.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Protocol;
+using CameraFrames::ChunkHeader;
+
+constexpr uint32_t SEED = 0x360;
+constexpr float SENSOR_FPS = 25.0f;
+constexpr int64_t SENSOR_PERIOD_US = static_cast<int64_t>(1e6f / SENSOR_FPS);
+constexpr int64_t EXPOSURE_US = 12000;                      // frames are stamped when they started
+constexpr size_t FRAME_SIZE[2] = { 18 * 1024, 34 * 1024 }; // VGA, quality 20
+constexpr int64_t TICK_US = static_cast<int64_t>(CONTROL_LOOP_DT_S * 1e6f);
+constexpr int64_t TICK_JITTER_US = 200;
+constexpr uint16_t CHUNK_SIZES[] = { 512, 1024, 2048, 4096, 8192, 16384 };
+
+static uint8_t pattern(uint32_t id, size_t i)
+{
+    return static_cast<uint8_t>(id * 31 + i * 7 + (i >> 8));
+}
+
+/// @brief JPEG markers around a body derived from a frame id
+static void fill_frame(uint8_t* data, size_t size, uint32_t id)
+{
+    for (size_t i = 0; i < size; i++) data[i] = pattern(id, i);
+    data[0] = 0xFF;
+    data[1] = 0xD8;
+    memcpy(data + 2, &id, sizeof(id));
+    data[size - 2] = 0xFF;
+    data[size - 1] = 0xD9;
+}
+
+static bool check_frame(const uint8_t* data, size_t size)
+{
+    if (size < 8) return size > 0 && data[0] == pattern(0, 0); // frames of the chunking checks
+    if (data[0] != 0xFF || data[1] != 0xD8 || data[size - 2] != 0xFF || data[size - 1] != 0xD9) return false;
+    uint32_t id;
+    memcpy(&id, data + 2, sizeof(id));
+    for (size_t i = 6; i < size - 2; i++)
+    {
+        if (data[i] != pattern(id, i)) return false;
+    }
+    return true;
+}
+
+/// @brief Control loop ticks every TICK_US from `start_us`, each one starting up to TICK_JITTER_US late or early
+struct ControlClock
+{
+    int64_t start_us;
+
+    static int64_t jitter(uint32_t tick) { return static_cast<int64_t>(tick * 7919u % (2 * TICK_JITTER_US + 1)) - TICK_JITTER_US; }
+    int64_t tickTime(uint32_t tick) const { return start_us + (tick - 1) * TICK_US; }
+
+    void latest(uint32_t& tick, int64_t& tick_us) const
+    {
+        int64_t now = esp_timer_get_time();
+        tick = static_cast<uint32_t>(std::max<int64_t>(0, now - start_us) / TICK_US + 1);
+        tick_us = tickTime(tick) + jitter(tick);
+    }
+};
+
+/// @brief Sensor in CAMERA_GRAB_LATEST mode, paced at SENSOR_FPS or as fast as frames are asked
+class SyntheticCamera : public CameraStream::Source
+{
+public:
+    SyntheticCamera(bool realtime) : realtime(realtime), rng(SEED)
+    {
+        for (auto& buffer : storage) buffer.resize(FRAME_SIZE[1]);
+    }
+
+    Status capture(CameraStream::Frame& out) override
+    {
+        if (realtime)
+        {
+            int64_t next = (esp_timer_get_time() / SENSOR_PERIOD_US + 1) * SENSOR_PERIOD_US;
+            std::this_thread::sleep_for(std::chrono::microseconds(next - esp_timer_get_time()));
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        int index = -1;
+        for (int i = 0; i < CAMERA_RING_SIZE + 1; i++)
+        {
+            if (!held[i])
+            {
+                index = i;
+                break;
+            }
+        }
+        if (index < 0) return Status::Failure;
+        held[index] = true;
+
+        size_t size = FRAME_SIZE[0] + rng() % (FRAME_SIZE[1] - FRAME_SIZE[0]);
+        fill_frame(storage[index].data(), size, ++frames);
+        out.data = storage[index].data();
+        out.size = size;
+        out.width = 640;
+        out.height = 480;
+        out.timestamp_us = esp_timer_get_time() - EXPOSURE_US;
+        out.handle = reinterpret_cast<void*>(static_cast<intptr_t>(index));
+        return Status::Ok;
+    }
+
+    void release(CameraStream::Frame& frame) override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        int index = static_cast<int>(reinterpret_cast<intptr_t>(frame.handle));
+        memset(storage[index].data(), 0xEE, frame.size); // a client still sending it would send garbage
+        held[index] = false;
+    }
+
+private:
+    bool realtime;
+    std::mt19937 rng;
+    std::mutex mutex;
+    std::vector<uint8_t> storage[CAMERA_RING_SIZE + 1];
+    bool held[CAMERA_RING_SIZE + 1] = {};
+    uint32_t frames = 0;
+};
+
+/// @brief Reference client : frames back from the chunk events, with their order and ticks checked
+class Reassembler
+{
+public:
+    uint32_t frames = 0;
+    uint32_t corrupted = 0;
+    uint32_t abandoned = 0;   // frames with missing chunks
+    uint32_t bad_messages = 0;
+    uint32_t out_of_order = 0; // sequence, capture time or tick going back
+    uint32_t wrong_ticks = 0;
+    uint32_t messages = 0;
+    const ControlClock* clock = nullptr;
+
+    void push(const uint8_t* message, size_t size)
+    {
+        messages++;
+        MessageHeader header;
+        ChunkHeader chunk;
+        if (size < sizeof(header) + sizeof(chunk))
+        {
+            bad_messages++;
+            return;
+        }
+        memcpy(&header, message, sizeof(header));
+        memcpy(&chunk, message + sizeof(header), sizeof(chunk));
+        size_t data_size = size - sizeof(header) - sizeof(chunk);
+        if (header.type != MessageType::Event || header.event_id != CameraFrames::EVENT_FRAME_CHUNK || header.length != size - sizeof(header) ||
+            chunk.offset + data_size > chunk.frame_size)
+        {
+            bad_messages++;
+            return;
+        }
+
+        if (chunk.offset == 0)
+        {
+            if (!data.empty()) abandoned++;
+            current = chunk;
+            data.clear();
+        }
+        else if (data.empty() || chunk.sequence != current.sequence || chunk.offset != data.size())
+        {
+            bad_messages++;
+            return;
+        }
+        const uint8_t* bytes = message + sizeof(header) + sizeof(chunk);
+        data.insert(data.end(), bytes, bytes + data_size);
+        if (data.size() == chunk.frame_size) complete();
+    }
+
+private:
+    ChunkHeader current = {};
+    std::vector<uint8_t> data;
+    bool has_last = false;
+    ChunkHeader last = {};
+
+    void complete()
+    {
+        frames++;
+        if (!check_frame(data.data(), data.size())) corrupted++;
+        if (has_last && (current.sequence <= last.sequence || current.timestamp_us <= last.timestamp_us || current.tick < last.tick)) out_of_order++;
+        if (clock != nullptr && std::llabs(clock->tickTime(current.tick) - current.timestamp_us) > TICK_US / 2 + TICK_JITTER_US) wrong_ticks++;
+        has_last = true;
+        last = current;
+        data.clear();
+    }
+};
+
+/// @brief WebSocket binary frame of a message, as sent by the server (no mask)
+static bool send_ws(int fd, const uint8_t* message, size_t size)
+{
+    uint8_t header[4] = { 0x82 };
+    size_t header_size = 2;
+    if (size < 126) header[1] = static_cast<uint8_t>(size);
+    else
+    {
+        header[1] = 126;
+        header[2] = static_cast<uint8_t>(size >> 8);
+        header[3] = static_cast<uint8_t>(size);
+        header_size = 4;
+    }
+    auto send_all = [fd](const uint8_t* data, size_t length) {
+        while (length > 0)
+        {
+            ssize_t sent = send(fd, data, length, MSG_NOSIGNAL);
+            if (sent <= 0) return false;
+            data += sent;
+            length -= sent;
+        }
+        return true;
+    };
+    return send_all(header, header_size) && send_all(message, size);
+}
+
+static bool recv_all(int fd, uint8_t* data, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t got = recv(fd, data, length, 0);
+        if (got <= 0) return false;
+        data += got;
+        length -= got;
+    }
+    return true;
+}
+
+/// @brief Read WebSocket frames until the socket closes, returns the bytes read
+static uint64_t receive_ws(int fd, Reassembler& reassembler)
+{
+    std::vector<uint8_t> message;
+    uint64_t bytes = 0;
+    uint8_t header[4];
+    while (recv_all(fd, header, 2))
+    {
+        size_t size = header[1] & 0x7F;
+        if (size == 126)
+        {
+            if (!recv_all(fd, header + 2, 2)) break;
+            size = (header[2] << 8) | header[3];
+        }
+        message.resize(size);
+        if (!recv_all(fd, message.data(), size)) break;
+        bytes += size + (size < 126 ? 2 : 4);
+        reassembler.push(message.data(), size);
+    }
+    return bytes;
+}
+
+static uint64_t receive_raw(int fd)
+{
+    uint8_t buffer[16384];
+    uint64_t bytes = 0;
+    ssize_t got;
+    while ((got = recv(fd, buffer, sizeof(buffer), 0)) > 0) bytes += got;
+    return bytes;
+}
+
+static void run_checks()
+{
+    check(CameraFrames::ChunkSize(0) == CAMERA_CHUNK_SIZE, "chunk size : default");
+    check(CameraFrames::ChunkSize(1) == CAMERA_CHUNK_MIN_SIZE, "chunk size : lower bound");
+    check(CameraFrames::ChunkSize(60000) == CAMERA_CHUNK_MAX_SIZE, "chunk size : upper bound");
+    check(CameraFrames::MessageSize(CAMERA_CHUNK_MAX_SIZE) - sizeof(MessageHeader) <= UINT16_MAX, "chunk size : fits the message length");
+
+    check(CameraFrames::NearestTick(100, 1000000, 1000000) == 100, "nearest tick : same time");
+    check(CameraFrames::NearestTick(100, 1000000, 1000000 + TICK_US / 2 - 1) == 100, "nearest tick : just before the middle");
+    check(CameraFrames::NearestTick(100, 1000000, 1000000 + TICK_US / 2) == 101, "nearest tick : middle rounds up");
+    check(CameraFrames::NearestTick(100, 1000000, 1000000 - TICK_US / 2 + 1) == 100, "nearest tick : older, just after the middle");
+    check(CameraFrames::NearestTick(100, 1000000, 1000000 - TICK_US / 2 - 1) == 99, "nearest tick : older, before the middle");
+    check(CameraFrames::NearestTick(100, 1000000, 1000000 - 3 * TICK_US) == 97, "nearest tick : three ticks older");
+    check(CameraFrames::NearestTick(2, 1000000, 0) == 0, "nearest tick : before the first tick");
+
+    // frame sizes around the chunk size, cut and put back together
+    const uint16_t chunk_size = CAMERA_CHUNK_MIN_SIZE;
+    std::vector<uint8_t> buffer(CameraFrames::MessageSize(chunk_size));
+    std::vector<uint8_t> data(4 * chunk_size + 10);
+    const size_t sizes[] = { 1, 10, chunk_size - 1u, chunk_size, chunk_size + 1u, 3u * chunk_size, 4u * chunk_size + 10 };
+    Reassembler reassembler;
+    uint32_t sequence = 0;
+    bool counts = true;
+    bool bounded = true;
+    for (size_t size : sizes)
+    {
+        if (size >= 8) fill_frame(data.data(), size, 1000 + sequence);
+        else std::fill(data.begin(), data.begin() + size, pattern(0, 0));
+        CameraStream::Frame frame = { data.data(), size, 640, 480, 1000 + 10000 * sequence, ++sequence, nullptr };
+        uint32_t messages = 0;
+        for (uint32_t offset = 0;; offset += chunk_size)
+        {
+            size_t message = CameraFrames::WriteChunk(frame, 7, offset, chunk_size, buffer.data());
+            if (message == 0) break;
+            bounded &= message <= buffer.size();
+            reassembler.push(buffer.data(), message);
+            messages++;
+        }
+        counts &= messages == (size + chunk_size - 1) / chunk_size;
+    }
+    check(counts, "chunking : ceil(size / chunk) messages");
+    check(bounded, "chunking : messages fit MessageSize()");
+    check(reassembler.frames == sequence && reassembler.corrupted == 0 && reassembler.bad_messages == 0, "chunking : frames back intact");
+    check(reassembler.out_of_order == 0, "chunking : in order");
+
+    // a message cut short, a chunk of another frame, a response : refused
+    CameraStream::Frame frame = { data.data(), 3u * chunk_size, 640, 480, 0, 99, nullptr };
+    size_t message = CameraFrames::WriteChunk(frame, 7, chunk_size, chunk_size, buffer.data());
+    Reassembler strict;
+    strict.push(buffer.data(), message);
+    strict.push(buffer.data(), 10);
+    buffer[0] = static_cast<uint8_t>(MessageType::Response);
+    strict.push(buffer.data(), message);
+    check(strict.bad_messages == 3 && strict.frames == 0, "chunking : broken messages refused");
+}
+
+struct ClientResult
+{
+    std::string name;
+    uint16_t chunk_size; // 0 for the multipart stream
+    double seconds;
+    uint64_t bytes;      // on the socket
+    uint64_t jpeg_bytes;
+    uint32_t frames;
+    uint32_t messages;
+    Reassembler reassembler;
+
+    double mbPerS() const { return bytes / seconds / 1e6; }
+    double fps() const { return frames / seconds; }
+    double overhead() const { return jpeg_bytes > 0 ? 100.0 * (bytes - jpeg_bytes) / jpeg_bytes : 0.0; }
+};
+
+/**
+ * @brief Stream clients (chunk size each, 0 for multipart) of one CameraStream over loopback sockets.
+ */
+static std::vector<ClientResult> run_stream(const std::vector<uint16_t>& chunk_sizes, bool realtime, float frame_rate, double seconds)
+{
+    SyntheticCamera camera(realtime);
+    CameraStream stream(camera, CAMERA_RING_SIZE, frame_rate);
+    ControlClock clock = { esp_timer_get_time() - 1000 * TICK_US };
+    std::vector<ClientResult> results(chunk_sizes.size());
+
+    std::vector<std::thread> threads;
+    threads.emplace_back([&stream]() { stream.runCapture(); });
+    for (size_t i = 0; i < chunk_sizes.size(); i++)
+    {
+        ClientResult& result = results[i];
+        result.chunk_size = chunk_sizes[i];
+        result.name = chunk_sizes[i] == 0 ? "multipart" : "chunks " + std::to_string(chunk_sizes[i]);
+        result.reassembler.clock = &clock;
+        threads.emplace_back([&stream, &clock, &result]() {
+            int fds[2];
+            if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) return;
+            std::thread receiver([&result, fd = fds[1]]() {
+                result.bytes = result.chunk_size == 0 ? receive_raw(fd) : receive_ws(fd, result.reassembler);
+            });
+
+            int client = stream.subscribe();
+            if (result.chunk_size == 0)
+            {
+                stream.serve(client, [fd = fds[0]](const uint8_t* data, size_t size) { return send(fd, data, size, MSG_NOSIGNAL) == static_cast<ssize_t>(size); });
+            }
+            else
+            {
+                std::vector<uint8_t> buffer(CameraFrames::MessageSize(result.chunk_size));
+                CameraFrames::Serve(stream, client, result.chunk_size, buffer.data(),
+                    [&clock](uint32_t& tick, int64_t& tick_us) { clock.latest(tick, tick_us); },
+                    [fd = fds[0]](const uint8_t* message, size_t size) { return send_ws(fd, message, size); });
+            }
+            CameraStream::ClientStats stats = {};
+            stream.getClientStats(client, stats);
+            result.frames = stats.frames;
+            result.jpeg_bytes = stats.bytes;
+            stream.unsubscribe(client);
+
+            shutdown(fds[0], SHUT_WR);
+            receiver.join();
+            close(fds[0]);
+            close(fds[1]);
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    stream.stop();
+    for (std::thread& thread : threads) thread.join();
+    for (ClientResult& result : results)
+    {
+        result.seconds = seconds;
+        result.messages = result.reassembler.messages;
+    }
+    return results;
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    double seconds = 2.0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = std::max(0.5, atof(argv[++i]));
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--seconds s]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    run_checks();
+
+    std::vector<ClientResult> ordering = run_stream({ CAMERA_CHUNK_SIZE, CAMERA_CHUNK_MIN_SIZE }, true, CAMERA_FRAME_RATE, seconds);
+    for (ClientResult& result : ordering)
+    {
+        const Reassembler& r = result.reassembler;
+        result.name = "ordering " + result.name;
+        check(r.corrupted == 0 && r.bad_messages == 0, ("frames intact (" + result.name + ")").c_str());
+        check(r.abandoned == 0 && r.frames == result.frames, ("every frame sent is complete (" + result.name + ")").c_str());
+        check(r.out_of_order == 0, ("sequence, capture time and tick in order (" + result.name + ")").c_str());
+        check(r.wrong_ticks == 0, ("nearest control tick (" + result.name + ")").c_str());
+        check(result.fps() >= 0.9 * CAMERA_FRAME_RATE, ("frame rate held (" + result.name + ")").c_str());
+    }
+
+    std::vector<ClientResult> throughput;
+    for (uint16_t chunk_size : CHUNK_SIZES)
+    {
+        std::vector<ClientResult> run = run_stream({ chunk_size }, false, 1000.0f, seconds / 2);
+        check(run[0].reassembler.corrupted == 0 && run[0].reassembler.bad_messages == 0 && run[0].reassembler.out_of_order == 0,
+              ("frames intact (" + run[0].name + ")").c_str());
+        throughput.push_back(run[0]);
+    }
+    throughput.push_back(run_stream({ 0 }, false, 1000.0f, seconds / 2)[0]);
+    bool failed = check_failures != 0;
+
+    std::vector<const ClientResult*> all;
+    for (const ClientResult& r : ordering) all.push_back(&r);
+    for (const ClientResult& r : throughput) all.push_back(&r);
+
+    if (json)
+    {
+        printf("{\"checks_failed\": %d, \"seconds\": %.1f, \"target_fps\": %.1f, \"runs\": [\n", check_failures, seconds, CAMERA_FRAME_RATE);
+        for (size_t i = 0; i < all.size(); i++)
+        {
+            const ClientResult& r = *all[i];
+            printf("  {\"name\": \"%s\", \"chunk_size\": %u, \"mb_per_s\": %.2f, \"fps\": %.1f, \"messages_per_s\": %.0f, \"overhead_pct\": %.2f, "
+                   "\"corrupted\": %u, \"wrong_ticks\": %u}%s\n", r.name.c_str(), r.chunk_size, r.mbPerS(), r.fps(), r.messages / r.seconds, r.overhead(),
+                   r.reassembler.corrupted, r.reassembler.wrong_ticks, i + 1 < all.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("checks      : %s (%d failed)\n", check_failures == 0 ? "ok" : "FAILED", check_failures);
+        printf("ordering    : %.1f s, sensor %.0f fps, stream %.0f fps, control loop %d Hz\n", seconds, SENSOR_FPS, CAMERA_FRAME_RATE, CONTROL_LOOP_FREQ_HZ);
+        printf("throughput  : %.1f s each, capture as fast as the client sends, loopback socket\n\n", seconds / 2);
+        printf("%-26s %8s %8s %11s %10s %10s\n", "client", "MB/s", "fps", "messages/s", "overhead", "bad ticks");
+        for (const ClientResult* r : all)
+        {
+            printf("%-26s %8.2f %8.1f %11.0f %9.2f%% %10u\n", r->name.c_str(), r->mbPerS(), r->fps(), r->messages / r->seconds, r->overhead(),
+                   r->reassembler.wrong_ticks);
+        }
+        if (failed) printf("\nFAILED\n");
+    }
+
+    return check_exit_code();
+}
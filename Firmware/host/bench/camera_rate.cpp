@@ -0,0 +1,369 @@
+/**
+ * Camera rate controller (drivers/CameraRateController.hpp) : checks of the ladder decisions, then streams over link
+ * throughput traces against the previous fixed settings (VGA, quality 20, CAMERA_FRAME_RATE).
+ *
+ * - checks : baseline of new clients, immediate down step, up steps after CAMERA_UP_UPDATES updates, latency limit,
+ *            pressure mode hysteresis
+ * - traces : link throughput over time, synthesized (`good` LAN, `walk` away from the AP and back, `interference`
+ *            bursts, `congested` AP) or read from `--trace file` (CSV lines `seconds,bytes_per_s`, recorded with
+ *            iperf for instance). Each trace runs `--seconds` in 1 ms steps
+ * - simulation : the sensor makes frames at the capture rate, their size is the nominal size of the level scaled by
+ *                a slowly changing scene and noise. One client sends the newest frame it hasn't sent (as CameraStream
+ *                does) at the link throughput plus a fixed cost per frame, the controller gets its stats every
+ *                CAMERA_CONTROL_INTERVAL_MS
+ * - pressure : the `good` trace with a control loop load going over CAMERA_PRESSURE_LOAD for a while
+ *
+ * Reports the delivered frame rate, the stall time (gaps between delivered frames over two frame periods), the mean
+ * latency, the mean level and the level changes of each run.
+ *
+ * The tool exits with 2 if a check fails, if the controller stalls longer than the fixed settings on a weak trace,
+ * if it doesn't keep level DEFAULT_LEVEL or above on the good trace, if it changes level more than MAX_STEADY_CHANGES
+ * times on the congested (steady) trace, or if the pressure mode isn't entered and left as expected.
+ *
+ * Usage : bench_camera_rate [--json] [--seconds s] [--trace file]
+ */
+#include "drivers/CameraRateController.hpp"
+#include "Check.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+constexpr uint32_t SEED = 0x360;
+constexpr double SEND_OVERHEAD_BYTES = 1500;  // multipart headers, TCP acks and scheduling, per frame
+constexpr double SCENE_SCALE = 1.25;          // the scene makes JPEG frames bigger than the nominal ones
+constexpr double SCENE_SWING = 0.25;
+constexpr double SCENE_PERIOD_S = 50.0;
+constexpr double SIZE_NOISE = 0.12;
+constexpr int64_t STALL_GAP_US = static_cast<int64_t>(2e6 / CAMERA_FRAME_RATE);
+constexpr uint32_t MAX_STEADY_CHANGES = 6;
+
+/// @brief Link throughput over time, linear between points
+struct Trace
+{
+    std::string name;
+    std::vector<std::pair<double, double>> points; // seconds, bytes per second
+    bool weak;
+
+    double at(double t) const
+    {
+        if (points.empty()) return 0.0;
+        if (t <= points.front().first) return points.front().second;
+        for (size_t i = 1; i < points.size(); i++)
+        {
+            if (t > points[i].first) continue;
+            const auto& [t0, b0] = points[i - 1];
+            const auto& [t1, b1] = points[i];
+            return t1 > t0 ? b0 + (b1 - b0) * (t - t0) / (t1 - t0) : b1;
+        }
+        return points.back().second;
+    }
+};
+
+/// @brief Trace with a point every 100 ms, `base(t)` with a relative jitter
+static Trace synthesize(const char* name, bool weak, double seconds, double jitter, const std::function<double(double)>& base)
+{
+    std::mt19937 rng(SEED);
+    std::uniform_real_distribution<double> noise(-jitter, jitter);
+    Trace trace = { name, {}, weak };
+    for (double t = 0.0; t <= seconds + 0.1; t += 0.1) trace.points.push_back({ t, std::max(1e3, base(t) * (1.0 + noise(rng))) });
+    return trace;
+}
+
+static std::vector<Trace> synthesized_traces(double seconds)
+{
+    std::vector<Trace> traces;
+    traces.push_back(synthesize("good", false, seconds, 0.1, [](double) { return 2.5e6; }));
+    traces.push_back(synthesize("walk", true, seconds, 0.15, [seconds](double t) {
+        // away from the AP in the first third, at the far end in the second, back in the last
+        double x = t / seconds;
+        double far = x < 1.0 / 3 ? x * 3 : x < 2.0 / 3 ? 1.0 : (1.0 - x) * 3;
+        return 1.5e6 * std::pow(60e3 / 1.5e6, far);
+    }));
+    traces.push_back(synthesize("interference", true, seconds, 0.15, [](double t) {
+        // a microwave oven or a busy neighbour channel : a few seconds at a crawl every 15 s
+        double phase = std::fmod(t, 15.0);
+        return phase > 8.0 && phase < 8.0 + 2.0 + std::fmod(t / 15.0, 1.0) * 3.0 ? 50e3 : 800e3;
+    }));
+    traces.push_back(synthesize("congested", true, seconds, 0.3, [](double) { return 180e3; }));
+    return traces;
+}
+
+static bool read_trace(const char* path, Trace& out)
+{
+    FILE* file = fopen(path, "r");
+    if (file == nullptr) return false;
+    out = { std::string("file:") + path, {}, true };
+    char line[256];
+    while (fgets(line, sizeof(line), file))
+    {
+        double t = 0.0;
+        double rate = 0.0;
+        if (line[0] == '#' || sscanf(line, "%lf,%lf", &t, &rate) != 2) continue; // comments and header
+        out.points.push_back({ t, std::max(1e3, rate) });
+    }
+    fclose(file);
+    return !out.points.empty();
+}
+
+struct RunResult
+{
+    std::string name;
+    bool adaptive;
+    double fps;
+    double stall_s;
+    double latency_ms;
+    double mean_level;
+    uint32_t changes;
+    uint32_t pressure_updates;
+    std::vector<CameraRateController::Settings> updates; // settings after each update (adaptive runs)
+};
+
+/**
+ * @brief Stream over a trace, with the controller or at the fixed settings.
+ * @param load Control loop load at a time in seconds (the pressure mode), nullptr for an idle control loop.
+ */
+static RunResult run(const Trace& trace, double seconds, bool adaptive, const std::function<float(double)>* load = nullptr)
+{
+    std::mt19937 rng(SEED);
+    std::normal_distribution<double> noise(0.0, SIZE_NOISE);
+    CameraRateController controller;
+    CameraRateController::Settings settings = controller.getSettings();
+
+    RunResult result = { trace.name, adaptive, 0.0, 0.0, 0.0, 0.0, 0, 0, {} };
+    CameraStream::ClientStats stats = {};
+    int64_t next_capture_us = 0;
+    int64_t newest_us = 0;
+    double newest_bytes = 0.0;
+    uint32_t newest_sequence = 0;
+    uint32_t sent_sequence = 0;
+    bool sending = false;
+    double remaining = 0.0;
+    int64_t send_start_us = 0;
+    int64_t sending_capture_us = 0;
+    double sending_bytes = 0.0;
+    int64_t last_delivery_us = 0;
+    double latency_sum = 0.0;
+    double level_sum = 0.0;
+
+    int64_t steps = static_cast<int64_t>(seconds * 1000);
+    for (int64_t step = 0; step < steps; step++)
+    {
+        int64_t now = step * 1000;
+        double t = now * 1e-6;
+
+        // paced captures, as CameraStream::capture()
+        if (now >= next_capture_us)
+        {
+            int64_t period = static_cast<int64_t>(1e6f / settings.frame_rate);
+            next_capture_us += period;
+            if (next_capture_us <= now) next_capture_us = now + period;
+            double scene = SCENE_SCALE + SCENE_SWING * std::sin(2.0 * M_PI * t / SCENE_PERIOD_S);
+            newest_bytes = CameraRateController::LEVELS[settings.level].nominal_bytes * scene * std::clamp(1.0 + noise(rng), 0.6, 1.6);
+            newest_us = now;
+            newest_sequence++;
+        }
+
+        // the client takes the newest frame once the previous one is sent
+        if (!sending && newest_sequence > sent_sequence)
+        {
+            sending = true;
+            sent_sequence = newest_sequence;
+            sending_bytes = newest_bytes;
+            sending_capture_us = newest_us;
+            remaining = newest_bytes + SEND_OVERHEAD_BYTES;
+            send_start_us = now;
+        }
+        if (sending)
+        {
+            remaining -= trace.at(t) / 1000.0;
+            if (remaining <= 0.0)
+            {
+                int64_t done = now + 1000;
+                sending = false;
+                stats.frames++;
+                stats.bytes += static_cast<uint64_t>(sending_bytes);
+                stats.busy_us += done - send_start_us;
+                stats.latency_us = static_cast<uint32_t>(done - sending_capture_us);
+                latency_sum += stats.latency_us;
+                level_sum += settings.level;
+                result.stall_s += std::max<int64_t>(0, done - last_delivery_us - STALL_GAP_US) * 1e-6;
+                last_delivery_us = done;
+            }
+        }
+
+        if (adaptive && (step + 1) % CAMERA_CONTROL_INTERVAL_MS == 0)
+        {
+            controller.observe(0, stats);
+            uint8_t level = settings.level;
+            settings = controller.update(now + 1000, load != nullptr ? (*load)(t) : 0.2f);
+            if (settings.level != level) result.changes++;
+            result.updates.push_back(settings);
+        }
+    }
+    result.stall_s += std::max<int64_t>(0, steps * 1000 - last_delivery_us - STALL_GAP_US) * 1e-6;
+
+    result.fps = stats.frames / seconds;
+    result.latency_ms = stats.frames > 0 ? latency_sum / stats.frames / 1000.0 : 0.0;
+    result.mean_level = stats.frames > 0 ? level_sum / stats.frames : 0.0;
+    result.pressure_updates = controller.getStats().pressure_updates;
+    return result;
+}
+
+/// @brief Observe a client with totals (frames, bytes, busy time) and update at `t_s`
+static CameraRateController::Settings feed(CameraRateController& controller, double t_s, uint32_t frames, uint64_t bytes,
+                                           double busy_s, uint32_t latency_ms = 50, int64_t since_us = 0, float load = 0.2f)
+{
+    CameraStream::ClientStats stats = {};
+    stats.frames = frames;
+    stats.bytes = bytes;
+    stats.busy_us = static_cast<uint64_t>(busy_s * 1e6);
+    stats.latency_us = latency_ms * 1000;
+    stats.since_us = since_us;
+    controller.observe(0, stats);
+    return controller.update(static_cast<int64_t>(t_s * 1e6), load);
+}
+
+static void run_checks()
+{
+    constexpr uint32_t F = static_cast<uint32_t>(CAMERA_FRAME_RATE);
+    using Controller = CameraRateController;
+
+    {
+        Controller controller;
+        check(controller.update(0, 0.2f).level == Controller::DEFAULT_LEVEL, "no client : level held");
+        check(controller.update(1000000, 0.2f).level == Controller::DEFAULT_LEVEL, "no client : level held again");
+        // a new client only gives its baseline, then a client changing its subscription time starts again
+        feed(controller, 2.0, 0, 0, 0.0);
+        check(feed(controller, 3.0, F, F * 25000ull, 1.0, 50, 0).level == 5, "down at once to the fitting level");
+        check(controller.getStats().downs == 1, "one down step");
+        Controller::Settings settings = feed(controller, 4.0, 10 * F, 10 * F * 2500ull, 10.0, 50, 3000000);
+        check(settings.level == 5 && controller.getStats().downs == 1, "new client : no measure before its baseline");
+    }
+    {
+        Controller controller(CAMERA_FRAME_RATE, 0);
+        feed(controller, 0.0, 0, 0, 0.0);
+        check(feed(controller, 1.0, F, F * 2500ull, 0.1).level == 0, "up : not after one update");
+        check(feed(controller, 2.0, 2 * F, 2 * F * 2500ull, 0.2).level == 0, "up : not after two updates");
+        check(feed(controller, 3.0, 3 * F, 3 * F * 2500ull, 0.3).level == 1, "up : one level after CAMERA_UP_UPDATES");
+    }
+    {
+        Controller controller;
+        feed(controller, 0.0, 0, 0, 0.0);
+        Controller::Settings settings = feed(controller, 1.0, F, F * 25000ull, 0.1, CAMERA_MAX_LATENCY_MS + 100);
+        check(settings.level == Controller::DEFAULT_LEVEL - 1, "latency over the limit : one level down");
+        // no up step during the cooldown, even with a fast link
+        for (int i = 0; i < CAMERA_DOWN_COOLDOWN_UPDATES; i++)
+        {
+            settings = feed(controller, 2.0 + i, (2 + i) * F, (2 + i) * F * 21000ull, 0.1 * (2 + i));
+        }
+        check(settings.level == Controller::DEFAULT_LEVEL - 1, "cooldown after a down step");
+    }
+    {
+        Controller controller;
+        check(!feed(controller, 0.0, 0, 0, 0.0, 50, 0, 0.5f).pressure, "no pressure under the load limit");
+        Controller::Settings settings = feed(controller, 1.0, 0, 0, 0.0, 50, 0, CAMERA_PRESSURE_LOAD);
+        check(settings.pressure && settings.frame_rate == CAMERA_PRESSURE_FRAME_RATE, "pressure at once");
+        settings = feed(controller, 2.0, 0, 0, 0.0, 50, 0, 0.7f);
+        check(settings.pressure, "pressure held between the two limits");
+        for (int i = 0; i < CAMERA_UP_UPDATES; i++) settings = feed(controller, 3.0 + i, 0, 0, 0.0, 50, 0, 0.3f);
+        check(!settings.pressure && settings.frame_rate == CAMERA_FRAME_RATE, "pressure left after CAMERA_UP_UPDATES relieved updates");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    double seconds = 120.0;
+    const char* trace_path = nullptr;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = std::max(10.0, atof(argv[++i]));
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) trace_path = argv[++i];
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--seconds s] [--trace file]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    run_checks();
+
+    std::vector<Trace> traces = synthesized_traces(seconds);
+    if (trace_path != nullptr)
+    {
+        Trace trace;
+        if (!read_trace(trace_path, trace))
+        {
+            fprintf(stderr, "can't read a trace from %s\n", trace_path);
+            return 1;
+        }
+        traces.push_back(trace);
+    }
+
+    std::vector<RunResult> results;
+    for (const Trace& trace : traces)
+    {
+        RunResult fixed = run(trace, seconds, false);
+        RunResult adaptive = run(trace, seconds, true);
+        if (trace.name == "good")
+        {
+            check(adaptive.mean_level >= CameraRateController::DEFAULT_LEVEL, "good link : default level or better");
+        }
+        else if (trace.weak && trace.name.compare(0, 5, "file:") != 0)
+        {
+            check(adaptive.stall_s < fixed.stall_s, ("less stall than the fixed settings (" + trace.name + ")").c_str());
+            check(adaptive.fps > fixed.fps, ("more frames than the fixed settings (" + trace.name + ")").c_str());
+        }
+        if (trace.name == "congested") check(adaptive.changes <= MAX_STEADY_CHANGES, "steady link : bounded level changes");
+        results.push_back(fixed);
+        results.push_back(adaptive);
+    }
+
+    // load over the pressure limit from 30% to 50% of the run
+    std::function<float(double)> load = [seconds](double t) { return t >= 0.3 * seconds && t < 0.5 * seconds ? 1.1f : 0.3f; };
+    RunResult pressure = run(traces[0], seconds, true, &load);
+    pressure.name = "good+pressure";
+    {
+        auto at = [&pressure, seconds](double x) { return pressure.updates[static_cast<size_t>(x * seconds * 1000 / CAMERA_CONTROL_INTERVAL_MS)]; };
+        check(!at(0.25).pressure && at(0.25).frame_rate == CAMERA_FRAME_RATE, "pressure : not before the load");
+        check(at(0.32).pressure && at(0.45).pressure && at(0.45).frame_rate == CAMERA_PRESSURE_FRAME_RATE, "pressure : entered under load");
+        check(!at(0.6).pressure && at(0.6).frame_rate == CAMERA_FRAME_RATE, "pressure : left once the load is gone");
+        check(pressure.pressure_updates >= 0.2 * seconds * 1000 / CAMERA_CONTROL_INTERVAL_MS, "pressure : held while loaded");
+    }
+    results.push_back(pressure);
+    bool failed = check_failures != 0;
+
+    if (json)
+    {
+        printf("{\"checks_failed\": %d, \"seconds\": %.0f, \"target_fps\": %.1f, \"runs\": [\n", check_failures, seconds, CAMERA_FRAME_RATE);
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const RunResult& r = results[i];
+            printf("  {\"trace\": \"%s\", \"adaptive\": %s, \"fps\": %.2f, \"stall_s\": %.2f, \"latency_ms\": %.0f, \"mean_level\": %.2f, \"changes\": %u, "
+                   "\"pressure_updates\": %u}%s\n", r.name.c_str(), r.adaptive ? "true" : "false", r.fps, r.stall_s, r.latency_ms, r.mean_level,
+                   r.changes, r.pressure_updates, i + 1 < results.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("checks      : %s (%d failed)\n", check_failures == 0 ? "ok" : "FAILED", check_failures);
+        printf("runs        : %.0f s each, target %.0f fps, fixed settings at level %u\n\n", seconds, CAMERA_FRAME_RATE, CameraRateController::DEFAULT_LEVEL);
+        printf("%-24s %-9s %7s %9s %12s %10s %8s\n", "trace", "settings", "fps", "stall (s)", "latency (ms)", "mean level", "changes");
+        for (const RunResult& r : results)
+        {
+            printf("%-24s %-9s %7.2f %9.2f %12.0f %10.2f %8u\n", r.name.c_str(), r.adaptive ? "adaptive" : "fixed", r.fps, r.stall_s, r.latency_ms,
+                   r.mean_level, r.changes);
+        }
+        if (failed) printf("\nFAILED\n");
+    }
+
+    return check_exit_code();
+}
@@ -0,0 +1,512 @@
+/**
+ * Camera stream fan-out (drivers/CameraStream.hpp) : checks of the frame ring, then stream clients on fake sockets
+ * against the previous per-client capture loop.
+ *
+ * - checks : pacing and deadlines, subscriptions, newest frame and dropped count, ring full, timeouts, stop, and every
+ *            captured frame given back to the source
+ * - streams : a synthetic sensor makes JPEG-like frames at SENSOR_FPS (sizes of a VGA frame, content derived from the
+ *             capture number so each client checks every byte it sends). `fast` clients have a LAN-like link, `slow`
+ *             ones can't take every frame, a `stall` client blocks in a send for STALL_MS once. Each run lasts
+ *             `--seconds` of real time
+ * - legacy : the same clients in the previous stream handler loop (esp_camera_fb_get() per client, one frame buffer
+ *            filled again only once it was given back, no pacing). The client giving the buffer back asks for it again
+ *            at once, so the others mostly starve (on the robot they got nothing : the single esp_http_server task
+ *            was busy with the first stream)
+ *
+ * The tool exits with 2 if a check fails, if a client sends a corrupted frame, if the source sees more frames held
+ * than it has buffers, or if fast clients of the fan-out don't hold 90% of CAMERA_FRAME_RATE in every run.
+ *
+ * Usage : bench_camera_stream [--json] [--seconds s]
+ */
+#include "drivers/CameraStream.hpp"
+#include "Check.hpp"
+#include <esp_timer.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+constexpr uint32_t SEED = 0x360;
+constexpr float SENSOR_FPS = 25.0f;                      // OV2640 JPEG VGA
+constexpr int64_t SENSOR_PERIOD_US = static_cast<int64_t>(1e6f / SENSOR_FPS);
+constexpr size_t FRAME_SIZE[2] = { 18 * 1024, 34 * 1024 }; // VGA, quality 20
+constexpr double FAST_BYTES_PER_S = 2.0e6;
+constexpr double SLOW_BYTES_PER_S = 150e3;                // about 6 frames per second
+constexpr int64_t STALL_MS = 1500;
+
+static void sleep_until_us(int64_t time_us)
+{
+    int64_t now = esp_timer_get_time();
+    if (time_us > now) std::this_thread::sleep_for(std::chrono::microseconds(time_us - now));
+}
+
+/// @brief Byte `i` of the frame with capture number `sequence`
+static uint8_t pattern(uint32_t sequence, size_t i)
+{
+    return static_cast<uint8_t>(sequence * 31 + i * 7 + (i >> 8));
+}
+
+/// @brief JPEG markers around a body derived from the capture number
+static void fill_frame(uint8_t* data, size_t size, uint32_t sequence)
+{
+    for (size_t i = 0; i < size; i++) data[i] = pattern(sequence, i);
+    data[0] = 0xFF;
+    data[1] = 0xD8;
+    memcpy(data + 2, &sequence, sizeof(sequence));
+    data[size - 2] = 0xFF;
+    data[size - 1] = 0xD9;
+}
+
+static bool check_frame(const uint8_t* data, size_t size)
+{
+    if (size < 8 || data[0] != 0xFF || data[1] != 0xD8 || data[size - 2] != 0xFF || data[size - 1] != 0xD9) return false;
+    uint32_t sequence;
+    memcpy(&sequence, data + 2, sizeof(sequence));
+    for (size_t i = 6; i < size - 2; i++)
+    {
+        if (data[i] != pattern(sequence, i)) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Camera driver in CAMERA_GRAB_LATEST mode : the sensor runs at SENSOR_FPS, a capture returns the next frame
+ *        completed into one of `buffers` frame buffers.
+ */
+class SyntheticCamera : public CameraStream::Source
+{
+public:
+    SyntheticCamera(int buffers, bool realtime) : buffers(buffers), realtime(realtime), rng(SEED)
+    {
+        for (int i = 0; i < buffers; i++) storage.emplace_back(FRAME_SIZE[1]);
+        free_buffers.resize(buffers, true);
+    }
+
+    Status capture(CameraStream::Frame& out) override
+    {
+        if (realtime) sleep_until_us((esp_timer_get_time() / SENSOR_PERIOD_US + 1) * SENSOR_PERIOD_US);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = std::find(free_buffers.begin(), free_buffers.end(), true);
+        if (it == free_buffers.end())
+        {
+            overheld = true; // the driver has no frame buffer left
+            return Status::Failure;
+        }
+        *it = false;
+        int index = static_cast<int>(it - free_buffers.begin());
+        held = std::max(held, static_cast<int>(std::count(free_buffers.begin(), free_buffers.end(), false)));
+
+        size_t size = FRAME_SIZE[0] + rng() % (FRAME_SIZE[1] - FRAME_SIZE[0]);
+        fill_frame(storage[index].data(), size, ++frames);
+        out.data = storage[index].data();
+        out.size = size;
+        out.width = 640;
+        out.height = 480;
+        out.timestamp_us = esp_timer_get_time();
+        out.handle = reinterpret_cast<void*>(static_cast<intptr_t>(index));
+        return Status::Ok;
+    }
+
+    void release(CameraStream::Frame& frame) override
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        int index = static_cast<int>(reinterpret_cast<intptr_t>(frame.handle));
+        memset(storage[index].data(), 0xEE, frame.size); // a client still sending it would notice
+        free_buffers[index] = true;
+        released++;
+    }
+
+    int outstanding()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return static_cast<int>(std::count(free_buffers.begin(), free_buffers.end(), false));
+    }
+
+    const int buffers;
+    const bool realtime;
+    uint32_t frames = 0;
+    uint32_t released = 0;
+    int held = 0;
+    bool overheld = false;
+
+private:
+    std::mutex mutex;
+    std::mt19937 rng;
+    std::vector<std::vector<uint8_t>> storage;
+    std::vector<bool> free_buffers;
+};
+
+/**
+ * @brief Camera driver with one frame buffer in CAMERA_GRAB_WHEN_EMPTY mode (previous setup) : once the buffer is
+ *        given back, the sensor waits for the next frame start and fills it during a whole frame.
+ */
+class LegacyCamera
+{
+public:
+    const uint8_t* get(size_t& size)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        returned.wait(lock, [this]() { return !held; });
+        held = true;
+        int64_t ready = (returned_at_us / SENSOR_PERIOD_US + 2) * SENSOR_PERIOD_US;
+        lock.unlock();
+        sleep_until_us(ready);
+
+        size = FRAME_SIZE[0] + rng() % (FRAME_SIZE[1] - FRAME_SIZE[0]);
+        fill_frame(buffer.data(), size, ++frames);
+        return buffer.data();
+    }
+
+    void put()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        memset(buffer.data(), 0xEE, buffer.size());
+        held = false;
+        returned_at_us = esp_timer_get_time();
+        returned.notify_one();
+    }
+
+    uint32_t frames = 0;
+
+private:
+    std::mutex mutex;
+    std::condition_variable returned;
+    bool held = false;
+    int64_t returned_at_us = 0;
+    std::mt19937 rng{SEED};
+    std::vector<uint8_t> buffer = std::vector<uint8_t>(FRAME_SIZE[1]);
+};
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Fake sockets
+
+enum class Link { Fast, Slow, Stall };
+
+static const char* link_name(Link link)
+{
+    switch (link)
+    {
+        case Link::Fast: return "fast";
+        case Link::Slow: return "slow";
+        case Link::Stall: return "stall";
+    }
+    return "?";
+}
+
+/// @brief Client socket sending at the rate of its link, checking the frames it sends
+struct FakeSocket
+{
+    Link link;
+    int64_t end_us;
+    int64_t stall_at_us;
+    int64_t free_at_us = 0;
+    uint32_t frames = 0;
+    uint32_t dropped = 0;
+    uint32_t corrupted = 0;
+    uint32_t last_sequence = 0;
+    uint64_t bytes = 0;
+
+    bool send(const uint8_t* data, size_t size)
+    {
+        int64_t now = esp_timer_get_time();
+        if (now >= end_us) return false;
+
+        // frame data (the multipart headers are less than 128 bytes)
+        if (size > 1024)
+        {
+            if (!check_frame(data, size)) corrupted++;
+            uint32_t sequence;
+            memcpy(&sequence, data + 2, sizeof(sequence));
+            if (last_sequence != 0 && sequence > last_sequence + 1) dropped += sequence - last_sequence - 1;
+            last_sequence = sequence;
+            frames++;
+        }
+        bytes += size;
+
+        double rate = link == Link::Slow ? SLOW_BYTES_PER_S : FAST_BYTES_PER_S;
+        free_at_us = std::max(free_at_us, now) + static_cast<int64_t>(size * 1e6 / rate);
+        if (link == Link::Stall && stall_at_us != 0 && now >= stall_at_us)
+        {
+            free_at_us += STALL_MS * 1000;
+            stall_at_us = 0;
+        }
+        sleep_until_us(free_at_us);
+
+        // a frame still held by this client must not have been given back meanwhile
+        if (size > 1024 && !check_frame(data, size)) corrupted++;
+        return true;
+    }
+};
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Runs
+
+struct ClientResult
+{
+    Link link;
+    double fps;
+    uint32_t dropped;
+    uint32_t corrupted;
+    double kb_per_s;
+};
+
+struct RunResult
+{
+    std::string name;
+    std::vector<ClientResult> clients;
+    double captures_per_s;
+    uint32_t ring_full;
+    int held;
+    bool overheld;
+    uint32_t leaked;
+
+    double minFps(Link link) const
+    {
+        double fps = 1e9;
+        for (const ClientResult& c : clients)
+        {
+            if (c.link == link) fps = std::min(fps, c.fps);
+        }
+        return fps == 1e9 ? 0.0 : fps;
+    }
+};
+
+static std::string run_name(const std::vector<Link>& links)
+{
+    std::string name;
+    for (Link link : links) name += std::string(name.empty() ? "" : "+") + link_name(link);
+    return name;
+}
+
+static RunResult run_fanout(const std::vector<Link>& links, double seconds)
+{
+    SyntheticCamera camera(CAMERA_RING_SIZE + 1, true);
+    CameraStream stream(camera);
+    int64_t start = esp_timer_get_time();
+    int64_t end = start + static_cast<int64_t>(seconds * 1e6);
+
+    std::thread capture([&stream]() { stream.runCapture(); });
+    std::vector<FakeSocket> sockets(links.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < links.size(); i++)
+    {
+        sockets[i] = { links[i], end, start + static_cast<int64_t>(seconds * 0.3e6) };
+        threads.emplace_back([&stream, &socket = sockets[i]]() {
+            int client = stream.subscribe();
+            stream.serve(client, [&socket](const uint8_t* data, size_t size) { return socket.send(data, size); });
+            stream.unsubscribe(client);
+        });
+    }
+    for (std::thread& t : threads) t.join();
+    CameraStream::Stats stats = stream.getStats();
+    stream.stop();
+    capture.join();
+
+    RunResult result = { "fan-out " + run_name(links) };
+    for (const FakeSocket& s : sockets) result.clients.push_back({ s.link, s.frames / seconds, s.dropped, s.corrupted, s.bytes / 1024.0 / seconds });
+    result.captures_per_s = stats.captured / seconds;
+    result.ring_full = stats.ring_full;
+    result.held = camera.held;
+    result.overheld = camera.overheld;
+    result.leaked = camera.outstanding();
+    return result;
+}
+
+static RunResult run_legacy(const std::vector<Link>& links, double seconds)
+{
+    LegacyCamera camera;
+    int64_t start = esp_timer_get_time();
+    int64_t end = start + static_cast<int64_t>(seconds * 1e6);
+
+    std::vector<FakeSocket> sockets(links.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < links.size(); i++)
+    {
+        sockets[i] = { links[i], end, start + static_cast<int64_t>(seconds * 0.3e6) };
+        threads.emplace_back([&camera, &socket = sockets[i]]() {
+            char header[128];
+            while (true)
+            {
+                size_t size;
+                const uint8_t* data = camera.get(size);
+                int length = snprintf(header, sizeof(header), "--%s\r\nContent-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n",
+                                      CameraStream::BOUNDARY, static_cast<unsigned>(size));
+                size_t header_size = std::min(static_cast<size_t>(length), sizeof(header) - 1); // never past a truncated header
+                bool sent = socket.send(reinterpret_cast<const uint8_t*>(header), header_size) && socket.send(data, size);
+                camera.put();
+                if (!sent) break;
+            }
+        });
+    }
+    for (std::thread& t : threads) t.join();
+
+    RunResult result = { "legacy " + run_name(links) };
+    for (const FakeSocket& s : sockets) result.clients.push_back({ s.link, s.frames / seconds, s.dropped, s.corrupted, s.bytes / 1024.0 / seconds });
+    result.captures_per_s = camera.frames / seconds;
+    result.held = 1;
+    return result;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Checks
+
+static void run_checks()
+{
+    SyntheticCamera camera(CAMERA_RING_SIZE + 1, false);
+    {
+        CameraStream stream(camera, CAMERA_RING_SIZE, 10.0f);
+        check(stream.deadline() == CameraStream::NO_DEADLINE, "no deadline without client");
+        check(stream.capture(0) == Status::Ok && camera.frames == 0, "no capture without client");
+
+        int a = stream.subscribe();
+        int b = stream.subscribe();
+        check(a >= 0 && b >= 0 && a != b, "subscribe");
+        for (int i = 2; i < CAMERA_MAX_CLIENTS; i++) stream.subscribe();
+        check(stream.subscribe() == -1, "client limit");
+        for (int i = 0; i < CAMERA_MAX_CLIENTS; i++)
+        {
+            if (i != a && i != b) stream.unsubscribe(i);
+        }
+        check(stream.getStats().clients == 2, "client count");
+
+        // pacing : one capture per 100 ms, a late capture paces the next ones from it
+        stream.capture(1000);
+        check(camera.frames == 1 && stream.deadline() == 100000, "first capture and deadline");
+        stream.capture(50000);
+        check(camera.frames == 1, "capture not due");
+        stream.capture(350000);
+        check(camera.frames == 2 && stream.deadline() == 450000, "late capture");
+        stream.capture(400000);
+        check(camera.frames == 2, "no burst after a late capture");
+        stream.capture(450000);
+        check(camera.frames == 3 && stream.deadline() == 550000, "capture after a late one");
+
+        // a client gets the newest frame, the frames it missed count as dropped
+        const CameraStream::Frame* frame_a = stream.acquire(a, 10);
+        check(frame_a != nullptr && frame_a->sequence == 3, "newest frame");
+        CameraStream::ClientStats stats;
+        check(stream.getClientStats(a, stats) && stats.dropped == 2, "dropped frames");
+        check(stream.acquire(a, 10) == nullptr, "timeout without a new frame");
+
+        // a holds frame 3, b holds frame 4, the ring holds frame 5 : no slot for a 6th one
+        stream.capture(550000);
+        const CameraStream::Frame* frame_b = stream.acquire(b, 10);
+        check(frame_b != nullptr && frame_b->sequence == 4, "second client");
+        stream.capture(650000);
+        check(camera.outstanding() == 3, "frames held");
+        stream.capture(750000);
+        check(stream.getStats().ring_full == 1 && camera.frames == 5, "ring full");
+        check(check_frame(frame_a->data, frame_a->size) && check_frame(frame_b->data, frame_b->size), "held frames intact");
+
+        size_t size_a = frame_a->size;
+        stream.release(a, frame_a, 750000);
+        check(stream.getClientStats(a, stats) && stats.frames == 1 && stats.bytes == size_a, "client stats");
+        stream.capture(850000);
+        check(camera.frames == 6 && camera.outstanding() == 2, "capture after a release"); // frame 5 went back with the ring reference
+        stream.release(b, frame_b, 850000);
+        check(camera.outstanding() == 1, "frames given back");
+
+        stream.unsubscribe(a);
+        stream.unsubscribe(b);
+        check(camera.outstanding() == 0, "newest frame given back without client");
+        check(!stream.getClientStats(a, stats), "unsubscribed client");
+
+        // stop wakes a waiting client
+        int c = stream.subscribe();
+        std::thread stopper([&stream]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            stream.stop();
+        });
+        int64_t waited = esp_timer_get_time();
+        check(stream.acquire(c, 5000) == nullptr && esp_timer_get_time() - waited < 1000000, "stop wakes the clients");
+        stopper.join();
+        check(stream.serve(c, [](const uint8_t*, size_t) { return true; }) == Status::Ok, "serve after stop");
+        stream.unsubscribe(c);
+    }
+    check(camera.released == camera.frames && camera.outstanding() == 0 && !camera.overheld, "every frame given back");
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    double seconds = 2.5;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = std::max(0.5, atof(argv[++i]));
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--seconds s]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    run_checks();
+
+    const std::vector<std::vector<Link>> scenarios = {
+        { Link::Fast },
+        { Link::Fast, Link::Fast },
+        { Link::Fast, Link::Fast, Link::Fast },
+        { Link::Fast, Link::Fast, Link::Slow },
+        { Link::Fast, Link::Stall },
+    };
+    std::vector<RunResult> results;
+    for (const auto& links : scenarios)
+    {
+        results.push_back(run_legacy(links, seconds));
+        results.push_back(run_fanout(links, seconds));
+    }
+
+    bool paced = true;
+    for (const RunResult& r : results)
+    {
+        for (const ClientResult& c : r.clients) check(c.corrupted == 0, ("frames sent intact (" + r.name + ")").c_str());
+        if (r.name.compare(0, 7, "fan-out") != 0) continue;
+        check(!r.overheld && r.held <= CAMERA_RING_SIZE + 1 && r.leaked == 0, ("frame buffers (" + r.name + ")").c_str());
+        paced &= r.minFps(Link::Fast) >= 0.9 * CAMERA_FRAME_RATE;
+    }
+    check(paced, "fast clients hold the frame rate");
+    bool failed = check_failures != 0;
+
+    if (json)
+    {
+        printf("{\"checks_failed\": %d, \"seconds\": %.1f, \"target_fps\": %.1f, \"sensor_fps\": %.1f, \"runs\": [\n", check_failures, seconds, CAMERA_FRAME_RATE, SENSOR_FPS);
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const RunResult& r = results[i];
+            printf("  {\"name\": \"%s\", \"captures_per_s\": %.1f, \"ring_full\": %u, \"clients\": [", r.name.c_str(), r.captures_per_s, r.ring_full);
+            for (size_t j = 0; j < r.clients.size(); j++)
+            {
+                const ClientResult& c = r.clients[j];
+                printf("{\"link\": \"%s\", \"fps\": %.1f, \"dropped\": %u, \"kb_per_s\": %.0f}%s", link_name(c.link), c.fps, c.dropped, c.kb_per_s,
+                       j + 1 < r.clients.size() ? ", " : "");
+            }
+            printf("]}%s\n", i + 1 < results.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("checks      : %s (%d failed)\n", check_failures == 0 ? "ok" : "FAILED", check_failures);
+        printf("runs        : %.1f s each, target %.0f fps, sensor %.0f fps, ring of %u frames\n\n", seconds, CAMERA_FRAME_RATE, SENSOR_FPS, CAMERA_RING_SIZE);
+        printf("%-28s %10s %9s   %s\n", "run", "captures/s", "ring full", "clients (fps / dropped)");
+        for (const RunResult& r : results)
+        {
+            printf("%-28s %10.1f %9u  ", r.name.c_str(), r.captures_per_s, r.ring_full);
+            for (const ClientResult& c : r.clients) printf(" %s %4.1f / %-4u", link_name(c.link), c.fps, c.dropped);
+            printf("\n");
+        }
+        if (failed) printf("\nFAILED\n");
+    }
+
+    return check_exit_code();
+}
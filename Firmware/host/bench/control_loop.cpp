@@ -0,0 +1,71 @@
+/**
+ * Control loop throughput on the host : runs the unmodified ControlLoop::control_task()
+ * (sensors read, state estimation, gait planner, IK, joint commands) against the fake drivers,
+ * with a virtual clock advanced by CONTROL_LOOP_DT_MS every tick.
+ *
+ * Usage : bench_control_loop [ticks]
+ */
+#include "locomotion/Body.hpp"
+#include "locomotion/ControlLoop.hpp"
+#include "locomotion/IPC.hpp"
+#include "common/config.hpp"
+#include "host/HostClock.hpp"
+#include "host/FakeDrivers.hpp"
+#include "esp_log_timestamp.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char** argv)
+{
+    long ticks = argc > 1 ? strtol(argv[1], nullptr, 10) : 20000;
+    if (ticks <= 0)
+    {
+        fprintf(stderr, "usage: %s [ticks]\n", argv[0]);
+        return 1;
+    }
+
+    HostClock::SetVirtual(true);
+
+    Body body;
+    ControlLoop control_loop(body);
+
+    if (body.init() != Status::Ok || body.enable() != Status::Ok)
+    {
+        fprintf(stderr, "Failed to initialize the body\n");
+        return 1;
+    }
+
+    // Walk forward, like the brain core would ask it
+    IPC::ControlIntent intent;
+    intent.gait = GaitPlanner::GaitType::Walk;
+    intent.body_pos = Vec3f(0.f, 0.f, DEFAULT_BODY_HEIGHT_M);
+    intent.body_vel = Vec3f(0.1f, 0.f, 0.f);
+
+    long failed = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < ticks; i++)
+    {
+        intent.timestamp_ms = esp_log_timestamp();
+        IPC::setIntent(intent);
+
+        if (control_loop.control_task() != Status::Ok)
+        {
+            failed++;
+        }
+        HostClock::Advance(CONTROL_LOOP_DT_MS * 1000);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double elapsed_s = std::chrono::duration<double>(end - start).count();
+    double ticks_per_s = ticks / elapsed_s;
+
+    printf("ticks        : %ld (%ld failed)\n", ticks, failed);
+    printf("motor frames : %u\n", FakeDrivers::GetMotor().send_count);
+    printf("elapsed      : %.3f s\n", elapsed_s);
+    printf("throughput   : %.0f ticks/s (%.2f us/tick)\n", ticks_per_s, elapsed_s * 1e6 / ticks);
+    printf("vs real-time : x%.1f (%d Hz)\n", ticks_per_s / CONTROL_LOOP_FREQ_HZ, CONTROL_LOOP_FREQ_HZ);
+
+    body.deinit();
+    return failed == 0 ? 0 : 2;
+}
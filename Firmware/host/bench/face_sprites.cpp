@@ -0,0 +1,441 @@
+/**
+ * Eye sprites of the Face menu (ui/FaceEyes.hpp, ui/SpriteCache.hpp) against the previous renderer, which drew the
+ * rounded rectangles and lid triangles with the primitives on every frame.
+ *
+ * - golden : animated eyes (looks, blinks, sizes, every lid, emotion changes) drawn by the previous MenuFace::onRender
+ *   code and by FaceEyes::Render(), with and without the cache, must give the same screen bytes
+ * - blit : cached circles blitted at random positions, partly or fully outside of the screen, against a pixel by
+ *   pixel reference, with a budget small enough to evict all the time (the budget must never be exceeded)
+ * - timing : us per Face frame (clear and both eyes) for the previous code, FaceEyes without the cache and FaceEyes
+ *   with the cache, on an idle sequence (looks moving, a blink every few seconds) and an emotions sequence (lids
+ *   moving between a few expressions), with the cache hit rate
+ *
+ * Exits with 2 if a frame differs or the budget is exceeded.
+ *
+ * Usage : bench_face_sprites [--json]
+ */
+#include "common/config.hpp"
+#include "drivers/ScreenDriver.hpp"
+#include "ui/Draw.hpp"
+#include "ui/FaceEyes.hpp"
+#include "ui/SpriteCache.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t SEED = 0x360;
+constexpr size_t FRAME_SIZE = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
+constexpr uint8_t EYES_SIZE = 30;
+
+/** PREVIOUS RENDERER (MenuFace::onRender before the sprite cache, kept as the reference) **/
+
+static void draw_face_primitives(const FaceEyesInfo& base_infos)
+{
+    const FaceEyesInfo& eyes_info = base_infos;
+
+    uint8_t m_eyes_size = EYES_SIZE * base_infos.size;
+    float look_x_right = -(-base_infos.look_x*2 - base_infos.look_x*base_infos.look_x);
+    float look_x_left = base_infos.look_x*2 - base_infos.look_x*base_infos.look_x;
+    
+    Draw::RectRounded( // right eye white
+        ScreenDriver::info.width / 4  + look_x_right * 10.0f - m_eyes_size / 2,
+        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f,
+        m_eyes_size,
+        m_eyes_size * base_infos.open_right,
+        7,
+        ScreenDriver::COLOR_WHITE
+    );
+    if (eyes_info.lid_in_right > 0.001f) Draw::TriangleFilled( // right eyelid in
+        ScreenDriver::info.width / 4  + look_x_right * 10.0f - m_eyes_size / 2,
+        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f,
+        ScreenDriver::info.width / 4  + look_x_right * 10.0f + m_eyes_size / 2,
+        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f,
+        ScreenDriver::info.width / 4  + look_x_right * 10.0f + m_eyes_size / 2,
+        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f + (base_infos.lid_in_right * m_eyes_size * base_infos.open_right),
+        ScreenDriver::COLOR_BLACK
+    );
+    if (eyes_info.lid_out_right > 0.001f) Draw::TriangleFilled( // right eyelid out
+        ScreenDriver::info.width / 4  + look_x_right * 10.0f - m_eyes_size / 2,
+        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f,
+        ScreenDriver::info.width / 4  + look_x_right * 10.0f - m_eyes_size / 2,
+        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f + (base_infos.lid_out_right * m_eyes_size * base_infos.open_right),
+        ScreenDriver::info.width / 4  + look_x_right * 10.0f + m_eyes_size / 2,
+        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f,
+        ScreenDriver::COLOR_BLACK
+    );
+    if (eyes_info.lid_bottom_right > 0.001f) Draw::TriangleFilled( // right eyelid bottom
+        ScreenDriver::info.width / 4  + look_x_right * 10.0f + m_eyes_size / 2,
+        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f + (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f,
+        ScreenDriver::info.width / 4  + look_x_right * 10.0f - m_eyes_size / 2,
+        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f + (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f,
+        ScreenDriver::info.width / 4  + look_x_right * 10.0f,
+        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f + (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f - (base_infos.lid_bottom_right * m_eyes_size * base_infos.open_right),
+        ScreenDriver::COLOR_BLACK
+    );
+
+    Draw::RectRounded( // left eye white
+        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f - m_eyes_size / 2,
+        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f,
+        m_eyes_size,
+        m_eyes_size * base_infos.open_left,
+        7,
+        ScreenDriver::COLOR_WHITE
+    );
+    if (eyes_info.lid_in_left > 0.001f) Draw::TriangleFilled( // left eyelid in
+        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f - m_eyes_size / 2,
+        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f,
+        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f + m_eyes_size / 2,
+        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f,
+        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f - m_eyes_size / 2,
+        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f + (base_infos.lid_in_left * m_eyes_size * base_infos.open_left),
+        ScreenDriver::COLOR_BLACK
+    );
+    if (eyes_info.lid_out_left > 0.001f) Draw::TriangleFilled( // left eyelid out
+        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f - m_eyes_size / 2,
+        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f,
+        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f + m_eyes_size / 2,
+        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f + (base_infos.lid_out_left * m_eyes_size * base_infos.open_left),
+        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f + m_eyes_size / 2,
+        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f,
+        ScreenDriver::COLOR_BLACK
+    );
+    if (eyes_info.lid_bottom_left > 0.001f) Draw::TriangleFilled( // left eyelid bottom
+        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f + m_eyes_size / 2,
+        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f + (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f,
+        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f - m_eyes_size / 2,
+        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f + (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f,
+        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f,
+        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f + (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f - (base_infos.lid_bottom_left * m_eyes_size * base_infos.open_left),
+        ScreenDriver::COLOR_BLACK
+    );
+}
+
+/** EYES SEQUENCES **/
+
+/// @brief Random eyes covering every parameter (kept on screen : the previous code didn't clip)
+static FaceEyesInfo random_eyes(std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    auto lid = [&]() { return unit(rng) < 0.5f ? 0.0f : unit(rng); };
+    FaceEyesInfo eyes = {};
+    eyes.look_x = unit(rng) * 1.8f - 0.9f;
+    eyes.look_y = unit(rng) * 1.8f - 0.9f;
+    eyes.skew = unit(rng) * 0.6f - 0.3f;
+    eyes.size = 0.8f + unit(rng) * 0.3f;
+    // a quarter of the frames reuse a few openings, so the cache is hit too
+    eyes.open_left = unit(rng) < 0.25f ? (rng() % 4) * 0.4f : unit(rng) * 1.2f;
+    eyes.open_right = unit(rng) < 0.5f ? eyes.open_left : unit(rng) * 1.2f;
+    eyes.lid_in_left = lid();
+    eyes.lid_in_right = lid();
+    eyes.lid_out_left = lid();
+    eyes.lid_out_right = lid();
+    eyes.lid_bottom_left = lid();
+    eyes.lid_bottom_right = lid();
+    return eyes;
+}
+
+/**
+ * @brief Eyes of the Face menu over time, like Behavior_Idle at 30 fps : looks moving every 2 to 6 s with small moves
+ *        every 300 to 800 ms, a 150 ms blink every 3 to 7 s. With `emotions`, the lids also move to a new expression
+ *        every 2 to 4 s.
+ */
+static std::vector<FaceEyesInfo> face_sequence(uint32_t frames, bool emotions)
+{
+    struct Expression { float open, lid_in, lid_out, lid_bottom; };
+    static const Expression EXPRESSIONS[] = {
+        { 1.2f, 0.0f, 0.0f, 0.0f }, // neutral
+        { 1.2f, 0.5f, 0.0f, 0.0f }, // angry
+        { 1.2f, 0.0f, 0.5f, 0.0f }, // sad
+        { 1.2f, 0.0f, 0.0f, 0.6f }, // happy
+        { 0.6f, 0.0f, 0.3f, 0.0f }, // sleepy
+    };
+    constexpr uint32_t FRAME_MS = 1000 / SCREEN_REFRESH_RATE;
+
+    std::mt19937 rng(SEED);
+    std::vector<FaceEyesInfo> sequence;
+    uint32_t next_look = 0, next_small_look = 0, next_blink = 3000, next_expression = 0;
+    float look_x = 0, look_y = 0, target_x = 0, target_y = 0, small_x = 0, small_y = 0, small_target_x = 0, small_target_y = 0;
+    Expression current = EXPRESSIONS[0], target = EXPRESSIONS[0];
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        uint32_t t = i * FRAME_MS;
+        if (t >= next_look)
+        {
+            next_look = t + 2000 + rng() % 4000;
+            target_x = (rng() % 1800) / 1000.0f - 0.9f;
+            target_y = (rng() % 1800) / 1000.0f - 0.9f;
+        }
+        if (t >= next_small_look)
+        {
+            next_small_look = t + 300 + rng() % 500;
+            small_target_x = (rng() % 200) / 1000.0f - 0.1f;
+            small_target_y = (rng() % 200) / 1000.0f - 0.1f;
+        }
+        if (emotions && t >= next_expression)
+        {
+            next_expression = t + 2000 + rng() % 2000;
+            target = EXPRESSIONS[rng() % (sizeof(EXPRESSIONS) / sizeof(EXPRESSIONS[0]))];
+        }
+        look_x += (target_x - look_x) * 0.1f;
+        look_y += (target_y - look_y) * 0.1f;
+        small_x += (small_target_x - small_x) * 0.5f;
+        small_y += (small_target_y - small_y) * 0.5f;
+        // expressions settle in a few frames (then stay still, like the face does)
+        auto approach = [](float& value, float goal) { value = std::fabs(goal - value) < 0.02f ? goal : value + (goal - value) * 0.3f; };
+        approach(current.open, target.open);
+        approach(current.lid_in, target.lid_in);
+        approach(current.lid_out, target.lid_out);
+        approach(current.lid_bottom, target.lid_bottom);
+
+        float open = current.open;
+        if (t >= next_blink)
+        {
+            float progress = (t - next_blink) / 150.0f;
+            if (progress >= 1.0f) next_blink = t + 3000 + rng() % 4000;
+            else open *= progress < 0.5f ? 1.0f - progress * 2.0f : (progress - 0.5f) * 2.0f;
+        }
+
+        FaceEyesInfo eyes = {};
+        eyes.look_x = look_x + small_x;
+        eyes.look_y = look_y + small_y;
+        eyes.size = 1.0f;
+        eyes.open_left = eyes.open_right = open;
+        eyes.lid_in_left = eyes.lid_in_right = current.lid_in;
+        eyes.lid_out_left = eyes.lid_out_right = current.lid_out;
+        eyes.lid_bottom_left = eyes.lid_bottom_right = current.lid_bottom;
+        sequence.push_back(eyes);
+    }
+    return sequence;
+}
+
+/** GOLDEN CHECKS **/
+
+struct Golden
+{
+    uint32_t frames;
+    uint32_t cached_mismatches;
+    uint32_t uncached_mismatches;
+    uint32_t blits;
+    uint32_t blit_mismatches;
+    uint32_t budget_exceeded;
+};
+
+/// @brief Draw over a random background, so the transparent pixels of the sprites are checked too
+static void fill_background(uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    for (size_t i = 0; i < FRAME_SIZE; i++) ScreenDriver::info.data[i] = rng() & (i % 3 == 0 ? 0xFF : 0x00);
+}
+
+static bool same_as(const uint8_t* expected)
+{
+    return memcmp(ScreenDriver::info.data, expected, FRAME_SIZE) == 0;
+}
+
+static void golden_faces(Golden& result)
+{
+    std::mt19937 rng(SEED);
+    std::vector<FaceEyesInfo> states;
+    for (uint32_t i = 0; i < 3000; i++) states.push_back(random_eyes(rng));
+    for (const FaceEyesInfo& eyes : face_sequence(2000, true)) states.push_back(eyes);
+
+    uint8_t expected[FRAME_SIZE];
+    for (bool cached : { true, false })
+    {
+        FaceEyes::SetCacheEnabled(cached);
+        for (uint32_t i = 0; i < states.size(); i++)
+        {
+            fill_background(i);
+            draw_face_primitives(states[i]);
+            memcpy(expected, ScreenDriver::info.data, FRAME_SIZE);
+
+            fill_background(i);
+            FaceEyes::Render(states[i]);
+            if (!same_as(expected))
+            {
+                uint32_t& mismatches = cached ? result.cached_mismatches : result.uncached_mismatches;
+                if (mismatches++ == 0) fprintf(stderr, "golden : face %u differs (%s)\n", i, cached ? "cached" : "uncached");
+            }
+        }
+    }
+    FaceEyes::SetCacheEnabled(true);
+    result.frames = states.size();
+}
+
+/// @brief Reference of Draw::BlitMasked<true>, one pixel at a time
+static void blit_pixels(int16_t x, int16_t y, const SpriteCache::Sprite& sprite)
+{
+    for (uint16_t j = 0; j < sprite.height; j++)
+    {
+        for (uint16_t i = 0; i < sprite.width; i++)
+        {
+            uint16_t index = (j / 8) * sprite.width + i;
+            if ((sprite.mask[index] >> (j % 8) & 1) == 0) continue;
+            if (x + i < 0 || x + i >= SCREEN_WIDTH || y + j < 0 || y + j >= SCREEN_HEIGHT) continue;
+            Draw::Pixel(x + i, y + j, (sprite.value[index] >> (j % 8) & 1) != 0);
+        }
+    }
+}
+
+static void golden_blits(Golden& result)
+{
+    constexpr size_t BUDGET = 2048; // a handful of circles
+    SpriteCache cache;
+    if (cache.init(BUDGET, 16) != Status::Ok)
+    {
+        result.budget_exceeded++;
+        return;
+    }
+
+    std::mt19937 rng(SEED);
+    uint8_t expected[FRAME_SIZE];
+    for (uint32_t i = 0; i < 20000; i++)
+    {
+        // ring of radius r and thickness t : white disc with a black hole (a transparent corner around it)
+        uint8_t key[2] = { static_cast<uint8_t>(2 + rng() % 28), static_cast<uint8_t>(1 + rng() % 4) };
+        uint16_t size = 2 * key[0] + 1;
+        const SpriteCache::Sprite* sprite = cache.get(key, sizeof(key), size, size, [&](bool coverage) {
+            Draw::CircleFilled(key[0], key[0], key[0], ScreenDriver::COLOR_WHITE);
+            if (key[0] > key[1]) Draw::CircleFilled(key[0], key[0], key[0] - key[1], coverage ? ScreenDriver::COLOR_WHITE : ScreenDriver::COLOR_BLACK);
+        });
+        if (cache.getStats().bytes > BUDGET) result.budget_exceeded++;
+        if (sprite == nullptr) continue;
+
+        int16_t x = static_cast<int16_t>(rng() % (SCREEN_WIDTH + 2 * size)) - size;
+        int16_t y = static_cast<int16_t>(rng() % (SCREEN_HEIGHT + 2 * size)) - size;
+        fill_background(i);
+        blit_pixels(x, y, *sprite);
+        memcpy(expected, ScreenDriver::info.data, FRAME_SIZE);
+        fill_background(i);
+        Draw::BlitMasked<true>(x, y, sprite->width, sprite->height, sprite->value, sprite->mask);
+        result.blits++;
+        if (!same_as(expected) && result.blit_mismatches++ == 0)
+        {
+            fprintf(stderr, "golden : blit %u (radius %u at %d, %d) differs\n", i, key[0], x, y);
+        }
+    }
+}
+
+/** TIMING **/
+
+struct Timing
+{
+    std::string sequence;
+    uint32_t frames;
+    double previous_us;
+    double uncached_us;
+    double cached_us;
+    double hit_rate;
+    uint32_t evictions;
+    uint32_t max_bytes;
+};
+
+enum class Renderer { Previous, Uncached, Cached };
+
+/// @brief us per frame of a whole sequence, from a cold cache (best of a few runs)
+static double time_sequence(const std::vector<FaceEyesInfo>& sequence, Renderer renderer, SpriteCache::Stats* stats, uint32_t* max_bytes)
+{
+    double best = 1e9;
+    for (int run = 0; run < 5; run++)
+    {
+        FaceEyes::SetCacheEnabled(false); // drops the cache
+        FaceEyes::SetCacheEnabled(renderer == Renderer::Cached);
+        uint32_t peak = 0;
+
+        Clock::time_point start = Clock::now();
+        for (const FaceEyesInfo& eyes : sequence)
+        {
+            ScreenDriver::Clear();
+            if (renderer == Renderer::Previous) draw_face_primitives(eyes);
+            else FaceEyes::Render(eyes);
+            if (max_bytes) peak = std::max(peak, FaceEyes::GetCacheStats().bytes);
+        }
+        double us = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / sequence.size();
+        best = std::min(best, us);
+        if (stats) *stats = FaceEyes::GetCacheStats();
+        if (max_bytes) *max_bytes = peak;
+    }
+    FaceEyes::SetCacheEnabled(true);
+    return best;
+}
+
+static Timing time_faces(const char* name, bool emotions)
+{
+    constexpr uint32_t FRAMES = 9000; // 5 minutes at 30 fps
+    std::vector<FaceEyesInfo> sequence = face_sequence(FRAMES, emotions);
+
+    Timing result{ name, FRAMES };
+    SpriteCache::Stats stats = {};
+    result.previous_us = time_sequence(sequence, Renderer::Previous, nullptr, nullptr);
+    result.uncached_us = time_sequence(sequence, Renderer::Uncached, nullptr, nullptr);
+    result.cached_us = time_sequence(sequence, Renderer::Cached, &stats, &result.max_bytes);
+    result.hit_rate = stats.hits + stats.misses > 0 ? static_cast<double>(stats.hits) / (stats.hits + stats.misses) : 0.0;
+    result.evictions = stats.evictions;
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (ScreenDriver::Init() != Status::Ok)
+    {
+        fprintf(stderr, "Failed to init the screen driver\n");
+        return 1;
+    }
+
+    Golden golden = {};
+    golden_faces(golden);
+    golden_blits(golden);
+    bool failed = golden.cached_mismatches > 0 || golden.uncached_mismatches > 0 || golden.blit_mismatches > 0 || golden.budget_exceeded > 0;
+
+    std::vector<Timing> timings = { time_faces("idle", false), time_faces("emotions", true) };
+
+    if (json)
+    {
+        printf("{\"golden\": {\"frames\": %u, \"cached_mismatches\": %u, \"uncached_mismatches\": %u, \"blits\": %u, "
+               "\"blit_mismatches\": %u, \"budget_exceeded\": %u},\n",
+               golden.frames, golden.cached_mismatches, golden.uncached_mismatches, golden.blits, golden.blit_mismatches, golden.budget_exceeded);
+        printf(" \"budget_bytes\": %u, \"timing\": [\n", static_cast<unsigned>(FACE_SPRITE_CACHE_SIZE));
+        for (size_t i = 0; i < timings.size(); i++)
+        {
+            const Timing& t = timings[i];
+            printf("  {\"sequence\": \"%s\", \"frames\": %u, \"previous_us\": %.3f, \"uncached_us\": %.3f, \"cached_us\": %.3f, "
+                   "\"hit_rate\": %.4f, \"evictions\": %u, \"max_bytes\": %u}%s\n",
+                   t.sequence.c_str(), t.frames, t.previous_us, t.uncached_us, t.cached_us, t.hit_rate, t.evictions, t.max_bytes,
+                   i + 1 < timings.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("golden : %u face frames, cached %s, uncached %s ; %u blits %s, budget %s\n\n", golden.frames,
+               golden.cached_mismatches ? "FAILED" : "ok", golden.uncached_mismatches ? "FAILED" : "ok", golden.blits,
+               golden.blit_mismatches ? "FAILED" : "ok", golden.budget_exceeded ? "EXCEEDED" : "ok");
+        printf("us per Face frame (clear + eyes), cache budget %u bytes\n", static_cast<unsigned>(FACE_SPRITE_CACHE_SIZE));
+        printf("%-9s %7s %9s %9s %9s %8s %9s %10s\n", "sequence", "frames", "previous", "uncached", "cached", "hits", "evictions", "max bytes");
+        for (const Timing& t : timings)
+        {
+            printf("%-9s %7u %9.2f %9.2f %9.2f %7.1f%% %9u %10u   (%.2fx)\n", t.sequence.c_str(), t.frames, t.previous_us, t.uncached_us,
+                   t.cached_us, t.hit_rate * 100, t.evictions, t.max_bytes, t.previous_us / t.cached_us);
+        }
+    }
+
+    return failed ? 2 : 0;
+}
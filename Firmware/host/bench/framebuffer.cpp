@@ -0,0 +1,752 @@
+/**
+ * Page-packed 1bpp frame buffer (drivers/ScreenDriver.hpp, ui/Draw.hpp) against the previous renderer, which kept
+ * one bool per pixel and packed them into panel pages on every upload.
+ *
+ * - golden : random scenes of every primitive (visible and clipped shapes, safe and unsafe modes, both colors), a sweep
+ *   of circle / rounded rectangle radii and animated Face frames are drawn by both renderers, the panel bytes must be
+ *   identical
+ * - primitives : ns per call of each primitive, previous renderer vs page-packed one
+ * - face : frames per second of the Face menu frame (clear, both eyes with their lids, upload to the fake panel). The
+ *   page-packed upload compares the drawn spans with the panel content to send less over I2C (see bench_screen_upload),
+ *   which costs more host time than the previous full copy
+ *
+ * Exits with 2 if a frame differs.
+ *
+ * Usage : bench_framebuffer [--json]
+ */
+#include "common/config.hpp"
+#include "drivers/ScreenDriver.hpp"
+#include "host/FakeDrivers.hpp"
+#include "ui/Draw.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+constexpr uint32_t SEED = 0x360;
+constexpr size_t FRAME_SIZE = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
+
+static inline uint64_t read_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/** PREVIOUS RENDERER (kept as the reference) **/
+
+static bool legacy_screen[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+// ui/Draw.hpp before the page-packed frame buffer, drawing in legacy_screen
+namespace LegacyDraw
+{
+    template <bool SafeMode = false>
+    void Pixel(uint16_t x, uint16_t y, bool c = true)
+    {
+        if constexpr (SafeMode)
+        {
+            if (x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return;
+        }
+        legacy_screen[y * SCREEN_WIDTH + x] = c;
+    }
+
+    template <bool SafeMode = false>
+    void Line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, bool c = true)
+    {
+        int16_t dx = std::abs(x2 - x1);
+        int16_t dy = std::abs(y2 - y1);
+        
+        int16_t sx = (x1 < x2) ? 1 : -1;
+        int32_t sy = (y1 < y2) ? SCREEN_WIDTH : -SCREEN_WIDTH;
+        
+        int16_t err = dx - dy;
+
+        auto* ptr = &legacy_screen[y1 * SCREEN_WIDTH + x1];
+
+        while (true)
+        {
+            if constexpr (SafeMode)
+            {
+                if (x1 < SCREEN_WIDTH && y1 < SCREEN_HEIGHT)
+                {
+                    *ptr = c;
+                }
+            }
+            else *ptr = c;
+
+            if (x1 == x2 && y1 == y2) break;
+
+            int16_t e2 = 2 * err;
+            
+            if (e2 > -dy) { 
+                err -= dy; 
+                x1 += (x1 < x2 ? 1 : -1);
+                ptr += sx;
+            }
+            if (e2 < dx) { 
+                err += dx; 
+                y1 += (y1 < y2 ? 1 : -1);
+                ptr += sy;
+            }
+        }
+    }
+
+    template <bool SafeMode = false>
+    void Hline(uint16_t x, uint16_t y, uint16_t l, bool c = true)
+    {
+        if constexpr (SafeMode)
+        {
+            if (x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return;
+            if (x + l > SCREEN_WIDTH) l = SCREEN_WIDTH - x;
+        }
+
+        bool* ptr = &legacy_screen[y * SCREEN_WIDTH + x];
+        memset(ptr, c, l);
+    }
+
+    template <bool SafeMode = false>
+    void Vline(uint16_t x, uint16_t y, uint16_t l, bool c = true)
+    {
+        if constexpr (SafeMode)
+        {
+            if (x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return;
+            if (y + l > SCREEN_HEIGHT) l = SCREEN_HEIGHT - y;
+        }
+
+        for (uint16_t i = 0; i < l; i++)
+        {
+            legacy_screen[(y + i) * SCREEN_WIDTH + x] = c;
+        }
+    }
+
+    template <bool SafeMode = false>
+    void RectFilled(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool c = true)
+    {
+        if constexpr (SafeMode)
+        {
+            if (x > SCREEN_WIDTH || y > SCREEN_HEIGHT) return;
+            if (x + w > SCREEN_WIDTH) w = SCREEN_WIDTH - x;
+            if (y + h > SCREEN_HEIGHT) h = SCREEN_HEIGHT - y;
+            if (w == 0 || h == 0) return;
+        }
+
+        for (uint16_t i = 0; i < h; i++)
+        {
+            Hline(x, y + i, w, c);
+        }
+    }
+
+    template <bool SafeMode = false>
+    void RectRounded(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t r, bool c = true)
+    {
+        if (r > w / 2) r = w / 2;
+        if (r > h / 2) r = h / 2;
+
+        for (int16_t i = 0; i < h - 2 * r; i++) {
+            Hline<SafeMode>(x, y + r + i, w, c);
+        }
+
+        int16_t f = 1 - r;
+        int16_t ddF_x = 1;
+        int16_t ddF_y = -2 * r;
+        int16_t x_off = 0;
+        int16_t y_off = r;
+
+        while (x_off < y_off)
+        {
+            if (f >= 0)
+            {
+                y_off--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x_off++;
+            ddF_x += 2;
+            f += ddF_x;
+
+            Hline<SafeMode>(x + r - x_off, y + r - y_off, w - 2 * r + 2 * x_off, c);
+            Hline<SafeMode>(x + r - x_off, y + h - r + y_off - 1, w - 2 * r + 2 * x_off, c);
+            Hline<SafeMode>(x + r - y_off, y + r - x_off, w - 2 * r + 2 * y_off, c);
+            Hline<SafeMode>(x + r - y_off, y + h - r + x_off - 1, w - 2 * r + 2 * y_off, c);
+        }
+    }
+
+    template <bool SafeMode = false>
+    void CircleFilled(uint16_t x0, uint16_t y0, uint16_t r, bool c = true)
+    {
+        int16_t x = 0;
+        int16_t y = r;
+        int16_t d = 3 - 2 * r;
+
+        while (y >= x)
+        {
+            Hline<SafeMode>(x0 - y, y0 - x, 2 * y + 1, c);
+            Hline<SafeMode>(x0 - y, y0 + x, 2 * y + 1, c);
+            Hline<SafeMode>(x0 - x, y0 - y, 2 * x + 1, c);
+            Hline<SafeMode>(x0 - x, y0 + y, 2 * x + 1, c);
+
+            x++;
+            if (d > 0)
+            {
+                y--;
+                d = d + 4 * (x - y) + 10;
+            }
+            else
+            {
+                d = d + 4 * x + 6;
+            }
+        }
+    }
+
+    template <bool SafeMode = false>
+    void TriangleFilled(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool c = true)
+    {
+        if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+        if (y1 > y2) { std::swap(y1, y2); std::swap(x1, x2); }
+        if (y0 > y1) { std::swap(y0, y1); std::swap(x0, x1); }
+
+        if (y2 < 0 || y0 >= SCREEN_HEIGHT) return;
+        
+        int32_t dx01 = 0, dx02 = 0, dx12 = 0;
+
+        if (y1 > y0) dx01 = ((int32_t)(x1 - x0) << 16) / (y1 - y0);
+        if (y2 > y0) dx02 = ((int32_t)(x2 - x0) << 16) / (y2 - y0);
+        if (y2 > y1) dx12 = ((int32_t)(x2 - x1) << 16) / (y2 - y1);
+
+        int32_t xa = (int32_t)x0 << 16;
+        int32_t xb = xa;
+
+        for (int16_t y = y0; y < y1; y++)
+        {
+            if (y >= 0 && y < SCREEN_HEIGHT) {
+                int16_t x_start = xa >> 16;
+                int16_t x_end   = xb >> 16;
+                
+                if (x_start > x_end) std::swap(x_start, x_end);
+                
+                if (x_start < 0) x_start = 0;
+                if (x_end >= SCREEN_WIDTH) x_end = SCREEN_WIDTH - 1;
+
+                if (x_end >= x_start) {
+                    Hline<SafeMode>(x_start, y, x_end - x_start + 1, c);
+                }
+            }
+            xa += dx02;
+            xb += dx01;
+        }
+        xb = (int32_t)x1 << 16;
+
+        for (int16_t y = y1; y <= y2; y++)
+        {
+             if (y >= 0 && y < SCREEN_HEIGHT) {
+                int16_t x_start = xa >> 16;
+                int16_t x_end   = xb >> 16;
+                
+                if (x_start > x_end) std::swap(x_start, x_end);
+                
+                if (x_start < 0) x_start = 0;
+                if (x_end >= SCREEN_WIDTH) x_end = SCREEN_WIDTH - 1;
+
+                if (x_end >= x_start) {
+                    Hline<SafeMode>(x_start, y, x_end - x_start + 1, c);
+                }
+            }
+            xa += dx02;
+            xb += dx12;
+        }
+    }
+
+    template <bool SafeMode = false>
+    void Blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t* bitmap, bool color = true, bool transparent_bg = false)
+    {
+        for (uint16_t j = 0; j < h; j++)
+        {
+            for (uint16_t i = 0; i < w; i++)
+            {
+                uint8_t byte = bitmap[(j * w + i) / 8];
+                uint8_t bit = 1 << (7 - ((j * w + i) % 8));
+                if (byte & bit)
+                {
+                    Pixel<SafeMode>(x + i, y + j, color);
+                }
+                else if (!transparent_bg)
+                {
+                    Pixel<SafeMode>(x + i, y + j, !color);
+                }
+            }
+        }
+    }
+
+    template <bool SafeMode = false>
+    void Text(uint16_t x, uint16_t y, char* text, bool color = true, bool transparent_bg = false)
+    {
+        uint16_t x_coord = x;
+        while (*text)
+        {
+            uint8_t c = *text++;
+
+            if constexpr (SafeMode)
+            {
+                for (uint16_t j = 0; j < 8; j++) {
+                    for (uint16_t k = 0; k < 8; k++) {
+                        bool active = (screen_font[c][j] & (1 << k));
+                        // the previous safe mode painted the background even when transparent, fixed since
+                        if (!transparent_bg || active) Pixel<true>(x_coord + k, y + j, active ? color : !color);
+                    }
+                }
+            }
+            else 
+            {
+                auto* draw_ptr = &legacy_screen[y * SCREEN_WIDTH + x_coord];
+
+                for (uint16_t j = 0; j < 8; j++)
+                {
+                    uint8_t row_bits = screen_font[c][j];
+                    for (uint16_t k = 0; k < 8; k++) 
+                    {
+                        if (!transparent_bg || (row_bits & 1)) {
+                            draw_ptr[k] = (row_bits & 1) ? color : !color;
+                        }
+                        row_bits >>= 1;
+                    }
+                    draw_ptr += SCREEN_WIDTH;
+                }
+            }
+
+            x_coord += 8;
+            if (x_coord >= SCREEN_WIDTH)
+            {
+                x_coord = x;
+                y += 8+2; // 8 for font height + 2 for line spacing
+            }
+        }
+    }
+    template <bool SafeMode = false>
+    void Text(uint16_t x, uint16_t y, const char* text, bool color = true, bool transparent_bg = false)
+    {
+        Text<SafeMode>(x, y, (char*) text, color, transparent_bg);
+    }
+
+}
+/// @brief Previous ScreenDriver::Upload() conversion to the panel format
+static void legacy_pack(uint8_t* buffer)
+{
+    for (uint16_t i = 0; i < SCREEN_HEIGHT / 8; i++)
+    {
+        for (uint16_t j = 0; j < SCREEN_WIDTH; j++)
+        {
+            uint8_t byte = 0;
+            for (uint16_t k = 0; k < 8; k++)
+            {
+                byte |= (legacy_screen[(i * 8 + k) * SCREEN_WIDTH + j] ? 1 : 0) << k;
+            }
+            buffer[i * SCREEN_WIDTH + j] = byte;
+        }
+    }
+}
+
+/** RENDERERS **/
+
+struct NewRenderer
+{
+    static constexpr const char* NAME = "packed";
+    static void clear() { ScreenDriver::Clear(); }
+    static void upload() { ScreenDriver::Upload(); }
+    template <bool Safe> static void pixel(uint16_t x, uint16_t y, bool c) { Draw::Pixel<Safe>(x, y, c); }
+    template <bool Safe> static void line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, bool c) { Draw::Line<Safe>(x1, y1, x2, y2, c); }
+    template <bool Safe> static void hline(uint16_t x, uint16_t y, uint16_t l, bool c) { Draw::Hline<Safe>(x, y, l, c); }
+    template <bool Safe> static void vline(uint16_t x, uint16_t y, uint16_t l, bool c) { Draw::Vline<Safe>(x, y, l, c); }
+    template <bool Safe> static void rect_filled(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool c) { Draw::RectFilled<Safe>(x, y, w, h, c); }
+    template <bool Safe> static void rect_rounded(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t r, bool c) { Draw::RectRounded<Safe>(x, y, w, h, r, c); }
+    template <bool Safe> static void circle_filled(uint16_t x, uint16_t y, uint16_t r, bool c) { Draw::CircleFilled<Safe>(x, y, r, c); }
+    template <bool Safe> static void triangle_filled(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool c) { Draw::TriangleFilled<Safe>(x0, y0, x1, y1, x2, y2, c); }
+    template <bool Safe> static void blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t* bitmap, bool c, bool transparent) { Draw::Blit<Safe>(x, y, w, h, bitmap, c, transparent); }
+    template <bool Safe> static void text(uint16_t x, uint16_t y, const char* s, bool c, bool transparent) { Draw::Text<Safe>(x, y, s, c, transparent); }
+};
+
+struct LegacyRenderer
+{
+    static constexpr const char* NAME = "legacy";
+    static void clear() { memset(legacy_screen, 0, sizeof(legacy_screen)); }
+    static void upload()
+    {
+        static uint8_t buffer[FRAME_SIZE];
+        legacy_pack(buffer);
+        FakeDrivers::GetScreen().upload(buffer, SCREEN_WIDTH, SCREEN_HEIGHT);
+    }
+    template <bool Safe> static void pixel(uint16_t x, uint16_t y, bool c) { LegacyDraw::Pixel<Safe>(x, y, c); }
+    template <bool Safe> static void line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, bool c) { LegacyDraw::Line<Safe>(x1, y1, x2, y2, c); }
+    template <bool Safe> static void hline(uint16_t x, uint16_t y, uint16_t l, bool c) { LegacyDraw::Hline<Safe>(x, y, l, c); }
+    template <bool Safe> static void vline(uint16_t x, uint16_t y, uint16_t l, bool c) { LegacyDraw::Vline<Safe>(x, y, l, c); }
+    template <bool Safe> static void rect_filled(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool c) { LegacyDraw::RectFilled<Safe>(x, y, w, h, c); }
+    template <bool Safe> static void rect_rounded(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t r, bool c) { LegacyDraw::RectRounded<Safe>(x, y, w, h, r, c); }
+    template <bool Safe> static void circle_filled(uint16_t x, uint16_t y, uint16_t r, bool c) { LegacyDraw::CircleFilled<Safe>(x, y, r, c); }
+    template <bool Safe> static void triangle_filled(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, bool c) { LegacyDraw::TriangleFilled<Safe>(x0, y0, x1, y1, x2, y2, c); }
+    template <bool Safe> static void blit(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t* bitmap, bool c, bool transparent) { LegacyDraw::Blit<Safe>(x, y, w, h, bitmap, c, transparent); }
+    template <bool Safe> static void text(uint16_t x, uint16_t y, const char* s, bool c, bool transparent) { LegacyDraw::Text<Safe>(x, y, s, c, transparent); }
+};
+
+/** FACE MENU FRAME (same drawing as MenuFace::onRender) **/
+
+struct Eyes
+{
+    float look_x, look_y, skew, size;
+    float open_left, open_right;
+    float lid_in_left, lid_in_right, lid_out_left, lid_out_right, lid_bottom_left, lid_bottom_right;
+};
+
+/// @brief Eyes at frame `i` of a looping animation covering looks, blinks and lids
+static Eyes face_state(uint32_t i)
+{
+    float t = i * 0.05f;
+    float blink = std::fabs(std::sin(t * 0.7f));
+    float lid = std::max(0.0f, std::sin(t * 0.3f)) * 0.5f;
+    return Eyes{
+        0.9f * std::sin(t), 0.9f * std::cos(t * 1.3f), 0.3f * std::sin(t * 0.5f), 1.0f,
+        1.2f * blink, 1.2f * blink,
+        lid, lid, lid * 0.5f, lid * 0.5f, (i % 3 == 0) ? lid : 0.0f, (i % 3 == 0) ? lid : 0.0f,
+    };
+}
+
+template <typename R>
+static void draw_face(const Eyes& base_infos)
+{
+    const Eyes& eyes_info = base_infos;
+    const uint16_t width = SCREEN_WIDTH, height = SCREEN_HEIGHT;
+    uint8_t m_eyes_size = 30 * base_infos.size;
+    float look_x_right = -(-base_infos.look_x*2 - base_infos.look_x*base_infos.look_x);
+    float look_x_left = base_infos.look_x*2 - base_infos.look_x*base_infos.look_x;
+
+    float ry = height / 2 + base_infos.look_y * 10.0f - base_infos.skew * 5.0f;
+    float rx = width / 4 + look_x_right * 10.0f;
+    float rh = m_eyes_size * base_infos.open_right;
+    R::template rect_rounded<false>(rx - m_eyes_size / 2, ry - rh / 2, m_eyes_size, rh, 7, true);
+    if (eyes_info.lid_in_right > 0.001f)
+        R::template triangle_filled<false>(rx - m_eyes_size / 2, ry - rh / 2, rx + m_eyes_size / 2, ry - rh / 2,
+                                           rx + m_eyes_size / 2, ry - rh / 2 + (base_infos.lid_in_right * rh), false);
+    if (eyes_info.lid_out_right > 0.001f)
+        R::template triangle_filled<false>(rx - m_eyes_size / 2, ry - rh / 2, rx - m_eyes_size / 2, ry - rh / 2 + (base_infos.lid_out_right * rh),
+                                           rx + m_eyes_size / 2, ry - rh / 2, false);
+    if (eyes_info.lid_bottom_right > 0.001f)
+        R::template triangle_filled<false>(rx + m_eyes_size / 2, ry + rh / 2, rx - m_eyes_size / 2, ry + rh / 2,
+                                           rx, ry + rh / 2 - (base_infos.lid_bottom_right * rh), false);
+
+    float ly = height / 2 + base_infos.look_y * 10.0f + base_infos.skew * 5.0f;
+    float lx = width * 3 / 4 + look_x_left * 10.0f;
+    float lh = m_eyes_size * base_infos.open_left;
+    R::template rect_rounded<false>(lx - m_eyes_size / 2, ly - lh / 2, m_eyes_size, lh, 7, true);
+    if (eyes_info.lid_in_left > 0.001f)
+        R::template triangle_filled<false>(lx - m_eyes_size / 2, ly - lh / 2, lx + m_eyes_size / 2, ly - lh / 2,
+                                           lx - m_eyes_size / 2, ly - lh / 2 + (base_infos.lid_in_left * lh), false);
+    if (eyes_info.lid_out_left > 0.001f)
+        R::template triangle_filled<false>(lx - m_eyes_size / 2, ly - lh / 2, lx + m_eyes_size / 2, ly - lh / 2 + (base_infos.lid_out_left * lh),
+                                           lx + m_eyes_size / 2, ly - lh / 2, false);
+    if (eyes_info.lid_bottom_left > 0.001f)
+        R::template triangle_filled<false>(lx + m_eyes_size / 2, ly + lh / 2, lx - m_eyes_size / 2, ly + lh / 2,
+                                           lx, ly + lh / 2 - (base_infos.lid_bottom_left * lh), false);
+}
+
+/** GOLDEN CHECKS **/
+
+static bool same_frame()
+{
+    uint8_t expected[FRAME_SIZE];
+    legacy_pack(expected);
+    return memcmp(expected, ScreenDriver::info.data, FRAME_SIZE) == 0;
+}
+
+/// @brief Apply the same random primitive to both renderers
+static void random_op(std::mt19937& rng, bool safe)
+{
+    auto coord = [&](int size) -> int16_t {
+        // safe mode : up to 24 pixels outside on each side (negative values wrap like in the menus)
+        return safe ? static_cast<int16_t>(static_cast<int>(rng() % (size + 48)) - 24) : static_cast<int16_t>(rng() % size);
+    };
+    auto span = [&](int from, int size) -> uint16_t {
+        int room = safe ? size + 24 - from : size - from;
+        return room > 0 ? static_cast<uint16_t>(rng() % (room + 1)) : 0;
+    };
+    bool c = rng() & 1;
+    static uint8_t bitmap[16 * 16 / 8];
+    static const char* texts[] = { "TNY", "360!", "ok", "Wi-Fi", "abc/xyz" };
+
+    int16_t x = coord(SCREEN_WIDTH), y = coord(SCREEN_HEIGHT);
+    switch (rng() % 11)
+    {
+    case 0:
+        if (safe) { NewRenderer::pixel<true>(x, y, c); LegacyRenderer::pixel<true>(x, y, c); }
+        else { NewRenderer::pixel<false>(x, y, c); LegacyRenderer::pixel<false>(x, y, c); }
+        break;
+    case 1: {
+        // lines only clip beyond the right / bottom edges (negative coordinates overflow their error term)
+        x = std::abs(x);
+        y = std::abs(y);
+        int16_t x2 = std::abs(coord(SCREEN_WIDTH)), y2 = std::abs(coord(SCREEN_HEIGHT));
+        if (rng() % 4 == 0) y2 = y; // horizontal and vertical lines have their own path
+        else if (rng() % 4 == 0) x2 = x;
+        if (safe) { NewRenderer::line<true>(x, y, x2, y2, c); LegacyRenderer::line<true>(x, y, x2, y2, c); }
+        else { NewRenderer::line<false>(x, y, x2, y2, c); LegacyRenderer::line<false>(x, y, x2, y2, c); }
+        break;
+    }
+    case 2: {
+        uint16_t l = span(x, SCREEN_WIDTH);
+        if (safe) { NewRenderer::hline<true>(x, y, l, c); LegacyRenderer::hline<true>(x, y, l, c); }
+        else { NewRenderer::hline<false>(x, y, l, c); LegacyRenderer::hline<false>(x, y, l, c); }
+        break;
+    }
+    case 3: {
+        uint16_t l = span(y, SCREEN_HEIGHT);
+        if (safe) { NewRenderer::vline<true>(x, y, l, c); LegacyRenderer::vline<true>(x, y, l, c); }
+        else { NewRenderer::vline<false>(x, y, l, c); LegacyRenderer::vline<false>(x, y, l, c); }
+        break;
+    }
+    case 4: {
+        uint16_t w = span(x, SCREEN_WIDTH), h = span(y, SCREEN_HEIGHT);
+        if (safe) { NewRenderer::rect_filled<true>(x, y, w, h, c); LegacyRenderer::rect_filled<true>(x, y, w, h, c); }
+        else { NewRenderer::rect_filled<false>(x, y, w, h, c); LegacyRenderer::rect_filled<false>(x, y, w, h, c); }
+        break;
+    }
+    case 5: {
+        uint16_t w = span(x, SCREEN_WIDTH), h = span(y, SCREEN_HEIGHT), r = rng() % 12;
+        if (safe) { NewRenderer::rect_rounded<true>(x, y, w, h, r, c); LegacyRenderer::rect_rounded<true>(x, y, w, h, r, c); }
+        else if (w > 0 && h > 0) { NewRenderer::rect_rounded<false>(x, y, w, h, r, c); LegacyRenderer::rect_rounded<false>(x, y, w, h, r, c); }
+        break;
+    }
+    case 6: {
+        uint16_t r = rng() % 32;
+        if (safe) { NewRenderer::circle_filled<true>(x, y, r, c); LegacyRenderer::circle_filled<true>(x, y, r, c); break; }
+        int limit = std::min(std::min<int>(x, y), std::min<int>(SCREEN_WIDTH - 1 - x, SCREEN_HEIGHT - 1 - y));
+        r = limit > 0 ? r % (limit + 1) : 0;
+        NewRenderer::circle_filled<false>(x, y, r, c);
+        LegacyRenderer::circle_filled<false>(x, y, r, c);
+        break;
+    }
+    case 7: {
+        // the triangle clips its rows itself, any coordinate is fine in both modes
+        int16_t p[4];
+        for (int16_t& v : p) v = static_cast<int16_t>(static_cast<int>(rng() % 200) - 36);
+        if (safe) { NewRenderer::triangle_filled<true>(x, y, p[0], p[1], p[2], p[3], c); LegacyRenderer::triangle_filled<true>(x, y, p[0], p[1], p[2], p[3], c); }
+        else { NewRenderer::triangle_filled<false>(x, y, p[0], p[1], p[2], p[3], c); LegacyRenderer::triangle_filled<false>(x, y, p[0], p[1], p[2], p[3], c); }
+        break;
+    }
+    case 8: {
+        // tall rectangles, crossing several pages
+        uint16_t w = span(x, SCREEN_WIDTH) % 4 + 1, h = span(y, SCREEN_HEIGHT);
+        if (safe) { NewRenderer::rect_filled<true>(x, y, w, h, c); LegacyRenderer::rect_filled<true>(x, y, w, h, c); }
+        else if (x + w <= SCREEN_WIDTH) { NewRenderer::rect_filled<false>(x, y, w, h, c); LegacyRenderer::rect_filled<false>(x, y, w, h, c); }
+        break;
+    }
+    case 9: {
+        for (uint8_t& b : bitmap) b = static_cast<uint8_t>(rng());
+        bool transparent = rng() & 1;
+        if (safe) { NewRenderer::blit<true>(x, y, 16, 16, bitmap, c, transparent); LegacyRenderer::blit<true>(x, y, 16, 16, bitmap, c, transparent); }
+        else if (x + 16 <= SCREEN_WIDTH && y + 16 <= SCREEN_HEIGHT) { NewRenderer::blit<false>(x, y, 16, 16, bitmap, c, transparent); LegacyRenderer::blit<false>(x, y, 16, 16, bitmap, c, transparent); }
+        break;
+    }
+    case 10: {
+        const char* s = texts[rng() % 5];
+        bool transparent = rng() & 1;
+        if (safe) { NewRenderer::text<true>(x, y, s, c, transparent); LegacyRenderer::text<true>(x, y, s, c, transparent); }
+        else if (x + 8 * strlen(s) <= SCREEN_WIDTH && y + 8 <= SCREEN_HEIGHT) { NewRenderer::text<false>(x, y, s, c, transparent); LegacyRenderer::text<false>(x, y, s, c, transparent); }
+        break;
+    }
+    }
+}
+
+struct GoldenResult
+{
+    uint32_t scenes;
+    uint32_t mismatches;
+};
+
+static GoldenResult check_golden()
+{
+    GoldenResult result = { 0, 0 };
+    std::mt19937 rng(SEED);
+    NewRenderer::clear();
+    LegacyRenderer::clear();
+
+    // random scenes, drawn over the previous ones (covers painting over both colors)
+    for (int scene = 0; scene < 4000; scene++)
+    {
+        bool safe = scene % 2 == 1;
+        for (int op = 0; op < 24; op++) random_op(rng, safe);
+        result.scenes++;
+        if (!same_frame())
+        {
+            if (result.mismatches++ == 0) fprintf(stderr, "golden : scene %d (%s mode) differs\n", scene, safe ? "safe" : "unsafe");
+            // start again from identical frames
+            NewRenderer::clear();
+            LegacyRenderer::clear();
+        }
+    }
+
+    // every radius, at every vertical phase in a page
+    for (uint16_t r = 0; r <= 31; r++)
+    {
+        for (uint16_t phase = 0; phase < 8; phase++)
+        {
+            for (bool safe : { false, true })
+            {
+                NewRenderer::clear();
+                LegacyRenderer::clear();
+                uint16_t cy = 31 + phase;
+                if (safe)
+                {
+                    NewRenderer::circle_filled<true>(64, cy, r, true);
+                    LegacyRenderer::circle_filled<true>(64, cy, r, true);
+                    NewRenderer::rect_rounded<true>(2, cy - r, 2 * r + 2, 2 * r + 1, r, true);
+                    LegacyRenderer::rect_rounded<true>(2, cy - r, 2 * r + 2, 2 * r + 1, r, true);
+                }
+                else if (cy + r < SCREEN_HEIGHT && cy >= r)
+                {
+                    NewRenderer::circle_filled<false>(64, cy, r, true);
+                    LegacyRenderer::circle_filled<false>(64, cy, r, true);
+                    NewRenderer::rect_rounded<false>(2, cy - r, 2 * r + 2, 2 * r + 1, r, true);
+                    LegacyRenderer::rect_rounded<false>(2, cy - r, 2 * r + 2, 2 * r + 1, r, true);
+                }
+                result.scenes++;
+                if (!same_frame() && result.mismatches++ == 0) fprintf(stderr, "golden : radius %u at y %u differs\n", r, cy);
+            }
+        }
+    }
+
+    // animated Face frames
+    for (uint32_t i = 0; i < 2000; i++)
+    {
+        NewRenderer::clear();
+        LegacyRenderer::clear();
+        Eyes eyes = face_state(i);
+        draw_face<NewRenderer>(eyes);
+        draw_face<LegacyRenderer>(eyes);
+        result.scenes++;
+        if (!same_frame() && result.mismatches++ == 0) fprintf(stderr, "golden : face frame %u differs\n", i);
+    }
+    return result;
+}
+
+/** TIMINGS **/
+
+struct Timing
+{
+    std::string name;
+    double legacy_ns;
+    double packed_ns;
+};
+
+template <typename F>
+static double ns_per_call(uint64_t calls, F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < calls; i++) f(i);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / calls;
+}
+
+template <typename R>
+static double time_primitive(const std::string& name, uint64_t calls)
+{
+    if (name == "rect_filled_32x16") return ns_per_call(calls, [](uint64_t i) { R::template rect_filled<false>(i % 96, i % 48, 32, 16, i & 1); });
+    if (name == "rect_rounded_32x16") return ns_per_call(calls, [](uint64_t i) { R::template rect_rounded<false>(i % 96, i % 48, 32, 16, 4, i & 1); });
+    if (name == "circle_filled_r12") return ns_per_call(calls, [](uint64_t i) { R::template circle_filled<false>(12 + i % 100, 12 + i % 40, 12, i & 1); });
+    if (name == "line_diagonal") return ns_per_call(calls, [](uint64_t i) { R::template line<false>(i % 64, i % 32, 64 + i % 64, 32 + i % 32, i & 1); });
+    if (name == "hline_64") return ns_per_call(calls, [](uint64_t i) { R::template hline<false>(i % 64, i % 64, 64, i & 1); });
+    if (name == "vline_48") return ns_per_call(calls, [](uint64_t i) { R::template vline<false>(i % 128, i % 16, 48, i & 1); });
+    if (name == "text_16_chars") return ns_per_call(calls, [](uint64_t i) { R::template text<false>(0, (i % 7) * 8, "TNY-360 v1.0 OK!", i & 1, false); });
+    if (name == "clear_upload") return ns_per_call(calls, [](uint64_t) { R::clear(); R::upload(); });
+    return 0.0;
+}
+
+template <typename R>
+static double face_fps(uint32_t frames, double& cycles_per_frame)
+{
+    std::vector<Eyes> states(256);
+    for (uint32_t i = 0; i < states.size(); i++) states[i] = face_state(i);
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t start_cycles = read_cycles();
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        R::clear();
+        draw_face<R>(states[i % states.size()]);
+        R::upload();
+    }
+    cycles_per_frame = static_cast<double>(read_cycles() - start_cycles) / frames;
+    auto end = std::chrono::steady_clock::now();
+    return frames / std::chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (ScreenDriver::Init() != Status::Ok)
+    {
+        fprintf(stderr, "Failed to init the screen driver\n");
+        return 1;
+    }
+
+    GoldenResult golden = check_golden();
+
+    std::vector<Timing> timings;
+    for (const char* name : { "rect_filled_32x16", "rect_rounded_32x16", "circle_filled_r12", "line_diagonal", "hline_64", "vline_48",
+                              "text_16_chars", "clear_upload" })
+    {
+        constexpr uint64_t CALLS = 200'000;
+        timings.push_back({ name, time_primitive<LegacyRenderer>(name, CALLS), time_primitive<NewRenderer>(name, CALLS) });
+    }
+
+    constexpr uint32_t FRAMES = 50'000;
+    double legacy_cycles, packed_cycles;
+    double legacy_fps = face_fps<LegacyRenderer>(FRAMES, legacy_cycles);
+    double packed_fps = face_fps<NewRenderer>(FRAMES, packed_cycles);
+
+    if (json)
+    {
+        printf("{\"golden_scenes\": %u, \"golden_mismatches\": %u, \"buffer_bytes\": {\"legacy\": %zu, \"packed\": %zu},\n",
+               golden.scenes, golden.mismatches, sizeof(legacy_screen) + FRAME_SIZE, FRAME_SIZE);
+        printf(" \"face\": {\"legacy_fps\": %.0f, \"packed_fps\": %.0f, \"legacy_cycles_per_frame\": %.0f, \"packed_cycles_per_frame\": %.0f},\n",
+               legacy_fps, packed_fps, legacy_cycles, packed_cycles);
+        printf(" \"primitives\": [\n");
+        for (size_t i = 0; i < timings.size(); i++)
+        {
+            const Timing& t = timings[i];
+            printf("  {\"name\": \"%s\", \"legacy_ns\": %.2f, \"packed_ns\": %.2f, \"speedup\": %.2f}%s\n", t.name.c_str(), t.legacy_ns,
+                   t.packed_ns, t.legacy_ns / t.packed_ns, i + 1 < timings.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("frame buffer : %zu bytes (previously %zu bytes of pixels + %zu bytes packed at upload)\n\n", FRAME_SIZE,
+               sizeof(legacy_screen), FRAME_SIZE);
+        printf("%-20s %12s %12s %9s\n", "primitive", "legacy ns", "packed ns", "speedup");
+        for (const Timing& t : timings)
+        {
+            printf("%-20s %12.2f %12.2f %8.2fx\n", t.name.c_str(), t.legacy_ns, t.packed_ns, t.legacy_ns / t.packed_ns);
+        }
+        printf("\nface frame (clear + eyes + upload) : legacy %.0f fps (%.0f cycles), packed %.0f fps (%.0f cycles), %.2fx\n",
+               legacy_fps, legacy_cycles, packed_fps, packed_cycles, packed_fps / legacy_fps);
+        printf("golden : %s (%u frames compared, %u different)\n", golden.mismatches == 0 ? "ok" : "FAILED", golden.scenes, golden.mismatches);
+    }
+
+    return golden.mismatches == 0 ? 0 : 2;
+}
@@ -0,0 +1,375 @@
+/**
+ * Status LED effects (common/LED.Effects.hpp) : checks of the fixed point curves and deadlines, and frames sent to the
+ * strip against the previous LED task.
+ *
+ * - gamma : ToLevel() monotonic over every Q8.8 brightness, ToLevel(ToBrightness(level)) == level for every level
+ * - curves : a fade is monotonic and ends exactly on its color, breathe starts and ends off and peaks on the color,
+ *            pulse peaks on the color then only decays, rainbow keeps its brightness through the 6 hue sectors,
+ *            blink gives `count` blinks per period
+ * - layers : the highest active layer is shown, an expired or cleared layer uncovers the one below it
+ * - deadlines : a session of static effects (solid colors, blinks, timed alerts, finished fades) rendered only at the
+ *               deadlines must show the same frame as rendering every millisecond
+ * - session : a day-like session (status colors, a boot fade, breathing while connecting, alert pulses, an error
+ *             code) rendered at the deadlines, against the previous task sending a frame every 50 ms
+ *
+ * The tool exits with 2 on any failed check, or if the effects engine sends more frames than the previous task.
+ *
+ * Usage : bench_led_effects [--json] [--minutes count]
+ */
+#include "common/LED.Effects.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+
+using namespace LED;
+
+constexpr uint32_t SEED = 0x360;
+constexpr int64_t MS = 1000;
+constexpr int64_t LEGACY_INTERVAL_MS = 50; // previous UPDATE_TASK_INTERVAL_MS, a frame sent every time
+
+using Frame = uint8_t[EffectEngine::FRAME_SIZE];
+
+static int failures = 0;
+
+static void expect(bool condition, const char* what)
+{
+    if (condition) return;
+    fprintf(stderr, "FAILED : %s\n", what);
+    failures++;
+}
+
+/// @brief Color shown at a time, from the GRB frame of the first LED
+static Color shown(EffectEngine& engine, int64_t now_us, int64_t* deadline_us = nullptr)
+{
+    Frame frame;
+    int64_t deadline;
+    engine.render(now_us, frame, deadline);
+    if (deadline_us) *deadline_us = deadline;
+    return Color(frame[1], frame[0], frame[2]);
+}
+
+static uint8_t max_component(Color c)
+{
+    return std::max({ c.r, c.g, c.b });
+}
+
+static void check_gamma()
+{
+    uint8_t previous = 0;
+    bool monotonic = true;
+    for (uint32_t b = 0; b <= 0xFFFF; b++)
+    {
+        uint8_t level = EffectEngine::ToLevel(static_cast<Q8_8>(b));
+        if (level < previous) monotonic = false;
+        previous = level;
+    }
+    expect(monotonic, "gamma : ToLevel() monotonic");
+    expect(EffectEngine::ToLevel(0) == 0 && EffectEngine::ToLevel(0xFFFF) == 255, "gamma : ToLevel() range");
+
+    bool round_trip = true;
+    for (uint32_t level = 0; level <= 255; level++)
+    {
+        if (EffectEngine::ToLevel(EffectEngine::ToBrightness(level)) != level) round_trip = false;
+        if (level > 0 && EffectEngine::ToBrightness(level) <= EffectEngine::ToBrightness(level - 1)) round_trip = false;
+    }
+    expect(round_trip, "gamma : ToLevel(ToBrightness(level)) == level");
+}
+
+static void check_fade()
+{
+    const Color from(200, 10, 0), to(0, 40, 255);
+    EffectEngine engine;
+    engine.set(0, Layer::Base, Effect::Solid(from), 0);
+    engine.set(0, Layer::Base, Effect::Fade(to, 500), 1000 * MS);
+
+    Color previous = shown(engine, 1000 * MS);
+    expect(previous.r == from.r && previous.g == from.g && previous.b == from.b, "fade : starts on the color shown");
+    bool monotonic = true;
+    for (int64_t t = 1001 * MS; t <= 1500 * MS; t += MS)
+    {
+        Color c = shown(engine, t);
+        if (c.r > previous.r || c.g < previous.g || c.b < previous.b) monotonic = false;
+        previous = c;
+    }
+    expect(monotonic, "fade : monotonic");
+
+    int64_t deadline;
+    Color end = shown(engine, 1500 * MS, &deadline);
+    expect(end.r == to.r && end.g == to.g && end.b == to.b, "fade : ends exactly on its color");
+    expect(deadline == EffectEngine::NO_DEADLINE, "fade : no deadline once finished");
+    shown(engine, 1490 * MS, &deadline);
+    expect(deadline == 1500 * MS, "fade : last deadline at the end of the transition");
+}
+
+static void check_breathe_pulse()
+{
+    const Color color(0, 120, 60);
+    const uint16_t period_ms = 2000;
+
+    EffectEngine breathe;
+    breathe.set(0, Layer::Base, Effect::Breathe(color, period_ms), 0);
+    int64_t deadline;
+    expect(max_component(shown(breathe, 0, &deadline)) == 0, "breathe : starts off");
+    expect(deadline == LED_FRAME_MS * MS, "breathe : deadline on the next frame");
+    Color peak = shown(breathe, period_ms / 2 * MS);
+    expect(peak.g == color.g && peak.b == color.b, "breathe : peaks on the color");
+    bool symmetric = true, rising = true;
+    uint8_t previous = 0;
+    for (int64_t t = 0; t <= period_ms / 2 * MS; t += 10 * MS)
+    {
+        uint8_t up = shown(breathe, t).g, down = shown(breathe, period_ms * MS - t).g;
+        if (std::abs(up - down) > 1) symmetric = false;
+        if (up < previous) rising = false;
+        previous = up;
+    }
+    expect(symmetric && rising, "breathe : rises then falls symmetrically");
+
+    EffectEngine pulse;
+    pulse.set(0, Layer::Base, Effect::Pulse(color, period_ms), 0);
+    peak = shown(pulse, period_ms / 8 * MS);
+    expect(peak.g == color.g && peak.b == color.b, "pulse : peaks on the color");
+    bool decaying = true;
+    previous = 255;
+    for (int64_t t = period_ms / 8 * MS; t < period_ms * MS; t += 10 * MS)
+    {
+        uint8_t level = shown(pulse, t).g;
+        if (level > previous) decaying = false;
+        previous = level;
+    }
+    expect(decaying && previous <= 1, "pulse : decays to off");
+}
+
+static void check_rainbow()
+{
+    EffectEngine engine;
+    engine.set(0, Layer::Base, Effect::Rainbow(80, 3000), 0);
+    bool bright = true;
+    bool sectors[6] = {};
+    for (int64_t t = 0; t < 3000 * MS; t += 5 * MS)
+    {
+        Color c = shown(engine, t);
+        if (max_component(c) < 79) bright = false;
+        // sector from the order of the components
+        int sector = c.r >= c.g && c.g > c.b ? 0 : c.g >= c.r && c.r > c.b ? 1 : c.g >= c.b && c.b > c.r ? 2
+                   : c.b >= c.g && c.g > c.r ? 3 : c.b >= c.r && c.r > c.g ? 4 : c.r >= c.b && c.b > c.g ? 5 : -1;
+        if (sector >= 0) sectors[sector] = true;
+    }
+    expect(bright, "rainbow : keeps its brightness");
+    expect(std::all_of(sectors, sectors + 6, [](bool s) { return s; }), "rainbow : goes through every hue sector");
+}
+
+static void check_blink()
+{
+    const uint8_t count = 3;
+    const uint16_t period_ms = 1600;
+    EffectEngine engine;
+    engine.set(0, Layer::Base, Effect::Blink(Color(255, 0, 0), count, period_ms), 0);
+
+    // only render at the deadlines : every edge must be one
+    int64_t t = 0, deadline;
+    uint32_t blinks = 0, renders = 0;
+    bool on = false;
+    while (t < 10 * period_ms * MS)
+    {
+        bool now_on = shown(engine, t, &deadline).r != 0;
+        if (now_on && !on) blinks++;
+        on = now_on;
+        renders++;
+        t = deadline;
+    }
+    expect(blinks == 10 * count, "blink : count blinks per period");
+    expect(renders == 10 * 2 * count, "blink : a deadline per edge only");
+}
+
+static void check_layers()
+{
+    EffectEngine engine;
+    expect(engine.set(LED_COUNT, Layer::Base, Effect::Solid(Color(1, 1, 1)), 0) == Status::InvalidParameters &&
+           engine.set(0, Layer::COUNT, Effect::Solid(Color(1, 1, 1)), 0) == Status::InvalidParameters,
+           "layers : invalid LED or layer");
+
+    engine.set(0, Layer::Base, Effect::Solid(Color(0, 16, 0)), 0);
+    engine.set(0, Layer::Status, Effect::Solid(Color(16, 8, 0)), 0);
+    expect(shown(engine, 50 * MS).r == 16, "layers : status over base");
+
+    int64_t deadline;
+    engine.set(0, Layer::Alert, Effect::Solid(Color(0, 0, 200), 300), 100 * MS);
+    expect(shown(engine, 200 * MS, &deadline).b == 200 && deadline == 400 * MS, "layers : alert over status until it expires");
+    expect(shown(engine, 400 * MS).r == 16, "layers : expired alert uncovers the status");
+    expect(engine.getColor(0, Layer::Alert, 400 * MS).b == 0, "layers : expired alert has no color");
+
+    engine.set(0, Layer::Error, Effect::Solid(Color(10, 0, 0)), 500 * MS);
+    expect(shown(engine, 500 * MS).r == 10, "layers : error over everything");
+    engine.clear(0, Layer::Error);
+    engine.clear(0, Layer::Status);
+    Color base = shown(engine, 600 * MS);
+    expect(base.g == 16 && base.r == 0, "layers : cleared layers uncover the base");
+}
+
+/// @brief A change of the effects at a time of a session
+struct Action
+{
+    int64_t time_us;
+    std::function<void(EffectEngine&, int64_t)> apply;
+};
+
+/**
+ * @brief Run a session rendering only at the deadlines and actions (like the LED task).
+ * @param reference When not null, also render every millisecond and compare the frames shown.
+ * @return frames rendered (task wakeups).
+ */
+static uint32_t run_session(const std::vector<Action>& actions, int64_t end_us, EffectEngine& engine, bool* same_as_dense = nullptr)
+{
+    EffectEngine dense;
+    Frame frame, dense_frame, strip = {};
+    uint32_t renders = 0;
+    size_t next_action = 0;
+    int64_t t = 0, deadline = EffectEngine::NO_DEADLINE;
+    int64_t dense_t = 0;
+    size_t dense_action = 0;
+    if (same_as_dense) *same_as_dense = true;
+
+    while (t < end_us)
+    {
+        while (next_action < actions.size() && actions[next_action].time_us <= t) actions[next_action++].apply(engine, t);
+        if (engine.render(t, frame, deadline)) memcpy(strip, frame, sizeof(frame));
+        renders++;
+
+        int64_t next = std::min(deadline, next_action < actions.size() ? actions[next_action].time_us : end_us);
+        next = std::min(next, end_us);
+
+        // the strip keeps `strip` until `next` : the dense rendering must agree on every millisecond of it
+        if (same_as_dense)
+        {
+            for (; dense_t < next; dense_t += MS)
+            {
+                while (dense_action < actions.size() && actions[dense_action].time_us <= dense_t)
+                {
+                    actions[dense_action++].apply(dense, dense_t);
+                }
+                int64_t unused;
+                dense.render(dense_t, dense_frame, unused);
+                if (memcmp(dense_frame, strip, sizeof(strip)) != 0) *same_as_dense = false;
+            }
+        }
+        t = next;
+    }
+    return renders;
+}
+
+static void check_static_deadlines()
+{
+    std::vector<Action> actions = {
+        { 0, [](EffectEngine& e, int64_t t) { e.set(0, Layer::Base, Effect::Solid(Color(0, 1, 0)), t); } },
+        { 1000 * MS, [](EffectEngine& e, int64_t t) { e.set(0, Layer::Status, Effect::Blink(Color(16, 8, 0), 2, 1000, 4500), t); } },
+        { 2000 * MS, [](EffectEngine& e, int64_t t) { e.set(0, Layer::Alert, Effect::Solid(Color(0, 0, 50), 333), t); } },
+        { 7000 * MS, [](EffectEngine& e, int64_t t) { e.set(0, Layer::Alert, Effect::Fade(Color(0, 0, 50), 0, 1000), t); } },
+        { 9000 * MS, [](EffectEngine& e, int64_t t) { e.set(0, Layer::Error, Effect::Blink(Color(10, 0, 0), 1, 600), t); } },
+        { 11000 * MS, [](EffectEngine& e, int64_t) { e.clear(0, Layer::Error); } },
+        { 12000 * MS, [](EffectEngine& e, int64_t t) { e.set(0, Layer::Status, Effect::Solid(Color(16, 16, 0), 200), t); } },
+    };
+    EffectEngine engine;
+    bool same = false;
+    run_session(actions, 15000 * MS, engine, &same);
+    expect(same, "deadlines : static effects rendered at the deadlines match a rendering every millisecond");
+}
+
+/**
+ * @brief Day-like session : long static stretches, a few fades, breathing while connecting, pulses, an error code.
+ */
+static std::vector<Action> make_session(uint32_t minutes, std::mt19937& rng)
+{
+    std::vector<Action> actions;
+    std::uniform_int_distribution<int64_t> gap(5 * 1000 * MS, 60 * 1000 * MS);
+    std::uniform_int_distribution<int> kind(0, 5);
+    const Color statuses[] = { Color(16, 16, 0), Color(16, 8, 0), Color(0, 1, 0) };
+
+    actions.push_back({ 0, [](EffectEngine& e, int64_t t) { e.set(0, Layer::Base, Effect::Fade(Color(0, 1, 0), 500), t); } });
+    for (int64_t t = gap(rng); t < minutes * 60 * 1000 * MS; t += gap(rng))
+    {
+        switch (kind(rng))
+        {
+            case 0: // robot state change, like Robot.cpp
+            case 1:
+            {
+                Color c = statuses[rng() % 3];
+                actions.push_back({ t, [c](EffectEngine& e, int64_t now) { e.set(0, Layer::Base, Effect::Fade(c, 100), now); } });
+                break;
+            }
+            case 2: // connecting for a few seconds
+                actions.push_back({ t, [](EffectEngine& e, int64_t now) { e.set(0, Layer::Status, Effect::Breathe(Color(0, 0, 40), 2000, 6000), now); } });
+                break;
+            case 3: // notification
+                actions.push_back({ t, [](EffectEngine& e, int64_t now) { e.set(0, Layer::Alert, Effect::Pulse(Color(40, 40, 40), 600, 1800), now); } });
+                break;
+            case 4: // acknowledgment
+                actions.push_back({ t, [](EffectEngine& e, int64_t now) { e.set(0, Layer::Alert, Effect::Blink(Color(0, 30, 0), 2, 800, 800), now); } });
+                break;
+            case 5: // error code shown for a while
+                actions.push_back({ t, [](EffectEngine& e, int64_t now) { e.set(0, Layer::Error, Effect::Blink(Color(10, 0, 0), 3, 2000), now); } });
+                actions.push_back({ t + 4000 * MS, [](EffectEngine& e, int64_t) { e.clear(0, Layer::Error); } });
+                break;
+        }
+    }
+    return actions;
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    uint32_t minutes = 60;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--minutes") == 0 && i + 1 < argc) minutes = strtoul(argv[++i], nullptr, 10);
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--minutes count]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    check_gamma();
+    check_fade();
+    check_breathe_pulse();
+    check_rainbow();
+    check_blink();
+    check_layers();
+    check_static_deadlines();
+
+    std::mt19937 rng(SEED);
+    std::vector<Action> actions = make_session(minutes, rng);
+    int64_t end_us = static_cast<int64_t>(minutes) * 60 * 1000 * MS;
+    EffectEngine engine;
+    uint32_t wakeups = run_session(actions, end_us, engine);
+    EffectEngine::Stats stats = engine.getStats();
+    uint32_t legacy_frames = static_cast<uint32_t>(end_us / (LEGACY_INTERVAL_MS * MS));
+
+    expect(stats.frames_sent + stats.frames_skipped == wakeups, "session : every render counted");
+    bool fewer = stats.frames_sent < legacy_frames;
+    bool failed = failures != 0 || !fewer;
+
+    double seconds = end_us / 1e6;
+    if (json)
+    {
+        printf("{\"checks_failed\": %d, \"minutes\": %u, \"actions\": %zu, \"legacy_frames_per_s\": %.2f, "
+               "\"wakeups_per_s\": %.2f, \"frames_sent_per_s\": %.2f, \"frames_skipped\": %u}\n",
+               failures, minutes, actions.size(), legacy_frames / seconds, wakeups / seconds, stats.frames_sent / seconds,
+               stats.frames_skipped);
+    }
+    else
+    {
+        printf("checks         : %s (%d failed)\n", failures == 0 ? "ok" : "FAILED", failures);
+        printf("session        : %u minutes, %zu effect changes\n\n", minutes, actions.size());
+        printf("%-14s %10s %12s %14s\n", "task", "wakeups/s", "frames/s", "frames skipped");
+        printf("%-14s %10.2f %12.2f %14u\n", "every 50 ms", legacy_frames / seconds, legacy_frames / seconds, 0u);
+        printf("%-14s %10.2f %12.2f %14u\n", "effects", wakeups / seconds, stats.frames_sent / seconds, stats.frames_skipped);
+        if (!fewer) printf("\nthe effects engine sends more frames than the previous task : FAILED\n");
+    }
+
+    return failed ? 2 : 0;
+}
@@ -0,0 +1,162 @@
+/**
+ * Snapshots of the firmware menus, rendered by the menu emulator (emu/include/emu/MenuEmulator.hpp).
+ *
+ * - snapshots : the script (emu/golden/menus.txt by default) drives the menus with button presses and fake service
+ *   states ; every `snap` is compared pixel by pixel against golden/<name>.png
+ * - timing : us per render (update, render and upload of the frames that drew) of each menu, over `--repeat` runs
+ *
+ * `--update` writes the golden images instead of comparing them, `--out` also writes every snapshot (`--scale` to
+ * look at them). Exits with 2 if a snapshot differs from its golden image or has none.
+ *
+ * Usage : menu_snapshots [--json] [--script file] [--golden dir] [--update] [--out dir] [--scale n] [--repeat n]
+ */
+#include "emu/MenuEmulator.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+constexpr uint32_t SEED = 0x360;
+
+struct SnapshotReport
+{
+    std::string name;
+    std::string menu;
+    uint32_t differences;
+    bool missing;
+};
+
+static bool read_file(const std::string& path, std::string& content)
+{
+    std::ifstream file(path);
+    if (!file) return false;
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    content = buffer.str();
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    bool update = false;
+    std::string script_path = std::string(EMU_GOLDEN_DIR) + "/menus.txt";
+    std::string golden_dir = EMU_GOLDEN_DIR;
+    std::string out_dir;
+    int scale = 1;
+    int repeat = 1;
+    for (int i = 1; i < argc; i++)
+    {
+        bool has_value = i + 1 < argc;
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--update") == 0) update = true;
+        else if (strcmp(argv[i], "--script") == 0 && has_value) script_path = argv[++i];
+        else if (strcmp(argv[i], "--golden") == 0 && has_value) golden_dir = argv[++i];
+        else if (strcmp(argv[i], "--out") == 0 && has_value) out_dir = argv[++i];
+        else if (strcmp(argv[i], "--scale") == 0 && has_value) scale = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--repeat") == 0 && has_value) repeat = atoi(argv[++i]);
+        else
+        {
+            scale = 0;
+            break;
+        }
+    }
+    if (scale < 1 || scale > 16 || repeat < 1)
+    {
+        fprintf(stderr, "usage: %s [--json] [--script file] [--golden dir] [--update] [--out dir] [--scale 1-16] [--repeat n]\n",
+                argv[0]);
+        return 1;
+    }
+
+    std::string script;
+    if (!read_file(script_path, script))
+    {
+        fprintf(stderr, "Can't read the script %s\n", script_path.c_str());
+        return 1;
+    }
+
+    Emu::MenuEmulator emulator;
+    if (emulator.init(SEED) != Status::Ok)
+    {
+        fprintf(stderr, "Failed to init the menu emulator\n");
+        return 1;
+    }
+
+    // the first run gives the snapshots, the others only add renders to the timing
+    std::vector<Emu::Snapshot> snapshots;
+    for (int run = 0; run < repeat; run++)
+    {
+        std::vector<Emu::Snapshot> run_snapshots;
+        if (emulator.run(script, run_snapshots) != Status::Ok) return 1;
+        if (run == 0) snapshots = run_snapshots;
+    }
+
+    std::vector<SnapshotReport> reports;
+    bool failed = false;
+    for (const Emu::Snapshot& snapshot : snapshots)
+    {
+        SnapshotReport report = { snapshot.name, snapshot.menu.empty() ? "-" : snapshot.menu, 0, false };
+        std::string golden_path = golden_dir + "/" + snapshot.name + ".png";
+        if (!out_dir.empty())
+        {
+            std::string out_path = out_dir + "/" + snapshot.name + ".png";
+            if (Emu::SavePNG(out_path.c_str(), snapshot.frame.data(), scale) != Status::Ok) return 1;
+        }
+        if (update)
+        {
+            if (Emu::SavePNG(golden_path.c_str(), snapshot.frame.data()) != Status::Ok) return 1;
+        }
+        else
+        {
+            std::vector<uint8_t> golden(Emu::FRAME_SIZE);
+            report.missing = Emu::LoadPNG(golden_path.c_str(), golden.data()) != Status::Ok;
+            if (!report.missing) report.differences = Emu::CountDifferences(snapshot.frame.data(), golden.data());
+            failed |= report.missing || report.differences > 0;
+        }
+        reports.push_back(report);
+    }
+
+    const std::map<std::string, Emu::RenderStats>& stats = emulator.getStats();
+    if (json)
+    {
+        printf("{\"runs\": %d, \"updated\": %s,\n \"snapshots\": [\n", repeat, update ? "true" : "false");
+        for (size_t i = 0; i < reports.size(); i++)
+        {
+            const SnapshotReport& r = reports[i];
+            printf("  {\"name\": \"%s\", \"menu\": \"%s\", \"missing\": %s, \"differences\": %u}%s\n", r.name.c_str(),
+                   r.menu.c_str(), r.missing ? "true" : "false", r.differences, i + 1 < reports.size() ? "," : "");
+        }
+        printf(" ],\n \"menus\": [\n");
+        size_t i = 0;
+        for (const auto& [title, s] : stats)
+        {
+            printf("  {\"title\": \"%s\", \"renders\": %u, \"avg_us\": %.3f, \"max_us\": %.3f}%s\n",
+                   title.empty() ? "-" : title.c_str(), s.renders, s.renders ? s.total_us / s.renders : 0.0, s.max_us,
+                   ++i < stats.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("%-20s %-14s %s\n", "snapshot", "menu", update ? "golden" : "differing pixels");
+        for (const SnapshotReport& r : reports)
+        {
+            if (update) printf("%-20s %-14s written\n", r.name.c_str(), r.menu.c_str());
+            else if (r.missing) printf("%-20s %-14s MISSING\n", r.name.c_str(), r.menu.c_str());
+            else printf("%-20s %-14s %u%s\n", r.name.c_str(), r.menu.c_str(), r.differences, r.differences ? " FAILED" : "");
+        }
+        printf("\n%-14s %8s %9s %9s\n", "menu", "renders", "avg us", "max us");
+        for (const auto& [title, s] : stats)
+        {
+            printf("%-14s %8u %9.2f %9.2f\n", title.empty() ? "-" : title.c_str(), s.renders,
+                   s.renders ? s.total_us / s.renders : 0.0, s.max_us);
+        }
+        printf("\n%zu snapshots over %d run(s) : %s\n", reports.size(), repeat,
+               update ? "golden images written" : failed ? "FAILED" : "ok");
+    }
+
+    return failed ? 2 : 0;
+}
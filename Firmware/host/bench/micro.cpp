@@ -0,0 +1,535 @@
+/**
+ * Microbenchmarks of the hot building blocks of the firmware : geometry, kinematics, gait planner,
+ * filters, analysis helpers, audio mixer and drawing primitives.
+ *
+ * Inputs are generated from a fixed seed, so two runs (or two commits) measure the same work.
+ * Each benchmark is calibrated to run for --min-time seconds, repeated 5 times, and the median
+ * is reported in ns/op along with the heap allocations per op (counted by replacing operator new).
+ *
+ * Usage : bench_micro [--json] [--filter text] [--min-time seconds]
+ */
+#include "common/geometry.hpp"
+#include "common/KalmanFilter.hpp"
+#include "common/analysis/ArrayStats.hpp"
+#include "common/analysis/FastRegression.hpp"
+#include "locomotion/KinematicsEngine.hpp"
+#include "locomotion/GaitPlanner.hpp"
+#include "audio/SoundMixer.hpp"
+#include "audio/SineProvider.hpp"
+#include "drivers/ScreenDriver.hpp"
+#include "ui/Draw.hpp"
+#include "common/config.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+/** ALLOCATION COUNTING **/
+
+static std::atomic<uint64_t> alloc_count(0);
+static std::atomic<uint64_t> alloc_bytes(0);
+
+void* operator new(size_t size)
+{
+    alloc_count.fetch_add(1, std::memory_order_relaxed);
+    alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = malloc(size > 0 ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    alloc_count.fetch_add(1, std::memory_order_relaxed);
+    alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+    return malloc(size > 0 ? size : 1);
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { free(ptr); }
+
+/** HARNESS **/
+
+constexpr uint32_t SEED = 0x360;
+constexpr int REPETITIONS = 5;
+// Inputs are cycled through, so the compiler can't hoist the work out of the loop
+constexpr size_t INPUT_COUNT = 256;
+
+/// @brief Keep the compiler from optimizing away a value
+template <typename T>
+inline void DoNotOptimize(const T& value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+/// @brief Runs the measured code the given number of times
+using Loop = std::function<void(uint64_t iterations)>;
+
+struct Benchmark
+{
+    std::string name;
+    /// @brief Builds the inputs (from a generator seeded with SEED) and returns the measured loop
+    std::function<Loop(std::mt19937&)> setup;
+};
+
+struct Result
+{
+    std::string name;
+    uint64_t iterations;
+    double ns_per_op;
+    double ns_min;
+    double ns_max;
+    double allocs_per_op;
+    double bytes_per_op;
+};
+
+static double run_for(const Loop& loop, uint64_t iterations)
+{
+    auto start = std::chrono::steady_clock::now();
+    loop(iterations);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+static Result measure(const Benchmark& benchmark, double min_time_s)
+{
+    std::mt19937 rng(SEED);
+    Loop loop = benchmark.setup(rng);
+
+    // calibration : grow the iteration count until a run lasts long enough
+    uint64_t iterations = 1;
+    double target_ns = min_time_s * 1e9;
+    while (true)
+    {
+        double elapsed = run_for(loop, iterations);
+        if (elapsed >= target_ns || iterations >= (1ull << 40)) break;
+        double scale = elapsed > 0 ? target_ns / elapsed * 1.2 : 100.0;
+        iterations = std::max<uint64_t>(iterations + 1, static_cast<uint64_t>(iterations * std::min(scale, 100.0)));
+    }
+
+    double times[REPETITIONS];
+    uint64_t allocs_before = alloc_count.load();
+    uint64_t bytes_before = alloc_bytes.load();
+    for (int r = 0; r < REPETITIONS; r++)
+    {
+        times[r] = run_for(loop, iterations) / iterations;
+    }
+    uint64_t total_ops = iterations * REPETITIONS;
+    std::sort(times, times + REPETITIONS);
+
+    return Result{
+        benchmark.name,
+        iterations,
+        times[REPETITIONS / 2],
+        times[0],
+        times[REPETITIONS - 1],
+        static_cast<double>(alloc_count.load() - allocs_before) / total_ops,
+        static_cast<double>(alloc_bytes.load() - bytes_before) / total_ops,
+    };
+}
+
+/** INPUT GENERATION **/
+
+static float uniform(std::mt19937& rng, float min, float max)
+{
+    return std::uniform_real_distribution<float>(min, max)(rng);
+}
+
+static Vec3f random_vec(std::mt19937& rng, float range)
+{
+    return Vec3f(uniform(rng, -range, range), uniform(rng, -range, range), uniform(rng, -range, range));
+}
+
+static std::vector<Vec3f> random_vecs(std::mt19937& rng, float range)
+{
+    std::vector<Vec3f> out(INPUT_COUNT);
+    for (Vec3f& v : out) v = random_vec(rng, range);
+    return out;
+}
+
+static std::vector<Quatf> random_quats(std::mt19937& rng)
+{
+    std::vector<Quatf> out(INPUT_COUNT);
+    for (Quatf& q : out) q = Quatf::FromEulerAngles(random_vec(rng, PI));
+    return out;
+}
+
+static KinematicsEngine make_kinematics()
+{
+    return KinematicsEngine(KinematicsEngine::KinematicsConfig{
+        .hip_shift_x = HIP_POS_X_M,
+        .hip_shift_y = HIP_POS_Y_M,
+        .hip_offset = HIP_OFFSET_M,
+        .length_thigh = LEG_THIGH_LENGTH_M,
+        .length_calf = LEG_CALF_LENGTH_M,
+        .leg_inverted = { false, false, true, true },
+    });
+}
+
+/** BENCHMARKS **/
+
+static std::vector<Benchmark> make_benchmarks()
+{
+    std::vector<Benchmark> benchmarks;
+
+    /** geometry **/
+    benchmarks.push_back({ "geometry/vec3_cross", [](std::mt19937& rng) -> Loop {
+        auto a = random_vecs(rng, 1.f), b = random_vecs(rng, 1.f);
+        return [a, b](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) DoNotOptimize(a[i % INPUT_COUNT].cross(b[(i + 1) % INPUT_COUNT]));
+        };
+    }});
+    benchmarks.push_back({ "geometry/vec3_normalized", [](std::mt19937& rng) -> Loop {
+        auto a = random_vecs(rng, 1.f);
+        return [a](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) DoNotOptimize(a[i % INPUT_COUNT].normalized());
+        };
+    }});
+    benchmarks.push_back({ "geometry/quat_multiply", [](std::mt19937& rng) -> Loop {
+        auto a = random_quats(rng), b = random_quats(rng);
+        return [a, b](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) DoNotOptimize(a[i % INPUT_COUNT] * b[(i + 1) % INPUT_COUNT]);
+        };
+    }});
+    benchmarks.push_back({ "geometry/quat_rotate", [](std::mt19937& rng) -> Loop {
+        auto q = random_quats(rng);
+        auto v = random_vecs(rng, 1.f);
+        return [q, v](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) DoNotOptimize(q[i % INPUT_COUNT].rotate(v[(i + 1) % INPUT_COUNT]));
+        };
+    }});
+    benchmarks.push_back({ "geometry/quat_from_euler", [](std::mt19937& rng) -> Loop {
+        auto a = random_vecs(rng, PI);
+        return [a](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) DoNotOptimize(Quatf::FromEulerAngles(a[i % INPUT_COUNT]));
+        };
+    }});
+    benchmarks.push_back({ "geometry/quat_to_euler", [](std::mt19937& rng) -> Loop {
+        auto q = random_quats(rng);
+        return [q](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) DoNotOptimize(q[i % INPUT_COUNT].toEulerAngles());
+        };
+    }});
+    benchmarks.push_back({ "geometry/transform_local_to_world", [](std::mt19937& rng) -> Loop {
+        std::vector<Transformf> t(INPUT_COUNT);
+        for (Transformf& tr : t) tr = Transformf(random_vec(rng, 0.2f), Quatf::FromEulerAngles(random_vec(rng, PI)));
+        auto v = random_vecs(rng, 0.2f);
+        return [t, v](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) DoNotOptimize(t[i % INPUT_COUNT].localToWorld(v[(i + 1) % INPUT_COUNT]));
+        };
+    }});
+    benchmarks.push_back({ "geometry/transform_world_to_local", [](std::mt19937& rng) -> Loop {
+        std::vector<Transformf> t(INPUT_COUNT);
+        for (Transformf& tr : t) tr = Transformf(random_vec(rng, 0.2f), Quatf::FromEulerAngles(random_vec(rng, PI)));
+        auto v = random_vecs(rng, 0.2f);
+        return [t, v](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) DoNotOptimize(t[i % INPUT_COUNT].worldToLocal(v[(i + 1) % INPUT_COUNT]));
+        };
+    }});
+
+    /** kinematics **/
+    benchmarks.push_back({ "kinematics/compute_body_ik", [](std::mt19937& rng) -> Loop {
+        // small body motions around the default stance, like the control loop asks for
+        std::vector<BodyCartesianState> states(INPUT_COUNT);
+        for (BodyCartesianState& state : states)
+        {
+            state.body_pos = Vec3f(0.f, 0.f, DEFAULT_BODY_HEIGHT_M) + random_vec(rng, 0.01f);
+            state.body_rot = random_vec(rng, DEG_TO_RAD(10.f));
+            for (int l = 0; l < 4; l++)
+            {
+                float sx = (l == 0 || l == 3) ? 1.f : -1.f;
+                float sy = (l == 0 || l == 1) ? 1.f : -1.f;
+                state.legs[l].target_pos = Vec3f(sx * DEFAULT_FEET_SPREAD_X_M, sy * DEFAULT_FEET_SPREAD_Y_M, 0.f) + random_vec(rng, 0.02f);
+            }
+        }
+        auto engine = std::make_shared<KinematicsEngine>(make_kinematics());
+        return [states, engine](uint64_t n) {
+            BodyJointState joints;
+            for (uint64_t i = 0; i < n; i++)
+            {
+                engine->computeBodyIK(states[i % INPUT_COUNT], joints);
+                DoNotOptimize(joints);
+            }
+        };
+    }});
+    benchmarks.push_back({ "kinematics/compute_leg_ik", [](std::mt19937& rng) -> Loop {
+        std::vector<Vec3f> targets(INPUT_COUNT);
+        for (Vec3f& t : targets) t = Vec3f(0.f, HIP_OFFSET_M, -DEFAULT_BODY_HEIGHT_M) + random_vec(rng, 0.03f);
+        auto engine = std::make_shared<KinematicsEngine>(make_kinematics());
+        return [targets, engine](uint64_t n) {
+            LegJointState joints;
+            for (uint64_t i = 0; i < n; i++)
+            {
+                engine->computeLegIK(targets[i % INPUT_COUNT], joints);
+                DoNotOptimize(joints);
+            }
+        };
+    }});
+
+    /** gait **/
+    for (float velocity : { 0.f, 0.1f })
+    {
+        benchmarks.push_back({ velocity > 0.f ? "gait/update_walk" : "gait/update_idle", [velocity](std::mt19937&) -> Loop {
+            auto planner = std::make_shared<GaitPlanner>();
+            planner->setVelocityCommand(velocity, 0.f, 0.f);
+            return [planner](uint64_t n) {
+                BodyCartesianState state;
+                state.body_pos = Vec3f(0.f, 0.f, DEFAULT_BODY_HEIGHT_M);
+                for (uint64_t i = 0; i < n; i++)
+                {
+                    planner->update(CONTROL_LOOP_DT_S, state);
+                    DoNotOptimize(state);
+                }
+            };
+        }});
+    }
+
+    /** filters **/
+    benchmarks.push_back({ "filters/kalman_1d_predict_update", [](std::mt19937& rng) -> Loop {
+        std::vector<float> moves(INPUT_COUNT), measures(INPUT_COUNT);
+        std::normal_distribution<float> noise(0.f, 0.01f);
+        for (size_t i = 0; i < INPUT_COUNT; i++)
+        {
+            moves[i] = uniform(rng, -0.02f, 0.02f);
+            measures[i] = 1.f + noise(rng);
+        }
+        return [moves, measures](uint64_t n) {
+            KalmanFilter1D filter;
+            filter.Init(1.f, 0.1f, 1.f);
+            for (uint64_t i = 0; i < n; i++)
+            {
+                filter.Predict(moves[i % INPUT_COUNT]);
+                DoNotOptimize(filter.Update(measures[i % INPUT_COUNT]));
+            }
+        };
+    }});
+
+    /** analysis **/
+    for (size_t size : { 100, 1000 })
+    {
+        benchmarks.push_back({ "analysis/array_stats_" + std::to_string(size), [size](std::mt19937& rng) -> Loop {
+            std::vector<float> values(size);
+            for (float& v : values) v = uniform(rng, 0.f, 3.3f);
+            return [values](uint64_t n) {
+                for (uint64_t i = 0; i < n; i++) DoNotOptimize(ArrayStats::GetStats(values.data(), values.size()));
+            };
+        }});
+    }
+    benchmarks.push_back({ "analysis/fast_regression_50_points", [](std::mt19937& rng) -> Loop {
+        std::vector<float> xs(50), ys(50);
+        for (size_t i = 0; i < xs.size(); i++)
+        {
+            xs[i] = static_cast<float>(i);
+            ys[i] = 0.5f * xs[i] + 2.f + uniform(rng, -0.1f, 0.1f);
+        }
+        return [xs, ys](uint64_t n) {
+            FastRegression regression;
+            float slope, offset, error;
+            for (uint64_t i = 0; i < n; i++)
+            {
+                regression.reset();
+                for (size_t p = 0; p < xs.size(); p++) regression.addPoint(xs[p], ys[p]);
+                regression.compute(slope, offset, error);
+                DoNotOptimize(slope);
+            }
+        };
+    }});
+
+    /** audio (one op = one mixer buffer) **/
+    benchmarks.push_back({ "audio/sine_provider_512", [](std::mt19937&) -> Loop {
+        auto provider = std::make_shared<SineProvider>(440.f, 0.5f);
+        return [provider](uint64_t n) {
+            Speaker::Sample buffer[SoundMixer::MIX_BUFFER_SIZE];
+            for (uint64_t i = 0; i < n; i++)
+            {
+                provider->provideSamples(buffer, SoundMixer::MIX_BUFFER_SIZE);
+                DoNotOptimize(buffer);
+            }
+        };
+    }});
+    for (int providers : { 1, 4 })
+    {
+        benchmarks.push_back({ "audio/mixer_" + std::to_string(providers) + "_sines_512", [providers](std::mt19937& rng) -> Loop {
+            static Speaker speaker;
+            auto mixer = std::make_shared<SoundMixer>(speaker);
+            for (int p = 0; p < providers; p++)
+            {
+                mixer->addSoundProvider(new SineProvider(uniform(rng, 200.f, 2000.f), 0.5f));
+            }
+            return [mixer](uint64_t n) {
+                Speaker::Sample buffer[SoundMixer::MIX_BUFFER_SIZE];
+                for (uint64_t i = 0; i < n; i++)
+                {
+                    mixer->mix(buffer, SoundMixer::MIX_BUFFER_SIZE);
+                    DoNotOptimize(buffer);
+                }
+            };
+        }});
+    }
+
+    /** drawing (ScreenDriver frame buffer, fake panel) **/
+    auto shapes = [](std::mt19937& rng, int count) {
+        std::vector<std::array<int16_t, 6>> out(INPUT_COUNT);
+        for (auto& s : out)
+        {
+            for (int k = 0; k < count; k++)
+            {
+                s[k] = static_cast<int16_t>(k % 2 == 0 ? rng() % SCREEN_WIDTH : rng() % SCREEN_HEIGHT);
+            }
+        }
+        return out;
+    };
+    benchmarks.push_back({ "draw/clear", [](std::mt19937&) -> Loop {
+        return [](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++)
+            {
+                ScreenDriver::Clear();
+                DoNotOptimize(ScreenDriver::info.data[0]);
+            }
+        };
+    }});
+    benchmarks.push_back({ "draw/pixel", [shapes](std::mt19937& rng) -> Loop {
+        auto s = shapes(rng, 2);
+        return [s](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) Draw::Pixel(s[i % INPUT_COUNT][0], s[i % INPUT_COUNT][1], i & 1);
+            DoNotOptimize(ScreenDriver::info.data[0]);
+        };
+    }});
+    benchmarks.push_back({ "draw/line", [shapes](std::mt19937& rng) -> Loop {
+        auto s = shapes(rng, 4);
+        return [s](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++)
+            {
+                const auto& p = s[i % INPUT_COUNT];
+                Draw::Line(p[0], p[1], p[2], p[3], i & 1);
+            }
+            DoNotOptimize(ScreenDriver::info.data[0]);
+        };
+    }});
+    benchmarks.push_back({ "draw/rect_filled_32x16", [shapes](std::mt19937& rng) -> Loop {
+        auto s = shapes(rng, 2);
+        return [s](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) Draw::RectFilled<true>(s[i % INPUT_COUNT][0], s[i % INPUT_COUNT][1], 32, 16, i & 1);
+            DoNotOptimize(ScreenDriver::info.data[0]);
+        };
+    }});
+    benchmarks.push_back({ "draw/rect_rounded_32x16", [](std::mt19937&) -> Loop {
+        return [](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) Draw::RectRounded(16 + (i % 64), 8 + (i % 32), 32, 16, 4, i & 1);
+            DoNotOptimize(ScreenDriver::info.data[0]);
+        };
+    }});
+    benchmarks.push_back({ "draw/circle_filled_r12", [](std::mt19937&) -> Loop {
+        return [](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) Draw::CircleFilled(16 + (i % 96), 16 + (i % 32), 12, i & 1);
+            DoNotOptimize(ScreenDriver::info.data[0]);
+        };
+    }});
+    benchmarks.push_back({ "draw/triangle_filled", [shapes](std::mt19937& rng) -> Loop {
+        auto s = shapes(rng, 6);
+        return [s](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++)
+            {
+                const auto& p = s[i % INPUT_COUNT];
+                Draw::TriangleFilled(p[0], p[1], p[2], p[3], p[4], p[5], i & 1);
+            }
+            DoNotOptimize(ScreenDriver::info.data[0]);
+        };
+    }});
+    benchmarks.push_back({ "draw/text_16_chars", [](std::mt19937&) -> Loop {
+        return [](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) Draw::Text(0, (i % 7) * 8, "TNY-360 v1.0 OK!", i & 1);
+            DoNotOptimize(ScreenDriver::info.data[0]);
+        };
+    }});
+    benchmarks.push_back({ "draw/blit_32x32", [](std::mt19937& rng) -> Loop {
+        std::vector<uint8_t> bitmap(32 * 32 / 8);
+        for (uint8_t& b : bitmap) b = static_cast<uint8_t>(rng());
+        return [bitmap](uint64_t n) mutable {
+            for (uint64_t i = 0; i < n; i++) Draw::Blit(i % 96, i % 32, 32, 32, bitmap.data(), true, i & 1);
+            DoNotOptimize(ScreenDriver::info.data[0]);
+        };
+    }});
+    benchmarks.push_back({ "draw/upload_frame", [](std::mt19937&) -> Loop {
+        return [](uint64_t n) {
+            for (uint64_t i = 0; i < n; i++) ScreenDriver::Upload();
+        };
+    }});
+
+    return benchmarks;
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    const char* filter = nullptr;
+    double min_time_s = 0.1;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) filter = argv[++i];
+        else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) min_time_s = strtod(argv[++i], nullptr);
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--filter text] [--min-time seconds]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (ScreenDriver::Init() != Status::Ok)
+    {
+        fprintf(stderr, "Failed to initialize the screen driver\n");
+        return 1;
+    }
+
+    std::vector<Result> results;
+    for (const Benchmark& benchmark : make_benchmarks())
+    {
+        if (filter != nullptr && benchmark.name.find(filter) == std::string::npos) continue;
+        results.push_back(measure(benchmark, min_time_s));
+        if (!json)
+        {
+            const Result& r = results.back();
+            printf("%-40s %12.2f ns/op  [%9.2f .. %9.2f]  %6.2f allocs/op %8.1f B/op  (%llu iterations)\n",
+                   r.name.c_str(), r.ns_per_op, r.ns_min, r.ns_max, r.allocs_per_op, r.bytes_per_op,
+                   static_cast<unsigned long long>(r.iterations));
+        }
+    }
+
+    if (json)
+    {
+        printf("{\"seed\": %u, \"repetitions\": %d, \"min_time_s\": %.3f, \"benchmarks\": [\n", SEED, REPETITIONS, min_time_s);
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const Result& r = results[i];
+            printf("  {\"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.3f, \"ns_min\": %.3f, \"ns_max\": %.3f, "
+                   "\"allocs_per_op\": %.4f, \"bytes_per_op\": %.2f}%s\n",
+                   r.name.c_str(), static_cast<unsigned long long>(r.iterations), r.ns_per_op, r.ns_min, r.ns_max,
+                   r.allocs_per_op, r.bytes_per_op, i + 1 < results.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+
+    ScreenDriver::Deinit();
+    return 0;
+}
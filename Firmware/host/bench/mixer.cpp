@@ -0,0 +1,205 @@
+/**
+ * SoundMixer::mix() (Q15 block pipeline, audio/Mixing.hpp) against the previous per-sample mixing loop.
+ *
+ * Providers replay fixed-seed random blocks, so both loops only measure the mixing work.
+ * - quiet : providers at 1/8 full scale, the limiter never engages (also checks that both loops agree)
+ * - loud : providers at full scale, every buffer goes through the soft-knee limiter (the old loop hard clips)
+ *
+ * Usage : bench_mixer [--json]
+ */
+#include "audio/Mixing.hpp"
+#include "audio/SoundMixer.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+constexpr uint32_t SEED = 0x360;
+constexpr size_t BLOCK = SoundMixer::MIX_BUFFER_SIZE;
+constexpr float MASTER_VOLUME = 0.8f;
+
+// Sink so the mixed buffers can't be optimized away
+static volatile int32_t sink = 0;
+
+/**
+ * @brief Provider playing a fixed buffer in a loop.
+ */
+class ReplayProvider : public SoundProvider
+{
+public:
+    ReplayProvider(const std::vector<Speaker::Sample>& samples) : samples(samples) {}
+
+    bool provideSamples(Speaker::Sample* buffer, size_t sampleCount) override
+    {
+        memcpy(buffer, samples.data() + offset, sampleCount * sizeof(Speaker::Sample));
+        offset = (offset + sampleCount) % (samples.size() - BLOCK);
+        return true;
+    }
+
+private:
+    const std::vector<Speaker::Sample>& samples;
+    size_t offset = 0;
+};
+
+/**
+ * @brief Mixing loop of the SoundMixer before the Q15 pipeline (kept as the reference).
+ */
+static void legacy_mix(SoundProvider** providers, size_t nb_providers, float master_volume, Speaker::Sample* buffer, size_t sampleCount)
+{
+    Speaker::Sample sourceBuffer[BLOCK];
+    memset(buffer, 0, sampleCount * sizeof(Speaker::Sample));
+    for (size_t source_idx = 0; source_idx < nb_providers; source_idx++)
+    {
+        providers[source_idx]->provideSamples(sourceBuffer, sampleCount);
+        for (size_t i = 0; i < sampleCount; i++)
+        {
+            int32_t mixedSample = static_cast<int32_t>(buffer[i]) + static_cast<int32_t>(sourceBuffer[i]);
+            if (mixedSample > INT16_MAX) mixedSample = INT16_MAX;
+            else if (mixedSample < INT16_MIN) mixedSample = INT16_MIN;
+            buffer[i] = static_cast<Speaker::Sample>(mixedSample);
+        }
+    }
+    for (size_t i = 0; i < sampleCount; i++)
+    {
+        buffer[i] = static_cast<Speaker::Sample>(buffer[i] * master_volume);
+    }
+}
+
+struct Result
+{
+    std::string name;
+    size_t providers;
+    double legacy_samples_per_us;
+    double mixer_samples_per_us;
+    int max_deviation;    // largest difference between both outputs (quiet runs only)
+    uint32_t limited;     // samples bent by the limiter over the run
+    uint32_t avg_mix_us;  // SoundMixer own CPU time report
+};
+
+template <typename F>
+static double samples_per_us(uint64_t buffers, F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return buffers * BLOCK / std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+static Result run(const char* name, size_t nb_providers, int16_t amplitude)
+{
+    constexpr uint64_t BUFFERS = 100'000;
+    std::mt19937 rng(SEED + nb_providers);
+    std::uniform_int_distribution<int> dist(-amplitude, amplitude);
+
+    std::vector<std::vector<Speaker::Sample>> sources(nb_providers, std::vector<Speaker::Sample>(BLOCK * 16 + 1));
+    for (auto& source : sources)
+        for (Speaker::Sample& sample : source) sample = static_cast<Speaker::Sample>(dist(rng));
+
+    Result result{ name, nb_providers };
+
+    // previous loop
+    std::vector<ReplayProvider> legacyProviders;
+    std::vector<SoundProvider*> legacyPtrs;
+    for (auto& source : sources) legacyProviders.emplace_back(source);
+    for (auto& provider : legacyProviders) legacyPtrs.push_back(&provider);
+    Speaker::Sample legacyBuffer[BLOCK];
+    result.legacy_samples_per_us = samples_per_us(BUFFERS, [&]() {
+        for (uint64_t b = 0; b < BUFFERS; b++)
+        {
+            legacy_mix(legacyPtrs.data(), nb_providers, MASTER_VOLUME, legacyBuffer, BLOCK);
+            sink = sink + legacyBuffer[b % BLOCK];
+        }
+    });
+
+    // new pipeline (the mixer owns and deletes its providers)
+    Speaker speaker;
+    SoundMixer mixer(speaker);
+    mixer.setVolume(MASTER_VOLUME);
+    for (auto& source : sources) mixer.addSoundProvider(new ReplayProvider(source));
+    Speaker::Sample mixBuffer[BLOCK];
+    result.mixer_samples_per_us = samples_per_us(BUFFERS, [&]() {
+        for (uint64_t b = 0; b < BUFFERS; b++)
+        {
+            mixer.mix(mixBuffer, BLOCK);
+            sink = sink + mixBuffer[b % BLOCK];
+        }
+    });
+    SoundMixer::Stats stats = mixer.getStats();
+    result.limited = stats.limited_samples;
+    result.avg_mix_us = stats.avg_mix_us;
+
+    // compare a few buffers from the same starting point
+    result.max_deviation = 0;
+    SoundMixer reference(speaker);
+    reference.setVolume(MASTER_VOLUME);
+    std::vector<ReplayProvider> compareProviders;
+    std::vector<SoundProvider*> comparePtrs;
+    for (auto& source : sources)
+    {
+        compareProviders.emplace_back(source);
+        reference.addSoundProvider(new ReplayProvider(source));
+    }
+    for (auto& provider : compareProviders) comparePtrs.push_back(&provider);
+    for (int b = 0; b < 64; b++)
+    {
+        legacy_mix(comparePtrs.data(), nb_providers, MASTER_VOLUME, legacyBuffer, BLOCK);
+        reference.mix(mixBuffer, BLOCK);
+        for (size_t i = 0; i < BLOCK; i++)
+        {
+            int deviation = std::abs(legacyBuffer[i] - mixBuffer[i]);
+            if (deviation > result.max_deviation) result.max_deviation = deviation;
+        }
+    }
+    reference.deinit();
+    mixer.deinit();
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<Result> results;
+    for (size_t providers = 1; providers <= SPEAKER_NB_AUDIO_PROVIDERS; providers++)
+        results.push_back(run("quiet", providers, INT16_MAX / 8));
+    for (size_t providers = 1; providers <= SPEAKER_NB_AUDIO_PROVIDERS; providers++)
+        results.push_back(run("loud", providers, INT16_MAX));
+
+    if (json)
+    {
+        printf("{\"block\": %zu, \"master_volume\": %.2f, \"benchmarks\": [\n", BLOCK, MASTER_VOLUME);
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const Result& r = results[i];
+            printf("  {\"name\": \"%s_%zu\", \"legacy_samples_per_us\": %.2f, \"mixer_samples_per_us\": %.2f, \"speedup\": %.2f, "
+                   "\"max_deviation\": %d, \"limited_samples\": %u, \"avg_mix_us\": %u}%s\n",
+                   r.name.c_str(), r.providers, r.legacy_samples_per_us, r.mixer_samples_per_us,
+                   r.mixer_samples_per_us / r.legacy_samples_per_us, r.max_deviation, r.limited, r.avg_mix_us,
+                   i + 1 < results.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("%zu samples per buffer, master volume %.2f\n\n", BLOCK, MASTER_VOLUME);
+        printf("%-8s %9s %16s %16s %9s %13s %14s\n", "signal", "providers", "legacy smp/us", "mixer smp/us", "speedup", "max deviation", "limited smp");
+        for (const Result& r : results)
+        {
+            printf("%-8s %9zu %16.2f %16.2f %8.2fx %13d %14u\n", r.name.c_str(), r.providers, r.legacy_samples_per_us,
+                   r.mixer_samples_per_us, r.mixer_samples_per_us / r.legacy_samples_per_us, r.max_deviation, r.limited);
+        }
+        printf("\nmax deviation : largest sample difference with the previous loop (quiet : rounding only, loud : limiter vs clipping)\n");
+    }
+    return 0;
+}
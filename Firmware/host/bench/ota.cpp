@@ -0,0 +1,731 @@
+/**
+ * OTA downloads (network/OtaDownload.hpp, network/OtaManifest.hpp, common/Sha256.hpp) : SHA-256 test vectors, manifest
+ * text and signatures, then downloads of a random image from a loopback HTTP/1.1 server to a file-backed partition.
+ *
+ * - server : one connection at a time with small socket buffers (like the lwIP window), paced at the link rate. It
+ *            answers Range requests with 206 and Content-Range, or ignores them (200 with the whole image), and can
+ *            drop connections after some bytes (closed early or reset), flip a bit of the image or answer 404
+ * - partition : a file written in order, paced at the flash program rate, with a block erase stall every 64 KB
+ * - downloads : OtaDownload (reader task and ring buffer, resumed with Range requests) against the sequential loop
+ *               the update used before (read a chunk, write it, any loss fails the update), and OtaDownload with a
+ *               legacy manifest (no size nor hash : one connection, no resume)
+ *
+ * Manifest signatures are made with a fresh P-256 key and checked through the Verifier (needs OpenSSL, skipped
+ * otherwise). The tool exits with 2 if a check fails : a complete image differing from the served one, a corrupted,
+ * truncated or oversized image accepted, a lost connection not resumed (or resumed for a legacy manifest), a tampered
+ * manifest accepted, or the overlapped download not faster than the sequential one on a clean link.
+ *
+ * Usage : bench_ota [--json] [--size KB] [--link KB/s] [--flash KB/s]
+ */
+#include "network/OtaDownload.hpp"
+#include "network/OtaManifest.hpp"
+#include "common/Sha256.hpp"
+#include "Check.hpp"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef HAVE_OPENSSL
+#include <openssl/ec.h>
+#include <openssl/evp.h>
+#endif
+
+constexpr uint32_t SEED = 0x360;
+constexpr int SOCKET_BUFFER = 4 * 1024; // doubled by Linux, about the lwIP TCP window of the robot
+constexpr uint32_t FLASH_BLOCK = 64 * 1024;
+constexpr uint32_t FLASH_BLOCK_ERASE_MS = 150; // typical 64 KB block erase of the SPI flash
+constexpr uint32_t RESUME_DELAY_MS = 20;  // instead of OTA_RESUME_DELAY_MS, the server is local
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static std::string to_hex(const uint8_t* data, size_t size)
+{
+    std::string hex;
+    char digits[3];
+    for (size_t i = 0; i < size; i++)
+    {
+        snprintf(digits, sizeof(digits), "%02x", data[i]);
+        hex += digits;
+    }
+    return hex;
+}
+
+static bool send_all(int fd, const void* data, size_t size)
+{
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0)
+    {
+        ssize_t sent = send(fd, bytes, size, MSG_NOSIGNAL);
+        if (sent <= 0) return false;
+        bytes += sent;
+        size -= sent;
+    }
+    return true;
+}
+
+/// ========== Server ========== ///
+
+/**
+ * Faults of the server
+ * - `ignore_range`: answer every request with the whole image
+ * - `drops`: connections to drop, each after `drop_after` bytes of body (every other one with a reset)
+ * - `corrupt_at`: offset of a flipped bit (-1 for none)
+ * - `not_found`: answer 404
+ */
+struct Faults
+{
+    bool ignore_range = false;
+    uint32_t drops = 0;
+    uint32_t drop_after = 0;
+    int64_t corrupt_at = -1;
+    bool not_found = false;
+};
+
+struct Server
+{
+    std::string image;
+    uint32_t link_bps;
+    Faults faults;
+    int listen_fd = -1;
+    uint16_t port = 0;
+    std::thread thread;
+    std::atomic<uint32_t> requests{0};
+    std::atomic<uint32_t> ranges{0};
+
+    bool start()
+    {
+        listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+        int yes = 1;
+        setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(listen_fd, 4) != 0) return false;
+        socklen_t length = sizeof(addr);
+        getsockname(listen_fd, reinterpret_cast<sockaddr*>(&addr), &length);
+        port = ntohs(addr.sin_port);
+        thread = std::thread([this]() { run(); });
+        return true;
+    }
+
+    void stop()
+    {
+        shutdown(listen_fd, SHUT_RDWR);
+        thread.join();
+        close(listen_fd);
+    }
+
+    void run()
+    {
+        while (true)
+        {
+            int fd = accept(listen_fd, nullptr, nullptr);
+            if (fd < 0) return;
+            setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &SOCKET_BUFFER, sizeof(SOCKET_BUFFER));
+            handle(fd);
+            close(fd);
+        }
+    }
+
+    void handle(int fd)
+    {
+        std::string request;
+        char c;
+        while (request.find("\r\n\r\n") == std::string::npos)
+        {
+            if (recv(fd, &c, 1, 0) != 1) return;
+            request += c;
+        }
+        requests++;
+        if (faults.not_found)
+        {
+            send_all(fd, "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n", 45);
+            return;
+        }
+
+        uint32_t start = 0;
+        size_t range = request.find("Range: bytes=");
+        if (range != std::string::npos && !faults.ignore_range)
+        {
+            start = std::min<uint32_t>(strtoul(request.c_str() + range + 13, nullptr, 10), image.size());
+            ranges++;
+        }
+        uint32_t length = image.size() - start;
+        char headers[160];
+        if (range != std::string::npos && !faults.ignore_range)
+        {
+            snprintf(headers, sizeof(headers), "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes %u-%zu/%zu\r\nContent-Length: %u\r\n\r\n",
+                     start, image.size() - 1, image.size(), length);
+        }
+        else snprintf(headers, sizeof(headers), "HTTP/1.1 200 OK\r\nContent-Length: %u\r\n\r\n", length);
+        if (!send_all(fd, headers, strlen(headers))) return;
+
+        bool drop = faults.drops > 0;
+        uint32_t limit = drop ? std::min(length, faults.drop_after) : length;
+        std::string piece;
+        for (uint32_t sent = 0; sent < limit;)
+        {
+            uint32_t size = std::min<uint32_t>(1460, limit - sent); // one TCP segment
+            piece.assign(image, start + sent, size);
+            if (faults.corrupt_at >= start + sent && faults.corrupt_at < start + sent + size) piece[faults.corrupt_at - start - sent] ^= 0x10;
+            if (!send_all(fd, piece.data(), size)) return;
+            sent += size;
+            std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int64_t>(size * 1e6 / link_bps)));
+        }
+        if (drop)
+        {
+            if (faults.drops-- % 2 == 0)
+            {
+                linger reset = { 1, 0 }; // RST instead of FIN
+                setsockopt(fd, SOL_SOCKET, SO_LINGER, &reset, sizeof(reset));
+            }
+        }
+    }
+};
+
+/// ========== Source and target ========== ///
+
+/**
+ * @brief OtaDownload::Source over a socket, like the HTTP client of UpdateManager.
+ */
+class SocketSource : public OtaDownload::Source
+{
+public:
+    explicit SocketSource(uint16_t port) : port(port) {}
+    ~SocketSource() override { close(); }
+
+    Status open(uint32_t offset, uint32_t& start, uint32_t& total) override
+    {
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &SOCKET_BUFFER, sizeof(SOCKET_BUFFER));
+        timeval timeout = { 2, 0 };
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(port);
+        if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0)
+        {
+            close();
+            return Status::Failure;
+        }
+
+        char request[96];
+        int length = snprintf(request, sizeof(request), "GET /firmware.bin HTTP/1.1\r\nHost: localhost\r\n");
+        if (offset > 0) length += snprintf(request + length, sizeof(request) - length, "Range: bytes=%u-\r\n", offset);
+        length += snprintf(request + length, sizeof(request) - length, "\r\n");
+        if (!send_all(fd, request, length))
+        {
+            close();
+            return Status::Failure;
+        }
+
+        std::string headers;
+        char buffer[512];
+        size_t end;
+        while ((end = headers.find("\r\n\r\n")) == std::string::npos)
+        {
+            ssize_t received = recv(fd, buffer, sizeof(buffer), 0);
+            if (received <= 0)
+            {
+                close();
+                return Status::Failure;
+            }
+            headers.append(buffer, received);
+        }
+        pending = headers.substr(end + 4);
+        headers.resize(end + 2);
+
+        int code = atoi(headers.c_str() + 9);
+        size_t content_length = headers.find("Content-Length: ");
+        remaining = content_length == std::string::npos ? 0 : strtoul(headers.c_str() + content_length + 16, nullptr, 10);
+        if (code == 206)
+        {
+            unsigned long first, last, size;
+            size_t content_range = headers.find("Content-Range: ");
+            if (content_range == std::string::npos || sscanf(headers.c_str() + content_range, "Content-Range: bytes %lu-%lu/%lu", &first, &last, &size) != 3)
+            {
+                close();
+                return Status::InvalidState;
+            }
+            start = first;
+            total = size;
+            return Status::Ok;
+        }
+        if (code == 200)
+        {
+            start = 0;
+            total = remaining;
+            return Status::Ok;
+        }
+        close();
+        return code >= 500 ? Status::Failure : Status::NotFound;
+    }
+
+    int read(uint8_t* buffer, size_t size) override
+    {
+        size = std::min<size_t>(size, remaining);
+        if (size == 0) return 0;
+        if (!pending.empty())
+        {
+            size = std::min(size, pending.size());
+            memcpy(buffer, pending.data(), size);
+            pending.erase(0, size);
+            remaining -= size;
+            return size;
+        }
+        ssize_t received = recv(fd, buffer, size, 0);
+        if (received > 0) remaining -= received;
+        return received;
+    }
+
+    void close() override
+    {
+        if (fd >= 0) ::close(fd);
+        fd = -1;
+    }
+
+private:
+    uint16_t port;
+    int fd = -1;
+    std::string pending;
+    uint32_t remaining = 0;
+};
+
+/**
+ * @brief OtaDownload::Target in a file, written in order at the flash rate.
+ */
+class FileTarget : public OtaDownload::Target
+{
+public:
+    FileTarget(const char* path, uint32_t capacity, uint32_t flash_bps) : path(path), capacity(capacity), flash_bps(flash_bps) {}
+    ~FileTarget() override { if (file) fclose(file); }
+
+    Status begin(uint32_t size) override
+    {
+        if (size > capacity) return Status::OutOfBounds;
+        file = fopen(path, "wb");
+        began = true;
+        return file ? Status::Ok : Status::Failure;
+    }
+
+    Status write(const uint8_t* data, size_t size) override
+    {
+        if (fwrite(data, 1, size, file) != size) return Status::Failure;
+        int64_t stall_us = static_cast<int64_t>(size * 1e6 / flash_bps);
+        for (; erased < written + size; erased += FLASH_BLOCK) stall_us += FLASH_BLOCK_ERASE_MS * 1000;
+        written += size;
+        std::this_thread::sleep_for(std::chrono::microseconds(stall_us));
+        return Status::Ok;
+    }
+
+    Status finish() override
+    {
+        fclose(file);
+        file = nullptr;
+        finished = true;
+        return Status::Ok;
+    }
+
+    void abort() override
+    {
+        if (file) fclose(file);
+        file = nullptr;
+        aborted = true;
+    }
+
+    std::string content() const
+    {
+        std::string data;
+        FILE* in = fopen(path, "rb");
+        if (!in) return data;
+        char buffer[4096];
+        size_t length;
+        while ((length = fread(buffer, 1, sizeof(buffer), in)) > 0) data.append(buffer, length);
+        fclose(in);
+        return data;
+    }
+
+    const char* path;
+    uint32_t capacity;
+    uint32_t flash_bps;
+    FILE* file = nullptr;
+    bool began = false;
+    bool finished = false;
+    bool aborted = false;
+    uint32_t written = 0;
+    uint32_t erased = 0;
+};
+
+/// ========== Checks ========== ///
+
+static void check_sha256()
+{
+    struct Vector { std::string message; const char* hex; };
+    const Vector vectors[] = {
+        { "", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+        { "abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+        { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+        { std::string(1000000, 'a'), "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0" },
+    };
+    for (const Vector& vector : vectors)
+    {
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(vector.message.data());
+        uint8_t digest[Sha256::SIZE];
+        Sha256::Hash(data, vector.message.size(), digest);
+        check(to_hex(digest, Sha256::SIZE) == vector.hex, "SHA-256 test vector");
+
+        // same hash in uneven updates, across the 64 bytes blocks and the padding
+        Sha256 sha;
+        for (size_t offset = 0, step = 1; offset < vector.message.size(); offset += step, step = step * 3 % 127 + 1)
+        {
+            sha.update(data + offset, std::min(step, vector.message.size() - offset));
+        }
+        sha.finish(digest);
+        check(to_hex(digest, Sha256::SIZE) == vector.hex, "SHA-256 in chunks");
+        sha.reset();
+        sha.update(data, vector.message.size());
+        sha.finish(digest);
+        check(to_hex(digest, Sha256::SIZE) == vector.hex, "SHA-256 after reset");
+    }
+}
+
+static OtaManifest::Manifest make_manifest(const std::string& image)
+{
+    OtaManifest::Manifest manifest;
+    manifest.version = "1.4.0";
+    manifest.firmware.url = "https://cdn.tny-robotics.com/firmware/tny-360/1.4.0/firmware.bin";
+    manifest.firmware.size = image.size();
+    Sha256::Hash(reinterpret_cast<const uint8_t*>(image.data()), image.size(), manifest.firmware.sha256);
+    manifest.filesystem.url = "https://cdn.tny-robotics.com/firmware/tny-360/1.4.0/filesystem.bin";
+    manifest.filesystem.size = 1441792;
+    Sha256::Hash(reinterpret_cast<const uint8_t*>("filesystem"), 10, manifest.filesystem.sha256);
+    return manifest;
+}
+
+static void check_manifest(const std::string& image, bool& signatures_checked)
+{
+    OtaManifest::Manifest manifest = make_manifest(image);
+    std::string text = OtaManifest::SignedText(manifest, OTA_ROBOT_MODEL);
+    std::string expected = std::string(OTA_ROBOT_MODEL) + "\n1.4.0\nfirmware " + std::to_string(image.size()) + " " +
+                           to_hex(manifest.firmware.sha256, Sha256::SIZE) + "\nfilesystem 1441792 " +
+                           to_hex(manifest.filesystem.sha256, Sha256::SIZE) + "\n";
+    check(text == expected, "manifest signed text");
+
+    uint8_t hash[Sha256::SIZE];
+    std::string hex = to_hex(manifest.firmware.sha256, Sha256::SIZE);
+    check(OtaManifest::ParseHash(hex.c_str(), hash) && memcmp(hash, manifest.firmware.sha256, Sha256::SIZE) == 0, "hash parsed");
+    for (char& c : hex) c = toupper(c);
+    check(OtaManifest::ParseHash(hex.c_str(), hash) && memcmp(hash, manifest.firmware.sha256, Sha256::SIZE) == 0, "uppercase hash parsed");
+    check(!OtaManifest::ParseHash(hex.substr(2).c_str(), hash), "short hash refused");
+    check(!OtaManifest::ParseHash(("zz" + hex.substr(2)).c_str(), hash), "non hex hash refused");
+    check(!OtaManifest::ParseHash(nullptr, hash), "missing hash refused");
+
+    uint8_t decoded[16];
+    check(OtaManifest::DecodeBase64("TWFu", decoded, sizeof(decoded)) == 3 && memcmp(decoded, "Man", 3) == 0, "base64");
+    check(OtaManifest::DecodeBase64("TWE=", decoded, sizeof(decoded)) == 2 && memcmp(decoded, "Ma", 2) == 0, "base64 padded");
+    check(OtaManifest::DecodeBase64("TQ", decoded, sizeof(decoded)) == 1 && decoded[0] == 'M', "base64 unpadded");
+    check(OtaManifest::DecodeBase64("TW$u", decoded, sizeof(decoded)) == 0, "invalid base64 refused");
+    check(OtaManifest::DecodeBase64("TWFuTWFu", decoded, 4) == 0, "base64 over capacity refused");
+    check(OtaManifest::DecodeBase64("TQ==x", decoded, sizeof(decoded)) == 0, "data after the base64 padding refused");
+
+    auto accept_all = [](const uint8_t*, const uint8_t*, size_t) { return true; };
+    check(OtaManifest::Verify(manifest, OTA_ROBOT_MODEL, nullptr, 0, accept_all) == Status::InvalidParameters, "missing signature refused");
+
+#ifdef HAVE_OPENSSL
+    EVP_PKEY* key = EVP_EC_gen("P-256");
+    auto sign = [](EVP_PKEY* key, const OtaManifest::Manifest& signed_manifest, const char* model) {
+        std::string message = OtaManifest::SignedText(signed_manifest, model);
+        std::vector<uint8_t> signature(128);
+        size_t length = signature.size();
+        EVP_MD_CTX* context = EVP_MD_CTX_new();
+        EVP_DigestSignInit(context, nullptr, EVP_sha256(), nullptr, key);
+        EVP_DigestSign(context, signature.data(), &length, reinterpret_cast<const uint8_t*>(message.data()), message.size());
+        EVP_MD_CTX_free(context);
+        signature.resize(length);
+        return signature;
+    };
+    // what mbedtls_pk_verify() does on the robot : ECDSA over the digest, DER signature
+    OtaManifest::Verifier verifier = [key](const uint8_t digest[Sha256::SIZE], const uint8_t* signature, size_t size) {
+        EVP_PKEY_CTX* context = EVP_PKEY_CTX_new(key, nullptr);
+        bool ok = EVP_PKEY_verify_init(context) == 1 && EVP_PKEY_CTX_set_signature_md(context, EVP_sha256()) == 1 &&
+                  EVP_PKEY_verify(context, signature, size, digest, Sha256::SIZE) == 1;
+        EVP_PKEY_CTX_free(context);
+        return ok;
+    };
+
+    std::vector<uint8_t> signature = sign(key, manifest, OTA_ROBOT_MODEL);
+    check(OtaManifest::Verify(manifest, OTA_ROBOT_MODEL, signature.data(), signature.size(), verifier) == Status::Ok, "signed manifest accepted");
+
+    OtaManifest::Manifest moved = manifest;
+    moved.firmware.url = "https://mirror.example.com/firmware.bin";
+    check(OtaManifest::Verify(moved, OTA_ROBOT_MODEL, signature.data(), signature.size(), verifier) == Status::Ok, "URLs outside the signature");
+
+    OtaManifest::Manifest tampered = manifest;
+    tampered.firmware.sha256[7] ^= 1;
+    check(OtaManifest::Verify(tampered, OTA_ROBOT_MODEL, signature.data(), signature.size(), verifier) == Status::InvalidParameters, "tampered hash refused");
+    tampered = manifest;
+    tampered.filesystem.size++;
+    check(OtaManifest::Verify(tampered, OTA_ROBOT_MODEL, signature.data(), signature.size(), verifier) == Status::InvalidParameters, "tampered size refused");
+    tampered = manifest;
+    tampered.version = "9.9.9";
+    check(OtaManifest::Verify(tampered, OTA_ROBOT_MODEL, signature.data(), signature.size(), verifier) == Status::InvalidParameters, "tampered version refused");
+    check(OtaManifest::Verify(manifest, "tny-180", signature.data(), signature.size(), verifier) == Status::InvalidParameters, "other model refused");
+    std::vector<uint8_t> broken = signature;
+    broken[broken.size() / 2] ^= 0x40;
+    check(OtaManifest::Verify(manifest, OTA_ROBOT_MODEL, broken.data(), broken.size(), verifier) == Status::InvalidParameters, "broken signature refused");
+
+    EVP_PKEY* other = EVP_EC_gen("P-256");
+    std::vector<uint8_t> foreign = sign(other, manifest, OTA_ROBOT_MODEL);
+    check(OtaManifest::Verify(manifest, OTA_ROBOT_MODEL, foreign.data(), foreign.size(), verifier) == Status::InvalidParameters, "signature of another key refused");
+    EVP_PKEY_free(other);
+    EVP_PKEY_free(key);
+    signatures_checked = true;
+#else
+    signatures_checked = false;
+#endif
+}
+
+/// ========== Downloads ========== ///
+
+/**
+ * Result of a download
+ * - `status`: returned by the download
+ * - `seconds`: wall time
+ * - `progress`: last progress report
+ * - `reports`: progress callbacks, `monotonic` if `written` never went back
+ * - `requests`, `ranges`: HTTP requests to the server, with a honored range
+ * - `intact`: target finished with the served image
+ */
+struct Result
+{
+    const char* name;
+    Status status;
+    double seconds;
+    OtaDownload::Progress progress;
+    uint32_t reports;
+    bool monotonic;
+    uint32_t requests;
+    uint32_t ranges;
+    bool intact;
+    bool aborted;
+};
+
+static Result run_download(const char* name, const std::string& image, uint32_t link_bps, uint32_t flash_bps, const Faults& faults,
+                           int64_t size_offset = 0, uint32_t capacity = 0, bool legacy = false)
+{
+    Server server;
+    server.image = image;
+    server.link_bps = link_bps;
+    server.faults = faults;
+    Result result = { name };
+    if (!server.start())
+    {
+        check(false, "server start");
+        return result;
+    }
+
+    OtaManifest::Image manifest_image = make_manifest(image).firmware;
+    manifest_image.size += size_offset;
+    if (legacy)
+    {
+        manifest_image.size = 0;
+        memset(manifest_image.sha256, 0, Sha256::SIZE);
+    }
+    SocketSource source(server.port);
+    FileTarget target("/tmp/tny360_ota_partition.bin", capacity ? capacity : image.size() * 2, flash_bps);
+    OtaDownload download(OTA_RING_SIZE, OTA_CHUNK_SIZE, RESUME_DELAY_MS);
+
+    uint32_t last_written = 0;
+    result.monotonic = true;
+    auto start = std::chrono::steady_clock::now();
+    result.status = download.run(source, target, manifest_image, [&](const OtaDownload::Progress& progress) {
+        result.reports++;
+        result.monotonic = result.monotonic && progress.written >= last_written && progress.written <= progress.received;
+        last_written = progress.written;
+    });
+    result.seconds = seconds_since(start);
+    result.progress = download.getProgress();
+    server.stop();
+    result.requests = server.requests;
+    result.ranges = server.ranges;
+    result.intact = target.finished && target.content() == image;
+    result.aborted = target.aborted || !target.began;
+    remove(target.path);
+    return result;
+}
+
+/**
+ * @brief The previous update loop : one connection, read a chunk then write it, any loss fails the update.
+ */
+static Result run_sequential(const char* name, const std::string& image, uint32_t link_bps, uint32_t flash_bps, const Faults& faults)
+{
+    Server server;
+    server.image = image;
+    server.link_bps = link_bps;
+    server.faults = faults;
+    Result result = { name };
+    if (!server.start())
+    {
+        check(false, "server start");
+        return result;
+    }
+
+    SocketSource source(server.port);
+    FileTarget target("/tmp/tny360_ota_partition.bin", image.size() * 2, flash_bps);
+    std::vector<uint8_t> buffer(OTA_CHUNK_SIZE);
+    auto start = std::chrono::steady_clock::now();
+    uint32_t first, total, received = 0;
+    result.status = source.open(0, first, total);
+    if (result.status == Status::Ok) result.status = target.begin(total);
+    while (result.status == Status::Ok && received < total)
+    {
+        int length = source.read(buffer.data(), buffer.size());
+        if (length <= 0) result.status = Status::Failure;
+        else
+        {
+            result.status = target.write(buffer.data(), length);
+            received += length;
+        }
+    }
+    source.close();
+    if (result.status == Status::Ok) target.finish();
+    else target.abort();
+    result.seconds = seconds_since(start);
+    result.progress = { static_cast<uint32_t>(image.size()), received, received, received, static_cast<float>(received / result.seconds), 0 };
+    result.monotonic = true;
+    server.stop();
+    result.requests = server.requests;
+    result.intact = target.finished && target.content() == image;
+    result.aborted = target.aborted;
+    remove(target.path);
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    uint32_t size_kb = 512;
+    uint32_t link_kbps = 384;
+    uint32_t flash_kbps = 1024;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) size_kb = std::max(64ul, strtoul(argv[++i], nullptr, 10));
+        else if (strcmp(argv[i], "--link") == 0 && i + 1 < argc) link_kbps = std::max(16ul, strtoul(argv[++i], nullptr, 10));
+        else if (strcmp(argv[i], "--flash") == 0 && i + 1 < argc) flash_kbps = std::max(16ul, strtoul(argv[++i], nullptr, 10));
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--size KB] [--link KB/s] [--flash KB/s]\n", argv[0]);
+            return 1;
+        }
+    }
+    uint32_t link_bps = link_kbps * 1024;
+    uint32_t flash_bps = flash_kbps * 1024;
+
+    std::mt19937 random(SEED);
+    std::string image(size_kb * 1024 + 123, '\0'); // not a multiple of the chunks
+    for (char& c : image) c = static_cast<char>(random());
+
+    check_sha256();
+    bool signatures_checked = false;
+    check_manifest(image, signatures_checked);
+
+    uint32_t third = image.size() / 3;
+    Faults clean;
+    Faults drops;
+    drops.drops = 3;
+    drops.drop_after = third / 2;
+    Faults ignored = drops;
+    ignored.ignore_range = true;
+    Faults corrupted;
+    corrupted.corrupt_at = 2 * third + 17;
+    Faults endless;
+    endless.drops = 1000;
+    endless.drop_after = 0;
+    Faults not_found;
+    not_found.not_found = true;
+
+    std::vector<Result> results;
+    results.push_back(run_sequential("sequential clean", image, link_bps, flash_bps, clean));
+    results.push_back(run_download("overlapped clean", image, link_bps, flash_bps, clean));
+    results.push_back(run_sequential("sequential drops", image, link_bps, flash_bps, drops));
+    results.push_back(run_download("overlapped drops", image, link_bps, flash_bps, drops));
+    results.push_back(run_download("range ignored", image, link_bps, flash_bps, ignored));
+    results.push_back(run_download("corrupted", image, link_bps, flash_bps, corrupted));
+    results.push_back(run_download("size mismatch", image, link_bps, flash_bps, clean, -1024));
+    results.push_back(run_download("endless drops", image, link_bps, flash_bps, endless));
+    results.push_back(run_download("not found", image, link_bps, flash_bps, not_found));
+    results.push_back(run_download("too large", image, link_bps, flash_bps, clean, 0, image.size() - 1));
+    results.push_back(run_download("legacy clean", image, link_bps, flash_bps, clean, 0, 0, true));
+    results.push_back(run_download("legacy drops", image, link_bps, flash_bps, drops, 0, 0, true));
+
+    const Result& sequential = results[0];
+    const Result& overlapped = results[1];
+    check(sequential.status == Status::Ok && sequential.intact, "sequential download");
+    check(overlapped.status == Status::Ok && overlapped.intact, "overlapped download");
+    check(overlapped.progress.written == image.size() && overlapped.progress.resumes == 0 && overlapped.requests == 1, "clean download in one request");
+    check(overlapped.reports >= 2 && overlapped.monotonic && overlapped.progress.bytes_per_s > 0, "progress reports");
+    check(overlapped.seconds < sequential.seconds * 0.85, "overlapped download faster than the sequential one");
+    check(results[2].status != Status::Ok && !results[2].intact, "sequential download fails on a lost connection");
+    check(results[3].status == Status::Ok && results[3].intact, "download resumed after lost connections");
+    check(results[3].progress.resumes == drops.drops && results[3].ranges == drops.drops, "resumes with Range requests");
+    check(results[3].progress.fetched == image.size(), "resumes fetch no byte twice");
+    check(results[4].status == Status::Ok && results[4].intact, "download resumed without range support");
+    check(results[4].progress.fetched > image.size() && results[4].ranges == 0, "bytes sent again dropped");
+    check(results[5].status == Status::InvalidParameters && !results[5].intact && results[5].aborted, "corrupted image refused");
+    check(results[6].status == Status::InvalidParameters && !results[6].intact && results[6].aborted, "image size mismatch refused");
+    check(results[7].status == Status::Failure && !results[7].intact && results[7].progress.resumes == OTA_MAX_RESUMES, "gives up after OTA_MAX_RESUMES");
+    check(results[8].status == Status::NotFound && results[8].requests == 1, "missing image not retried");
+    check(results[9].status == Status::OutOfBounds && results[9].requests == 0, "image larger than the partition refused");
+    check(results[10].status == Status::Ok && results[10].intact && results[10].requests == 1, "legacy manifest downloaded in one request");
+    check(results[10].progress.size == image.size() && results[10].progress.written == image.size(), "legacy image size from the server");
+    check(results[11].status == Status::Failure && !results[11].intact && results[11].aborted && results[11].requests == 1, "legacy download not resumed");
+    bool failed = check_failures != 0;
+
+    if (json)
+    {
+        printf("{\"checks_failed\": %d, \"signatures_checked\": %s, \"image_bytes\": %zu, \"link_kb_per_s\": %u, \"flash_kb_per_s\": %u, \"flash_block_erase_ms\": %u, \"ring_bytes\": %zu, \"rows\": [\n",
+               check_failures, signatures_checked ? "true" : "false", image.size(), link_kbps, flash_kbps, FLASH_BLOCK_ERASE_MS, OTA_RING_SIZE);
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const Result& r = results[i];
+            printf("  {\"name\": \"%s\", \"status\": %d, \"seconds\": %.3f, \"kb_per_s\": %.1f, \"written\": %u, \"fetched\": %u, \"resumes\": %u, \"requests\": %u, \"intact\": %s}%s\n",
+                   r.name, static_cast<int>(r.status), r.seconds, r.status == Status::Ok ? image.size() / 1024.0 / r.seconds : 0.0,
+                   r.progress.written, r.progress.fetched, r.progress.resumes, r.requests, r.intact ? "true" : "false", i + 1 < results.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("checks       : %s (%d failed)%s\n", check_failures == 0 ? "ok" : "FAILED", check_failures, signatures_checked ? "" : ", signatures skipped (no OpenSSL)");
+        printf("image        : %.1f KB, link %u KB/s, flash %u KB/s + %u ms erase per %u KB, ring %zu KB\n\n", image.size() / 1024.0, link_kbps,
+               flash_kbps, FLASH_BLOCK_ERASE_MS, FLASH_BLOCK / 1024, OTA_RING_SIZE / 1024);
+        printf("%-18s %-8s %8s %9s %10s %10s %8s %9s\n", "download", "result", "s", "KB/s", "KB written", "KB fetched", "resumes", "requests");
+        for (const Result& r : results)
+        {
+            printf("%-18s %-8s %8.3f %9.1f %10.1f %10.1f %8u %9u\n", r.name, r.status == Status::Ok ? (r.intact ? "ok" : "BAD") : "refused",
+                   r.seconds, r.status == Status::Ok ? image.size() / 1024.0 / r.seconds : 0.0, r.progress.written / 1024.0,
+                   r.progress.fetched / 1024.0, r.progress.resumes, r.requests);
+        }
+        double flash_s = image.size() / static_cast<double>(flash_bps) + (image.size() + FLASH_BLOCK - 1) / FLASH_BLOCK * FLASH_BLOCK_ERASE_MS / 1e3;
+        printf("\noverlap      : %.2fx faster than the sequential loop (bounds %.3f s at the link rate, %.3f s at the flash rate)\n",
+               sequential.seconds / overlapped.seconds, image.size() / static_cast<double>(link_bps), flash_s);
+        if (failed) printf("\nFAILED\n");
+    }
+    return check_exit_code();
+}
@@ -0,0 +1,279 @@
+/**
+ * Pool (common/Pool.hpp) against the system allocator, and multi-threaded stress check of the pool.
+ *
+ * - alloc_free : one allocation immediately freed (best case for every allocator)
+ * - batch_64 : 64 allocations, then freed in a shuffled order (fixed seed)
+ * - list_push_pop : std::list<Message> with std::allocator vs PoolAllocator
+ * - threads_N : N threads allocating / freeing concurrently in random patterns
+ *
+ * The stress part writes a per-thread pattern in every block it holds and checks it before freeing it,
+ * then checks that the pool counters went back to zero : the tool exits with 2 on any mismatch.
+ *
+ * Usage : bench_pool [--json] [--stress seconds]
+ */
+#include "common/Pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+constexpr uint32_t SEED = 0x360;
+constexpr size_t BLOCK_SIZE = 128;
+constexpr size_t BLOCK_COUNT = 1024;
+using BenchPool = Pool<BLOCK_SIZE, BLOCK_COUNT>;
+
+struct Message
+{
+    uint8_t data[96];
+};
+
+struct Result
+{
+    std::string name;
+    double pool_ns;
+    double system_ns;
+};
+
+template <typename F>
+static double ns_per_op(uint64_t ops, F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / ops;
+}
+
+// Sink so the allocations can't be optimized away
+static volatile uintptr_t sink = 0;
+
+static Result bench_alloc_free(BenchPool& pool)
+{
+    constexpr uint64_t N = 5'000'000;
+    Result result{ "alloc_free" };
+    result.pool_ns = ns_per_op(N, [&]() {
+        for (uint64_t i = 0; i < N; i++)
+        {
+            void* p = pool.allocate();
+            sink = sink + reinterpret_cast<uintptr_t>(p);
+            pool.deallocate(p);
+        }
+    });
+    result.system_ns = ns_per_op(N, [&]() {
+        for (uint64_t i = 0; i < N; i++)
+        {
+            void* p = malloc(BLOCK_SIZE);
+            sink = sink + reinterpret_cast<uintptr_t>(p);
+            free(p);
+        }
+    });
+    return result;
+}
+
+static Result bench_batch(BenchPool& pool)
+{
+    constexpr size_t BATCH = 64;
+    constexpr uint64_t ROUNDS = 100'000;
+    std::mt19937 rng(SEED);
+    std::vector<size_t> order(BATCH);
+    for (size_t i = 0; i < BATCH; i++) order[i] = i;
+    std::shuffle(order.begin(), order.end(), rng);
+
+    void* blocks[BATCH];
+    Result result{ "batch_64" };
+    result.pool_ns = ns_per_op(ROUNDS * BATCH, [&]() {
+        for (uint64_t r = 0; r < ROUNDS; r++)
+        {
+            for (size_t i = 0; i < BATCH; i++) blocks[i] = pool.allocate();
+            sink = sink + reinterpret_cast<uintptr_t>(blocks[r % BATCH]);
+            for (size_t i : order) pool.deallocate(blocks[i]);
+        }
+    });
+    result.system_ns = ns_per_op(ROUNDS * BATCH, [&]() {
+        for (uint64_t r = 0; r < ROUNDS; r++)
+        {
+            for (size_t i = 0; i < BATCH; i++) blocks[i] = malloc(BLOCK_SIZE);
+            sink = sink + reinterpret_cast<uintptr_t>(blocks[r % BATCH]);
+            for (size_t i : order) free(blocks[i]);
+        }
+    });
+    return result;
+}
+
+static Result bench_list(BenchPool& pool)
+{
+    constexpr uint64_t ROUNDS = 50'000;
+    constexpr size_t LENGTH = 32;
+    Result result{ "list_push_pop" };
+
+    std::list<Message, PoolAllocator<Message, BenchPool>> pooled{ PoolAllocator<Message, BenchPool>(pool) };
+    result.pool_ns = ns_per_op(ROUNDS * LENGTH, [&]() {
+        for (uint64_t r = 0; r < ROUNDS; r++)
+        {
+            for (size_t i = 0; i < LENGTH; i++) pooled.emplace_back();
+            sink = sink + pooled.size();
+            while (!pooled.empty()) pooled.pop_front();
+        }
+    });
+
+    std::list<Message> system;
+    result.system_ns = ns_per_op(ROUNDS * LENGTH, [&]() {
+        for (uint64_t r = 0; r < ROUNDS; r++)
+        {
+            for (size_t i = 0; i < LENGTH; i++) system.emplace_back();
+            sink = sink + system.size();
+            while (!system.empty()) system.pop_front();
+        }
+    });
+    return result;
+}
+
+/**
+ * @brief Every thread keeps up to 64 blocks, randomly allocating or freeing one at each step.
+ * @param errors Incremented for each block whose content was overwritten by someone else.
+ */
+template <typename Alloc, typename Free>
+static double run_threads(int nb_threads, uint64_t steps, Alloc&& alloc, Free&& dealloc, std::atomic<uint64_t>& errors)
+{
+    std::vector<std::thread> threads;
+    std::atomic<bool> go(false);
+    for (int t = 0; t < nb_threads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            std::mt19937 rng(SEED + t);
+            std::vector<std::pair<uint8_t*, uint32_t>> held;
+            held.reserve(64);
+            uint32_t stamp = static_cast<uint32_t>(t) << 24;
+            while (!go) std::this_thread::yield();
+
+            for (uint64_t s = 0; s < steps; s++)
+            {
+                bool take = held.empty() || (held.size() < 64 && (rng() & 1));
+                if (take)
+                {
+                    uint8_t* p = static_cast<uint8_t*>(alloc());
+                    if (p == nullptr) continue; // pool exhausted by the other threads, counted as a failure
+                    stamp++;
+                    memset(p, stamp & 0xFF, BLOCK_SIZE);
+                    memcpy(p, &stamp, sizeof(stamp));
+                    held.emplace_back(p, stamp);
+                }
+                else
+                {
+                    size_t i = rng() % held.size();
+                    auto [p, expected] = held[i];
+                    uint32_t found;
+                    memcpy(&found, p, sizeof(found));
+                    if (found != expected || p[BLOCK_SIZE - 1] != (expected & 0xFF)) errors++;
+                    dealloc(p);
+                    held[i] = held.back();
+                    held.pop_back();
+                }
+            }
+            for (auto [p, expected] : held) dealloc(p);
+        });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    go = true;
+    for (std::thread& thread : threads) thread.join();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (steps * nb_threads);
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    double stress_s = 1.0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--stress") == 0 && i + 1 < argc) stress_s = strtod(argv[++i], nullptr);
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--stress seconds]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    static BenchPool pool;
+    if (pool.init(PoolPlacement::Internal) != Status::Ok)
+    {
+        fprintf(stderr, "Failed to initialize the pool\n");
+        return 1;
+    }
+
+    std::vector<Result> results;
+    results.push_back(bench_alloc_free(pool));
+    results.push_back(bench_batch(pool));
+    results.push_back(bench_list(pool));
+
+    // Stress : contended threads, repeated until the requested duration is spent
+    bool failed = false;
+    uint64_t stress_errors = 0;
+    uint32_t stress_failures = 0;
+    for (int nb_threads : { 2, 8 })
+    {
+        constexpr uint64_t STEPS = 200'000;
+        std::atomic<uint64_t> errors(0);
+        pool.resetStats();
+
+        Result result{ "threads_" + std::to_string(nb_threads) };
+        result.pool_ns = 0;
+        int rounds = 0;
+        auto until = std::chrono::steady_clock::now() + std::chrono::duration<double>(stress_s / 2);
+        do
+        {
+            result.pool_ns += run_threads(nb_threads, STEPS, [&]() { return pool.allocate(); }, [&](void* p) { pool.deallocate(p); }, errors);
+            rounds++;
+        } while (std::chrono::steady_clock::now() < until);
+        result.pool_ns /= rounds;
+
+        std::atomic<uint64_t> system_errors(0);
+        result.system_ns = run_threads(nb_threads, STEPS, []() { return malloc(BLOCK_SIZE); }, [](void* p) { free(p); }, system_errors);
+        results.push_back(result);
+
+        BenchPool::Stats stats = pool.getStats();
+        stress_errors += errors;
+        stress_failures += stats.failures;
+        if (errors != 0 || stats.in_use != 0 || stats.high_water > BLOCK_COUNT)
+        {
+            fprintf(stderr, "%s : %llu corrupted blocks, %u blocks still in use, high water %u\n", result.name.c_str(),
+                    static_cast<unsigned long long>(errors.load()), stats.in_use, stats.high_water);
+            failed = true;
+        }
+    }
+
+    BenchPool::Stats stats = pool.getStats();
+    if (json)
+    {
+        printf("{\"block_size\": %zu, \"block_count\": %zu, \"stress_errors\": %llu, \"stress_pool_failures\": %u, \"benchmarks\": [\n",
+               BLOCK_SIZE, BLOCK_COUNT, static_cast<unsigned long long>(stress_errors), stress_failures);
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const Result& r = results[i];
+            printf("  {\"name\": \"%s\", \"pool_ns_per_op\": %.3f, \"system_ns_per_op\": %.3f, \"speedup\": %.2f}%s\n",
+                   r.name.c_str(), r.pool_ns, r.system_ns, r.system_ns / r.pool_ns, i + 1 < results.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("pool of %zu x %zu bytes blocks\n\n", BLOCK_COUNT, BLOCK_SIZE);
+        printf("%-16s %14s %14s %9s\n", "benchmark", "pool ns/op", "malloc ns/op", "speedup");
+        for (const Result& r : results)
+        {
+            printf("%-16s %14.2f %14.2f %8.2fx\n", r.name.c_str(), r.pool_ns, r.system_ns, r.system_ns / r.pool_ns);
+        }
+        printf("\nstress         : %s (%llu corrupted blocks, %u allocations refused by the full pool, high water %u)\n",
+               failed ? "FAILED" : "ok", static_cast<unsigned long long>(stress_errors), stress_failures, stats.high_water);
+    }
+
+    return failed ? 2 : 0;
+}
@@ -0,0 +1,543 @@
+/**
+ * Offline comparison of the state estimators on a sensor recording (see common/SensorRecord.hpp) :
+ * - body orientation : IMU::estimateState() and complementary filter variants,
+ * - joint angles from the potentiometers : raw, analog EMA, KalmanFilter1D fed with the commands (as in Joint),
+ * - foot contacts : voltage thresholds on the filtered / raw voltages.
+ *
+ * Every variant runs over the whole recording, fed through the drivers by Replay::SensorReplay, and is
+ * compared to the ground truth when there is one (e.g. recordings made by bench_sim_walk --record), or to
+ * the firmware estimator otherwise. The cost of each variant is reported per sample.
+ *
+ * Usage : replay_estimators <recording> [reference] [--skip seconds] [--speed x] [--json]
+ */
+#include "replay/SensorReplay.hpp"
+#include "locomotion/Body.hpp"
+#include "locomotion/IMU.hpp"
+#include "common/KalmanFilter.hpp"
+#include "common/config.hpp"
+#include "host/HostClock.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/** COST MEASUREMENT **/
+
+static inline uint64_t read_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+struct CostMeter
+{
+    uint64_t cycles = 0;
+    std::chrono::nanoseconds time{0};
+    uint64_t samples = 0;
+
+    std::chrono::steady_clock::time_point start_time;
+    uint64_t start_cycles = 0;
+
+    inline void start()
+    {
+        start_time = std::chrono::steady_clock::now();
+        start_cycles = read_cycles();
+    }
+
+    inline void stop(uint64_t nb_samples)
+    {
+        cycles += read_cycles() - start_cycles;
+        time += std::chrono::steady_clock::now() - start_time;
+        samples += nb_samples;
+    }
+};
+
+// Cost of an empty start()/stop(), removed from the measures
+static double overhead_ns = 0.0;
+static double overhead_cycles = 0.0;
+
+static void calibrate_overhead()
+{
+    CostMeter meter;
+    constexpr int N = 200000;
+    for (int i = 0; i < N; i++)
+    {
+        meter.start();
+        meter.stop(1);
+    }
+    overhead_ns = static_cast<double>(meter.time.count()) / N;
+    overhead_cycles = static_cast<double>(meter.cycles) / N;
+}
+
+/** RESULTS **/
+
+struct Result
+{
+    std::string group;
+    std::string name;
+    const char* unit;
+    double error_rms = 0.0;
+    double error_max = 0.0;
+    double extra = 0.0; // group specific (contacts : transitions per second)
+    double ns_per_sample = 0.0;
+    double cycles_per_sample = 0.0;
+};
+
+static void finish_cost(Result& result, const CostMeter& meter, uint64_t calls)
+{
+    if (meter.samples == 0) return;
+    double ns = meter.time.count() - overhead_ns * calls;
+    double cycles = meter.cycles - overhead_cycles * calls;
+    result.ns_per_sample = std::max(0.0, ns / meter.samples);
+    result.cycles_per_sample = std::max(0.0, cycles / meter.samples);
+}
+
+struct ErrorStats
+{
+    double sum_sq = 0.0;
+    double max = 0.0;
+    uint64_t count = 0;
+
+    void add(double error)
+    {
+        sum_sq += error * error;
+        max = std::max(max, std::fabs(error));
+        count++;
+    }
+
+    double rms() const { return count > 0 ? std::sqrt(sum_sq / count) : 0.0; }
+};
+
+/** JOINT MAPPING (same as Joint + MotorController, with the default calibration) **/
+
+struct JointMapping
+{
+    float min_angle_rad;
+    float max_angle_rad;
+    bool inverted;
+    AnalogDriver::Channel feedback_channel;
+    MotorDriver::Channel motor_channel;
+
+    float fromVoltage(float voltage) const
+    {
+        MotorController::CalibrationData calibration;
+        float ratio = (voltage - calibration.feedback_min) / (calibration.feedback_max - calibration.feedback_min);
+        if (inverted) ratio = 1.f - ratio;
+        return min_angle_rad + ratio * (max_angle_rad - min_angle_rad);
+    }
+
+    float fromDutyCycle(float dc) const
+    {
+        MotorController::CalibrationData calibration;
+        float ratio = (dc - calibration.dc_min) / (calibration.dc_max - calibration.dc_min);
+        if (inverted) ratio = 1.f - ratio;
+        return min_angle_rad + ratio * (max_angle_rad - min_angle_rad);
+    }
+};
+
+/** ESTIMATOR VARIANTS **/
+
+/// @brief Complementary filter of IMU::estimateState(), with a configurable coefficient
+static Vec3f complementary_update(Vec3f& down, const IMUDriver::IMUData& data, float dt, float alpha)
+{
+    Quatf q_gyro = Quatf::FromEulerAngles(Vec3f(
+        DEG_TO_RAD(-data.gyro_x_ds) * dt,
+        DEG_TO_RAD(-data.gyro_y_ds) * dt,
+        DEG_TO_RAD(-data.gyro_z_ds) * dt
+    ));
+    Vec3f rotated = q_gyro.rotate(down);
+    Vec3f accel = Vec3f(data.accel_x_g, data.accel_y_g, data.accel_z_g).normalized();
+    down = (rotated * alpha + accel * (1.f - alpha)).normalized();
+    return Vec3f(
+        atan2f(down.y, down.z),
+        atan2f(-down.x, sqrtf(down.y * down.y + down.z * down.z)),
+        0.f
+    );
+}
+
+int main(int argc, char** argv)
+{
+    const char* record_path = nullptr;
+    const char* reference_path = nullptr;
+    float skip_s = 1.f;
+    float speed = 0.f;
+    bool json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--skip") == 0 && i + 1 < argc) skip_s = strtof(argv[++i], nullptr);
+        else if (strcmp(argv[i], "--speed") == 0 && i + 1 < argc) speed = strtof(argv[++i], nullptr);
+        else if (record_path == nullptr) record_path = argv[i];
+        else reference_path = argv[i];
+    }
+    if (record_path == nullptr)
+    {
+        fprintf(stderr, "usage: %s <recording> [reference] [--skip seconds] [--speed x] [--json]\n", argv[0]);
+        return 1;
+    }
+
+    HostClock::SetVirtual(true);
+
+    Replay::SensorReplay replay;
+    if (replay.open(record_path) != Status::Ok)
+    {
+        fprintf(stderr, "Cannot load %s\n", record_path);
+        return 1;
+    }
+    std::string default_reference = std::string(record_path) + ".ref";
+    if (reference_path != nullptr)
+    {
+        if (replay.loadReference(reference_path) != Status::Ok)
+        {
+            fprintf(stderr, "Cannot load the reference %s\n", reference_path);
+            return 1;
+        }
+    }
+    else if (!replay.hasReference())
+    {
+        replay.loadReference(default_reference.c_str()); // optional
+    }
+    replay.setSpeed(speed);
+
+    if (replay.install() != Status::Ok || AnalogDriver::Init() != Status::Ok)
+    {
+        fprintf(stderr, "Failed to plug the replay under the drivers\n");
+        return 1;
+    }
+
+    // Joint geometry comes from the firmware body description (nothing is initialized)
+    Body body;
+    std::vector<JointMapping> joints;
+    AnalogDriver::Channel contact_channels[4];
+    for (int l = 0; l < 4; l++)
+    {
+        Leg& leg = body.getLeg(static_cast<Leg::Id>(l));
+        contact_channels[l] = leg.getContactChannel();
+        for (int j = 0; j < 3; j++)
+        {
+            Joint& joint = leg.getJoint(static_cast<Leg::JointId>(j));
+            joints.push_back({ joint.getMinAngle(), joint.getMaxAngle(), joint.isInverted(),
+                joint.getMotorController().getAnalogChannel(), joint.getMotorController().getMotorChannel() });
+        }
+    }
+
+    const std::vector<Replay::SensorReplay::Tick>& ticks = replay.getTicks();
+    const size_t nb_ticks = ticks.size();
+    const int64_t skip_until_us = ticks[0].timestamp_us + static_cast<int64_t>(skip_s * 1e6f);
+    const bool has_reference = replay.hasReference();
+    auto scored = [&](size_t t) { return ticks[t].timestamp_us >= skip_until_us && (!has_reference || ticks[t].has_reference); };
+
+    calibrate_overhead();
+    std::vector<Result> results;
+
+    /** ORIENTATION **/
+    {
+        IMU imu;
+        if (imu.init() != Status::Ok)
+        {
+            fprintf(stderr, "Failed to initialize the IMU\n");
+            return 1;
+        }
+
+        // firmware estimator first, it is the reference when the recording has no ground truth
+        std::vector<Vec3f> baseline(nb_ticks);
+        auto run = [&](const std::string& name, const std::function<Vec3f()>& update)
+        {
+            Result result{ "orientation", name, "deg" };
+            ErrorStats errors;
+            CostMeter meter;
+            replay.rewind();
+            for (size_t t = 0; replay.step(); t++)
+            {
+                IMUDriver::ReadData();
+                meter.start();
+                Vec3f rpy = update();
+                meter.stop(1);
+
+                if (results.empty() && name == "IMU::estimateState (firmware)") baseline[t] = rpy;
+                if (!scored(t)) continue;
+                float truth_roll = has_reference ? ticks[t].reference.roll_rad : baseline[t].x;
+                float truth_pitch = has_reference ? ticks[t].reference.pitch_rad : baseline[t].y;
+                errors.add(RAD_TO_DEG(rpy.x - truth_roll));
+                errors.add(RAD_TO_DEG(rpy.y - truth_pitch));
+            }
+            result.error_rms = errors.rms();
+            result.error_max = errors.max;
+            finish_cost(result, meter, meter.samples);
+            results.push_back(result);
+        };
+
+        run("IMU::estimateState (firmware)", [&]() {
+            imu.estimateState(CONTROL_LOOP_DT_S);
+            return imu.getOrientation();
+        });
+        // unlike IMU (starting from a fixed down vector), the variants start from the first accelerometer sample
+        for (float alpha : { 0.95f, 0.98f, 0.995f, 0.f, 1.f })
+        {
+            Vec3f down(0.f, 0.f, 0.f);
+            char name[64];
+            if (alpha == 0.f) snprintf(name, sizeof(name), "accelerometer only");
+            else if (alpha == 1.f) snprintf(name, sizeof(name), "gyroscope only");
+            else snprintf(name, sizeof(name), "complementary alpha=%.3f", alpha);
+            run(name, [&]() {
+                const IMUDriver::IMUData& data = IMUDriver::GetData();
+                if (down.x == 0.f && down.y == 0.f && down.z == 0.f)
+                {
+                    down = Vec3f(data.accel_x_g, data.accel_y_g, data.accel_z_g).normalized();
+                }
+                return complementary_update(down, data, CONTROL_LOOP_DT_S, alpha);
+            });
+        }
+    }
+
+    /** JOINT ANGLES **/
+    {
+        const size_t nb_joints = joints.size();
+        std::vector<float> baseline(nb_ticks * nb_joints);
+        bool first = true;
+
+        // update(t, out) fills the estimated angle of every joint for the current tick
+        auto run = [&](const std::string& name, const std::function<void(size_t, float*)>& update)
+        {
+            Result result{ "joint angle", name, "deg" };
+            ErrorStats errors;
+            CostMeter meter;
+            std::vector<float> angles(nb_joints);
+            replay.rewind();
+            for (size_t t = 0; replay.step(); t++)
+            {
+                meter.start();
+                update(t, angles.data());
+                meter.stop(nb_joints);
+
+                if (first) std::copy(angles.begin(), angles.end(), baseline.begin() + t * nb_joints);
+                if (!scored(t)) continue;
+                for (size_t j = 0; j < nb_joints; j++)
+                {
+                    float truth = has_reference ? ticks[t].reference.joint_angles_rad[j] : baseline[t * nb_joints + j];
+                    errors.add(RAD_TO_DEG(angles[j] - truth));
+                }
+            }
+            first = false;
+            result.error_rms = errors.rms();
+            result.error_max = errors.max;
+            finish_cost(result, meter, meter.samples / nb_joints);
+            results.push_back(result);
+        };
+
+        // firmware : analog EMA (AnalogDriver), then Kalman filter predicted with the commands (Joint)
+        {
+            std::vector<KalmanFilter1D> filters(nb_joints);
+            std::vector<float> models(nb_joints, NAN);
+            run("EMA + KalmanFilter1D (firmware)", [&](size_t t, float* out) {
+                AnalogDriver::ReadAllChannels();
+                for (size_t j = 0; j < nb_joints; j++)
+                {
+                    AnalogDriver::Value voltage;
+                    AnalogDriver::GetVoltage(joints[j].feedback_channel, voltage);
+                    float measure = joints[j].fromVoltage(voltage);
+                    if (std::isnan(models[j]))
+                    {
+                        filters[j].Init(1.f, 0.1f, measure);
+                        models[j] = measure;
+                    }
+                    // commands of the previous tick moved the joint since the last measure
+                    float dc = t > 0 && ticks[t - 1].has_motor ? ticks[t - 1].duty_cycles[joints[j].motor_channel] : 0.f;
+                    if (dc > 0.f)
+                    {
+                        float model = joints[j].fromDutyCycle(dc);
+                        filters[j].Predict(model - models[j]);
+                        models[j] = model;
+                    }
+                    out[j] = filters[j].Update(measure);
+                }
+            });
+        }
+
+        run("raw voltage", [&](size_t t, float* out) {
+            for (size_t j = 0; j < nb_joints; j++) out[j] = joints[j].fromVoltage(ticks[t].analog[joints[j].feedback_channel]);
+        });
+
+        {
+            AnalogDriver::Value ema[AnalogDriver::CHANNEL_COUNT] = {};
+            run("analog EMA only (firmware alpha)", [&](size_t t, float* out) {
+                AnalogDriver::ReadAllChannels();
+                for (size_t j = 0; j < nb_joints; j++)
+                {
+                    AnalogDriver::GetVoltage(joints[j].feedback_channel, ema[j]);
+                    out[j] = joints[j].fromVoltage(ema[j]);
+                }
+            });
+        }
+
+        for (float alpha : { 0.3f, 0.6f })
+        {
+            std::vector<float> ema(nb_joints, NAN);
+            char name[64];
+            snprintf(name, sizeof(name), "EMA alpha=%.1f", alpha);
+            run(name, [&](size_t t, float* out) {
+                for (size_t j = 0; j < nb_joints; j++)
+                {
+                    float v = ticks[t].analog[joints[j].feedback_channel];
+                    ema[j] = std::isnan(ema[j]) ? v : ema[j] + alpha * (v - ema[j]);
+                    out[j] = joints[j].fromVoltage(ema[j]);
+                }
+            });
+        }
+
+        {
+            std::vector<KalmanFilter1D> filters(nb_joints);
+            std::vector<float> models(nb_joints, NAN);
+            run("KalmanFilter1D on raw, commands (R=0.01, Q=0.001)", [&](size_t t, float* out) {
+                for (size_t j = 0; j < nb_joints; j++)
+                {
+                    float measure = joints[j].fromVoltage(ticks[t].analog[joints[j].feedback_channel]);
+                    if (std::isnan(models[j]))
+                    {
+                        filters[j].Init(0.01f, 0.001f, measure);
+                        models[j] = measure;
+                    }
+                    float dc = t > 0 && ticks[t - 1].has_motor ? ticks[t - 1].duty_cycles[joints[j].motor_channel] : 0.f;
+                    if (dc > 0.f)
+                    {
+                        float model = joints[j].fromDutyCycle(dc);
+                        filters[j].Predict(model - models[j]);
+                        models[j] = model;
+                    }
+                    out[j] = filters[j].Update(measure);
+                }
+            });
+        }
+    }
+
+    /** FOOT CONTACTS **/
+    {
+        std::vector<uint8_t> baseline(nb_ticks);
+        bool first = true;
+        const double duration_s = (ticks.back().timestamp_us - skip_until_us) / 1e6;
+
+        auto run = [&](const std::string& name, const std::function<uint8_t(size_t)>& update)
+        {
+            Result result{ "foot contact", name, "%" };
+            CostMeter meter;
+            uint64_t matches = 0, total = 0, transitions = 0;
+            uint8_t last = 0;
+            replay.rewind();
+            for (size_t t = 0; replay.step(); t++)
+            {
+                meter.start();
+                uint8_t contacts = update(t);
+                meter.stop(4);
+
+                if (first) baseline[t] = contacts;
+                if (!scored(t)) { last = contacts; continue; }
+                uint8_t truth = has_reference ? ticks[t].reference.contacts : baseline[t];
+                for (int l = 0; l < 4; l++)
+                {
+                    matches += ((contacts >> l) & 1) == ((truth >> l) & 1);
+                    transitions += ((contacts >> l) & 1) != ((last >> l) & 1);
+                    total++;
+                }
+                last = contacts;
+            }
+            first = false;
+            // error = percentage of wrong leg states, extra = state changes per second (all legs)
+            result.error_rms = total > 0 ? 100.0 * (total - matches) / total : 0.0;
+            result.error_max = NAN;
+            result.extra = duration_s > 0 ? transitions / duration_s : 0.0;
+            finish_cost(result, meter, meter.samples / 4);
+            results.push_back(result);
+        };
+
+        char name[64];
+        for (float threshold : { LEG_GROUNDED_THRESHOLD_V, 1.0f, 2.5f })
+        {
+            snprintf(name, sizeof(name), "EMA < %.1fV%s", threshold, threshold == LEG_GROUNDED_THRESHOLD_V ? " (firmware)" : "");
+            run(name, [&](size_t t) {
+                AnalogDriver::ReadAllChannels();
+                uint8_t contacts = 0;
+                for (int l = 0; l < 4; l++)
+                {
+                    AnalogDriver::Value voltage;
+                    AnalogDriver::GetVoltage(contact_channels[l], voltage);
+                    if (voltage < threshold) contacts |= 1 << l;
+                }
+                return contacts;
+            });
+        }
+        snprintf(name, sizeof(name), "raw < %.1fV", LEG_GROUNDED_THRESHOLD_V);
+        run(name, [&](size_t t) {
+            uint8_t contacts = 0;
+            for (int l = 0; l < 4; l++)
+            {
+                if (ticks[t].analog[contact_channels[l]] < LEG_GROUNDED_THRESHOLD_V) contacts |= 1 << l;
+            }
+            return contacts;
+        });
+        if (has_reference)
+        {
+            uint64_t transitions = 0;
+            for (size_t t = 1; t < nb_ticks; t++)
+            {
+                if (scored(t)) transitions += __builtin_popcount(ticks[t].reference.contacts ^ ticks[t - 1].reference.contacts);
+            }
+            Result truth{ "foot contact", "ground truth", "%" };
+            truth.error_max = NAN;
+            truth.extra = duration_s > 0 ? transitions / duration_s : 0.0;
+            results.push_back(truth);
+        }
+    }
+
+    /** REPORT **/
+    double recording_s = (ticks.back().timestamp_us - ticks.front().timestamp_us) / 1e6;
+    const char* compared_to = has_reference ? "ground truth" : "firmware estimator";
+    if (json)
+    {
+        printf("{\"recording\": \"%s\", \"ticks\": %zu, \"duration_s\": %.3f, \"compared_to\": \"%s\", \"estimators\": [\n",
+               record_path, nb_ticks, recording_s, compared_to);
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const Result& r = results[i];
+            printf("  {\"group\": \"%s\", \"name\": \"%s\", \"unit\": \"%s\", \"error_rms\": %.4f, ",
+                   r.group.c_str(), r.name.c_str(), r.unit, r.error_rms);
+            if (std::isnan(r.error_max)) printf("\"transitions_per_s\": %.3f, ", r.extra);
+            else printf("\"error_max\": %.4f, ", r.error_max);
+            printf("\"ns_per_sample\": %.2f, \"cycles_per_sample\": %.1f}%s\n",
+                   r.ns_per_sample, r.cycles_per_sample, i + 1 < results.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("recording : %s (%zu ticks, %.1f s), errors vs %s, first %.1f s skipped\n\n", record_path, nb_ticks, recording_s, compared_to, skip_s);
+        std::string group;
+        for (const Result& r : results)
+        {
+            if (r.group != group)
+            {
+                group = r.group;
+                if (std::isnan(r.error_max))
+                    printf("\n%-52s %10s %12s %10s %10s\n", group.c_str(), "wrong %", "changes/s", "ns/sample", "cyc/sample");
+                else
+                    printf("\n%-52s %10s %12s %10s %10s\n", group.c_str(), "RMS", "max", "ns/sample", "cyc/sample");
+            }
+            if (std::isnan(r.error_max))
+                printf("  %-50s %10.2f %12.2f %10.1f %10.1f\n", r.name.c_str(), r.error_rms, r.extra, r.ns_per_sample, r.cycles_per_sample);
+            else
+                printf("  %-50s %7.3f %s %9.3f %s %10.1f %10.1f\n", r.name.c_str(), r.error_rms, r.unit, r.error_max, r.unit, r.ns_per_sample, r.cycles_per_sample);
+        }
+    }
+
+    replay.uninstall();
+    return 0;
+}
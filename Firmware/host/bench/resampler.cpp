@@ -0,0 +1,335 @@
+/**
+ * Polyphase sample rate converter (audio/Resampler.hpp) : frequency response checks and cost per output sample,
+ * for the usual asset rates converted to SPEAKER_SAMPLE_RATE_HZ, at every quality.
+ *
+ * - ripple : gain of sine tones spread over the passband (max - min, in dB)
+ * - rejection : worst image / alias landing in the passband, relative to the tone, for passband tones
+ *   (images of upsampling) and for tones above the output Nyquist frequency (aliases of decimation)
+ * - streaming : converting in random block sizes gives the same samples as one big block, and the output
+ *   length follows the ratio
+ * - cost : cycles (rdtsc, x86 only) and ns per output sample
+ *
+ * Levels are read with a Blackman-Harris window (sidelobes below -92 dB), so rejections above ~90 dB are floored.
+ * Exits with 2 if a check fails.
+ *
+ * Usage : bench_resampler [--json]
+ */
+#include "audio/Resampler.hpp"
+#include "common/config.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+constexpr uint32_t SEED = 0x360;
+constexpr double OUTPUT_RATE = SPEAKER_SAMPLE_RATE_HZ;
+constexpr size_t ANALYSIS_LENGTH = 16384; // output samples per tone
+constexpr double TONE_AMPLITUDE = 16384.0;
+
+static const uint32_t INPUT_RATES[] = { 8000, 11025, 16000, 22050, 22500, 32000, 44100, 48000 };
+
+/**
+ * Requirements of each quality
+ * - `passband`: checked band, as a fraction of the lowest Nyquist frequency
+ * - `max_ripple_db`, `min_rejection_db`: limits
+ */
+struct QualityCheck
+{
+    const char* name;
+    Resampler::Quality quality;
+    double passband;
+    double max_ripple_db;
+    double min_rejection_db;
+};
+
+static const QualityCheck QUALITIES[] = {
+    { "low", Resampler::Quality::Low, 0.55, 0.5, 50.0 },
+    { "medium", Resampler::Quality::Medium, 0.75, 0.2, 65.0 },
+    { "high", Resampler::Quality::High, 0.85, 0.1, 75.0 },
+};
+
+static inline uint64_t read_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+struct Result
+{
+    uint32_t input_rate;
+    const QualityCheck* check;
+    uint16_t phases;
+    uint8_t taps;
+    double ratio_error;
+    double ripple_db;
+    double rejection_db;
+    bool streaming_ok;
+    double ns_per_sample;
+    double cycles_per_sample;
+    bool passed;
+};
+
+/** ANALYSIS **/
+
+static std::vector<double> make_window(size_t n)
+{
+    std::vector<double> window(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        double x = 2.0 * M_PI * i / (n - 1);
+        window[i] = 0.35875 - 0.48829 * std::cos(x) + 0.14128 * std::cos(2 * x) - 0.01168 * std::cos(3 * x);
+    }
+    return window;
+}
+
+/// @brief Amplitude of the frequency `hz` in the signal
+static double level(const std::vector<int16_t>& signal, const std::vector<double>& window, double hz)
+{
+    double re = 0.0, im = 0.0, sum = 0.0;
+    double w = 2.0 * M_PI * hz / OUTPUT_RATE;
+    for (size_t i = 0; i < signal.size(); i++)
+    {
+        re += window[i] * signal[i] * std::cos(w * i);
+        im -= window[i] * signal[i] * std::sin(w * i);
+        sum += window[i];
+    }
+    return 2.0 * std::sqrt(re * re + im * im) / sum;
+}
+
+/// @brief Frequency seen in the output for a component at `hz`
+static double fold(double hz)
+{
+    double f = std::fmod(hz, OUTPUT_RATE);
+    return f > OUTPUT_RATE / 2 ? OUTPUT_RATE - f : f;
+}
+
+/// @brief Convert a sine at `hz`, and keep ANALYSIS_LENGTH output samples once the filter settled
+static std::vector<int16_t> convert_tone(Resampler& resampler, uint32_t input_rate, double hz)
+{
+    resampler.reset();
+    size_t skip = 512;
+    size_t input_count = static_cast<size_t>((ANALYSIS_LENGTH + skip) * input_rate / OUTPUT_RATE) + 2 * Resampler::MAX_TAPS;
+    std::vector<int16_t> input(input_count);
+    for (size_t i = 0; i < input_count; i++)
+    {
+        input[i] = static_cast<int16_t>(std::lround(TONE_AMPLITUDE * std::sin(2.0 * M_PI * hz * i / input_rate)));
+    }
+
+    std::vector<int16_t> output(ANALYSIS_LENGTH + skip);
+    size_t consumed = 0, produced = 0;
+    while (produced < output.size() && consumed < input.size())
+    {
+        size_t taken;
+        produced += resampler.process(input.data() + consumed, input.size() - consumed, taken, output.data() + produced, output.size() - produced);
+        consumed += taken;
+    }
+    return std::vector<int16_t>(output.begin() + skip, output.end());
+}
+
+static void measure_response(Resampler& resampler, uint32_t input_rate, const QualityCheck& check, Result& result)
+{
+    const std::vector<double> window = make_window(ANALYSIS_LENGTH);
+    const double nyquist = std::min<double>(input_rate, OUTPUT_RATE) / 2;
+    const double pass_edge = nyquist * check.passband;
+    const double min_spacing = 50.0; // Hz, to keep spurs out of the tone main lobe
+
+    double min_gain = INFINITY, max_gain = -INFINITY, worst_spur = 0.0;
+    constexpr int NB_TONES = 24;
+    for (int t = 0; t < NB_TONES; t++)
+    {
+        double hz = 100.0 + (pass_edge - 100.0) * t / (NB_TONES - 1);
+        std::vector<int16_t> output = convert_tone(resampler, input_rate, hz);
+        double gain_db = 20.0 * std::log10(level(output, window, hz) / TONE_AMPLITUDE);
+        min_gain = std::min(min_gain, gain_db);
+        max_gain = std::max(max_gain, gain_db);
+
+        // images around the multiples of the input rate, as seen in the output
+        for (int k = 1; k <= 4; k++)
+        {
+            for (double image : { k * input_rate - hz, k * input_rate + hz })
+            {
+                double seen = fold(image);
+                if (seen > pass_edge || std::fabs(seen - hz) < min_spacing) continue;
+                worst_spur = std::max(worst_spur, level(output, window, seen) / TONE_AMPLITUDE);
+            }
+        }
+    }
+
+    // decimation : tones the output can't hold must not come back in the passband
+    if (input_rate > OUTPUT_RATE)
+    {
+        double low = OUTPUT_RATE - pass_edge, high = input_rate / 2.0 * 0.98;
+        for (int t = 0; t < NB_TONES; t++)
+        {
+            double hz = low + (high - low) * t / (NB_TONES - 1);
+            double seen = fold(hz);
+            if (seen > pass_edge) continue;
+            std::vector<int16_t> output = convert_tone(resampler, input_rate, hz);
+            worst_spur = std::max(worst_spur, level(output, window, seen) / TONE_AMPLITUDE);
+        }
+    }
+
+    result.ripple_db = max_gain - min_gain;
+    result.rejection_db = worst_spur > 0.0 ? -20.0 * std::log10(worst_spur) : 200.0;
+}
+
+/// @brief Random block sizes must give the same output as one block, with length following the ratio
+static bool check_streaming(Resampler& resampler, uint32_t input_rate)
+{
+    std::mt19937 rng(SEED);
+    std::uniform_int_distribution<int> noise(-20000, 20000);
+    std::vector<int16_t> input(input_rate); // one second
+    for (int16_t& s : input) s = static_cast<int16_t>(noise(rng));
+
+    const size_t expected = static_cast<size_t>(input.size() * OUTPUT_RATE / input_rate);
+    std::vector<int16_t> whole(expected + 64), pieces(expected + 64);
+
+    resampler.reset();
+    size_t taken;
+    size_t whole_count = resampler.process(input.data(), input.size(), taken, whole.data(), whole.size());
+    size_t consumed = taken;
+    while (consumed < input.size())
+    {
+        whole_count += resampler.process(input.data() + consumed, input.size() - consumed, taken, whole.data() + whole_count, whole.size() - whole_count);
+        consumed += taken;
+    }
+
+    resampler.reset();
+    std::uniform_int_distribution<size_t> in_size(1, 700), out_size(1, 300);
+    size_t pieces_count = 0;
+    consumed = 0;
+    while (consumed < input.size())
+    {
+        size_t in_n = std::min(in_size(rng), input.size() - consumed);
+        size_t out_n = std::min(out_size(rng), pieces.size() - pieces_count);
+        pieces_count += resampler.process(input.data() + consumed, in_n, taken, pieces.data() + pieces_count, out_n);
+        consumed += taken;
+        if (taken < in_n && out_n == 0) return false; // output full before the end
+    }
+    // drain what the last calls couldn't output
+    pieces_count += resampler.process(nullptr, 0, taken, pieces.data() + pieces_count, pieces.size() - pieces_count);
+
+    double tolerance = 2.0 + resampler.getTaps();
+    if (std::fabs(static_cast<double>(whole_count) - expected) > tolerance || pieces_count != whole_count) return false;
+    return memcmp(whole.data(), pieces.data(), whole_count * sizeof(int16_t)) == 0;
+}
+
+static void measure_cost(Resampler& resampler, uint32_t input_rate, Result& result)
+{
+    constexpr size_t OUTPUT_COUNT = 1 << 20;
+    std::mt19937 rng(SEED);
+    std::uniform_int_distribution<int> noise(-20000, 20000);
+    std::vector<int16_t> input(8192);
+    for (int16_t& s : input) s = static_cast<int16_t>(noise(rng));
+    std::vector<int16_t> output(512);
+
+    resampler.reset();
+    size_t produced = 0, offset = 0;
+    int64_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    uint64_t start_cycles = read_cycles();
+    while (produced < OUTPUT_COUNT)
+    {
+        size_t taken;
+        size_t n = resampler.process(input.data() + offset, 512, taken, output.data(), output.size());
+        offset = (offset + taken) % (input.size() - 512);
+        produced += n;
+        checksum += output[0];
+    }
+    uint64_t cycles = read_cycles() - start_cycles;
+    auto end = std::chrono::steady_clock::now();
+
+    result.ns_per_sample = std::chrono::duration<double, std::nano>(end - start).count() / produced;
+    result.cycles_per_sample = static_cast<double>(cycles) / produced;
+    if (checksum == 0x7FFFFFFFFFFFFFFF) printf(" "); // keep the work alive
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<Result> results;
+    bool failed = false;
+    for (const QualityCheck& check : QUALITIES)
+    {
+        for (uint32_t rate : INPUT_RATES)
+        {
+            Resampler resampler;
+            if (resampler.init(rate, SPEAKER_SAMPLE_RATE_HZ, check.quality) != Status::Ok)
+            {
+                fprintf(stderr, "Failed to init the resampler for %u Hz\n", rate);
+                return 1;
+            }
+
+            Result result = {};
+            result.input_rate = rate;
+            result.check = &check;
+            result.phases = resampler.getPhases();
+            result.taps = resampler.getTaps();
+            result.ratio_error = resampler.getRatioError();
+            measure_response(resampler, rate, check, result);
+            result.streaming_ok = check_streaming(resampler, rate);
+            measure_cost(resampler, rate, result);
+
+            result.passed = result.streaming_ok && std::fabs(result.ratio_error) < 1e-4;
+            if (!resampler.isPassthrough())
+            {
+                result.passed = result.passed && result.ripple_db <= check.max_ripple_db && result.rejection_db >= check.min_rejection_db;
+            }
+            failed = failed || !result.passed;
+            results.push_back(result);
+        }
+    }
+
+    if (json)
+    {
+        printf("{\"output_rate\": %d, \"results\": [\n", SPEAKER_SAMPLE_RATE_HZ);
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const Result& r = results[i];
+            printf("  {\"input_rate\": %u, \"quality\": \"%s\", \"phases\": %u, \"taps\": %u, \"ratio_error\": %.3g, \"ripple_db\": %.4f, "
+                   "\"rejection_db\": %.1f, \"streaming\": %s, \"ns_per_sample\": %.2f, \"cycles_per_sample\": %.1f, \"passed\": %s}%s\n",
+                   r.input_rate, r.check->name, r.phases, r.taps, r.ratio_error, r.ripple_db, r.rejection_db, r.streaming_ok ? "true" : "false",
+                   r.ns_per_sample, r.cycles_per_sample, r.passed ? "true" : "false", i + 1 < results.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("conversion to %d Hz\n\n", SPEAKER_SAMPLE_RATE_HZ);
+        printf("%-8s %8s %7s %5s %10s %10s %13s %10s %8s %11s\n", "quality", "input", "phases", "taps", "ratio err", "ripple dB",
+               "rejection dB", "streaming", "ns/smp", "cycles/smp");
+        for (const Result& r : results)
+        {
+            printf("%-8s %8u %7u %5u %10.2g %10.4f %13.1f %10s %8.2f %11.1f%s\n", r.check->name, r.input_rate, r.phases, r.taps,
+                   r.ratio_error, r.ripple_db, r.rejection_db, r.streaming_ok ? "ok" : "FAILED", r.ns_per_sample, r.cycles_per_sample,
+                   r.passed ? "" : "  <- FAILED");
+        }
+        printf("\nlimits : ripple / rejection over the checked passband (fraction of the lowest Nyquist frequency)\n");
+        for (const QualityCheck& check : QUALITIES)
+        {
+            printf("  %-7s : %.2f, ripple <= %.2f dB, rejection >= %.0f dB\n", check.name, check.passband, check.max_ripple_db, check.min_rejection_db);
+        }
+    }
+
+    return failed ? 2 : 0;
+}
@@ -0,0 +1,292 @@
+/**
+ * Display pipeline (drivers/ScreenDriver.hpp) with and without the upload task, on a fake I2C bus that takes as long
+ * as the real one (400 kHz, 9 bit times per byte).
+ *
+ * A UI thread renders like the menus task (update, clear, draw, Upload(), then sleeps until the next period) while an
+ * input thread presses a button at random times, moving the selection of a list. For each run :
+ * - rendered fps : frames drawn per second, against the target rate
+ * - shown fps : frames that reached the panel per second, and frames dropped by the upload task
+ * - blocked : time the UI thread spends in Upload() per frame (it can't draw nor react meanwhile)
+ * - input to photon : time from the press to the end of the upload of the first frame drawn after it
+ *
+ * Scenes : `list` (selection bar moving between items, a few hundred bytes per frame) and `full` (a background
+ * scrolling under the list, most columns change, close to the 24 ms of a full frame every time).
+ * After each run the fake panel must show the last frame : the tool exits with 2 if it doesn't.
+ *
+ * Usage : bench_screen_pipeline [--json] [--seconds s]
+ */
+#include "common/config.hpp"
+#include "drivers/ScreenDriver.hpp"
+#include "ui/Draw.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t SEED = 0x360;
+constexpr double I2C_BYTE_US = 9 / 0.4; // 8 bits and the acknowledge at 400 kHz
+
+/// @brief Panel on a bus as slow as the robot's one
+class FakeBus : public ScreenDriver::Backend
+{
+public:
+    Status init() override { return Status::Ok; }
+    Status deinit() override { return Status::Ok; }
+    Status setPower(bool) override { return Status::Ok; }
+
+    Status upload(const uint8_t* buffer, uint16_t width, uint16_t height) override
+    {
+        transfer(ScreenDriver::PAGE_COUNT * (width + ScreenDriver::SPAN_OVERHEAD_BYTES));
+        std::lock_guard<std::mutex> lock(mutex);
+        memcpy(frame, buffer, sizeof(frame));
+        return Status::Ok;
+    }
+
+    Status uploadSpan(uint16_t page, uint16_t x, const uint8_t* data, uint16_t length) override
+    {
+        transfer(length + ScreenDriver::SPAN_OVERHEAD_BYTES);
+        std::lock_guard<std::mutex> lock(mutex);
+        memcpy(&frame[page * SCREEN_WIDTH + x], data, length);
+        return Status::Ok;
+    }
+
+    std::mutex mutex;
+    uint8_t frame[SCREEN_WIDTH * SCREEN_HEIGHT / 8] = {0};
+
+private:
+    static void transfer(uint32_t bytes)
+    {
+        std::this_thread::sleep_until(Clock::now() + std::chrono::nanoseconds(static_cast<int64_t>(bytes * I2C_BYTE_US * 1000)));
+    }
+};
+
+/** SCENE **/
+
+constexpr int ITEM_COUNT = 5;
+constexpr int ITEM_HEIGHT = 12;
+static const char* ITEMS[ITEM_COUNT] = { "Network", "Tests", "Calibration", "System", "Update" };
+
+/// @brief List with an animated selection bar (like MenuList), optionally over a scrolling background
+static void render_list(float selection, uint32_t frame, bool background)
+{
+    ScreenDriver::Clear();
+    if (background)
+    {
+        for (uint16_t x = 0; x < SCREEN_WIDTH; x += 4)
+        {
+            Draw::Line<false>(x, 0, (x + frame) % SCREEN_WIDTH, SCREEN_HEIGHT - 1);
+        }
+    }
+    Draw::RectRounded<true>(0, 4 + selection * ITEM_HEIGHT, SCREEN_WIDTH, ITEM_HEIGHT, 3);
+    for (int i = 0; i < ITEM_COUNT; i++)
+    {
+        Draw::Text<true>(12, 6 + i * ITEM_HEIGHT, ITEMS[i], ScreenDriver::COLOR_WHITE, true);
+    }
+}
+
+/** RUN **/
+
+struct Run
+{
+    std::string scene;
+    bool async;
+    uint32_t period_ms;
+    double rendered_fps;
+    double shown_fps;
+    uint32_t dropped;
+    double blocked_ms;
+    double latency_mean_ms;
+    double latency_p95_ms;
+    double latency_max_ms;
+    uint32_t presses;
+    bool panel_ok;
+};
+
+static Run run(FakeBus& bus, const std::string& scene, bool async, uint32_t period_ms, double seconds)
+{
+    if (async) ScreenDriver::StartUploadTask();
+    else ScreenDriver::StopUploadTask();
+    ScreenDriver::ResetUploadStats();
+
+    const bool background = scene == "full";
+    std::atomic<int> target{0};
+    std::atomic<bool> running{true};
+    std::mutex mutex;
+    std::vector<Clock::time_point> presses;
+    std::vector<std::pair<uint32_t, Clock::time_point>> shown; // (frame number, time it reached the panel)
+
+    // button presses every 60 to 200 ms
+    std::thread input([&]() {
+        std::mt19937 rng(SEED);
+        while (running)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(60 + rng() % 140));
+            std::lock_guard<std::mutex> lock(mutex);
+            presses.push_back(Clock::now());
+            target = (target + 1) % ITEM_COUNT;
+        }
+    });
+
+    // panel watcher : when each frame is on the panel
+    std::thread watcher([&]() {
+        uint32_t last = ScreenDriver::GetShownFrame();
+        while (running)
+        {
+            uint32_t now = ScreenDriver::GetShownFrame();
+            if (now != last)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                shown.emplace_back(now, Clock::now());
+                last = now;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    });
+
+    // UI loop (Menus::update_task)
+    std::vector<std::pair<size_t, uint32_t>> press_frames; // (number of presses seen, first frame drawn after them)
+    float selection = 0.0f;
+    uint32_t frames = 0;
+    double blocked_s = 0.0;
+    Clock::time_point start = Clock::now();
+    Clock::time_point next = start;
+    Clock::time_point end = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+    while (Clock::now() < end)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            press_frames.emplace_back(presses.size(), ScreenDriver::GetPresentedFrame() + 1);
+        }
+        selection += (target - selection) * 0.5f;
+        render_list(selection, frames, background);
+
+        Clock::time_point before = Clock::now();
+        ScreenDriver::Upload();
+        blocked_s += std::chrono::duration<double>(Clock::now() - before).count();
+        frames++;
+
+        next += std::chrono::milliseconds(period_ms);
+        if (next < Clock::now()) next = Clock::now(); // late, like xTaskDelayUntil catching up
+        std::this_thread::sleep_until(next);
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    ScreenDriver::Flush(1000);
+    running = false;
+    input.join();
+    watcher.join();
+
+    Run result{ scene, async, period_ms };
+    ScreenDriver::UploadStats stats = ScreenDriver::GetUploadStats();
+    result.rendered_fps = frames / elapsed;
+    result.shown_fps = stats.frames / elapsed;
+    result.dropped = stats.dropped;
+    result.blocked_ms = blocked_s * 1000 / frames;
+    {
+        std::lock_guard<std::mutex> lock(bus.mutex);
+        result.panel_ok = memcmp(bus.frame, ScreenDriver::info.data, sizeof(bus.frame)) == 0;
+    }
+
+    // latency of each press : first frame drawn after it, then the moment that frame (or a later one) was shown
+    std::vector<double> latencies;
+    size_t frame_index = 0;
+    for (size_t p = 0; p < presses.size(); p++)
+    {
+        while (frame_index < press_frames.size() && press_frames[frame_index].first <= p) frame_index++;
+        if (frame_index >= press_frames.size()) break;
+        uint32_t frame = press_frames[frame_index].second;
+        auto it = std::find_if(shown.begin(), shown.end(), [&](const auto& s) { return static_cast<int32_t>(s.first - frame) >= 0; });
+        if (it == shown.end()) break;
+        latencies.push_back(std::chrono::duration<double, std::milli>(it->second - presses[p]).count());
+    }
+    std::sort(latencies.begin(), latencies.end());
+    result.presses = latencies.size();
+    if (!latencies.empty())
+    {
+        double sum = 0.0;
+        for (double l : latencies) sum += l;
+        result.latency_mean_ms = sum / latencies.size();
+        result.latency_p95_ms = latencies[latencies.size() * 95 / 100];
+        result.latency_max_ms = latencies.back();
+    }
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    double seconds = 3.0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = strtod(argv[++i], nullptr);
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--seconds s]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    static FakeBus bus;
+    if (ScreenDriver::SetBackend(&bus) != Status::Ok || ScreenDriver::Init() != Status::Ok)
+    {
+        fprintf(stderr, "Failed to init the screen driver\n");
+        return 1;
+    }
+
+    std::vector<Run> runs;
+    for (const char* scene : { "list", "full" })
+    {
+        for (uint32_t period_ms : { static_cast<uint32_t>(SCREEN_REFRESH_RATE), 16u })
+        {
+            for (bool async : { false, true })
+            {
+                runs.push_back(run(bus, scene, async, period_ms, seconds));
+            }
+        }
+    }
+    ScreenDriver::StopUploadTask();
+
+    bool failed = false;
+    for (const Run& r : runs) failed |= !r.panel_ok;
+
+    if (json)
+    {
+        printf("{\"i2c_byte_us\": %.1f, \"runs\": [\n", I2C_BYTE_US);
+        for (size_t i = 0; i < runs.size(); i++)
+        {
+            const Run& r = runs[i];
+            printf("  {\"scene\": \"%s\", \"upload\": \"%s\", \"period_ms\": %u, \"rendered_fps\": %.1f, \"shown_fps\": %.1f, "
+                   "\"dropped\": %u, \"blocked_ms\": %.2f, \"latency_mean_ms\": %.1f, \"latency_p95_ms\": %.1f, "
+                   "\"latency_max_ms\": %.1f, \"presses\": %u, \"panel_ok\": %s}%s\n",
+                   r.scene.c_str(), r.async ? "task" : "sync", r.period_ms, r.rendered_fps, r.shown_fps, r.dropped, r.blocked_ms,
+                   r.latency_mean_ms, r.latency_p95_ms, r.latency_max_ms, r.presses, r.panel_ok ? "true" : "false",
+                   i + 1 < runs.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("fake bus : %.1f us per byte (400 kHz), %.1f s per run\n\n", I2C_BYTE_US, seconds);
+        printf("%-6s %-6s %7s %9s %9s %8s %11s %28s %6s\n", "scene", "upload", "target", "rendered", "shown", "dropped",
+               "blocked ms", "input to photon mean/p95/max", "panel");
+        for (const Run& r : runs)
+        {
+            printf("%-6s %-6s %5.0ffps %8.1f %9.1f %8u %11.2f %12.1f / %5.1f / %5.1f ms %6s\n", r.scene.c_str(), r.async ? "task" : "sync",
+                   1000.0 / r.period_ms, r.rendered_fps, r.shown_fps, r.dropped, r.blocked_ms, r.latency_mean_ms, r.latency_p95_ms,
+                   r.latency_max_ms, r.panel_ok ? "ok" : "FAILED");
+        }
+    }
+
+    return failed ? 2 : 0;
+}
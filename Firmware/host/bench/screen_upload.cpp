@@ -0,0 +1,403 @@
+/**
+ * Dirty span uploads of the screen driver (drivers/ScreenDriver.hpp) on the menus of the robot.
+ *
+ * Every scene renders its frames like Menu::render() does (clear, draw the whole menu, upload) and the fake panel
+ * only receives the spans the driver decides to send. After each upload the panel must show exactly the screen
+ * buffer, which is what a full upload would have shown.
+ *
+ * - list_idle : a list menu after its title animation, nothing moves (the menus redraw it every 30 ms anyway)
+ * - list_browse : the same list, going down and up its items (selection and scroll animations)
+ * - power : Power menu, readings changing every frame
+ * - logs : Logs menu, a new line every second
+ * - face : Face menu, eyes looking around, blinking and moving their lids
+ * - random : random primitives of every kind (safe and unsafe, clipped, both colors) without clearing, to check
+ *   that each of them records what it draws
+ *
+ * For each scene : bytes sent per frame against a full upload (pixels and addressing), I2C time at 400 kHz, spans
+ * per frame and host CPU time of the upload. Exits with 2 if the panel differs from the buffer.
+ *
+ * Usage : bench_screen_upload [--json]
+ */
+#include "common/config.hpp"
+#include "drivers/ScreenDriver.hpp"
+#include "host/FakeDrivers.hpp"
+#include "ui/Draw.hpp"
+#include "ui/Icons.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+constexpr uint32_t SEED = 0x360;
+constexpr uint32_t FULL_FRAME_BYTES = ScreenDriver::PAGE_COUNT * (SCREEN_WIDTH + ScreenDriver::SPAN_OVERHEAD_BYTES);
+constexpr double I2C_BYTE_US = 9 / 0.4; // 8 bits and the acknowledge at 400 kHz
+
+/** MENU FRAMES (same drawing as the menus, see src/ui/menus) **/
+
+constexpr uint8_t HEADER_HEIGHT = 10;
+constexpr uint8_t HEADER_TITLE_ANIMATION_SHIFT = 16;
+
+/// @brief Menu::render() title animation and Menu::renderHeader()
+struct Header
+{
+    const char* title;
+    const uint8_t* icon;
+    int8_t title_shift = HEADER_TITLE_ANIMATION_SHIFT;
+
+    void step()
+    {
+        if (title_shift == 1 || title_shift == -1) title_shift = 0;
+        else if (title_shift != 0) title_shift -= title_shift / 2;
+    }
+
+    void render()
+    {
+        uint8_t text_width = Draw::GetTextWidth(title);
+        Draw::RectFilled<false>(0, 0, ScreenDriver::info.width, HEADER_HEIGHT, ScreenDriver::COLOR_BLACK);
+        Draw::Text<true>(title_shift - text_width / 2 + ScreenDriver::info.width / 2, 0, title);
+        Draw::Blit<false>(0, 0, 8, 8, (uint8_t*)icon);
+    }
+};
+
+/// @brief MenuList::onRender() with the items of the main menu
+struct ListMenu
+{
+    struct Item
+    {
+        const char* title;
+        const uint8_t* icon;
+    };
+    std::vector<Item> items = {
+        { "Network", Icons::NetworkMenu },
+        { "Tests", Icons::TestsMenu },
+        { "Calibration", Icons::CalibrationMenu },
+        { "System", Icons::SystemMenu },
+    };
+    Header header{ "Main menu", Icons::MainMenu };
+    uint8_t selected_index = 0;
+    uint8_t selected_shift = 4;
+    float view_shift_current = 0.0f;
+    float selected_index_current = 0.0f;
+
+    void select(uint8_t index)
+    {
+        selected_index = index;
+        selected_shift = MENU_LIST_ITEM_DEFAULT_SHIFT;
+    }
+
+    void render()
+    {
+        header.step();
+        if (selected_shift < MENU_LIST_ITEM_SELECTED_SHIFT) selected_shift += 1;
+
+        view_shift_current += (selected_index - view_shift_current) * 0.25f;
+        selected_index_current += (selected_index - selected_index_current) * 0.5f;
+
+        const uint8_t text_height = 8;
+        const uint8_t padding = 4;
+        const uint8_t item_height = text_height + padding * 2 + 1;
+
+        int16_t y_select_pos = ScreenDriver::info.height / 2 + (selected_index_current - view_shift_current) * item_height;
+        Draw::RectRounded<true>(0, y_select_pos - item_height / 2, ScreenDriver::info.width, item_height, 4, ScreenDriver::COLOR_WHITE);
+        Draw::RectRounded<true>(1, y_select_pos - item_height / 2 + 1, ScreenDriver::info.width - 3, item_height - 3, 2, ScreenDriver::COLOR_BLACK);
+
+        for (uint8_t i = 0; i < items.size(); i++)
+        {
+            bool selected = (i == selected_index);
+            int x_pos = (selected ? selected_shift : MENU_LIST_ITEM_DEFAULT_SHIFT);
+            int y_pos = ScreenDriver::info.height / 2 + (i - view_shift_current) * item_height;
+            if (y_pos < 0) continue;
+            Draw::Text<true>(x_pos + 14, y_pos - text_height / 2, items[i].title);
+            Draw::RectRounded<true>(x_pos - 2, y_pos - 6, 12, 12, 2, ScreenDriver::COLOR_BLACK);
+            Draw::Blit<true>(x_pos, y_pos - 4, 8, 8, (uint8_t*)items[i].icon, ScreenDriver::COLOR_WHITE, true);
+        }
+
+        header.render();
+    }
+};
+
+/// @brief MenuPower::onRender()
+static void render_power(Header& header, float voltage_v, float current_a)
+{
+    header.step();
+    header.render();
+
+    char str[32];
+    snprintf(str, sizeof(str), "Voltage: %+1.1f V", voltage_v);
+    Draw::Text(0, HEADER_HEIGHT + 4 + 12, str);
+    snprintf(str, sizeof(str), "Current: %+1.1f A", current_a);
+    Draw::Text(0, HEADER_HEIGHT + 4 + 27, str);
+    snprintf(str, sizeof(str), "Power:   %+1.1f W", voltage_v * current_a);
+    Draw::Text(0, HEADER_HEIGHT + 4 + 42, str);
+}
+
+/// @brief MenuLogs::onRender(), `lines` newest first
+static void render_logs(Header& header, const std::vector<std::string>& lines)
+{
+    header.step();
+    header.render();
+
+    for (size_t i = 0; i < 4 && i < lines.size(); i++)
+    {
+        char str[128 / 8 + 1];
+        snprintf(str, sizeof(str), "[I] %.12s", lines[3 - i].c_str());
+        Draw::Text(0, HEADER_HEIGHT + i * 12 + 4, str);
+    }
+}
+
+/// @brief MenuFace::onRender() (eyes and lids)
+static void render_face(uint32_t frame)
+{
+    float t = frame * 0.05f;
+    float look_x = 0.9f * std::sin(t), look_y = 0.9f * std::cos(t * 1.3f), skew = 0.3f * std::sin(t * 0.5f);
+    float open = 1.2f * std::fabs(std::sin(t * 0.7f));
+    float lid = std::max(0.0f, std::sin(t * 0.3f)) * 0.5f;
+
+    const uint16_t width = SCREEN_WIDTH, height = SCREEN_HEIGHT;
+    uint8_t size = 30;
+    float look_x_right = look_x * 2 + look_x * look_x;
+    float look_x_left = look_x * 2 - look_x * look_x;
+
+    for (int side = 0; side < 2; side++)
+    {
+        float cy = height / 2 + look_y * 10.0f + (side == 0 ? -skew : skew) * 5.0f;
+        float cx = (side == 0 ? width / 4 : width * 3 / 4) + (side == 0 ? look_x_right : look_x_left) * 10.0f;
+        float h = size * open;
+        float top = cy - h / 2;
+        Draw::RectRounded<false>(cx - size / 2, top, size, h, 7, ScreenDriver::COLOR_WHITE);
+        if (lid > 0.001f)
+        {
+            float inner = side == 0 ? cx + size / 2 : cx - size / 2;
+            Draw::TriangleFilled<false>(cx - size / 2, top, cx + size / 2, top, inner, top + lid * h, ScreenDriver::COLOR_BLACK);
+            float outer = side == 0 ? cx - size / 2 : cx + size / 2;
+            Draw::TriangleFilled<false>(cx - size / 2, top, cx + size / 2, top, outer, top + lid * 0.5f * h, ScreenDriver::COLOR_BLACK);
+        }
+    }
+}
+
+/// @brief One random primitive, anywhere (partly outside of the screen in safe mode)
+static void random_primitive(std::mt19937& rng)
+{
+    bool safe = rng() & 1;
+    auto coord = [&](int size) -> uint16_t {
+        return safe ? static_cast<uint16_t>(static_cast<int>(rng() % (size + 48)) - 24) : static_cast<uint16_t>(rng() % size);
+    };
+    ScreenDriver::Color c = rng() & 1;
+    uint16_t x = coord(SCREEN_WIDTH), y = coord(SCREEN_HEIGHT);
+    switch (rng() % 8)
+    {
+    case 0:
+        if (safe) Draw::Pixel<true>(x, y, c);
+        else Draw::Pixel<false>(x, y, c);
+        break;
+    case 1: // lines with positive coordinates (safe mode doesn't walk negative ones)
+    {
+        uint16_t x2 = rng() % (SCREEN_WIDTH + 24), y2 = rng() % (SCREEN_HEIGHT + 24);
+        if (safe) Draw::Line<true>(x % SCREEN_WIDTH, y % SCREEN_HEIGHT, x2, y2, c);
+        else Draw::Line<false>(x % SCREEN_WIDTH, y % SCREEN_HEIGHT, x2 % SCREEN_WIDTH, y2 % SCREEN_HEIGHT, c);
+        break;
+    }
+    case 2:
+    {
+        uint16_t l = rng() % 64;
+        if (safe) Draw::Hline<true>(x, y, l, c);
+        else Draw::Hline<false>(x, y, std::min<uint16_t>(l, SCREEN_WIDTH - x), c);
+        break;
+    }
+    case 3:
+    {
+        uint16_t l = rng() % 32;
+        if (safe) Draw::Vline<true>(x, y, l, c);
+        else Draw::Vline<false>(x, y, std::min<uint16_t>(l, SCREEN_HEIGHT - y), c);
+        break;
+    }
+    case 4:
+    {
+        uint16_t w = rng() % 48 + 1, h = rng() % 32 + 1;
+        if (safe) Draw::RectFilled<true>(x, y, w, h, c);
+        else Draw::RectFilled<false>(x, y, std::min<uint16_t>(w, SCREEN_WIDTH - x), std::min<uint16_t>(h, SCREEN_HEIGHT - y), c);
+        break;
+    }
+    case 5:
+    {
+        uint16_t w = rng() % 48 + 1, h = rng() % 32 + 1, r = rng() % 10;
+        if (safe) Draw::RectRounded<true>(x, y, w, h, r, c);
+        else Draw::RectRounded<false>(x, y, std::min<uint16_t>(w, SCREEN_WIDTH - x), std::min<uint16_t>(h, SCREEN_HEIGHT - y), r, c);
+        break;
+    }
+    case 6:
+    {
+        uint16_t r = rng() % 16;
+        if (safe) Draw::CircleFilled<true>(x, y, r, c);
+        else
+        {
+            r = std::min<uint16_t>({ r, x, y, static_cast<uint16_t>(SCREEN_WIDTH - 1 - x), static_cast<uint16_t>(SCREEN_HEIGHT - 1 - y) });
+            Draw::CircleFilled<false>(x, y, r, c);
+        }
+        break;
+    }
+    case 7:
+    {
+        bool transparent = rng() & 1;
+        if (safe) Draw::Text<true>(x, y, "TNY", c, transparent);
+        else Draw::Text<false>(x % (SCREEN_WIDTH - 24), y % (SCREEN_HEIGHT - 8), "TNY", c, transparent);
+        break;
+    }
+    }
+}
+
+/** SCENES **/
+
+struct Scene
+{
+    std::string name;
+    uint32_t frames;
+    std::function<void(uint32_t)> render; // draws frame i (clearing the screen first if needed)
+};
+
+struct Result
+{
+    std::string name;
+    uint32_t frames;
+    double bytes_per_frame;
+    uint32_t max_frame_bytes;
+    double spans_per_frame;
+    double upload_ns;
+    uint32_t mismatches;
+};
+
+static Result run_scene(const Scene& scene)
+{
+    FakeDrivers::Screen& panel = FakeDrivers::GetScreen();
+    ScreenDriver::Clear();
+    ScreenDriver::Invalidate(); // every scene starts from a full upload, not counted
+    ScreenDriver::Upload();
+    ScreenDriver::ResetUploadStats();
+
+    Result result{ scene.name, scene.frames };
+    result.mismatches = 0;
+    double upload_s = 0.0;
+    for (uint32_t i = 0; i < scene.frames; i++)
+    {
+        scene.render(i);
+
+        auto start = std::chrono::steady_clock::now();
+        ScreenDriver::Upload();
+        upload_s += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (memcmp(panel.frame, ScreenDriver::info.data, sizeof(panel.frame)) != 0)
+        {
+            if (result.mismatches == 0) fprintf(stderr, "%s : panel differs from the screen buffer at frame %u\n", scene.name.c_str(), i);
+            result.mismatches++;
+            memcpy(panel.frame, ScreenDriver::info.data, sizeof(panel.frame)); // keep going from a correct panel
+        }
+    }
+
+    ScreenDriver::UploadStats stats = ScreenDriver::GetUploadStats();
+    result.bytes_per_frame = static_cast<double>(stats.bytes) / stats.frames;
+    result.max_frame_bytes = stats.max_frame_bytes;
+    result.spans_per_frame = static_cast<double>(stats.spans) / stats.frames;
+    result.upload_ns = upload_s * 1e9 / scene.frames;
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (ScreenDriver::Init() != Status::Ok)
+    {
+        fprintf(stderr, "Failed to init the screen driver\n");
+        return 1;
+    }
+
+    ListMenu idle_list;
+    ListMenu browsed_list;
+    Header power_header{ "Power", Icons::PowerMenu };
+    Header logs_header{ "Logs", Icons::LogsMenu };
+    std::vector<std::string> log_lines = { "Boot", "I2C ready", "IMU ready", "Motors ready" };
+    std::mt19937 rng(SEED);
+
+    std::vector<Scene> scenes = {
+        { "list_idle", 300, [&](uint32_t) {
+             ScreenDriver::Clear();
+             idle_list.render();
+         } },
+        { "list_browse", 600, [&](uint32_t i) {
+             // one step every 20 frames (600 ms), down to the last item then back up
+             if (i % 20 == 0 && i > 0)
+             {
+                 uint32_t step = (i / 20) % 6;
+                 browsed_list.select(step < 3 ? step + 1 : 6 - step - 1);
+             }
+             ScreenDriver::Clear();
+             browsed_list.render();
+         } },
+        { "power", 600, [&](uint32_t i) {
+             ScreenDriver::Clear();
+             render_power(power_header, 7.4f + 0.8f * std::sin(i * 0.01f), 0.6f + 0.5f * std::sin(i * 0.13f));
+         } },
+        { "logs", 600, [&](uint32_t i) {
+             if (i % 33 == 32) log_lines.push_back("Line " + std::to_string(i));
+             ScreenDriver::Clear();
+             render_logs(logs_header, std::vector<std::string>(log_lines.end() - 4, log_lines.end()));
+         } },
+        { "face", 2000, [&](uint32_t i) {
+             ScreenDriver::Clear();
+             render_face(i);
+         } },
+        { "random", 5000, [&](uint32_t) {
+             for (uint32_t n = rng() % 4 + 1; n > 0; n--) random_primitive(rng);
+         } },
+    };
+
+    std::vector<Result> results;
+    uint32_t mismatches = 0;
+    for (const Scene& scene : scenes)
+    {
+        results.push_back(run_scene(scene));
+        mismatches += results.back().mismatches;
+    }
+
+    if (json)
+    {
+        printf("{\"full_frame_bytes\": %u, \"mismatches\": %u, \"scenes\": [\n", FULL_FRAME_BYTES, mismatches);
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const Result& r = results[i];
+            printf("  {\"name\": \"%s\", \"frames\": %u, \"bytes_per_frame\": %.1f, \"max_frame_bytes\": %u, \"saved\": %.4f, "
+                   "\"i2c_us_per_frame\": %.0f, \"spans_per_frame\": %.2f, \"upload_ns\": %.1f}%s\n",
+                   r.name.c_str(), r.frames, r.bytes_per_frame, r.max_frame_bytes, 1.0 - r.bytes_per_frame / FULL_FRAME_BYTES,
+                   r.bytes_per_frame * I2C_BYTE_US, r.spans_per_frame, r.upload_ns, i + 1 < results.size() ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("full frame : %u bytes, %.1f ms at 400 kHz\n\n", FULL_FRAME_BYTES, FULL_FRAME_BYTES * I2C_BYTE_US / 1000);
+        printf("%-12s %7s %12s %10s %8s %12s %7s %10s\n", "scene", "frames", "bytes/frame", "max bytes", "saved", "i2c us/frame",
+               "spans", "upload ns");
+        for (const Result& r : results)
+        {
+            printf("%-12s %7u %12.1f %10u %7.1f%% %12.0f %7.2f %10.1f\n", r.name.c_str(), r.frames, r.bytes_per_frame,
+                   r.max_frame_bytes, 100.0 * (1.0 - r.bytes_per_frame / FULL_FRAME_BYTES), r.bytes_per_frame * I2C_BYTE_US,
+                   r.spans_per_frame, r.upload_ns);
+        }
+        printf("\npanel check : %s (%u frames differ from the screen buffer)\n", mismatches == 0 ? "ok" : "FAILED", mismatches);
+    }
+
+    return mismatches == 0 ? 0 : 2;
+}
@@ -0,0 +1,173 @@
+/**
+ * Closed-loop walking benchmark : the unmodified ControlLoop::control_task() drives the physics
+ * simulation (host/sim) through the drivers, on virtual time, as fast as the host can go.
+ *
+ * Reports the headline metrics of the gait (distance, tilt, energy) along with the simulation speed,
+ * so it can be used as a regression benchmark for the locomotion stack.
+ *
+ * With --record, the raw sensor streams are captured by the firmware SensorRecorder, and the simulation
+ * ground truth is written next to them (<file>.ref), to be replayed by replay_estimators.
+ *
+ * Usage : bench_sim_walk [seconds] [velocity_m_s] [--json] [--record file]
+ */
+#include "sim/Simulation.hpp"
+#include "diagnostic/SensorRecorder.hpp"
+#include "common/SensorRecord.hpp"
+#include "locomotion/Body.hpp"
+#include "locomotion/ControlLoop.hpp"
+#include "locomotion/IPC.hpp"
+#include "common/config.hpp"
+#include "host/HostClock.hpp"
+#include "esp_log_timestamp.h"
+#include "esp_timer.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    float duration_s = 10.f;
+    float velocity_m_s = 0.1f;
+    bool json = false;
+    const char* record_path = nullptr;
+    int positional = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) record_path = argv[++i];
+        else if (positional == 0) { duration_s = strtof(argv[i], nullptr); positional++; }
+        else if (positional == 1) { velocity_m_s = strtof(argv[i], nullptr); positional++; }
+    }
+    if (duration_s <= 0.f)
+    {
+        fprintf(stderr, "usage: %s [seconds] [velocity_m_s] [--json] [--record file]\n", argv[0]);
+        return 1;
+    }
+
+    HostClock::SetVirtual(true);
+
+    Body body;
+    ControlLoop control_loop(body);
+    Sim::Simulation sim(body, control_loop.getKinematicsEngine());
+
+    if (sim.install() != Status::Ok)
+    {
+        fprintf(stderr, "Failed to install the simulation\n");
+        return 1;
+    }
+    if (body.init() != Status::Ok)
+    {
+        fprintf(stderr, "Failed to initialize the body\n");
+        return 1;
+    }
+
+    IPC::ControlIntent intent;
+    intent.gait = GaitPlanner::GaitType::Walk;
+    intent.body_pos = Vec3f(0.f, 0.f, DEFAULT_BODY_HEIGHT_M);
+
+    // Motors stay limp during the first second, so the analog filters converge to the actual joint
+    // positions before the joints sync on them (like on the robot, where the control loop runs before
+    // the body is enabled). Then stand one second, then walk.
+    const long warmup_ticks = CONTROL_LOOP_FREQ_HZ;
+    const long settle_ticks = 2 * CONTROL_LOOP_FREQ_HZ;
+    const long ticks = settle_ticks + static_cast<long>(duration_s * CONTROL_LOOP_FREQ_HZ);
+    long failed = 0;
+
+    SensorRecord::Writer reference;
+    if (record_path != nullptr)
+    {
+        std::string reference_path = std::string(record_path) + ".ref";
+        if (SensorRecorder::Start(record_path) != Status::Ok ||
+            reference.open(reference_path.c_str(), CONTROL_LOOP_FREQ_HZ) != Status::Ok)
+        {
+            fprintf(stderr, "Failed to start the recording\n");
+            return 1;
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < ticks; i++)
+    {
+        if (reference.isOpen())
+        {
+            // state seen by the sensors read in this tick
+            SensorRecord::ReferencePayload truth = {};
+            Vec3f rpy = sim.getOrientation();
+            truth.roll_rad = rpy.x;
+            truth.pitch_rad = rpy.y;
+            for (int l = 0; l < 4; l++)
+            {
+                for (int j = 0; j < 3; j++) truth.joint_angles_rad[l * 3 + j] = sim.getJointAngle(l, j);
+                if (sim.isFootInContact(l)) truth.contacts |= 1 << l;
+            }
+            reference.write(SensorRecord::Type::Reference, esp_timer_get_time(), &truth, sizeof(truth));
+
+            // the simulation runs way faster than real-time, let the writer task keep up
+            while (SensorRecorder::GetStats().pending > RECORDER_QUEUE_SIZE / 2)
+            {
+                std::this_thread::yield();
+            }
+        }
+        if (i == warmup_ticks && body.enable() != Status::Ok)
+        {
+            fprintf(stderr, "Failed to enable the body\n");
+            return 1;
+        }
+        if (i == settle_ticks)
+        {
+            sim.resetMetrics();
+        }
+        intent.body_vel = Vec3f(i < settle_ticks ? 0.f : velocity_m_s, 0.f, 0.f);
+        intent.timestamp_ms = esp_log_timestamp();
+        IPC::setIntent(intent);
+
+        if (control_loop.control_task() != Status::Ok)
+        {
+            failed++;
+        }
+        sim.step();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double elapsed_s = std::chrono::duration<double>(end - start).count();
+    const Sim::Simulation::Metrics& m = sim.getMetrics();
+    float speed_m_s = m.forward_m / m.time_s;
+    double realtime_factor = ticks * CONTROL_LOOP_DT_S / elapsed_s;
+
+    if (json)
+    {
+        printf("{\"sim_time_s\": %.3f, \"distance_m\": %.4f, \"forward_m\": %.4f, \"speed_m_s\": %.4f, "
+               "\"tilt_rms_deg\": %.3f, \"tilt_max_deg\": %.3f, \"energy_j\": %.2f, \"avg_power_w\": %.3f, "
+               "\"cost_of_transport\": %.2f, \"fell\": %s, \"failed_ticks\": %ld, \"realtime_factor\": %.1f}\n",
+               m.time_s, m.distance_m, m.forward_m, speed_m_s,
+               RAD_TO_DEG(m.tilt_rms_rad), RAD_TO_DEG(m.tilt_max_rad), m.energy_j, m.energy_j / m.time_s,
+               m.cost_of_transport, m.fell ? "true" : "false", failed, realtime_factor);
+    }
+    else
+    {
+        printf("walked        : %.1f s (%ld ticks with warm-up, %ld failed)\n", m.time_s, ticks, failed);
+        printf("distance      : %.3f m (forward %.3f m, %.3f m/s, asked %.3f m/s)\n", m.distance_m, m.forward_m, speed_m_s, velocity_m_s);
+        printf("tilt          : %.2f deg RMS, %.2f deg max%s\n", RAD_TO_DEG(m.tilt_rms_rad), RAD_TO_DEG(m.tilt_max_rad), m.fell ? " (FELL)" : "");
+        printf("energy        : %.1f J (%.2f W average, cost of transport %.1f)\n", m.energy_j, m.energy_j / m.time_s, m.cost_of_transport);
+        printf("vs real-time  : x%.1f (%.2f us/tick)\n", realtime_factor, elapsed_s * 1e6 / ticks);
+    }
+
+    if (record_path != nullptr)
+    {
+        SensorRecorder::Stop();
+        while (SensorRecorder::IsRecording())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        reference.close();
+        SensorRecorder::Stats stats = SensorRecorder::GetStats();
+        fprintf(stderr, "recorded %u records (%u bytes, %u dropped) to %s\n", stats.records, stats.bytes, stats.dropped, record_path);
+    }
+
+    body.deinit();
+    sim.uninstall();
+    return (failed == 0 && !m.fell) ? 0 : 2;
+}
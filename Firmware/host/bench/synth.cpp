@@ -0,0 +1,355 @@
+/**
+ * Wavetable synthesis (audio/Synth.hpp, audio/ToneProvider.hpp) : signal checks and cost against the previous
+ * std::sin based SineProvider.
+ *
+ * - purity : SFDR (fundamental vs strongest spur) and SINAD of the sine oscillator, from a windowed FFT
+ * - harmonics : 3rd harmonic level of the square and triangle tables against theory (-9.5 dB, -19.1 dB)
+ * - sequences : every tune of audio/Tunes.hpp plays for the expected duration, stays in range and ends silent
+ * - cost : cycles (rdtsc, x86 only) and ns per sample of each generator
+ *
+ * Exits with 2 if a check fails.
+ *
+ * Usage : bench_synth [--json]
+ */
+#include "audio/SineProvider.hpp"
+#include "audio/ToneProvider.hpp"
+#include "audio/Tunes.hpp"
+#include "common/config.hpp"
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+constexpr size_t BLOCK = 512;
+constexpr double SFDR_MIN_DB = 80.0;        // sine oscillator spurs must stay below this
+constexpr double HARMONIC_TOLERANCE_DB = 1.0;
+constexpr double END_SILENCE_MAX = 0.01;    // last sample of a tune, fraction of full scale
+
+static inline uint64_t read_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief SineProvider before the wavetable oscillator (kept as the reference).
+ */
+class LegacySineProvider : public SoundProvider
+{
+public:
+    LegacySineProvider(float frequencyHz, float volume)
+        : volume(volume), phaseIncrement((2.0f * M_PI * frequencyHz) / static_cast<float>(SPEAKER_SAMPLE_RATE_HZ)) {}
+
+    bool provideSamples(Speaker::Sample* buffer, size_t sampleCount) override
+    {
+        const float amplitude = 20000.0f * volume;
+        for (size_t i = 0; i < sampleCount; i++)
+        {
+            buffer[i] = static_cast<Speaker::Sample>(amplitude * std::sin(phase));
+            phase += phaseIncrement;
+            if (phase > 2.0f * M_PI) phase -= 2.0f * M_PI;
+        }
+        return true;
+    }
+
+private:
+    float volume;
+    float phase = 0.0f;
+    float phaseIncrement;
+};
+
+/** SPECTRUM **/
+
+static void fft(std::vector<std::complex<double>>& data)
+{
+    const size_t n = data.size();
+    for (size_t i = 1, j = 0; i < n; i++)
+    {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j ^= bit;
+        if (i < j) std::swap(data[i], data[j]);
+    }
+    for (size_t len = 2; len <= n; len <<= 1)
+    {
+        std::complex<double> w_len = std::polar(1.0, -2.0 * M_PI / len);
+        for (size_t i = 0; i < n; i += len)
+        {
+            std::complex<double> w = 1.0;
+            for (size_t k = 0; k < len / 2; k++)
+            {
+                std::complex<double> u = data[i + k], v = data[i + k + len / 2] * w;
+                data[i + k] = u + v;
+                data[i + k + len / 2] = u - v;
+                w *= w_len;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Power spectrum (first half) of samples, with a 4-term Blackman-Harris window (-92 dB sidelobes).
+ */
+static std::vector<double> power_spectrum(const std::vector<Speaker::Sample>& samples)
+{
+    const size_t n = samples.size();
+    std::vector<std::complex<double>> data(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        double x = 2.0 * M_PI * i / n;
+        double window = 0.35875 - 0.48829 * std::cos(x) + 0.14128 * std::cos(2 * x) - 0.01168 * std::cos(3 * x);
+        data[i] = samples[i] * window;
+    }
+    fft(data);
+    std::vector<double> power(n / 2);
+    for (size_t i = 0; i < n / 2; i++) power[i] = std::norm(data[i]);
+    return power;
+}
+
+constexpr size_t FFT_SIZE = 1 << 15;
+constexpr size_t MAIN_LOBE = 6; // bins each side of a tone holding its windowed energy
+
+static std::vector<Speaker::Sample> render(SoundProvider& provider, size_t count)
+{
+    std::vector<Speaker::Sample> samples(count);
+    for (size_t i = 0; i < count; i += BLOCK)
+        provider.provideSamples(samples.data() + i, std::min(BLOCK, count - i));
+    return samples;
+}
+
+static double band_power(const std::vector<double>& power, double frequency)
+{
+    long center = std::lround(frequency * FFT_SIZE / SPEAKER_SAMPLE_RATE_HZ);
+    double sum = 0.0;
+    for (long i = center - (long) MAIN_LOBE; i <= center + (long) MAIN_LOBE; i++)
+        if (i > 0 && i < (long) power.size()) sum += power[i];
+    return sum;
+}
+
+struct Purity
+{
+    double frequency;
+    double sfdr_db;
+    double sinad_db;
+};
+
+static Purity measure_purity(SoundProvider& provider, double frequency)
+{
+    std::vector<double> power = power_spectrum(render(provider, FFT_SIZE));
+    long center = std::lround(frequency * FFT_SIZE / SPEAKER_SAMPLE_RATE_HZ);
+
+    double signal = band_power(power, frequency);
+    double noise = 0.0, spur = 0.0;
+    for (long i = MAIN_LOBE; i < (long) power.size(); i++) // skip DC
+    {
+        if (std::labs(i - center) <= (long) MAIN_LOBE) continue;
+        noise += power[i];
+        spur = std::max(spur, power[i]);
+    }
+    double peak = 0.0;
+    for (long i = center - (long) MAIN_LOBE; i <= center + (long) MAIN_LOBE; i++) peak = std::max(peak, power[i]);
+    return { frequency, 10 * std::log10(peak / spur), 10 * std::log10(signal / noise) };
+}
+
+/** COST **/
+
+struct Cost
+{
+    std::string name;
+    double ns_per_sample;
+    double cycles_per_sample;
+};
+
+static Cost measure_cost(const std::string& name, const std::function<void(Speaker::Sample*)>& render_block)
+{
+    constexpr int BLOCKS = 20000;
+    Speaker::Sample buffer[BLOCK];
+    volatile int32_t sink = 0;
+    for (int i = 0; i < 100; i++) render_block(buffer); // warm up (tables, caches)
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t start_cycles = read_cycles();
+    for (int i = 0; i < BLOCKS; i++)
+    {
+        render_block(buffer);
+        sink = sink + buffer[i % BLOCK];
+    }
+    uint64_t cycles = read_cycles() - start_cycles;
+    auto end = std::chrono::steady_clock::now();
+    double samples = static_cast<double>(BLOCKS) * BLOCK;
+    return { name, std::chrono::duration<double, std::nano>(end - start).count() / samples, cycles / samples };
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+    bool failed = false;
+
+    // Spectral purity of the sine, old and new
+    std::vector<Purity> legacyPurity, sinePurity;
+    for (double frequency : { 440.0, 1000.0, 3151.7, 7040.0 })
+    {
+        LegacySineProvider legacy(frequency, 1.0f);
+        SineProvider sine(frequency, 1.0f);
+        legacyPurity.push_back(measure_purity(legacy, frequency));
+        sinePurity.push_back(measure_purity(sine, frequency));
+        if (sinePurity.back().sfdr_db < SFDR_MIN_DB) failed = true;
+    }
+
+    // Harmonics of the square and triangle tables
+    struct Harmonic { const char* name; double expected_db; double measured_db; };
+    std::vector<Harmonic> harmonics = { { "square", 20 * std::log10(1.0 / 3), 0 }, { "triangle", 20 * std::log10(1.0 / 9), 0 } };
+    for (size_t h = 0; h < harmonics.size(); h++)
+    {
+        constexpr double frequency = 440.0;
+        class Wave : public SoundProvider
+        {
+        public:
+            Wave(Synth::Waveform waveform) : oscillator(waveform, frequency) {}
+            bool provideSamples(Speaker::Sample* buffer, size_t count) override { oscillator.render(buffer, count, 20000); return true; }
+            Synth::Oscillator oscillator;
+        } wave(h == 0 ? Synth::Waveform::Square : Synth::Waveform::Triangle);
+        std::vector<double> power = power_spectrum(render(wave, FFT_SIZE));
+        harmonics[h].measured_db = 10 * std::log10(band_power(power, 3 * frequency) / band_power(power, frequency));
+        if (std::fabs(harmonics[h].measured_db - harmonics[h].expected_db) > HARMONIC_TOLERANCE_DB) failed = true;
+    }
+
+    // Sequences : duration, range, silent ending
+    struct SequenceCheck { std::string name; double expected_ms; double played_ms; int peak; double end_level; bool ok; };
+    std::vector<std::pair<std::string, const ToneSequence*>> sequences = {
+        { "ui_click", &Tunes::UiClick }, { "ui_select", &Tunes::UiSelect }, { "ui_back", &Tunes::UiBack },
+        { "ui_error", &Tunes::UiError }, { "boot", &Tunes::Boot }, { "shutdown", &Tunes::Shutdown },
+    };
+    const char* voices[] = { "voice_happy", "voice_sad", "voice_curious", "voice_surprised", "voice_alert", "voice_sleepy" };
+    for (size_t v = 0; v < static_cast<size_t>(Tunes::Voice::Count); v++)
+        sequences.push_back({ voices[v], &Tunes::GetVoice(static_cast<Tunes::Voice>(v)) });
+
+    std::vector<SequenceCheck> sequenceChecks;
+    for (auto& [name, sequence] : sequences)
+    {
+        SequenceCheck check{ name, 0, 0, 0, 0, true };
+        uint32_t expected_samples = 0;
+        for (uint8_t t = 0; t < sequence->count; t++)
+            expected_samples += static_cast<uint32_t>(sequence->tones[t].duration_ms) * SPEAKER_SAMPLE_RATE_HZ / 1000;
+        check.expected_ms = expected_samples * 1000.0 / SPEAKER_SAMPLE_RATE_HZ;
+
+        // render one sample at a time at the end, to find where the sound stops exactly
+        ToneProvider provider(*sequence);
+        std::vector<Speaker::Sample> samples;
+        Speaker::Sample buffer[BLOCK];
+        while (!provider.isFinished())
+        {
+            size_t count = samples.size() + BLOCK <= expected_samples ? BLOCK : 1;
+            if (!provider.provideSamples(buffer, count)) break;
+            samples.insert(samples.end(), buffer, buffer + count);
+        }
+        check.played_ms = samples.size() * 1000.0 / SPEAKER_SAMPLE_RATE_HZ;
+        for (Speaker::Sample s : samples) check.peak = std::max(check.peak, std::abs(static_cast<int>(s)));
+        check.end_level = samples.empty() ? 0.0 : std::abs(samples.back()) / 32767.0;
+        check.ok = samples.size() == expected_samples && check.end_level <= END_SILENCE_MAX && !provider.provideSamples(buffer, BLOCK);
+        failed |= !check.ok;
+        sequenceChecks.push_back(check);
+    }
+
+    // Cost
+    std::vector<Cost> costs;
+    {
+        LegacySineProvider legacy(1000.0f, 1.0f);
+        costs.push_back(measure_cost("legacy_sine_provider", [&](Speaker::Sample* b) { legacy.provideSamples(b, BLOCK); }));
+        SineProvider sine(1000.0f, 1.0f);
+        costs.push_back(measure_cost("sine_provider", [&](Speaker::Sample* b) { sine.provideSamples(b, BLOCK); }));
+        const char* names[] = { "oscillator_sine", "oscillator_square", "oscillator_triangle", "oscillator_noise" };
+        for (size_t w = 0; w < static_cast<size_t>(Synth::Waveform::Count); w++)
+        {
+            Synth::Oscillator oscillator(static_cast<Synth::Waveform>(w), 1000.0f);
+            costs.push_back(measure_cost(names[w], [&](Speaker::Sample* b) { oscillator.render(b, BLOCK, 20000); }));
+        }
+        Synth::Oscillator oscillator(Synth::Waveform::Sine, 1000.0f);
+        Synth::Envelope envelope({ 200, 200, 128, 200 });
+        int block = 0;
+        costs.push_back(measure_cost("oscillator_envelope", [&](Speaker::Sample* b) {
+            if (block++ % 64 == 0) envelope.noteOn(); // keep cycling through the stages
+            else if (block % 64 == 40) envelope.noteOff();
+            oscillator.render(b, BLOCK, 20000);
+            envelope.apply(b, BLOCK);
+        }));
+        ToneProvider* voice = nullptr;
+        costs.push_back(measure_cost("tone_provider_voice", [&](Speaker::Sample* b) {
+            if (voice == nullptr || !voice->provideSamples(b, BLOCK))
+            {
+                delete voice;
+                voice = new ToneProvider(Tunes::GetVoice(Tunes::Voice::Happy));
+                voice->provideSamples(b, BLOCK);
+            }
+        }));
+        delete voice;
+    }
+
+    if (json)
+    {
+        printf("{\"sample_rate\": %d, \"failed\": %s,\n \"purity\": [\n", SPEAKER_SAMPLE_RATE_HZ, failed ? "true" : "false");
+        for (size_t i = 0; i < sinePurity.size(); i++)
+            printf("  {\"frequency\": %.1f, \"legacy_sfdr_db\": %.1f, \"legacy_sinad_db\": %.1f, \"sfdr_db\": %.1f, \"sinad_db\": %.1f}%s\n",
+                   sinePurity[i].frequency, legacyPurity[i].sfdr_db, legacyPurity[i].sinad_db, sinePurity[i].sfdr_db,
+                   sinePurity[i].sinad_db, i + 1 < sinePurity.size() ? "," : "");
+        printf(" ],\n \"harmonics\": [\n");
+        for (size_t i = 0; i < harmonics.size(); i++)
+            printf("  {\"waveform\": \"%s\", \"expected_h3_db\": %.2f, \"measured_h3_db\": %.2f}%s\n", harmonics[i].name,
+                   harmonics[i].expected_db, harmonics[i].measured_db, i + 1 < harmonics.size() ? "," : "");
+        printf(" ],\n \"sequences\": [\n");
+        for (size_t i = 0; i < sequenceChecks.size(); i++)
+        {
+            const SequenceCheck& c = sequenceChecks[i];
+            printf("  {\"name\": \"%s\", \"expected_ms\": %.2f, \"played_ms\": %.2f, \"peak\": %d, \"end_level\": %.4f, \"ok\": %s}%s\n",
+                   c.name.c_str(), c.expected_ms, c.played_ms, c.peak, c.end_level, c.ok ? "true" : "false",
+                   i + 1 < sequenceChecks.size() ? "," : "");
+        }
+        printf(" ],\n \"cost\": [\n");
+        for (size_t i = 0; i < costs.size(); i++)
+            printf("  {\"name\": \"%s\", \"ns_per_sample\": %.3f, \"cycles_per_sample\": %.2f}%s\n", costs[i].name.c_str(),
+                   costs[i].ns_per_sample, costs[i].cycles_per_sample, i + 1 < costs.size() ? "," : "");
+        printf(" ]}\n");
+    }
+    else
+    {
+        printf("sine purity (%zu points FFT, Blackman-Harris)   SFDR must be >= %.0f dB\n", FFT_SIZE, SFDR_MIN_DB);
+        printf("%10s %14s %15s %13s %14s\n", "freq Hz", "legacy SFDR", "legacy SINAD", "SFDR", "SINAD");
+        for (size_t i = 0; i < sinePurity.size(); i++)
+            printf("%10.1f %11.1f dB %12.1f dB %10.1f dB %11.1f dB\n", sinePurity[i].frequency, legacyPurity[i].sfdr_db,
+                   legacyPurity[i].sinad_db, sinePurity[i].sfdr_db, sinePurity[i].sinad_db);
+
+        printf("\nharmonics (3rd harmonic vs fundamental, tolerance %.1f dB)\n", HARMONIC_TOLERANCE_DB);
+        for (const Harmonic& h : harmonics)
+            printf("%10s : %7.2f dB (theory %7.2f dB)\n", h.name, h.measured_db, h.expected_db);
+
+        printf("\n%-16s %12s %12s %7s %10s %5s\n", "sequence", "expected ms", "played ms", "peak", "end level", "");
+        for (const SequenceCheck& c : sequenceChecks)
+            printf("%-16s %12.2f %12.2f %7d %9.2f%% %5s\n", c.name.c_str(), c.expected_ms, c.played_ms, c.peak, c.end_level * 100,
+                   c.ok ? "ok" : "FAIL");
+
+        printf("\n%-22s %10s %12s\n", "generator", "ns/sample", "cycles/smp");
+        for (const Cost& c : costs)
+            printf("%-22s %10.3f %12.2f\n", c.name.c_str(), c.ns_per_sample, c.cycles_per_sample);
+        printf("\nchecks : %s\n", failed ? "FAILED" : "ok");
+    }
+    return failed ? 2 : 0;
+}
@@ -0,0 +1,452 @@
+/**
+ * Text engine (ui/Font.hpp, ui/TextCache.hpp, Draw::Text() / Draw::TextScroll()) against the previous glyph renderer.
+ *
+ * - golden : random strings (short and long enough to wrap or to skip the cache, any character) drawn at random
+ *   positions (on and off screen, negative coordinates), both colors, opaque and transparent, safe and unsafe modes,
+ *   over random pixels, must give the same panel bytes as the previous Draw::Text() (a pixel per font bit). The same
+ *   for the narrow font against a reference trimming the glyphs pixel by pixel, and for scrolling text against the
+ *   reference drawn at every loop position and clipped to its window. Drawn twice (cache miss, then hit).
+ * - widths : Draw::GetTextWidth() against the sum of the glyph widths
+ * - timing : glyphs per ms of the previous renderers (safe : a pixel at a time, unsafe : glyph transposed at each
+ *   draw) against the text engine, without the cache (cleared before each string) and with it ; then us per frame of
+ *   text-only menus (the Logs and Info screens)
+ *
+ * Exits with 2 if a check fails.
+ *
+ * Usage : bench_text [--json]
+ */
+#include "common/config.hpp"
+#include "drivers/ScreenDriver.hpp"
+#include "ui/Draw.hpp"
+#include "ui/Font.hpp"
+#include "ui/TextCache.hpp"
+#include "ui/font8x8_basic.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t SEED = 0x360;
+constexpr size_t FRAME_SIZE = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
+
+/** REFERENCES **/
+
+// Draw::Text() before the text engine, one pixel per font bit (the safe mode branch), uint16_t coordinates wrapping
+// like in the menus. The previous safe mode painted the background even when transparent, fixed in the text engine.
+namespace Reference
+{
+    static void pixel(uint16_t x, uint16_t y, bool c)
+    {
+        if (x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) return;
+        uint8_t& byte = ScreenDriver::info.data[(y / 8) * SCREEN_WIDTH + x];
+        byte = c ? byte | (1 << (y % 8)) : byte & ~(1 << (y % 8));
+    }
+
+    /// @brief Glyph of the basic font, trimmed for the narrow font (first column and width)
+    static void glyph_bounds(uint8_t c, bool narrow, uint8_t& first, uint8_t& width)
+    {
+        first = 0;
+        width = 8;
+        if (!narrow) return;
+        int left = -1, right = -1;
+        for (int k = 0; k < 8; k++)
+        {
+            bool used = false;
+            for (int j = 0; j < 8; j++) used |= (font8x8_basic[c][j] >> k) & 1;
+            if (!used) continue;
+            if (left < 0) left = k;
+            right = k;
+        }
+        if (left < 0) width = 3;
+        else
+        {
+            first = left;
+            width = right - left + 1;
+        }
+    }
+
+    /// @brief Paint a glyph, only its columns in [clip_left, clip_right)
+    static void glyph(uint16_t x, uint16_t y, uint8_t c, bool color, bool transparent, bool narrow, int clip_left,
+                      int clip_right)
+    {
+        if (c >= 128) c = 0;
+        uint8_t first, width;
+        glyph_bounds(c, narrow, first, width);
+        for (uint16_t j = 0; j < 8; j++)
+        {
+            for (uint16_t k = 0; k < width; k++)
+            {
+                int column = static_cast<int16_t>(static_cast<uint16_t>(x + k));
+                if (column < clip_left || column >= clip_right) continue;
+                bool active = first + k < 8 && (font8x8_basic[c][j] & (1 << (first + k)));
+                if (!transparent || active) pixel(x + k, y + j, active ? color : !color);
+            }
+        }
+    }
+
+    static void text(uint16_t x, uint16_t y, const char* text, bool color, bool transparent, bool narrow)
+    {
+        uint16_t x_coord = x;
+        while (*text)
+        {
+            uint8_t c = *text++;
+            if (c >= 128) c = 0;
+            glyph(x_coord, y, c, color, transparent, narrow, INT32_MIN, INT32_MAX);
+            uint8_t first, width;
+            glyph_bounds(c, narrow, first, width);
+            uint16_t glyph_end = x_coord + width;
+            x_coord += width + (narrow ? 1 : 0);
+            if (x_coord >= SCREEN_WIDTH)
+            {
+                x_coord = x;
+                y += 8 + 2;
+            }
+            else if (narrow && *text && !transparent)
+            {
+                // blank column before the next glyph of the line
+                for (uint16_t j = 0; j < 8; j++) pixel(glyph_end, y + j, !color);
+            }
+        }
+    }
+
+    static uint16_t width(const char* text, bool narrow)
+    {
+        uint16_t width = 0;
+        for (const char* c = text; *c; c++)
+        {
+            uint8_t first, glyph_width;
+            glyph_bounds(static_cast<uint8_t>(*c) >= 128 ? 0 : *c, narrow, first, glyph_width);
+            width += glyph_width + (narrow ? 1 : 0);
+        }
+        return *text && narrow ? width - 1 : width;
+    }
+
+    static void scroll(uint16_t x, uint16_t y, uint16_t w, const char* text, uint32_t offset, bool color,
+                       bool transparent, bool narrow)
+    {
+        uint16_t text_width = width(text, narrow);
+        int right = x + w;
+        auto line = [&](int start) {
+            int x_coord = start;
+            for (const char* c = text; *c; c++)
+            {
+                uint8_t code = static_cast<uint8_t>(*c) >= 128 ? 0 : *c;
+                uint8_t first, glyph_width;
+                glyph_bounds(code, narrow, first, glyph_width);
+                glyph(x_coord, y, code, color, true, narrow, x, right);
+                x_coord += glyph_width + (narrow ? 1 : 0);
+            }
+        };
+        if (text_width <= w)
+        {
+            if (!transparent)
+            {
+                for (int i = x; i < x + text_width; i++)
+                    for (int j = 0; j < 8; j++) pixel(i, y + j, !color);
+            }
+            line(x);
+            return;
+        }
+        if (!transparent)
+        {
+            for (int i = x; i < right; i++)
+                for (int j = 0; j < 8; j++) pixel(i, y + j, !color);
+        }
+        uint32_t period = text_width + TEXT_SCROLL_GAP;
+        for (int start = x - static_cast<int>(offset % period); start < right; start += period) line(start);
+    }
+}
+
+// Draw::Text() before the text engine, unsafe mode : each glyph transposed to panel columns at each draw
+namespace Previous
+{
+    static void text(uint16_t x, uint16_t y, const char* text, bool color, bool transparent_bg)
+    {
+        uint16_t x_coord = x;
+        while (*text)
+        {
+            uint8_t c = *text++;
+            uint8_t columns[8] = {0};
+            for (uint16_t j = 0; j < 8; j++)
+            {
+                uint8_t row_bits = font8x8_basic[c][j];
+                for (uint16_t k = 0; k < 8; k++)
+                {
+                    columns[k] |= ((row_bits >> k) & 1) << j;
+                }
+            }
+
+            ScreenDriver::MarkDirty(x_coord, y, 8, 8);
+            uint16_t shift = y % ScreenDriver::PAGE_HEIGHT;
+            uint8_t* page_ptr = &ScreenDriver::info.data[(y / ScreenDriver::PAGE_HEIGHT) * ScreenDriver::info.width + x_coord];
+            for (uint16_t part = 0; part < (shift == 0 ? 1 : 2); part++)
+            {
+                uint8_t mask = part == 0 ? 0xFF << shift : 0xFF >> (ScreenDriver::PAGE_HEIGHT - shift);
+                for (uint16_t k = 0; k < 8; k++)
+                {
+                    uint8_t bits = part == 0 ? columns[k] << shift : columns[k] >> (ScreenDriver::PAGE_HEIGHT - shift);
+                    uint8_t painted = transparent_bg ? bits : mask;
+                    uint8_t value = color ? bits : ~bits;
+                    page_ptr[k] = (page_ptr[k] & ~painted) | (value & painted);
+                }
+                page_ptr += ScreenDriver::info.width;
+            }
+
+            x_coord += 8;
+            if (x_coord >= ScreenDriver::info.width)
+            {
+                x_coord = x;
+                y += 8 + 2;
+            }
+        }
+    }
+}
+
+/** GOLDEN **/
+
+struct Golden
+{
+    uint32_t draws;
+    uint32_t mismatches;
+    uint32_t width_mismatches;
+};
+
+static std::string random_text(std::mt19937& rng)
+{
+    static const char printable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789 .,:;!?-+/()[]{}<>=_#%&*'\"|~";
+    size_t length = rng() % 4 == 0 ? rng() % 48 : rng() % 12;
+    std::string text;
+    for (size_t i = 0; i < length; i++)
+    {
+        // mostly printable, some control characters and bytes past the font
+        uint32_t kind = rng() % 16;
+        if (kind == 0) text += static_cast<char>(1 + rng() % 31);
+        else if (kind == 1) text += static_cast<char>(128 + rng() % 128);
+        else text += printable[rng() % (sizeof(printable) - 1)];
+    }
+    return text;
+}
+
+static bool compare(const uint8_t* expected, const char* what, const std::string& text, int x, int y, Golden& golden)
+{
+    golden.draws++;
+    if (memcmp(expected, ScreenDriver::info.data, FRAME_SIZE) == 0) return true;
+    if (golden.mismatches++ == 0)
+    {
+        fprintf(stderr, "golden : %s \"%s\" at (%d, %d) differs\n", what, text.c_str(), x, y);
+    }
+    return false;
+}
+
+static Golden run_golden()
+{
+    std::mt19937 rng(SEED);
+    Golden golden = {};
+    std::vector<uint8_t> background(FRAME_SIZE), expected(FRAME_SIZE);
+    TextCache& cache = Draw::GetTextCache();
+
+    for (int i = 0; i < 20000; i++)
+    {
+        std::string text = random_text(rng);
+        bool safe = i % 2 == 1;
+        bool narrow = i % 3 == 2;
+        bool color = rng() & 1;
+        bool transparent = rng() & 1;
+        const Font& font = narrow ? Fonts::Narrow : Fonts::Basic;
+        for (uint8_t& b : background) b = static_cast<uint8_t>(rng());
+
+        uint16_t x, y;
+        if (safe)
+        {
+            // up to 24 pixels outside on each side, negative values wrap like in the menus
+            x = static_cast<uint16_t>(static_cast<int>(rng() % (SCREEN_WIDTH + 48)) - 24);
+            y = static_cast<uint16_t>(static_cast<int>(rng() % (SCREEN_HEIGHT + 48)) - 24);
+        }
+        else
+        {
+            // unsafe mode : one line on screen
+            uint16_t text_width = Reference::width(text.c_str(), narrow);
+            if (text_width > SCREEN_WIDTH) text.resize(text.size() * SCREEN_WIDTH / text_width / 2);
+            text_width = Reference::width(text.c_str(), narrow);
+            x = rng() % (SCREEN_WIDTH - text_width + 1);
+            y = rng() % (SCREEN_HEIGHT - 8 + 1);
+        }
+
+        memcpy(ScreenDriver::info.data, background.data(), FRAME_SIZE);
+        Reference::text(x, y, text.c_str(), color, transparent, narrow);
+        memcpy(expected.data(), ScreenDriver::info.data, FRAME_SIZE);
+
+        if (i % 5 == 0) cache.clear();
+        for (int pass = 0; pass < 2; pass++) // miss (or uncached), then hit
+        {
+            memcpy(ScreenDriver::info.data, background.data(), FRAME_SIZE);
+            if (safe) Draw::Text<true>(x, y, text.c_str(), color, transparent, font);
+            else Draw::Text<false>(x, y, text.c_str(), color, transparent, font);
+            if (!compare(expected.data(), safe ? "safe text" : "text", text, static_cast<int16_t>(x), static_cast<int16_t>(y), golden)) break;
+        }
+
+        if (Draw::GetTextWidth(text.c_str(), font) != Reference::width(text.c_str(), narrow)) golden.width_mismatches++;
+
+        // scrolling text, in a window on screen
+        uint16_t w = 8 + rng() % (SCREEN_WIDTH - 8);
+        uint16_t sx = rng() % (SCREEN_WIDTH - w + 1);
+        uint16_t sy = rng() % (SCREEN_HEIGHT - 8 + 1);
+        uint32_t offset = rng() % 2000;
+        memcpy(ScreenDriver::info.data, background.data(), FRAME_SIZE);
+        Reference::scroll(sx, sy, w, text.c_str(), offset, color, transparent, narrow);
+        memcpy(expected.data(), ScreenDriver::info.data, FRAME_SIZE);
+        memcpy(ScreenDriver::info.data, background.data(), FRAME_SIZE);
+        if (safe) Draw::TextScroll<true>(sx, sy, w, text.c_str(), offset, color, transparent, font);
+        else Draw::TextScroll<false>(sx, sy, w, text.c_str(), offset, color, transparent, font);
+        compare(expected.data(), "scroll", text, sx, sy, golden);
+    }
+    return golden;
+}
+
+/** TIMING **/
+
+static const char* const SAMPLE_TEXTS[] = {
+    "TNY-360", "Firmware version", "192.168.4.1", "Mode: AP", "[I] WiFi ready", "Battery 7.4V", "Are you sure?", "Back",
+};
+constexpr size_t SAMPLE_COUNT = sizeof(SAMPLE_TEXTS) / sizeof(SAMPLE_TEXTS[0]);
+
+template <typename F>
+static double glyphs_per_ms(F&& draw)
+{
+    size_t glyphs = 0;
+    for (const char* text : SAMPLE_TEXTS) glyphs += strlen(text);
+    const int rounds = 20000;
+    Clock::time_point start = Clock::now();
+    for (int round = 0; round < rounds; round++)
+    {
+        for (size_t i = 0; i < SAMPLE_COUNT; i++) draw(SAMPLE_TEXTS[i], (round + i * 9) % (SCREEN_HEIGHT - 8));
+    }
+    double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    return glyphs * rounds / ms;
+}
+
+template <typename F>
+static double us_per_frame(F&& frame)
+{
+    const int frames = 20000;
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < frames; i++) frame(i);
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / frames;
+}
+
+struct Timing
+{
+    double reference_safe;
+    double previous;
+    double uncached;
+    double cached;
+    double cached_safe;
+    double narrow_cached;
+    double logs_previous_us;
+    double logs_us;
+    double info_previous_us;
+    double info_us;
+    TextCache::Stats stats;
+};
+
+static Timing run_timing()
+{
+    Timing t = {};
+    TextCache& cache = Draw::GetTextCache();
+    t.reference_safe = glyphs_per_ms([](const char* s, uint16_t y) { Reference::text(0, y, s, true, false, false); });
+    t.previous = glyphs_per_ms([](const char* s, uint16_t y) { Previous::text(0, y, s, true, false); });
+    t.uncached = glyphs_per_ms([&](const char* s, uint16_t y) { cache.clear(); Draw::Text<false>(0, y, s); });
+    cache.clear();
+    cache.resetStats();
+    t.cached = glyphs_per_ms([](const char* s, uint16_t y) { Draw::Text<false>(0, y, s); });
+    t.stats = cache.getStats();
+    t.cached_safe = glyphs_per_ms([](const char* s, uint16_t y) { Draw::Text<true>(0, y, s); });
+    t.narrow_cached = glyphs_per_ms([](const char* s, uint16_t y) {
+        Draw::Text<false>(0, y, s, ScreenDriver::COLOR_WHITE, false, Fonts::Narrow);
+    });
+
+    // text part of the Logs menu (4 lines) and of the Info menu, as drawn at each render
+    static const char* const logs[] = { "[I] WiFi ready", "[W] Battery low", "[I] IMU ok", "[E] I2C timeout" };
+    t.logs_previous_us = us_per_frame([](int) {
+        ScreenDriver::Clear();
+        Previous::text(48, 0, "Logs", true, false);
+        for (int i = 0; i < 4; i++) Previous::text(0, 12 + i * 12 + 4, logs[i], true, false);
+    });
+    t.logs_us = us_per_frame([](int) {
+        ScreenDriver::Clear();
+        Draw::Text(48, 0, "Logs");
+        for (int i = 0; i < 4; i++) Draw::Text(0, 12 + i * 12 + 4, logs[i]);
+    });
+    t.info_previous_us = us_per_frame([](int) {
+        ScreenDriver::Clear();
+        Previous::text(48, 0, "Info", true, false);
+        Previous::text(0, 14, "Firmware version", true, false);
+        Previous::text(0, 24, "v1.0.0", true, false);
+    });
+    t.info_us = us_per_frame([](int) {
+        ScreenDriver::Clear();
+        Draw::Text(48, 0, "Info");
+        Draw::Text(0, 14, "Firmware version");
+        Draw::Text(0, 24, "v1.0.0");
+    });
+    return t;
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (ScreenDriver::Init() != Status::Ok)
+    {
+        fprintf(stderr, "Failed to init the screen driver\n");
+        return 1;
+    }
+
+    Golden golden = run_golden();
+    bool failed = golden.mismatches > 0 || golden.width_mismatches > 0;
+    Timing t = run_timing();
+
+    if (json)
+    {
+        printf("{\"golden\": {\"draws\": %u, \"mismatches\": %u, \"width_mismatches\": %u},\n", golden.draws,
+               golden.mismatches, golden.width_mismatches);
+        printf(" \"glyphs_per_ms\": {\"previous_safe\": %.0f, \"previous\": %.0f, \"uncached\": %.0f, \"cached\": %.0f, "
+               "\"cached_safe\": %.0f, \"narrow_cached\": %.0f},\n",
+               t.reference_safe, t.previous, t.uncached, t.cached, t.cached_safe, t.narrow_cached);
+        printf(" \"cache\": {\"hits\": %u, \"misses\": %u, \"evictions\": %u, \"uncached\": %u},\n", t.stats.hits,
+               t.stats.misses, t.stats.evictions, t.stats.uncached);
+        printf(" \"frame_us\": {\"logs_previous\": %.3f, \"logs\": %.3f, \"info_previous\": %.3f, \"info\": %.3f}}\n",
+               t.logs_previous_us, t.logs_us, t.info_previous_us, t.info_us);
+    }
+    else
+    {
+        printf("golden : %s (%u draws, %u different) ; widths %s\n\n", golden.mismatches ? "FAILED" : "ok", golden.draws,
+               golden.mismatches, golden.width_mismatches ? "FAILED" : "ok");
+        printf("%-28s %12s\n", "renderer", "glyphs/ms");
+        printf("%-28s %12.0f\n", "previous, safe (pixels)", t.reference_safe);
+        printf("%-28s %12.0f\n", "previous, unsafe", t.previous);
+        printf("%-28s %12.0f\n", "engine, cache cleared", t.uncached);
+        printf("%-28s %12.0f\n", "engine, cached", t.cached);
+        printf("%-28s %12.0f\n", "engine, cached, safe", t.cached_safe);
+        printf("%-28s %12.0f\n", "engine, cached, narrow font", t.narrow_cached);
+        printf("\ncache : %u hits, %u misses, %u evictions\n", t.stats.hits, t.stats.misses, t.stats.evictions);
+        printf("\n%-8s %12s %12s\n", "frame", "previous us", "engine us");
+        printf("%-8s %12.3f %12.3f\n", "Logs", t.logs_previous_us, t.logs_us);
+        printf("%-8s %12.3f %12.3f\n", "Info", t.info_previous_us, t.info_us);
+    }
+
+    return failed ? 2 : 0;
+}
@@ -0,0 +1,537 @@
+/**
+ * Vision (vision/JpegThumbnail.hpp, vision/MotionAnalyzer.hpp) : JPEG thumbnails checks, motion analysis of image
+ * sequences, and the cost of both per frame.
+ *
+ * - thumbnails (needs libjpeg) : frames encoded by libjpeg (4:2:2 like the OV2640, 4:2:0, grayscale, restart intervals,
+ *   sizes that aren't a multiple of the MCU) decoded to thumbnails, against the 1/8 scaled decode of libjpeg (also made
+ *   from the DC coefficients) and the 8x8 block means of the source. Truncated and progressive frames are refused
+ * - scenes : QVGA sequences of a textured scene at 10 fps, synthesized with sensor noise : still, an object moving on
+ *   the left / on the right, exposure ramp, camera pan, camera going up (robot lifted), walk bobbing, lens covered.
+ *   Each must raise its events and no other (the `left` scene also goes through JPEG frames when libjpeg is there)
+ * - `--images dir` : analysis of a recorded sequence (binary PGM files, in name order), printing the flow, motion and
+ *   events of each frame
+ * - timing : thumbnail of a VGA frame (against the 1/8 scaled decode of libjpeg) and analysis, in ms per frame
+ *
+ * The tool exits with 2 if a check fails.
+ *
+ * Usage : bench_vision [--json] [--images dir]
+ */
+#include "vision/JpegThumbnail.hpp"
+#include "vision/MotionAnalyzer.hpp"
+#include "Check.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <random>
+#include <string>
+#include <vector>
+#if HAVE_LIBJPEG
+#include <jpeglib.h>
+#endif
+
+constexpr uint32_t SEED = 0x360;
+constexpr int64_t FRAME_US = static_cast<int64_t>(1e6f / VISION_FRAME_RATE);
+constexpr int SCENE_FRAMES = 40;
+
+struct Image
+{
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> pixels;
+};
+
+/// @brief Textured scene seen by the camera : a few slanted waves, an optional dark disc, exposure and sensor noise
+struct Scene
+{
+    struct Wave { double fx, fy, phase, amplitude; };
+    std::vector<Wave> waves;
+
+    explicit Scene(uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> period(30.0, 100.0), angle(0.0, 2 * M_PI), amplitude(10.0, 16.0);
+        for (int i = 0; i < 6; i++)
+        {
+            double p = period(rng), a = angle(rng);
+            waves.push_back({ cos(a) / p, sin(a) / p, angle(rng), amplitude(rng) });
+        }
+    }
+
+    double background(double x, double y) const
+    {
+        double value = 128.0;
+        for (const Wave& w : waves) value += w.amplitude * sin(2 * M_PI * (w.fx * x + w.fy * y) + w.phase);
+        return value;
+    }
+
+    /**
+     * @param camera_x, camera_y Camera position, the scene moves the other way in the image
+     * @param object_x Center of the disc in image pixels, negative for none
+     */
+    Image render(int width, int height, double camera_x, double camera_y, double object_x, double object_y,
+                 double exposure, double noise, std::mt19937& rng) const
+    {
+        constexpr double OBJECT_RADIUS = 32.0;
+        std::normal_distribution<double> sensor(0.0, noise);
+        Image image { width, height, std::vector<uint8_t>(width * height) };
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                double value = background(x + camera_x, y + camera_y);
+                if (object_x >= 0 && (x - object_x) * (x - object_x) + (y - object_y) * (y - object_y) < OBJECT_RADIUS * OBJECT_RADIUS)
+                    value = 40.0;
+                value = value * exposure + (noise > 0 ? sensor(rng) : 0.0);
+                image.pixels[y * width + x] = static_cast<uint8_t>(std::clamp(std::lround(value), 0L, 255L));
+            }
+        }
+        return image;
+    }
+};
+
+/// @brief Means of the 8x8 blocks, edge pixels repeated in the partial blocks (like the JPEG encoders pad)
+static Image block_means(const Image& image)
+{
+    Image means { (image.width + 7) / 8, (image.height + 7) / 8, {} };
+    means.pixels.resize(means.width * means.height);
+    for (int by = 0; by < means.height; by++)
+    {
+        for (int bx = 0; bx < means.width; bx++)
+        {
+            int sum = 0;
+            for (int y = 0; y < 8; y++)
+                for (int x = 0; x < 8; x++)
+                    sum += image.pixels[std::min(by * 8 + y, image.height - 1) * image.width + std::min(bx * 8 + x, image.width - 1)];
+            means.pixels[by * means.width + bx] = static_cast<uint8_t>((sum + 32) / 64);
+        }
+    }
+    return means;
+}
+
+#if HAVE_LIBJPEG
+/**
+ * @brief Encode a grayscale image as YCbCr (neutral chroma) or grayscale JPEG.
+ * @param h, v Sampling factors of the luma (chroma at 1x1), 0 for a grayscale JPEG
+ * @param restart Restart interval in MCUs (0 for none)
+ */
+static std::vector<uint8_t> encode(const Image& image, int quality, int h, int v, int restart, bool progressive = false)
+{
+    jpeg_compress_struct cinfo;
+    jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_compress(&cinfo);
+    unsigned char* buffer = nullptr;
+    unsigned long size = 0;
+    jpeg_mem_dest(&cinfo, &buffer, &size);
+
+    cinfo.image_width = image.width;
+    cinfo.image_height = image.height;
+    cinfo.input_components = h ? 3 : 1;
+    cinfo.in_color_space = h ? JCS_RGB : JCS_GRAYSCALE;
+    jpeg_set_defaults(&cinfo);
+    jpeg_set_quality(&cinfo, quality, TRUE);
+    if (h)
+    {
+        cinfo.comp_info[0].h_samp_factor = h;
+        cinfo.comp_info[0].v_samp_factor = v;
+    }
+    cinfo.restart_interval = restart;
+    if (progressive) jpeg_simple_progression(&cinfo);
+    jpeg_start_compress(&cinfo, TRUE);
+
+    std::vector<uint8_t> row(image.width * cinfo.input_components);
+    while (cinfo.next_scanline < cinfo.image_height)
+    {
+        const uint8_t* source = &image.pixels[cinfo.next_scanline * image.width];
+        for (int x = 0; x < image.width; x++)
+            for (int c = 0; c < cinfo.input_components; c++) row[x * cinfo.input_components + c] = source[x];
+        JSAMPROW rows[1] = { row.data() };
+        jpeg_write_scanlines(&cinfo, rows, 1);
+    }
+    jpeg_finish_compress(&cinfo);
+    std::vector<uint8_t> jpeg(buffer, buffer + size);
+    jpeg_destroy_compress(&cinfo);
+    free(buffer);
+    return jpeg;
+}
+
+/// @brief Luma of a JPEG decoded by libjpeg at 1/8 scale (DC only as well)
+static Image decode_eighth(const std::vector<uint8_t>& jpeg)
+{
+    jpeg_decompress_struct cinfo;
+    jpeg_error_mgr jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, jpeg.data(), jpeg.size());
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = 8;
+    cinfo.out_color_space = JCS_GRAYSCALE;
+    jpeg_start_decompress(&cinfo);
+    Image image { static_cast<int>(cinfo.output_width), static_cast<int>(cinfo.output_height), {} };
+    image.pixels.resize(image.width * image.height);
+    while (cinfo.output_scanline < cinfo.output_height)
+    {
+        JSAMPROW rows[1] = { &image.pixels[cinfo.output_scanline * image.width] };
+        jpeg_read_scanlines(&cinfo, rows, 1);
+    }
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    return image;
+}
+
+static int max_difference(const Image& a, const uint8_t* b)
+{
+    int worst = 0;
+    for (size_t i = 0; i < a.pixels.size(); i++) worst = std::max(worst, std::abs(a.pixels[i] - b[i]));
+    return worst;
+}
+
+static void run_thumbnail_checks()
+{
+    Scene scene(SEED);
+    std::mt19937 rng(SEED);
+    struct Case { const char* name; int width, height, h, v, restart, quality; };
+    const Case cases[] = {
+        { "4:2:2 VGA", 640, 480, 2, 1, 0, 80 },
+        { "4:2:2 QVGA restarts", 320, 240, 2, 1, 3, 60 },
+        { "4:2:0 odd size", 324, 236, 2, 2, 0, 90 },
+        { "4:4:4 restarts", 200, 152, 1, 1, 7, 75 },
+        { "grayscale odd size", 165, 123, 0, 0, 5, 85 },
+    };
+    uint8_t thumbnail[VISION_MAX_THUMBNAIL_WIDTH * VISION_MAX_THUMBNAIL_HEIGHT];
+    for (const Case& c : cases)
+    {
+        Image image = scene.render(c.width, c.height, 0, 0, c.width / 3.0, c.height / 2.0, 1.0, 3.0, rng);
+        std::vector<uint8_t> jpeg = encode(image, c.quality, c.h, c.v, c.restart);
+        std::string name = c.name;
+
+        uint16_t width = 0, height = 0;
+        check(JpegThumbnail::GetSize(jpeg.data(), jpeg.size(), width, height) == Status::Ok, ("size : " + name).c_str());
+        check(width == (c.width + 7) / 8 && height == (c.height + 7) / 8, ("size : " + name).c_str());
+        Status err = JpegThumbnail::Decode(jpeg.data(), jpeg.size(), thumbnail, sizeof(thumbnail), width, height);
+        check(err == Status::Ok, ("decode : " + name).c_str());
+        if (err != Status::Ok) continue;
+
+        Image reference = decode_eighth(jpeg);
+        Image means = block_means(image);
+        check(reference.width == width && reference.height == height, ("libjpeg 1/8 size : " + name).c_str());
+        check(max_difference(reference, thumbnail) <= 1, ("against libjpeg 1/8 : " + name).c_str());
+        check(max_difference(means, thumbnail) <= 3, ("against the block means : " + name).c_str());
+
+        // cut in the entropy coded data
+        std::vector<uint8_t> truncated(jpeg.begin(), jpeg.begin() + jpeg.size() / 2);
+        check(JpegThumbnail::Decode(truncated.data(), truncated.size(), thumbnail, sizeof(thumbnail), width, height) == Status::InvalidParameters,
+              ("truncated refused : " + name).c_str());
+    }
+
+    Image image = scene.render(640, 480, 0, 0, -1, 0, 1.0, 3.0, rng);
+    std::vector<uint8_t> jpeg = encode(image, 80, 2, 1, 0, true);
+    uint16_t width, height;
+    check(JpegThumbnail::Decode(jpeg.data(), jpeg.size(), thumbnail, sizeof(thumbnail), width, height) == Status::InvalidParameters, "progressive refused");
+    jpeg = encode(image, 80, 2, 1, 0);
+    check(JpegThumbnail::Decode(jpeg.data(), jpeg.size(), thumbnail, 40 * 30, width, height) == Status::OutOfBounds, "small buffer refused");
+    const uint8_t garbage[] = { 0xFF, 0xD8, 0xFF, 0xC0, 0x00 };
+    check(JpegThumbnail::Decode(garbage, sizeof(garbage), thumbnail, sizeof(thumbnail), width, height) == Status::InvalidParameters, "garbage refused");
+}
+#endif
+
+/// @brief Frames of a synthesized sequence
+struct SceneRun
+{
+    const char* name;
+    std::vector<MotionAnalyzer::Event> expected; // events to raise (each at least once), no other
+    // camera position, object position (x < 0 for none), exposure and the frame index
+    void (*frame)(int i, double& camera_x, double& camera_y, double& object_x, double& object_y, double& exposure);
+    bool through_jpeg;
+};
+
+struct SceneResult
+{
+    std::string name;
+    std::vector<MotionAnalyzer::Event> events;
+    float mean_flow_x, mean_flow_y, max_motion;
+    bool passed;
+};
+
+static SceneResult run_scene(const SceneRun& run, const Scene& scene)
+{
+    std::mt19937 rng(SEED);
+    MotionAnalyzer analyzer;
+    SceneResult result { run.name, {}, 0, 0, 0, true };
+    uint8_t thumbnail[VISION_MAX_THUMBNAIL_WIDTH * VISION_MAX_THUMBNAIL_HEIGHT];
+    int valid = 0;
+    for (int i = 0; i < SCENE_FRAMES; i++)
+    {
+        double camera_x = 0, camera_y = 0, object_x = -1, object_y = 120, exposure = 1.0;
+        run.frame(i, camera_x, camera_y, object_x, object_y, exposure);
+        Image image = scene.render(320, 240, camera_x, camera_y, object_x, object_y, exposure, 3.0, rng);
+
+        uint16_t width, height;
+#if HAVE_LIBJPEG
+        if (run.through_jpeg)
+        {
+            std::vector<uint8_t> jpeg = encode(image, 75, 2, 1, 0);
+            if (JpegThumbnail::Decode(jpeg.data(), jpeg.size(), thumbnail, sizeof(thumbnail), width, height) != Status::Ok)
+            {
+                check(false, "scene through JPEG : decode");
+                result.passed = false;
+                return result;
+            }
+        }
+        else
+#endif
+        {
+            Image means = block_means(image);
+            memcpy(thumbnail, means.pixels.data(), means.pixels.size());
+            width = means.width;
+            height = means.height;
+        }
+
+        MotionAnalyzer::Result frame;
+        analyzer.process(thumbnail, width, height, i * FRAME_US, frame);
+        if (frame.event != MotionAnalyzer::Event::None) result.events.push_back(frame.event);
+        if (frame.valid)
+        {
+            valid++;
+            result.mean_flow_x += frame.flow_x;
+            result.mean_flow_y += frame.flow_y;
+            result.max_motion = std::max(result.max_motion, frame.motion);
+        }
+    }
+    if (valid)
+    {
+        result.mean_flow_x /= valid;
+        result.mean_flow_y /= valid;
+    }
+
+    for (MotionAnalyzer::Event event : run.expected)
+        if (std::find(result.events.begin(), result.events.end(), event) == result.events.end()) result.passed = false;
+    for (MotionAnalyzer::Event event : result.events)
+        if (std::find(run.expected.begin(), run.expected.end(), event) == run.expected.end()) result.passed = false;
+    check(result.passed, (std::string("scene events : ") + run.name).c_str());
+    return result;
+}
+
+static std::vector<SceneResult> run_scenes()
+{
+    using Event = MotionAnalyzer::Event;
+    Scene scene(SEED + 1);
+    // grid pixels (1/8 of the frame) per frame
+    const SceneRun runs[] = {
+        { "still", {}, [](int, double&, double&, double&, double&, double&) {}, false },
+        { "left", { Event::MotionLeft },
+          [](int i, double&, double&, double& ox, double&, double&) { if (i >= 10 && i < 30) ox = 60 + 30 * sin(i * 0.6); }, true },
+        { "right", { Event::MotionRight },
+          [](int i, double&, double&, double& ox, double& oy, double&) { if (i >= 10 && i < 30) { ox = 260 - 3 * (i - 10); oy = 100 + 40 * sin(i * 0.7); } }, false },
+        { "exposure", {}, [](int i, double&, double&, double&, double&, double& e) { e = 1.0 + 0.3 * std::min(i, 20) / 20.0; }, false },
+        { "pan", {}, [](int i, double& cx, double&, double&, double&, double&) { cx = 12.0 * i; }, false },
+        { "lifted", { Event::Lifted },
+          [](int i, double&, double& cy, double&, double&, double&) { if (i >= 15) cy = -10.0 * std::min(i - 15, 8); }, false },
+        { "bobbing", {}, [](int i, double& cx, double& cy, double&, double&, double&) { cy = 4.0 * sin(i * 2 * M_PI * 2.0 / VISION_FRAME_RATE); cx = 2.0 * sin(i * 0.9); }, false },
+        { "covered", { Event::Covered }, [](int i, double&, double&, double&, double&, double& e) { if (i >= 15) e = 0.05; }, false },
+    };
+
+    std::vector<SceneResult> results;
+    for (const SceneRun& run : runs)
+    {
+#if !HAVE_LIBJPEG
+        if (run.through_jpeg)
+        {
+            SceneRun plain = run;
+            plain.through_jpeg = false;
+            results.push_back(run_scene(plain, scene));
+            continue;
+        }
+#endif
+        results.push_back(run_scene(run, scene));
+    }
+
+    // flow of the pan (12 px to the right per frame : scene moves 1.5 grid px to the left) and of the lift (down)
+    for (const SceneResult& result : results)
+    {
+        if (result.name == "pan") check(std::fabs(result.mean_flow_x + 1.5f) < 0.2f && std::fabs(result.mean_flow_y) < 0.2f, "pan : flow");
+        if (result.name == "still") check(result.max_motion < VISION_MOTION_MIN, "still : no motion");
+        if (result.name == "exposure") check(result.max_motion < VISION_MOTION_MIN, "exposure : no motion");
+    }
+    return results;
+}
+
+static bool read_pgm(const std::string& path, Image& image)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) return false;
+    int max_value = 0;
+    bool ok = fscanf(file, "P5 %d %d %d", &image.width, &image.height, &max_value) == 3 && max_value == 255 && fgetc(file) != EOF
+              && image.width > 0 && image.height > 0;
+    if (ok)
+    {
+        image.pixels.resize(image.width * image.height);
+        ok = fread(image.pixels.data(), 1, image.pixels.size(), file) == image.pixels.size();
+    }
+    fclose(file);
+    return ok;
+}
+
+static int run_images(const char* directory, bool json)
+{
+    std::vector<std::string> names;
+    if (DIR* dir = opendir(directory))
+    {
+        while (dirent* entry = readdir(dir))
+        {
+            std::string name = entry->d_name;
+            if (name.size() > 4 && name.compare(name.size() - 4, 4, ".pgm") == 0) names.push_back(name);
+        }
+        closedir(dir);
+    }
+    if (names.empty())
+    {
+        fprintf(stderr, "no .pgm file in %s\n", directory);
+        return 1;
+    }
+    std::sort(names.begin(), names.end());
+
+    MotionAnalyzer analyzer;
+    if (json) printf("{\"frames\": [\n");
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        Image image;
+        if (!read_pgm(std::string(directory) + "/" + names[i], image))
+        {
+            fprintf(stderr, "can't read %s (binary PGM, 8 bits)\n", names[i].c_str());
+            return 1;
+        }
+        // full frames are reduced like the thumbnails are
+        if (image.width > VISION_MAX_THUMBNAIL_WIDTH || image.height > VISION_MAX_THUMBNAIL_HEIGHT) image = block_means(image);
+
+        MotionAnalyzer::Result r;
+        analyzer.process(image.pixels.data(), image.width, image.height, i * FRAME_US, r);
+        if (json)
+            printf("  {\"file\": \"%s\", \"flow_x\": %.2f, \"flow_y\": %.2f, \"motion\": %.3f, \"x\": %.2f, \"y\": %.2f, \"brightness\": %.0f, \"event\": \"%s\"}%s\n",
+                   names[i].c_str(), r.flow_x, r.flow_y, r.motion, r.x, r.y, r.brightness, MotionAnalyzer::EventName(r.event), i + 1 < names.size() ? "," : "");
+        else
+            printf("%-24s flow %+5.2f %+5.2f  motion %5.1f%% at %+5.2f %+5.2f  level %3.0f  %s\n", names[i].c_str(), r.flow_x, r.flow_y,
+                   r.motion * 100, r.x, r.y, r.brightness, r.event == MotionAnalyzer::Event::None ? "" : MotionAnalyzer::EventName(r.event));
+    }
+    if (json) printf("]}\n");
+    return 0;
+}
+
+struct Timing
+{
+    double thumbnail_ms = 0;
+    double libjpeg_eighth_ms = 0;
+    double analysis_ms = 0;
+    size_t jpeg_bytes = 0;
+};
+
+template <typename F>
+static double time_ms(int iterations, F f)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) f(i);
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / iterations;
+}
+
+static Timing run_timing()
+{
+    constexpr int FRAMES = 8;
+    constexpr int ITERATIONS = 200;
+    Scene scene(SEED + 2);
+    std::mt19937 rng(SEED);
+    std::vector<Image> thumbnails;
+    Timing timing;
+
+#if HAVE_LIBJPEG
+    std::vector<std::vector<uint8_t>> frames;
+    for (int i = 0; i < FRAMES; i++)
+    {
+        Image image = scene.render(640, 480, 6.0 * i, 0, 200 + 20 * i, 240, 1.0, 6.0, rng);
+        frames.push_back(encode(image, 80, 2, 1, 0));
+        timing.jpeg_bytes += frames.back().size();
+    }
+    timing.jpeg_bytes /= FRAMES;
+
+    uint8_t thumbnail[VISION_MAX_THUMBNAIL_WIDTH * VISION_MAX_THUMBNAIL_HEIGHT];
+    timing.thumbnail_ms = time_ms(ITERATIONS, [&](int i) {
+        uint16_t width, height;
+        JpegThumbnail::Decode(frames[i % FRAMES].data(), frames[i % FRAMES].size(), thumbnail, sizeof(thumbnail), width, height);
+    });
+    timing.libjpeg_eighth_ms = time_ms(ITERATIONS, [&](int i) { decode_eighth(frames[i % FRAMES]); });
+    for (const std::vector<uint8_t>& frame : frames) thumbnails.push_back(decode_eighth(frame));
+#else
+    for (int i = 0; i < FRAMES; i++)
+        thumbnails.push_back(block_means(scene.render(640, 480, 6.0 * i, 0, 200 + 20 * i, 240, 1.0, 6.0, rng)));
+#endif
+
+    MotionAnalyzer analyzer;
+    MotionAnalyzer::Result result;
+    timing.analysis_ms = time_ms(ITERATIONS * 10, [&](int i) {
+        const Image& image = thumbnails[i % FRAMES];
+        analyzer.process(image.pixels.data(), image.width, image.height, i * FRAME_US, result);
+    });
+    return timing;
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    const char* images = nullptr;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--images") == 0 && i + 1 < argc) images = argv[++i];
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--images dir]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (images) return run_images(images, json);
+
+#if HAVE_LIBJPEG
+    run_thumbnail_checks();
+    const bool jpeg_checks = true;
+#else
+    const bool jpeg_checks = false;
+#endif
+    std::vector<SceneResult> scenes = run_scenes();
+    Timing timing = run_timing();
+
+    auto events = [](const SceneResult& r) {
+        std::string text;
+        for (MotionAnalyzer::Event event : r.events) text += (text.empty() ? "" : ", ") + std::string(MotionAnalyzer::EventName(event));
+        return text;
+    };
+
+    if (json)
+    {
+        printf("{\"checks_failed\": %d, \"jpeg_checks\": %s, \"scenes\": [\n", check_failures, jpeg_checks ? "true" : "false");
+        for (size_t i = 0; i < scenes.size(); i++)
+        {
+            const SceneResult& r = scenes[i];
+            printf("  {\"scene\": \"%s\", \"passed\": %s, \"events\": \"%s\", \"flow_x\": %.2f, \"flow_y\": %.2f, \"max_motion\": %.3f}%s\n",
+                   r.name.c_str(), r.passed ? "true" : "false", events(r).c_str(), r.mean_flow_x, r.mean_flow_y, r.max_motion,
+                   i + 1 < scenes.size() ? "," : "");
+        }
+        printf("], \"vga_jpeg_bytes\": %zu, \"thumbnail_ms\": %.3f, \"libjpeg_eighth_ms\": %.3f, \"analysis_ms\": %.4f}\n",
+               timing.jpeg_bytes, timing.thumbnail_ms, timing.libjpeg_eighth_ms, timing.analysis_ms);
+    }
+    else
+    {
+        printf("checks    : %s (%d failed)%s\n\n", check_failures == 0 ? "ok" : "FAILED", check_failures, jpeg_checks ? "" : ", no libjpeg : thumbnails not checked");
+        printf("%-10s %-6s %8s %8s %8s  %s\n", "scene", "events", "flow x", "flow y", "motion", "raised");
+        for (const SceneResult& r : scenes)
+            printf("%-10s %-6s %8.2f %8.2f %7.1f%%  %s\n", r.name.c_str(), r.passed ? "ok" : "FAIL", r.mean_flow_x, r.mean_flow_y, r.max_motion * 100, events(r).c_str());
+        printf("\nper frame : ");
+        if (jpeg_checks)
+            printf("thumbnail of a VGA JPEG (%zu bytes) %.3f ms (libjpeg 1/8 scale : %.3f ms), ", timing.jpeg_bytes, timing.thumbnail_ms, timing.libjpeg_eighth_ms);
+        printf("analysis %.4f ms\n", timing.analysis_ms);
+    }
+    return check_exit_code();
+}
@@ -0,0 +1,656 @@
+/**
+ * Static files of the web interface (network/StaticAssets.hpp) : checks of the request resolution and cache validation,
+ * then page loads through a loopback HTTP/1.1 server against the previous WebInterface.
+ *
+ * - tree : the real web files (`data/web`, written by copy_web_assets.py with their manifest) when they are there,
+ *          otherwise a synthetic tree shaped like a Nuxt build (gzipped index and hashed scripts and styles in `_nuxt/`,
+ *          the build id, the favicon and 3D model of extras/WebPortal/public) with its manifest
+ * - server : one keep-alive connection at a time, like esp_http_server. `assets` answers with StaticAssets (ETag,
+ *            Cache-Control, 304, RAM cache hits sent with a Content-Length, misses in chunks from one buffer),
+ *            `legacy` like the previous WebInterface (no validator, every file read again in chunks, a buffer
+ *            allocated per request)
+ * - browser : loads every file of the tree on one connection, keeping the responses in its cache. A cold load starts
+ *             with an empty cache, a warm load reuses it : fresh immutable files aren't asked, the others are
+ *             revalidated with If-None-Match (a response without validator is always downloaded again)
+ *
+ * Every body is compared to the file on disk. The tool exits with 2 on any check failure, or if warm loads of the
+ * assets server don't transfer at least 10 times fewer bytes than its cold loads, or if the RAM cache gets no hit.
+ *
+ * Usage : bench_web_assets [--json] [--root dir] [--loads count] [--serve port]
+ */
+#include "network/StaticAssets.hpp"
+#include "Check.hpp"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+constexpr uint32_t SEED = 0x360;
+
+static std::string read_file(const fs::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static void write_file(const fs::path& path, const std::string& content)
+{
+    fs::create_directories(path.parent_path());
+    std::ofstream(path, std::ios::binary).write(content.data(), content.size());
+}
+
+/// @brief Content hash of the manifest (copy_web_assets.py keeps 16 hex digits of a SHA-256, any content hash works)
+static std::string content_hash(const std::string& content)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (unsigned char c : content) hash = (hash ^ c) * 0x100000001b3ull;
+    char text[17];
+    snprintf(text, sizeof(text), "%016llx", static_cast<unsigned long long>(hash));
+    return text;
+}
+
+static void write_manifest(const fs::path& root)
+{
+    std::vector<std::string> lines;
+    for (const auto& entry : fs::recursive_directory_iterator(root))
+    {
+        if (!entry.is_regular_file() || entry.path().filename() == fs::path(WEB_ASSETS_MANIFEST).filename()) continue;
+        lines.push_back("/" + fs::relative(entry.path(), root).generic_string() + " " + content_hash(read_file(entry.path())));
+    }
+    std::sort(lines.begin(), lines.end());
+    std::string manifest;
+    for (const std::string& line : lines) manifest += line + "\n";
+    write_file(root.string() + WEB_ASSETS_MANIFEST, manifest);
+}
+
+/// @brief Synthetic Nuxt build : random bytes stand for the gzipped files (the server never looks inside)
+static void make_tree(const fs::path& root)
+{
+    std::mt19937 rng(SEED);
+    auto bytes = [&rng](size_t size) {
+        std::string content(size, '\0');
+        for (char& c : content) c = static_cast<char>(rng());
+        return content;
+    };
+    auto hashed = [&rng]() {
+        char name[9];
+        snprintf(name, sizeof(name), "%08x", static_cast<unsigned>(rng()));
+        return std::string(name);
+    };
+
+    write_file(root / "index.html.gz", bytes(3100));
+    write_file(root / "200.html.gz", bytes(3100));
+    write_file(root / "_nuxt" / ("entry." + hashed() + ".js.gz"), bytes(58 * 1024));
+    write_file(root / "_nuxt" / ("entry." + hashed() + ".css.gz"), bytes(9 * 1024));
+    write_file(root / "_nuxt" / (hashed() + ".css.gz"), bytes(1800));
+    const size_t chunks[] = { 1200, 2400, 3300, 4700, 6100, 8200, 11000, 14500, 19000, 24000 };
+    for (size_t size : chunks) write_file(root / "_nuxt" / (hashed() + ".js.gz"), bytes(size));
+    write_file(root / "_nuxt" / "builds" / "latest.json", "{\"id\":\"" + hashed() + "\",\"timestamp\":1760000000000}");
+
+    for (const char* name : { "favicon.ico", "TNY-360.glb" })
+    {
+        fs::path source = fs::path(WEB_PUBLIC_DIR) / name;
+        if (fs::exists(source)) fs::copy_file(source, root / name);
+        else write_file(root / name, bytes(12 * 1024));
+    }
+    write_manifest(root);
+}
+
+/// @brief Request paths of a page load : every file of the tree, by the name the page asks for (no `.gz`)
+static std::vector<std::string> page_urls(const fs::path& root)
+{
+    std::vector<std::string> urls = { "/" };
+    for (const auto& entry : fs::recursive_directory_iterator(root))
+    {
+        if (!entry.is_regular_file()) continue;
+        std::string url = "/" + fs::relative(entry.path(), root).generic_string();
+        if (url == WEB_ASSETS_MANIFEST) continue;
+        if (url.size() > 3 && url.compare(url.size() - 3, 3, ".gz") == 0) url.resize(url.size() - 3);
+        else if (fs::exists(entry.path().string() + ".gz")) continue; // the gzipped variant is sent
+        if (url == "/index.html") continue;
+        urls.push_back(url);
+    }
+    std::sort(urls.begin() + 1, urls.end());
+    urls.erase(std::unique(urls.begin(), urls.end()), urls.end());
+    return urls;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Sockets
+
+static bool send_all(int fd, const void* data, size_t size)
+{
+    const char* p = static_cast<const char*>(data);
+    while (size > 0)
+    {
+        ssize_t sent = send(fd, p, size, MSG_NOSIGNAL);
+        if (sent <= 0) return false;
+        p += sent;
+        size -= sent;
+    }
+    return true;
+}
+
+static bool send_text(int fd, const std::string& text)
+{
+    return send_all(fd, text.data(), text.size());
+}
+
+/// @brief Buffered reads of a socket, counting the bytes received
+struct Reader
+{
+    int fd;
+    std::string buffer;
+    uint64_t received = 0;
+
+    bool fill()
+    {
+        char chunk[16384];
+        ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0) return false;
+        buffer.append(chunk, n);
+        received += n;
+        return true;
+    }
+
+    /// @brief Read up to the end of the headers (or a line with `separator` = "\r\n")
+    bool until(const char* separator, std::string& out)
+    {
+        size_t end;
+        while ((end = buffer.find(separator)) == std::string::npos)
+        {
+            if (!fill()) return false;
+        }
+        out = buffer.substr(0, end);
+        buffer.erase(0, end + strlen(separator));
+        return true;
+    }
+
+    bool exactly(size_t size, std::string& out)
+    {
+        while (buffer.size() < size)
+        {
+            if (!fill()) return false;
+        }
+        out.append(buffer, 0, size);
+        buffer.erase(0, size);
+        return true;
+    }
+};
+
+/// @brief Value of a header (case insensitive name), empty if absent
+static std::string header_value(const std::string& headers, const char* name)
+{
+    size_t name_length = strlen(name);
+    size_t pos = 0;
+    while ((pos = headers.find("\r\n", pos)) != std::string::npos)
+    {
+        pos += 2;
+        if (strncasecmp(headers.c_str() + pos, name, name_length) == 0 && headers[pos + name_length] == ':')
+        {
+            size_t start = headers.find_first_not_of(' ', pos + name_length + 1);
+            size_t end = headers.find("\r\n", start);
+            return headers.substr(start, end == std::string::npos ? std::string::npos : end - start);
+        }
+    }
+    return "";
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Servers
+
+enum class Mode { Assets, Legacy };
+
+struct Server
+{
+    Mode mode;
+    StaticAssets assets;
+    int listen_fd = -1;
+    uint16_t port = 0;
+    std::thread thread;
+    std::atomic<uint32_t> connections{0};
+    uint64_t legacy_bytes_read = 0;
+
+    bool start(const fs::path& root, uint16_t wanted_port)
+    {
+        if (assets.init(root.c_str()) != Status::Ok) return false;
+        listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+        int yes = 1;
+        setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(wanted_port ? INADDR_ANY : INADDR_LOOPBACK);
+        addr.sin_port = htons(wanted_port);
+        if (bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(listen_fd, 8) != 0) return false;
+        socklen_t length = sizeof(addr);
+        getsockname(listen_fd, reinterpret_cast<sockaddr*>(&addr), &length);
+        port = ntohs(addr.sin_port);
+        thread = std::thread([this]() { run(); });
+        return true;
+    }
+
+    void stop()
+    {
+        shutdown(listen_fd, SHUT_RDWR);
+        thread.join();
+        close(listen_fd);
+    }
+
+    void run()
+    {
+        while (true)
+        {
+            int fd = accept(listen_fd, nullptr, nullptr);
+            if (fd < 0) return;
+            int yes = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+            connections++;
+            Reader reader = { fd };
+            std::string request;
+            while (reader.until("\r\n\r\n", request) && handle(fd, request)) {}
+            close(fd);
+        }
+    }
+
+    bool handle(int fd, std::string request)
+    {
+        request += "\r\n";
+        size_t uri_start = request.find(' ') + 1;
+        std::string uri = request.substr(uri_start, request.find(' ', uri_start) - uri_start);
+
+        StaticAssets::Asset asset;
+        if (assets.resolve(uri.c_str(), asset) != Status::Ok) return send_text(fd, "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n");
+        return mode == Mode::Assets ? send_asset(fd, asset, header_value(request, "If-None-Match")) : send_legacy(fd, asset);
+    }
+
+    /// @brief WebInterface::send_asset()
+    bool send_asset(int fd, const StaticAssets::Asset& asset, const std::string& if_none_match)
+    {
+        std::string headers;
+        if (asset.etag[0] != '\0') headers += std::string("ETag: ") + asset.etag + "\r\n";
+        headers += std::string("Cache-Control: ") + StaticAssets::CacheControl(asset) + "\r\n";
+
+        if (!if_none_match.empty() && assets.notModified(asset, if_none_match.c_str()))
+        {
+            return send_text(fd, "HTTP/1.1 304 Not Modified\r\n" + headers + "Content-Length: 0\r\n\r\n");
+        }
+
+        headers += std::string("Content-Type: ") + asset.mime + "\r\n";
+        if (asset.gzip) headers += "Content-Encoding: gzip\r\n";
+
+        if (const uint8_t* cached = assets.getCached(asset); cached != nullptr)
+        {
+            return send_text(fd, "HTTP/1.1 200 OK\r\n" + headers + "Content-Length: " + std::to_string(asset.size) + "\r\n\r\n") &&
+                   send_all(fd, cached, asset.size);
+        }
+
+        if (!send_text(fd, "HTTP/1.1 200 OK\r\n" + headers + "Transfer-Encoding: chunked\r\n\r\n")) return false;
+        Status err = assets.stream(asset, [fd](const uint8_t* data, size_t size) {
+            char length[20]; // 16 hex digits of a size_t, CRLF and the terminator
+            snprintf(length, sizeof(length), "%zx\r\n", size);
+            return send_text(fd, length) && send_all(fd, data, size) && send_text(fd, "\r\n");
+        });
+        return err == Status::Ok && send_text(fd, "0\r\n\r\n");
+    }
+
+    /// @brief Previous WebInterface::send_file_chunked()
+    bool send_legacy(int fd, const StaticAssets::Asset& asset)
+    {
+        FILE* file = fopen(asset.path, "r");
+        if (!file) return false;
+        std::string headers = std::string("HTTP/1.1 200 OK\r\nContent-Type: ") + asset.mime + "\r\n";
+        if (asset.gzip) headers += "Content-Encoding: gzip\r\n";
+        bool ok = send_text(fd, headers + "Transfer-Encoding: chunked\r\n\r\n");
+
+        char* chunk = static_cast<char*>(malloc(4096));
+        size_t chunk_size;
+        while (ok && (chunk_size = fread(chunk, 1, 4096, file)) > 0)
+        {
+            legacy_bytes_read += chunk_size;
+            char length[20]; // 16 hex digits of a size_t, CRLF and the terminator
+            snprintf(length, sizeof(length), "%zx\r\n", chunk_size);
+            ok = send_text(fd, length) && send_all(fd, chunk, chunk_size) && send_text(fd, "\r\n");
+        }
+        free(chunk);
+        fclose(file);
+        return ok && send_text(fd, "0\r\n\r\n");
+    }
+
+    uint64_t bytesRead() const { return mode == Mode::Assets ? assets.getStats().bytes_read : legacy_bytes_read; }
+};
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Browser
+
+struct Load
+{
+    uint32_t requests = 0;
+    uint32_t full = 0;          // 200 responses
+    uint32_t not_modified = 0;  // 304 responses
+    uint32_t from_cache = 0;    // fresh immutable files, not asked
+    uint64_t bytes = 0;         // received on the connection
+    uint64_t bytes_read = 0;    // read from the filesystem by the server
+    double seconds = 0.0;
+    bool ok = true;
+};
+
+struct Browser
+{
+    struct Entry
+    {
+        std::string etag;
+        bool immutable;
+        std::string body;
+    };
+    std::map<std::string, Entry> cache;
+
+    Load load(Server& server, const std::vector<std::string>& urls, StaticAssets& reference)
+    {
+        Load result;
+        uint64_t read_before = server.bytesRead();
+        auto start = std::chrono::steady_clock::now();
+
+        int fd = socket(AF_INET, SOCK_STREAM, 0);
+        int yes = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+        sockaddr_in addr = {};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = htons(server.port);
+        if (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0)
+        {
+            close(fd);
+            result.ok = false;
+            return result;
+        }
+        Reader reader = { fd };
+
+        for (const std::string& url : urls)
+        {
+            auto cached = cache.find(url);
+            if (cached != cache.end() && cached->second.immutable)
+            {
+                result.from_cache++;
+                continue;
+            }
+
+            std::string request = "GET " + url + " HTTP/1.1\r\nHost: 127.0.0.1\r\nAccept-Encoding: gzip\r\n";
+            if (cached != cache.end() && !cached->second.etag.empty()) request += "If-None-Match: " + cached->second.etag + "\r\n";
+            result.requests++;
+            std::string headers, body;
+            if (!send_text(fd, request + "\r\n") || !reader.until("\r\n\r\n", headers) || !read_body(reader, headers + "\r\n", body))
+            {
+                result.ok = false;
+                break;
+            }
+            headers += "\r\n";
+
+            int status = atoi(headers.c_str() + headers.find(' ') + 1);
+            if (status == 304 && cached != cache.end())
+            {
+                result.not_modified++;
+                body = cached->second.body;
+            }
+            else if (status == 200) result.full++;
+            else
+            {
+                result.ok = false;
+                continue;
+            }
+
+            StaticAssets::Asset asset;
+            result.ok &= reference.resolve(url.c_str(), asset) == Status::Ok && body == read_file(asset.path);
+            cache[url] = { header_value(headers, "ETag"), header_value(headers, "Cache-Control").find("immutable") != std::string::npos, body };
+        }
+        close(fd);
+
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        result.bytes = reader.received;
+        result.bytes_read = server.bytesRead() - read_before;
+        return result;
+    }
+
+    static bool read_body(Reader& reader, const std::string& headers, std::string& body)
+    {
+        if (header_value(headers, "Transfer-Encoding") == "chunked")
+        {
+            while (true)
+            {
+                std::string line, crlf;
+                if (!reader.until("\r\n", line)) return false;
+                size_t size = strtoul(line.c_str(), nullptr, 16);
+                if (size == 0) return reader.until("\r\n", line);
+                if (!reader.exactly(size, body) || !reader.until("\r\n", crlf)) return false;
+            }
+        }
+        return reader.exactly(strtoul(header_value(headers, "Content-Length").c_str(), nullptr, 10), body);
+    }
+};
+
+struct Totals
+{
+    Load cold_first; // first load of a fresh server
+    Load cold;       // following cold loads (RAM cache filled)
+    Load warm;
+
+    static void add(Load& to, const Load& load)
+    {
+        to.requests += load.requests;
+        to.full += load.full;
+        to.not_modified += load.not_modified;
+        to.from_cache += load.from_cache;
+        to.bytes += load.bytes;
+        to.bytes_read += load.bytes_read;
+        to.seconds += load.seconds;
+        to.ok &= load.ok;
+    }
+};
+
+static Totals run_mode(Mode mode, const fs::path& root, const std::vector<std::string>& urls, uint32_t loads, uint32_t& connections, StaticAssets::Stats& stats)
+{
+    Totals totals;
+    Server server;
+    server.mode = mode;
+    StaticAssets reference;
+    if (!server.start(root, 0) || reference.init(root.c_str()) != Status::Ok)
+    {
+        fprintf(stderr, "can't start the server\n");
+        exit(1);
+    }
+
+    for (uint32_t i = 0; i < loads; i++)
+    {
+        Browser browser;
+        Totals::add(i == 0 ? totals.cold_first : totals.cold, browser.load(server, urls, reference));
+        Totals::add(totals.warm, browser.load(server, urls, reference));
+    }
+
+    server.stop();
+    connections = server.connections;
+    stats = server.assets.getStats();
+    return totals;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Checks
+
+static void run_checks(const fs::path& root, const std::vector<std::string>& urls)
+{
+    check(StaticAssets::MatchesETag("\"3f2a\"", "\"3f2a\""), "same ETag");
+    check(StaticAssets::MatchesETag("W/\"3f2a\"", "\"3f2a\""), "weak ETag");
+    check(StaticAssets::MatchesETag("\"0000\", \"3f2a\"", "\"3f2a\""), "ETag in a list");
+    check(StaticAssets::MatchesETag(" \"3f2a\" ,", "\"3f2a\""), "ETag with spaces");
+    check(StaticAssets::MatchesETag("*", "\"3f2a\""), "any ETag");
+    check(!StaticAssets::MatchesETag("\"3f2a0\"", "\"3f2a\""), "longer ETag");
+    check(!StaticAssets::MatchesETag("\"3f2\"", "\"3f2a\""), "shorter ETag");
+    check(!StaticAssets::MatchesETag("3f2a", "\"3f2a\""), "unquoted ETag");
+    check(!StaticAssets::MatchesETag("*", ""), "no ETag");
+
+    StaticAssets assets;
+    check(assets.init(root.c_str()) == Status::Ok, "init");
+    StaticAssets::Asset asset;
+    check(assets.resolve("/../etc/passwd", asset) == Status::InvalidParameters, "path going up the tree");
+    check(assets.resolve("/_nuxt/..%2f..", asset) == Status::InvalidParameters, "path going up the tree (encoded slash)");
+    check(assets.resolve("/", asset) == Status::Ok && asset.gzip && strcmp(asset.mime, "text/html") == 0 && !asset.immutable, "index");
+    std::string index = asset.path;
+    check(assets.resolve("/robot/settings?tab=wifi", asset) == Status::Ok && index == asset.path, "single page app route");
+    check(assets.resolve("/?lang=fr", asset) == Status::Ok && index == asset.path, "query string");
+    check(strcmp(StaticAssets::CacheControl(asset), "no-cache") == 0, "revalidated Cache-Control");
+
+    bool manifest = fs::exists(root.string() + WEB_ASSETS_MANIFEST);
+    size_t prefix = strlen(WEB_IMMUTABLE_DIR);
+    for (const std::string& url : urls)
+    {
+        bool resolved = assets.resolve(url.c_str(), asset) == Status::Ok;
+        check(resolved, ("resolve " + url).c_str());
+        if (!resolved) continue;
+        bool immutable = url.compare(0, prefix, WEB_IMMUTABLE_DIR) == 0 && url.find('/', prefix) == std::string::npos;
+        check(asset.immutable == immutable, ("immutable " + url).c_str());
+        check(!manifest || asset.etag[0] == '"', ("ETag of " + url).c_str());
+        if (immutable) check(strstr(StaticAssets::CacheControl(asset), "immutable") != nullptr, "immutable Cache-Control");
+    }
+
+    // cache budget : every file streamed twice, the cache never holds more than WEB_ASSET_CACHE_SIZE
+    for (int pass = 0; pass < 2; pass++)
+    {
+        for (const std::string& url : urls)
+        {
+            if (assets.resolve(url.c_str(), asset) != Status::Ok) continue;
+            std::string content;
+            const uint8_t* cached = assets.getCached(asset);
+            if (cached) content.assign(reinterpret_cast<const char*>(cached), asset.size);
+            else assets.stream(asset, [&content](const uint8_t* data, size_t size) { content.append(reinterpret_cast<const char*>(data), size); return true; });
+            check(content == read_file(asset.path), ("content of " + url).c_str());
+            check(assets.getStats().cached_bytes <= WEB_ASSET_CACHE_SIZE, "cache budget");
+        }
+    }
+
+    // a sink stopping the transfer leaves nothing in the cache
+    StaticAssets fresh;
+    fresh.init(root.c_str());
+    if (fresh.resolve("/", asset) == Status::Ok)
+    {
+        check(fresh.stream(asset, [](const uint8_t*, size_t) { return false; }) == Status::InvalidState, "stopped stream");
+        check(fresh.getCached(asset) == nullptr, "stopped stream not cached");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    fs::path root = WEB_DATA_DIR;
+    uint32_t loads = 20;
+    int serve_port = -1;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--root") == 0 && i + 1 < argc) root = argv[++i];
+        else if (strcmp(argv[i], "--loads") == 0 && i + 1 < argc) loads = std::max(2ul, strtoul(argv[++i], nullptr, 10));
+        else if (strcmp(argv[i], "--serve") == 0 && i + 1 < argc) serve_port = atoi(argv[++i]);
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--root dir] [--loads count] [--serve port]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    fs::path synthetic;
+    if (!fs::exists(root / "index.html.gz") && !fs::exists(root / "index.html"))
+    {
+        char temp[] = "/tmp/tny360_web_XXXXXX";
+        synthetic = mkdtemp(temp);
+        make_tree(synthetic);
+        root = synthetic;
+    }
+
+    if (serve_port >= 0)
+    {
+        Server server;
+        server.mode = Mode::Assets;
+        if (!server.start(root, serve_port)) return 1;
+        printf("serving %s on http://localhost:%u/\n", root.c_str(), server.port);
+        server.thread.join();
+        return 0;
+    }
+
+    std::vector<std::string> urls = page_urls(root);
+    uint64_t tree_bytes = 0;
+    for (const auto& entry : fs::recursive_directory_iterator(root))
+    {
+        if (entry.is_regular_file()) tree_bytes += entry.file_size();
+    }
+
+    run_checks(root, urls);
+
+    uint32_t connections[2];
+    StaticAssets::Stats stats[2];
+    Totals legacy = run_mode(Mode::Legacy, root, urls, loads, connections[0], stats[0]);
+    Totals assets = run_mode(Mode::Assets, root, urls, loads, connections[1], stats[1]);
+
+    check(legacy.cold_first.ok && legacy.cold.ok && legacy.warm.ok, "legacy page loads");
+    check(assets.cold_first.ok && assets.cold.ok && assets.warm.ok, "assets page loads");
+    check(assets.warm.full == 0, "warm loads only get 304s");
+    check(assets.warm.bytes * 10 < assets.cold.bytes, "warm loads transfer 10 times fewer bytes");
+    check(stats[1].cache_hits > 0 && assets.cold.bytes_read < assets.cold_first.bytes_read * (loads - 1), "RAM cache hits");
+    bool failed = check_failures != 0;
+
+    auto per_load = [](const Load& load, uint32_t count, uint64_t value) { return static_cast<double>(value) / count; };
+    struct Row { const char* name; const Load* load; uint32_t count; };
+    const Row rows[] = {
+        { "legacy cold", &legacy.cold, loads - 1 }, { "legacy warm", &legacy.warm, loads },
+        { "assets first", &assets.cold_first, 1 }, { "assets cold", &assets.cold, loads - 1 }, { "assets warm", &assets.warm, loads },
+    };
+
+    if (json)
+    {
+        printf("{\"checks_failed\": %d, \"root\": \"%s\", \"synthetic\": %s, \"files\": %zu, \"tree_bytes\": %llu, \"loads\": %u, \"rows\": [\n",
+               check_failures, root.c_str(), synthetic.empty() ? "false" : "true", urls.size(), static_cast<unsigned long long>(tree_bytes), loads);
+        for (size_t i = 0; i < sizeof(rows) / sizeof(rows[0]); i++)
+        {
+            const Row& r = rows[i];
+            printf("  {\"name\": \"%s\", \"requests\": %.1f, \"full\": %.1f, \"not_modified\": %.1f, \"from_cache\": %.1f, \"bytes\": %.0f, \"bytes_read\": %.0f, \"ms\": %.3f, \"req_per_s\": %.0f}%s\n",
+                   r.name, per_load(*r.load, r.count, r.load->requests), per_load(*r.load, r.count, r.load->full),
+                   per_load(*r.load, r.count, r.load->not_modified), per_load(*r.load, r.count, r.load->from_cache),
+                   per_load(*r.load, r.count, r.load->bytes), per_load(*r.load, r.count, r.load->bytes_read), r.load->seconds * 1e3 / r.count,
+                   r.load->requests / std::max(r.load->seconds, 1e-9), i + 1 < sizeof(rows) / sizeof(rows[0]) ? "," : "");
+        }
+        printf("], \"connections\": [%u, %u], \"cache_hits\": %u, \"cached_bytes\": %u}\n", connections[0], connections[1], stats[1].cache_hits, stats[1].cached_bytes);
+    }
+    else
+    {
+        printf("checks       : %s (%d failed)\n", check_failures == 0 ? "ok" : "FAILED", check_failures);
+        printf("tree         : %s%s, %zu files in a page load, %.1f KB\n", root.c_str(), synthetic.empty() ? "" : " (synthetic)", urls.size(), tree_bytes / 1024.0);
+        printf("loads        : %u cold and %u warm per server, one keep-alive connection each\n\n", loads, loads);
+        printf("%-13s %9s %6s %6s %7s %11s %11s %9s %9s\n", "per load", "requests", "200", "304", "cached", "KB sent", "KB read", "ms", "req/s");
+        for (const Row& r : rows)
+        {
+            printf("%-13s %9.1f %6.1f %6.1f %7.1f %11.1f %11.1f %9.3f %9.0f\n", r.name, per_load(*r.load, r.count, r.load->requests),
+                   per_load(*r.load, r.count, r.load->full), per_load(*r.load, r.count, r.load->not_modified),
+                   per_load(*r.load, r.count, r.load->from_cache), per_load(*r.load, r.count, r.load->bytes) / 1024.0,
+                   per_load(*r.load, r.count, r.load->bytes_read) / 1024.0, r.load->seconds * 1e3 / r.count,
+                   r.load->requests / std::max(r.load->seconds, 1e-9));
+        }
+        printf("\nRAM cache    : %u hits, %.1f KB held (budget %zu KB)\n", stats[1].cache_hits, stats[1].cached_bytes / 1024.0, WEB_ASSET_CACHE_SIZE / 1024);
+        printf("(cached : fresh immutable files the browser didn't ask, KB read : from the filesystem by the server)\n");
+        if (failed) printf("\nFAILED\n");
+    }
+
+    if (!synthetic.empty()) fs::remove_all(synthetic);
+    return check_exit_code();
+}
@@ -0,0 +1,556 @@
+/**
+ * WiFi station reconnection (network/WiFiReconnect.hpp) : checks of the state machine, then outages replayed through
+ * a fake WiFi driver against the previous reconnection of WiFiManager.
+ *
+ * - cases : hand written event sequences (boot on the cached access point, stale cache falling back to a scan,
+ *           backoff growth and cap, disconnection storms, phase timeouts, flapping and stable links) and the exact
+ *           commands they must give
+ * - outages : random trials (fixed seed), each one a connected robot losing its access point : a short drop, a router
+ *             reboot, a router coming back on another channel, or a storm of disconnections (failed associations
+ *             and spurious disconnection events). The fake driver answers scans, connections and DHCP with delays
+ *             drawn from the ranges below
+ * - legacy : the same trials seen by the previous WiFiManager (esp_wifi_connect() scanning every channel, retried
+ *            on every disconnection with no delay, full DHCP exchange, access point mode after WIFI_MAX_RETRIES)
+ *
+ * Recovery is the time from the access point being usable again to the IP address, boot the time from the station
+ * start to the IP address. The tool exits with 2 on any case mismatch, or if the state machine recovers fewer
+ * outages, recovers slower, boots slower or calls esp_wifi_connect() more often than the previous reconnection.
+ *
+ * Usage : bench_wifi_reconnect [--json] [--trials count]
+ */
+#include "network/WiFiReconnect.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <queue>
+#include <random>
+#include <vector>
+
+using Command = WiFiReconnect::Command;
+using State = WiFiReconnect::State;
+
+constexpr uint32_t SEED = 0x360;
+constexpr int64_t MS = 1000;
+constexpr int64_t S = 1000 * MS;
+
+// fake driver delays
+constexpr int64_t SCAN_US[2] = { 1800 * MS, 2600 * MS };        // every channel, active and passive
+constexpr int64_t ASSOC_US[2] = { 40 * MS, 150 * MS };          // authentication and association
+constexpr int64_t PROBE_FAIL_US[2] = { 100 * MS, 300 * MS };    // no access point on the given channel
+constexpr int64_t AUTH_FAIL_US[2] = { 300 * MS, 1000 * MS };    // association timeout
+constexpr int64_t DHCP_FULL_US[2] = { 400 * MS, 1500 * MS };    // discover, offer, request, ack
+constexpr int64_t DHCP_RESTORE_US[2] = { 60 * MS, 250 * MS };   // request of the last lease, ack
+constexpr int64_t TRIAL_US = 180 * S;                           // a trial not recovered by then failed
+constexpr int64_t OUTAGE_AT_US = 30 * S;                        // outage after a stable link
+
+static const char* command_name(Command command)
+{
+    switch (command)
+    {
+        case Command::None: return "None";
+        case Command::Scan: return "Scan";
+        case Command::Connect: return "Connect";
+        case Command::ConnectCached: return "ConnectCached";
+        case Command::Disconnect: return "Disconnect";
+        case Command::DropCache: return "DropCache";
+        case Command::GiveUp: return "GiveUp";
+    }
+    return "?";
+}
+
+/// CASES
+
+static int case_failures = 0;
+
+static void expect_command(Command got, Command expected, const char* name)
+{
+    if (got == expected) return;
+    fprintf(stderr, "%s : got %s, expected %s\n", name, command_name(got), command_name(expected));
+    case_failures++;
+}
+
+static void expect(bool condition, const char* name)
+{
+    if (condition) return;
+    fprintf(stderr, "%s : FAILED\n", name);
+    case_failures++;
+}
+
+static void run_cases()
+{
+    const WiFiReconnect::Policy& policy = WiFiReconnect::DEFAULT_POLICY;
+
+    {
+        WiFiReconnect r;
+        expect_command(r.start(true, 0), Command::ConnectCached, "boot cached");
+        expect_command(r.onAssociated(80 * MS), Command::None, "boot cached : associated");
+        expect_command(r.onGotIP(300 * MS), Command::None, "boot cached : IP");
+        WiFiReconnect::Timings t = r.getTimings();
+        expect(t.fast && t.scan_ms == 0 && t.assoc_ms == 80 && t.dhcp_ms == 220 && t.total_ms == 300, "boot cached : timings");
+        expect(r.deadline() == WiFiReconnect::NO_DEADLINE, "boot cached : no deadline once connected");
+    }
+    {
+        WiFiReconnect r;
+        expect_command(r.start(true, 0), Command::ConnectCached, "stale cache");
+        expect_command(r.onDisconnected(200 * MS), Command::DropCache, "stale cache : scan right away");
+        expect_command(r.onScanDone(true, 2200 * MS), Command::Connect, "stale cache : connect");
+        r.onAssociated(2300 * MS);
+        r.onGotIP(3000 * MS);
+        WiFiReconnect::Timings t = r.getTimings();
+        expect(!t.fast && t.scan_ms == 2000 && t.total_ms == 3000, "stale cache : timings");
+    }
+    {
+        // no access point : backoff doubling (minus the jitter) up to the cap, then giving up
+        WiFiReconnect r(policy, 42);
+        int64_t now = 0;
+        expect_command(r.start(false, now), Command::Scan, "backoff");
+        bool in_range = true;
+        for (uint8_t failure = 1; failure <= policy.max_retries; failure++)
+        {
+            now += 2 * S;
+            expect_command(r.onScanDone(false, now), Command::None, "backoff : not found");
+            int64_t delay = r.deadline() - now, nominal = r.backoffDelay(failure);
+            if (delay > nominal || delay < nominal - static_cast<int64_t>(nominal * policy.jitter)) in_range = false;
+            if (nominal != std::min(policy.backoff_base_us << (failure - 1), policy.backoff_max_us)) in_range = false;
+            expect_command(r.poll(r.deadline() - 1), Command::None, "backoff : not due");
+            now = r.deadline();
+            expect_command(r.poll(now), Command::Scan, "backoff : retry");
+        }
+        expect(in_range, "backoff : delays");
+        expect_command(r.onScanDone(false, now + 2 * S), Command::GiveUp, "backoff : give up");
+        expect(r.getState() == State::GaveUp && r.getStats().attempts == policy.max_retries + 1u, "backoff : attempts");
+    }
+    {
+        WiFiReconnect r;
+        r.start(false, 0);
+        r.onScanDone(false, 2 * S);
+        for (int i = 0; i < 100; i++) expect_command(r.onDisconnected(2 * S + i * MS), Command::None, "storm while waiting");
+        expect(r.getStats().ignored_events == 100 && r.getState() == State::Waiting, "storm while waiting : ignored");
+    }
+    {
+        WiFiReconnect r;
+        r.start(false, 0);
+        r.onScanDone(true, 2 * S);
+        expect_command(r.poll(2 * S + policy.phase_timeout_us), Command::Disconnect, "association timeout");
+        expect_command(r.onDisconnected(2 * S + policy.phase_timeout_us + MS), Command::None, "association timeout : end of the abort");
+        expect(r.getState() == State::Waiting, "association timeout : backing off");
+    }
+    {
+        WiFiReconnect r;
+        r.start(true, 0);
+        r.onAssociated(100 * MS);
+        r.onGotIP(300 * MS);
+        expect_command(r.onDisconnected(1 * S), Command::None, "flapping link : backs off");
+        r.poll(r.deadline());
+        r.onAssociated(r.deadline() - policy.phase_timeout_us + 100 * MS);
+        r.onGotIP(r.deadline() - policy.phase_timeout_us + 100 * MS);
+        expect(r.getState() == State::Connected, "flapping link : reconnected");
+        int64_t now = 100 * S;
+        expect_command(r.onDisconnected(now), Command::ConnectCached, "stable link : reconnects right away");
+        expect(r.getStats().link_losses == 2, "stable link : losses counted");
+    }
+}
+
+/// OUTAGES
+
+enum class Outage : uint8_t
+{
+    Drop,   // link lost, access point still there
+    Reboot, // access point gone for a while
+    Move,   // access point gone for a while, back on another channel
+    Storm,  // access point there, associations failing and spurious disconnections
+};
+
+static const char* outage_name(Outage outage)
+{
+    switch (outage)
+    {
+        case Outage::Drop: return "drop";
+        case Outage::Reboot: return "reboot";
+        case Outage::Move: return "move";
+        case Outage::Storm: return "storm";
+    }
+    return "?";
+}
+
+constexpr int OUTAGE_KINDS = 4;
+
+struct Trial
+{
+    Outage kind;
+    int64_t start_us;          // link lost
+    int64_t end_us;            // access point usable again
+    uint8_t channel_before;
+    uint8_t channel_after;
+    std::vector<int64_t> spurious_us; // disconnection events of a storm
+    uint64_t seed;
+};
+
+static Trial make_trial(std::mt19937& rng)
+{
+    Trial trial;
+    trial.kind = static_cast<Outage>(rng() % OUTAGE_KINDS);
+    trial.start_us = OUTAGE_AT_US;
+    trial.channel_before = 1 + rng() % 11;
+    trial.channel_after = trial.channel_before;
+    trial.seed = rng();
+    switch (trial.kind)
+    {
+        case Outage::Drop:
+            trial.end_us = trial.start_us;
+            break;
+        case Outage::Reboot:
+            trial.end_us = trial.start_us + std::uniform_int_distribution<int64_t>(5 * S, 40 * S)(rng);
+            break;
+        case Outage::Move:
+            trial.end_us = trial.start_us + std::uniform_int_distribution<int64_t>(5 * S, 20 * S)(rng);
+            trial.channel_after = 1 + (trial.channel_before + 4) % 11;
+            break;
+        case Outage::Storm:
+        {
+            trial.end_us = trial.start_us + std::uniform_int_distribution<int64_t>(2 * S, 6 * S)(rng);
+            std::uniform_int_distribution<int64_t> gap(20 * MS, 200 * MS);
+            for (int64_t t = trial.start_us + gap(rng); t < trial.end_us; t += gap(rng)) trial.spurious_us.push_back(t);
+            break;
+        }
+    }
+    return trial;
+}
+
+/// @brief Fake WiFi driver : answers the operations of a model with events, according to the trial
+class FakeDriver
+{
+public:
+    enum class Kind : uint8_t { ScanDone, Associated, GotIP, Disconnected, Timer };
+
+    struct Event
+    {
+        int64_t time_us;
+        Kind kind;
+        int64_t op; // operation the event answers, -1 for spontaneous events
+        bool found;
+        bool operator>(const Event& other) const { return time_us > other.time_us; }
+    };
+
+    uint32_t connects = 0;
+    uint32_t scans = 0;
+    uint8_t scanned_channel = 0;
+    uint8_t linked_channel = 0;
+    bool lease_seen = false;
+
+    FakeDriver(const Trial& trial, bool restores_lease) : trial(trial), restores_lease(restores_lease), rng(trial.seed)
+    {
+        push({ trial.start_us, Kind::Disconnected, -2, false }); // link loss
+        for (int64_t t : trial.spurious_us) push({ t, Kind::Disconnected, -1, false });
+    }
+
+    void scan(int64_t now_us)
+    {
+        scans++;
+        op++;
+        int64_t done = now_us + draw(SCAN_US);
+        scanned_channel = channel(done);
+        push({ done, Kind::ScanDone, op, available(done) });
+    }
+
+    /// @param channel_hint Channel of the access point, 0 to scan every channel first (esp_wifi_connect() without one)
+    void connect(int64_t now_us, uint8_t channel_hint)
+    {
+        connects++;
+        op++;
+        int64_t t = now_us + (channel_hint == 0 ? draw(SCAN_US) : 0);
+        if (!available(t) || (channel_hint != 0 && channel_hint != channel(t)))
+        {
+            push({ t + draw(channel_hint != 0 ? PROBE_FAIL_US : AUTH_FAIL_US), Kind::Disconnected, op, false });
+            return;
+        }
+        if (storming(t))
+        {
+            push({ t + draw(AUTH_FAIL_US), Kind::Disconnected, op, false });
+            return;
+        }
+        t += draw(ASSOC_US);
+        linked_channel = channel(t);
+        push({ t, Kind::Associated, op, false });
+        t += draw(restores_lease && lease_seen ? DHCP_RESTORE_US : DHCP_FULL_US);
+        push({ t, Kind::GotIP, op, false });
+    }
+
+    void disconnect(int64_t now_us)
+    {
+        op++;
+        push({ now_us + 5 * MS, Kind::Disconnected, op, false });
+    }
+
+    /// @brief Next event still current (answers to aborted operations are dropped), false at the end of the trial
+    bool next(int64_t timer_us, Event& event)
+    {
+        while (!events.empty())
+        {
+            Event e = events.top();
+            if (timer_us <= e.time_us) break;
+            events.pop();
+            if (e.op >= 0 && e.op != op) continue;
+            if (e.op == -2) op++; // the link loss also ends any pending operation
+            event = e;
+            return event.time_us < TRIAL_US;
+        }
+        event = { timer_us, Kind::Timer, -1, false };
+        return timer_us < TRIAL_US;
+    }
+
+private:
+    const Trial& trial;
+    bool restores_lease;
+    std::mt19937_64 rng;
+    int64_t op = 0;
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+
+    void push(const Event& event) { events.push(event); }
+
+    int64_t draw(const int64_t range[2]) { return std::uniform_int_distribution<int64_t>(range[0], range[1])(rng); }
+
+    bool available(int64_t t) const
+    {
+        if (trial.kind == Outage::Reboot || trial.kind == Outage::Move) return t < trial.start_us || t >= trial.end_us;
+        return true;
+    }
+
+    bool storming(int64_t t) const { return trial.kind == Outage::Storm && t >= trial.start_us && t < trial.end_us; }
+
+    uint8_t channel(int64_t t) const { return t < trial.end_us ? trial.channel_before : trial.channel_after; }
+};
+
+/**
+ * Result of a trial
+ * - `recovered`: got an IP address after the outage, before the end of the trial or giving up
+ * - `recovery_us`: access point usable again to the IP address
+ * - `connects`: esp_wifi_connect() calls during the outage
+ */
+struct TrialResult
+{
+    bool recovered;
+    int64_t recovery_us;
+    int64_t boot_us;
+    uint32_t connects;
+    uint32_t scans;
+};
+
+/// @brief WiFiManager with the state machine : boots on the cached access point, then goes through the outage
+static TrialResult run_state_machine(const Trial& trial, bool cached_at_boot)
+{
+    FakeDriver driver(trial, true);
+    WiFiReconnect r(WiFiReconnect::DEFAULT_POLICY, static_cast<uint32_t>(trial.seed));
+    uint8_t cached_channel = cached_at_boot ? trial.channel_before : 0;
+    TrialResult result = {};
+    uint32_t connects_at_outage = 0, scans_at_outage = 0;
+    bool outage_started = false;
+
+    auto run = [&](Command command, int64_t now) {
+        switch (command)
+        {
+            case Command::DropCache: cached_channel = 0; [[fallthrough]];
+            case Command::Scan: driver.scan(now); break;
+            case Command::Connect: driver.connect(now, driver.scanned_channel); break;
+            case Command::ConnectCached: driver.connect(now, cached_channel); break;
+            case Command::Disconnect: driver.disconnect(now); break;
+            default: break;
+        }
+    };
+
+    run(r.start(cached_channel != 0, 0), 0);
+    FakeDriver::Event event;
+    while (driver.next(r.deadline(), event))
+    {
+        int64_t now = event.time_us;
+        if (!outage_started && now >= trial.start_us)
+        {
+            outage_started = true;
+            connects_at_outage = driver.connects;
+            scans_at_outage = driver.scans;
+        }
+        switch (event.kind)
+        {
+            case FakeDriver::Kind::ScanDone: run(r.onScanDone(event.found, now), now); break;
+            case FakeDriver::Kind::Associated: run(r.onAssociated(now), now); break;
+            case FakeDriver::Kind::Disconnected: run(r.onDisconnected(now), now); break;
+            case FakeDriver::Kind::Timer: run(r.poll(now), now); break;
+            case FakeDriver::Kind::GotIP:
+                run(r.onGotIP(now), now);
+                cached_channel = driver.linked_channel;
+                driver.lease_seen = true;
+                if (!outage_started) result.boot_us = now;
+                else
+                {
+                    result.recovered = true;
+                    result.recovery_us = now - trial.end_us;
+                }
+                break;
+        }
+        if (result.recovered || r.getState() == State::GaveUp) break;
+    }
+    result.connects = driver.connects - connects_at_outage;
+    result.scans = driver.scans - scans_at_outage;
+    return result;
+}
+
+/// @brief Previous WiFiManager : esp_wifi_connect() on start and on every disconnection, up to WIFI_MAX_RETRIES
+static TrialResult run_legacy(const Trial& trial)
+{
+    FakeDriver driver(trial, false);
+    TrialResult result = {};
+    uint32_t connects_at_outage = 0;
+    bool outage_started = false;
+    int retry_count = 0;
+    bool gave_up = false;
+
+    driver.connect(0, 0);
+    FakeDriver::Event event;
+    while (!gave_up && driver.next(WiFiReconnect::NO_DEADLINE, event))
+    {
+        int64_t now = event.time_us;
+        if (!outage_started && now >= trial.start_us)
+        {
+            outage_started = true;
+            connects_at_outage = driver.connects;
+        }
+        if (event.kind == FakeDriver::Kind::Disconnected)
+        {
+            if (retry_count < WIFI_MAX_RETRIES)
+            {
+                driver.connect(now, 0);
+                retry_count++;
+            }
+            else gave_up = true;
+        }
+        else if (event.kind == FakeDriver::Kind::GotIP)
+        {
+            retry_count = 0;
+            if (!outage_started) result.boot_us = now;
+            else
+            {
+                result.recovered = true;
+                result.recovery_us = now - trial.end_us;
+                break;
+            }
+        }
+    }
+    result.connects = driver.connects - connects_at_outage;
+    return result;
+}
+
+struct Summary
+{
+    uint32_t trials[OUTAGE_KINDS] = {};
+    uint32_t recovered[OUTAGE_KINDS] = {};
+    double recovery_ms[OUTAGE_KINDS] = {}; // sum over the recovered trials
+    uint64_t connects = 0;
+    uint64_t scans = 0;
+    double boot_ms = 0.0;
+    uint32_t total = 0;
+
+    void add(Outage kind, const TrialResult& result)
+    {
+        int k = static_cast<int>(kind);
+        trials[k]++;
+        total++;
+        connects += result.connects;
+        scans += result.scans;
+        boot_ms += result.boot_us / 1e3;
+        if (!result.recovered) return;
+        recovered[k]++;
+        recovery_ms[k] += result.recovery_us / 1e3;
+    }
+
+    uint32_t recoveredTotal() const
+    {
+        uint32_t n = 0;
+        for (int k = 0; k < OUTAGE_KINDS; k++) n += recovered[k];
+        return n;
+    }
+
+    double meanRecoveryMs() const
+    {
+        double sum = 0.0;
+        for (int k = 0; k < OUTAGE_KINDS; k++) sum += recovery_ms[k];
+        return recoveredTotal() ? sum / recoveredTotal() : 0.0;
+    }
+
+    double kindRecoveryMs(int k) const { return recovered[k] ? recovery_ms[k] / recovered[k] : 0.0; }
+};
+
+int main(int argc, char** argv)
+{
+    bool json = false;
+    uint32_t trial_count = 1000;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0) json = true;
+        else if (strcmp(argv[i], "--trials") == 0 && i + 1 < argc) trial_count = strtoul(argv[++i], nullptr, 10);
+        else
+        {
+            fprintf(stderr, "usage: %s [--json] [--trials count]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    run_cases();
+
+    std::mt19937 rng(SEED);
+    Summary machine, legacy;
+    double cold_boot_ms = 0.0;
+    for (uint32_t i = 0; i < trial_count; i++)
+    {
+        Trial trial = make_trial(rng);
+        machine.add(trial.kind, run_state_machine(trial, true));
+        legacy.add(trial.kind, run_legacy(trial));
+        cold_boot_ms += run_state_machine(trial, false).boot_us / 1e3;
+    }
+    cold_boot_ms /= std::max<uint32_t>(trial_count, 1);
+
+    bool better = machine.recoveredTotal() >= legacy.recoveredTotal() && machine.meanRecoveryMs() < legacy.meanRecoveryMs() &&
+                  machine.boot_ms < legacy.boot_ms && machine.connects < legacy.connects;
+    bool failed = case_failures != 0 || !better;
+
+    const Summary* models[] = { &legacy, &machine };
+    if (json)
+    {
+        printf("{\"cases_failed\": %d, \"trials\": %u, \"cold_boot_ms\": %.0f, \"models\": [\n", case_failures, trial_count, cold_boot_ms);
+        const char* names[] = { "legacy", "state_machine" };
+        for (int i = 0; i < 2; i++)
+        {
+            const Summary& m = *models[i];
+            printf("  {\"name\": \"%s\", \"boot_ms\": %.0f, \"recovered\": %u, \"recovery_ms\": %.0f, \"connects_per_outage\": %.2f, \"outages\": {",
+                   names[i], m.boot_ms / m.total, m.recoveredTotal(), m.meanRecoveryMs(), static_cast<double>(m.connects) / m.total);
+            for (int k = 0; k < OUTAGE_KINDS; k++)
+            {
+                printf("\"%s\": {\"trials\": %u, \"recovered\": %u, \"recovery_ms\": %.0f}%s", outage_name(static_cast<Outage>(k)),
+                       m.trials[k], m.recovered[k], m.kindRecoveryMs(k), k + 1 < OUTAGE_KINDS ? ", " : "");
+            }
+            printf("}}%s\n", i == 0 ? "," : "");
+        }
+        printf("]}\n");
+    }
+    else
+    {
+        printf("cases          : %s (%d failed)\n", case_failures == 0 ? "ok" : "FAILED", case_failures);
+        printf("trials         : %u (boot without a cached access point : %.0f ms)\n\n", trial_count, cold_boot_ms);
+        printf("%-14s %8s %10s %12s %9s", "model", "boot ms", "recovered", "recovery ms", "connects");
+        for (int k = 0; k < OUTAGE_KINDS; k++) printf(" %14s", outage_name(static_cast<Outage>(k)));
+        printf("\n");
+        const char* names[] = { "legacy", "state machine" };
+        for (int i = 0; i < 2; i++)
+        {
+            const Summary& m = *models[i];
+            printf("%-14s %8.0f %9.1f%% %12.0f %9.2f", names[i], m.boot_ms / m.total, 100.0 * m.recoveredTotal() / m.total,
+                   m.meanRecoveryMs(), static_cast<double>(m.connects) / m.total);
+            for (int k = 0; k < OUTAGE_KINDS; k++) printf(" %5.0f%% %6.0fms", 100.0 * m.recovered[k] / std::max<uint32_t>(m.trials[k], 1), m.kindRecoveryMs(k));
+            printf("\n");
+        }
+        printf("\n(outage columns : recovered trials, mean recovery)\n");
+        if (!better) printf("\nthe state machine doesn't beat the previous reconnection : FAILED\n");
+    }
+
+    return failed ? 2 : 0;
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "network/NetworkManager.hpp"
+#include "audio/AudioManager.hpp"
+
+/**
+ * @brief Menu emulator replacement of include/Robot.hpp : only the managers the menus use.
+ * @note The audio manager is the firmware one, left uninitialized (button sounds are ignored). The network managers
+ *       are fakes whose state is set by the emulator scripts (see network/WiFiManager.hpp and network/UpdateManager.hpp).
+ */
+class Robot
+{
+public:
+    constexpr static const char* TAG = "Robot";
+
+    static Robot& GetInstance();
+
+    inline NetworkManager& getNetworkManager() { return network_manager; }
+
+    inline AudioManager& getAudioManager() { return audio_manager; }
+
+private:
+    NetworkManager network_manager;
+    AudioManager audio_manager;
+};
@@ -0,0 +1,21 @@
+#pragma once
+#include "common/utils.hpp"
+
+/**
+ * @brief Menu emulator replacement of include/common/I2C.hpp : two fake buses, where the devices set with
+ *        Emu::SetI2CDevices() answer the probes.
+ */
+typedef struct i2c_master_bus_t* i2c_master_bus_handle_t;
+
+namespace I2C
+{
+    extern i2c_master_bus_handle_t handle_primary;
+
+    extern i2c_master_bus_handle_t handle_secondary;
+
+    Status Init();
+
+    Status Deinit();
+
+    Status ProbeAddress(i2c_master_bus_handle_t handle, uint8_t address);
+}
@@ -0,0 +1,140 @@
+#pragma once
+#include "common/utils.hpp"
+#include "common/config.hpp"
+#include "ui/ButtonDebouncer.hpp"
+#include "ui/Menus.hpp"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Emu
+{
+    constexpr size_t FRAME_SIZE = SCREEN_WIDTH * SCREEN_HEIGHT / 8;
+
+    enum class Button : uint8_t
+    {
+        Left = 0,
+        Right = 1,
+    };
+
+    /**
+     * Renders of a menu (frames where Menu::render() drew and uploaded the screen)
+     * - `renders`: number of renders
+     * - `total_us`: time spent in the menu cycle of those frames (update, render, upload)
+     * - `max_us`: slowest of them
+     */
+    struct RenderStats
+    {
+        uint32_t renders = 0;
+        double total_us = 0.0;
+        double max_us = 0.0;
+    };
+
+    /**
+     * Result of a `snap` command of a script
+     * - `name`: snapshot name
+     * - `menu`: title of the menu on screen
+     * - `frame`: panel content, in the page-packed panel format
+     */
+    struct Snapshot
+    {
+        std::string name;
+        std::string menu;
+        std::vector<uint8_t> frame;
+    };
+
+    /**
+     * @brief Runs the firmware menus (src/ui/Menus.cpp, src/ui/menus) on the host, on the fake screen panel.
+     *
+     * Time is virtual : step() advances the clock by SCREEN_REFRESH_RATE and runs one menu cycle (Menus::Update()),
+     * like the menus task does on the robot, and esp_random() is seeded, so a script always gives the same frames.
+     * Button presses are edges given to a ButtonDebouncer at virtual times, its events reach the menus through
+ * Menus::HandleInput() at the start of each cycle, like in the menus task (there are no pins nor interrupt).
+     *
+     * Scripts are lines of commands (`#` starts a comment) :
+     * - `show splash|face|error` : make a menu the current one
+     * - `left`, `right` : short press (the menu sees it on release)
+     * - `left-long`, `right-long` : long press, held for BTN_LONG_PRESS_MS and PRESS_MS more
+     * - `wait ms` : run the menus for that long
+     * - `snap name` : record the panel
+     * - `wifi ap|sta ip ssid`, `update status [progress] [version]`, `i2c primary|secondary addresses...` : state of
+     *   the fake services shown by the menus
+     * - `log info|warning|error|success message` : add a line to the logs
+     */
+    class MenuEmulator
+    {
+    public:
+        /** Time a button is held for a short press, in ms */
+        constexpr static uint32_t PRESS_MS = 50;
+
+        /**
+         * @brief Switch to virtual time from 0, seed esp_random() and initialize the screen driver on the fake panel.
+         */
+        Status init(uint32_t seed = 0x360);
+
+        /**
+         * @brief Make a menu the current one, then run one cycle.
+         */
+        void show(Menus::Menu* menu);
+
+        /**
+         * @brief Run menu cycles, SCREEN_REFRESH_RATE ms of virtual time each.
+         */
+        void step(uint32_t frames = 1);
+
+        /**
+         * @brief Run the menus for a duration (rounded up to whole cycles).
+         */
+        void wait(uint32_t ms);
+
+        /**
+         * @brief Press a button and release it after PRESS_MS (after BTN_LONG_PRESS_MS more for a long press), then
+         *        run the menus until the release is debounced.
+         */
+        void press(Button button, bool long_press = false);
+
+        /**
+         * @brief Run a script (see the class description).
+         * @param snapshots Receives the `snap` results.
+         * @return Status::InvalidParameters on an unknown command (the line is logged).
+         */
+        Status run(const std::string& script, std::vector<Snapshot>& snapshots);
+
+        /**
+         * @brief Panel content, what the robot would show (page-packed, FRAME_SIZE bytes).
+         */
+        const uint8_t* getPanel() const;
+
+        /**
+         * @brief Render statistics by menu title, since init() or resetStats().
+         */
+        const std::map<std::string, RenderStats>& getStats() const { return stats; }
+
+        void resetStats() { stats.clear(); }
+
+    private:
+        std::map<std::string, RenderStats> stats;
+        ButtonDebouncer buttons[2];
+    };
+
+    /**
+     * @brief Set the devices answering the probes of a fake I2C bus.
+     */
+    void SetI2CDevices(bool primary, const std::vector<uint8_t>& addresses);
+
+    /**
+     * @brief Write a panel frame as a PNG (white pixels lit, each one `scale` x `scale` pixels).
+     */
+    Status SavePNG(const char* path, const uint8_t* frame, uint8_t scale = 1);
+
+    /**
+     * @brief Read a PNG written by SavePNG() with a scale of 1 (pixels at least half bright are lit).
+     * @return Status::NotFound if the file can't be read, Status::InvalidParameters if it isn't the screen size.
+     */
+    Status LoadPNG(const char* path, uint8_t* frame);
+
+    /**
+     * @brief Number of pixels that differ between two panel frames.
+     */
+    uint32_t CountDifferences(const uint8_t* a, const uint8_t* b);
+}
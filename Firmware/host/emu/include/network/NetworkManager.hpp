@@ -0,0 +1,18 @@
+#pragma once
+#include "network/WiFiManager.hpp"
+#include "network/UpdateManager.hpp"
+
+/**
+ * @brief Menu emulator replacement of include/network/NetworkManager.hpp (fake managers, no network).
+ */
+class NetworkManager
+{
+public:
+    WiFiManager& getWiFiManager() { return wifi_manager; }
+
+    UpdateManager& getUpdateManager() { return update_manager; }
+
+private:
+    WiFiManager wifi_manager;
+    UpdateManager update_manager;
+};
@@ -0,0 +1,61 @@
+#pragma once
+#include "common/utils.hpp"
+#include <string>
+
+/**
+ * @brief Menu emulator replacement of include/network/UpdateManager.hpp : the update process is driven by the public
+ *        fields, checkForUpdate() and startUpdate() are only counted.
+ */
+class UpdateManager
+{
+public:
+    constexpr static const char* TAG = "UpdateManager";
+
+    enum class Status: uint8_t {
+        Done = 0,
+        FetchingUpdate,
+        DownloadingFirmware,
+        DownloadingFilesystem,
+        UpdatingFirmware,
+        UpdatingFilesystem,
+        VerifyingFirmware,
+        VerifyingFilesystem,
+        Rebooting,
+        ErrorUnreachable,
+        ErrorInvalidJson,
+        ErrorEmptyResponse,
+        ErrorFirmwareUpdateFailed,
+        ErrorFilesystemUpdateFailed,
+        ErrorUnknown,
+        ErrorPartitionNotFound,
+        ErrorHTTPClient,
+        ErrorOutOfBounds,
+        ErrorEraseStorage,
+        ErrorIntegrity,
+        ErrorNoManifestKey,
+    };
+
+    Status getStatus() { return status; }
+
+    float getProgress() { return progress; }
+
+    float getThroughput() { return throughput; }
+
+    std::string getLatestVersion() { return latest_version; }
+
+    bool isUpdateAvailable() { return update_available; }
+
+    bool isUpdatePending() { return false; }
+
+    ::Status checkForUpdate() { check_count++; return ::Status::Ok; }
+
+    ::Status startUpdate() { start_count++; return ::Status::Ok; }
+
+    Status status = Status::Done;
+    float progress = 0.0f;
+    float throughput = 0.0f;
+    bool update_available = false;
+    std::string latest_version;
+    uint32_t check_count = 0;
+    uint32_t start_count = 0;
+};
@@ -0,0 +1,38 @@
+#pragma once
+#include "common/utils.hpp"
+
+/**
+ * @brief Menu emulator replacement of include/network/WiFiManager.hpp : the getters used by the menus, returning
+ *        whatever is written in the public fields.
+ */
+class WiFiManager
+{
+public:
+    constexpr static const char* TAG = "WiFiManager";
+
+    enum State
+    {
+        Disconnected,
+        Connecting,
+        Connected
+    };
+
+    enum Mode
+    {
+        Station,
+        AccessPoint,
+    };
+
+    State getState() const { return state; }
+
+    Mode getMode() const { return mode; }
+
+    const char* getIPAddr() const { return ip_address; }
+
+    const char* getSSID() { return ssid; }
+
+    State state = Connected;
+    Mode mode = AccessPoint;
+    char ip_address[16] = "192.168.4.1";
+    char ssid[32] = "TNY-360";
+};
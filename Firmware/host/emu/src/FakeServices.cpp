@@ -0,0 +1,117 @@
+// Services the menus reach outside of the UI, replaced for the menu emulator (see include/emu/MenuEmulator.hpp) :
+// Robot and network managers (fake headers in include/), I2C buses, status LED, buttons, LittleFS and the motor
+// calibration.
+#include "emu/MenuEmulator.hpp"
+#include "Robot.hpp"
+#include "common/I2C.hpp"
+#include "common/LED.hpp"
+#include "common/LittleFS.hpp"
+#include "locomotion/MotorController.hpp"
+#include "ui/Button.hpp"
+#include <algorithm>
+
+/** ROBOT **/
+
+Robot& Robot::GetInstance()
+{
+    static Robot robot;
+    return robot;
+}
+
+/** I2C **/
+
+namespace I2C
+{
+    // handles are only compared, they don't point to anything
+    i2c_master_bus_handle_t handle_primary = reinterpret_cast<i2c_master_bus_handle_t>(1);
+    i2c_master_bus_handle_t handle_secondary = reinterpret_cast<i2c_master_bus_handle_t>(2);
+
+    static std::vector<uint8_t> devices_primary;
+    static std::vector<uint8_t> devices_secondary;
+
+    Status Init()
+    {
+        return Status::Ok;
+    }
+
+    Status Deinit()
+    {
+        return Status::Ok;
+    }
+
+    Status ProbeAddress(i2c_master_bus_handle_t handle, uint8_t address)
+    {
+        const std::vector<uint8_t>& devices = handle == handle_primary ? devices_primary : devices_secondary;
+        return std::find(devices.begin(), devices.end(), address) != devices.end() ? Status::Ok : Status::NotFound;
+    }
+}
+
+void Emu::SetI2CDevices(bool primary, const std::vector<uint8_t>& addresses)
+{
+    (primary ? I2C::devices_primary : I2C::devices_secondary) = addresses;
+}
+
+/** STATUS LED (nothing to show) **/
+
+namespace LED
+{
+    void LoopErrorCode(uint8_t errCode)
+    {
+    }
+
+    void clearErrorCode()
+    {
+    }
+}
+
+/** BUTTONS (no pins : presses come from MenuEmulator::press()) **/
+
+namespace Button
+{
+    Status Init(TaskHandle_t wake_task)
+    {
+        return Status::Ok;
+    }
+
+    int64_t Process(int64_t now_us)
+    {
+        return ButtonDebouncer::NO_DEADLINE;
+    }
+
+    bool PopEvent(InputEvent& event)
+    {
+        return false;
+    }
+
+    Stats GetStats()
+    {
+        return {};
+    }
+}
+
+/** LITTLEFS (no storage : files can't be opened) **/
+
+namespace LittleFS
+{
+    Status Init()
+    {
+        return Status::NotFound;
+    }
+
+    Status LoadFileContent(const char* path, char** out_buffer, size_t* out_size)
+    {
+        return Status::NotFound;
+    }
+}
+
+/** MOTOR CALIBRATION (src/locomotion/MotorControllerCalibration.cpp needs the motors and the control loop) **/
+
+Status MotorController::startCalibration()
+{
+    return Status::Ok;
+}
+
+Status MotorController::stopCalibration()
+{
+    return Status::Ok;
+}
@@ -0,0 +1,274 @@
+#include "emu/MenuEmulator.hpp"
+#include "drivers/ScreenDriver.hpp"
+#include "common/Log.hpp"
+#include "host/FakeDrivers.hpp"
+#include "host/HostClock.hpp"
+#include "host/HostSystem.hpp"
+#include <esp_timer.h>
+#include "network/UpdateManager.hpp"
+#include "Robot.hpp"
+#include <png.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+namespace Emu
+{
+    using Clock = std::chrono::steady_clock;
+
+    Status MenuEmulator::init(uint32_t seed)
+    {
+        HostClock::SetVirtual(true);
+        HostClock::Set(0);
+        HostSystem::SeedRandom(seed);
+        stats.clear();
+        for (ButtonDebouncer& button : buttons) button.reset(false, 0);
+        return ScreenDriver::Init();
+    }
+
+    void MenuEmulator::show(Menus::Menu* menu)
+    {
+        Menus::SetCurrentMenu(menu);
+        step();
+    }
+
+    void MenuEmulator::step(uint32_t frames)
+    {
+        for (uint32_t i = 0; i < frames; i++)
+        {
+            HostClock::Advance(SCREEN_REFRESH_RATE * 1000);
+
+            // button events due by now, before the cycle like in the menus task
+            ButtonDebouncer::Output output;
+            for (uint8_t b = 0; b < 2; b++)
+            {
+                while (buttons[b].poll(esp_timer_get_time(), output)) Menus::HandleInput(b, output.event);
+            }
+
+            Menus::Menu* menu = Menus::GetCurrentMenu();
+            uint32_t presented = ScreenDriver::GetUploadStats().presented;
+            Clock::time_point start = Clock::now();
+            Menus::Update();
+            double us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+
+            // Menu::render() presents a frame each time it draws one
+            if (menu == nullptr || ScreenDriver::GetUploadStats().presented == presented) continue;
+            RenderStats& menu_stats = stats[menu->getTitle()];
+            menu_stats.renders++;
+            menu_stats.total_us += us;
+            if (us > menu_stats.max_us) menu_stats.max_us = us;
+        }
+    }
+
+    void MenuEmulator::wait(uint32_t ms)
+    {
+        step((ms + SCREEN_REFRESH_RATE - 1) / SCREEN_REFRESH_RATE);
+    }
+
+    void MenuEmulator::press(Button button, bool long_press)
+    {
+        ButtonDebouncer& debouncer = buttons[static_cast<uint8_t>(button)];
+        debouncer.edge(true, esp_timer_get_time());
+        wait(PRESS_MS + (long_press ? BTN_LONG_PRESS_MS : 0));
+        debouncer.edge(false, esp_timer_get_time());
+        wait(BTN_DEBOUNCE_MS);
+    }
+
+    static bool parse_update_status(const std::string& name, UpdateManager::Status& status)
+    {
+        static const std::pair<const char*, UpdateManager::Status> names[] = {
+            { "done", UpdateManager::Status::Done },
+            { "fetching", UpdateManager::Status::FetchingUpdate },
+            { "downloading-firmware", UpdateManager::Status::DownloadingFirmware },
+            { "downloading-filesystem", UpdateManager::Status::DownloadingFilesystem },
+            { "updating-firmware", UpdateManager::Status::UpdatingFirmware },
+            { "updating-filesystem", UpdateManager::Status::UpdatingFilesystem },
+            { "rebooting", UpdateManager::Status::Rebooting },
+            { "unreachable", UpdateManager::Status::ErrorUnreachable },
+            { "invalid-json", UpdateManager::Status::ErrorInvalidJson },
+            { "integrity", UpdateManager::Status::ErrorIntegrity },
+            { "no-manifest-key", UpdateManager::Status::ErrorNoManifestKey },
+        };
+        for (const auto& entry : names)
+        {
+            if (name == entry.first)
+            {
+                status = entry.second;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    Status MenuEmulator::run(const std::string& script, std::vector<Snapshot>& snapshots)
+    {
+        std::istringstream lines(script);
+        std::string line;
+        uint32_t line_number = 0;
+        while (std::getline(lines, line))
+        {
+            line_number++;
+            line = line.substr(0, line.find('#'));
+            std::istringstream words(line);
+            std::string command;
+            if (!(words >> command)) continue;
+
+            bool valid = true;
+            if (command == "left" || command == "right" || command == "left-long" || command == "right-long")
+            {
+                press(command[0] == 'l' ? Button::Left : Button::Right, command.find("-long") != std::string::npos);
+            }
+            else if (command == "wait")
+            {
+                uint32_t ms = 0;
+                valid = static_cast<bool>(words >> ms);
+                if (valid) wait(ms);
+            }
+            else if (command == "show")
+            {
+                std::string name;
+                words >> name;
+                if (name == "splash") show(Menus::GetMenuSplash());
+                else if (name == "face") show(Menus::GetMenuFace());
+                else if (name == "error") show(Menus::GetMenuError());
+                else valid = false;
+            }
+            else if (command == "snap")
+            {
+                Snapshot snapshot;
+                valid = static_cast<bool>(words >> snapshot.name);
+                Menus::Menu* menu = Menus::GetCurrentMenu();
+                snapshot.menu = menu != nullptr ? menu->getTitle() : "";
+                snapshot.frame.assign(getPanel(), getPanel() + FRAME_SIZE);
+                if (valid) snapshots.push_back(snapshot);
+            }
+            else if (command == "wifi")
+            {
+                WiFiManager& wifi = Robot::GetInstance().getNetworkManager().getWiFiManager();
+                std::string mode, ip, ssid;
+                valid = static_cast<bool>(words >> mode >> ip >> ssid) && (mode == "ap" || mode == "sta");
+                if (valid)
+                {
+                    wifi.mode = mode == "ap" ? WiFiManager::AccessPoint : WiFiManager::Station;
+                    snprintf(wifi.ip_address, sizeof(wifi.ip_address), "%s", ip.c_str());
+                    snprintf(wifi.ssid, sizeof(wifi.ssid), "%s", ssid.c_str());
+                }
+            }
+            else if (command == "update")
+            {
+                UpdateManager& update = Robot::GetInstance().getNetworkManager().getUpdateManager();
+                std::string status, version;
+                valid = static_cast<bool>(words >> status) && parse_update_status(status, update.status);
+                float progress = 0.0f;
+                if (words >> progress) update.progress = progress;
+                update.update_available = static_cast<bool>(words >> version);
+                update.latest_version = version;
+            }
+            else if (command == "log")
+            {
+                std::string level, message;
+                words >> level;
+                std::getline(words >> std::ws, message);
+                if (level == "info") LOG_INFO("Emu", "%s", message.c_str());
+                else if (level == "warning") LOG_WARNING("Emu", "%s", message.c_str());
+                else if (level == "error") LOG_ERROR("Emu", "%s", message.c_str());
+                else if (level == "success") LOG_SUCCESS("Emu", "%s", message.c_str());
+                else valid = false;
+            }
+            else if (command == "i2c")
+            {
+                std::string bus;
+                std::vector<uint8_t> addresses;
+                valid = static_cast<bool>(words >> bus) && (bus == "primary" || bus == "secondary");
+                for (std::string address; words >> address;) addresses.push_back(strtoul(address.c_str(), nullptr, 0));
+                if (valid) SetI2CDevices(bus == "primary", addresses);
+            }
+            else
+            {
+                valid = false;
+            }
+
+            if (!valid)
+            {
+                fprintf(stderr, "Script line %u : invalid command '%s'\n", line_number, line.c_str());
+                return Status::InvalidParameters;
+            }
+        }
+        return Status::Ok;
+    }
+
+    const uint8_t* MenuEmulator::getPanel() const
+    {
+        return FakeDrivers::GetScreen().frame;
+    }
+
+    Status SavePNG(const char* path, const uint8_t* frame, uint8_t scale)
+    {
+        if (scale == 0) return Status::InvalidParameters;
+
+        const uint32_t width = SCREEN_WIDTH * scale;
+        const uint32_t height = SCREEN_HEIGHT * scale;
+        std::vector<uint8_t> pixels(width * height);
+        for (uint32_t y = 0; y < height; y++)
+        {
+            for (uint32_t x = 0; x < width; x++)
+            {
+                uint32_t sx = x / scale, sy = y / scale;
+                pixels[y * width + x] = (frame[(sy / 8) * SCREEN_WIDTH + sx] >> (sy % 8) & 1) ? 0xFF : 0x00;
+            }
+        }
+
+        png_image png;
+        memset(&png, 0, sizeof(png));
+        png.version = PNG_IMAGE_VERSION;
+        png.width = width;
+        png.height = height;
+        png.format = PNG_FORMAT_GRAY;
+        if (!png_image_write_to_file(&png, path, 0, pixels.data(), 0, nullptr))
+        {
+            fprintf(stderr, "Can't write %s : %s\n", path, png.message);
+            return Status::Failure;
+        }
+        return Status::Ok;
+    }
+
+    Status LoadPNG(const char* path, uint8_t* frame)
+    {
+        png_image png;
+        memset(&png, 0, sizeof(png));
+        png.version = PNG_IMAGE_VERSION;
+        if (!png_image_begin_read_from_file(&png, path))
+        {
+            return Status::NotFound;
+        }
+        if (png.width != SCREEN_WIDTH || png.height != SCREEN_HEIGHT)
+        {
+            png_image_free(&png);
+            return Status::InvalidParameters;
+        }
+        png.format = PNG_FORMAT_GRAY;
+        std::vector<uint8_t> pixels(PNG_IMAGE_SIZE(png));
+        if (!png_image_finish_read(&png, nullptr, pixels.data(), 0, nullptr))
+        {
+            return Status::InvalidParameters;
+        }
+
+        memset(frame, 0, FRAME_SIZE);
+        for (uint32_t y = 0; y < SCREEN_HEIGHT; y++)
+        {
+            for (uint32_t x = 0; x < SCREEN_WIDTH; x++)
+            {
+                if (pixels[y * SCREEN_WIDTH + x] >= 128) frame[(y / 8) * SCREEN_WIDTH + x] |= 1 << (y % 8);
+            }
+        }
+        return Status::Ok;
+    }
+
+    uint32_t CountDifferences(const uint8_t* a, const uint8_t* b)
+    {
+        uint32_t count = 0;
+        for (size_t i = 0; i < FRAME_SIZE; i++) count += __builtin_popcount(a[i] ^ b[i]);
+        return count;
+    }
+}
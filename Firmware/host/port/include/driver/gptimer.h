@@ -0,0 +1,5 @@
+#pragma once
+// Host build shim : the control loop timer only exists in ControlLoop.ESP.cpp,
+// host code drives ControlLoop::control_task() directly.
+
+typedef struct gptimer_t* gptimer_handle_t;
@@ -0,0 +1,5 @@
+#pragma once
+// Host build shim, backed by HostClock (see host/HostClock.hpp).
+#include <cstdint>
+
+uint32_t esp_log_timestamp();
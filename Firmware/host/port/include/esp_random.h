@@ -0,0 +1,7 @@
+#pragma once
+// Host build shim : pseudo-random numbers from a fixed seed, so runs can be replayed (see host/HostSystem.hpp).
+#include <cstddef>
+#include <cstdint>
+
+uint32_t esp_random();
+void esp_fill_random(void* buffer, size_t length);
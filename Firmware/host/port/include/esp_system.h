@@ -0,0 +1,4 @@
+#pragma once
+// Host build shim : restarts are only counted (see host/HostSystem.hpp), the caller keeps running.
+
+void esp_restart();
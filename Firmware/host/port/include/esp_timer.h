@@ -0,0 +1,6 @@
+#pragma once
+// Host build shim, backed by HostClock (see host/HostClock.hpp).
+#include <cstdint>
+#include "esp_attr.h"
+
+int64_t esp_timer_get_time();
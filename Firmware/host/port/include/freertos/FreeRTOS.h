@@ -0,0 +1,22 @@
+#pragma once
+// Host build shim of the FreeRTOS subset used by the portable firmware code.
+// Tasks are std::threads, one tick is one millisecond of wall-clock time.
+#include <cstdint>
+#include <cstddef>
+#include "esp_attr.h"
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE ((BaseType_t) 0)
+#define pdTRUE  ((BaseType_t) 1)
+#define pdFAIL  pdFALSE
+#define pdPASS  pdTRUE
+
+#define portMAX_DELAY ((TickType_t) 0xffffffffUL)
+#define portTICK_PERIOD_MS ((TickType_t) 1)
+#define pdMS_TO_TICKS(ms) ((TickType_t) (ms))
+
+#define configMAX_PRIORITIES 25
+#define tskIDLE_PRIORITY ((UBaseType_t) 0)
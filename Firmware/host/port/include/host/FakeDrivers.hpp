@@ -0,0 +1,87 @@
+#pragma once
+#include "drivers/MotorDriver.hpp"
+#include "drivers/AnalogDriver.hpp"
+#include "drivers/IMUDriver.hpp"
+#include "drivers/PowerDriver.hpp"
+#include "drivers/ScreenDriver.hpp"
+#include "common/config.hpp"
+
+/**
+ * @brief Default driver backends of the host build.
+ * @note They don't model any physics : inputs are whatever the test bench writes in them,
+ *       outputs are kept so they can be inspected. Use DriverName::SetBackend() for anything smarter.
+ */
+namespace FakeDrivers
+{
+    class Motor : public MotorDriver::Backend
+    {
+    public:
+        Status init() override { return Status::Ok; }
+        Status deinit() override { return Status::Ok; }
+        Status sendPWMs(const uint16_t* pwm_values) override;
+
+        /// @brief Last values sent by the driver, one per PCA9685 channel.
+        uint16_t pwm[16] = {0};
+        /// @brief Number of sendPWMs() calls.
+        uint32_t send_count = 0;
+    };
+
+    class Analog : public AnalogDriver::Backend
+    {
+    public:
+        Status init() override { return Status::Ok; }
+        Status deinit() override { return Status::Ok; }
+        Status select(AnalogDriver::Channel channel) override;
+        Status read(AnalogDriver::Value& out_value) override;
+
+        /// @brief Voltage returned for each multiplexer channel.
+        AnalogDriver::Value voltage[AnalogDriver::CHANNEL_COUNT] = {0};
+        AnalogDriver::Channel selected = 0;
+    };
+
+    class IMU : public IMUDriver::Backend
+    {
+    public:
+        Status init() override { return Status::Ok; }
+        Status deinit() override { return Status::Ok; }
+        Status read(IMUDriver::IMUData& out_data) override;
+
+        /// @brief Sample returned by read(), flat and still by default.
+        IMUDriver::IMUData data = { 0.f, 0.f, 1.f, 0.f, 0.f, 0.f };
+    };
+
+    class Power : public PowerDriver::Backend
+    {
+    public:
+        Status init() override { return Status::Ok; }
+        Status deinit() override { return Status::Ok; }
+        Status readVoltage(PowerDriver::Value& voltage_v) override;
+        Status readCurrent(PowerDriver::Value& current_a) override;
+        Status readPower(PowerDriver::Value& power_w) override;
+
+        PowerDriver::Data data = { 8.4f, 0.f, 0.f };
+    };
+
+    class Screen : public ScreenDriver::Backend
+    {
+    public:
+        Status init() override { return Status::Ok; }
+        Status deinit() override { return Status::Ok; }
+        Status setPower(bool on) override;
+        Status upload(const uint8_t* buffer, uint16_t width, uint16_t height) override;
+        Status uploadSpan(uint16_t page, uint16_t x, const uint8_t* data, uint16_t length) override;
+
+        /// @brief Panel content (full frames and spans applied), in the page-packed panel format.
+        uint8_t frame[SCREEN_WIDTH * SCREEN_HEIGHT / 8] = {0};
+        bool powered = false;
+        uint32_t upload_count = 0;
+        uint32_t span_count = 0;
+    };
+
+    /// @brief Instances used as default backends of the host build.
+    Motor& GetMotor();
+    Analog& GetAnalog();
+    IMU& GetIMU();
+    Power& GetPower();
+    Screen& GetScreen();
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief Time source of the host build (esp_timer_get_time, esp_log_timestamp, xTaskGetTickCount).
+ * @note In real-time mode the clock follows the monotonic system clock. In virtual mode it only moves
+ *       when Advance() is called, which makes simulations and benchmarks deterministic.
+ */
+namespace HostClock
+{
+    /**
+     * @brief Switch between real-time and virtual time.
+     * @param is_virtual true to freeze the clock at its current value and drive it with Advance().
+     */
+    void SetVirtual(bool is_virtual);
+
+    /**
+     * @brief Move the virtual clock forward (ignored in real-time mode).
+     * @param us Number of microseconds to add.
+     */
+    void Advance(int64_t us);
+
+    /**
+     * @brief Set the virtual clock (ignored in real-time mode), to start runs from the same time.
+     * @param us Time in microseconds since the program start.
+     */
+    void Set(int64_t us);
+
+    /**
+     * @brief Get the current time in microseconds since the program start.
+     */
+    int64_t Now();
+}
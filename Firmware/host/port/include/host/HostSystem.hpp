@@ -0,0 +1,18 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief System services of the host build (esp_random, esp_restart).
+ */
+namespace HostSystem
+{
+    /**
+     * @brief Restart the esp_random() sequence from a seed (0x360 at program start).
+     */
+    void SeedRandom(uint32_t seed);
+
+    /**
+     * @brief Number of esp_restart() calls since the program start.
+     */
+    uint32_t GetRestartCount();
+}
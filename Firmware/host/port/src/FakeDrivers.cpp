@@ -0,0 +1,84 @@
+#include "host/FakeDrivers.hpp"
+#include <cstring>
+
+namespace FakeDrivers
+{
+    Status Motor::sendPWMs(const uint16_t* pwm_values)
+    {
+        memcpy(pwm, pwm_values, sizeof(pwm));
+        send_count++;
+        return Status::Ok;
+    }
+
+    Status Analog::select(AnalogDriver::Channel channel)
+    {
+        if (channel >= AnalogDriver::CHANNEL_COUNT) return Status::InvalidParameters;
+        selected = channel;
+        return Status::Ok;
+    }
+
+    Status Analog::read(AnalogDriver::Value& out_value)
+    {
+        out_value = voltage[selected];
+        return Status::Ok;
+    }
+
+    Status IMU::read(IMUDriver::IMUData& out_data)
+    {
+        out_data = data;
+        return Status::Ok;
+    }
+
+    Status Power::readVoltage(PowerDriver::Value& voltage_v)
+    {
+        voltage_v = data.voltage_v;
+        return Status::Ok;
+    }
+
+    Status Power::readCurrent(PowerDriver::Value& current_a)
+    {
+        current_a = data.current_a;
+        return Status::Ok;
+    }
+
+    Status Power::readPower(PowerDriver::Value& power_w)
+    {
+        power_w = data.power_w;
+        return Status::Ok;
+    }
+
+    Status Screen::setPower(bool on)
+    {
+        powered = on;
+        return Status::Ok;
+    }
+
+    Status Screen::upload(const uint8_t* buffer, uint16_t width, uint16_t height)
+    {
+        if (width != SCREEN_WIDTH || height != SCREEN_HEIGHT) return Status::InvalidParameters;
+        memcpy(frame, buffer, sizeof(frame));
+        upload_count++;
+        return Status::Ok;
+    }
+
+    Status Screen::uploadSpan(uint16_t page, uint16_t x, const uint8_t* data, uint16_t length)
+    {
+        if (page >= SCREEN_HEIGHT / 8 || x + length > SCREEN_WIDTH) return Status::InvalidParameters;
+        memcpy(&frame[page * SCREEN_WIDTH + x], data, length);
+        span_count++;
+        return Status::Ok;
+    }
+
+    Motor& GetMotor() { static Motor motor; return motor; }
+    Analog& GetAnalog() { static Analog analog; return analog; }
+    IMU& GetIMU() { static IMU imu; return imu; }
+    Power& GetPower() { static Power power; return power; }
+    Screen& GetScreen() { static Screen screen; return screen; }
+}
+
+// Default backends of the host build (the robot ones live in the drivers' .ESP.cpp files)
+MotorDriver::Backend& MotorDriver::GetDefaultBackend() { return FakeDrivers::GetMotor(); }
+AnalogDriver::Backend& AnalogDriver::GetDefaultBackend() { return FakeDrivers::GetAnalog(); }
+IMUDriver::Backend& IMUDriver::GetDefaultBackend() { return FakeDrivers::GetIMU(); }
+PowerDriver::Backend& PowerDriver::GetDefaultBackend() { return FakeDrivers::GetPower(); }
+ScreenDriver::Backend& ScreenDriver::GetDefaultBackend() { return FakeDrivers::GetScreen(); }
@@ -0,0 +1,345 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "host/HostClock.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*** TASKS ***/
+
+struct HostTask
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    uint32_t notify_count = 0;
+    std::atomic<bool> delete_requested{false};
+};
+
+namespace
+{
+    // Thrown by vTaskDelete(nullptr) to unwind the task thread
+    struct TaskExit {};
+
+    thread_local HostTask* current_task = nullptr;
+
+    bool delete_requested()
+    {
+        return current_task != nullptr && current_task->delete_requested;
+    }
+
+    /**
+     * Blocking wait used by all the primitives. Waits are sliced so that a task deleted
+     * by another one (vTaskDelete(handle)) leaves as soon as possible, like on FreeRTOS.
+     */
+    template<typename Predicate>
+    bool wait_for(std::condition_variable& cv, std::unique_lock<std::mutex>& lock, TickType_t ticks, Predicate pred)
+    {
+        constexpr auto SLICE = std::chrono::milliseconds(10);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(ticks * portTICK_PERIOD_MS);
+
+        while (!pred())
+        {
+            if (delete_requested())
+            {
+                throw TaskExit();
+            }
+            if (ticks != portMAX_DELAY && std::chrono::steady_clock::now() >= deadline)
+            {
+                return false;
+            }
+            auto until = std::chrono::steady_clock::now() + SLICE;
+            if (ticks != portMAX_DELAY && deadline < until) until = deadline;
+            cv.wait_until(lock, until);
+        }
+        return true;
+    }
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack_depth, void* params,
+                                   UBaseType_t priority, TaskHandle_t* out_handle, BaseType_t core_id)
+{
+    HostTask* task = new HostTask();
+    if (out_handle != nullptr)
+    {
+        *out_handle = task;
+    }
+
+    std::thread([fn, params, task]() {
+        current_task = task;
+        try
+        {
+            fn(params);
+        }
+        catch (const TaskExit&)
+        {
+        }
+        // NOTE : The task object is leaked on purpose, handles may outlive the thread (like on FreeRTOS)
+    }).detach();
+
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack_depth, void* params,
+                       UBaseType_t priority, TaskHandle_t* out_handle)
+{
+    return xTaskCreatePinnedToCore(fn, name, stack_depth, params, priority, out_handle, -1);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task == nullptr || task == current_task)
+    {
+        if (current_task != nullptr)
+        {
+            throw TaskExit();
+        }
+        return; // deleting the main thread makes no sense on the host
+    }
+
+    std::lock_guard<std::mutex> lock(task->mutex);
+    task->delete_requested = true;
+    task->cv.notify_all();
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::unique_lock<std::mutex> lock(mutex);
+    wait_for(cv, lock, ticks, []() { return false; });
+}
+
+BaseType_t xTaskDelayUntil(TickType_t* previous_wake_time, TickType_t increment)
+{
+    TickType_t wake_time = *previous_wake_time + increment;
+    TickType_t now = xTaskGetTickCount();
+    *previous_wake_time = wake_time;
+    if (static_cast<int32_t>(wake_time - now) <= 0) return pdFALSE; // already late
+    vTaskDelay(wake_time - now);
+    return pdTRUE;
+}
+
+TickType_t xTaskGetTickCount()
+{
+    return static_cast<TickType_t>(HostClock::Now() / 1000 / portTICK_PERIOD_MS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    return current_task;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait)
+{
+    HostTask* task = current_task;
+    if (task == nullptr) return 0;
+
+    std::unique_lock<std::mutex> lock(task->mutex);
+    wait_for(task->cv, lock, ticks_to_wait, [task]() { return task->notify_count > 0; });
+
+    uint32_t value = task->notify_count;
+    if (value > 0)
+    {
+        task->notify_count = clear_on_exit ? 0 : value - 1;
+    }
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    if (task == nullptr) return pdFAIL;
+
+    std::lock_guard<std::mutex> lock(task->mutex);
+    task->notify_count++;
+    task->cv.notify_all();
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higher_priority_task_woken)
+{
+    xTaskNotifyGive(task);
+    if (higher_priority_task_woken != nullptr)
+    {
+        *higher_priority_task_woken = pdFALSE;
+    }
+}
+
+/*** QUEUES ***/
+
+struct HostQueue
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t length;
+    size_t item_size;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    HostQueue* queue = new HostQueue();
+    queue->length = length;
+    queue->item_size = item_size;
+    return queue;
+}
+
+QueueHandle_t xQueueCreateStatic(UBaseType_t length, UBaseType_t item_size, uint8_t* storage, StaticQueue_t* queue_buffer)
+{
+    // storage is only needed on target, the host queue owns its items
+    return xQueueCreate(length, item_size);
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+    // NOTE : Intentionally leaked, a deleted task may still be leaving a wait on it
+    //        (target code deletes the task then its queues right away).
+    (void) queue;
+}
+
+static BaseType_t queue_push(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait, bool overwrite)
+{
+    if (queue == nullptr) return pdFAIL;
+
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (overwrite)
+    {
+        queue->items.clear();
+    }
+    else if (!wait_for(queue->cv, lock, ticks_to_wait, [queue]() { return queue->items.size() < queue->length; }))
+    {
+        return pdFAIL;
+    }
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(item);
+    queue->items.emplace_back(bytes, bytes + queue->item_size);
+    queue->cv.notify_all();
+    return pdPASS;
+}
+
+static BaseType_t queue_pop(QueueHandle_t queue, void* out_item, TickType_t ticks_to_wait, bool remove)
+{
+    if (queue == nullptr) return pdFAIL;
+
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!wait_for(queue->cv, lock, ticks_to_wait, [queue]() { return !queue->items.empty(); }))
+    {
+        return pdFAIL;
+    }
+
+    memcpy(out_item, queue->items.front().data(), queue->item_size);
+    if (remove)
+    {
+        queue->items.pop_front();
+        queue->cv.notify_all();
+    }
+    return pdPASS;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait)
+{
+    return queue_push(queue, item, ticks_to_wait, false);
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t queue, const void* item, TickType_t ticks_to_wait)
+{
+    return queue_push(queue, item, ticks_to_wait, false);
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* higher_priority_task_woken)
+{
+    if (higher_priority_task_woken != nullptr)
+    {
+        *higher_priority_task_woken = pdFALSE;
+    }
+    return queue_push(queue, item, 0, false);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item)
+{
+    return queue_push(queue, item, 0, true);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* out_item, TickType_t ticks_to_wait)
+{
+    return queue_pop(queue, out_item, ticks_to_wait, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void* out_item, TickType_t ticks_to_wait)
+{
+    return queue_pop(queue, out_item, ticks_to_wait, false);
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    if (queue == nullptr) return 0;
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return queue->items.size();
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue)
+{
+    if (queue == nullptr) return pdFAIL;
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    queue->items.clear();
+    queue->cv.notify_all();
+    return pdPASS;
+}
+
+/*** SEMAPHORES ***/
+
+struct HostSemaphore
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool available;
+};
+
+SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+    HostSemaphore* semaphore = new HostSemaphore();
+    semaphore->available = true;
+    return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+    HostSemaphore* semaphore = new HostSemaphore();
+    semaphore->available = false;
+    return semaphore;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    // NOTE : Intentionally leaked, same reason as vQueueDelete()
+    (void) semaphore;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait)
+{
+    if (semaphore == nullptr) return pdFAIL;
+
+    std::unique_lock<std::mutex> lock(semaphore->mutex);
+    if (!wait_for(semaphore->cv, lock, ticks_to_wait, [semaphore]() { return semaphore->available; }))
+    {
+        return pdFAIL;
+    }
+    semaphore->available = false;
+    return pdPASS;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    if (semaphore == nullptr) return pdFAIL;
+
+    std::lock_guard<std::mutex> lock(semaphore->mutex);
+    semaphore->available = true;
+    semaphore->cv.notify_one();
+    return pdPASS;
+}
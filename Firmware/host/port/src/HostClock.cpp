@@ -0,0 +1,57 @@
+#include "host/HostClock.hpp"
+#include "esp_timer.h"
+#include "esp_log_timestamp.h"
+#include <atomic>
+#include <chrono>
+
+namespace HostClock
+{
+    static const auto start_time = std::chrono::steady_clock::now();
+    static std::atomic<bool> virtual_mode{false};
+    static std::atomic<int64_t> virtual_time_us{0};
+
+    static int64_t real_now()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count();
+    }
+
+    void SetVirtual(bool is_virtual)
+    {
+        if (is_virtual && !virtual_mode)
+        {
+            virtual_time_us = real_now();
+        }
+        virtual_mode = is_virtual;
+    }
+
+    void Advance(int64_t us)
+    {
+        if (virtual_mode)
+        {
+            virtual_time_us += us;
+        }
+    }
+
+    void Set(int64_t us)
+    {
+        if (virtual_mode)
+        {
+            virtual_time_us = us;
+        }
+    }
+
+    int64_t Now()
+    {
+        return virtual_mode ? virtual_time_us.load() : real_now();
+    }
+}
+
+int64_t esp_timer_get_time()
+{
+    return HostClock::Now();
+}
+
+uint32_t esp_log_timestamp()
+{
+    return static_cast<uint32_t>(HostClock::Now() / 1000);
+}
@@ -0,0 +1,82 @@
+#include "common/NVS.hpp"
+#include "nvs_flash.h"
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// In-memory NVS for host builds : same API as src/common/NVS.cpp, nothing survives the process.
+namespace NVS
+{
+    using Namespace = std::map<std::string, std::vector<uint8_t>>;
+
+    static std::mutex storage_mutex;
+    static std::map<std::string, Namespace> storage;
+
+    class HandleImpl : public Handle
+    {
+    public:
+        HandleImpl(Namespace& ns) : m_namespace(ns) {}
+
+        Status get(const char* key, void* out_value, size_t* length) override
+        {
+            std::lock_guard<std::mutex> lock(storage_mutex);
+            auto it = m_namespace.find(key);
+            if (it == m_namespace.end()) return Status::NotFound;
+            if (it->second.size() > *length) return Status::Unknown; // like ESP_ERR_NVS_INVALID_LENGTH
+
+            memcpy(out_value, it->second.data(), it->second.size());
+            *length = it->second.size();
+            return Status::Ok;
+        }
+
+        Status set(const char* key, const void* value, size_t length) override
+        {
+            std::lock_guard<std::mutex> lock(storage_mutex);
+            const uint8_t* bytes = static_cast<const uint8_t*>(value);
+            m_namespace[key].assign(bytes, bytes + length);
+            return Status::Ok;
+        }
+
+        Status erase(const char* key) override
+        {
+            std::lock_guard<std::mutex> lock(storage_mutex);
+            return m_namespace.erase(key) > 0 ? Status::Ok : Status::NotFound;
+        }
+
+        Namespace& m_namespace;
+    };
+
+    Status Init()
+    {
+        return Status::Ok;
+    }
+
+    Status Open(const char* namespace_name, Handle** out_handle)
+    {
+        if (namespace_name == nullptr || out_handle == nullptr) return Status::InvalidParameters;
+
+        std::lock_guard<std::mutex> lock(storage_mutex);
+        *out_handle = new HandleImpl(storage[namespace_name]);
+        return Status::Ok;
+    }
+
+    void Close(Handle* handle)
+    {
+        delete handle;
+    }
+}
+
+esp_err_t nvs_flash_init()
+{
+    return ESP_OK;
+}
+
+esp_err_t nvs_flash_erase()
+{
+    // namespaces are emptied, not removed : open handles keep a reference to them
+    std::lock_guard<std::mutex> lock(NVS::storage_mutex);
+    for (auto& entry : NVS::storage) entry.second.clear();
+    return ESP_OK;
+}
@@ -0,0 +1,26 @@
+#include "audio/Speaker.hpp"
+#include "common/config.hpp"
+#include <chrono>
+#include <thread>
+
+// Host implementation of the speaker : samples are dropped, writeSamples() only keeps the audio pace
+// like the I2S DMA does on the robot (see src/audio/Speaker.cpp)
+
+Speaker::Speaker()
+{
+}
+
+Status Speaker::init()
+{
+    return Status::Ok;
+}
+
+Status Speaker::deinit()
+{
+    return Status::Ok;
+}
+
+void Speaker::writeSamples(const Sample* samples, size_t sampleCount)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(sampleCount * 1'000'000 / SPEAKER_SAMPLE_RATE_HZ));
+}
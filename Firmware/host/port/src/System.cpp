@@ -0,0 +1,47 @@
+#include "host/HostSystem.hpp"
+#include "esp_random.h"
+#include "esp_system.h"
+#include "common/Log.hpp"
+#include <atomic>
+#include <mutex>
+#include <random>
+
+namespace HostSystem
+{
+    static std::mutex random_mutex;
+    static std::mt19937 random_engine(0x360);
+    static std::atomic<uint32_t> restart_count{0};
+
+    void SeedRandom(uint32_t seed)
+    {
+        std::lock_guard<std::mutex> lock(random_mutex);
+        random_engine.seed(seed);
+    }
+
+    uint32_t GetRestartCount()
+    {
+        return restart_count;
+    }
+}
+
+uint32_t esp_random()
+{
+    std::lock_guard<std::mutex> lock(HostSystem::random_mutex);
+    return HostSystem::random_engine();
+}
+
+void esp_fill_random(void* buffer, size_t length)
+{
+    uint8_t* bytes = static_cast<uint8_t*>(buffer);
+    for (size_t i = 0; i < length; i += 4)
+    {
+        uint32_t value = esp_random();
+        for (size_t j = 0; j < 4 && i + j < length; j++) bytes[i + j] = value >> (8 * j);
+    }
+}
+
+void esp_restart()
+{
+    LOG_INFO("HostSystem", "esp_restart() called, ignored on the host");
+    HostSystem::restart_count++;
+}
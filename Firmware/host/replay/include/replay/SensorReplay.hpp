@@ -0,0 +1,139 @@
+#pragma once
+#include "common/SensorRecord.hpp"
+#include "drivers/AnalogDriver.hpp"
+#include "drivers/IMUDriver.hpp"
+#include "drivers/PowerDriver.hpp"
+#include "drivers/MotorDriver.hpp"
+#include <chrono>
+#include <vector>
+
+namespace Replay
+{
+    /**
+     * @brief Plays a sensor recording (see SensorRecord.hpp) back through the analog, IMU and power drivers.
+     *
+     * The whole file is loaded in memory and grouped by control tick (a tick starts with an Analog record),
+     * so stepping through it costs nothing next to the estimators being measured.
+     *
+     * Typical use :
+     * @code
+     * Replay::SensorReplay replay;
+     * replay.open("walk.rec");
+     * replay.install();    // before the drivers are initialized
+     * while (replay.step()) { AnalogDriver::ReadAllChannels(); IMUDriver::ReadData(); ... }
+     * @endcode
+     */
+    class SensorReplay
+    {
+    public:
+        struct Tick
+        {
+            int64_t timestamp_us = 0;
+            AnalogDriver::Value analog[AnalogDriver::CHANNEL_COUNT] = {};
+            IMUDriver::IMUData imu = {};
+            /// @brief Last power sample (power is recorded at a lower rate)
+            PowerDriver::Data power = {};
+            /// @brief Duty cycles sent at the end of the tick (0 if none were recorded)
+            MotorDriver::Value duty_cycles[MotorDriver::CHANNEL_COUNT] = {};
+            bool has_motor = false;
+            /// @brief Ground truth, if the recording (or the reference file) has some
+            SensorRecord::ReferencePayload reference = {};
+            bool has_reference = false;
+        };
+
+        SensorReplay();
+
+        /**
+         * @brief Load a recording.
+         */
+        Status open(const char* path);
+
+        /**
+         * @brief Load ground truth records from another file, matched to the ticks by timestamp.
+         */
+        Status loadReference(const char* path);
+
+        /**
+         * @brief Plug the replay under the analog, IMU and power drivers.
+         * @note Must be called before the drivers are initialized.
+         */
+        Status install();
+
+        /**
+         * @brief Restore the default driver backends.
+         */
+        void uninstall();
+
+        /**
+         * @brief Replay speed : 1 is real time, 0 (default) is as fast as possible.
+         */
+        void setSpeed(float speed) { this->speed = speed; }
+
+        /**
+         * @brief Go back to the beginning of the recording.
+         */
+        void rewind() { next_tick = 0; }
+
+        /**
+         * @brief Make the next tick the current one : the drivers now read its samples and the host clock is moved to its timestamp.
+         * @return false at the end of the recording.
+         */
+        bool step();
+
+        const Tick& getTick() const { return ticks[current_tick]; }
+        const std::vector<Tick>& getTicks() const { return ticks; }
+        const SensorRecord::FileHeader& getFileHeader() const { return file_header; }
+        bool hasReference() const { return reference_count > 0; }
+
+    private:
+        class AnalogBackend : public AnalogDriver::Backend
+        {
+        public:
+            AnalogBackend(SensorReplay& replay) : replay(replay) {}
+            Status init() override { return Status::Ok; }
+            Status deinit() override { return Status::Ok; }
+            Status select(AnalogDriver::Channel channel) override { selected = channel; return Status::Ok; }
+            Status read(AnalogDriver::Value& out_value) override;
+        private:
+            SensorReplay& replay;
+            AnalogDriver::Channel selected = 0;
+        };
+
+        class IMUBackend : public IMUDriver::Backend
+        {
+        public:
+            IMUBackend(SensorReplay& replay) : replay(replay) {}
+            Status init() override { return Status::Ok; }
+            Status deinit() override { return Status::Ok; }
+            Status read(IMUDriver::IMUData& out_data) override;
+        private:
+            SensorReplay& replay;
+        };
+
+        class PowerBackend : public PowerDriver::Backend
+        {
+        public:
+            PowerBackend(SensorReplay& replay) : replay(replay) {}
+            Status init() override { return Status::Ok; }
+            Status deinit() override { return Status::Ok; }
+            Status readVoltage(PowerDriver::Value& voltage_v) override;
+            Status readCurrent(PowerDriver::Value& current_a) override;
+            Status readPower(PowerDriver::Value& power_w) override;
+        private:
+            SensorReplay& replay;
+        };
+
+        AnalogBackend analog_backend;
+        IMUBackend imu_backend;
+        PowerBackend power_backend;
+
+        SensorRecord::FileHeader file_header = {};
+        std::vector<Tick> ticks;
+        size_t reference_count = 0;
+        size_t current_tick = 0;
+        size_t next_tick = 0;
+
+        float speed = 0.f;
+        std::chrono::steady_clock::time_point wall_start;
+    };
+}
@@ -0,0 +1,160 @@
+#include "replay/SensorReplay.hpp"
+#include "host/HostClock.hpp"
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace Replay
+{
+    SensorReplay::SensorReplay()
+        : analog_backend(*this), imu_backend(*this), power_backend(*this)
+    {
+    }
+
+    Status SensorReplay::open(const char* path)
+    {
+        SensorRecord::Reader reader;
+        if (Status err = reader.open(path); err != Status::Ok)
+        {
+            return err;
+        }
+        file_header = reader.getFileHeader();
+
+        ticks.clear();
+        reference_count = 0;
+        Tick tick;
+        bool started = false;
+
+        SensorRecord::RecordHeader header;
+        uint8_t payload[SensorRecord::MAX_PAYLOAD_SIZE];
+        while (reader.next(header, payload) == Status::Ok)
+        {
+            switch (header.type)
+            {
+                case SensorRecord::Type::Analog:
+                    if (started) ticks.push_back(tick);
+                    started = true;
+                    tick.timestamp_us = header.timestamp_us;
+                    tick.has_motor = false;
+                    tick.has_reference = false;
+                    memcpy(tick.analog, payload, std::min<size_t>(header.length, sizeof(tick.analog)));
+                    break;
+                case SensorRecord::Type::IMU:
+                    memcpy(&tick.imu, payload, std::min<size_t>(header.length, sizeof(tick.imu)));
+                    break;
+                case SensorRecord::Type::Power:
+                    memcpy(&tick.power, payload, std::min<size_t>(header.length, sizeof(tick.power)));
+                    break;
+                case SensorRecord::Type::Motor:
+                    memcpy(tick.duty_cycles, payload, std::min<size_t>(header.length, sizeof(tick.duty_cycles)));
+                    tick.has_motor = true;
+                    break;
+                case SensorRecord::Type::Reference:
+                    memcpy(&tick.reference, payload, std::min<size_t>(header.length, sizeof(tick.reference)));
+                    tick.has_reference = true;
+                    reference_count++;
+                    break;
+                default: // unknown record, skip it
+                    break;
+            }
+        }
+        if (started) ticks.push_back(tick);
+
+        rewind();
+        return ticks.empty() ? Status::NotFound : Status::Ok;
+    }
+
+    Status SensorReplay::loadReference(const char* path)
+    {
+        SensorRecord::Reader reader;
+        if (Status err = reader.open(path); err != Status::Ok)
+        {
+            return err;
+        }
+
+        // Both files are sorted by time : attach each reference to the last tick started before it
+        size_t t = 0;
+        SensorRecord::RecordHeader header;
+        uint8_t payload[SensorRecord::MAX_PAYLOAD_SIZE];
+        while (reader.next(header, payload) == Status::Ok)
+        {
+            if (header.type != SensorRecord::Type::Reference) continue;
+            while (t + 1 < ticks.size() && ticks[t + 1].timestamp_us <= header.timestamp_us) t++;
+            if (t >= ticks.size() || ticks[t].timestamp_us > header.timestamp_us) continue;
+
+            if (!ticks[t].has_reference) reference_count++;
+            memcpy(&ticks[t].reference, payload, std::min<size_t>(header.length, sizeof(ticks[t].reference)));
+            ticks[t].has_reference = true;
+        }
+        return reference_count > 0 ? Status::Ok : Status::NotFound;
+    }
+
+    Status SensorReplay::install()
+    {
+        if (Status err = AnalogDriver::SetBackend(&analog_backend); err != Status::Ok) return err;
+        if (Status err = IMUDriver::SetBackend(&imu_backend); err != Status::Ok) return err;
+        if (Status err = PowerDriver::SetBackend(&power_backend); err != Status::Ok) return err;
+        return Status::Ok;
+    }
+
+    void SensorReplay::uninstall()
+    {
+        AnalogDriver::SetBackend(nullptr);
+        IMUDriver::SetBackend(nullptr);
+        PowerDriver::SetBackend(nullptr);
+    }
+
+    bool SensorReplay::step()
+    {
+        if (next_tick >= ticks.size())
+        {
+            return false;
+        }
+        current_tick = next_tick++;
+        const Tick& tick = ticks[current_tick];
+
+        if (speed > 0.f)
+        {
+            if (current_tick == 0) wall_start = std::chrono::steady_clock::now();
+            int64_t elapsed_us = static_cast<int64_t>((tick.timestamp_us - ticks[0].timestamp_us) / speed);
+            std::this_thread::sleep_until(wall_start + std::chrono::microseconds(elapsed_us));
+        }
+
+        int64_t now_us = HostClock::Now();
+        if (tick.timestamp_us > now_us)
+        {
+            HostClock::Advance(tick.timestamp_us - now_us);
+        }
+        return true;
+    }
+
+    Status SensorReplay::AnalogBackend::read(AnalogDriver::Value& out_value)
+    {
+        out_value = replay.getTick().analog[selected];
+        return Status::Ok;
+    }
+
+    Status SensorReplay::IMUBackend::read(IMUDriver::IMUData& out_data)
+    {
+        out_data = replay.getTick().imu;
+        return Status::Ok;
+    }
+
+    Status SensorReplay::PowerBackend::readVoltage(PowerDriver::Value& voltage_v)
+    {
+        voltage_v = replay.getTick().power.voltage_v;
+        return Status::Ok;
+    }
+
+    Status SensorReplay::PowerBackend::readCurrent(PowerDriver::Value& current_a)
+    {
+        current_a = replay.getTick().power.current_a;
+        return Status::Ok;
+    }
+
+    Status SensorReplay::PowerBackend::readPower(PowerDriver::Value& power_w)
+    {
+        power_w = replay.getTick().power.power_w;
+        return Status::Ok;
+    }
+}
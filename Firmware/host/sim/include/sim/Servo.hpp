@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+
+namespace Sim
+{
+    /**
+     * @brief Hobby servo model : the command goes through a transport delay, then a first order
+     *        response whose speed is clamped (MG996R-like by default).
+     * @note A servo without PWM (duty cycle of 0) is limp : it keeps its angle and produces no torque.
+     */
+    class Servo
+    {
+    public:
+        struct Config
+        {
+            /// @brief Delay between a PWM change and the start of the movement (in s)
+            float latency_s = 0.02f;
+            /// @brief Time constant of the position loop (in s)
+            float time_constant_s = 0.03f;
+            /// @brief Maximum output speed (in rad/s), 0.17s/60deg for a MG996R
+            float max_speed_rad_s = 6.0f;
+        };
+
+        Servo();
+        Servo(Config config, float angle_rad);
+
+        /**
+         * @brief Set the commanded angle (takes effect after the latency).
+         * @param powered false if the servo receives no PWM.
+         */
+        void command(float angle_rad, bool powered);
+
+        /**
+         * @brief Advance the servo by dt seconds.
+         */
+        void update(float dt);
+
+        float getAngle() const { return angle_rad; }
+        float getVelocity() const { return velocity_rad_s; }
+        bool isPowered() const { return powered; }
+
+    private:
+        constexpr static int DELAY_SLOTS = 64;
+
+        struct DelayedCommand
+        {
+            float time_s;
+            float angle_rad;
+            bool powered;
+        };
+
+        Config config;
+        float time_s = 0.f;
+        float angle_rad = 0.f;
+        float velocity_rad_s = 0.f;
+        float target_rad = 0.f;
+        bool powered = false;
+
+        // ring of pending commands, oldest first
+        DelayedCommand pending[DELAY_SLOTS];
+        uint8_t pending_head = 0;
+        uint8_t pending_count = 0;
+    };
+}
@@ -0,0 +1,246 @@
+#pragma once
+#include "sim/Servo.hpp"
+#include "locomotion/Body.hpp"
+#include "locomotion/KinematicsEngine.hpp"
+#include "drivers/MotorDriver.hpp"
+#include "drivers/AnalogDriver.hpp"
+#include "drivers/IMUDriver.hpp"
+#include "drivers/PowerDriver.hpp"
+#include "common/geometry.hpp"
+#include <random>
+
+namespace Sim
+{
+    /**
+     * @brief Lightweight physics of the robot, plugged under the drivers so the firmware runs unmodified on top of it.
+     *
+     * - The 12 leg servos are Servo models driven by the PCA9685 PWM values, and report their angle on the
+     *   feedback ADC channels (using the default MotorController calibration).
+     * - The trunk is a rigid box carrying all the mass (legs are massless), feet touch a flat ground through
+     *   spring-damper contacts with regularized Coulomb friction.
+     * - Sensors : MPU6050-like accelerations / angular rates, foot switches voltages, INA219 battery readings
+     *   (servo current estimated from the joint torques).
+     *
+     * Typical use :
+     * @code
+     * Sim::Simulation sim(body, control_loop.getKinematicsEngine());
+     * sim.install();   // before body.init()
+     * body.init(); body.enable();
+     * while (...) { control_loop.control_task(); sim.step(); }
+     * @endcode
+     */
+    class Simulation
+    {
+    public:
+        struct Config
+        {
+            /// @brief Total mass of the robot (in kg)
+            float mass_kg = 1.6f;
+            /// @brief Trunk box dimensions, used for the inertia (in m)
+            Vec3f trunk_size_m = Vec3f(0.24f, 0.13f, 0.07f);
+            /// @brief Leg servos model
+            Servo::Config servo;
+
+            /// @brief Ground contact stiffness (in N/m) and damping (in N.s/m), per foot
+            float ground_stiffness = 4000.f;
+            float ground_damping = 60.f;
+            /// @brief Friction coefficient between feet and ground
+            float friction = 0.8f;
+            /// @brief Sliding speed under which friction is proportional to speed (in m/s)
+            float friction_slip_speed = 0.005f;
+
+            /// @brief Physics steps per control tick
+            int substeps = 10;
+
+            /// @brief Sensor noises (standard deviation)
+            float accel_noise_g = 0.01f;
+            float gyro_noise_ds = 0.2f;
+            float feedback_noise_v = 0.004f;
+
+            /// @brief Battery model
+            float battery_voltage_v = 11.1f;
+            float battery_resistance_ohm = 0.05f;
+            /// @brief Electronics consumption outside of the servos (in W)
+            float base_power_w = 1.5f;
+            /// @brief Servo rail voltage and regulator efficiency
+            float servo_voltage_v = 6.0f;
+            float regulator_efficiency = 0.85f;
+            /// @brief Servo current model : idle + torque / kt + speed * ks
+            float servo_idle_current_a = 0.01f;
+            float servo_torque_constant_nm_a = 0.36f;
+            float servo_speed_current_a_s_rad = 0.03f;
+
+            /// @brief Seed of the sensor noises
+            uint32_t seed = 1;
+        };
+
+        struct Metrics
+        {
+            /// @brief Simulated time (in s)
+            float time_s = 0.f;
+            /// @brief Horizontal distance from the start position (in m)
+            float distance_m = 0.f;
+            /// @brief Displacement along the initial heading (in m)
+            float forward_m = 0.f;
+            /// @brief RMS of the angle between the trunk and the vertical (in rad)
+            float tilt_rms_rad = 0.f;
+            /// @brief Maximum tilt seen (in rad)
+            float tilt_max_rad = 0.f;
+            /// @brief Battery energy used (in J)
+            float energy_j = 0.f;
+            /// @brief Dimensionless cost of transport (energy / (m.g.distance))
+            float cost_of_transport = 0.f;
+            /// @brief The trunk went over 60 degrees of tilt or touched the ground
+            bool fell = false;
+        };
+
+        Simulation(Body& body, const KinematicsEngine& kinematics);
+
+        Simulation(Body& body, const KinematicsEngine& kinematics, Config config);
+
+        /**
+         * @brief Plug the simulation under the drivers, and store the calibration it emulates in NVS.
+         * @note Must be called before Body::init(). The robot starts standing on the default feet positions.
+         */
+        Status install();
+
+        /**
+         * @brief Unplug the simulation (restore the default driver backends).
+         * @note Drivers must be deinitialized first.
+         */
+        void uninstall();
+
+        /**
+         * @brief Advance the physics by one control tick (and the host clock with it).
+         */
+        void step();
+
+        /**
+         * @brief Restart the metrics from the current state (e.g. once the robot stands, before walking).
+         */
+        void resetMetrics();
+
+        const Metrics& getMetrics() const { return metrics; }
+
+        /// @brief Trunk position in world frame (in m)
+        const Vec3f& getPosition() const { return position; }
+        /// @brief Trunk orientation (roll, pitch, yaw in rad)
+        Vec3f getOrientation() const { return orientation.toEulerAngles(); }
+        /// @brief Is the given foot (FL, BL, BR, FR order) touching the ground
+        bool isFootInContact(int leg) const { return feet[leg].in_contact; }
+        /// @brief Actual angle of a leg joint (in rad)
+        float getJointAngle(int leg, int joint) const { return leg_servos[leg][joint]->servo.getAngle(); }
+
+    private:
+        struct ServoChannel
+        {
+            bool used = false;
+            Servo servo;
+            float min_angle_rad = 0.f;
+            float max_angle_rad = 0.f;
+            bool inverted = false;
+            AnalogDriver::Channel feedback_channel = 0;
+            // where the joint sits in the body (leg, joint), -1 for the ears
+            int leg = -1;
+            int joint = 0;
+            // last estimated joint torque (in N.m)
+            float torque_nm = 0.f;
+        };
+
+        struct Foot
+        {
+            AnalogDriver::Channel contact_channel = 0;
+            Vec3f pos_body;      // in body frame
+            Vec3f vel_body;      // derivative of pos_body
+            Vec3f force_world;   // ground reaction force
+            bool in_contact = false;
+        };
+
+        class MotorBackend : public MotorDriver::Backend
+        {
+        public:
+            MotorBackend(Simulation& sim) : sim(sim) {}
+            Status init() override { return Status::Ok; }
+            Status deinit() override { return Status::Ok; }
+            Status sendPWMs(const uint16_t* pwm_values) override;
+        private:
+            Simulation& sim;
+        };
+
+        class AnalogBackend : public AnalogDriver::Backend
+        {
+        public:
+            AnalogBackend(Simulation& sim) : sim(sim) {}
+            Status init() override { return Status::Ok; }
+            Status deinit() override { return Status::Ok; }
+            Status select(AnalogDriver::Channel channel) override;
+            Status read(AnalogDriver::Value& out_value) override;
+        private:
+            Simulation& sim;
+            AnalogDriver::Channel selected = 0;
+        };
+
+        class IMUBackend : public IMUDriver::Backend
+        {
+        public:
+            IMUBackend(Simulation& sim) : sim(sim) {}
+            Status init() override { return Status::Ok; }
+            Status deinit() override { return Status::Ok; }
+            Status read(IMUDriver::IMUData& out_data) override;
+        private:
+            Simulation& sim;
+        };
+
+        class PowerBackend : public PowerDriver::Backend
+        {
+        public:
+            PowerBackend(Simulation& sim) : sim(sim) {}
+            Status init() override { return Status::Ok; }
+            Status deinit() override { return Status::Ok; }
+            Status readVoltage(PowerDriver::Value& voltage_v) override;
+            Status readCurrent(PowerDriver::Value& current_a) override;
+            Status readPower(PowerDriver::Value& power_w) override;
+        private:
+            Simulation& sim;
+        };
+
+        void update_feet(float dt);
+        void physics_step(float dt);
+        void update_power();
+        float servo_voltage(const ServoChannel& channel);
+        float tilt() const;
+
+        Body& body;
+        KinematicsEngine kinematics;
+        Config config;
+
+        MotorBackend motor_backend;
+        AnalogBackend analog_backend;
+        IMUBackend imu_backend;
+        PowerBackend power_backend;
+
+        ServoChannel servos[MotorDriver::CHANNEL_COUNT];
+        ServoChannel* leg_servos[4][3] = {};
+        Foot feet[4];
+
+        // trunk state (world frame, z up)
+        Vec3f position;
+        Vec3f velocity;
+        Quatf orientation;
+        Vec3f angular_velocity; // in world frame
+        Vec3f inertia;          // diagonal, in body frame
+        Vec3f acceleration;     // average over the last tick, for the IMU
+        Vec3f start_position;
+
+        // battery state
+        float battery_current_a = 0.f;
+        float battery_voltage_v = 0.f;
+
+        float tilt_sq_sum = 0.f;
+        uint32_t tick_count = 0;
+        Metrics metrics;
+
+        std::mt19937 rng;
+        std::normal_distribution<float> normal{0.f, 1.f};
+    };
+}
@@ -0,0 +1,67 @@
+#include "sim/Servo.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Sim
+{
+    Servo::Servo() {}
+
+    Servo::Servo(Config config, float angle_rad)
+        : config(config), angle_rad(angle_rad), target_rad(angle_rad)
+    {
+    }
+
+    void Servo::command(float angle_rad, bool powered)
+    {
+        // Only keep changes, the PWM is resent every control tick
+        if (pending_count > 0)
+        {
+            const DelayedCommand& last = pending[(pending_head + pending_count - 1) % DELAY_SLOTS];
+            if (last.angle_rad == angle_rad && last.powered == powered) return;
+        }
+        else if (target_rad == angle_rad && this->powered == powered)
+        {
+            return;
+        }
+
+        if (pending_count == DELAY_SLOTS) // drop the oldest one, should never happen with sane latencies
+        {
+            pending_head = (pending_head + 1) % DELAY_SLOTS;
+            pending_count--;
+        }
+        pending[(pending_head + pending_count) % DELAY_SLOTS] = { time_s + config.latency_s, angle_rad, powered };
+        pending_count++;
+    }
+
+    void Servo::update(float dt)
+    {
+        time_s += dt;
+
+        // apply the commands that went through the delay
+        while (pending_count > 0 && pending[pending_head].time_s <= time_s)
+        {
+            target_rad = pending[pending_head].angle_rad;
+            powered = pending[pending_head].powered;
+            pending_head = (pending_head + 1) % DELAY_SLOTS;
+            pending_count--;
+        }
+
+        if (!powered)
+        {
+            velocity_rad_s = 0.f;
+            return;
+        }
+
+        float velocity = (target_rad - angle_rad) / config.time_constant_s;
+        velocity = std::clamp(velocity, -config.max_speed_rad_s, config.max_speed_rad_s);
+
+        // don't overshoot on large dt
+        float step = velocity * dt;
+        if (std::fabs(step) > std::fabs(target_rad - angle_rad))
+        {
+            step = target_rad - angle_rad;
+        }
+        angle_rad += step;
+        velocity_rad_s = step / dt;
+    }
+}
@@ -0,0 +1,421 @@
+#include "sim/Simulation.hpp"
+#include "host/HostClock.hpp"
+#include "common/NVS.hpp"
+#include "common/config.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace Sim
+{
+    constexpr float GRAVITY = 9.81f;
+    // Feedback voltage of the foot switches, pressed or released
+    constexpr float CONTACT_PRESSED_V = 0.2f;
+    constexpr float CONTACT_RELEASED_V = 3.1f;
+    constexpr float FALL_TILT_RAD = DEG_TO_RAD(60.f);
+    // Joint angle step used for the numerical leg jacobian
+    constexpr float JACOBIAN_STEP_RAD = 1e-4f;
+
+    /// @brief Ground reaction of a point at the given world position / velocity
+    static Vec3f ground_force(const Simulation::Config& config, const Vec3f& pos, const Vec3f& vel)
+    {
+        if (pos.z >= 0.f) return Vec3f::Zero();
+
+        float normal = std::max(0.f, -config.ground_stiffness * pos.z - config.ground_damping * vel.z);
+
+        // regularized Coulomb friction
+        Vec3f slip(vel.x, vel.y, 0.f);
+        float slip_speed = slip.length();
+        float friction = config.friction * normal;
+        Vec3f tangent = slip_speed > config.friction_slip_speed
+            ? slip * (-friction / slip_speed)
+            : slip * (-friction / config.friction_slip_speed);
+
+        return Vec3f(tangent.x, tangent.y, normal);
+    }
+
+    Simulation::Simulation(Body& body, const KinematicsEngine& kinematics)
+        : Simulation(body, kinematics, Config())
+    {
+    }
+
+    Simulation::Simulation(Body& body, const KinematicsEngine& kinematics, Config config)
+        : body(body),
+          kinematics(kinematics),
+          config(config),
+          motor_backend(*this),
+          analog_backend(*this),
+          imu_backend(*this),
+          power_backend(*this),
+          rng(config.seed)
+    {
+        const Vec3f& s = config.trunk_size_m;
+        inertia = Vec3f(
+            config.mass_kg / 12.f * (s.y * s.y + s.z * s.z),
+            config.mass_kg / 12.f * (s.x * s.x + s.z * s.z),
+            config.mass_kg / 12.f * (s.x * s.x + s.y * s.y)
+        );
+        battery_voltage_v = config.battery_voltage_v;
+    }
+
+    Status Simulation::install()
+    {
+        if (Status err = NVS::Init(); err != Status::Ok)
+        {
+            return err;
+        }
+
+        // Initial stance : default feet spread under the default body height
+        BodyCartesianState stance;
+        stance.body_pos = Vec3f(0.f, 0.f, DEFAULT_BODY_HEIGHT_M);
+        const float feet_sign[4][2] = { {1, 1}, {-1, 1}, {-1, -1}, {1, -1} }; // FL, BL, BR, FR
+        for (int l = 0; l < 4; l++)
+        {
+            stance.legs[l].target_pos = Vec3f(feet_sign[l][0] * DEFAULT_FEET_SPREAD_X_M, feet_sign[l][1] * DEFAULT_FEET_SPREAD_Y_M, 0.f);
+        }
+        BodyJointState stance_joints;
+        if (Status err = kinematics.computeBodyIK(stance, stance_joints); err != Status::Ok)
+        {
+            return err;
+        }
+
+        for (int l = 0; l < 4; l++)
+        {
+            Leg& leg = body.getLeg(static_cast<Leg::Id>(l));
+            feet[l].contact_channel = leg.getContactChannel();
+
+            for (int j = 0; j < 3; j++)
+            {
+                Joint& joint = leg.getJoint(static_cast<Leg::JointId>(j));
+                MotorController& controller = joint.getMotorController();
+
+                ServoChannel& channel = servos[controller.getMotorChannel()];
+                channel.used = true;
+                channel.servo = Servo(config.servo, stance_joints.leg_joints[l].joint_angles_rad[j]);
+                channel.min_angle_rad = joint.getMinAngle();
+                channel.max_angle_rad = joint.getMaxAngle();
+                channel.inverted = joint.isInverted();
+                channel.feedback_channel = controller.getAnalogChannel();
+                channel.leg = l;
+                channel.joint = j;
+                leg_servos[l][j] = &channel;
+
+                // The firmware reads the potentiometers only once the motor is calibrated,
+                // store the calibration the simulated servos follow (the default one)
+                char key[32];
+                sprintf(key, "MtrCtrl-%d", static_cast<int>(controller.getMotorChannel()));
+                NVS::Handle* handle = nullptr;
+                if (Status err = NVS::Open(key, &handle); err != Status::Ok)
+                {
+                    return err;
+                }
+                MotorController::CalibrationData calibration;
+                Status err = handle->set("calib_data", calibration);
+                NVS::Close(handle);
+                if (err != Status::Ok)
+                {
+                    return err;
+                }
+            }
+        }
+
+        // Put the trunk right above the ground
+        orientation = Quatf();
+        velocity = Vec3f::Zero();
+        angular_velocity = Vec3f::Zero();
+        position = Vec3f::Zero();
+        update_feet(0.f);
+        float lowest = 0.f;
+        for (int l = 0; l < 4; l++) lowest = std::min(lowest, feet[l].pos_body.z);
+        position = Vec3f(0.f, 0.f, -lowest);
+        start_position = position;
+
+        if (Status err = MotorDriver::SetBackend(&motor_backend); err != Status::Ok) return err;
+        if (Status err = AnalogDriver::SetBackend(&analog_backend); err != Status::Ok) return err;
+        if (Status err = IMUDriver::SetBackend(&imu_backend); err != Status::Ok) return err;
+        if (Status err = PowerDriver::SetBackend(&power_backend); err != Status::Ok) return err;
+
+        return Status::Ok;
+    }
+
+    void Simulation::uninstall()
+    {
+        MotorDriver::SetBackend(nullptr);
+        AnalogDriver::SetBackend(nullptr);
+        IMUDriver::SetBackend(nullptr);
+        PowerDriver::SetBackend(nullptr);
+    }
+
+    void Simulation::step()
+    {
+        const float dt = CONTROL_LOOP_DT_S / config.substeps;
+        Vec3f start_velocity = velocity;
+
+        for (int i = 0; i < config.substeps; i++)
+        {
+            for (ServoChannel& channel : servos)
+            {
+                if (channel.used) channel.servo.update(dt);
+            }
+            update_feet(dt);
+            physics_step(dt);
+        }
+        acceleration = (velocity - start_velocity) / CONTROL_LOOP_DT_S;
+
+        update_power();
+        HostClock::Advance(CONTROL_LOOP_DT_MS * 1000);
+
+        // metrics
+        tick_count++;
+        float tilt_rad = tilt();
+        tilt_sq_sum += tilt_rad * tilt_rad;
+        Vec3f moved = position - start_position;
+        metrics.time_s = tick_count * CONTROL_LOOP_DT_S;
+        metrics.distance_m = sqrtf(moved.x * moved.x + moved.y * moved.y);
+        metrics.forward_m = moved.x;
+        metrics.tilt_rms_rad = sqrtf(tilt_sq_sum / tick_count);
+        metrics.tilt_max_rad = std::max(metrics.tilt_max_rad, tilt_rad);
+        metrics.energy_j += battery_voltage_v * battery_current_a * CONTROL_LOOP_DT_S;
+        metrics.cost_of_transport = metrics.distance_m > 0.f
+            ? metrics.energy_j / (config.mass_kg * GRAVITY * metrics.distance_m)
+            : 0.f;
+        if (tilt_rad > FALL_TILT_RAD || position.z < config.trunk_size_m.z * 0.5f)
+        {
+            metrics.fell = true;
+        }
+    }
+
+    void Simulation::resetMetrics()
+    {
+        start_position = position;
+        tick_count = 0;
+        tilt_sq_sum = 0.f;
+        metrics = Metrics();
+    }
+
+    void Simulation::update_feet(float dt)
+    {
+        for (int l = 0; l < 4; l++)
+        {
+            LegJointState joints;
+            for (int j = 0; j < 3; j++)
+            {
+                joints.joint_angles_rad[j] = leg_servos[l][j]->servo.getAngle();
+            }
+
+            Vec3f foot;
+            kinematics.computeLegFK(joints, foot);
+            if (kinematics.getConfig().leg_inverted[l])
+            {
+                foot.y = -foot.y;
+            }
+            foot += kinematics.getHipPosition(l);
+
+            feet[l].vel_body = dt > 0.f ? (foot - feet[l].pos_body) / dt : Vec3f::Zero();
+            feet[l].pos_body = foot;
+        }
+    }
+
+    void Simulation::physics_step(float dt)
+    {
+        Vec3f force(0.f, 0.f, -config.mass_kg * GRAVITY);
+        Vec3f torque = Vec3f::Zero();
+
+        auto apply_contact = [&](const Vec3f& point_body, const Vec3f& vel_body) -> Vec3f
+        {
+            Vec3f lever = orientation.rotate(point_body);
+            Vec3f pos = position + lever;
+            Vec3f vel = velocity + angular_velocity.cross(lever) + orientation.rotate(vel_body);
+            Vec3f f = ground_force(config, pos, vel);
+            force += f;
+            torque += lever.cross(f);
+            return f;
+        };
+
+        for (int l = 0; l < 4; l++)
+        {
+            feet[l].force_world = apply_contact(feet[l].pos_body, feet[l].vel_body);
+            feet[l].in_contact = feet[l].force_world.z > 0.f;
+        }
+
+        // trunk corners, for when the robot lies on the ground
+        const Vec3f half = config.trunk_size_m * 0.5f;
+        for (int c = 0; c < 8; c++)
+        {
+            Vec3f corner((c & 1) ? half.x : -half.x, (c & 2) ? half.y : -half.y, (c & 4) ? half.z : -half.z);
+            apply_contact(corner, Vec3f::Zero());
+        }
+
+        // semi-implicit Euler, rotation handled in body frame (diagonal inertia)
+        velocity += force * (dt / config.mass_kg);
+        position += velocity * dt;
+
+        Quatf to_body = orientation.conjugate();
+        Vec3f w = to_body.rotate(angular_velocity);
+        Vec3f t = to_body.rotate(torque);
+        Vec3f iw(inertia.x * w.x, inertia.y * w.y, inertia.z * w.z);
+        Vec3f gyroscopic = w.cross(iw);
+        w.x += (t.x - gyroscopic.x) / inertia.x * dt;
+        w.y += (t.y - gyroscopic.y) / inertia.y * dt;
+        w.z += (t.z - gyroscopic.z) / inertia.z * dt;
+        angular_velocity = orientation.rotate(w);
+
+        float angle = w.length() * dt;
+        if (angle > 0.f)
+        {
+            Vec3f axis = w.normalized();
+            float s = sinf(angle * 0.5f);
+            orientation = orientation * Quatf(axis.x * s, axis.y * s, axis.z * s, cosf(angle * 0.5f));
+            orientation.normalize();
+        }
+    }
+
+    void Simulation::update_power()
+    {
+        Quatf to_body = orientation.conjugate();
+        float servo_current_a = 0.f;
+
+        for (int l = 0; l < 4; l++)
+        {
+            // force applied by the leg on the ground, in hip frame
+            Vec3f f = -to_body.rotate(feet[l].force_world);
+            bool inverted = kinematics.getConfig().leg_inverted[l];
+            if (inverted) f.y = -f.y;
+
+            LegJointState joints;
+            for (int j = 0; j < 3; j++)
+            {
+                joints.joint_angles_rad[j] = leg_servos[l][j]->servo.getAngle();
+            }
+            Vec3f foot;
+            kinematics.computeLegFK(joints, foot);
+
+            // joint torques = J^T.F
+            for (int j = 0; j < 3; j++)
+            {
+                LegJointState moved = joints;
+                moved.joint_angles_rad[j] += JACOBIAN_STEP_RAD;
+                Vec3f moved_foot;
+                kinematics.computeLegFK(moved, moved_foot);
+                Vec3f column = (moved_foot - foot) / JACOBIAN_STEP_RAD;
+                leg_servos[l][j]->torque_nm = column.dot(f);
+            }
+        }
+
+        for (ServoChannel& channel : servos)
+        {
+            if (!channel.used || !channel.servo.isPowered()) continue;
+            servo_current_a += config.servo_idle_current_a
+                + fabsf(channel.torque_nm) / config.servo_torque_constant_nm_a
+                + fabsf(channel.servo.getVelocity()) * config.servo_speed_current_a_s_rad;
+        }
+
+        float power_w = config.base_power_w + servo_current_a * config.servo_voltage_v / config.regulator_efficiency;
+        // solve P = (E - R.I).I for the battery current
+        float e = config.battery_voltage_v;
+        float r = config.battery_resistance_ohm;
+        float delta = e * e - 4.f * r * power_w;
+        battery_current_a = delta > 0.f ? (e - sqrtf(delta)) / (2.f * r) : e / (2.f * r);
+        battery_voltage_v = e - r * battery_current_a;
+    }
+
+    float Simulation::servo_voltage(const ServoChannel& channel)
+    {
+        MotorController::CalibrationData calibration;
+        float ratio = (channel.servo.getAngle() - channel.min_angle_rad) / (channel.max_angle_rad - channel.min_angle_rad);
+        if (channel.inverted) ratio = 1.f - ratio;
+        return calibration.feedback_min + ratio * (calibration.feedback_max - calibration.feedback_min)
+            + normal(rng) * config.feedback_noise_v;
+    }
+
+    float Simulation::tilt() const
+    {
+        Vec3f up = orientation.rotate(Vec3f::Z());
+        return acosf(std::clamp(up.z, -1.f, 1.f));
+    }
+
+    /** BACKENDS **/
+
+    Status Simulation::MotorBackend::sendPWMs(const uint16_t* pwm_values)
+    {
+        MotorController::CalibrationData calibration;
+        for (int c = 0; c < MotorDriver::CHANNEL_COUNT; c++)
+        {
+            ServoChannel& channel = sim.servos[c];
+            if (!channel.used) continue;
+
+            if (pwm_values[c] == 0)
+            {
+                channel.servo.command(channel.servo.getAngle(), false);
+                continue;
+            }
+
+            float dc = MotorDriver::PWM_TO_DC(pwm_values[c]);
+            float ratio = std::clamp((dc - calibration.dc_min) / (calibration.dc_max - calibration.dc_min), 0.f, 1.f);
+            if (channel.inverted) ratio = 1.f - ratio;
+            channel.servo.command(channel.min_angle_rad + ratio * (channel.max_angle_rad - channel.min_angle_rad), true);
+        }
+        return Status::Ok;
+    }
+
+    Status Simulation::AnalogBackend::select(AnalogDriver::Channel channel)
+    {
+        selected = channel;
+        return Status::Ok;
+    }
+
+    Status Simulation::AnalogBackend::read(AnalogDriver::Value& out_value)
+    {
+        for (int l = 0; l < 4; l++)
+        {
+            if (sim.feet[l].contact_channel == selected)
+            {
+                out_value = sim.feet[l].in_contact ? CONTACT_PRESSED_V : CONTACT_RELEASED_V;
+                return Status::Ok;
+            }
+        }
+        for (const ServoChannel& channel : sim.servos)
+        {
+            if (channel.used && channel.feedback_channel == selected)
+            {
+                out_value = sim.servo_voltage(channel);
+                return Status::Ok;
+            }
+        }
+        out_value = 0.f;
+        return Status::Ok;
+    }
+
+    Status Simulation::IMUBackend::read(IMUDriver::IMUData& out_data)
+    {
+        Quatf to_body = sim.orientation.conjugate();
+        Vec3f specific_force = to_body.rotate(sim.acceleration + Vec3f(0.f, 0.f, GRAVITY)) / GRAVITY;
+        Vec3f rates = to_body.rotate(sim.angular_velocity) * RAD_TO_DEG_FACTOR;
+
+        out_data.accel_x_g = specific_force.x + sim.normal(sim.rng) * sim.config.accel_noise_g;
+        out_data.accel_y_g = specific_force.y + sim.normal(sim.rng) * sim.config.accel_noise_g;
+        out_data.accel_z_g = specific_force.z + sim.normal(sim.rng) * sim.config.accel_noise_g;
+        out_data.gyro_x_ds = rates.x + sim.normal(sim.rng) * sim.config.gyro_noise_ds;
+        out_data.gyro_y_ds = rates.y + sim.normal(sim.rng) * sim.config.gyro_noise_ds;
+        out_data.gyro_z_ds = rates.z + sim.normal(sim.rng) * sim.config.gyro_noise_ds;
+        return Status::Ok;
+    }
+
+    Status Simulation::PowerBackend::readVoltage(PowerDriver::Value& voltage_v)
+    {
+        voltage_v = sim.battery_voltage_v;
+        return Status::Ok;
+    }
+
+    Status Simulation::PowerBackend::readCurrent(PowerDriver::Value& current_a)
+    {
+        current_a = sim.battery_current_a;
+        return Status::Ok;
+    }
+
+    Status Simulation::PowerBackend::readPower(PowerDriver::Value& power_w)
+    {
+        power_w = sim.battery_voltage_v * sim.battery_current_a;
+        return Status::Ok;
+    }
+}
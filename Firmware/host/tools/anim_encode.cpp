@@ -0,0 +1,578 @@
+/**
+ * Converts image sequences to the compressed animations of ui/AnimationCodec.hpp (key frames and XOR deltas).
+ *
+ * Inputs (1bpp after thresholding, white pixels are lit) :
+ * - PNG files, one frame each, or a single strip of frames split with --size (frames stacked vertically or side by side)
+ * - an animated GIF, every frame composited like a viewer shows it
+ * - --raw WxH : frames stored row by row, most significant bit first (the previous C arrays of ui/Animations.hpp)
+ *
+ * Every file is decoded again after encoding and must give the input frames back, the tool exits with 2 otherwise.
+ *
+ * - default : writes the animation file (for LittleFS)
+ * - --header Name : writes a C++ array named `Name` instead, to paste in ui/Animations.hpp
+ * - --decode : writes the frames of an animation file as a vertical PNG strip
+ *
+ * Usage : anim_encode [--size WxH] [--threshold t] [--invert] [--keyframe n] [--header Name] input... output
+ *         anim_encode --raw WxH [--keyframe n] [--header Name] input.bin output
+ *         anim_encode --decode input.anim output.png
+ */
+#include "ui/AnimationCodec.hpp"
+#include "common/config.hpp"
+#include <png.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/** 8 bits gray image (alpha already applied : transparent pixels are black) **/
+struct Image
+{
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::vector<uint8_t> pixels;
+};
+
+static void usage(const char* name)
+{
+    fprintf(stderr, "usage: %s [--size WxH] [--threshold t] [--invert] [--keyframe n] [--header Name] input... output\n", name);
+    fprintf(stderr, "       %s --raw WxH [--keyframe n] [--header Name] input.bin output\n", name);
+    fprintf(stderr, "       %s --decode input.anim output.png\n", name);
+}
+
+static bool read_file(const char* path, std::vector<uint8_t>& data)
+{
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+    uint8_t buffer[4096];
+    size_t count;
+    data.clear();
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) data.insert(data.end(), buffer, buffer + count);
+    fclose(file);
+    return true;
+}
+
+/** PNG **/
+
+static bool read_png(const char* path, Image& image)
+{
+    png_image png;
+    memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&png, path))
+    {
+        fprintf(stderr, "%s : %s\n", path, png.message);
+        return false;
+    }
+    png.format = PNG_FORMAT_GA;
+    std::vector<uint8_t> gray_alpha(PNG_IMAGE_SIZE(png));
+    if (!png_image_finish_read(&png, nullptr, gray_alpha.data(), 0, nullptr))
+    {
+        fprintf(stderr, "%s : %s\n", path, png.message);
+        return false;
+    }
+
+    image.width = png.width;
+    image.height = png.height;
+    image.pixels.resize(image.width * image.height);
+    for (size_t i = 0; i < image.pixels.size(); i++)
+    {
+        image.pixels[i] = gray_alpha[2 * i + 1] >= 128 ? gray_alpha[2 * i] : 0;
+    }
+    return true;
+}
+
+static bool write_png(const char* path, const Image& image)
+{
+    png_image png;
+    memset(&png, 0, sizeof(png));
+    png.version = PNG_IMAGE_VERSION;
+    png.width = image.width;
+    png.height = image.height;
+    png.format = PNG_FORMAT_GRAY;
+    if (!png_image_write_to_file(&png, path, 0, image.pixels.data(), 0, nullptr))
+    {
+        fprintf(stderr, "%s : %s\n", path, png.message);
+        return false;
+    }
+    return true;
+}
+
+/** GIF **/
+
+class GifReader
+{
+public:
+    explicit GifReader(const std::vector<uint8_t>& data) : data(data) {}
+
+    /**
+     * @brief Decode every frame, composited on the logical screen (disposal methods and transparency applied).
+     */
+    bool read(std::vector<Image>& frames)
+    {
+        if (data.size() < 13 || (memcmp(data.data(), "GIF87a", 6) != 0 && memcmp(data.data(), "GIF89a", 6) != 0))
+        {
+            return fail("not a GIF file");
+        }
+        pos = 6;
+        uint32_t width = u16();
+        uint32_t height = u16();
+        uint8_t flags = u8();
+        pos += 2; // background color (drawn black), aspect ratio
+        if (flags & 0x80) read_palette(global_palette, 2 << (flags & 7));
+
+        Image canvas{ width, height, std::vector<uint8_t>(width * height, 0) };
+        int transparent = -1;
+        uint8_t disposal = 0;
+        while (pos < data.size())
+        {
+            uint8_t block = u8();
+            if (block == 0x3B) break; // trailer
+            if (block == 0x21) // extension
+            {
+                uint8_t label = u8();
+                if (label == 0xF9 && pos + 6 <= data.size()) // graphic control
+                {
+                    pos++; // block size
+                    uint8_t control = u8();
+                    pos += 2; // delay, frames are shown one per update
+                    uint8_t index = u8();
+                    disposal = (control >> 2) & 7;
+                    transparent = (control & 1) ? index : -1;
+                }
+                skip_blocks();
+            }
+            else if (block == 0x2C) // image
+            {
+                Image previous = canvas;
+                if (!read_image(canvas, transparent)) return false;
+                frames.push_back(canvas);
+
+                // what the next frame is drawn on
+                if (disposal == 2) std::fill(canvas.pixels.begin(), canvas.pixels.end(), 0);
+                else if (disposal == 3) canvas = previous;
+                transparent = -1;
+                disposal = 0;
+            }
+            else
+            {
+                return fail("unknown block");
+            }
+            if (error) return false;
+        }
+        return !frames.empty() || fail("no frame");
+    }
+
+private:
+    const std::vector<uint8_t>& data;
+    size_t pos = 0;
+    bool error = false;
+    std::vector<uint8_t> global_palette; // gray level of each color
+
+    bool fail(const char* message)
+    {
+        fprintf(stderr, "GIF : %s\n", message);
+        error = true;
+        return false;
+    }
+
+    uint8_t u8() { return pos < data.size() ? data[pos++] : (error = true, 0); }
+    uint16_t u16() { uint16_t low = u8(); return low | (u8() << 8); }
+
+    void read_palette(std::vector<uint8_t>& palette, size_t count)
+    {
+        palette.resize(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            uint32_t r = u8(), g = u8(), b = u8();
+            palette[i] = (r * 299 + g * 587 + b * 114) / 1000;
+        }
+    }
+
+    void skip_blocks()
+    {
+        for (uint8_t size; (size = u8()) != 0 && !error;) pos += size;
+    }
+
+    bool read_image(Image& canvas, int transparent)
+    {
+        uint32_t left = u16(), top = u16(), width = u16(), height = u16();
+        uint8_t flags = u8();
+        std::vector<uint8_t> palette = global_palette;
+        if (flags & 0x80) read_palette(palette, 2 << (flags & 7));
+        bool interlaced = flags & 0x40;
+
+        uint8_t min_code_size = u8();
+        std::vector<uint8_t> stream;
+        for (uint8_t size; (size = u8()) != 0 && !error;)
+        {
+            if (pos + size > data.size()) return fail("truncated image");
+            stream.insert(stream.end(), data.begin() + pos, data.begin() + pos + size);
+            pos += size;
+        }
+        if (error || min_code_size < 2 || min_code_size > 11 || palette.empty()) return fail("invalid image");
+
+        std::vector<uint8_t> indices;
+        if (!lzw_decode(stream, min_code_size, width * height, indices)) return fail("invalid LZW data");
+
+        // rows of interlaced images come in 4 passes
+        std::vector<uint32_t> rows;
+        if (interlaced)
+        {
+            for (uint32_t start : { 0, 4, 2, 1 })
+                for (uint32_t row = start; row < height; row += (start == 0 ? 8 : start == 4 ? 8 : start == 2 ? 4 : 2)) rows.push_back(row);
+        }
+        else
+        {
+            for (uint32_t row = 0; row < height; row++) rows.push_back(row);
+        }
+
+        for (uint32_t i = 0; i < height; i++)
+        {
+            for (uint32_t x = 0; x < width; x++)
+            {
+                uint8_t index = indices[i * width + x];
+                uint32_t cx = left + x, cy = top + rows[i];
+                if (index == transparent || cx >= canvas.width || cy >= canvas.height) continue;
+                canvas.pixels[cy * canvas.width + cx] = index < palette.size() ? palette[index] : 0;
+            }
+        }
+        return true;
+    }
+
+    static bool lzw_decode(const std::vector<uint8_t>& stream, uint8_t min_code_size, size_t count, std::vector<uint8_t>& out)
+    {
+        const uint32_t clear = 1 << min_code_size;
+        const uint32_t end = clear + 1;
+        std::vector<uint16_t> prefix(4096);
+        std::vector<uint8_t> suffix(4096), first(4096);
+        for (uint32_t i = 0; i < clear; i++) { prefix[i] = 0xFFFF; suffix[i] = i; first[i] = i; }
+
+        uint32_t code_size = min_code_size + 1;
+        uint32_t next = end + 1;
+        int32_t old = -1;
+        uint32_t bits = 0, bit_count = 0;
+        size_t byte = 0;
+        std::vector<uint8_t> string;
+        while (out.size() < count)
+        {
+            while (bit_count < code_size)
+            {
+                if (byte >= stream.size()) return false;
+                bits |= stream[byte++] << bit_count;
+                bit_count += 8;
+            }
+            uint32_t code = bits & ((1 << code_size) - 1);
+            bits >>= code_size;
+            bit_count -= code_size;
+
+            if (code == clear)
+            {
+                code_size = min_code_size + 1;
+                next = end + 1;
+                old = -1;
+                continue;
+            }
+            if (code == end) break;
+            if (code > next || (old < 0 && code >= clear)) return false;
+
+            // the code being defined (code == next) is the previous string followed by its own first byte
+            uint32_t walk = code == next ? old : code;
+            string.clear();
+            for (; walk != 0xFFFF; walk = prefix[walk]) string.push_back(suffix[walk]);
+            if (code == next) string.insert(string.begin(), first[old]);
+            out.insert(out.end(), string.rbegin(), string.rend());
+
+            if (old >= 0 && next < 4096)
+            {
+                prefix[next] = old;
+                suffix[next] = code == next ? first[old] : first[code];
+                first[next] = first[old];
+                next++;
+                if (next == (1u << code_size) && code_size < 12) code_size++;
+            }
+            old = code;
+        }
+        out.resize(count, 0);
+        return true;
+    }
+};
+
+/** FRAMES **/
+
+static bool ends_with(const std::string& text, const char* suffix)
+{
+    size_t length = strlen(suffix);
+    if (text.size() < length) return false;
+    return strcasecmp(text.c_str() + text.size() - length, suffix) == 0;
+}
+
+static bool parse_size(const char* text, uint32_t& width, uint32_t& height)
+{
+    return sscanf(text, "%ux%u", &width, &height) == 2 && width > 0 && height > 0;
+}
+
+/**
+ * @brief Threshold a part of an image into a frame in the screen buffer format.
+ */
+static void image_to_frame(const Image& image, uint32_t left, uint32_t top, uint32_t width, uint32_t height,
+                           uint8_t threshold, bool invert, uint8_t* frame)
+{
+    memset(frame, 0, AnimationCodec::FrameSize(width, height));
+    for (uint32_t y = 0; y < height; y++)
+    {
+        for (uint32_t x = 0; x < width; x++)
+        {
+            bool lit = (image.pixels[(top + y) * image.width + left + x] >= threshold) != invert;
+            if (lit) frame[(y / 8) * width + x] |= 1 << (y % 8);
+        }
+    }
+}
+
+static bool write_header(const char* path, const char* name, const std::vector<uint8_t>& animation, const AnimationCodec::Header& header)
+{
+    FILE* file = fopen(path, "w");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "Cannot write %s\n", path);
+        return false;
+    }
+    size_t raw = header.width * header.height / 8 * header.frame_count;
+    fprintf(file, "    // Resolution: %ux%u\n", header.width, header.height);
+    fprintf(file, "    // Number of frames: %u\n", header.frame_count);
+    fprintf(file, "    // Total: %zu bytes (%zu bytes uncompressed)\n", animation.size(), raw);
+    fprintf(file, "    const uint8_t %s[] = {", name);
+    for (size_t i = 0; i < animation.size(); i++)
+    {
+        fprintf(file, "%s0x%02X,", i % 16 == 0 ? "\n        " : " ", animation[i]);
+    }
+    fprintf(file, "\n    };\n");
+    fclose(file);
+    return true;
+}
+
+static bool write_binary(const char* path, const std::vector<uint8_t>& data)
+{
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr || fwrite(data.data(), 1, data.size(), file) != data.size())
+    {
+        fprintf(stderr, "Cannot write %s\n", path);
+        if (file) fclose(file);
+        return false;
+    }
+    fclose(file);
+    return true;
+}
+
+/**
+ * @brief Decode every frame of an animation, one after the other in `frames` (false if it can't be decoded).
+ */
+static bool decode_all(const std::vector<uint8_t>& animation, AnimationCodec::Header& header, std::vector<uint8_t>& frames)
+{
+    AnimationCodec::Decoder decoder;
+    if (decoder.open(animation.data(), animation.size()) != Status::Ok) return false;
+    header = decoder.getHeader();
+    size_t frame_size = AnimationCodec::FrameSize(header.width, header.height);
+    frames.resize(frame_size * header.frame_count);
+    for (uint8_t i = 0; i < header.frame_count; i++)
+    {
+        if (decoder.seek(i) != Status::Ok) return false;
+        memcpy(&frames[i * frame_size], decoder.getFrame(), frame_size);
+    }
+    return true;
+}
+
+static int decode(const char* input, const char* output)
+{
+    std::vector<uint8_t> animation;
+    if (!read_file(input, animation)) return 1;
+
+    AnimationCodec::Header header;
+    std::vector<uint8_t> frames;
+    if (!decode_all(animation, header, frames))
+    {
+        fprintf(stderr, "%s is not a valid animation\n", input);
+        return 1;
+    }
+
+    Image strip{ header.width, static_cast<uint32_t>(header.height) * header.frame_count, {} };
+    strip.pixels.resize(strip.width * strip.height);
+    size_t frame_size = AnimationCodec::FrameSize(header.width, header.height);
+    for (uint32_t f = 0; f < header.frame_count; f++)
+    {
+        for (uint32_t y = 0; y < header.height; y++)
+        {
+            for (uint32_t x = 0; x < header.width; x++)
+            {
+                bool lit = frames[f * frame_size + (y / 8) * header.width + x] & (1 << (y % 8));
+                strip.pixels[(f * header.height + y) * header.width + x] = lit ? 0xFF : 0x00;
+            }
+        }
+    }
+    if (!write_png(output, strip)) return 1;
+    printf("%s : %u frames of %ux%u\n", output, header.frame_count, header.width, header.height);
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    const char* raw_size = nullptr;
+    const char* frame_size_text = nullptr;
+    const char* header_name = nullptr;
+    uint8_t threshold = 128;
+    bool invert = false;
+    bool decode_mode = false;
+    uint8_t keyframe_interval = 0;
+    std::vector<const char*> paths;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--raw") == 0 && i + 1 < argc) raw_size = argv[++i];
+        else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) frame_size_text = argv[++i];
+        else if (strcmp(argv[i], "--header") == 0 && i + 1 < argc) header_name = argv[++i];
+        else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) threshold = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--keyframe") == 0 && i + 1 < argc) keyframe_interval = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--invert") == 0) invert = true;
+        else if (strcmp(argv[i], "--decode") == 0) decode_mode = true;
+        else if (argv[i][0] == '-')
+        {
+            usage(argv[0]);
+            return 1;
+        }
+        else paths.push_back(argv[i]);
+    }
+    if (paths.size() < 2)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+    if (decode_mode)
+    {
+        if (paths.size() != 2)
+        {
+            usage(argv[0]);
+            return 1;
+        }
+        return decode(paths[0], paths[1]);
+    }
+    const char* output = paths.back();
+    paths.pop_back();
+
+    // input frames, in the screen buffer format
+    uint32_t width = 0, height = 0;
+    std::vector<uint8_t> frames;
+    if (raw_size != nullptr)
+    {
+        std::vector<uint8_t> raw;
+        if (!parse_size(raw_size, width, height) || paths.size() != 1 || (width * height) % 8 != 0)
+        {
+            usage(argv[0]);
+            return 1;
+        }
+        if (!read_file(paths[0], raw)) return 1;
+        size_t raw_frame = width * height / 8;
+        if (width > SCREEN_WIDTH || height > SCREEN_HEIGHT || raw.size() % raw_frame != 0)
+        {
+            fprintf(stderr, "%s doesn't hold whole %ux%u frames\n", paths[0], width, height);
+            return 1;
+        }
+        frames.resize(raw.size() / raw_frame * AnimationCodec::FrameSize(width, height));
+        for (size_t f = 0; f < raw.size() / raw_frame; f++)
+        {
+            AnimationCodec::RowsToPages(&raw[f * raw_frame], width, height, &frames[f * AnimationCodec::FrameSize(width, height)]);
+        }
+    }
+    else
+    {
+        std::vector<Image> images;
+        for (const char* path : paths)
+        {
+            if (ends_with(path, ".gif"))
+            {
+                std::vector<uint8_t> data;
+                if (!read_file(path, data) || !GifReader(data).read(images)) return 1;
+            }
+            else
+            {
+                Image image;
+                if (!read_png(path, image)) return 1;
+                images.push_back(image);
+            }
+        }
+
+        // frames are the whole images, or the tiles of a strip
+        if (frame_size_text != nullptr && !parse_size(frame_size_text, width, height))
+        {
+            usage(argv[0]);
+            return 1;
+        }
+        if (frame_size_text == nullptr)
+        {
+            width = images[0].width;
+            height = images[0].height;
+        }
+        if (width > SCREEN_WIDTH || height > SCREEN_HEIGHT)
+        {
+            fprintf(stderr, "Frames are %ux%u, the screen is %ux%u\n", width, height, SCREEN_WIDTH, SCREEN_HEIGHT);
+            return 1;
+        }
+        size_t frame_size = AnimationCodec::FrameSize(width, height);
+        for (const Image& image : images)
+        {
+            if (image.width % width != 0 || image.height % height != 0)
+            {
+                fprintf(stderr, "Images must be made of whole %ux%u frames\n", width, height);
+                return 1;
+            }
+            for (uint32_t top = 0; top < image.height; top += height)
+            {
+                for (uint32_t left = 0; left < image.width; left += width)
+                {
+                    frames.resize(frames.size() + frame_size);
+                    image_to_frame(image, left, top, width, height, threshold, invert, &frames[frames.size() - frame_size]);
+                }
+            }
+        }
+    }
+
+    size_t frame_size = AnimationCodec::FrameSize(width, height);
+    size_t frame_count = frames.size() / frame_size;
+    if (frame_count == 0 || frame_count > 255)
+    {
+        fprintf(stderr, "%zu frames, an animation holds 1 to 255\n", frame_count);
+        return 1;
+    }
+
+    std::vector<uint8_t> animation;
+    if (AnimationCodec::Encode(frames.data(), width, height, frame_count, keyframe_interval, animation) != Status::Ok)
+    {
+        fprintf(stderr, "Encoding failed\n");
+        return 1;
+    }
+
+    // round trip check
+    AnimationCodec::Header header;
+    std::vector<uint8_t> decoded;
+    if (!decode_all(animation, header, decoded) || decoded != frames)
+    {
+        fprintf(stderr, "Decoded frames differ from the input\n");
+        return 2;
+    }
+
+    bool written = header_name != nullptr ? write_header(output, header_name, animation, header) : write_binary(output, animation);
+    if (!written) return 1;
+
+    uint32_t key_frames = 0;
+    for (uint8_t i = 0; i < header.frame_count; i++)
+    {
+        uint32_t offset = 0;
+        memcpy(&offset, &animation[AnimationCodec::HEADER_SIZE + 4 * i], 4);
+        key_frames += animation[offset] == AnimationCodec::FRAME_KEY;
+    }
+    printf("%s : %zu frames of %ux%u (%u key frames), %zu bytes, %zu uncompressed (%.1fx)\n", output, frame_count, width,
+           height, key_frames, animation.size(), frames.size(), static_cast<double>(frames.size()) / animation.size());
+    return 0;
+}
@@ -0,0 +1,201 @@
+/**
+ * Converts WAV files to the formats played by StreamProvider (audio/StreamProvider.hpp).
+ *
+ * - default : 16 bits PCM input (mono or stereo, mixed down) to mono IMA-ADPCM, 4 times smaller
+ * - --pcm : same input to mono 16 bits PCM
+ * - --decode : any supported file (PCM or IMA-ADPCM) back to mono 16 bits PCM, bit exact with the firmware decoder
+ *
+ * The sample rate is kept : files not at SPEAKER_SAMPLE_RATE_HZ are resampled while played on the robot, which costs CPU.
+ *
+ * Usage : audio_encode [--pcm | --decode] [--block bytes] input.wav output.wav
+ */
+#include "audio/Adpcm.hpp"
+#include "audio/Wav.hpp"
+#include "common/config.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+enum class Mode
+{
+    Adpcm,
+    Pcm,
+    Decode,
+};
+
+static void usage(const char* name)
+{
+    fprintf(stderr, "usage: %s [--pcm | --decode] [--block bytes] input.wav output.wav\n", name);
+}
+
+/**
+ * @brief Read every sample of a WAV file, mixed down to mono.
+ */
+static bool read_samples(const char* path, Wav::Info& info, std::vector<int16_t>& samples)
+{
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+    if (Wav::ReadHeader(file, info) != Status::Ok)
+    {
+        fprintf(stderr, "%s is not a 16 bits PCM or IMA-ADPCM WAV file\n", path);
+        fclose(file);
+        return false;
+    }
+
+    std::vector<uint8_t> data(info.data_size);
+    size_t size = fread(data.data(), 1, data.size(), file);
+    fclose(file);
+
+    if (info.format == Wav::Format::PCM)
+    {
+        size_t channels = info.channels ? info.channels : 1;
+        size_t frames = size / (2 * channels);
+        samples.resize(frames);
+        for (size_t i = 0; i < frames; i++)
+        {
+            int32_t sum = 0;
+            for (size_t c = 0; c < channels; c++)
+            {
+                int16_t sample;
+                memcpy(&sample, data.data() + (i * channels + c) * 2, 2);
+                sum += sample;
+            }
+            samples[i] = static_cast<int16_t>(sum / static_cast<int32_t>(channels));
+        }
+    }
+    else
+    {
+        if (info.channels != 1)
+        {
+            fprintf(stderr, "Only mono IMA-ADPCM files can be decoded\n");
+            return false;
+        }
+        std::vector<int16_t> block(info.samples_per_block);
+        for (size_t offset = 0; offset + Adpcm::BLOCK_HEADER_SIZE < size; offset += info.block_align)
+        {
+            size_t length = std::min<size_t>(info.block_align, size - offset);
+            Adpcm::DecodeBlock(data.data() + offset, block.data(), length);
+            samples.insert(samples.end(), block.begin(), block.begin() + Adpcm::SamplesPerBlock(length));
+        }
+        if (samples.size() > info.sample_count) samples.resize(info.sample_count);
+    }
+    return true;
+}
+
+static double snr_db(const std::vector<int16_t>& reference, const std::vector<int16_t>& decoded)
+{
+    double signal = 0.0, noise = 0.0;
+    for (size_t i = 0; i < reference.size() && i < decoded.size(); i++)
+    {
+        double error = static_cast<double>(reference[i]) - decoded[i];
+        signal += static_cast<double>(reference[i]) * reference[i];
+        noise += error * error;
+    }
+    return noise > 0.0 ? 10 * std::log10(signal / noise) : INFINITY;
+}
+
+int main(int argc, char** argv)
+{
+    Mode mode = Mode::Adpcm;
+    uint16_t block_align = Adpcm::DEFAULT_BLOCK_ALIGN;
+    const char* paths[2] = { nullptr, nullptr };
+    int nb_paths = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--pcm") == 0) mode = Mode::Pcm;
+        else if (strcmp(argv[i], "--decode") == 0) mode = Mode::Decode;
+        else if (strcmp(argv[i], "--block") == 0 && i + 1 < argc) block_align = static_cast<uint16_t>(atoi(argv[++i]));
+        else if (argv[i][0] != '-' && nb_paths < 2) paths[nb_paths++] = argv[i];
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (nb_paths != 2)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+    if (block_align <= Adpcm::BLOCK_HEADER_SIZE || block_align > SPEAKER_STREAM_CHUNK_SIZE)
+    {
+        fprintf(stderr, "Block size must be between %zu and %zu bytes\n", Adpcm::BLOCK_HEADER_SIZE + 1, SPEAKER_STREAM_CHUNK_SIZE);
+        return 1;
+    }
+
+    Wav::Info input;
+    std::vector<int16_t> samples;
+    if (!read_samples(paths[0], input, samples)) return 1;
+    if (mode == Mode::Adpcm && input.format != Wav::Format::PCM)
+    {
+        fprintf(stderr, "%s is already compressed, use --decode first\n", paths[0]);
+        return 1;
+    }
+
+    Wav::Info output = {};
+    output.channels = 1;
+    output.sample_rate = input.sample_rate;
+    output.sample_count = static_cast<uint32_t>(samples.size());
+    std::vector<uint8_t> data;
+    std::vector<int16_t> decoded;
+
+    if (mode == Mode::Adpcm)
+    {
+        output.format = Wav::Format::ImaAdpcm;
+        output.block_align = block_align;
+        output.samples_per_block = static_cast<uint16_t>(Adpcm::SamplesPerBlock(block_align));
+
+        // last block padded with its last sample, the fact chunk keeps the real length
+        size_t blocks = (samples.size() + output.samples_per_block - 1) / output.samples_per_block;
+        std::vector<int16_t> padded(samples);
+        padded.resize(blocks * output.samples_per_block, samples.empty() ? 0 : samples.back());
+        data.resize(blocks * block_align);
+        uint8_t index = 0;
+        for (size_t b = 0; b < blocks; b++)
+            Adpcm::EncodeBlock(padded.data() + b * output.samples_per_block, data.data() + b * block_align, block_align, index);
+
+        decoded.resize(padded.size());
+        for (size_t b = 0; b < blocks; b++)
+            Adpcm::DecodeBlock(data.data() + b * block_align, decoded.data() + b * output.samples_per_block, block_align);
+        decoded.resize(samples.size());
+    }
+    else
+    {
+        output.format = Wav::Format::PCM;
+        output.block_align = 2;
+        output.samples_per_block = 1;
+        data.resize(samples.size() * 2);
+        memcpy(data.data(), samples.data(), data.size());
+    }
+    output.data_size = static_cast<uint32_t>(data.size());
+
+    FILE* file = fopen(paths[1], "wb");
+    if (file == nullptr)
+    {
+        fprintf(stderr, "Cannot create %s\n", paths[1]);
+        return 1;
+    }
+    bool ok = Wav::WriteHeader(file, output) == Status::Ok && fwrite(data.data(), 1, data.size(), file) == data.size();
+    if (ok && (data.size() & 1)) ok = fputc(0, file) != EOF; // RIFF padding
+    fclose(file);
+    if (!ok)
+    {
+        fprintf(stderr, "Failed to write %s\n", paths[1]);
+        return 1;
+    }
+
+    printf("%s : %zu samples at %u Hz, %u bytes of %s data\n", paths[1], samples.size(), output.sample_rate, output.data_size,
+           mode == Mode::Adpcm ? "IMA-ADPCM" : "PCM");
+    if (mode == Mode::Adpcm)
+        printf("compression %.2f:1, SNR %.1f dB\n", samples.size() * 2.0 / data.size(), snr_db(samples, decoded));
+    if (output.sample_rate != SPEAKER_SAMPLE_RATE_HZ)
+        printf("note : the speaker runs at %d Hz, this file will be resampled while played\n", SPEAKER_SAMPLE_RATE_HZ);
+    return 0;
+}
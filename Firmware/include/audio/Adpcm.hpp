@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * IMA-ADPCM codec (4 bits per sample, mono), in the block layout of WAV files (format tag 0x0011) :
+ *
+ *     int16 first sample | uint8 step index | uint8 reserved | (block_align - 4) bytes of 4 bits codes
+ *
+ * Codes are stored low nibble first. The first sample of a block is stored raw in its header, so a block holds
+ * (block_align - 4) * 2 + 1 samples and can be decoded without the previous ones.
+ */
+namespace Adpcm
+{
+    constexpr size_t BLOCK_HEADER_SIZE = 4;
+
+    /// @brief Block size used by the encoder by default (505 samples, 22ms at 22500Hz)
+    constexpr uint16_t DEFAULT_BLOCK_ALIGN = 256;
+
+    /**
+     * @brief Number of samples held by a block.
+     */
+    constexpr size_t SamplesPerBlock(size_t blockAlign)
+    {
+        return (blockAlign - BLOCK_HEADER_SIZE) * 2 + 1;
+    }
+
+    /**
+     * @brief Encode one block.
+     * @param in SamplesPerBlock(blockAlign) samples.
+     * @param out blockAlign bytes.
+     * @param blockAlign Size of the block, in bytes.
+     * @param index Step index carried from the previous block (0 for the first one), updated.
+     */
+    void EncodeBlock(const int16_t* in, uint8_t* out, size_t blockAlign, uint8_t& index);
+
+    /**
+     * @brief Decode one block.
+     * @param in blockAlign bytes.
+     * @param out SamplesPerBlock(blockAlign) samples.
+     * @param blockAlign Size of the block, in bytes.
+     * @note A corrupted step index in the header is clamped, decoding never reads out of the tables.
+     */
+    void DecodeBlock(const uint8_t* in, int16_t* out, size_t blockAlign);
+}
@@ -2,6 +2,7 @@
 #include "common/utils.hpp"
 #include "audio/Speaker.hpp"
 #include "audio/SoundMixer.hpp"
+#include "audio/ToneProvider.hpp"
 
 class AudioManager
 {
@@ -32,7 +33,16 @@ public:
      */
     SoundMixer& getMixer() { return mixer; }
 
+    /**
+     * @brief Play a tone sequence once (UI sounds, jingles, voice chirps, see audio/Tunes.hpp).
+     * @param sequence Sequence to play, must outlive the playback (constant data).
+     * @param gain Gain of the sequence in the mix (0.0 to 1.0).
+     * @return Status::InvalidState if the audio manager isn't initialized, Status::NoMemory if the mixer is full.
+     */
+    Status play(const ToneSequence& sequence, float gain = 1.0f);
+
 private:
     Speaker speaker;
     SoundMixer mixer;
+    bool initialized = false;
 };
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+#include "audio/Speaker.hpp"
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Block processing kernels of the SoundMixer, in Q15 fixed point.
+ * On the ESP32-S3, Accumulate() runs on the PIE vector unit for 16 bytes aligned buffers, plain loops do the rest
+ * (and everything on the other targets and the host).
+ */
+namespace Mixing
+{
+    /// @brief Q15 gain of 1.0 (saturated to the int16 range)
+    constexpr int16_t Q15_ONE = 32767;
+
+    /// @brief Samples below this level go through the limiter untouched (0.75 full scale)
+    constexpr int32_t LIMITER_THRESHOLD = 24576;
+
+    /**
+     * @brief Convert a gain to Q15.
+     * @param gain Linear gain, clamped between 0.0 and 1.0.
+     */
+    int16_t GainToQ15(float gain);
+
+    /**
+     * @brief Multiply two Q15 gains.
+     */
+    inline int16_t MultiplyQ15(int16_t a, int16_t b)
+    {
+        return static_cast<int16_t>((static_cast<int32_t>(a) * b) >> 15);
+    }
+
+    /**
+     * @brief Add a block of samples, scaled by a gain, to an accumulator.
+     * @param acc Accumulator, one int32 per sample (the sum of 65536 full scale blocks fits).
+     * @param src Samples to add.
+     * @param gain Q15 gain applied to the samples (Q15_ONE adds them unchanged).
+     * @param count Number of samples.
+     * @note Gives the same result on every target : the ESP32-S3 kernel scales the samples exactly like the plain loop.
+     */
+    void Accumulate(int32_t* acc, const Speaker::Sample* src, int16_t gain, size_t count);
+
+    /**
+     * @brief Bring an accumulator back to the sample range through a soft-knee limiter.
+     * @param out Output samples.
+     * @param acc Accumulator filled by Accumulate().
+     * @param count Number of samples.
+     * @return Number of samples above LIMITER_THRESHOLD (the ones bent by the knee).
+     * @note Below LIMITER_THRESHOLD the signal is untouched. Above, it follows T + K·d / (d + K)
+     *       (d the excess, K the headroom left), which has a unit slope at the threshold and tends
+     *       to full scale without ever reaching it : no hard clipping, whatever the number of providers.
+     *       Blocks below the threshold are only copied, the knee (and its divide) is only paid by the samples above it.
+     */
+    size_t SoftLimit(Speaker::Sample* out, const int32_t* acc, size_t count);
+}
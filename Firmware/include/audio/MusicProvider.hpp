@@ -1,24 +1,19 @@
 #pragma once
-#include "audio/SoundProvider.hpp"
-#include "audio/Speaker.hpp"
+#include "audio/StreamProvider.hpp"
 #include "common/utils.hpp"
 
-class MusicProvider : public SoundProvider
+/**
+ * @brief Plays a WAV file of the LittleFS storage (streamed, see StreamProvider).
+ */
+class MusicProvider : public StreamProvider
 {
 public:
     constexpr static const char* TAG = "MusicProvider";
 
-    MusicProvider();
-    ~MusicProvider();
-
-    Status loadFromFile(const char* filepath);
-
-    void stop();
-
-    bool provideSamples(Speaker::Sample* buffer, size_t sampleCount) override;
-
-private:
-    char* file_content = nullptr;
-    size_t content_size = 0;
-    size_t read_position = 0;
-};
\ No newline at end of file
+    /**
+     * @brief Open a WAV file of the storage.
+     * @param filepath Path of the file, relative to the storage root (e.g. "test.wav").
+     * @param quality Resampling quality, used if the file isn't at SPEAKER_SAMPLE_RATE_HZ.
+     */
+    Status loadFromFile(const char* filepath, Resampler::Quality quality = Resampler::Quality::Medium);
+};
@@ -0,0 +1,116 @@
+#pragma once
+#include "audio/SoundProvider.hpp"
+#include "common/utils.hpp"
+
+/**
+ * @brief Streaming polyphase FIR sample rate converter (mono, 16 bits).
+ * @note The rate ratio is reduced to up / down (e.g. 16000 -> 22500 Hz is 45 / 32), and each output sample is
+ *       one dot product between the last input samples and one of the `up` phases of a Kaiser windowed sinc,
+ *       stored in Q14. Ratios needing more than MAX_PHASES phases are approximated by the closest one that
+ *       doesn't (see getRatioError(), a few ppm for the usual rates).
+ *       Memory : up * taps coefficients, plus taps + INPUT_BLOCK samples of input. Decimation (e.g. 44100 -> 22500 Hz)
+ *       uses longer windows, so it costs about input rate / output rate times more per output sample.
+ */
+class Resampler
+{
+public:
+    constexpr static const char* TAG = "Resampler";
+    constexpr static size_t MAX_PHASES = 160;
+    constexpr static size_t MAX_TAPS = 128;
+    /// @brief Number of input samples asked at once to the source by provide()
+    constexpr static size_t INPUT_BLOCK = 256;
+
+    /**
+     * Quality / CPU trade-off
+     * - `Low`: 8 taps per phase, flat up to ~55% of the Nyquist frequency, images / aliases below -50 dB
+     * - `Medium`: 16 taps per phase, flat up to ~75%, below -65 dB (the default)
+     * - `High`: 32 taps per phase, flat up to ~85%, below -75 dB, for music
+     * (see bench_resampler for the measures)
+     */
+    enum class Quality : uint8_t
+    {
+        Low,
+        Medium,
+        High,
+    };
+
+    Resampler() = default;
+    ~Resampler();
+    Resampler(const Resampler&) = delete;
+    Resampler& operator=(const Resampler&) = delete;
+
+    /**
+     * @brief Design the filter for a conversion.
+     * @param inputRateHz Sample rate of the input.
+     * @param outputRateHz Sample rate of the output.
+     * @param quality Quality / CPU trade-off.
+     * @return Status::InvalidParameters if a rate is 0.
+     */
+    Status init(uint32_t inputRateHz, uint32_t outputRateHz, Quality quality = Quality::Medium);
+
+    void deinit();
+
+    /// @brief Forget the past input (start a new stream with the same conversion)
+    void reset();
+
+    /**
+     * @brief Convert a block of input (push style).
+     * @param in Input samples.
+     * @param inCount Number of input samples.
+     * @param consumed Set to the number of input samples taken (the others must be given again).
+     * @param out Output samples.
+     * @param outCount Maximum number of output samples.
+     * @return Number of output samples written.
+     */
+    size_t process(const Speaker::Sample* in, size_t inCount, size_t& consumed, Speaker::Sample* out, size_t outCount);
+
+    /**
+     * @brief Fill an output buffer from a source provider (pull style).
+     * @param source Provider running at the input rate.
+     * @param out Output samples.
+     * @param count Number of output samples.
+     * @return false once the source ended and the filter is flushed (same contract as SoundProvider::provideSamples).
+     */
+    bool provide(SoundProvider& source, Speaker::Sample* out, size_t count);
+
+    bool isPassthrough() const { return up == 1 && down == 1; }
+    uint16_t getPhases() const { return up; }
+    uint8_t getTaps() const { return taps; }
+
+    /// @brief Relative error between the requested and the implemented ratio (0 when exact)
+    float getRatioError() const { return ratioError; }
+
+private:
+    int16_t* coefficients = nullptr; // [phase][tap], Q14, in input order
+    Speaker::Sample* buffer = nullptr;
+    size_t capacity = 0;
+    size_t filled = 0;
+    size_t position = 0; // first input sample of the next output window
+    uint16_t phase = 0;
+    uint16_t up = 1;
+    uint16_t down = 1;
+    uint8_t taps = 0;
+    float ratioError = 0.0f;
+
+    bool sourceEnded = false;
+    size_t flushLeft = 0;
+
+    size_t produce(Speaker::Sample* out, size_t outCount);
+};
+
+/**
+ * @brief Sound provider playing another provider at a different sample rate.
+ * @note Takes the ownership of the source (deleted with this provider).
+ */
+class ResampledProvider : public SoundProvider
+{
+public:
+    ResampledProvider(SoundProvider* source, uint32_t sourceRateHz, Resampler::Quality quality = Resampler::Quality::Medium);
+    ~ResampledProvider();
+
+    bool provideSamples(Speaker::Sample* buffer, size_t sampleCount) override;
+
+private:
+    SoundProvider* source;
+    Resampler resampler;
+};
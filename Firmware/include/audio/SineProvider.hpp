@@ -1,5 +1,6 @@
 #pragma once
 #include "audio/SoundProvider.hpp"
+#include "audio/Synth.hpp"
 #include "common/utils.hpp"
 
 class SineProvider : public SoundProvider
@@ -17,6 +18,5 @@ public:
 private:
     float volume = 1.0f;
     float frequency = 440.0f;
-    float phase = 0.0f;
-    float phaseIncrement = 0.0f;
-};
\ No newline at end of file
+    Synth::Oscillator oscillator;
+};
@@ -8,6 +8,28 @@ class SoundMixer
 {
 public:
     constexpr static const char* TAG = "SoundMixer";
+    constexpr static size_t MIX_BUFFER_SIZE = 512;
+
+    /**
+     * Mixer statistics
+     * - `buffers`: number of buffers mixed
+     * - `last_mix_us`: CPU time spent mixing the last buffer (providers rendering included)
+     * - `max_mix_us`: maximum CPU time spent on a buffer
+     * - `avg_mix_us`: average CPU time spent on a buffer
+     * - `budget_us`: duration of a buffer at SPEAKER_SAMPLE_RATE_HZ (mixing must stay well below)
+     * - `limited_samples`: number of samples bent by the limiter
+     * - `active_providers`: number of providers mixed in the last buffer
+     */
+    struct Stats
+    {
+        uint32_t buffers;
+        uint32_t last_mix_us;
+        uint32_t max_mix_us;
+        uint32_t avg_mix_us;
+        uint32_t budget_us;
+        uint32_t limited_samples;
+        uint8_t active_providers;
+    };
 
     SoundMixer(Speaker& speaker);
 
@@ -20,10 +42,38 @@ public:
     /**
      * @brief Add an audio provider to the mixer
      * @param provider Pointer to the audio provider to add
+     * @param gain Gain of the provider in the mix (0.0 to 1.0)
      * @return Error code indicating success or failure
      * @note The ownership of the provider is transferred to the mixer, which will delete it when no longer needed
      */
-    Status addSoundProvider(SoundProvider* provider);
+    Status addSoundProvider(SoundProvider* provider, float gain = 1.0f);
+
+    /**
+     * @brief Change the gain of a provider in the mix
+     * @param provider Provider added with addSoundProvider()
+     * @param gain Gain of the provider (0.0 to 1.0)
+     * @return Status::NotFound if the provider isn't (or no longer) in the mixer
+     */
+    Status setProviderGain(SoundProvider* provider, float gain);
+
+    /**
+     * @brief Mix one buffer of every provider into the given buffer, with gains and master volume applied
+     * @param buffer Buffer to fill
+     * @param sampleCount Number of samples to mix (at most MIX_BUFFER_SIZE)
+     * @note Called by the mixing task for each buffer sent to the speaker. Providers running out of samples are deleted.
+     *       Providers render without the provider list locked, so adding a provider or changing a volume never waits for them.
+     */
+    void mix(Speaker::Sample* buffer, size_t sampleCount);
+
+    /**
+     * @brief Get the mixer statistics
+     */
+    Stats getStats();
+
+    /**
+     * @brief Reset the mixer statistics
+     */
+    void resetStats();
 
     /**
      * @brief Internal mixing task
@@ -33,14 +83,22 @@ public:
     void __internal_task(void* pvParams);
 
 private:
-    constexpr static size_t MIX_BUFFER_SIZE = 512;
+    struct Slot
+    {
+        SoundProvider* provider = nullptr;
+        int16_t gain = 0; // Q15
+    };
 
-    SoundProvider* providers[SPEAKER_NB_AUDIO_PROVIDERS];
-    std::mutex mixerMutex;
-    float masterVolume; // Master volume (0.0 to 1.0)
+    Slot slots[SPEAKER_NB_AUDIO_PROVIDERS];
+    std::mutex slotsMutex;  // Protects slots, master volume and stats (short sections only)
+    std::mutex renderMutex; // Held while providers render, so deinit() never deletes one in use
+    int16_t masterGain;     // Master volume, Q15
     Speaker& speaker;
-    bool running;
+    bool running = false;
+    Stats stats = {};
+    uint64_t totalMixUs = 0;
 
-    Speaker::Sample mixBuffer[MIX_BUFFER_SIZE];
-    Speaker::Sample sourceBuffer[MIX_BUFFER_SIZE];
-};
\ No newline at end of file
+    alignas(16) int32_t accBuffer[MIX_BUFFER_SIZE];
+    alignas(16) Speaker::Sample mixBuffer[MIX_BUFFER_SIZE];
+    alignas(16) Speaker::Sample sourceBuffer[MIX_BUFFER_SIZE];
+};
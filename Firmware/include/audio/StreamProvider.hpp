@@ -0,0 +1,115 @@
+#pragma once
+#include "audio/Resampler.hpp"
+#include "audio/SoundProvider.hpp"
+#include "audio/Wav.hpp"
+#include "common/config.hpp"
+#include <atomic>
+#include <cstdio>
+
+/**
+ * @brief Sound provider streaming a WAV file (mono, 16 bits PCM or IMA-ADPCM) from the filesystem.
+ * @note The file is read in SPEAKER_STREAM_CHUNK_SIZE chunks on a double buffer : the mixer plays one chunk
+ *       while a shared loader task reads the next one, so neither the mixer nor the caller of open() waits for
+ *       the whole file, and the memory used doesn't depend on its length.
+ *       Files at another sample rate than SPEAKER_SAMPLE_RATE_HZ go through a Resampler.
+ *       Like every provider, it is deleted by the mixer once the file is over.
+ */
+class StreamProvider : public SoundProvider
+{
+public:
+    constexpr static const char* TAG = "StreamProvider";
+
+    /**
+     * Streaming statistics
+     * - `chunks_read`: number of chunks read from the file
+     * - `underruns`: number of times the next chunk wasn't loaded in time (silence was played instead)
+     * - `max_read_us`: longest chunk read
+     */
+    struct Stats
+    {
+        uint32_t chunks_read;
+        uint32_t underruns;
+        uint32_t max_read_us;
+    };
+
+    StreamProvider();
+    ~StreamProvider();
+
+    /**
+     * @brief Open a WAV file and load its first chunk.
+     * @param path Full path of the file (e.g. on LittleFS, "/storage/sounds/bark.wav").
+     * @param quality Resampling quality, used if the file isn't at SPEAKER_SAMPLE_RATE_HZ.
+     * @return Status::NotFound if the file doesn't exist, Status::InvalidParameters if its format isn't supported.
+     */
+    Status open(const char* path, Resampler::Quality quality = Resampler::Quality::Medium);
+
+    /// @brief Stop the playback (the mixer deletes the provider on its next buffer)
+    void stop();
+
+    bool provideSamples(Speaker::Sample* buffer, size_t sampleCount) override;
+
+    const Wav::Info& getInfo() const { return info; }
+
+    Stats getStats() const;
+
+    /**
+     * @brief Read the next part of the file in a chunk.
+     * @note YOU SHOULD NOT CALL THIS FUNCTION DIRECTLY (called by the loader task)
+     */
+    void __internal_fill(uint8_t chunk);
+
+private:
+    enum ChunkState : uint8_t
+    {
+        CHUNK_EMPTY,
+        CHUNK_LOADING,
+        CHUNK_READY,
+    };
+
+    // gives the file samples (at the file rate) to the resampler
+    struct Reader : public SoundProvider
+    {
+        StreamProvider* stream;
+        explicit Reader(StreamProvider* stream) : stream(stream) {}
+        bool provideSamples(Speaker::Sample* buffer, size_t sampleCount) override { return stream->readSamples(buffer, sampleCount); }
+    };
+
+    struct Chunk
+    {
+        uint8_t* data = nullptr;
+        size_t size = 0; // valid bytes, 0 at the end of the file
+        std::atomic<uint8_t> state{CHUNK_EMPTY};
+    };
+
+    FILE* file = nullptr;
+    Wav::Info info = {};
+    size_t chunkSize = 0;     // multiple of the block size
+    uint32_t bytesLeft = 0;   // sample data not read yet (loader side)
+    uint32_t samplesLeft = 0; // samples not played yet (mixer side)
+
+    Chunk chunks[2];
+    uint8_t current = 0;
+    size_t position = 0; // in the current chunk, in bytes
+
+    // decoded IMA-ADPCM block
+    int16_t* decoded = nullptr;
+    size_t decodedCount = 0;
+    size_t decodedPosition = 0;
+
+    std::atomic<bool> stopped{false};
+    std::atomic<uint8_t> pending{0}; // fills queued to the loader task
+    std::atomic<uint32_t> chunksRead{0};
+    std::atomic<uint32_t> maxReadUs{0};
+    uint32_t underruns = 0;
+
+    Resampler resampler;
+    Reader reader{this};
+
+    void release();
+    void fill(uint8_t chunk);
+    Status requestFill(uint8_t chunk);
+    /// @brief Current chunk if loaded (nullptr on underrun), moving to the next one when the current is consumed
+    Chunk* currentChunk();
+    /// @brief Next samples of the file, at its own sample rate
+    bool readSamples(Speaker::Sample* buffer, size_t sampleCount);
+};
@@ -0,0 +1,121 @@
+#pragma once
+#include "audio/Speaker.hpp"
+#include "common/utils.hpp"
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Wavetable synthesis building blocks : oscillators reading one-period tables with a 32 bits phase accumulator,
+ * and ADSR envelopes. Everything runs in fixed point, one block of samples at a time.
+ */
+namespace Synth
+{
+    /// @brief log2 of the number of samples in one period of a table
+    constexpr uint32_t TABLE_BITS = 10;
+    constexpr uint32_t TABLE_SIZE = 1 << TABLE_BITS;
+
+    enum class Waveform : uint8_t
+    {
+        Sine,
+        Square,
+        Triangle,
+        Noise, // one period of white noise, pitched by the oscillator frequency (chiptune style)
+        Count
+    };
+
+    /**
+     * @brief Get the table of a waveform.
+     * @return TABLE_SIZE + 1 samples (the first sample is repeated at the end for the interpolation), full scale.
+     * @note Tables are built on first use.
+     */
+    const int16_t* GetTable(Waveform waveform);
+
+    /**
+     * @brief Convert a frequency to a phase increment (fraction of period per sample, 2^32 = one period).
+     */
+    uint32_t PhaseIncrement(float frequencyHz);
+
+    class Oscillator
+    {
+    public:
+        Oscillator(Waveform waveform = Waveform::Sine, float frequencyHz = 440.0f);
+
+        void setWaveform(Waveform waveform);
+        void setFrequency(float frequencyHz);
+        void setPhaseIncrement(uint32_t increment) { this->increment = increment; }
+        uint32_t getPhaseIncrement() const { return increment; }
+        void resetPhase() { phase = 0; }
+
+        /**
+         * @brief Render samples.
+         * @param buffer Output samples.
+         * @param sampleCount Number of samples to render.
+         * @param amplitude Q15 amplitude of the output (32767 = full scale).
+         * @note Sine and triangle are linearly interpolated between table samples, square and noise are not
+         *       (interpolating them would only blur their edges).
+         */
+        void render(Speaker::Sample* buffer, size_t sampleCount, int16_t amplitude);
+
+    private:
+        const int16_t* table;
+        bool interpolate;
+        uint32_t phase = 0;
+        uint32_t increment;
+    };
+
+    /**
+     * ADSR envelope settings
+     * - `attack_ms`: time to rise from silence to full level
+     * - `decay_ms`: time to fall from full level to the sustain level
+     * - `sustain`: level held until release, 0 to 255
+     * - `release_ms`: time to fall from the current level to silence
+     */
+    struct EnvelopeSettings
+    {
+        uint16_t attack_ms;
+        uint16_t decay_ms;
+        uint8_t sustain;
+        uint16_t release_ms;
+    };
+
+    class Envelope
+    {
+    public:
+        enum class Stage : uint8_t
+        {
+            Idle,
+            Attack,
+            Decay,
+            Sustain,
+            Release,
+        };
+
+        Envelope(const EnvelopeSettings& settings = { 5, 20, 200, 30 });
+
+        void setSettings(const EnvelopeSettings& settings);
+
+        /// @brief Start the attack stage (from the current level, so retriggering doesn't click)
+        void noteOn();
+
+        /// @brief Start the release stage
+        void noteOff();
+
+        /**
+         * @brief Multiply samples by the envelope, advancing it by sampleCount samples.
+         * @note Stages are processed as linear ramps over whole segments, no per-sample stage check.
+         */
+        void apply(Speaker::Sample* buffer, size_t sampleCount);
+
+        Stage getStage() const { return stage; }
+        bool isIdle() const { return stage == Stage::Idle; }
+
+    private:
+        EnvelopeSettings settings;
+        Stage stage = Stage::Idle;
+        int32_t level = 0;     // Q15 level, << 16 for the ramps precision
+        int32_t step = 0;      // level change per sample in the current stage
+        uint32_t remaining = 0; // samples left in the current stage (Attack, Decay, Release)
+
+        void enterStage(Stage stage);
+    };
+}
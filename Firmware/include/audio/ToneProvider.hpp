@@ -0,0 +1,64 @@
+#pragma once
+#include "audio/SoundProvider.hpp"
+#include "audio/Synth.hpp"
+
+/**
+ * One event of a tone sequence
+ * - `waveform`: waveform of the oscillator
+ * - `frequency_hz`: frequency at the start of the tone (0 for a rest)
+ * - `end_frequency_hz`: frequency at the end of the tone, for glides and chirps (0 to keep frequency_hz)
+ * - `duration_ms`: duration of the tone, release included
+ * - `volume`: volume of the tone, 0 to 255
+ */
+struct Tone
+{
+    Synth::Waveform waveform;
+    uint16_t frequency_hz;
+    uint16_t end_frequency_hz;
+    uint16_t duration_ms;
+    uint8_t volume;
+};
+
+/**
+ * A scripted sound : tones played one after the other, shaped by the same envelope.
+ * @note Sequences are meant to be constant data (see audio/Tunes.hpp), providers only keep a pointer to them.
+ */
+struct ToneSequence
+{
+    const Tone* tones;
+    uint8_t count;
+    Synth::EnvelopeSettings envelope;
+};
+
+/**
+ * @brief Sound provider playing a ToneSequence once.
+ * @note Stops providing samples at the end of the sequence, so the mixer deletes it : create it with new,
+ *       and give it to SoundMixer::addSoundProvider() (or use AudioManager::play()).
+ */
+class ToneProvider : public SoundProvider
+{
+public:
+    /// @brief Number of samples between two frequency updates during a glide
+    constexpr static size_t GLIDE_STEP_SAMPLES = 32;
+
+    ToneProvider(const ToneSequence& sequence);
+
+    bool provideSamples(Speaker::Sample* buffer, size_t sampleCount) override;
+
+    bool isFinished() const { return index >= sequence.count; }
+
+private:
+    const ToneSequence& sequence;
+    Synth::Oscillator oscillator;
+    Synth::Envelope envelope;
+    uint8_t index = 0;
+
+    uint32_t elapsed = 0;   // samples played in the current tone
+    uint32_t duration = 0;  // samples of the current tone
+    uint32_t releaseAt = 0; // sample at which the current tone is released
+    uint32_t startIncrement = 0;
+    uint32_t endIncrement = 0;
+    int16_t amplitude = 0;
+
+    void startTone();
+};
@@ -0,0 +1,37 @@
+#pragma once
+#include "audio/ToneProvider.hpp"
+
+/**
+ * Scripted sounds of the robot : UI feedback, jingles, and the chirps making its "voice".
+ */
+namespace Tunes
+{
+    /// UI feedback
+    extern const ToneSequence UiClick;
+    extern const ToneSequence UiSelect;
+    extern const ToneSequence UiBack;
+    extern const ToneSequence UiError;
+
+    /// Jingles
+    extern const ToneSequence Boot;
+    extern const ToneSequence Shutdown;
+
+    /**
+     * @brief Emotions the robot can express with its voice.
+     */
+    enum class Voice : uint8_t
+    {
+        Happy,
+        Sad,
+        Curious,
+        Surprised,
+        Alert,
+        Sleepy,
+        Count
+    };
+
+    /**
+     * @brief Get the chirp expressing an emotion.
+     */
+    const ToneSequence& GetVoice(Voice voice);
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "common/utils.hpp"
+#include <cstdio>
+
+/**
+ * @brief Minimal RIFF / WAVE reader and writer for the audio assets (mono, 16 bits PCM or IMA-ADPCM).
+ */
+namespace Wav
+{
+    enum class Format : uint16_t
+    {
+        PCM = 0x0001,
+        ImaAdpcm = 0x0011,
+    };
+
+    /**
+     * Description of a WAV file
+     * - `format`: encoding of the samples
+     * - `channels`: number of channels (only mono is played)
+     * - `sample_rate`: in Hz
+     * - `block_align`: size of a block (IMA-ADPCM), or of a frame (PCM), in bytes
+     * - `samples_per_block`: samples in a block (IMA-ADPCM), 1 for PCM
+     * - `sample_count`: total number of samples
+     * - `data_offset`: position of the first sample data in the file
+     * - `data_size`: size of the sample data, in bytes
+     */
+    struct Info
+    {
+        Format format;
+        uint16_t channels;
+        uint32_t sample_rate;
+        uint16_t block_align;
+        uint16_t samples_per_block;
+        uint32_t sample_count;
+        uint32_t data_offset;
+        uint32_t data_size;
+    };
+
+    /**
+     * @brief Read the header of a WAV file.
+     * @param file File open for reading, positioned at the start. Left at data_offset on success.
+     * @param info Filled with the description of the file.
+     * @return Status::InvalidParameters if the file isn't a WAV file in a supported format.
+     */
+    Status ReadHeader(FILE* file, Info& info);
+
+    /**
+     * @brief Write the header of a WAV file (fmt, fact for IMA-ADPCM, and the data chunk header).
+     * @param file File open for writing, positioned at the start.
+     * @param info Description of the file. data_size and sample_count must be final.
+     */
+    Status WriteHeader(FILE* file, const Info& info);
+}
@@ -0,0 +1,169 @@
+#pragma once
+#include "common/LED.hpp"
+#include "common/config.hpp"
+#include <cstdint>
+
+namespace LED
+{
+    /** Color component in Q8.8 fixed point (0 to 255 + 255/256), in perceived brightness */
+    using Q8_8 = uint16_t;
+
+    /**
+     * @brief Priority layers of an LED : the highest layer holding an effect is shown, an effect ending uncovers the
+     *        layer below it.
+     * - `Base`: color set by SetColor()
+     * - `Status`: robot states (connecting, updating...)
+     * - `Alert`: short notifications over the status
+     * - `Error`: error codes (LoopErrorCode())
+     */
+    enum class Layer : uint8_t
+    {
+        Base,
+        Status,
+        Alert,
+        Error,
+        COUNT,
+    };
+
+    enum class EffectType : uint8_t
+    {
+        None,    // empty layer
+        Solid,   // `color`
+        Fade,    // from the color the layer showed to `color` in `period_ms`, then `color`
+        Breathe, // `color` rising and falling smoothly from off, one breath every `period_ms`
+        Pulse,   // quick flash of `color` fading out, one every `period_ms`
+        Rainbow, // hue wheel at the brightness of `color`, one turn every `period_ms`
+        Blink,   // `count` blinks of `color` then a pause (two blinks long), every `period_ms`
+    };
+
+    /**
+     * An effect of a layer
+     * - `type`: see EffectType
+     * - `color`: color of the effect, in LED levels (as given to SetColor())
+     * - `period_ms`: transition time of a fade, period of the other animated effects
+     * - `count`: blinks per period
+     * - `duration_ms`: the effect ends (and the layer is emptied) after that time, 0 to keep it until replaced
+     */
+    struct Effect
+    {
+        EffectType type = EffectType::None;
+        Color color;
+        uint16_t period_ms = 0;
+        uint8_t count = 0;
+        uint32_t duration_ms = 0;
+
+        static Effect Solid(Color color, uint32_t duration_ms = 0);
+        static Effect Fade(Color color, uint16_t transition_ms, uint32_t duration_ms = 0);
+        static Effect Breathe(Color color, uint16_t period_ms, uint32_t duration_ms = 0);
+        static Effect Pulse(Color color, uint16_t period_ms, uint32_t duration_ms = 0);
+        static Effect Rainbow(uint8_t brightness, uint16_t period_ms, uint32_t duration_ms = 0);
+        static Effect Blink(Color color, uint8_t count, uint16_t period_ms, uint32_t duration_ms = 0);
+    };
+
+    /**
+     * @brief Effects of the LED strip : computes the strip frame at a given time and the time it changes next.
+     *
+     * Colors are interpolated in Q8.8 perceived brightness (LED levels are turned into it through the inverse gamma
+     * curve, and back at the end), so fades and breaths look even and a fade ends exactly on its color.
+     * render() tells if the frame differs from the previous one, so unchanged frames aren't sent, and gives the time
+     * of the next change : nothing is computed while the strip is static.
+     * @note Portable (no ESP-IDF call), times are in microseconds. Not thread safe.
+     */
+    class EffectEngine
+    {
+    public:
+        constexpr static int64_t NO_DEADLINE = INT64_MAX;
+        constexpr static size_t FRAME_SIZE = LED_COUNT * 3;
+
+        /**
+         * Frames computed by render()
+         * - `frames_sent`: frames that differed from the previous one
+         * - `frames_skipped`: frames equal to the previous one
+         */
+        struct Stats
+        {
+            uint32_t frames_sent;
+            uint32_t frames_skipped;
+        };
+
+        EffectEngine();
+
+        /**
+         * @brief Start an effect on a layer of an LED, replacing the one it held.
+         * @return Status::InvalidParameters on an unknown LED or layer.
+         */
+        Status set(Id id, Layer layer, const Effect& effect, int64_t now_us);
+
+        /**
+         * @brief Empty a layer of an LED.
+         * @return Status::InvalidParameters on an unknown LED or layer.
+         */
+        Status clear(Id id, Layer layer);
+
+        /**
+         * @brief Color a layer ends up on (the color of a fade, black for an empty layer or an ended effect).
+         */
+        Color getColor(Id id, Layer layer, int64_t now_us) const;
+
+        /**
+         * @brief Compute the frame of the strip.
+         * @param frame Receives the LED levels, in the strip order (GRB for each LED).
+         * @param deadline_us Receives the time of the next change (NO_DEADLINE if none).
+         * @return true if the frame differs from the previous one (the first frame always does).
+         */
+        bool render(int64_t now_us, uint8_t frame[FRAME_SIZE], int64_t& deadline_us);
+
+        Stats getStats() const;
+
+        void resetStats();
+
+        /**
+         * @brief Perceived brightness (Q8.8) to LED level, through the LED_GAMMA curve.
+         */
+        static uint8_t ToLevel(Q8_8 brightness);
+
+        /**
+         * @brief LED level to perceived brightness (Q8.8), ToLevel(ToBrightness(level)) == level.
+         */
+        static Q8_8 ToBrightness(uint8_t level);
+
+    private:
+        struct Slot
+        {
+            Effect effect;
+            int64_t start_us;
+            Q8_8 from[3]; // fade start, in R, G, B order
+        };
+
+        Slot slots[LED_COUNT][static_cast<uint8_t>(Layer::COUNT)] = {};
+        uint8_t last_frame[FRAME_SIZE] = {};
+        bool has_frame = false;
+        Stats stats = {};
+
+        bool active(const Slot& slot, int64_t now_us) const;
+        void value(const Slot& slot, int64_t now_us, Q8_8 out[3]) const;
+        int64_t next_change(const Slot& slot, int64_t now_us) const;
+    };
+
+    /**
+     * @brief Start an effect on a layer of an LED (SetColor() uses the Base layer).
+     * @param id The LED identifier.
+     * @param layer The layer to hold the effect.
+     * @param effect The effect.
+     * @return Error code.
+     */
+    Status SetEffect(Id id, Layer layer, const Effect& effect);
+
+    /**
+     * @brief Remove the effect of a layer of an LED, showing the layer below it.
+     * @param id The LED identifier.
+     * @param layer The layer to empty.
+     * @return Error code.
+     */
+    Status ClearEffect(Id id, Layer layer);
+
+    /**
+     * @brief Frames sent to the strip and frames skipped because nothing changed.
+     */
+    EffectEngine::Stats GetStats();
+}
@@ -104,13 +104,15 @@ namespace LED
     /**
      * @brief Show error code on first LED as a color.
      * @param errCode Error code to display.
-     * @note This function launches a task in an infinite loop, displaying the error code.
+     * @note The code is shown in a loop by a background task (started on the first call), until clearErrorCode() or
+     *       another code.
      * @return void.
      */
     void LoopErrorCode(uint8_t errCode);
 
     /**
      * @brief Clear any looping error code displayed on the LED
+     * @note Only notifies the display task : it uncovers the status color itself, then waits for the next code.
      */
     void clearErrorCode();
 }
\ No newline at end of file
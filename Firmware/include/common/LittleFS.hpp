@@ -5,6 +5,9 @@
 
 namespace LittleFS
 {
+    /// @brief Mount point of the filesystem, prefix of the full paths
+    constexpr const char* ROOT_FOLDER = "/storage";
+
     /**
      * @brief Initialize and mount LittleFS
      * @return Error code
@@ -0,0 +1,270 @@
+#pragma once
+#include "common/utils.hpp"
+#include "esp_heap_caps.h"
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+/**
+ * @brief Memory region the blocks of a Pool live in.
+ * - `Internal`: internal DRAM, fast and DMA capable, but scarce when Wi-Fi is running
+ * - `PSRAM`: external SPI RAM, big but slower (and not DMA capable for every peripheral)
+ */
+enum class PoolPlacement : uint8_t
+{
+    Internal,
+    PSRAM,
+};
+
+/**
+ * @brief Fixed-capacity pool of fixed-size blocks.
+ * @tparam BlockSize Usable size of each block, in bytes.
+ * @tparam BlockCount Number of blocks (at most 65534).
+ * @note The storage is allocated once by init(), in the requested memory region, and never moves afterwards.
+ *       allocate() / deallocate() are lock-free (no FreeRTOS call, no heap access), so they can be used from
+ *       any core, from time critical tasks and from ISRs. Both are O(1).
+ */
+template <size_t BlockSize, size_t BlockCount>
+class Pool
+{
+    static_assert(BlockSize > 0, "Pool blocks can't be empty");
+    static_assert(BlockCount > 0 && BlockCount < 0xFFFF, "Pool block count must fit on 16 bits");
+
+public:
+    constexpr static size_t ALIGNMENT = alignof(std::max_align_t);
+    constexpr static size_t BLOCK_SIZE = BlockSize;
+    constexpr static size_t BLOCK_COUNT = BlockCount;
+
+    /**
+     * Usage statistics of the pool
+     * - `in_use`: number of blocks currently allocated
+     * - `high_water`: maximum number of blocks allocated at the same time
+     * - `failures`: number of allocations that failed because the pool was empty
+     */
+    struct Stats
+    {
+        uint32_t in_use;
+        uint32_t high_water;
+        uint32_t failures;
+    };
+
+    Pool() = default;
+    Pool(const Pool&) = delete;
+    Pool& operator=(const Pool&) = delete;
+
+    ~Pool()
+    {
+        if (storage != nullptr && in_use.load() == 0)
+        {
+            heap_caps_free(storage);
+        }
+    }
+
+    /**
+     * @brief Allocate the storage of the pool.
+     * @param placement Memory region of the blocks.
+     * @return Status::NoMemory if the region can't hold the pool. Does nothing if already initialized.
+     */
+    Status init(PoolPlacement placement = PoolPlacement::Internal)
+    {
+        if (storage != nullptr) return Status::Ok;
+
+        uint32_t caps = MALLOC_CAP_8BIT | (placement == PoolPlacement::PSRAM ? MALLOC_CAP_SPIRAM : MALLOC_CAP_INTERNAL);
+        storage = static_cast<uint8_t*>(heap_caps_aligned_alloc(ALIGNMENT, STRIDE * BlockCount, caps));
+        if (storage == nullptr)
+        {
+            return Status::NoMemory;
+        }
+        this->placement = placement;
+
+        // chain every block in the free list, in address order
+        for (size_t i = 0; i < BlockCount; i++)
+        {
+            next_free[i].store(i + 1 < BlockCount ? static_cast<uint16_t>(i + 1) : NO_BLOCK, std::memory_order_relaxed);
+        }
+        head.store(0, std::memory_order_release);
+        return Status::Ok;
+    }
+
+    /**
+     * @brief Release the storage of the pool.
+     * @return Status::InvalidState if some blocks are still allocated.
+     */
+    Status deinit()
+    {
+        if (storage == nullptr) return Status::Ok;
+        if (in_use.load() != 0) return Status::InvalidState;
+
+        head.store(NO_BLOCK, std::memory_order_release);
+        heap_caps_free(storage);
+        storage = nullptr;
+        return Status::Ok;
+    }
+
+    /**
+     * @brief Take a block from the pool.
+     * @return The block (BlockSize bytes, aligned on ALIGNMENT), or nullptr if the pool is empty or not initialized.
+     */
+    void* allocate()
+    {
+        uint32_t old_head = head.load(std::memory_order_acquire);
+        uint32_t new_head;
+        uint16_t index;
+        do
+        {
+            index = old_head & INDEX_MASK;
+            if (index == NO_BLOCK)
+            {
+                failures.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            // the tag changes on every head update, so a block freed and taken again meanwhile fails the exchange (ABA)
+            new_head = next_tag(old_head) | next_free[index].load(std::memory_order_relaxed);
+        } while (!head.compare_exchange_weak(old_head, new_head, std::memory_order_acq_rel, std::memory_order_acquire));
+
+        uint32_t used = in_use.fetch_add(1, std::memory_order_relaxed) + 1;
+        uint32_t high = high_water.load(std::memory_order_relaxed);
+        while (used > high && !high_water.compare_exchange_weak(high, used, std::memory_order_relaxed)) {}
+
+        return storage + index * STRIDE;
+    }
+
+    /**
+     * @brief Give a block back to the pool.
+     * @param ptr Block returned by allocate() (nullptr is ignored).
+     * @note Giving back a pointer that doesn't belong to the pool is an error, check with owns() if unsure.
+     */
+    void deallocate(void* ptr)
+    {
+        if (ptr == nullptr) return;
+
+        uint16_t index = static_cast<uint16_t>((static_cast<uint8_t*>(ptr) - storage) / STRIDE);
+        uint32_t old_head = head.load(std::memory_order_relaxed);
+        uint32_t new_head;
+        do
+        {
+            next_free[index].store(old_head & INDEX_MASK, std::memory_order_relaxed);
+            new_head = next_tag(old_head) | index;
+        } while (!head.compare_exchange_weak(old_head, new_head, std::memory_order_release, std::memory_order_relaxed));
+
+        in_use.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Build an object in a block of the pool.
+     * @return The object, or nullptr if the pool is empty.
+     */
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+        static_assert(sizeof(T) <= BlockSize && alignof(T) <= ALIGNMENT, "Type doesn't fit in the pool blocks");
+        void* ptr = allocate();
+        if (ptr == nullptr) return nullptr;
+        return new (ptr) T(static_cast<Args&&>(args)...);
+    }
+
+    /**
+     * @brief Destroy an object built with create() and give its block back.
+     */
+    template <typename T>
+    void destroy(T* object)
+    {
+        if (object == nullptr) return;
+        object->~T();
+        deallocate(object);
+    }
+
+    /**
+     * @brief Check if a pointer is a block of this pool.
+     */
+    bool owns(const void* ptr) const
+    {
+        const uint8_t* p = static_cast<const uint8_t*>(ptr);
+        return storage != nullptr && p >= storage && p < storage + STRIDE * BlockCount;
+    }
+
+    bool isInitialized() const { return storage != nullptr; }
+
+    PoolPlacement getPlacement() const { return placement; }
+
+    Stats getStats() const
+    {
+        return Stats{
+            in_use.load(std::memory_order_relaxed),
+            high_water.load(std::memory_order_relaxed),
+            failures.load(std::memory_order_relaxed),
+        };
+    }
+
+    /**
+     * @brief Restart the high-water mark from the current usage, and clear the failures counter.
+     */
+    void resetStats()
+    {
+        high_water.store(in_use.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        failures.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    constexpr static size_t STRIDE = (BlockSize + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    constexpr static uint16_t NO_BLOCK = 0xFFFF;
+    constexpr static uint32_t INDEX_MASK = 0xFFFF;
+
+    // 32 bits CAS are lock-free on the ESP32-S3 (64 bits ones are not), so the head packs a 16 bits tag and a 16 bits index
+    static uint32_t next_tag(uint32_t head_value) { return (head_value & ~INDEX_MASK) + (INDEX_MASK + 1); }
+
+    uint8_t* storage = nullptr;
+    PoolPlacement placement = PoolPlacement::Internal;
+
+    std::atomic<uint32_t> head{NO_BLOCK};
+    std::atomic<uint16_t> next_free[BlockCount];
+
+    std::atomic<uint32_t> in_use{0};
+    std::atomic<uint32_t> high_water{0};
+    std::atomic<uint32_t> failures{0};
+};
+
+/**
+ * @brief STL allocator taking its memory from a Pool.
+ * @note Meant for node based containers (std::list, std::map, std::set...) that allocate one element at a time.
+ *       Requests bigger than a block, or made while the pool is empty, fall back to the heap so the container
+ *       keeps working (they show up in the pool failures counter when the pool was empty).
+ */
+template <typename T, typename PoolT>
+class PoolAllocator
+{
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(PoolT& pool) noexcept : pool(&pool) {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U, PoolT>& other) noexcept : pool(other.pool) {}
+
+    T* allocate(size_t n)
+    {
+        if (n * sizeof(T) <= PoolT::BLOCK_SIZE && alignof(T) <= PoolT::ALIGNMENT)
+        {
+            if (void* ptr = pool->allocate()) return static_cast<T*>(ptr);
+        }
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, size_t) noexcept
+    {
+        if (pool->owns(ptr)) pool->deallocate(ptr);
+        else ::operator delete(ptr);
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U, PoolT>& other) const noexcept { return pool == other.pool; }
+
+    template <typename U>
+    bool operator!=(const PoolAllocator<U, PoolT>& other) const noexcept { return pool != other.pool; }
+
+private:
+    template <typename U, typename P>
+    friend class PoolAllocator;
+
+    PoolT* pool;
+};
@@ -0,0 +1,131 @@
+#pragma once
+#include "common/utils.hpp"
+#include <cstdio>
+
+/**
+ * @brief Binary format of the raw sensor recordings (see SensorRecorder), and helpers to read / write them.
+ *
+ * All values are little endian, structures are packed :
+ *
+ *     FileHeader                          (16 bytes)
+ *     { RecordHeader, payload } ...       until the end of the file
+ *
+ * | Record    | Type | Payload                                                                 |
+ * |-----------|------|-------------------------------------------------------------------------|
+ * | Analog    | 0x01 | float32[16] raw voltages of the analog channels, before the EMA (V)     |
+ * | IMU       | 0x02 | float32 accel x, y, z (g), float32 gyro x, y, z (deg/s)                 |
+ * | Power     | 0x03 | float32 voltage (V), current (A), power (W)                             |
+ * | Motor     | 0x04 | float32[16] duty cycles sent to the motor driver (ms, 0 = disabled)     |
+ * | Reference | 0x10 | ReferencePayload : ground truth, written by simulators / external tools |
+ *
+ * The timestamp of a record is esp_timer_get_time() when the sample was read (in us).
+ * Readers must skip the records they don't know using the payload length.
+ */
+namespace SensorRecord
+{
+    constexpr uint32_t MAGIC = 0x52594E54; // "TNYR"
+    constexpr uint16_t VERSION = 1;
+    /// @brief Biggest payload of the known records
+    constexpr uint16_t MAX_PAYLOAD_SIZE = 64;
+
+    enum class Type : uint8_t
+    {
+        Analog = 0x01,
+        IMU = 0x02,
+        Power = 0x03,
+        Motor = 0x04,
+        Reference = 0x10,
+    };
+
+    struct FileHeader
+    {
+        uint32_t magic;
+        uint16_t version;
+        /// @brief Control loop frequency of the recording robot (in Hz)
+        uint16_t loop_freq_hz;
+        /// @brief Number of analog channels in Analog records
+        uint16_t analog_channels;
+        uint8_t reserved[6];
+    } __attribute__((packed));
+
+    struct RecordHeader
+    {
+        Type type;
+        uint8_t flags;
+        uint16_t length;
+        int64_t timestamp_us;
+    } __attribute__((packed));
+
+    struct ReferencePayload
+    {
+        /// @brief Actual body roll and pitch (in rad)
+        float roll_rad;
+        float pitch_rad;
+        /// @brief Actual leg joint angles, in Joint::Id order (in rad)
+        float joint_angles_rad[12];
+        /// @brief Actual foot contacts, one bit per leg (FL, BL, BR, FR order)
+        uint8_t contacts;
+        uint8_t reserved[3];
+    } __attribute__((packed));
+
+    /**
+     * @brief Sequential writer of a recording file.
+     */
+    class Writer
+    {
+    public:
+        ~Writer();
+
+        /**
+         * @brief Create the file and write its header.
+         * @param path Full path of the file (e.g. on LittleFS, "/storage/rec/walk.rec").
+         */
+        Status open(const char* path, uint16_t loop_freq_hz);
+
+        Status write(Type type, int64_t timestamp_us, const void* payload, uint16_t length);
+
+        Status close();
+
+        bool isOpen() const { return file != nullptr; }
+
+        /// @brief Number of bytes written, header included
+        uint32_t getSize() const { return size; }
+
+    private:
+        FILE* file = nullptr;
+        uint32_t size = 0;
+    };
+
+    /**
+     * @brief Sequential reader of a recording file.
+     */
+    class Reader
+    {
+    public:
+        ~Reader();
+
+        /**
+         * @brief Open the file and check its header.
+         * @return Status::InvalidParameters if it is not a recording.
+         */
+        Status open(const char* path);
+
+        /**
+         * @brief Read the next record.
+         * @param payload Buffer of at least MAX_PAYLOAD_SIZE bytes (bigger payloads are skipped and truncated).
+         * @return Status::NotFound at the end of the file.
+         */
+        Status next(RecordHeader& header, void* payload);
+
+        Status close();
+
+        /// @brief Go back to the first record
+        Status rewind();
+
+        const FileHeader& getFileHeader() const { return file_header; }
+
+    private:
+        FILE* file = nullptr;
+        FileHeader file_header = {};
+    };
+}
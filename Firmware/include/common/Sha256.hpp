@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Streaming SHA-256 (FIPS 180-4).
+ * @note The SHA peripheral does the work on the robot (mbedtls, Sha256.ESP.cpp), host builds provide a software
+ *       implementation. Not thread safe.
+ */
+class Sha256
+{
+public:
+    constexpr static size_t SIZE = 32;
+
+    Sha256();
+    ~Sha256();
+    Sha256(const Sha256&) = delete;
+    Sha256& operator=(const Sha256&) = delete;
+
+    /**
+     * @brief Start a new hash (the constructor already does).
+     */
+    void reset();
+
+    /**
+     * @brief Hash the next bytes of the message.
+     */
+    void update(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Get the hash of the message (call reset() before hashing another one).
+     */
+    void finish(uint8_t out[SIZE]);
+
+    /**
+     * @brief Hash of a whole message.
+     */
+    static void Hash(const uint8_t* data, size_t size, uint8_t out[SIZE]);
+
+private:
+    struct Context;
+    Context* context;
+};
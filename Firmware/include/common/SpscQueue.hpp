@@ -0,0 +1,84 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Fixed-capacity FIFO between one producer and one consumer.
+ * @tparam T Item type, copied in and out.
+ * @tparam Capacity Number of items (a power of two).
+ * @note push() and pop() are lock-free (no FreeRTOS call, no heap access), so the producer can be an ISR and the
+ *       consumer a task, on any core. A push on a full queue is refused and counted, the queued items are kept.
+ */
+template <typename T, size_t Capacity>
+class SpscQueue
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+    static_assert(Capacity <= 0x80000000u, "SpscQueue capacity must fit on 32 bits");
+
+public:
+    constexpr static size_t CAPACITY = Capacity;
+
+    SpscQueue() = default;
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Add an item at the back of the queue (producer side).
+     * @return false if the queue is full (the item is dropped).
+     */
+    bool push(const T& item)
+    {
+        uint32_t write = head.load(std::memory_order_relaxed);
+        if (write - tail.load(std::memory_order_acquire) == Capacity)
+        {
+            drops.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        items[write & MASK] = item;
+        head.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Take the item at the front of the queue (consumer side).
+     * @return false if the queue is empty.
+     */
+    bool pop(T& item)
+    {
+        uint32_t read = tail.load(std::memory_order_relaxed);
+        if (read == head.load(std::memory_order_acquire)) return false;
+        item = items[read & MASK];
+        tail.store(read + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Number of queued items (exact from the producer or the consumer, a snapshot from anywhere else).
+     */
+    size_t size() const
+    {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Number of items refused because the queue was full.
+     */
+    uint32_t dropped() const
+    {
+        return drops.load(std::memory_order_relaxed);
+    }
+
+private:
+    constexpr static uint32_t MASK = Capacity - 1;
+
+    T items[Capacity] = {};
+    std::atomic<uint32_t> head{0}; // next slot written, only moved by the producer
+    std::atomic<uint32_t> tail{0}; // next slot read, only moved by the consumer
+    std::atomic<uint32_t> drops{0};
+};
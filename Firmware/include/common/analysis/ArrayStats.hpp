@@ -59,7 +59,7 @@ namespace ArrayStats
         
         if (size > 1)
         {
-            stats.std_dev = std::sqrtf(M2 / static_cast<float>(size));
+            stats.std_dev = std::sqrt(M2 / static_cast<float>(size));
         } 
         else
         {
@@ -1,9 +1,15 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include <driver/gpio.h>
 
 /** COMPILATION FLAGS **/
+#ifndef DEBUG_MODE
 #define DEBUG_MODE 1  // 1 to enable debug logs and behaviors, 0 to disable
+#endif
+#ifndef OTA_REQUIRE_SIGNED_MANIFEST
+#define OTA_REQUIRE_SIGNED_MANIFEST 0  // 1 to refuse every update manifest when no key is embedded (instead of accepting unsigned ones)
+#endif
 
 /** MULTICORE SETUP */
 constexpr int CORE_BRAIN = 0;
@@ -15,8 +21,20 @@ constexpr uint32_t CONTROL_INTENT_WATCHDOG_MS = 500;
 constexpr const char* OTA_FIRMWARE_LATEST_URL = "https://api.tny-robotics.com/firmware/latest";
 constexpr const char* OTA_FILESYSTEM_DOWNLOAD_URL = "https://cdn.tny-robotics.com/firmware/tny-360/%s/filesystem.bin";
 constexpr int OTA_UPDATE_TIMEOUT_MS = 5000;
-constexpr int OTA_UPDATE_FILESYSTEM_BUFFER_SIZE = 4096; // in bytes
 constexpr const char* OTA_ROBOT_MODEL = "tny-360";
+// Ring buffer between the network reads and the flash writes of an image (in PSRAM), and the size of each read / write
+constexpr size_t OTA_RING_SIZE = 64 * 1024; // in bytes
+constexpr size_t OTA_CHUNK_SIZE = 4096; // in bytes
+// Lost connections resumed (HTTP Range) in a row without new data before giving up, the n-th one after n * OTA_RESUME_DELAY_MS
+constexpr uint8_t OTA_MAX_RESUMES = 8;
+constexpr uint32_t OTA_RESUME_DELAY_MS = 500;
+// Interval of the progress reports of a download
+constexpr uint32_t OTA_PROGRESS_INTERVAL_MS = 250;
+// Network task of the downloads (the update task writes to flash)
+constexpr int OTA_READER_TASK_PRIORITY = 2;
+constexpr uint32_t OTA_READER_STACK_SIZE = 8192; // in bytes
+// The update manifest signatures are checked with the key of src/certs/ota_manifest_key.pem (PEM, ECDSA P-256, embedded
+// by the build). Without it manifests are accepted unsigned like before, or refused with OTA_REQUIRE_SIGNED_MANIFEST
 
 
 /** PHYSICAL INFORMATIONS **/
@@ -52,9 +70,30 @@ constexpr int MAX_PATH_LEN = 128;
 constexpr int RPC_QUEUE_SIZE = 32; // number of pending RPC jobs (between core 0 and core 1)
 
 
+/** Sensor recorder **/
+// Number of samples waiting to be written to the file (between core 1 and core 0)
+constexpr int RECORDER_QUEUE_SIZE = 128;
+// Power is read by the writer task on the brain core while recording (the INA219 is slow to read, never in a control tick)
+constexpr uint32_t RECORDER_POWER_PERIOD_MS = 50;
+// Maximum size of a recording chunk sent through the protocol
+constexpr uint16_t RECORDER_READ_CHUNK_SIZE = 192; // in bytes
+
+
 /** Wi-Fi **/
 // Maximum number of connection retries before giving up
 constexpr uint8_t WIFI_MAX_RETRIES = 5;
+// Delay before the n-th retry : WIFI_BACKOFF_BASE_MS * 2^(n-1), capped, minus up to WIFI_BACKOFF_JITTER of it
+constexpr uint32_t WIFI_BACKOFF_BASE_MS = 500; // ms
+constexpr uint32_t WIFI_BACKOFF_MAX_MS = 30000; // ms
+constexpr float WIFI_BACKOFF_JITTER = 0.25f;
+// Scan, association or DHCP taking longer than this is a failed attempt
+constexpr uint32_t WIFI_PHASE_TIMEOUT_MS = 10000; // ms
+// Attempts with the cached BSSID and channel before falling back to a scan
+constexpr uint8_t WIFI_FAST_ATTEMPTS = 1;
+// A link lost before this is a failed attempt (retries keep backing off), after it reconnects right away
+constexpr uint32_t WIFI_STABLE_LINK_MS = 10000; // ms
+// Access points of the network kept from a scan (the strongest one is used)
+constexpr uint16_t WIFI_SCAN_MAX_RECORDS = 8;
 // Maximum length for SSID and Password
 constexpr uint8_t WIFI_MAX_SSID_LEN = 32;
 constexpr uint8_t WIFI_MAX_PASSWORD_LEN = 64;
@@ -63,9 +102,25 @@ constexpr const char* WIFI_AP_SSID = "TNY-360";
 constexpr const char* WIFI_AP_PASSWORD = ""; // open by default
 
 
+/** Web interface **/
+// Content hashes of the web assets, written by copy_web_assets.py ("<path> <hash>" lines, path from the web root)
+constexpr const char* WEB_ASSETS_MANIFEST = "/etags.txt";
+// Files right in this folder have content hashed names (Nuxt build assets) : cached by browsers without revalidation
+constexpr const char* WEB_IMMUTABLE_DIR = "/_nuxt/";
+constexpr uint32_t WEB_IMMUTABLE_MAX_AGE = 365 * 24 * 3600; // in seconds
+// Buffer reading the assets, allocated once
+constexpr size_t WEB_CHUNK_SIZE = 4096; // in bytes
+// RAM (PSRAM) cache of compressed assets : total size, biggest asset kept and number of assets
+constexpr size_t WEB_ASSET_CACHE_SIZE = 256 * 1024; // in bytes
+constexpr size_t WEB_ASSET_CACHE_MAX_FILE = 64 * 1024; // in bytes
+constexpr uint8_t WEB_ASSET_CACHE_ENTRIES = 16;
+
+
 /** Websocket **/
 // Maximum message size for WebSocket frames
 constexpr uint16_t WEBSOCKET_MAX_MSG_SIZE = 256; // in bytes
+// Number of preallocated message buffers (bigger messages, or messages beyond this count, use the heap)
+constexpr uint8_t WEBSOCKET_POOL_BLOCKS = 16;
 
 
 /** Protocol **/
@@ -141,13 +196,42 @@ constexpr uint8_t JOINT_COUNT = 16; // 12 legs joints + 2 ears, but PCA9685 has
 
 /** Screen **/
 constexpr int SCREEN_REFRESH_RATE = 30;
+// Screen resolution in pixels (SH1106 panel)
+constexpr uint16_t SCREEN_WIDTH = 128;
+constexpr uint16_t SCREEN_HEIGHT = 64;
+// Task sending the frames to the panel while the menus draw the next one (same priority as the menus task)
+constexpr int SCREEN_UPLOAD_TASK_PRIORITY = 1;
+constexpr uint32_t SCREEN_UPLOAD_TASK_STACK_SIZE = 4096; // in bytes
+// Maximum time waited for a frame to be sent (Flush)
+constexpr uint32_t SCREEN_FLUSH_TIMEOUT_MS = 100;
+
+/** Text **/
+// Strings kept rasterized by Draw::Text() (least recently used ones go first)
+constexpr uint8_t TEXT_CACHE_ENTRIES = 8;
+// Longest string kept rasterized, longer ones are rasterized each time they are drawn
+constexpr uint8_t TEXT_CACHE_MAX_LENGTH = 24;
+// Blank columns between the end of a scrolling text and its next start (Draw::TextScroll())
+constexpr uint8_t TEXT_SCROLL_GAP = 16;
 
 /** Buttons **/
 constexpr gpio_num_t BTN_LEFT_PIN = GPIO_NUM_11;
 constexpr gpio_num_t BTN_RIGHT_PIN = GPIO_NUM_10;
 constexpr uint16_t BTN_LONG_PRESS_MS = 300; // ms
-// Buttons polling interval in milliseconds
-constexpr uint16_t BTN_POLL_INT_MS = 50; // ms
+// A button state is kept once its pin stopped bouncing for that long (shorter glitches are ignored)
+constexpr uint16_t BTN_DEBOUNCE_MS = 8; // ms
+// A click starting less than that after the previous one also gives a double click
+constexpr uint16_t BTN_DOUBLE_CLICK_MS = 300; // ms
+// Interval of the repeat events while a button stays held after a long press (0 to disable them)
+constexpr uint16_t BTN_REPEAT_INT_MS = 150; // ms
+// Edges sent by the GPIO interrupt to the menus task, and debounced events waiting to be handled
+constexpr size_t BTN_EDGE_QUEUE_SIZE = 32;
+constexpr size_t BTN_EVENT_QUEUE_SIZE = 16;
+
+/** Status LED **/
+// Interval of the frames of the animated effects (fades, breathe, pulse, rainbow), in milliseconds
+constexpr uint16_t LED_FRAME_MS = 20; // ms
+// Effects are interpolated in perceived brightness, then turned into LED levels with this gamma
+constexpr float LED_GAMMA = 2.2f;
 
 /** Menu **/
 // List item shift by default
@@ -155,8 +239,82 @@ constexpr uint8_t MENU_LIST_ITEM_DEFAULT_SHIFT = 4;
 // List item shift when selected
 constexpr uint8_t MENU_LIST_ITEM_SELECTED_SHIFT = 8;
 
+/** Face **/
+// Memory budget of the pre-rasterized eye shapes (in PSRAM), least recently used shapes are dropped beyond it
+constexpr size_t FACE_SPRITE_CACHE_SIZE = 16 * 1024; // in bytes
+// Maximum number of cached eye shapes
+constexpr uint16_t FACE_SPRITE_CACHE_ENTRIES = 64;
+
+/** Camera **/
+// Port of the MJPEG stream server
+constexpr uint16_t CAMERA_STREAM_PORT = 90;
+// Frames captured per second while a client watches the stream (no capture without client)
+constexpr float CAMERA_FRAME_RATE = 15.0f;
+// Captured frames held for the clients (the camera driver gets one more frame buffer, for the sensor)
+constexpr uint8_t CAMERA_RING_SIZE = 3;
+// Clients streaming at the same time, others get a 503
+constexpr uint8_t CAMERA_MAX_CLIENTS = 4;
+// A client gets no frame for that long : the stream ends
+constexpr uint32_t CAMERA_CLIENT_TIMEOUT_MS = 3000;
+// Capture task (mostly waiting for the sensor, one above the menus task) and stream client tasks (same as the menus task)
+constexpr int CAMERA_TASK_PRIORITY = 2;
+constexpr int CAMERA_CLIENT_PRIORITY = 1;
+constexpr uint32_t CAMERA_TASK_STACK_SIZE = 4096; // in bytes
+constexpr uint32_t CAMERA_CLIENT_STACK_SIZE = 4096; // in bytes
+// Quality and frame size controller (see CameraRateController) : interval of its updates
+constexpr uint32_t CAMERA_CONTROL_INTERVAL_MS = 1000;
+// Part of the link throughput given to the frames at the target rate (the rest absorbs the link variations)
+constexpr float CAMERA_LINK_HEADROOM = 0.75f;
+// A level is only raised once the next one fits with this margin for CAMERA_UP_UPDATES updates in a row
+constexpr float CAMERA_UP_MARGIN = 1.3f;
+constexpr uint8_t CAMERA_UP_UPDATES = 3;
+// No level raise for that many updates after a lowering
+constexpr uint8_t CAMERA_DOWN_COOLDOWN_UPDATES = 5;
+// Capture to sent time beyond which the level is lowered
+constexpr uint32_t CAMERA_MAX_LATENCY_MS = 400;
+// Control loop load (worst tick time over its period) entering / leaving the deadline pressure mode
+constexpr float CAMERA_PRESSURE_LOAD = 0.8f;
+constexpr float CAMERA_PRESSURE_RELEASE_LOAD = 0.6f;
+// Frame rate and capture task priority (idle priority) under deadline pressure
+constexpr float CAMERA_PRESSURE_FRAME_RATE = 5.0f;
+constexpr int CAMERA_PRESSURE_TASK_PRIORITY = 0;
+// Frames sent over the protocol (camera module) : frame bytes per chunk event by default, and the sizes a client can ask
+constexpr uint16_t CAMERA_CHUNK_SIZE = 4096; // in bytes
+constexpr uint16_t CAMERA_CHUNK_MIN_SIZE = 512; // in bytes
+constexpr uint16_t CAMERA_CHUNK_MAX_SIZE = 16384; // in bytes
+// Longest wait for a chunk to be sent before the protocol client is dropped
+constexpr uint32_t CAMERA_CHUNK_TIMEOUT_MS = 5000;
+
+/** Vision **/
+// Frames analyzed per second (taken from the camera stream, as a stream client)
+constexpr float VISION_FRAME_RATE = 10.0f;
+// Largest thumbnail decoded (1/8 of the frame size, VGA frames give 80x60)
+constexpr uint16_t VISION_MAX_THUMBNAIL_WIDTH = 80;
+constexpr uint16_t VISION_MAX_THUMBNAIL_HEIGHT = 60;
+// Change of a pixel of the working grid (after compensating the global motion and brightness) counted as motion
+constexpr uint8_t VISION_MOTION_THRESHOLD = 24;
+// Part of the image that must change to raise a motion event (beyond the maximum, the whole scene changed)
+constexpr float VISION_MOTION_MIN = 0.02f;
+constexpr float VISION_MOTION_MAX = 0.4f;
+constexpr uint8_t VISION_MOTION_FRAMES = 2; // frames in a row
+// Downward image flow (working grid pixels per 1 / VISION_FRAME_RATE) kept for VISION_LIFT_FRAMES frames : robot lifted
+constexpr float VISION_LIFT_FLOW = 1.0f;
+constexpr uint8_t VISION_LIFT_FRAMES = 3;
+// Mean level below which the camera is covered, for VISION_COVERED_FRAMES frames in a row
+constexpr uint8_t VISION_DARK_LEVEL = 20;
+constexpr uint8_t VISION_COVERED_FRAMES = 5;
+// An event of a type isn't raised again before that time
+constexpr uint32_t VISION_EVENT_COOLDOWN_MS = 3000;
+// Events waiting for the decision loop, newer ones are dropped beyond
+constexpr uint8_t VISION_EVENT_QUEUE_SIZE = 4;
+// Vision task (same as the stream clients)
+constexpr int VISION_TASK_PRIORITY = 1;
+constexpr uint32_t VISION_TASK_STACK_SIZE = 4096; // in bytes
+
 
 /** Speaker **/
 constexpr gpio_num_t SPEAKER_GPIO_NUM = GPIO_NUM_1;
 constexpr int SPEAKER_SAMPLE_RATE_HZ = 22'500; // in Hz
 constexpr size_t SPEAKER_NB_AUDIO_PROVIDERS = 4; // number of stacked audio providers
+// Size of the chunks read from the filesystem by streamed sounds (two per sound)
+constexpr size_t SPEAKER_STREAM_CHUNK_SIZE = 2048; // in bytes
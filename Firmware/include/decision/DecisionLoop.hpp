@@ -1,8 +1,11 @@
 #pragma once
 #include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
 #include "common/utils.hpp"
 #include "common/geometry.hpp"
 #include "locomotion/IPC.hpp"
+#include "audio/Tunes.hpp"
+#include "vision/MotionAnalyzer.hpp"
 
 namespace AutoLifeFlags {
     // No auto life features enabled
@@ -138,12 +141,36 @@ public:
     */
     Status askJointAngle(Joint::Id joint_id, float angle_rad, IPC::OverrideMode mode = IPC::OverrideMode::Absolute);
 
+    /**
+     * @brief Express an emotion with the robot's voice (short synthesized chirp).
+     * @param voice The emotion to express.
+     * @return Error code indicating success or failure of the operation.
+     * @note Chirps are dropped (Status::NoMemory) while the sound mixer is full.
+     */
+    Status express(Tunes::Voice voice);
+
+    /**
+     * @brief Post an event of the vision task, handled at the next update.
+     * @param event The event (see MotionAnalyzer::Event).
+     * @param x Horizontal position of the motion (-1 to 1, left to right), 0 for the other events.
+     * @return Status::InvalidState before init(), Status::NoMemory while VISION_EVENT_QUEUE_SIZE events wait.
+     */
+    Status postVisionEvent(MotionAnalyzer::Event event, float x);
+
 private:
+    struct VisionEvent
+    {
+        MotionAnalyzer::Event event;
+        float x;
+    };
+
+
     TaskHandle_t decision_loop_task = nullptr;
     bool loop_running = false;
     IPC::ControlIntent intent;
     IPC::RobotState state;
     uint8_t auto_life_level = AutoLifeLevel::Full; // Default to full auto life features enabled
+    QueueHandle_t vision_events = nullptr;
 
     Vec3f askedBodyVel;
     Vec3f askedBodyRot;
@@ -166,6 +193,11 @@ private:
      */
     void update(float dt, const IPC::RobotState& state);
 
+    /**
+     * @brief React to the events posted by the vision task (called by update()).
+     */
+    void handleVisionEvents();
+
     /**
     * @brief Fill the intent object with the decision loop's control intentions.
     * @param intent The final intent object to be sent to the Reflex core. This object is modified in-place.
@@ -0,0 +1,66 @@
+#pragma once
+#include "common/utils.hpp"
+#include "drivers/AnalogDriver.hpp"
+#include "drivers/IMUDriver.hpp"
+#include "drivers/PowerDriver.hpp"
+#include "drivers/MotorDriver.hpp"
+
+/**
+ * @brief Capture of the raw sensor streams (ADC, IMU, power, motor commands) to a file, see SensorRecord.hpp for the format.
+ *
+ * Samples are pushed by the control loop without blocking (they are dropped if the queue is full),
+ * and written to the file by a task running on the brain core, which also samples the power sensor.
+ * Recordings can be replayed on the host to compare estimators on identical data (see host/README.md).
+ */
+namespace SensorRecorder
+{
+    constexpr const char* TAG = "SensorRecorder";
+
+    struct Stats
+    {
+        /// @brief A recording is running (or its last samples are being written)
+        bool recording;
+        /// @brief Number of records written to the file
+        uint32_t records;
+        /// @brief Number of samples dropped because the writer couldn't keep up
+        uint32_t dropped;
+        /// @brief Number of samples waiting to be written
+        uint32_t pending;
+        /// @brief Size of the file (in bytes)
+        uint32_t bytes;
+        /// @brief Duration of the recording (in ms)
+        uint32_t duration_ms;
+    };
+
+    /**
+     * @brief Start a new recording.
+     * @param path Full path of the file to create (overwritten if it exists).
+     * @param max_duration_ms The recording stops by itself after this duration, 0 for no limit.
+     * @return Status::InvalidState if a recording is already running.
+     * @note The file system has to be mounted.
+     */
+    Status Start(const char* path, uint32_t max_duration_ms = 0);
+
+    /**
+     * @brief Stop the current recording.
+     * @note The remaining samples are written in background, IsRecording() stays true until the file is closed.
+     */
+    Status Stop();
+
+    /**
+     * @brief Check if a recording is running.
+     */
+    bool IsRecording();
+
+    /**
+     * @brief Get the statistics of the current (or last) recording.
+     */
+    Stats GetStats();
+
+    /** SAMPLES (called by the control loop) **/
+
+    void RecordAnalog(int64_t timestamp_us, const AnalogDriver::Value* raw_voltages);
+    void RecordIMU(int64_t timestamp_us, const IMUDriver::IMUData& data);
+    void RecordPower(int64_t timestamp_us, const PowerDriver::Data& data); // sampled by the writer task, on the brain core
+    void RecordMotor(int64_t timestamp_us, const MotorDriver::Value* duty_cycles);
+}
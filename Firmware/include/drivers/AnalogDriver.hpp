@@ -7,6 +7,44 @@ namespace AnalogDriver
     using Value = float; // in Volt
     constexpr Channel CHANNEL_COUNT = 16;
 
+    /**
+     * @brief Hardware backend of the analog driver.
+     * @note The multiplexer + ESP32 ADC implementation lives in AnalogDriver.ESP.cpp, host builds provide their own.
+     */
+    class Backend
+    {
+    public:
+        virtual ~Backend() = default;
+
+        virtual Status init() = 0;
+        virtual Status deinit() = 0;
+
+        /**
+         * @brief Route the given channel to the ADC input.
+         * @note Should only return once the signal is stable enough to be read.
+         */
+        virtual Status select(Channel channel) = 0;
+
+        /**
+         * @brief Read the voltage of the currently selected channel.
+         * @param outVoltage Reference to store the read voltage value in Volt.
+         */
+        virtual Status read(Value& outVoltage) = 0;
+    };
+
+    /**
+     * @brief Get the backend used when none is set with SetBackend().
+     * @note Defined by the platform (ESP-IDF on the robot, fakes on host builds).
+     */
+    Backend& GetDefaultBackend();
+
+    /**
+     * @brief Replace the hardware backend of the driver.
+     * @param backend The backend to use, nullptr to restore the default one.
+     * @return Status::InvalidState if the driver is already initialized.
+     */
+    Status SetBackend(Backend* backend);
+
     namespace internal
     {
         /**
@@ -69,5 +107,12 @@ namespace AnalogDriver
     */
     Status GetVoltages(const Channel* ids, Value* outVoltages, uint8_t count);
 
+    /**
+    * @brief Gets the voltages of all channels from the last ReadAllChannels(), without filtering.
+    * @param outVoltages Pointer to array of CHANNEL_COUNT values to store the voltages.
+    * @return Error code indicating success or failure.
+    */
+    Status GetRawVoltages(Value* outVoltages);
+
     Status ReadAllChannels();
 }
\ No newline at end of file
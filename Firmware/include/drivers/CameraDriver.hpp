@@ -1,7 +1,15 @@
 #pragma once
 #include "common/utils.hpp"
+#include "drivers/CameraRateController.hpp"
+#include "drivers/CameraStream.hpp"
 #include "esp_camera.h"
 #include "esp_http_server.h"
+#include "network/protocol/Protocol.hpp"
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <atomic>
+#include <memory>
 
 class CameraDriver
 {
@@ -12,10 +20,82 @@ public:
     Status init();
     Status deinit();
 
+    /**
+     * @brief Start the capture task and the MJPEG stream server (CAMERA_STREAM_PORT).
+     * @note Each stream client gets its own task (up to CAMERA_MAX_CLIENTS), they all send the frames of the capture task.
+     *       A control task adapts the frame size, quality and rate to the clients links and the control loop load
+     *       every CAMERA_CONTROL_INTERVAL_MS (see CameraRateController).
+     */
     Status start();
+
+    /**
+     * @brief End the streams, then stop the capture task and the stream server.
+     */
     Status stop();
 
+    /**
+     * @brief Stream the frames to a protocol client as chunk events (see Protocol::CameraFrames), from its own task.
+     * @param chunk_size Frame bytes per event, 0 for CAMERA_CHUNK_SIZE (see Protocol::CameraFrames::ChunkSize()).
+     * @return Status::InvalidState if the client is already subscribed, Status::OutOfBounds when every stream client
+     *         is taken, Status::NoMemory or Status::Failure if its task couldn't start.
+     */
+    Status subscribe(Protocol::ITransport* transport, void* context, uint16_t chunk_size);
+
+    /**
+     * @brief End the stream of a protocol client (its task ends after the chunk being sent).
+     * @return Status::NotFound if the client isn't subscribed.
+     */
+    Status unsubscribe(Protocol::ITransport* transport, void* context);
+
+    /**
+     * @brief Stream stats of a protocol client.
+     * @return false if the client isn't subscribed.
+     */
+    bool getSubscriptionStats(Protocol::ITransport* transport, void* context, CameraStream::ClientStats& out) const;
+
+    CameraStream& getStream() { return *stream; }
+    const CameraRateController& getRateController() const { return rate_controller; }
+
 private:
     sensor_t* sensor;
     httpd_handle_t server;
+    TaskHandle_t capture_task = nullptr;
+    TaskHandle_t control_task = nullptr;
+    std::unique_ptr<CameraStream::Source> source;
+    std::unique_ptr<CameraStream> stream;
+    CameraRateController rate_controller;
+
+    /**
+     * A protocol client, from subscribe() until its task ended and its last chunk was sent
+     * - `refs`: its task, and the chunk queued in the transport (the last one frees `buffer` and the slot)
+     * - `used`: the slot is taken
+     * - `active`: cleared by unsubscribe()
+     */
+    struct ProtocolClient
+    {
+        CameraDriver* driver;
+        Protocol::ITransport* transport;
+        void* context;
+        int client;
+        uint16_t chunk_size;
+        uint8_t* buffer;
+        SemaphoreHandle_t sent;
+        bool sent_ok;
+        std::atomic<uint8_t> refs;
+        std::atomic<bool> used;
+        std::atomic<bool> active;
+    };
+    ProtocolClient protocol_clients[CAMERA_MAX_CLIENTS] = {};
+
+    static esp_err_t stream_handler(httpd_req_t *req);
+    static void client_task(void* param);
+    static void protocol_client_task(void* param);
+    static void chunk_sent(void* param, bool sent);
+    static void release(ProtocolClient& protocol_client);
+
+    /**
+     * @brief Feed the rate controller with the clients stats and apply its settings, until stop() notifies the task.
+     */
+    void run_rate_control();
+    void apply(const CameraRateController::Settings& settings, const CameraRateController::Settings& previous);
 };
\ No newline at end of file
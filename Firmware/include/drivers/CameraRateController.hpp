@@ -0,0 +1,145 @@
+#pragma once
+#include "common/config.hpp"
+#include "drivers/CameraStream.hpp"
+#include <cstdint>
+
+/**
+ * @brief Frame size and JPEG quality of the camera stream, picked from the link throughput of its clients to hold the
+ *        target frame rate, and frame rate and priority of the capture lowered when the control loop is late.
+ *
+ * Settings are a ladder of levels (QQVGA with a low quality up to VGA with a high one, see LEVELS). Every update, the
+ * link throughput of the slowest client (bytes sent over the time spent sending) gives the bytes a frame can take at
+ * the target rate, with CAMERA_LINK_HEADROOM. The frame size of each level is predicted from its nominal size, scaled
+ * by the sizes measured (the scene changes the JPEG size much more than the level does).
+ * - the level goes down at once when its frames don't fit, when the slowest client is late while busy sending all the
+ *   time, or when the latency goes over CAMERA_MAX_LATENCY_MS (to the highest level that fits)
+ * - it goes up one level at a time, once the next level fits with CAMERA_UP_MARGIN for CAMERA_UP_UPDATES updates,
+ *   and not for CAMERA_DOWN_COOLDOWN_UPDATES updates after going down
+ * - a control loop load (worst tick time over its period) over CAMERA_PRESSURE_LOAD enters the pressure mode :
+ *   CAMERA_PRESSURE_FRAME_RATE and an idle priority capture, until the load stays under CAMERA_PRESSURE_RELEASE_LOAD
+ *   for CAMERA_UP_UPDATES updates
+ *
+ * Clients stats are given with observe() before each update(), which returns the settings to apply.
+ * @note Portable (no ESP-IDF call), times are in microseconds from any monotonic clock. Not thread safe.
+ */
+class CameraRateController
+{
+public:
+    /**
+     * A level of the ladder
+     * - `width`, `height`: frame size in pixels
+     * - `quality`: JPEG quality of the camera driver (lower is better, 0 to 63)
+     * - `nominal_bytes`: typical JPEG size of an indoor scene
+     */
+    struct Level
+    {
+        uint16_t width;
+        uint16_t height;
+        uint8_t quality;
+        uint32_t nominal_bytes;
+    };
+
+    constexpr static Level LEVELS[] = {
+        { 160, 120, 30, 2500 },
+        { 160, 120, 15, 4000 },
+        { 320, 240, 30, 7000 },
+        { 320, 240, 20, 9500 },
+        { 320, 240, 12, 13500 },
+        { 480, 320, 20, 16500 },
+        { 640, 480, 25, 21000 },
+        { 640, 480, 20, 25000 },
+        { 640, 480, 12, 37000 },
+    };
+    constexpr static uint8_t LEVEL_COUNT = sizeof(LEVELS) / sizeof(LEVELS[0]);
+    /** Level of the previous fixed settings (VGA, quality 20) */
+    constexpr static uint8_t DEFAULT_LEVEL = 7;
+
+    /**
+     * Settings to apply
+     * - `level`: index in LEVELS
+     * - `frame_rate`: capture rate
+     * - `pressure`: the control loop is late, the capture task runs at CAMERA_PRESSURE_TASK_PRIORITY
+     */
+    struct Settings
+    {
+        uint8_t level;
+        float frame_rate;
+        bool pressure;
+    };
+
+    /**
+     * Measures of the last update
+     * - `link_bytes_per_s`: link throughput of the slowest client (0 when no frame was sent)
+     * - `fps`: frames sent per second by the slowest client
+     * - `frame_bytes`: mean size of the frames sent
+     * - `latency_us`: worst capture to sent time
+     * - `scale`: measured frame sizes over the nominal ones
+     */
+    struct Measures
+    {
+        float link_bytes_per_s;
+        float fps;
+        float frame_bytes;
+        uint32_t latency_us;
+        float scale;
+    };
+
+    /**
+     * Changes since the creation
+     * - `ups`, `downs`: level changes
+     * - `pressure_updates`: updates spent in the pressure mode
+     */
+    struct Stats
+    {
+        uint32_t ups;
+        uint32_t downs;
+        uint32_t pressure_updates;
+    };
+
+    /**
+     * @param frame_rate Target frame rate (out of the pressure mode).
+     */
+    CameraRateController(float frame_rate = CAMERA_FRAME_RATE, uint8_t level = DEFAULT_LEVEL);
+
+    /**
+     * @brief Give the stats of a streaming client (for the next update).
+     */
+    void observe(int client, const CameraStream::ClientStats& stats);
+
+    /**
+     * @brief Pick the settings from the clients observed since the last update.
+     * @param control_load Worst tick time of the control loop over its period, in the last second.
+     */
+    Settings update(int64_t now_us, float control_load);
+
+    Settings getSettings() const { return settings; }
+    Measures getMeasures() const { return measures; }
+    Stats getStats() const { return stats; }
+
+    /**
+     * @brief Predicted frame size of a level, from the measured sizes.
+     */
+    float predictBytes(uint8_t level) const;
+
+private:
+    struct Observed
+    {
+        bool seen;         // observed since the last update
+        bool has_baseline; // stats of the previous update are known
+        CameraStream::ClientStats last;
+        CameraStream::ClientStats current;
+    };
+
+    float target_fps;
+    Settings settings;
+    Measures measures = {};
+    Stats stats = {};
+    Observed clients[CAMERA_MAX_CLIENTS] = {};
+    int64_t last_update_us = -1;
+    uint8_t up_count = 0;
+    uint8_t cooldown = 0;
+    uint8_t release_count = 0;
+    bool level_changed = false; // frames of the last update mix two levels, their size isn't measured
+
+    int fitting_level(float budget) const;
+};
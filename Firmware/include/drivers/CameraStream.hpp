@@ -0,0 +1,225 @@
+#pragma once
+#include "common/utils.hpp"
+#include "common/config.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+/**
+ * @brief Frames of the camera shared by every stream client : a capture task fills a small ring of reference counted
+ *        frames at a paced rate, each client sends the newest frame it hasn't sent yet.
+ *
+ * Frames stay in the buffers of the Source (no copy) until no client holds them anymore. A client slower than the
+ * capture skips the frames captured while it was sending (counted as dropped), it never makes the capture wait.
+ * The capture only waits when every frame of the ring is held (a client stuck in a send for instance) : the frame
+ * is skipped, the other clients keep the newest one. Without any client nothing is captured.
+ * @note Portable (the Source hides the camera driver). The capture task runs runCapture(), each client task serve().
+ */
+class CameraStream
+{
+public:
+    constexpr static int64_t NO_DEADLINE = INT64_MAX;
+    constexpr static const char* BOUNDARY = "____boundary____";
+    /** Content type of the stream (multipart, one JPEG part per frame) */
+    constexpr static const char* CONTENT_TYPE = "multipart/x-mixed-replace;boundary=____boundary____";
+
+    /**
+     * A captured frame
+     * - `data`: JPEG data
+     * - `size`: size of the data in bytes
+     * - `width`, `height`: size of the image in pixels
+     * - `timestamp_us`: capture time (esp_timer_get_time() clock)
+     * - `sequence`: capture number, from 1
+     * - `handle`: frame of the source (camera_fb_t on the robot)
+     */
+    struct Frame
+    {
+        const uint8_t* data;
+        size_t size;
+        uint16_t width;
+        uint16_t height;
+        int64_t timestamp_us;
+        uint32_t sequence;
+        void* handle;
+    };
+
+    /**
+     * @brief Frames producer (the camera driver on the robot, synthetic frames on host builds).
+     */
+    class Source
+    {
+    public:
+        virtual ~Source() = default;
+
+        /**
+         * @brief Capture a frame (fill everything but `sequence`), blocking until it is ready.
+         */
+        virtual Status capture(Frame& out) = 0;
+
+        /**
+         * @brief Give back a frame no client holds anymore.
+         */
+        virtual void release(Frame& frame) = 0;
+    };
+
+    /**
+     * Stream of one client
+     * - `frames`: frames sent
+     * - `dropped`: frames captured while the client was sending an older one
+     * - `bytes`: JPEG bytes sent
+     * - `fps`: frames sent per second (smoothed)
+     * - `send_us`: time taken to send the last frame
+     * - `busy_us`: time spent sending frames (bytes / busy_us is the link throughput)
+     * - `latency_us`: capture to the end of the send of the last frame
+     * - `since_us`: time the client subscribed
+     */
+    struct ClientStats
+    {
+        uint32_t frames;
+        uint32_t dropped;
+        uint64_t bytes;
+        float fps;
+        uint32_t send_us;
+        uint64_t busy_us;
+        uint32_t latency_us;
+        int64_t since_us;
+    };
+
+    /**
+     * Capture
+     * - `captured`: frames captured
+     * - `failures`: failed captures
+     * - `ring_full`: captures skipped because every frame of the ring was held
+     * - `clients`: clients streaming now
+     */
+    struct Stats
+    {
+        uint32_t captured;
+        uint32_t failures;
+        uint32_t ring_full;
+        uint8_t clients;
+    };
+
+    /** Receives the bytes of the stream, false when the client is gone */
+    using Sink = std::function<bool(const uint8_t* data, size_t size)>;
+    /** Sends a whole frame (held until it returns), false when the client is gone */
+    using FrameSink = std::function<bool(const Frame& frame)>;
+
+    /**
+     * @param ring_size Frames held at most (up to CAMERA_RING_SIZE).
+     */
+    CameraStream(Source& source, uint8_t ring_size = CAMERA_RING_SIZE, float frame_rate = CAMERA_FRAME_RATE);
+    ~CameraStream();
+
+    /**
+     * @brief Change the capture rate (taken at the next capture).
+     */
+    void setFrameRate(float frame_rate);
+    float getFrameRate() const;
+
+    /**
+     * @brief Capture loop of the capture task : paced captures while there are clients, returns after stop().
+     */
+    void runCapture();
+
+    /**
+     * @brief Capture a frame if one is due at `now_us` and a frame of the ring is free (runCapture() step).
+     * @return Status::Failure if the capture failed, Status::Ok otherwise (even when nothing was due).
+     */
+    Status capture(int64_t now_us);
+
+    /**
+     * @brief Time the next capture is due (NO_DEADLINE without client).
+     */
+    int64_t deadline() const;
+
+    /**
+     * @brief Wake the capture task and every client (runCapture() and serve() return, acquire() returns nullptr).
+     */
+    void stop();
+
+    /**
+     * @brief Allow capturing and serving again after stop().
+     */
+    void restart();
+
+    /**
+     * @brief Add a client.
+     * @return Its number, -1 if there already are CAMERA_MAX_CLIENTS.
+     */
+    int subscribe();
+
+    /**
+     * @brief Remove a client (after it released its frame).
+     */
+    void unsubscribe(int client);
+
+    /**
+     * @brief Take the newest frame the client hasn't had yet, waiting for it if needed.
+     * @return The frame, to give back with release(), nullptr after a timeout or stop().
+     */
+    const Frame* acquire(int client, uint32_t timeout_ms);
+
+    /**
+     * @brief Give back a frame taken with acquire().
+     * @param send_start_us Time its send started (for the client stats).
+     */
+    void release(int client, const Frame* frame, int64_t send_start_us);
+
+    /**
+     * @brief Send frames to a client as a multipart stream (without the HTTP headers) until it is gone.
+     * @return Status::Ok after stop(), Status::InvalidState when the sink failed (client gone), Status::Failure when no
+     *         frame came for CAMERA_CLIENT_TIMEOUT_MS.
+     */
+    Status serve(int client, const Sink& sink);
+
+    /**
+     * @brief Give frames to a client until it is gone, in any framing (the time `sink` takes is its send time).
+     * @return Same as serve().
+     */
+    Status serveFrames(int client, const FrameSink& sink);
+
+    /**
+     * @brief Stats of a client.
+     * @return false if the client number isn't streaming.
+     */
+    bool getClientStats(int client, ClientStats& out) const;
+
+    Stats getStats() const;
+
+private:
+    struct Slot
+    {
+        Frame frame;
+        uint8_t refs;  // ring reference (newest frame) and client references
+        bool used;     // holds a frame, or a capture is filling it
+    };
+
+    struct Client
+    {
+        bool active;
+        uint32_t last_sequence;
+        int64_t last_send_us;
+        ClientStats stats;
+    };
+
+    Source& source;
+    const uint8_t ring_size;
+    mutable std::mutex mutex;
+    std::condition_variable frame_ready; // clients wait for a new frame
+    std::condition_variable wake;        // capture task waits for clients or its deadline
+
+    Slot slots[CAMERA_RING_SIZE] = {};
+    int newest = -1;
+    uint32_t sequence = 0;
+    Client clients[CAMERA_MAX_CLIENTS] = {};
+    uint8_t client_count = 0;
+    int64_t period_us;
+    int64_t next_capture_us = 0;
+    bool stopped = false;
+    Stats stats = {};
+
+    void unref(int slot); // with the mutex held
+};
@@ -15,6 +15,38 @@ namespace IMUDriver
         float gyro_z_ds;
     };
 
+    /**
+     * @brief Hardware backend of the IMU driver.
+     * @note The MPU6050 implementation lives in IMUDriver.ESP.cpp, host builds provide their own.
+     */
+    class Backend
+    {
+    public:
+        virtual ~Backend() = default;
+
+        virtual Status init() = 0;
+        virtual Status deinit() = 0;
+
+        /**
+         * @brief Read a new sample from the sensor.
+         * @param out_data Reference to store the accelerations (in g) and angular rates (in deg/s).
+         */
+        virtual Status read(IMUData& out_data) = 0;
+    };
+
+    /**
+     * @brief Get the backend used when none is set with SetBackend().
+     * @note Defined by the platform (ESP-IDF on the robot, fakes on host builds).
+     */
+    Backend& GetDefaultBackend();
+
+    /**
+     * @brief Replace the hardware backend of the driver.
+     * @param backend The backend to use, nullptr to restore the default one.
+     * @return Status::InvalidState if the driver is already initialized.
+     */
+    Status SetBackend(Backend* backend);
+
     /**
     * @brief Initializes the IMU driver.
     * @return Error code indicating success or failure.
@@ -28,6 +28,38 @@ namespace MotorDriver
         return (pwm / 4096.f) * (1000.f / MOTOR_DRIVER_PWM_FREQUENCY_HZ);
     }
 
+    /**
+     * @brief Hardware backend of the motor driver.
+     * @note The PCA9685 implementation lives in MotorDriver.ESP.cpp, host builds provide their own.
+     */
+    class Backend
+    {
+    public:
+        virtual ~Backend() = default;
+
+        virtual Status init() = 0;
+        virtual Status deinit() = 0;
+
+        /**
+         * @brief Send the PWM values of all channels to the hardware.
+         * @param pwm_values Array of CHANNEL_COUNT PWM values (0-4096).
+         */
+        virtual Status sendPWMs(const uint16_t* pwm_values) = 0;
+    };
+
+    /**
+     * @brief Get the backend used when none is set with SetBackend().
+     * @note Defined by the platform (ESP-IDF on the robot, fakes on host builds).
+     */
+    Backend& GetDefaultBackend();
+
+    /**
+     * @brief Replace the hardware backend of the driver.
+     * @param backend The backend to use, nullptr to restore the default one.
+     * @return Status::InvalidState if the driver is already initialized.
+     */
+    Status SetBackend(Backend* backend);
+
     /**
     * @brief Initializes the Motor driver.
     * @return Error code indicating success or failure.
@@ -14,6 +14,36 @@ namespace PowerDriver
         Value power_w;   // in watts
     };
 
+    /**
+     * @brief Hardware backend of the power driver.
+     * @note The INA219 implementation lives in PowerDriver.ESP.cpp, host builds provide their own.
+     */
+    class Backend
+    {
+    public:
+        virtual ~Backend() = default;
+
+        virtual Status init() = 0;
+        virtual Status deinit() = 0;
+
+        virtual Status readVoltage(Value& voltage_v) = 0;
+        virtual Status readCurrent(Value& current_a) = 0;
+        virtual Status readPower(Value& power_w) = 0;
+    };
+
+    /**
+     * @brief Get the backend used when none is set with SetBackend().
+     * @note Defined by the platform (ESP-IDF on the robot, fakes on host builds).
+     */
+    Backend& GetDefaultBackend();
+
+    /**
+     * @brief Replace the hardware backend of the driver.
+     * @param backend The backend to use, nullptr to restore the default one.
+     * @return Status::InvalidState if the driver is already initialized.
+     */
+    Status SetBackend(Backend* backend);
+
     namespace internal
     {
         Status read_voltage(Value& voltage_v);
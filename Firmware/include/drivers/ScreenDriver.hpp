@@ -1,9 +1,10 @@
 #pragma once
+#include "common/config.hpp"
 #include "common/utils.hpp"
 #include <memory.h>
 #include <utility>
 
-extern char (*screen_font)[8];
+extern const char (*screen_font)[8];
 
 namespace ScreenDriver
 {
@@ -19,6 +20,17 @@ namespace ScreenDriver
     constexpr Color COLOR_BLACK = false;
     constexpr Color COLOR_WHITE = true;
 
+    /** Number of rows packed in each byte of the screen buffer */
+    constexpr uint16_t PAGE_HEIGHT = 8;
+    /** Number of pages of the screen buffer */
+    constexpr uint16_t PAGE_COUNT = SCREEN_HEIGHT / PAGE_HEIGHT;
+    /**
+     * Bus bytes of a span besides its pixels : device address and control byte of the addressing transaction,
+     * page / column low / column high commands, then device address and control byte of the data transaction.
+     * Unchanged columns between two changed ones are sent along when there are fewer of them than this.
+     */
+    constexpr uint16_t SPAN_OVERHEAD_BYTES = 7;
+
     /**
      * Screen information structure
      * - `data`: the screen buffer data
@@ -27,8 +39,11 @@ namespace ScreenDriver
      */
     typedef struct
     {
-        /** the screen buffer data, in row-major order, with origin on the top-left corner */
-        Color* data;
+        /**
+         * the screen buffer data, in the panel format : one byte per column for each page of PAGE_HEIGHT rows,
+         * pages from top to bottom, bit 0 on top (pixel (x, y) is bit y % 8 of data[(y / 8) * width + x])
+         */
+        uint8_t* data;
         /** the screen width in pixels */
         uint16_t width;
         /** the screen height in pixels */
@@ -37,11 +52,169 @@ namespace ScreenDriver
 
     extern Info info;
 
+    /**
+     * Columns of a page drawn since the last upload
+     * - `first`: first drawn column
+     * - `last`: last drawn column (`first` > `last` when nothing was drawn in the page)
+     */
+    typedef struct
+    {
+        uint16_t first;
+        uint16_t last;
+    } DirtySpan;
+
+    /** spans of the frame being drawn (moves to the next frame at each upload, like info.data) */
+    extern DirtySpan* dirty;
+
+    /**
+     * @brief Record that an area of the screen buffer was drawn, so Upload() looks at it (no bounds check).
+     * @note Called by the Draw primitives, code writing info.data directly has to call it too.
+     */
+    inline void MarkDirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+    {
+        if (w == 0 || h == 0) return;
+
+        uint16_t last_x = x + w - 1;
+        uint16_t last_page = (y + h - 1) / PAGE_HEIGHT;
+        for (uint16_t page = y / PAGE_HEIGHT; page <= last_page; page++)
+        {
+            if (x < dirty[page].first) dirty[page].first = x;
+            if (last_x > dirty[page].last) dirty[page].last = last_x;
+        }
+    }
+
+    /**
+     * Upload statistics
+     * - `presented`: number of frames handed to Upload()
+     * - `dropped`: presented frames replaced by the next one before being sent (the upload task was still busy)
+     * - `frames`: number of frames sent to the panel
+     * - `full_frames`: frames sent as the whole buffer (first one, or after Invalidate() or a bus error)
+     * - `spans`: number of column spans sent for the other frames
+     * - `bytes`: bytes sent over the bus (pixels and addressing)
+     * - `last_frame_bytes`: bytes sent for the last frame
+     * - `max_frame_bytes`: most bytes sent for one frame
+     */
+    typedef struct
+    {
+        uint32_t presented;
+        uint32_t dropped;
+        uint32_t frames;
+        uint32_t full_frames;
+        uint32_t spans;
+        uint64_t bytes;
+        uint32_t last_frame_bytes;
+        uint32_t max_frame_bytes;
+    } UploadStats;
+
+    /**
+     * @brief Read a pixel of the screen buffer (no bounds check).
+     */
+    inline Color GetPixel(uint16_t x, uint16_t y)
+    {
+        return (info.data[(y / PAGE_HEIGHT) * info.width + x] >> (y % PAGE_HEIGHT)) & 1;
+    }
+
+    /**
+     * @brief Hardware backend of the screen driver.
+     * @note The SH1106 implementation lives in ScreenDriver.ESP.cpp, host builds provide their own.
+     */
+    class Backend
+    {
+    public:
+        virtual ~Backend() = default;
+
+        virtual Status init() = 0;
+        virtual Status deinit() = 0;
+
+        /**
+         * @brief Turn the panel on or off.
+         */
+        virtual Status setPower(bool on) = 0;
+
+        /**
+         * @brief Send a full frame to the panel.
+         * @param buffer Page-packed frame (one byte per column per 8-rows page, LSB on top).
+         * @param width Frame width in pixels.
+         * @param height Frame height in pixels, multiple of 8.
+         */
+        virtual Status upload(const uint8_t* buffer, uint16_t width, uint16_t height) = 0;
+
+        /**
+         * @brief Send consecutive columns of one page to the panel.
+         * @param page Page index (rows page * 8 to page * 8 + 7).
+         * @param x First column.
+         * @param data One byte per column, LSB on top.
+         * @param length Number of columns.
+         */
+        virtual Status uploadSpan(uint16_t page, uint16_t x, const uint8_t* data, uint16_t length) = 0;
+    };
+
+    /**
+     * @brief Get the backend used when none is set with SetBackend().
+     * @note Defined by the platform (ESP-IDF on the robot, fakes on host builds).
+     */
+    Backend& GetDefaultBackend();
+
+    /**
+     * @brief Replace the hardware backend of the driver.
+     * @param backend The backend to use, nullptr to restore the default one.
+     * @return Status::InvalidState if the driver is already initialized.
+     */
+    Status SetBackend(Backend* backend);
+
     Status Init();
 
     Status Deinit();
 
     Status Clear();
 
+    /**
+     * @brief Start the task sending the frames to the panel, Upload() doesn't wait for the bus anymore afterwards.
+     * @note The task has a low priority (SCREEN_UPLOAD_TASK_PRIORITY) : it only sends the last frame handed to Upload(),
+     *       frames presented faster than the bus can take them are dropped (see UploadStats).
+     */
+    Status StartUploadTask();
+
+    /**
+     * @brief Send the pending frame and stop the upload task, Upload() sends the frames itself again.
+     */
+    Status StopUploadTask();
+
+    /**
+     * @brief Send the changes of the screen buffer to the panel (the buffer already is in the panel format, nothing is converted).
+     * @note Only the drawn spans (see MarkDirty()) are compared with what the panel shows, and only the columns that
+     *       differ are sent : a menu redrawing the same frame sends nothing. The first upload sends the whole buffer.
+     * @note With the upload task running, the frame is handed to the task and drawing goes on at once, in a copy of the
+     *       frame (info.data changes at each upload, don't keep it).
+     */
     Status Upload();
+
+    /**
+     * @brief Wait until the last uploaded frame is on the panel.
+     * @param timeout_ms Maximum waiting time, in milliseconds.
+     * @return Status::Failure if it isn't after `timeout_ms` (or if its upload failed).
+     */
+    Status Flush(uint32_t timeout_ms = SCREEN_FLUSH_TIMEOUT_MS);
+
+    /**
+     * @brief Send the whole buffer at the next upload (when the panel content is unknown, after a reset for instance).
+     */
+    void Invalidate();
+
+    /**
+     * @brief Number of the last frame handed to Upload() (counting from 1).
+     */
+    uint32_t GetPresentedFrame();
+
+    /**
+     * @brief Number of the last frame sent to the panel (dropped frames are skipped).
+     */
+    uint32_t GetShownFrame();
+
+    /**
+     * @note Updated by the upload task, fields may be read a frame apart from each other.
+     */
+    UploadStats GetUploadStats();
+
+    void ResetUploadStats();
 }
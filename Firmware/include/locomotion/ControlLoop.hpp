@@ -3,13 +3,19 @@
 #include "driver/gptimer.h"
 #include "locomotion/GaitPlanner.hpp"
 #include "locomotion/KinematicsEngine.hpp"
+#include <atomic>
+
+class Body;
 
 class ControlLoop
 {
 public:
     constexpr static const char* TAG = "ControlLoop";
 
-    ControlLoop();
+    /**
+     * @param body The body driven by this control loop.
+     */
+    ControlLoop(Body& body);
 
     /**
      * @brief Initializes the Control Loop.
@@ -39,6 +45,12 @@ public:
      */
     bool isRunning() const;
 
+    /**
+     * @brief Load of the control loop : worst tick time over its period, in the last second.
+     * @note Over 1 the loop misses its deadlines. Readable from any task.
+     */
+    float getLoad() const { return load.load(std::memory_order_relaxed); }
+
     /**
      * @brief Get the control loop's GaitPlanner object.
      */
@@ -58,9 +70,16 @@ public:
 private:
     Status create_internal_task();
 
+    /**
+     * @brief Push the raw sensor values of this tick to the SensorRecorder (power excepted, read on the brain core).
+     */
+    void record_sensors();
+
     bool initialized;
     gptimer_handle_t timer = NULL;
+    std::atomic<float> load = 0.0f;
 
+    Body& body;
     GaitPlanner gait_planner;
     KinematicsEngine kinematics_engine;
 };
\ No newline at end of file
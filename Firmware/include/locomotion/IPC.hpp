@@ -52,6 +52,8 @@ namespace IPC
 
     struct RobotState {
         uint32_t timestamp_ms = 0;
+        uint32_t tick = 0;         // control loop tick, from 1
+        int64_t timestamp_us = 0;  // start of the tick (esp_timer_get_time(), the clock of the camera frames)
 
         struct JointState {
             float target_angle_rad = 0.0f;
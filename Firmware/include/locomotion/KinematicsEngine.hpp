@@ -45,6 +45,25 @@ public:
      */
     Status computeLegIK(const Vec3f& target, LegJointState& joints);
 
+    /**
+     * @brief Computes the FK for a leg (inverse of computeLegIK)
+     * @param joints [IN] The joint angles of the leg
+     * @param feet [OUT] The feet position (in hip frame)
+     * @returns Status::Ok if success, other Error type overwise
+     */
+    Status computeLegFK(const LegJointState& joints, Vec3f& feet);
+
+    /**
+     * @brief Get the position of a hip in body frame
+     * @param leg_index The leg index (FL, BL, BR, FR order)
+     */
+    Vec3f getHipPosition(int leg_index) const;
+
+    /**
+     * @brief Get the engine configuration
+     */
+    const KinematicsConfig& getConfig() const { return config; }
+
 private:
     KinematicsConfig config;
 };
\ No newline at end of file
@@ -102,6 +102,12 @@ public:
      */
     inline bool isInverted() { return y_inverted; }
 
+    /**
+     * @brief Get the analog channel of the foot contact switch
+     * @return AnalogDriver channel
+     */
+    inline AnalogDriver::Channel getContactChannel() const { return contact_channel; }
+
     /**
      * @brief Get if the leg touches ground or not
      * @return Boolean true if grounded
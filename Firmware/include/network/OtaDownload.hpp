@@ -0,0 +1,146 @@
+#pragma once
+#include "common/config.hpp"
+#include "common/utils.hpp"
+#include "network/OtaManifest.hpp"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+/**
+ * @brief Streamed download of an update image to a partition, resumed after connection losses and checked against
+ *        the size and SHA-256 of the manifest.
+ *
+ * A reader task fills a ring buffer from the network while the calling task hashes and writes the previous chunks to
+ * flash, so the erase / write time of the flash overlaps the transfer. A lost connection (read error, or the body
+ * ending early) is resumed where the ring stops with an HTTP Range request, after n * OTA_RESUME_DELAY_MS for the
+ * n-th loss in a row; the download fails after OTA_MAX_RESUMES losses in a row without new data. A server ignoring the
+ * range answers from the start : the bytes already received are read again and dropped.
+ *
+ * The target only gets finish() once the whole image was written and its hash matched, abort() otherwise.
+ *
+ * An image without size nor hash (legacy manifest) is read in one connection until the end of the body, like before
+ * resumable downloads : any loss fails the download, and nothing but the target (esp_ota_end) checks the image.
+ * @note Portable (no ESP-IDF call but the reader task), the HTTP client and the partitions are behind Source and Target.
+ */
+class OtaDownload
+{
+public:
+    constexpr static const char* TAG = "OtaDownload";
+
+    /**
+     * @brief Image on the network (HTTP client on the robot, sockets on host builds).
+     */
+    class Source
+    {
+    public:
+        virtual ~Source() = default;
+
+        /**
+         * @brief Request the image from `offset` to its end (Range request when `offset` isn't 0).
+         * @param start Receives the offset the body starts at (0 when the server ignored the range).
+         * @param total Receives the size of the whole image (0 if the server didn't tell).
+         * @return Status::Failure for network errors (retried), any other error ends the download.
+         */
+        virtual Status open(uint32_t offset, uint32_t& start, uint32_t& total) = 0;
+
+        /**
+         * @brief Read the next bytes of the body, blocking.
+         * @return Bytes read, 0 at the end of the body, negative when the connection is lost.
+         */
+        virtual int read(uint8_t* buffer, size_t size) = 0;
+
+        virtual void close() = 0;
+    };
+
+    /**
+     * @brief Partition the image goes to (OTA or data partition on the robot, a file on host builds).
+     */
+    class Target
+    {
+    public:
+        virtual ~Target() = default;
+
+        virtual Status begin(uint32_t size) = 0;
+
+        /**
+         * @brief Write the next bytes of the image (in order, erasing as needed).
+         */
+        virtual Status write(const uint8_t* data, size_t size) = 0;
+
+        /**
+         * @brief The whole image was written and its hash matched.
+         */
+        virtual Status finish() = 0;
+
+        virtual void abort() = 0;
+    };
+
+    /**
+     * Progress of a download
+     * - `size`: size of the image
+     * - `received`: bytes of the image received (in the ring or written)
+     * - `written`: bytes hashed and written to the target
+     * - `fetched`: bytes read from the network, with the ones dropped after a server ignored a range
+     * - `bytes_per_s`: received bytes over the time since the start (resumes included)
+     * - `resumes`: connections resumed after a loss
+     */
+    struct Progress
+    {
+        uint32_t size;
+        uint32_t received;
+        uint32_t written;
+        uint32_t fetched;
+        float bytes_per_s;
+        uint16_t resumes;
+    };
+
+    using ProgressCallback = std::function<void(const Progress& progress)>;
+
+    /**
+     * @param ring_size Ring buffer between the reads and the writes (allocated in PSRAM).
+     * @param chunk_size Most bytes per read and per write (at most half the ring).
+     * @param resume_delay_ms Wait before the n-th resume in a row, times n.
+     */
+    explicit OtaDownload(size_t ring_size = OTA_RING_SIZE, size_t chunk_size = OTA_CHUNK_SIZE, uint32_t resume_delay_ms = OTA_RESUME_DELAY_MS);
+    ~OtaDownload();
+
+    /**
+     * @brief Download an image to a target, blocking until it is written and checked.
+     * @param on_progress Called by this task every OTA_PROGRESS_INTERVAL_MS and at the end.
+     * @return Status::InvalidParameters when the size or the hash doesn't match the manifest, Status::Failure after
+     *         OTA_MAX_RESUMES losses in a row (the first one for an image of size 0), Status::NoMemory without ring, or
+     *         the error of the source / target.
+     */
+    Status run(Source& source, Target& target, const OtaManifest::Image& image, const ProgressCallback& on_progress = nullptr);
+
+    /**
+     * @brief Progress of the current (or last) download, from any task.
+     */
+    Progress getProgress() const;
+
+private:
+    size_t ring_size;
+    size_t chunk_size;
+    uint32_t resume_delay_ms;
+    uint8_t* ring = nullptr;
+
+    mutable std::mutex mutex;
+    std::condition_variable changed; // ring data or room, end of the reader, cancel
+    Source* source = nullptr;
+    uint32_t size = 0;
+    bool sized = false; // size and hash given by the manifest (resumed and checked)
+    uint32_t head = 0;  // bytes received, ring index head % ring_size
+    uint32_t tail = 0;  // bytes written
+    bool cancelled = false;
+    bool reader_done = false;
+    Status reader_status = Status::Ok;
+    Progress progress = {};
+    int64_t start_us = 0;
+
+    /**
+     * @brief Reader task : network to ring, with the resumes, until the image is received, it fails or run() cancels.
+     */
+    void read_loop();
+    Status read_image();
+    void update_rate(); // with the mutex held
+};
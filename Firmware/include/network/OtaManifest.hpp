@@ -0,0 +1,61 @@
+#pragma once
+#include "common/Sha256.hpp"
+#include "common/utils.hpp"
+#include <functional>
+#include <string>
+
+/**
+ * Update manifest : the version and the images of an update, with the size and SHA-256 of each image, signed by the
+ * update server.
+ *
+ * The signature covers SignedText() : the robot model, the version and the size and hash of each image, one per line.
+ * The URLs aren't covered (the CDN may change), an image from anywhere else still has to match its hash.
+ */
+namespace OtaManifest
+{
+    /**
+     * An image of the update
+     * - `url`: where to download it (HTTP Range requests supported to resume)
+     * - `size`: size in bytes, 0 in a legacy manifest (written by servers before the hashes, nor resumed nor checked)
+     * - `sha256`: hash of the whole image (zeros in a legacy manifest)
+     */
+    struct Image
+    {
+        std::string url;
+        uint32_t size;
+        uint8_t sha256[Sha256::SIZE];
+    };
+
+    struct Manifest
+    {
+        std::string version;
+        Image firmware;
+        Image filesystem;
+    };
+
+    /** Checks a signature of a SHA-256 digest (ECDSA with the key of the update server on the robot) */
+    using Verifier = std::function<bool(const uint8_t digest[Sha256::SIZE], const uint8_t* signature, size_t size)>;
+
+    /**
+     * @brief Text covered by the signature of a manifest.
+     */
+    std::string SignedText(const Manifest& manifest, const char* model);
+
+    /**
+     * @brief Check the signature of a manifest.
+     * @return Status::InvalidParameters if the signature doesn't match.
+     */
+    Status Verify(const Manifest& manifest, const char* model, const uint8_t* signature, size_t size, const Verifier& verifier);
+
+    /**
+     * @brief Parse a hash written in hexadecimal (64 digits, any case).
+     * @return false if it isn't one.
+     */
+    bool ParseHash(const char* hex, uint8_t out[Sha256::SIZE]);
+
+    /**
+     * @brief Decode base64 (standard alphabet, padding optional).
+     * @return Size of the decoded data, 0 if it isn't base64 or doesn't fit in `capacity`.
+     */
+    size_t DecodeBase64(const char* text, uint8_t* out, size_t capacity);
+}
@@ -0,0 +1,152 @@
+#pragma once
+#include "common/utils.hpp"
+#include "common/config.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Static files of the web interface : request path to file (gzipped variant, folder index, single page app
+ *        fallback), cache validation headers, and the content read through a reusable buffer or a RAM cache.
+ *
+ * ETags come from the content hashes of the WEB_ASSETS_MANIFEST written at build time, so a request with a matching
+ * If-None-Match gets a 304 without reading the file. Files right in WEB_IMMUTABLE_DIR have content hashed names and
+ * are marked immutable (browsers keep them for WEB_IMMUTABLE_MAX_AGE without asking again), the others have to be
+ * revalidated on each use. Gzipped assets up to WEB_ASSET_CACHE_MAX_FILE are kept in a RAM cache once read
+ * (least recently used ones go first).
+ * @note Portable (stdio and stat), not thread safe : the HTTP server handles one request at a time.
+ */
+class StaticAssets
+{
+public:
+    constexpr static size_t ETAG_SIZE = 40; // quoted hash
+    constexpr static size_t PATH_SIZE = 128;
+
+    /**
+     * A resolved request
+     * - `path`: file to send, from the filesystem root
+     * - `mime`: content type of the requested file (not of its gzipped variant)
+     * - `gzip`: the file is the gzipped variant
+     * - `immutable`: the file has a content hashed name
+     * - `etag`: quoted content hash, empty if the manifest doesn't know the file
+     * - `size`: size of the file in bytes
+     */
+    struct Asset
+    {
+        char path[PATH_SIZE];
+        const char* mime;
+        bool gzip;
+        bool immutable;
+        char etag[ETAG_SIZE];
+        size_t size;
+    };
+
+    /**
+     * Requests and transfers
+     * - `requests`: resolved requests
+     * - `not_modified`: requests answered with a 304
+     * - `cache_hits`: assets sent from the RAM cache
+     * - `cache_misses`: assets read from the filesystem
+     * - `bytes_read`: bytes read from the filesystem
+     * - `cached_bytes`: size of the assets in the RAM cache
+     */
+    struct Stats
+    {
+        uint32_t requests;
+        uint32_t not_modified;
+        uint32_t cache_hits;
+        uint32_t cache_misses;
+        uint64_t bytes_read;
+        uint32_t cached_bytes;
+    };
+
+    /** Receives the content of an asset, false to stop */
+    using Sink = std::function<bool(const uint8_t* data, size_t size)>;
+
+    StaticAssets() = default;
+    ~StaticAssets();
+
+    /**
+     * @brief Load the manifest of a web root and allocate the read buffer.
+     * @param root Folder of the web files.
+     * @return Status::NoMemory if the buffer can't be allocated. A missing manifest isn't an error (no ETag).
+     */
+    Status init(const char* root);
+
+    /**
+     * @brief Free the buffer, the RAM cache and the manifest.
+     */
+    void deinit();
+
+    /**
+     * @brief Find the file answering a request path.
+     * @param uri Request path, the query string is ignored.
+     * @return Status::NotFound if nothing answers it (not even the single page app index), Status::InvalidParameters
+     *         for a path going up the tree.
+     */
+    Status resolve(const char* uri, Asset& out);
+
+    /**
+     * @brief Tells if a request can be answered with a 304 (and counts it).
+     * @param if_none_match Value of the If-None-Match header, nullptr if none.
+     */
+    bool notModified(const Asset& asset, const char* if_none_match);
+
+    /**
+     * @brief Content of an asset in the RAM cache.
+     * @return The content (`asset.size` bytes), nullptr if it isn't cached.
+     */
+    const uint8_t* getCached(const Asset& asset);
+
+    /**
+     * @brief Read an asset through the read buffer, keeping it in the RAM cache if it fits.
+     * @return Status::Failure if the file can't be read, Status::InvalidState if the sink stopped.
+     */
+    Status stream(const Asset& asset, const Sink& sink);
+
+    Stats getStats() const;
+
+    /**
+     * @brief Value of the Cache-Control header for an asset.
+     */
+    static const char* CacheControl(const Asset& asset);
+
+    /**
+     * @brief Tells if an If-None-Match value (list of ETags, weak ones or `*`) matches an ETag.
+     */
+    static bool MatchesETag(const char* if_none_match, const char* etag);
+
+    /**
+     * @brief Content type from the extension of a path.
+     */
+    static const char* MimeType(const char* path);
+
+private:
+    struct ManifestEntry
+    {
+        std::string path; // from the web root
+        std::string etag; // quoted
+    };
+
+    struct CacheEntry
+    {
+        char path[PATH_SIZE];
+        uint8_t* data; // nullptr when the entry is free
+        size_t size;
+        uint32_t last_use;
+    };
+
+    std::string root;
+    std::vector<ManifestEntry> manifest; // sorted by path
+    uint8_t* buffer = nullptr;
+    CacheEntry cache[WEB_ASSET_CACHE_ENTRIES] = {};
+    size_t cached_bytes = 0;
+    uint32_t use_clock = 0;
+    Stats stats = {};
+
+    Status load_manifest();
+    bool fill(const std::string& path, bool gzip, const char* mime, Asset& out);
+    CacheEntry* reserve(const Asset& asset);
+};
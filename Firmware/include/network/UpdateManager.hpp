@@ -1,6 +1,8 @@
 #pragma once
 #include "common/utils.hpp"
 #include "common/NVS.hpp"
+#include "network/OtaDownload.hpp"
+#include "network/OtaManifest.hpp"
 #include <string>
 
 class UpdateManager
@@ -28,6 +30,8 @@ public:
         ErrorHTTPClient,
         ErrorOutOfBounds,
         ErrorEraseStorage,
+        ErrorIntegrity, // manifest signature or image hash doesn't match
+        ErrorNoManifestKey, // no key in this build to check the manifests (with OTA_REQUIRE_SIGNED_MANIFEST)
     };
 
     UpdateManager();
@@ -57,6 +61,12 @@ public:
      */
     float getProgress();
 
+    /**
+     * @brief Get the download throughput of the current image
+     * @returns Mean throughput in bytes per second since the image started (resumes included)
+     */
+    float getThroughput();
+
     /**
      * @brief Get the latest available version string from the update server
      * @returns Latest version string (e.g. "1.2.3") or empty string if not available
@@ -101,17 +111,18 @@ public:
 private:
     // For getters
     float progress = 0.0f;
+    float throughput = 0.0f;
     Status status = Status::Done;
     bool update_available = false;
 
     // Internal state
     std::string latest_version;
-    std::string firmware_download_url;
-    std::string filesystem_download_url;
+    OtaManifest::Manifest manifest = {};
 
     // Internal functions
     ::Status check_update();
     ::Status download_firmware();
     ::Status download_filesystem();
+    ::Status download_image(const OtaManifest::Image& image, OtaDownload::Target& target, Status updating);
     ::Status verify_firmware();
 };
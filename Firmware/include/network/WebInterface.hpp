@@ -2,6 +2,7 @@
 #include "common/utils.hpp"
 #include "esp_http_server.h"
 #include "network/WiFiManager.hpp"
+#include "network/StaticAssets.hpp"
 
 class WebInterface
 {
@@ -28,12 +29,12 @@ private:
     httpd_handle_t server = nullptr;
     bool running = false;
     const uint16_t port;
+    StaticAssets assets;
 
     void registerURIHandlers();
     esp_err_t main_request_handler(httpd_req_t *req);
     
-    static const char* get_mime_type(const char* filepath);
-    static esp_err_t send_file_chunked(httpd_req_t *req, const char *filepath, const char *mime_type, bool is_gzip);
+    esp_err_t send_asset(httpd_req_t *req, const StaticAssets::Asset& asset);
     static esp_err_t safe_request_handler(httpd_req_t *req);
     static esp_err_t connect_request_handler(httpd_req_t *req);
 };
\ No newline at end of file
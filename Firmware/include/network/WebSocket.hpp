@@ -25,6 +25,7 @@ public:
     Status deinit();
 
     void sendResponse(void* context, const Protocol::MessageHeader& header, const uint8_t* payload);
+    Status sendMessage(void* context, const uint8_t* message, size_t len, SentCallback sent, void* arg);
 
     uint8_t getNbClients() const;
 
@@ -2,12 +2,15 @@
 #include "common/utils.hpp"
 #include "common/NVS.hpp"
 #include "network/DNSServer.hpp"
+#include "network/WiFiReconnect.hpp"
+#include <mutex>
 
 // ESP-IDF WiFi includes
 #include "esp_wifi.h"
 #include "esp_event.h"
 #include "esp_netif.h"
 #include "esp_system.h"
+#include "esp_timer.h"
 #include "nvs_flash.h"
 #include "lwip/err.h"
 #include "lwip/sys.h"
@@ -80,14 +83,45 @@ public:
 
     const char* getSSID() { return ssid; }
 
+    /**
+     * @brief Get the phase timings of the last station connection.
+     * @return Scan, association and DHCP times of the last connection.
+     */
+    WiFiReconnect::Timings getTimings();
+
+    /**
+     * @brief Get the station connection counters.
+     * @return Attempts, connections and link losses since the station started.
+     */
+    WiFiReconnect::Stats getStats();
+
     void __wifi_event_handler(esp_event_base_t event_base, int32_t event_id, void* event_data);
+    void __on_retry_timer();
 
 private:
     State state;
     Mode mode;
     char mac_address[18];
     char ip_address[16];
-    int retry_count;
+
+    /**
+     * Access point of the last connection, stored in NVS to skip the scan
+     * - `ssid`: network the access point belongs to
+     * - `bssid`: MAC address of the access point
+     * - `channel`: primary channel of the access point
+     */
+    struct CachedAP
+    {
+        char ssid[32];
+        uint8_t bssid[6];
+        uint8_t channel;
+    };
+
+    WiFiReconnect reconnect;
+    std::mutex reconnect_mutex; // WiFi events and the retry timer run in different tasks
+    esp_timer_handle_t retry_timer = nullptr;
+    CachedAP cached_ap = {};  // valid when its ssid is the current one
+    CachedAP scanned_ap = {}; // best access point of the last scan
 
     char ssid[32];
     char password[64];
@@ -100,6 +134,12 @@ private:
     Status __connect_to_ap();
     Status __create_ap();
 
+    bool has_cached_ap() const;
+    void run_command(WiFiReconnect::Command command);
+    void connect_to(const CachedAP& ap);
+    void on_scan_done();
+    void arm_retry_timer();
+
     DNSServer dns_server;
 
     void on_ap_started();
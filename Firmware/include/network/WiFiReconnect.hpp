@@ -0,0 +1,197 @@
+#pragma once
+#include "common/config.hpp"
+#include <cstdint>
+
+/**
+ * @brief Station connection state machine of WiFiManager : which step to take on each WiFi event, when to retry,
+ *        and how long each phase of a connection took.
+ *
+ * An attempt with a cached access point (BSSID and channel of the last connection) skips the scan and goes straight
+ * to the association. Once WIFI_FAST_ATTEMPTS of them failed, the cache is dropped and attempts start with a scan.
+ * Failed attempts (disconnection, phase timeout, SSID not found) are retried after an exponential backoff with
+ * jitter, up to `max_retries` times before giving up. A link lost after WIFI_STABLE_LINK_MS reconnects right away,
+ * a link lost sooner counts as a failed attempt, so a flapping access point keeps backing off.
+ * Events that don't match the current phase are ignored : a storm of disconnections while waiting or scanning gives
+ * no extra command.
+ *
+ * Every input returns the command the caller has to run now, poll() the one due at a given time and deadline() the
+ * time poll() has to be called again.
+ * @note Portable (no ESP-IDF call), times are in microseconds from any monotonic clock. Not thread safe.
+ */
+class WiFiReconnect
+{
+public:
+    enum class State : uint8_t
+    {
+        Idle,        // not started
+        Scanning,    // looking for the SSID
+        Associating, // authentication and association with the access point
+        ObtainingIP, // associated, waiting for the DHCP lease
+        Connected,
+        Waiting,     // backing off before the next attempt
+        GaveUp,      // `max_retries` retries failed in a row
+    };
+
+    enum class Command : uint8_t
+    {
+        None,
+        Scan,          // scan for the SSID, then call onScanDone()
+        Connect,       // connect to the access point found by the scan
+        ConnectCached, // connect to the cached access point (BSSID and channel), without scanning
+        Disconnect,    // abort the attempt (a phase timed out)
+        DropCache,     // forget the cached access point, then scan (same as Scan)
+        GiveUp,        // stop retrying
+    };
+
+    /**
+     * Retry policy
+     * - `backoff_base_us`: delay before the first retry, doubled for each retry after it
+     * - `backoff_max_us`: cap of the delay
+     * - `jitter`: random part of the delay (0 to 1), removed from it so concurrent robots don't retry together
+     * - `phase_timeout_us`: time allowed to each phase (scan, association, DHCP)
+     * - `fast_attempts`: attempts with the cached access point before scanning
+     * - `stable_link_us`: time a link has to last for its loss to reconnect right away
+     * - `max_retries`: retries of failed attempts in a row before giving up
+     */
+    struct Policy
+    {
+        int64_t backoff_base_us;
+        int64_t backoff_max_us;
+        float jitter;
+        int64_t phase_timeout_us;
+        uint8_t fast_attempts;
+        int64_t stable_link_us;
+        uint8_t max_retries;
+    };
+
+    /**
+     * Time taken by each phase of the last connection, in milliseconds
+     * - `scan_ms`: 0 when the cached access point was used
+     * - `assoc_ms`: authentication and association (the WiFi driver reports them as one step)
+     * - `dhcp_ms`: association to the IP address
+     * - `total_ms`: first attempt (including the failed ones and their backoff) to the IP address
+     * - `fast`: the cached access point was used
+     */
+    struct Timings
+    {
+        uint32_t scan_ms;
+        uint32_t assoc_ms;
+        uint32_t dhcp_ms;
+        uint32_t total_ms;
+        bool fast;
+    };
+
+    /**
+     * Counters since start()
+     * - `attempts`: connection attempts
+     * - `fast_attempts`: attempts with the cached access point
+     * - `connections`: attempts that got an IP address
+     * - `link_losses`: disconnections of a connected link
+     * - `ignored_events`: events that didn't match the current phase
+     */
+    struct Stats
+    {
+        uint32_t attempts;
+        uint32_t fast_attempts;
+        uint32_t connections;
+        uint32_t link_losses;
+        uint32_t ignored_events;
+    };
+
+    constexpr static int64_t NO_DEADLINE = INT64_MAX;
+
+    /** Policy from config.hpp (WIFI_*) */
+    constexpr static Policy DEFAULT_POLICY = {
+        WIFI_BACKOFF_BASE_MS * 1000ll,
+        WIFI_BACKOFF_MAX_MS * 1000ll,
+        WIFI_BACKOFF_JITTER,
+        WIFI_PHASE_TIMEOUT_MS * 1000ll,
+        WIFI_FAST_ATTEMPTS,
+        WIFI_STABLE_LINK_MS * 1000ll,
+        WIFI_MAX_RETRIES,
+    };
+
+    /**
+     * @param seed Seed of the backoff jitter.
+     */
+    WiFiReconnect(const Policy& policy = DEFAULT_POLICY, uint32_t seed = 1);
+
+    /**
+     * @brief Start connecting (the station interface just started).
+     * @param has_cache An access point is cached for the SSID.
+     */
+    Command start(bool has_cache, int64_t now_us);
+
+    /**
+     * @brief Stop connecting (back to Idle, events are ignored until start()).
+     */
+    void stop();
+
+    /**
+     * @brief The scan asked by Command::Scan ended.
+     * @param found The SSID was seen.
+     */
+    Command onScanDone(bool found, int64_t now_us);
+
+    /**
+     * @brief The station associated with the access point.
+     */
+    Command onAssociated(int64_t now_us);
+
+    /**
+     * @brief The station got its IP address : the caller should cache the access point.
+     */
+    Command onGotIP(int64_t now_us);
+
+    /**
+     * @brief The station got disconnected (or failed to associate).
+     */
+    Command onDisconnected(int64_t now_us);
+
+    /**
+     * @brief Take the command due at `now_us` (a retry after its backoff, or an abort on a phase timeout).
+     */
+    Command poll(int64_t now_us);
+
+    /**
+     * @brief Time the next command is due if no event comes (NO_DEADLINE when connected, idle or given up).
+     */
+    int64_t deadline() const;
+
+    State getState() const { return state; }
+
+    /**
+     * @brief Phase timings of the last connection (zeros before the first one).
+     */
+    Timings getTimings() const { return timings; }
+
+    Stats getStats() const { return stats; }
+
+    /**
+     * @brief Backoff before the retry following `failures` failed attempts, without the jitter.
+     */
+    int64_t backoffDelay(uint8_t failures) const;
+
+private:
+    Policy policy;
+    uint32_t random_state;
+
+    State state = State::Idle;
+    bool has_cache = false;
+    bool fast = false;           // current attempt uses the cached access point
+    uint8_t failures = 0;        // failed attempts in a row
+    uint8_t fast_failures = 0;   // failed attempts with the cached access point
+    int64_t phase_start_us = 0;
+    int64_t first_attempt_us = 0;
+    int64_t retry_at_us = 0;
+    int64_t connected_at_us = 0;
+    int64_t scan_us = 0;
+    int64_t assoc_us = 0;
+
+    Timings timings = {};
+    Stats stats = {};
+
+    Command attempt(int64_t now_us);
+    Command fail(int64_t now_us, bool abort);
+    uint32_t next_random();
+};
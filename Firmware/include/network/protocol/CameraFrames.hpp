@@ -0,0 +1,74 @@
+#pragma once
+#include "network/protocol/Protocol.hpp"
+#include "drivers/CameraStream.hpp"
+#include <functional>
+
+namespace Protocol
+{
+namespace CameraFrames
+{
+    /** Event of a frame chunk (module 0x16 in the low byte, like the command ids) */
+    constexpr uint16_t EVENT_FRAME_CHUNK = 0x0016;
+
+    /** <API_REF>
+     * @type CameraChunk
+     * @desc Part of a camera frame, sent as event 0x0016 to the clients subscribed with camera.subscribe. The chunks of
+     *       a frame come in order, a frame is complete once frame_size bytes were received. A chunk of another sequence
+     *       before that means the frame was abandoned (client gone or too slow).
+     * @field sequence uint32 Capture number of the frame (increasing, gaps are frames skipped for this client).
+     * @field frame_size uint32 Size of the whole JPEG frame in bytes.
+     * @field offset uint32 Offset of this chunk in the frame.
+     * @field timestamp_us int64 Capture time, on the clock of the control loop (see RobotState timestamp_us).
+     * @field tick uint32 Control loop tick nearest to the capture (see RobotState tick), 0 before the control loop ran.
+     * @field width uint16 Width of the image in pixels.
+     * @field height uint16 Height of the image in pixels.
+     * @field data byte[] JPEG bytes of the chunk (up to the chunk size given to subscribe).
+     */
+    struct ChunkHeader
+    {
+        uint32_t sequence;
+        uint32_t frame_size;
+        uint32_t offset;
+        int64_t timestamp_us;
+        uint32_t tick;
+        uint16_t width;
+        uint16_t height;
+    } __attribute__((packed));
+
+    /** Latest control loop tick and its start time */
+    using TickSource = std::function<void(uint32_t& tick, int64_t& tick_us)>;
+    /** Sends a whole message (protocol header included), blocking until sent, false when the client is gone */
+    using Send = std::function<bool(const uint8_t* message, size_t size)>;
+
+    /**
+     * @brief Size of a chunk message, for the buffer given to Serve().
+     */
+    constexpr size_t MessageSize(uint16_t chunk_size)
+    {
+        return sizeof(MessageHeader) + sizeof(ChunkHeader) + chunk_size;
+    }
+
+    /**
+     * @brief Chunk size asked by a client, 0 for CAMERA_CHUNK_SIZE, within CAMERA_CHUNK_MIN_SIZE and CAMERA_CHUNK_MAX_SIZE.
+     */
+    uint16_t ChunkSize(uint16_t asked);
+
+    /**
+     * @brief Control loop tick nearest to a time, from a known tick (the ticks are CONTROL_LOOP_DT_S apart).
+     */
+    uint32_t NearestTick(uint32_t tick, int64_t tick_us, int64_t time_us);
+
+    /**
+     * @brief Write the chunk message of a frame starting at `offset`.
+     * @param out Buffer of MessageSize(chunk_size) bytes.
+     * @return Size of the message, 0 when `offset` is past the frame.
+     */
+    size_t WriteChunk(const CameraStream::Frame& frame, uint32_t tick, uint32_t offset, uint16_t chunk_size, uint8_t* out);
+
+    /**
+     * @brief Send the frames of a stream client as chunk events until it is gone (see CameraStream::serveFrames()).
+     * @param buffer Buffer of MessageSize(chunk_size) bytes, each chunk is written there before `send`.
+     */
+    Status Serve(CameraStream& stream, int client, uint16_t chunk_size, uint8_t* buffer, const TickSource& ticks, const Send& send);
+}
+}
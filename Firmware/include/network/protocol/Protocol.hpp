@@ -44,7 +44,16 @@ namespace Protocol
 
     class ITransport {
     public:
+        /** Called once a message of sendMessage() was sent (or failed) */
+        using SentCallback = void(*)(void* arg, bool sent);
+
         virtual void sendResponse(void* context, const MessageHeader& header, const uint8_t* payload) = 0;
+
+        /**
+         * @brief Queue a whole message (header included) without copying it, for streams of big messages.
+         * @note The message must stay valid until `sent` is called (from the transport task).
+         */
+        virtual Status sendMessage(void* context, const uint8_t* message, size_t len, SentCallback sent, void* arg) = 0;
     };
 
     struct RequestContext {
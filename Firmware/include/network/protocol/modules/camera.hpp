@@ -0,0 +1,109 @@
+#pragma once
+#include "network/protocol/Protocol.hpp"
+#include "network/protocol/CameraFrames.hpp"
+#include "common/BinaryReader.hpp"
+#include "common/BinaryWriter.hpp"
+#include "Robot.hpp"
+
+namespace Protocol
+{
+namespace Camera
+{
+    constexpr uint8_t MODULE_ID = 0x16;
+
+    /** <API_REF>
+     * @module camera 0x16
+     * @action subscribe 0x00
+     * @desc Starts streaming the camera frames to this client, as CameraChunk events (0x0016) on this connection. Each
+     *       frame carries its capture time and the nearest control loop tick, to match it with the robot state.
+     * @arg chunk_size uint16 Frame bytes per event (512 to 16384), 0 for the default (4096).
+     * @result chunk_size uint16 Frame bytes per event used.
+     * @impl done
+     */
+    static void Subscribe(const RequestContext& ctx, const uint8_t* payload)
+    {
+        BinaryReader reader(payload, ctx.expected_len);
+        uint16_t chunk_size;
+        if (reader.read(chunk_size) != Status::Ok)
+        {
+            ctx.respond(ResponseStatus::InvalidParameters);
+            return;
+        }
+
+        Status err = Robot::GetInstance().getUIManager().getCamera().subscribe(ctx.transport, ctx.transport_context, chunk_size);
+        if (err == Status::NoMemory)
+        {
+            ctx.respond(ResponseStatus::OutOfMemory);
+            return;
+        }
+        if (err != Status::Ok && err != Status::InvalidState) // already subscribed
+        {
+            ctx.respond(ResponseStatus::UnknownError);
+            return;
+        }
+        chunk_size = CameraFrames::ChunkSize(chunk_size);
+        ctx.respond(ResponseStatus::Ok, reinterpret_cast<const uint8_t*>(&chunk_size), sizeof(chunk_size));
+    }
+
+    /** <API_REF>
+     * @module camera 0x16
+     * @action unsubscribe 0x01
+     * @desc Stops streaming the camera frames to this client (the frame being sent is completed).
+     * @impl done
+     */
+    static void Unsubscribe(const RequestContext& ctx, const uint8_t* payload)
+    {
+        Status err = Robot::GetInstance().getUIManager().getCamera().unsubscribe(ctx.transport, ctx.transport_context);
+        ctx.respond(err == Status::Ok ? ResponseStatus::Ok : ResponseStatus::NotFound);
+    }
+
+    /** <API_REF>
+     * @module camera 0x16
+     * @action getStats 0x02
+     * @desc Gets the stream stats of this client.
+     * @result frames uint32 Frames sent.
+     * @result dropped uint32 Frames skipped while an older one was sent.
+     * @result fps float Frames sent per second (smoothed).
+     * @result latency_ms uint32 Capture to the end of the send of the last frame, in milliseconds.
+     * @result width uint16 Width of the frames captured now.
+     * @result height uint16 Height of the frames captured now.
+     * @result frame_rate float Capture rate now.
+     * @impl done
+     */
+    static void GetStats(const RequestContext& ctx, const uint8_t* payload)
+    {
+        CameraDriver& camera = Robot::GetInstance().getUIManager().getCamera();
+        CameraStream::ClientStats stats;
+        if (!camera.getSubscriptionStats(ctx.transport, ctx.transport_context, stats))
+        {
+            ctx.respond(ResponseStatus::NotFound);
+            return;
+        }
+        CameraRateController::Settings settings = camera.getRateController().getSettings();
+        const CameraRateController::Level& level = CameraRateController::LEVELS[settings.level];
+
+        uint8_t buffer[3 * sizeof(uint32_t) + 2 * sizeof(uint16_t) + 2 * sizeof(float)];
+        BinaryWriter writer(buffer, sizeof(buffer));
+        writer.write(stats.frames);
+        writer.write(stats.dropped);
+        writer.write(stats.fps);
+        writer.write(stats.latency_us / 1000);
+        writer.write(level.width);
+        writer.write(level.height);
+        writer.write(settings.frame_rate);
+        ctx.respond(ResponseStatus::Ok, buffer, writer.getOffset());
+    }
+
+
+    static ActionCallback actions[] = {
+        Subscribe,      // 0x00
+        Unsubscribe,    // 0x01
+        GetStats,       // 0x02
+    };
+
+    static void Register(Dispatcher& dispatcher)
+    {
+        dispatcher.registerModule(MODULE_ID, actions, sizeof(actions));
+    }
+}
+}
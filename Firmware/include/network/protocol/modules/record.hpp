@@ -0,0 +1,168 @@
+#pragma once
+#include "network/protocol/Protocol.hpp"
+#include "common/BinaryReader.hpp"
+#include "common/BinaryWriter.hpp"
+#include "common/LittleFS.hpp"
+#include "diagnostic/SensorRecorder.hpp"
+#include <cstdio>
+#include <cctype>
+
+namespace Protocol
+{
+namespace Record
+{
+    constexpr uint8_t MODULE_ID = 0x15;
+    constexpr size_t MAX_NAME_LEN = 32;
+
+    /// @brief Read a recording name from the payload and build its path on the file system
+    static bool read_path(BinaryReader& reader, char* path, size_t path_size)
+    {
+        char name[MAX_NAME_LEN];
+        if (reader.readString(name, sizeof(name)) != Status::Ok || name[0] == '\0')
+        {
+            return false;
+        }
+        for (const char* c = name; *c; c++)
+        {
+            if (!isalnum((unsigned char) *c) && *c != '-' && *c != '_') return false;
+        }
+        snprintf(path, path_size, "/storage/%s.rec", name);
+        return true;
+    }
+
+    /** <API_REF>
+     * @module record 0x15
+     * @action start 0x00
+     * @desc Starts recording the raw sensor streams (ADC, IMU, power, motor commands) to a file. See SensorRecord.hpp for the file format.
+     * @arg name string Name of the recording (letters, digits, '-' and '_' only).
+     * @arg max_duration_ms uint32 The recording stops by itself after this duration, 0 for no limit.
+     * @impl done
+     */
+    static void Start(const RequestContext& ctx, const uint8_t* payload)
+    {
+        BinaryReader reader(payload, ctx.expected_len);
+        char path[MAX_PATH_LEN];
+        uint32_t max_duration_ms;
+        if (!read_path(reader, path, sizeof(path)) || reader.read(max_duration_ms) != Status::Ok)
+        {
+            ctx.respond(ResponseStatus::InvalidParameters);
+            return;
+        }
+
+        if (LittleFS::Init() != Status::Ok || SensorRecorder::Start(path, max_duration_ms) != Status::Ok)
+        {
+            ctx.respond(ResponseStatus::UnknownError);
+            return;
+        }
+        ctx.respond(ResponseStatus::Ok);
+    }
+
+    /** <API_REF>
+     * @module record 0x15
+     * @action stop 0x01
+     * @desc Stops the current recording. The file is complete once getStatus reports recording = false.
+     * @impl done
+     */
+    static void Stop(const RequestContext& ctx, const uint8_t* payload)
+    {
+        SensorRecorder::Stop();
+        ctx.respond(ResponseStatus::Ok);
+    }
+
+    /** <API_REF>
+     * @module record 0x15
+     * @action getStatus 0x02
+     * @desc Gets the status of the current (or last) recording.
+     * @result recording bool Whether a recording is running.
+     * @result records uint32 Number of records written.
+     * @result dropped uint32 Number of samples dropped (writer too slow).
+     * @result bytes uint32 Size of the file in bytes.
+     * @result duration_ms uint32 Duration of the recording in milliseconds.
+     * @impl done
+     */
+    static void GetStatus(const RequestContext& ctx, const uint8_t* payload)
+    {
+        SensorRecorder::Stats stats = SensorRecorder::GetStats();
+        uint8_t buffer[sizeof(bool) + 4 * sizeof(uint32_t)];
+        BinaryWriter writer(buffer, sizeof(buffer));
+        writer.write(stats.recording);
+        writer.write(stats.records);
+        writer.write(stats.dropped);
+        writer.write(stats.bytes);
+        writer.write(stats.duration_ms);
+        ctx.respond(ResponseStatus::Ok, buffer, writer.getOffset());
+    }
+
+    /** <API_REF>
+     * @module record 0x15
+     * @action read 0x03
+     * @desc Reads a chunk of a recording file.
+     * @arg name string Name of the recording.
+     * @arg offset uint32 Offset in the file, in bytes.
+     * @arg length uint16 Number of bytes to read (at most 192).
+     * @result data byte[] The chunk, shorter than length at the end of the file (empty after it).
+     * @impl done
+     */
+    static void Read(const RequestContext& ctx, const uint8_t* payload)
+    {
+        BinaryReader reader(payload, ctx.expected_len);
+        char path[MAX_PATH_LEN];
+        uint32_t offset;
+        uint16_t length;
+        if (!read_path(reader, path, sizeof(path)) || reader.read(offset) != Status::Ok || reader.read(length) != Status::Ok)
+        {
+            ctx.respond(ResponseStatus::InvalidParameters);
+            return;
+        }
+        if (length > RECORDER_READ_CHUNK_SIZE) length = RECORDER_READ_CHUNK_SIZE;
+
+        FILE* file = fopen(path, "rb");
+        if (file == nullptr)
+        {
+            ctx.respond(ResponseStatus::NotFound);
+            return;
+        }
+        uint8_t chunk[RECORDER_READ_CHUNK_SIZE];
+        size_t read = 0;
+        if (fseek(file, offset, SEEK_SET) == 0)
+        {
+            read = fread(chunk, 1, length, file);
+        }
+        fclose(file);
+        ctx.respond(ResponseStatus::Ok, chunk, read);
+    }
+
+    /** <API_REF>
+     * @module record 0x15
+     * @action delete 0x04
+     * @desc Deletes a recording file.
+     * @arg name string Name of the recording.
+     * @impl done
+     */
+    static void Delete(const RequestContext& ctx, const uint8_t* payload)
+    {
+        BinaryReader reader(payload, ctx.expected_len);
+        char path[MAX_PATH_LEN];
+        if (!read_path(reader, path, sizeof(path)))
+        {
+            ctx.respond(ResponseStatus::InvalidParameters);
+            return;
+        }
+        ctx.respond(remove(path) == 0 ? ResponseStatus::Ok : ResponseStatus::NotFound);
+    }
+
+
+    static ActionCallback actions[] = {
+        Start,      // 0x00
+        Stop,       // 0x01
+        GetStatus,  // 0x02
+        Read,       // 0x03
+        Delete,     // 0x04
+    };
+
+    static void Register(Dispatcher& dispatcher)
+    {
+        dispatcher.registerModule(MODULE_ID, actions, sizeof(actions));
+    }
+}
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "network/protocol/Protocol.hpp"
 #include "common/BinaryReader.hpp"
+#include "common/BinaryWriter.hpp"
 #include "common/Log.hpp"
 #include "network/WiFiManager.hpp"
 #include "Robot.hpp"
@@ -41,9 +42,44 @@ namespace WiFi
         ctx.respond(err == Status::Ok ? ResponseStatus::Ok : ResponseStatus::InvalidParameters);
     }
 
+    /** <API_REF>
+     * @module wifi 0x10
+     * @action getConnectionStats 0x01
+     * @desc Gets the phase timings of the last station connection and the reconnection counters.
+     * @result scan_ms uint32 Scan time (0 when the cached access point was used).
+     * @result assoc_ms uint32 Authentication and association time.
+     * @result dhcp_ms uint32 Association to IP address time.
+     * @result total_ms uint32 First attempt (including the failed ones and their backoff) to IP address time.
+     * @result fast bool Whether the cached access point (BSSID and channel) was used.
+     * @result attempts uint32 Connection attempts.
+     * @result fast_attempts uint32 Attempts with the cached access point.
+     * @result connections uint32 Attempts that got an IP address.
+     * @result link_losses uint32 Disconnections of a connected link.
+     * @impl done
+     */
+    static void GetConnectionStats(const RequestContext& ctx, const uint8_t* payload)
+    {
+        WiFiManager& wifi = Robot::GetInstance().getNetworkManager().getWiFiManager();
+        WiFiReconnect::Timings timings = wifi.getTimings();
+        WiFiReconnect::Stats stats = wifi.getStats();
+
+        uint8_t buffer[8 * sizeof(uint32_t) + sizeof(bool)];
+        BinaryWriter writer(buffer, sizeof(buffer));
+        writer.write(timings.scan_ms);
+        writer.write(timings.assoc_ms);
+        writer.write(timings.dhcp_ms);
+        writer.write(timings.total_ms);
+        writer.write(timings.fast);
+        writer.write(stats.attempts);
+        writer.write(stats.fast_attempts);
+        writer.write(stats.connections);
+        writer.write(stats.link_losses);
+        ctx.respond(ResponseStatus::Ok, buffer, writer.getOffset());
+    }
 
     static ActionCallback actions[] = {
         ConnectToAP,           // 0x00
+        GetConnectionStats,    // 0x01
     };
 
     static void Register(Dispatcher& dispatcher)
@@ -0,0 +1,124 @@
+#pragma once
+#include "common/utils.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Compressed 1bpp animations.
+ *
+ * Frames are stored in the screen buffer format (`width` columns by (height + 7) / 8 pages, bit 0 on top, see
+ * ScreenDriver::Info), so a decoded frame is painted on the screen a page at a time. A key frame holds the whole frame,
+ * a delta frame holds the XOR with the previous one (mostly zeros), both compressed with a byte run-length code.
+ *
+ * Container (little endian) :
+ * - header : "TNYA", version (1), width, height, frame count, 4 reserved bytes
+ * - frame offsets : one uint32 per frame, from the start of the container
+ * - frames : type (FRAME_KEY or FRAME_DELTA), then the runs until the frame is complete
+ *
+ * Runs : a control byte `c` followed by
+ * - `c` < 0x80 : c + 1 literal bytes
+ * - `c` >= 0x80 : one byte, repeated c - 0x80 + 2 times (a repeated zero in a delta frame leaves the pixels as they are)
+ *
+ * Files are made by the host tool `anim_encode` (see host/README.md), from PNG or GIF sequences.
+ */
+namespace AnimationCodec
+{
+    constexpr const char* TAG = "AnimationCodec";
+
+    constexpr uint8_t VERSION = 1;
+    constexpr size_t HEADER_SIZE = 12;
+    constexpr uint8_t FRAME_KEY = 0;
+    constexpr uint8_t FRAME_DELTA = 1;
+
+    /**
+     * Animation information
+     * - `width`: width of the frames, in pixels
+     * - `height`: height of the frames, in pixels
+     * - `frame_count`: number of frames
+     */
+    typedef struct
+    {
+        uint8_t width;
+        uint8_t height;
+        uint8_t frame_count;
+    } Header;
+
+    /**
+     * @brief Size of a frame in the screen buffer format, in bytes.
+     */
+    constexpr size_t FrameSize(uint8_t width, uint8_t height)
+    {
+        return width * ((height + 7) / 8);
+    }
+
+    /**
+     * @brief Read and check the header and the frame offsets of an animation.
+     * @return Status::InvalidParameters if the data isn't a valid animation.
+     */
+    Status ParseHeader(const uint8_t* data, size_t size, Header& header);
+
+    /**
+     * @brief Compress frames into an animation.
+     * @param frames `frame_count` frames in the screen buffer format, one after the other.
+     * @param keyframe_interval Maximum number of frames between two key frames (0 for no limit). Frames are also
+     *                          stored as key frames when that is smaller than their delta.
+     * @param out Receives the animation.
+     */
+    Status Encode(const uint8_t* frames, uint8_t width, uint8_t height, uint8_t frame_count, uint8_t keyframe_interval,
+                  std::vector<uint8_t>& out);
+
+    /**
+     * @brief Convert a frame stored row by row (most significant bit first, like Draw::Blit()) to the screen buffer format.
+     * @param rows `width` * `height` / 8 bytes.
+     * @param pages Receives FrameSize(width, height) bytes.
+     */
+    void RowsToPages(const uint8_t* rows, uint8_t width, uint8_t height, uint8_t* pages);
+
+    /**
+     * Streaming decoder : keeps the current frame (deltas are applied to it) and decodes the next ones on demand.
+     */
+    class Decoder
+    {
+    public:
+        Decoder() = default;
+        Decoder(const Decoder&) = delete;
+        Decoder& operator=(const Decoder&) = delete;
+        ~Decoder() { close(); }
+
+        /**
+         * @brief Use an animation (the data isn't copied and must outlive the decoder) and allocate the frame.
+         * @return Status::InvalidParameters if the data isn't a valid animation, Status::NoMemory if the frame can't be allocated.
+         */
+        Status open(const uint8_t* data, size_t size);
+
+        /**
+         * @brief Free the frame.
+         */
+        void close();
+
+        /**
+         * @brief Decode a frame : the next one is a single delta, other frames start from the closest key frame before them.
+         * @return Status::InvalidParameters if the frame data is corrupted (the frame is then blank).
+         */
+        Status seek(uint8_t index);
+
+        /**
+         * @brief Current frame in the screen buffer format (nullptr before the first seek()).
+         */
+        const uint8_t* getFrame() const { return index >= 0 ? frame : nullptr; }
+
+        const Header& getHeader() const { return header; }
+
+        bool isOpen() const { return frame != nullptr; }
+
+    private:
+        Status apply(uint8_t frame_index);
+
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        Header header = {};
+        uint8_t* frame = nullptr;
+        int16_t index = -1; // decoded frame, -1 if none
+    };
+}
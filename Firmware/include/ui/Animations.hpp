@@ -1,919 +1,121 @@
 #pragma once
 #include "common/utils.hpp"
 
+/**
+ * Animations of the boot menus, in the ui/AnimationCodec.hpp format.
+ * Generated by the host tool anim_encode from extras/animations/*.png (64x64 frames stacked vertically), do not edit :
+ *   anim_encode --size 64x64 --header PhoneQRSpawn extras/animations/PhoneQRSpawn.png PhoneQRSpawn.inc
+ */
 namespace Animation
 {
     // Resolution: 64x64
     // Number of frames: 7
-    // Total: 3584 bytes
+    // Total: 617 bytes (3584 bytes uncompressed)
     const uint8_t PhoneQRSpawn[] = {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        0x54, 0x4E, 0x59, 0x41, 0x01, 0x40, 0x40, 0x07, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+        0x40, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00,
+        0xCC, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xCE,
+        0x00, 0x00, 0xF0, 0x88, 0x10, 0x03, 0x90, 0xD0, 0xD0, 0x90, 0x88, 0x10, 0x00, 0xF0, 0x91, 0x00,
+        0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8F, 0x00, 0x00, 0xC0, 0x96, 0x40, 0x00, 0xC0, 0xA4, 0x00, 0x00,
+        0xFF, 0x88, 0x00, 0x03, 0x02, 0x07, 0x07, 0x02, 0x88, 0x00, 0x00, 0xFF, 0xA4, 0x00, 0x00, 0xFF,
+        0x82, 0x00, 0x00, 0xC0, 0x81, 0x40, 0x81, 0xC0, 0x04, 0x40, 0xC0, 0xC0, 0x40, 0xC0, 0x81, 0x40,
+        0x00, 0xC0, 0x82, 0x00, 0x00, 0xFF, 0xA4, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x0F, 0xFF, 0x6C, 0x15,
+        0xAC, 0xB7, 0x2A, 0x90, 0x51, 0xD6, 0x2A, 0x49, 0x77, 0x04, 0x55, 0xDC, 0xFF, 0x82, 0x00, 0x00,
+        0xFF, 0x91, 0x00, 0x01, 0xFF, 0x00, 0x90, 0x00, 0x00, 0xC0, 0x96, 0x40, 0x00, 0xC0, 0xA4, 0x00,
+        0x00, 0xFF, 0x88, 0x00, 0x03, 0x02, 0x07, 0x07, 0x02, 0x88, 0x00, 0x00, 0xFF, 0xA4, 0x00, 0x00,
+        0x3F, 0x82, 0x40, 0x00, 0x80, 0x81, 0x00, 0x81, 0x80, 0x04, 0x00, 0x80, 0x80, 0x00, 0x80, 0x81,
+        0x00, 0x00, 0x80, 0x82, 0x40, 0x00, 0x3F, 0xA9, 0x00, 0x0F, 0xFF, 0x6C, 0x15, 0xAC, 0xB7, 0x2A,
+        0x92, 0x56, 0xD1, 0x28, 0x49, 0x77, 0x04, 0x55, 0xDC, 0xFF, 0xAE, 0x00, 0x0F, 0xFF, 0x63, 0x6A,
+        0x62, 0xFE, 0xE4, 0xF7, 0x6B, 0xE9, 0xFA, 0x75, 0xE9, 0x7B, 0x7C, 0x76, 0xFF, 0xAE, 0x00, 0x0F,
+        0xFF, 0x6C, 0x15, 0xAC, 0xB7, 0x2A, 0x90, 0x51, 0xD6, 0x2A, 0x49, 0x77, 0x04, 0x55, 0xDC, 0xFF,
+        0x96, 0x00, 0x01, 0xD1, 0x00, 0x00, 0xC0, 0x96, 0x40, 0x00, 0xC0, 0xA4, 0x00, 0x00, 0x3F, 0x88,
+        0x40, 0x03, 0x42, 0x47, 0x47, 0x42, 0x88, 0x40, 0x00, 0x3F, 0xA9, 0x00, 0x00, 0xC0, 0x81, 0x40,
+        0x80, 0xC0, 0x05, 0xC2, 0x47, 0xC7, 0xC2, 0x40, 0xC0, 0x81, 0x40, 0x00, 0xC0, 0xAE, 0x00, 0x0F,
+        0x3F, 0x2C, 0x55, 0xEC, 0x77, 0xEA, 0x50, 0x11, 0x16, 0xEA, 0x09, 0xB7, 0x44, 0x15, 0x9C, 0x3F,
+        0xAE, 0x00, 0x0F, 0xC0, 0x4F, 0x3F, 0x8E, 0x89, 0x0E, 0xA7, 0x7A, 0xFF, 0x10, 0x7C, 0x5E, 0x3F,
+        0x69, 0xEA, 0xC0, 0xAE, 0x00, 0x0F, 0x3F, 0x23, 0x2A, 0x22, 0x3E, 0x24, 0x37, 0x2B, 0x29, 0x3A,
+        0x35, 0x29, 0x3B, 0x3C, 0x36, 0x3F, 0xAA, 0x00, 0x84, 0x80, 0x8A, 0xA0, 0x84, 0x80, 0x92, 0x00,
+        0x01, 0xD1, 0x00, 0x00, 0x3C, 0x88, 0x44, 0x03, 0x64, 0x34, 0x34, 0x64, 0x88, 0x44, 0x00, 0x3C,
+        0xAF, 0x00, 0x03, 0x02, 0x07, 0x07, 0x02, 0xB4, 0x00, 0x0F, 0x3C, 0x84, 0x14, 0x84, 0xBC, 0x6C,
+        0xCC, 0x54, 0xAC, 0x6C, 0xD4, 0xBC, 0x04, 0x14, 0x84, 0x3C, 0xAF, 0x00, 0x0D, 0x5A, 0xB4, 0x86,
+        0x5C, 0x68, 0xE9, 0xE4, 0x4B, 0x88, 0x1D, 0xE0, 0xB4, 0x90, 0xB1, 0xAF, 0x00, 0x0F, 0x3C, 0x21,
+        0x28, 0x20, 0x3D, 0x26, 0x34, 0x29, 0x2B, 0x39, 0x36, 0x2B, 0x38, 0x3F, 0x35, 0x3C, 0xE9, 0x00,
+        0x00, 0xF0, 0x84, 0x88, 0x8A, 0xAA, 0x84, 0x88, 0x00, 0xF0, 0x91, 0x00, 0x01, 0xD1, 0x00, 0x00,
+        0x03, 0x88, 0x05, 0x03, 0x2D, 0x69, 0x69, 0x2D, 0x88, 0x05, 0x00, 0x03, 0xE9, 0x00, 0x0F, 0x03,
+        0x75, 0x01, 0x75, 0xA3, 0x07, 0x4F, 0x51, 0x37, 0x07, 0xB1, 0xA3, 0x55, 0x01, 0xB5, 0x03, 0xAF,
+        0x00, 0x0D, 0xBB, 0x09, 0xA0, 0x11, 0xD2, 0xA7, 0x18, 0x3A, 0x4A, 0x81, 0x32, 0x5C, 0x34, 0xB6,
+        0xAF, 0x00, 0x00, 0x03, 0x81, 0x02, 0x07, 0x03, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x02, 0x82,
+        0x03, 0xB0, 0x00, 0x8A, 0x80, 0xAB, 0x00, 0x00, 0x0C, 0x84, 0x0A, 0x8A, 0x08, 0x84, 0x0A, 0x00,
+        0x0C, 0x91, 0x00, 0x01, 0x91, 0x00, 0x98, 0x80, 0xA5, 0x00, 0x88, 0x01, 0x03, 0x0D, 0x13, 0x13,
+        0x0D, 0x88, 0x01, 0xAA, 0x00, 0x8E, 0x80, 0xAF, 0x00, 0x0D, 0x69, 0x7F, 0xE9, 0xB0, 0xFE, 0x62,
+        0xE7, 0xF6, 0xFE, 0xB7, 0x30, 0x19, 0xFF, 0xC9, 0xAF, 0x00, 0x0F, 0x80, 0xCB, 0xFC, 0xCF, 0x87,
+        0xD8, 0xB1, 0xFB, 0xF4, 0x9C, 0xBF, 0xF7, 0x9A, 0x89, 0xB6, 0x80, 0xF0, 0x00, 0x8A, 0xC0, 0xAB,
+        0x00, 0x00, 0x02, 0x96, 0x03, 0x00, 0x02, 0x91, 0x00,
     };
 
-    // Resolution: 64x64 pixels.
+    // Resolution: 64x64
     // Number of frames: 15
-    // Total: 7680 bytes.
+    // Total: 470 bytes (7680 bytes uncompressed)
     const uint8_t PhoneQRScan[] = {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0F, 0xF0, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFF, 0xFF, 0xC8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x13, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x13, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x13, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x13, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x13, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x13, 0xFF, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x13, 0xFF, 0xFF, 0xC8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x07, 0xE0, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        0x54, 0x4E, 0x59, 0x41, 0x01, 0x40, 0x40, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+        0xB8, 0x00, 0x00, 0x00, 0xC5, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00,
+        0xF4, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00,
+        0x74, 0x01, 0x00, 0x00, 0x89, 0x01, 0x00, 0x00, 0x96, 0x01, 0x00, 0x00, 0xA7, 0x01, 0x00, 0x00,
+        0xB8, 0x01, 0x00, 0x00, 0xC9, 0x01, 0x00, 0x00, 0x00, 0x91, 0x00, 0x98, 0x80, 0xA4, 0x00, 0x00,
+        0xFF, 0x88, 0x00, 0x03, 0x04, 0x0E, 0x0E, 0x04, 0x88, 0x00, 0x00, 0xFF, 0xA4, 0x00, 0x00, 0xFF,
+        0x82, 0x00, 0x8E, 0x80, 0x82, 0x00, 0x00, 0xFF, 0xA4, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x0F, 0xFF,
+        0xD8, 0x2A, 0x58, 0x6F, 0x55, 0x21, 0xA2, 0xAD, 0x55, 0x92, 0xEF, 0x08, 0xAA, 0xB8, 0xFF, 0x82,
+        0x00, 0x00, 0xFF, 0xA4, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x0F, 0x7F, 0x46, 0x54, 0x45, 0x7D, 0x48,
+        0x6F, 0x56, 0x53, 0x74, 0x6A, 0x52, 0x76, 0x78, 0x6D, 0x7F, 0x82, 0x00, 0x00, 0xFF, 0xA4, 0x00,
+        0x00, 0xFF, 0x96, 0x00, 0x00, 0xFF, 0xA4, 0x00, 0x00, 0xFF, 0x84, 0x00, 0x8A, 0x40, 0x84, 0x00,
+        0x00, 0xFF, 0xA4, 0x00, 0x98, 0x01, 0x91, 0x00, 0x01, 0xFF, 0x00, 0x9C, 0x00, 0x80, 0x08, 0xFF,
+        0x00, 0xFF, 0x00, 0xDB, 0x00, 0x01, 0xFF, 0x00, 0x99, 0x00, 0x81, 0x08, 0x80, 0x00, 0x81, 0x08,
+        0xFF, 0x00, 0xFF, 0x00, 0xD8, 0x00, 0x01, 0xFF, 0x00, 0x93, 0x00, 0x84, 0x08, 0x86, 0x00, 0x84,
+        0x08, 0xFF, 0x00, 0xFF, 0x00, 0xD2, 0x00, 0x01, 0xFF, 0x00, 0x93, 0x00, 0x92, 0x18, 0xFF, 0x00,
+        0xFF, 0x00, 0xD2, 0x00, 0x01, 0xFF, 0x00, 0x93, 0x00, 0x92, 0x50, 0xFF, 0x00, 0xFF, 0x00, 0xD2,
+        0x00, 0x01, 0xFF, 0x00, 0x93, 0x00, 0x92, 0x40, 0xAA, 0x00, 0x80, 0x04, 0x00, 0x00, 0x81, 0x04,
+        0x80, 0x00, 0x80, 0x04, 0x80, 0x00, 0x01, 0x04, 0x00, 0x81, 0x04, 0x02, 0x00, 0x04, 0x04, 0xFF,
+        0x00, 0xFF, 0x00, 0x92, 0x00, 0x01, 0xFF, 0x00, 0xD3, 0x00, 0x80, 0x04, 0x00, 0x00, 0x81, 0x04,
+        0x80, 0x00, 0x80, 0x04, 0x80, 0x00, 0x01, 0x04, 0x00, 0x81, 0x04, 0x02, 0x00, 0x04, 0x04, 0xAA,
+        0x00, 0x80, 0x04, 0x83, 0x00, 0x0C, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x00,
+        0x00, 0x04, 0x04, 0xFF, 0x00, 0xD3, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x92, 0x00, 0x80, 0x44,
+        0x83, 0x00, 0x0C, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x44, 0x44,
+        0xFF, 0x00, 0xD3, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x92, 0x00, 0x80, 0x40, 0x8E, 0x00, 0x80,
+        0x40, 0xAA, 0x00, 0x92, 0x01, 0xFF, 0x00, 0x93, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xD2, 0x00,
+        0x92, 0x03, 0xFF, 0x00, 0x93, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xD2, 0x00, 0x82, 0x02, 0x8A,
+        0x00, 0x82, 0x02, 0xFF, 0x00, 0x93, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xD6, 0x00, 0x81, 0x02,
+        0x84, 0x00, 0x81, 0x02, 0xFF, 0x00, 0x97, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xD9, 0x00, 0x80,
+        0x02, 0x80, 0x00, 0x80, 0x02, 0xFF, 0x00, 0x9A, 0x00, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0xDB, 0x00,
+        0x80, 0x02, 0xFF, 0x00, 0x9C, 0x00,
     };
 
     // Resolution: 64x64
     // Number of frames: 6
-    // Total: 3072 bytes
+    // Total: 371 bytes (3072 bytes uncompressed)
     const uint8_t PhoneQRConnected[] = {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8E, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xA9, 0x35, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x8C, 0xD1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0x9F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xD4, 0x63, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xAB, 0x97, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xDC, 0x51, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC1, 0xB7, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x9A, 0x83, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC3, 0xB9, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFB, 0x4B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8E, 0x27, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xA9, 0xDD, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x6F, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1D, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x13, 0x50, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1D, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x19, 0xF0, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x16, 0x30, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x19, 0x70, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x15, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x70, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x18, 0x30, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x90, 0x00, 0x38, 0x00, 0x00,
-        0x00, 0x00, 0x14, 0xB0, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x12, 0x70, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1D, 0xD0, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x16, 0xF0, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xF0, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x14, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x14, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x14, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x00,
-        0x00, 0x00, 0x1C, 0x00, 0x0C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x0E, 0x78, 0x00, 0x00,
-        0x00, 0x00, 0x1C, 0x00, 0x07, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x03, 0xC8, 0x00, 0x00,
-        0x00, 0x00, 0x14, 0x00, 0x01, 0x88, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0xC8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x03, 0x88, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0x0E, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0x9C, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x01, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xF0, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x60, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x06, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0E, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x1C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x38, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x18, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1C, 0xE0, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x0F, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x07, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x03, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x0C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x1C, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x38, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x70, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x30, 0xE0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x39, 0xC0, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x1F, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0F, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x10, 0x3F, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x00, 0x00,
-        0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        0x54, 0x4E, 0x59, 0x41, 0x01, 0x40, 0x40, 0x06, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+        0x94, 0x00, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00,
+        0x56, 0x01, 0x00, 0x00, 0x00, 0x91, 0x00, 0x98, 0x80, 0xA4, 0x00, 0x00, 0xFF, 0x88, 0x00, 0x03,
+        0x04, 0x0E, 0x0E, 0x04, 0x88, 0x00, 0x00, 0xFF, 0xA4, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x8E, 0x80,
+        0x82, 0x00, 0x00, 0xFF, 0xA4, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x0F, 0xFF, 0xD8, 0x2A, 0x58, 0x6F,
+        0x55, 0x21, 0xA2, 0xAD, 0x55, 0x92, 0xEF, 0x08, 0xAA, 0xB8, 0xFF, 0x82, 0x00, 0x00, 0xFF, 0xA4,
+        0x00, 0x00, 0xFF, 0x82, 0x00, 0x0F, 0x7F, 0x46, 0x54, 0x45, 0x7D, 0x48, 0x6F, 0x56, 0x53, 0x74,
+        0x6A, 0x52, 0x76, 0x78, 0x6D, 0x7F, 0x82, 0x00, 0x00, 0xFF, 0xA4, 0x00, 0x00, 0xFF, 0x96, 0x00,
+        0x00, 0xFF, 0xA4, 0x00, 0x00, 0xFF, 0x84, 0x00, 0x8A, 0x40, 0x84, 0x00, 0x00, 0xFF, 0xA4, 0x00,
+        0x98, 0x01, 0x91, 0x00, 0x01, 0xFF, 0x00, 0x91, 0x00, 0x82, 0x80, 0x82, 0x00, 0x8A, 0x80, 0xAA,
+        0x00, 0x13, 0xAD, 0x55, 0x92, 0xEF, 0xF7, 0x72, 0x92, 0xA7, 0x6F, 0x55, 0x21, 0xA2, 0xAD, 0x55,
+        0x92, 0xEF, 0x08, 0xAA, 0xB8, 0xFF, 0xAA, 0x00, 0x17, 0x53, 0x74, 0x6A, 0x52, 0x09, 0x3E, 0x39,
+        0x3A, 0x7D, 0x48, 0x6F, 0x56, 0x53, 0x74, 0x6A, 0x52, 0x76, 0x78, 0x6D, 0x7F, 0x00, 0x00, 0x03,
+        0x07, 0xFF, 0x00, 0xD1, 0x00, 0x01, 0xFF, 0x00, 0x93, 0x00, 0x84, 0x80, 0xB6, 0x00, 0x07, 0x15,
+        0xAA, 0x92, 0xEF, 0x08, 0xAA, 0xB8, 0xFF, 0x8D, 0x00, 0x00, 0x80, 0xA6, 0x00, 0x07, 0x3E, 0x0B,
+        0x6A, 0x52, 0x76, 0x78, 0x6D, 0x7F, 0x86, 0x00, 0x07, 0x03, 0x07, 0x0E, 0x1C, 0x1C, 0x0E, 0x04,
+        0x04, 0xFF, 0x00, 0xD1, 0x00, 0x01, 0xFF, 0x00, 0x91, 0x00, 0x80, 0x80, 0xBC, 0x00, 0x01, 0xB8,
+        0xFF, 0x8D, 0x00, 0x06, 0x80, 0xC0, 0xE0, 0x70, 0x30, 0x00, 0x80, 0xA6, 0x00, 0x01, 0x6D, 0x7F,
+        0x86, 0x00, 0x0D, 0x03, 0x07, 0x0E, 0x1C, 0x1C, 0x0E, 0x04, 0x04, 0x0F, 0x1C, 0x1C, 0x0E, 0x07,
+        0x03, 0xFF, 0x00, 0xD1, 0x00, 0x01, 0xFF, 0x00, 0xDF, 0x00, 0x07, 0x80, 0xC0, 0xE0, 0xF0, 0xF0,
+        0xE0, 0x70, 0x30, 0xAF, 0x00, 0x0B, 0x03, 0x07, 0x0E, 0x1F, 0x1B, 0x00, 0x1B, 0x1F, 0x0F, 0x07,
+        0x03, 0x01, 0xFF, 0x00, 0xD6, 0x00, 0x01, 0xFF, 0x00, 0xDE, 0x00, 0x05, 0x80, 0x40, 0x20, 0x90,
+        0x40, 0x30, 0xB1, 0x00, 0x09, 0x03, 0x04, 0x09, 0x12, 0x00, 0x12, 0x09, 0x04, 0x02, 0x01, 0xFF,
+        0x00, 0xD9, 0x00,
     };
-};
\ No newline at end of file
+}
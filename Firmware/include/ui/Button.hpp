@@ -1,29 +1,70 @@
 #pragma once
 #include "common/utils.hpp"
+#include "ui/ButtonDebouncer.hpp"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
 namespace Button
 {
     constexpr const char* TAG = "Button";
 
-    using Callback = void(*)();
+    constexpr uint8_t LEFT = 0;
+    constexpr uint8_t RIGHT = 1;
+    constexpr uint8_t COUNT = 2;
 
-    typedef struct CallbackSet
+    using Event = ButtonDebouncer::Event;
+
+    /**
+     * A debounced button event
+     * - `button`: LEFT or RIGHT
+     * - `event`: what happened
+     * - `time_us`: esp_timer time of the edge it comes from (of the hold for LongPressed and Repeat)
+     */
+    typedef struct InputEvent
     {
-        Callback onPressed[2];
-        Callback onReleased[2];
-        Callback onLongPressed[2];
-    } CallbackSet;
+        uint8_t button;
+        Event event;
+        int64_t time_us;
+    } InputEvent;
 
     /**
-    * @brief Initializes the GPIO module.
-    * @return Error code indicating success or failure.
-    */
-    Status Init();
+     * Counters of the input path
+     * - `edges`: pin edges seen by the interrupt (bounces included)
+     * - `edges_dropped`: edges lost because the edge queue was full
+     * - `events`: debounced events queued
+     * - `events_dropped`: events lost because nobody took them in time
+     */
+    typedef struct Stats
+    {
+        uint32_t edges;
+        uint32_t edges_dropped;
+        uint32_t events;
+        uint32_t events_dropped;
+    } Stats;
 
     /**
-     * @brief Sets the callback functions for button events.
-     * @param callbacks The set of callback functions to be assigned.
+     * @brief Configure the button pins and their edge interrupt.
+     * @param wake_task Task notified (xTaskNotifyGive) on every edge, it has to call Process() then.
      * @return Error code indicating success or failure.
+     * @note Edges are timestamped in the interrupt and queued, nothing runs periodically.
+     */
+    Status Init(TaskHandle_t wake_task);
+
+    /**
+     * @brief Debounce the queued edges and queue the resulting events (see PopEvent()).
+     * @param now_us Current esp_timer time.
+     * @return esp_timer time Process() has to be called again at if no edge comes in
+     *         (ButtonDebouncer::NO_DEADLINE if none).
+     * @note Only called by the task given to Init().
+     */
+    int64_t Process(int64_t now_us);
+
+    /**
+     * @brief Take the oldest debounced event.
+     * @return false if there is none.
+     * @note Only called by one task (the one calling Process()).
      */
-    Status SetCallbacks(const CallbackSet& callbacks);
-}
\ No newline at end of file
+    bool PopEvent(InputEvent& event);
+
+    Stats GetStats();
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include "common/config.hpp"
+#include <cstdint>
+
+/**
+ * @brief Debouncing state machine of one button, fed with the timestamped edges of its pin.
+ *
+ * A new pin level is kept once no edge was seen for `debounce_us` (a pin back to its previous level is a glitch and
+ * gives nothing), and the resulting event is dated with the first edge of the bounce : presses and releases are
+ * reported at the time the button moved, not the time it settled.
+ * Nothing is polled : edge() records an edge, poll() gives the events due at a given time and deadline() the time
+ * poll() has to be called again (settling, long press or repeat), so the caller can sleep until then.
+ *
+ * Events of a press :
+ * - `Pressed` ... `Released`, always paired
+ * - `LongPressed` once held for `long_press_us`, then `Repeat` every `repeat_us` while held
+ * - `Clicked` on the release of a press that wasn't a long one, followed by `DoubleClicked` if the press started
+ *   less than `double_click_us` after the previous click
+ * A button already held at reset() gives no event until it is released.
+ * @note Portable (no ESP-IDF call), times are in microseconds from any monotonic clock. Not thread safe.
+ */
+class ButtonDebouncer
+{
+public:
+    enum class Event : uint8_t
+    {
+        Pressed,
+        Released,
+        Clicked,
+        LongPressed,
+        Repeat,
+        DoubleClicked,
+    };
+
+    /** Timings of the state machine, in microseconds */
+    struct Timing
+    {
+        uint32_t debounce_us;
+        uint32_t long_press_us;
+        uint32_t repeat_us;       // 0 : no repeat event
+        uint32_t double_click_us; // 0 : no double click event
+    };
+
+    /** An event and the time of the edge (or of the hold) it comes from */
+    struct Output
+    {
+        Event event;
+        int64_t time_us;
+    };
+
+    constexpr static int64_t NO_DEADLINE = INT64_MAX;
+
+    /** Timings from config.hpp (BTN_*) */
+    constexpr static Timing DEFAULT_TIMING = {
+        BTN_DEBOUNCE_MS * 1000u,
+        BTN_LONG_PRESS_MS * 1000u,
+        BTN_REPEAT_INT_MS * 1000u,
+        BTN_DOUBLE_CLICK_MS * 1000u,
+    };
+
+    ButtonDebouncer(const Timing& timing = DEFAULT_TIMING);
+
+    /**
+     * @brief Forget the current press and start from a known pin level (no event).
+     */
+    void reset(bool level, int64_t time_us);
+
+    /**
+     * @brief Record an edge of the pin.
+     * @param level Pin level after the edge (true when pressed). The same level twice means an edge was missed,
+     *        it still restarts the debounce delay.
+     * @note Edges are expected in time order, with the events due before `time_us` already taken by poll().
+     */
+    void edge(bool level, int64_t time_us);
+
+    /**
+     * @brief Take the next event due at `now_us`.
+     * @return false once there is none left (call it until then).
+     */
+    bool poll(int64_t now_us, Output& output);
+
+    /**
+     * @brief Time of the next event if the pin doesn't move (NO_DEADLINE when released and settled).
+     */
+    int64_t deadline() const;
+
+    /**
+     * @brief Debounced state of the button.
+     */
+    bool isPressed() const;
+
+    /**
+     * @brief Pin level after the last edge.
+     */
+    bool getLevel() const;
+
+    /**
+     * @brief Tells if edges were seen since the level was last kept : more edges only delay deadline().
+     */
+    bool isBouncing() const;
+
+private:
+    constexpr static int64_t NO_TIME = INT64_MIN;
+
+    Timing timing;
+
+    bool stable_level = false;   // debounced level
+    bool raw_level = false;      // level after the last edge
+    int64_t last_edge_us = 0;    // last edge, restarts the debounce delay
+    bool bouncing = false;       // edges seen since the level was last kept (or the glitch dropped)
+    int64_t bounce_start_us = 0; // first edge of the bounce
+    int64_t pressed_us = 0;      // time of the current press
+    int64_t next_hold_us = 0;    // time of the next LongPressed / Repeat event
+    bool long_pressed = false;
+    bool ignored = false;            // held since reset(), waiting for the release
+    int64_t last_click_us = NO_TIME; // end of the previous click, for double clicks
+
+    // a release gives up to three events at once
+    Output pending[3] = {};
+    uint8_t pending_count = 0;
+    uint8_t pending_read = 0;
+
+    int64_t settle_time() const;
+    int64_t hold_time() const;
+    void settle();
+};
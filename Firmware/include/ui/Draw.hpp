@@ -1,9 +1,83 @@
 #pragma once
 #include "drivers/ScreenDriver.hpp"
+#include "ui/Font.hpp"
+#include "ui/TextCache.hpp"
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
 
 namespace Draw
 {
+    /**
+     * @brief Paint the rows selected by `mask` in `count` consecutive columns of a page.
+     * @note Full pages are a plain memset, partial ones are masked 4 columns (one word) at a time.
+     */
+    inline void __fill_columns(uint8_t* ptr, size_t count, uint8_t mask, ScreenDriver::Color c)
+    {
+        if (mask == 0xFF)
+        {
+            memset(ptr, c ? 0xFF : 0x00, count);
+            return;
+        }
+
+        // painting black is clearing the bits : AND with the inverted mask, then the same code for both colors
+        const uint8_t set = c ? mask : 0x00;
+        const uint8_t keep = c ? 0xFF : static_cast<uint8_t>(~mask);
+        size_t i = 0;
+        for (; i < count && (reinterpret_cast<uintptr_t>(ptr + i) & 3) != 0; i++) // up to a word boundary
+        {
+            ptr[i] = (ptr[i] & keep) | set;
+        }
+        const uint32_t wide_set = set * 0x01010101u;
+        const uint32_t wide_keep = keep * 0x01010101u;
+        for (; i + 4 <= count; i += 4)
+        {
+            uint32_t word;
+            memcpy(&word, ptr + i, 4);
+            word = (word & wide_keep) | wide_set;
+            memcpy(ptr + i, &word, 4);
+        }
+        for (; i < count; i++)
+        {
+            ptr[i] = (ptr[i] & keep) | set;
+        }
+    }
+
+    /**
+     * @brief Paint a rectangle, page by page (no bounds check).
+     */
+    inline void __fill_area(uint16_t x, uint16_t y, uint16_t w, uint16_t h, ScreenDriver::Color c)
+    {
+        if (w == 0 || h == 0) return;
+        ScreenDriver::MarkDirty(x, y, w, h);
+
+        uint8_t* ptr = &ScreenDriver::info.data[(y / ScreenDriver::PAGE_HEIGHT) * ScreenDriver::info.width + x];
+        uint16_t shift = y % ScreenDriver::PAGE_HEIGHT;
+        if (shift != 0) // first page, partially covered
+        {
+            uint16_t rows = ScreenDriver::PAGE_HEIGHT - shift;
+            uint8_t mask = 0xFF << shift;
+            if (h < rows)
+            {
+                mask &= 0xFF >> (rows - h);
+                rows = h;
+            }
+            __fill_columns(ptr, w, mask, c);
+            ptr += ScreenDriver::info.width;
+            h -= rows;
+        }
+        while (h >= ScreenDriver::PAGE_HEIGHT)
+        {
+            __fill_columns(ptr, w, 0xFF, c);
+            ptr += ScreenDriver::info.width;
+            h -= ScreenDriver::PAGE_HEIGHT;
+        }
+        if (h > 0) // last page, partially covered
+        {
+            __fill_columns(ptr, w, 0xFF >> (ScreenDriver::PAGE_HEIGHT - h), c);
+        }
+    }
+
     template <bool SafeMode = false>
     void Pixel(uint16_t x, uint16_t y, ScreenDriver::Color c = ScreenDriver::COLOR_WHITE)
     {
@@ -11,32 +85,58 @@ namespace Draw
         {
             if (x >= ScreenDriver::info.width || y >= ScreenDriver::info.height) return;
         }
-        ScreenDriver::info.data[y * ScreenDriver::info.width + x] = c;
+        ScreenDriver::MarkDirty(x, y, 1, 1);
+        uint8_t* ptr = &ScreenDriver::info.data[(y / ScreenDriver::PAGE_HEIGHT) * ScreenDriver::info.width + x];
+        uint8_t bit = 1 << (y % ScreenDriver::PAGE_HEIGHT);
+        if (c) *ptr |= bit;
+        else *ptr &= ~bit;
     }
 
     template <bool SafeMode = false>
     void Line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, ScreenDriver::Color c = ScreenDriver::COLOR_WHITE)
     {
+        // horizontal and vertical lines are spans (only when fully visible in safe mode, to keep the per pixel clipping)
+        bool visible = !SafeMode || (std::max(x1, x2) < ScreenDriver::info.width && std::max(y1, y2) < ScreenDriver::info.height);
+        if (visible && y1 == y2)
+        {
+            __fill_area(std::min(x1, x2), y1, std::abs(x2 - x1) + 1, 1, c);
+            return;
+        }
+        if (visible && x1 == x2)
+        {
+            __fill_area(x1, std::min(y1, y2), 1, std::abs(y2 - y1) + 1, c);
+            return;
+        }
+
         int16_t dx = std::abs(x2 - x1);
         int16_t dy = std::abs(y2 - y1);
         
         int16_t sx = (x1 < x2) ? 1 : -1;
-        int32_t sy = (y1 < y2) ? ScreenDriver::info.width : -ScreenDriver::info.width;
+        bool down = y1 < y2;
         
         int16_t err = dx - dy;
 
-        auto* ptr = &ScreenDriver::info.data[y1 * ScreenDriver::info.width + x1];
+        // bounding box of the drawn pixels (clipped to the screen in safe mode)
+        uint16_t min_x = std::min(x1, x2), max_x = std::max(x1, x2);
+        uint16_t min_y = std::min(y1, y2), max_y = std::max(y1, y2);
+        if constexpr (SafeMode)
+        {
+            max_x = std::min<uint16_t>(max_x, ScreenDriver::info.width - 1);
+            max_y = std::min<uint16_t>(max_y, ScreenDriver::info.height - 1);
+        }
+        if (min_x <= max_x && min_y <= max_y) ScreenDriver::MarkDirty(min_x, min_y, max_x - min_x + 1, max_y - min_y + 1);
+
+        // current pixel : bit `mask` of the byte at `ptr`
+        uint8_t* ptr = &ScreenDriver::info.data[(y1 / ScreenDriver::PAGE_HEIGHT) * ScreenDriver::info.width + x1];
+        uint8_t mask = 1 << (y1 % ScreenDriver::PAGE_HEIGHT);
 
         while (true)
         {
-            if constexpr (SafeMode)
+            if (!SafeMode || (x1 < ScreenDriver::info.width && y1 < ScreenDriver::info.height))
             {
-                if (x1 < ScreenDriver::info.width && y1 < ScreenDriver::info.height)
-                {
-                    *ptr = c;
-                }
+                if (c) *ptr |= mask;
+                else *ptr &= ~mask;
             }
-            else *ptr = c;
 
             if (x1 == x2 && y1 == y2) break;
 
@@ -44,13 +144,23 @@ namespace Draw
             
             if (e2 > -dy) { 
                 err -= dy; 
-                x1 += (x1 < x2 ? 1 : -1);
+                x1 += sx;
                 ptr += sx;
             }
             if (e2 < dx) { 
                 err += dx; 
-                y1 += (y1 < y2 ? 1 : -1);
-                ptr += sy;
+                if (down)
+                {
+                    y1++;
+                    mask <<= 1;
+                    if (mask == 0) { mask = 0x01; ptr += ScreenDriver::info.width; }
+                }
+                else
+                {
+                    y1--;
+                    mask >>= 1;
+                    if (mask == 0) { mask = 0x80; ptr -= ScreenDriver::info.width; }
+                }
             }
         }
     }
@@ -109,8 +219,9 @@ namespace Draw
             if (x + l > ScreenDriver::info.width) l = ScreenDriver::info.width - x;
         }
 
-        bool* ptr = &ScreenDriver::info.data[y * ScreenDriver::info.width + x];
-        memset(ptr, c, l);
+        ScreenDriver::MarkDirty(x, y, l, 1);
+        uint8_t* ptr = &ScreenDriver::info.data[(y / ScreenDriver::PAGE_HEIGHT) * ScreenDriver::info.width + x];
+        __fill_columns(ptr, l, 1 << (y % ScreenDriver::PAGE_HEIGHT), c);
     }
 
     template <bool SafeMode = false>
@@ -122,10 +233,7 @@ namespace Draw
             if (y + l > ScreenDriver::info.height) l = ScreenDriver::info.height - y;
         }
 
-        for (uint16_t i = 0; i < l; i++)
-        {
-            ScreenDriver::info.data[(y + i) * ScreenDriver::info.width + x] = c;
-        }
+        __fill_area(x, y, 1, l, c);
     }
 
     template <bool SafeMode = false>
@@ -139,10 +247,7 @@ namespace Draw
             if (w == 0 || h == 0) return;
         }
 
-        for (uint16_t i = 0; i < h; i++)
-        {
-            Hline(x, y + i, w, c);
-        }
+        __fill_area(x, y, w, h, c);
     }
 
     template <bool SafeMode = false>
@@ -151,9 +256,8 @@ namespace Draw
         if (r > w / 2) r = w / 2;
         if (r > h / 2) r = h / 2;
 
-        for (int16_t i = 0; i < h - 2 * r; i++) {
-            Hline<SafeMode>(x, y + r + i, w, c);
-        }
+        constexpr uint16_t MAX_FAST_RADIUS = 127;
+        bool visible = r <= MAX_FAST_RADIUS && x + w <= ScreenDriver::info.width && y + h <= ScreenDriver::info.height;
 
         int16_t f = 1 - r;
         int16_t ddF_x = 1;
@@ -161,6 +265,47 @@ namespace Draw
         int16_t x_off = 0;
         int16_t y_off = r;
 
+        if (!visible) // clipped : row by row, like the spans below
+        {
+            // straight middle part in one fill
+            uint16_t top = y + r;
+            int32_t rows = h - 2 * r;
+            if constexpr (SafeMode)
+            {
+                if (top + rows > 0x10000) // starts above the screen (negative y) : keep the visible rows
+                {
+                    rows -= 0x10000 - top;
+                    top = 0;
+                }
+            }
+            if (rows > 0) RectFilled<SafeMode>(x, top, w, rows, c);
+
+            while (x_off < y_off)
+            {
+                if (f >= 0)
+                {
+                    y_off--;
+                    ddF_y += 2;
+                    f += ddF_y;
+                }
+                x_off++;
+                ddF_x += 2;
+                f += ddF_x;
+
+                Hline<SafeMode>(x + r - x_off, y + r - y_off, w - 2 * r + 2 * x_off, c);
+                Hline<SafeMode>(x + r - x_off, y + h - r + y_off - 1, w - 2 * r + 2 * x_off, c);
+                Hline<SafeMode>(x + r - y_off, y + r - x_off, w - 2 * r + 2 * y_off, c);
+                Hline<SafeMode>(x + r - y_off, y + h - r + x_off - 1, w - 2 * r + 2 * y_off, c);
+            }
+            return;
+        }
+        if (w == 0 || h == 0) return;
+
+        // same rows as above, but painted as columns : first column of each of the top r rows (bottom ones are symmetric)
+        uint8_t row_start[MAX_FAST_RADIUS + 1];
+        memset(row_start, 0xFF, r);
+        row_start[r] = h > 2 * r ? 0 : 0xFF; // middle part
+        auto top_row = [h](uint16_t row) -> uint16_t { return row < h - 1 - row ? row : h - 1 - row; }; // spans are mirrored
         while (x_off < y_off)
         {
             if (f >= 0)
@@ -173,26 +318,67 @@ namespace Draw
             ddF_x += 2;
             f += ddF_x;
 
-            Hline<SafeMode>(x + r - x_off, y + r - y_off, w - 2 * r + 2 * x_off, c);
-            Hline<SafeMode>(x + r - x_off, y + h - r + y_off - 1, w - 2 * r + 2 * x_off, c);
-            Hline<SafeMode>(x + r - y_off, y + r - x_off, w - 2 * r + 2 * y_off, c);
-            Hline<SafeMode>(x + r - y_off, y + h - r + x_off - 1, w - 2 * r + 2 * y_off, c);
+            uint8_t& first = row_start[top_row(r - y_off)];
+            if (first > r - x_off) first = r - x_off;
+            uint8_t& second = row_start[top_row(r - x_off)];
+            if (second > r - y_off) second = r - y_off;
+        }
+
+        // each column goes from the first row reaching it to its mirror, the full height ones in one fill
+        uint16_t top = r;
+        for (uint16_t column = 0; 2 * column < w; column++)
+        {
+            while (top > 0 && row_start[top - 1] <= column) top--;
+            if (top == 0)
+            {
+                __fill_area(x + column, y, w - 2 * column, h, c);
+                break;
+            }
+            __fill_area(x + column, y + top, 1, h - 2 * top, c);
+            __fill_area(x + w - 1 - column, y + top, 1, h - 2 * top, c);
         }
     }
 
     template <bool SafeMode = false>
     void CircleFilled(uint16_t x0, uint16_t y0, uint16_t r, ScreenDriver::Color c = ScreenDriver::COLOR_WHITE)
     {
+        constexpr uint16_t MAX_FAST_RADIUS = 127;
+        bool visible = r <= MAX_FAST_RADIUS && x0 >= r && y0 >= r &&
+                       x0 + r < ScreenDriver::info.width && y0 + r < ScreenDriver::info.height;
+
         int16_t x = 0;
         int16_t y = r;
         int16_t d = 3 - 2 * r;
 
+        if (!visible) // clipped : row by row, like the spans below
+        {
+            while (y >= x)
+            {
+                Hline<SafeMode>(x0 - y, y0 - x, 2 * y + 1, c);
+                Hline<SafeMode>(x0 - y, y0 + x, 2 * y + 1, c);
+                Hline<SafeMode>(x0 - x, y0 - y, 2 * x + 1, c);
+                Hline<SafeMode>(x0 - x, y0 + y, 2 * x + 1, c);
+
+                x++;
+                if (d > 0)
+                {
+                    y--;
+                    d = d + 4 * (x - y) + 10;
+                }
+                else
+                {
+                    d = d + 4 * x + 6;
+                }
+            }
+            return;
+        }
+
+        // same rows as above, but painted as columns : a column is a few page fills, a row touches a byte per pixel
+        uint8_t half_width[MAX_FAST_RADIUS + 1] = {0}; // half width of the row at each distance from the center
         while (y >= x)
         {
-            Hline<SafeMode>(x0 - y, y0 - x, 2 * y + 1, c);
-            Hline<SafeMode>(x0 - y, y0 + x, 2 * y + 1, c);
-            Hline<SafeMode>(x0 - x, y0 - y, 2 * x + 1, c);
-            Hline<SafeMode>(x0 - x, y0 + y, 2 * x + 1, c);
+            if (half_width[x] < y) half_width[x] = y;
+            if (half_width[y] < x) half_width[y] = x;
 
             x++;
             if (d > 0)
@@ -205,6 +391,18 @@ namespace Draw
                 d = d + 4 * x + 6;
             }
         }
+
+        // half height of each column : the farthest row reaching it
+        int16_t covered = -1;
+        for (int16_t row = r; row >= 0; row--)
+        {
+            while (covered < half_width[row])
+            {
+                covered++;
+                __fill_area(x0 - covered, y0 - row, 1, 2 * row + 1, c);
+                if (covered != 0) __fill_area(x0 + covered, y0 - row, 1, 2 * row + 1, c);
+            }
+        }
     }
 
     template <bool SafeMode = false>
@@ -286,54 +484,294 @@ namespace Draw
         }
     }
 
+    /**
+     * @brief Paint a page-packed bitmap through a mask : pixels set in `mask` take the value of the same bit in
+     *        `value`, the others are left untouched.
+     * @param value Pixels of the bitmap, `w` columns by (h + 7) / 8 pages in the screen buffer format (bit 0 on top).
+     * @param mask Pixels of the bitmap to paint, same format (nullptr to paint all of them, `value` to only paint the
+     *             white ones).
+     * @note In safe mode the bitmap can be partly (or fully) outside of the screen, on any side.
+     */
     template <bool SafeMode = false>
-    void Text(uint16_t x, uint16_t y, char* text, ScreenDriver::Color color = ScreenDriver::COLOR_WHITE, bool transparent_bg = false)
+    void BlitMasked(int16_t x, int16_t y, uint16_t w, uint16_t h, const uint8_t* value, const uint8_t* mask = nullptr)
     {
-        uint16_t x_coord = x;
-        while (*text)
+        uint16_t first_column = 0;
+        uint16_t end_column = w;
+        int16_t first_row = y;
+        int16_t end_row = y + h;
+        if constexpr (SafeMode)
         {
-            uint8_t c = *text++;
-
+            if (x < 0) first_column = -x;
+            if (x + w > ScreenDriver::info.width) end_column = ScreenDriver::info.width - x;
+            if (first_row < 0) first_row = 0;
+            if (end_row > ScreenDriver::info.height) end_row = ScreenDriver::info.height;
+            if (x >= ScreenDriver::info.width || first_column >= end_column || first_row >= end_row) return;
+        }
+        uint16_t columns = end_column - first_column;
+        ScreenDriver::MarkDirty(x + first_column, first_row, columns, end_row - first_row);
+
+        // each screen page takes the bottom of a bitmap page and the top of the next one (only the latter when aligned)
+        static const uint8_t no_page[SCREEN_WIDTH] = {0};
+        const bool opaque = mask == nullptr;
+        const int16_t screen_pages = ScreenDriver::info.height / ScreenDriver::PAGE_HEIGHT;
+        const int16_t y_page = y >= 0 ? y / ScreenDriver::PAGE_HEIGHT : (y - ScreenDriver::PAGE_HEIGHT + 1) / ScreenDriver::PAGE_HEIGHT;
+        const uint16_t shift = y - y_page * ScreenDriver::PAGE_HEIGHT;
+        const uint16_t pages = (h + ScreenDriver::PAGE_HEIGHT - 1) / ScreenDriver::PAGE_HEIGHT;
+        for (uint16_t page = 0; page < pages + (shift != 0); page++)
+        {
+            int16_t screen_page = y_page + page;
             if constexpr (SafeMode)
             {
-                for (uint16_t j = 0; j < 8; j++) {
-                    for (uint16_t k = 0; k < 8; k++) {
-                        bool active = (screen_font[c][j] & (1 << k));
-                        Pixel<true>(x_coord + k, y + j, active ? color : !color);
-                    }
-                }
+                if (screen_page < 0) continue;
+                if (screen_page >= screen_pages) break;
             }
-            else 
+            bool has_top = page < pages;
+            bool has_bottom = page > 0 && shift != 0;
+            const uint8_t* top_value = has_top ? &value[page * w + first_column] : no_page;
+            const uint8_t* bottom_value = has_bottom ? &value[(page - 1) * w + first_column] : no_page;
+            const uint8_t* top_mask = has_top && !opaque ? &mask[page * w + first_column] : no_page;
+            const uint8_t* bottom_mask = has_bottom && !opaque ? &mask[(page - 1) * w + first_column] : no_page;
+
+            // rows of the bitmap in this screen page (all of them painted when opaque)
+            int16_t page_top = screen_page * ScreenDriver::PAGE_HEIGHT;
+            int16_t from = std::max<int16_t>(y - page_top, 0);
+            int16_t to = std::min<int16_t>(y + h - page_top, ScreenDriver::PAGE_HEIGHT);
+            const uint8_t rows = (0xFF << from) & (0xFF >> (ScreenDriver::PAGE_HEIGHT - to));
+
+            uint8_t* ptr = &ScreenDriver::info.data[screen_page * ScreenDriver::info.width + x + first_column];
+            auto paint = [&](uint16_t i) {
+                uint8_t m = opaque ? rows : (top_mask[i] << shift) | (bottom_mask[i] >> (ScreenDriver::PAGE_HEIGHT - shift));
+                uint8_t v = (top_value[i] << shift) | (bottom_value[i] >> (ScreenDriver::PAGE_HEIGHT - shift));
+                ptr[i] = (ptr[i] & ~m) | (v & m);
+            };
+            uint16_t i = 0;
+            for (; i < columns && (reinterpret_cast<uintptr_t>(ptr + i) & 3) != 0; i++) paint(i); // up to a word boundary
+
+            // same as paint(), 4 columns at a time : shifted bits crossing into the next byte are masked off
+            const uint32_t top_lanes = static_cast<uint8_t>(0xFF << shift) * 0x01010101u;
+            const uint32_t bottom_lanes = (0xFF >> (ScreenDriver::PAGE_HEIGHT - shift)) * 0x01010101u;
+            const uint32_t wide_rows = rows * 0x01010101u;
+            auto load = [](const uint8_t* p) { uint32_t word; memcpy(&word, p, 4); return word; };
+            for (; i + 4 <= columns; i += 4)
             {
-                auto* draw_ptr = &ScreenDriver::info.data[y * ScreenDriver::info.width + x_coord];
+                uint32_t m = opaque ? wide_rows : ((load(top_mask + i) << shift) & top_lanes) |
+                                                  ((load(bottom_mask + i) >> (ScreenDriver::PAGE_HEIGHT - shift)) & bottom_lanes);
+                uint32_t v = ((load(top_value + i) << shift) & top_lanes) |
+                             ((load(bottom_value + i) >> (ScreenDriver::PAGE_HEIGHT - shift)) & bottom_lanes);
+                uint32_t word = (load(ptr + i) & ~m) | (v & m);
+                memcpy(ptr + i, &word, 4);
+            }
+            for (; i < columns; i++) paint(i);
+        }
+    }
 
-                for (uint16_t j = 0; j < 8; j++)
-                {
-                    uint8_t row_bits = screen_font[c][j];
-                    for (uint16_t k = 0; k < 8; k++) 
-                    {
-                        if (!transparent_bg || (row_bits & 1)) {
-                            draw_ptr[k] = (row_bits & 1) ? color : !color;
-                        }
-                        row_bits >>= 1;
-                    }
-                    draw_ptr += ScreenDriver::info.width;
-                }
+    /**
+     * @brief Paint one page of text columns (bit 0 on top) : `right_shift` moves the glyphs up, `left_shift` down,
+     *        `rows` are the rows of the page they cover.
+     * @note Same as BlitMasked() with a color, 4 columns (one word) at a time.
+     */
+    inline void __text_page(uint8_t* ptr, const uint8_t* columns, uint16_t count, uint8_t left_shift, uint8_t right_shift,
+                            uint8_t rows, ScreenDriver::Color color, bool transparent_bg)
+    {
+        auto paint = [&](uint16_t i) {
+            uint8_t bits = static_cast<uint8_t>(columns[i] << left_shift) >> right_shift;
+            uint8_t painted = transparent_bg ? bits : rows; // pixels to write
+            uint8_t value = color ? bits : ~bits;
+            ptr[i] = (ptr[i] & ~painted) | (value & painted);
+        };
+        uint16_t i = 0;
+        for (; i < count && (reinterpret_cast<uintptr_t>(ptr + i) & 3) != 0; i++) paint(i); // up to a word boundary
+
+        // shifted bits crossing into the next byte are out of `rows`
+        const uint32_t wide_rows = rows * 0x01010101u;
+        for (; i + 4 <= count; i += 4)
+        {
+            uint32_t word;
+            memcpy(&word, columns + i, 4);
+            uint32_t bits = ((word << left_shift) >> right_shift) & wide_rows;
+            uint32_t painted = transparent_bg ? bits : wide_rows;
+            uint32_t value = color ? bits : ~bits;
+            memcpy(&word, ptr + i, 4);
+            word = (word & ~painted) | (value & painted);
+            memcpy(ptr + i, &word, 4);
+        }
+        for (; i < count; i++) paint(i);
+    }
+
+    /**
+     * @brief Paint `count` text columns at (x, y), only those in [clip_left, clip_right) and on the screen width.
+     * @note In safe mode, the rows above and below the screen are also skipped.
+     */
+    template <bool SafeMode = false>
+    void __text_columns(int32_t x, int32_t y, const uint8_t* columns, int32_t count, ScreenDriver::Color color,
+                        bool transparent_bg, int32_t clip_left = 0, int32_t clip_right = INT32_MAX)
+    {
+        if constexpr (SafeMode)
+        {
+            if (y <= -Font::HEIGHT || y >= ScreenDriver::info.height) return;
+        }
+        clip_left = std::max<int32_t>(clip_left, 0);
+        clip_right = std::min<int32_t>(clip_right, ScreenDriver::info.width);
+        int32_t first = std::max<int32_t>(clip_left - x, 0);
+        int32_t end = std::min<int32_t>(clip_right - x, count);
+        if (first >= end) return;
+        columns += first;
+        x += first;
+        count = end - first;
+
+        int32_t top = y, bottom = y + Font::HEIGHT;
+        if constexpr (SafeMode)
+        {
+            top = std::max<int32_t>(top, 0);
+            bottom = std::min<int32_t>(bottom, ScreenDriver::info.height);
+        }
+        ScreenDriver::MarkDirty(x, top, count, bottom - top);
+
+        // the text covers one page, or the bottom of a page and the top of the next one
+        const int32_t page = y >= 0 ? y / ScreenDriver::PAGE_HEIGHT : -1;
+        const uint16_t shift = y - page * ScreenDriver::PAGE_HEIGHT;
+        uint8_t* column_ptr = &ScreenDriver::info.data[x];
+        if (page >= 0)
+        {
+            __text_page(column_ptr + page * ScreenDriver::info.width, columns, count, shift, 0, 0xFF << shift, color,
+                        transparent_bg);
+        }
+        if (shift == 0) return;
+        if constexpr (SafeMode)
+        {
+            if (page + 1 >= ScreenDriver::info.height / ScreenDriver::PAGE_HEIGHT) return;
+        }
+        __text_page(column_ptr + (page + 1) * ScreenDriver::info.width, columns, count, 0,
+                    ScreenDriver::PAGE_HEIGHT - shift, 0xFF >> (ScreenDriver::PAGE_HEIGHT - shift), color, transparent_bg);
+    }
+
+    /**
+     * @brief Paint a line of text starting at column x, from its raster when it is cached, else glyph by glyph.
+     */
+    template <bool SafeMode = false>
+    void __text_line(int32_t x, int32_t y, const char* text, const TextCache::Raster* raster, ScreenDriver::Color color,
+                     bool transparent_bg, const Font& font, int32_t clip_left, int32_t clip_right)
+    {
+        if (raster != nullptr)
+        {
+            __text_columns<SafeMode>(x, y, raster->columns, raster->width, color, transparent_bg, clip_left, clip_right);
+            return;
+        }
+        static const uint8_t blank[8] = {0};
+        for (; *text && x < clip_right; text++)
+        {
+            uint8_t width;
+            const uint8_t* glyph = font.glyph(*text, width);
+            if (x + width > clip_left)
+            {
+                __text_columns<SafeMode>(x, y, glyph, width, color, transparent_bg, clip_left, clip_right);
+            }
+            if (!transparent_bg && text[1] != '\0') // spacing, like in a raster
+            {
+                __text_columns<SafeMode>(x + width, y, blank, font.spacing, color, false, clip_left, clip_right);
             }
+            x += width + font.spacing;
+        }
+    }
 
-            x_coord += 8;
-            if (x_coord >= ScreenDriver::info.width)
+    /**
+     * @brief Cache of the strings drawn by Text() and TextScroll().
+     */
+    TextCache& GetTextCache();
+
+    /**
+     * @brief Draw a string. When the next glyph would start past the right edge of the screen, the text goes on at x,
+     *        `font.line_height` rows lower.
+     * @param transparent_bg Only paint the pixels of the glyphs (else the background of the glyphs is painted too).
+     * @note The glyphs are painted as columns of a page, the string is rasterized once and kept in GetTextCache().
+     */
+    template <bool SafeMode = false>
+    void Text(uint16_t x, uint16_t y, const char* text, ScreenDriver::Color color = ScreenDriver::COLOR_WHITE,
+              bool transparent_bg = false, const Font& font = Fonts::Basic)
+    {
+        const TextCache::Raster* raster = GetTextCache().get(text, font);
+
+        // coordinates are signed : a title sliding out on the left keeps its end on screen
+        const int32_t x_start = static_cast<int16_t>(x);
+        int32_t x_coord = x_start;
+        int32_t y_coord = static_cast<int16_t>(y);
+        const char* line_text = text;
+        uint16_t line_column = 0, line_end = 0, column = 0; // raster columns
+        uint8_t line[SCREEN_WIDTH + 2 * 8 + 2]; // a line that isn't cached (it starts on screen, ends one glyph past it)
+        for (const char* c = text; *c; c++)
+        {
+            uint8_t width;
+            font.glyph(*c, width);
+            line_end = column + width;
+            column += width + font.spacing;
+            x_coord += width + font.spacing;
+            // compared as unsigned like the previous renderer : far on the left, each glyph goes to a line of its own
+            if (static_cast<uint16_t>(x_coord) < ScreenDriver::info.width && c[1] != '\0') continue;
+
+            if (raster != nullptr)
             {
-                x_coord = x;
-                y += 8+2; // 8 for font height + 2 for line spacing
+                __text_columns<SafeMode>(x_start, y_coord, raster->columns + line_column, line_end - line_column, color,
+                                         transparent_bg);
             }
+            else if (uint16_t count = TextCache::Rasterize(line_text, c + 1 - line_text, font, line, sizeof(line)))
+            {
+                __text_columns<SafeMode>(x_start, y_coord, line, count, color, transparent_bg);
+            }
+            else
+            {
+                __text_line<SafeMode>(x_start, y_coord, line_text, nullptr, color, transparent_bg, font, 0, INT32_MAX);
+            }
+            line_column = column;
+            line_text = c + 1;
+            x_coord = x_start;
+            y_coord += font.line_height;
         }
     }
+
+    template <bool SafeMode = false>
+    void Text(uint16_t x, uint16_t y, char* text, ScreenDriver::Color color = ScreenDriver::COLOR_WHITE,
+              bool transparent_bg = false, const Font& font = Fonts::Basic)
+    {
+        Text<SafeMode>(x, y, const_cast<const char*>(text), color, transparent_bg, font);
+    }
+
+    /**
+     * @brief Width of a string drawn on one line, in columns.
+     */
+    uint16_t GetTextWidth(const char* text, const Font& font = Fonts::Basic);
+
+    /**
+     * @brief Draw one line of text in a window of `w` columns, scrolled to the left by `offset` columns. The text
+     *        loops, TEXT_SCROLL_GAP blank columns after its end. A text fitting in the window doesn't scroll.
+     * @param offset Columns scrolled since the start (grow it by one per frame for instance).
+     */
     template <bool SafeMode = false>
-    void Text(uint16_t x, uint16_t y, const char* text, ScreenDriver::Color color = ScreenDriver::COLOR_WHITE, bool transparent_bg = false)
+    void TextScroll(uint16_t x, uint16_t y, uint16_t w, const char* text, uint32_t offset,
+                    ScreenDriver::Color color = ScreenDriver::COLOR_WHITE, bool transparent_bg = false,
+                    const Font& font = Fonts::Basic)
     {
-        Text<SafeMode>(x, y, (char*) text, color, transparent_bg);
+        const TextCache::Raster* raster = GetTextCache().get(text, font);
+        const int32_t right = x + w;
+        const uint16_t width = raster != nullptr ? raster->width : GetTextWidth(text, font);
+        if (width <= w)
+        {
+            __text_line<SafeMode>(x, y, text, raster, color, transparent_bg, font, x, right);
+            return;
+        }
+
+        // the gap isn't covered by any glyph : paint the background of the whole window first
+        if (!transparent_bg)
+        {
+            int32_t end = std::min<int32_t>(right, ScreenDriver::info.width);
+            uint16_t rows = SafeMode ? std::min<int32_t>(Font::HEIGHT, std::max<int32_t>(ScreenDriver::info.height - y, 0))
+                                     : Font::HEIGHT;
+            if (end > x) __fill_area(x, y, end - x, rows, !color);
+        }
+        const uint32_t period = width + TEXT_SCROLL_GAP;
+        for (int32_t start = x - static_cast<int32_t>(offset % period); start < right; start += period)
+        {
+            __text_line<SafeMode>(start, y, text, raster, color, true, font, x, right);
+        }
     }
 
-    uint16_t GetTextWidth(const char* text);
 }
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+#include "ui/SpriteCache.hpp"
+
+struct FaceEyesInfo
+{
+    // Eyes look X direction, range [-1.0 (right), 1.0 (left)]
+    float look_x;
+    // Eyes look Y direction, range [-1.0 (down), 1.0 (up)]
+    float look_y;
+    // Skew of the eyes, range [-1.0 (left above right), 1.0 (right above left)]
+    float skew;
+    // Size multiplier for the eyes, 1.0 is default size
+    float size;
+    // Left eye open ratio, 1.0 is fully open, 0.0 is fully closed
+    float open_left;
+    // Right eye open ratio, 1.0 is fully open, 0.0 is fully closed
+    float open_right;
+    // Left eye top inner lid ratio, 1.0 is fully covering the eye, 0.0 is not covering at all
+    float lid_in_left;
+    // Right eye top inner lid ratio, 1.0 is fully covering the eye, 0.0 is not covering at all
+    float lid_in_right;
+    // Left eye top outer lid ratio, 1.0 is fully covering the eye, 0.0 is not covering at all
+    float lid_out_left;
+    // Right eye top outer lid ratio, 1.0 is fully covering the eye, 0.0 is not covering at all
+    float lid_out_right;
+    // Left eye bottom lid ratio, 1.0 is fully covering the eye, 0.0 is not covering at all
+    float lid_bottom_left;
+    // Right eye bottom lid ratio, 1.0 is fully covering the eye, 0.0 is not covering at all
+    float lid_bottom_right;
+};
+
+/**
+ * Procedural eyes of the Face menu : a rounded rectangle per eye, cut by up to three triangular lids.
+ * Each eye shape (size, opening and lids, in pixels) is rasterized once in a SpriteCache and then blitted wherever the
+ * eye looks, the screen gets the same pixels as drawing the primitives directly.
+ */
+namespace FaceEyes
+{
+    /**
+     * @brief Draw both eyes in the screen buffer.
+     * @param eyes_info Eyes to draw.
+     */
+    void Render(const FaceEyesInfo& eyes_info);
+
+    /**
+     * @brief Enable or disable the sprite cache (the eyes are drawn with the primitives every frame when disabled).
+     * @note Enabled by default. The cache memory is allocated at the first cached draw, and freed when disabling it.
+     */
+    void SetCacheEnabled(bool enabled);
+
+    /**
+     * @brief Get the statistics of the eyes sprite cache.
+     */
+    SpriteCache::Stats GetCacheStats();
+
+    /**
+     * @brief Clear the hits, misses, evictions and failures counters of the eyes sprite cache.
+     */
+    void ResetCacheStats();
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Bitmap font, 8 rows high, glyphs stored as panel columns (one byte per column, bit 0 on top) so a glyph
+ *        is painted like any page-packed bitmap, without transposing it.
+ * @note Fixed width fonts only give `fixed_width`, variable width ones pack their glyphs one after the other and
+ *       give the first column (`offsets`) and width (`widths`) of each of them.
+ */
+struct Font
+{
+    /** Height of every glyph, in rows (one screen page) */
+    constexpr static uint8_t HEIGHT = 8;
+
+    uint8_t first;          // code of the first glyph
+    uint8_t count;          // number of glyphs, codes outside of them use the first one
+    uint8_t fixed_width;    // width of every glyph, 0 for a variable width font
+    uint8_t spacing;        // blank columns between two glyphs
+    uint8_t line_height;    // rows from a line to the next one
+    const uint8_t* columns;
+    const uint16_t* offsets;
+    const uint8_t* widths;
+
+    /**
+     * @brief Get the columns of a glyph.
+     * @param width Receives the width of the glyph, in columns.
+     */
+    const uint8_t* glyph(char c, uint8_t& width) const
+    {
+        uint8_t code = static_cast<uint8_t>(c);
+        uint8_t index = (code >= first && code - first < count) ? code - first : 0;
+        if (fixed_width != 0)
+        {
+            width = fixed_width;
+            return &columns[index * fixed_width];
+        }
+        width = widths[index];
+        return &columns[offsets[index]];
+    }
+
+    /**
+     * @brief Columns taken by a glyph and the spacing after it.
+     */
+    uint16_t advance(char c) const
+    {
+        uint8_t width;
+        glyph(c, width);
+        return width + spacing;
+    }
+};
+
+namespace Fonts
+{
+    /** font8x8_basic : 8 columns per glyph, the default font of Draw::Text() */
+    extern const Font Basic;
+
+    /** font8x8_basic with the blank columns around each glyph removed, 1 column between glyphs (3 for a space) */
+    extern const Font Narrow;
+}
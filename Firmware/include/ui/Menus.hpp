@@ -1,5 +1,6 @@
 #pragma once
 #include "common/utils.hpp"
+#include "ui/ButtonDebouncer.hpp"
 
 namespace Menus
 {
@@ -35,6 +36,8 @@ namespace Menus
         void update();
         /// @brief Call action for when this menu should be rendered. @note render flag check is already made inside the function.
         void render();
+        /// @brief Tells if the menus task has to run this menu at the next cycle (pending render, title animation or a non idle menu)
+        bool needsUpdate();
 
         const char* getTitle();
         const uint8_t* getIcon();
@@ -86,6 +89,11 @@ namespace Menus
         virtual void onUpdate() = 0;
         /// @brief "on render" action callback. This function is called after onUpdate() if triggerRender() function was called.
         virtual void onRender() = 0;
+        /**
+         * @brief Tells if onUpdate() has nothing to do until the next button event or Menus::Wake() call.
+         * @note The menus task sleeps instead of running the cycles of an idle menu. Default : never idle.
+         */
+        virtual bool isIdle();
 
     private:
         bool m_need_render = true;
@@ -94,8 +102,49 @@ namespace Menus
 
     /// MENUS NAMESPACE FUNCTIONS
 
+    /**
+     * Counters of the menus task
+     * - `wakeups`: times the task woke up (button edge, deadline, Wake() or frame)
+     * - `cycles`: menu cycles run (Update())
+     * - `inputs`: button events handled
+     * - `input_latency_max_us`: longest time from a button edge to the end of its handling
+     * - `input_latency_last_us`: same for the last button event
+     */
+    typedef struct Stats
+    {
+        uint32_t wakeups;
+        uint32_t cycles;
+        uint32_t inputs;
+        uint32_t input_latency_max_us;
+        uint32_t input_latency_last_us;
+    } Stats;
+
+    /**
+     * @brief Start the menus task and the button input.
+     * @note The task sleeps until a button edge, a debounce / long press deadline, a Wake() call or the next frame of
+     *       a menu that isn't idle (every SCREEN_REFRESH_RATE ms).
+     */
     Status Init();
 
+    /**
+     * @brief Run one cycle of the current menu : update, then render if needed.
+     * @note Called by the menus task, and by the host menu emulator.
+     */
+    void Update();
+
+    /**
+     * @brief Give a debounced button event to the current menu (click : next / prev, long press : select / back).
+     */
+    void HandleInput(uint8_t button, ButtonDebouncer::Event event);
+
+    /**
+     * @brief Run a menu cycle as soon as possible, for data shown by an idle menu that changed.
+     * @note Can be called from any task.
+     */
+    void Wake();
+
+    Stats GetStats();
+
     Menu* GetCurrentMenu();
 
     void SetCurrentMenu(Menu* menu);
@@ -0,0 +1,141 @@
+#pragma once
+#include "common/utils.hpp"
+#include "drivers/ScreenDriver.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Cache of pre-rasterized 1bpp sprites, kept in PSRAM under a memory budget (least recently used ones go first).
+ * @note A sprite is drawn once with the Draw primitives, in a canvas of its own size, then painted at any position with
+ *       Draw::BlitMasked(). Shapes are cached by a key describing everything they depend on, the caller builds it.
+ *       Not thread safe : a cache belongs to the task drawing the screen.
+ */
+class SpriteCache
+{
+public:
+    /** Maximum size of a key, in bytes */
+    constexpr static size_t MAX_KEY_SIZE = 32;
+
+    /**
+     * A cached sprite, `width` columns by `pages` pages of ScreenDriver::PAGE_HEIGHT rows
+     * - `value`: pixels, in the screen buffer format
+     * - `mask`: pixels drawn when the sprite was rasterized (the others are transparent)
+     */
+    struct Sprite
+    {
+        uint16_t width;
+        uint16_t height;
+        uint16_t pages;
+        uint8_t* value;
+        uint8_t* mask;
+    };
+
+    /**
+     * Usage statistics of the cache
+     * - `hits`: sprites found in the cache
+     * - `misses`: sprites rasterized
+     * - `evictions`: sprites dropped to make room for new ones
+     * - `failures`: sprites that couldn't be cached (bigger than the screen or the budget, out of memory)
+     * - `entries`: number of sprites in the cache
+     * - `bytes`: memory used by the cached sprites
+     */
+    struct Stats
+    {
+        uint32_t hits;
+        uint32_t misses;
+        uint32_t evictions;
+        uint32_t failures;
+        uint32_t entries;
+        uint32_t bytes;
+    };
+
+    SpriteCache() = default;
+    SpriteCache(const SpriteCache&) = delete;
+    SpriteCache& operator=(const SpriteCache&) = delete;
+    ~SpriteCache() { deinit(); }
+
+    /**
+     * @brief Allocate the entries of the cache.
+     * @param budget Memory the sprites can use, in bytes (both planes).
+     * @param max_entries Maximum number of sprites.
+     * @return Status::NoMemory if the entries can't be allocated. Does nothing if already initialized.
+     */
+    Status init(size_t budget, uint16_t max_entries);
+
+    /**
+     * @brief Free every sprite and the entries.
+     */
+    void deinit();
+
+    /**
+     * @brief Drop every sprite (after a change of what the keys describe, for instance).
+     */
+    void clear();
+
+    /**
+     * @brief Get the sprite of a key, rasterizing it on a miss.
+     * @param key Bytes describing the shape (at most MAX_KEY_SIZE, compared as is : clear the padding).
+     * @param width, height Size of the sprite, in pixels (at most the screen size).
+     * @param rasterize Called twice on a miss, with ScreenDriver::info pointing to a blank canvas of the sprite size :
+     *                  `rasterize(false)` draws the shape, `rasterize(true)` draws it again with every color replaced by
+     *                  white (the pixels to paint).
+     * @return The sprite, or nullptr if it can't be cached (the caller draws the shape directly then).
+     */
+    template <typename RasterizeFunction>
+    const Sprite* get(const void* key, size_t key_size, uint16_t width, uint16_t height, RasterizeFunction&& rasterize)
+    {
+        uint32_t hash = hash_key(key, key_size);
+        if (const Sprite* sprite = find(hash, key, key_size)) return sprite;
+
+        Sprite* sprite = insert(hash, key, key_size, width, height);
+        if (sprite == nullptr) return nullptr;
+
+        begin_canvas(*sprite, sprite->value);
+        rasterize(false);
+        begin_canvas(*sprite, sprite->mask);
+        rasterize(true);
+        end_canvas();
+        return sprite;
+    }
+
+    bool isInitialized() const { return entries != nullptr; }
+
+    Stats getStats() const;
+
+    /**
+     * @brief Clear the hits, misses, evictions and failures counters.
+     */
+    void resetStats();
+
+private:
+    struct Entry
+    {
+        Sprite sprite;
+        uint32_t hash;
+        uint32_t last_use; // 0 when the entry is free
+        uint8_t key_size;
+        uint8_t key[MAX_KEY_SIZE];
+    };
+
+    static uint32_t hash_key(const void* key, size_t key_size);
+
+    const Sprite* find(uint32_t hash, const void* key, size_t key_size);
+    Sprite* insert(uint32_t hash, const void* key, size_t key_size, uint16_t width, uint16_t height);
+    void evict(Entry& entry);
+
+    void begin_canvas(const Sprite& sprite, uint8_t* plane);
+    void end_canvas();
+
+    Entry* entries = nullptr;
+    uint16_t max_entries = 0;
+    size_t budget = 0;
+    uint16_t last_hit = 0; // checked first : a shape tends to be drawn several times in a row
+    uint32_t use_clock = 0;
+    Stats stats = {};
+
+    // screen target saved while a sprite is rasterized
+    ScreenDriver::Info saved_info = {};
+    ScreenDriver::DirtySpan* saved_dirty = nullptr;
+    ScreenDriver::DirtySpan canvas_dirty[ScreenDriver::PAGE_COUNT];
+    bool canvas_active = false;
+};
@@ -0,0 +1,87 @@
+#pragma once
+#include "common/config.hpp"
+#include "ui/Font.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Cache of rasterized strings : the glyph columns of a whole line of text, ready to be painted in one go
+ *        (least recently used strings go first).
+ * @note Menus draw the same strings at every render (titles, labels), a hit skips the glyph lookups. Strings longer
+ *       than TEXT_CACHE_MAX_LENGTH aren't cached. Not thread safe : the cache belongs to the task drawing the screen.
+ */
+class TextCache
+{
+public:
+    /** Maximum width of a cached string, in columns (widest glyph and its spacing for every character) */
+    constexpr static uint16_t MAX_COLUMNS = TEXT_CACHE_MAX_LENGTH * (8 + 1);
+
+    /**
+     * A rasterized string, one page high
+     * - `width`: columns of the string, without the spacing after the last glyph
+     * - `columns`: pixels, in the screen buffer format (bit 0 on top)
+     */
+    struct Raster
+    {
+        uint16_t width;
+        uint8_t columns[MAX_COLUMNS];
+    };
+
+    /**
+     * Usage statistics of the cache
+     * - `hits`: strings found in the cache
+     * - `misses`: strings rasterized in the cache
+     * - `evictions`: strings dropped to make room for new ones
+     * - `uncached`: strings too long to be cached
+     * - `entries`: number of strings in the cache
+     */
+    struct Stats
+    {
+        uint32_t hits;
+        uint32_t misses;
+        uint32_t evictions;
+        uint32_t uncached;
+        uint32_t entries;
+    };
+
+    /**
+     * @brief Get the raster of a string, rasterizing it on a miss.
+     * @return The raster, or nullptr if the string is too long to be cached.
+     */
+    const Raster* get(const char* text, const Font& font);
+
+    /**
+     * @brief Drop every string.
+     */
+    void clear();
+
+    Stats getStats() const;
+
+    /**
+     * @brief Clear the hits, misses, evictions and uncached counters.
+     */
+    void resetStats();
+
+    /**
+     * @brief Write the glyph columns of `length` characters, one after the other with the spacing of the font.
+     * @param out Receives the columns (at most `max_columns`).
+     * @return Columns of the string without the spacing after the last glyph, or 0 if it doesn't fit in `max_columns`.
+     */
+    static uint16_t Rasterize(const char* text, size_t length, const Font& font, uint8_t* out, uint16_t max_columns);
+
+private:
+    struct Entry
+    {
+        Raster raster;
+        const Font* font;
+        uint32_t hash;
+        uint32_t last_use; // 0 when the entry is free
+        uint8_t length;
+        char text[TEXT_CACHE_MAX_LENGTH];
+    };
+
+    Entry entries[TEXT_CACHE_ENTRIES] = {};
+    uint8_t last_hit = 0; // checked first : a string tends to be measured, then drawn
+    uint32_t use_clock = 0;
+    Stats stats = {};
+};
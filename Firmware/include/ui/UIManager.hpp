@@ -2,6 +2,7 @@
 #include "common/utils.hpp"
 #include "drivers/CameraDriver.hpp"
 #include "ui/menus/Splash.hpp"
+#include "vision/VisionLoop.hpp"
 
 class UIManager
 {
@@ -23,7 +24,9 @@ public:
     Status deinit();
 
     CameraDriver& getCamera() { return camera; }
+    VisionLoop& getVision() { return vision; }
 
 private:
     CameraDriver camera;
+    VisionLoop vision;
 };
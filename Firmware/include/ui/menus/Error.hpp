@@ -19,6 +19,7 @@ protected:
     virtual void onHide() override;
     virtual void onRender() override;
     virtual void onUpdate() override;
+    virtual bool isIdle() override;
 
 private:
     // ErrorStruct::ErrorStruct error;
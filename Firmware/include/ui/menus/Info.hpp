@@ -18,4 +18,5 @@ protected:
     virtual void onHide() override;
     virtual void onRender() override;
     virtual void onUpdate() override;
+    virtual bool isIdle() override;
 };
\ No newline at end of file
@@ -15,6 +15,9 @@ public:
     void setItems(std::vector<Menu*> items);
 
 protected:
+    /** Distance (in items) under which the selection and view easing jump to their target */
+    constexpr static float ANIMATION_SNAP = 1.0f / 64.0f;
+
     uint8_t m_selected_index = 0;
     uint8_t m_selected_shift = 4;
 
@@ -32,4 +35,5 @@ protected:
     virtual void onHide() override;
     virtual void onRender() override;
     virtual void onUpdate() override;
+    virtual bool isIdle() override;
 };
\ No newline at end of file
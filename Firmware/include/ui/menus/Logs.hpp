@@ -22,4 +22,6 @@ protected:
 private:
     int updateCounter = 0;
     int updateFrequency = 2; // Hz
+    uint32_t scrollOffset = 0; // columns scrolled by the long messages
+    bool scrolling = false; // a message doesn't fit, render every frame
 };
\ No newline at end of file
@@ -20,6 +20,7 @@ protected:
     virtual void onHide() override;
     virtual void onRender() override;
     virtual void onUpdate() override;
+    virtual bool isIdle() override;
 
 private:
     float frequency = 440.0f; // A4 note
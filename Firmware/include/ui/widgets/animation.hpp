@@ -1,5 +1,6 @@
 #pragma once
 #include "common/utils.hpp"
+#include "ui/AnimationCodec.hpp"
 #include "ui/Draw.hpp"
 
 namespace UIWidgets
@@ -8,8 +9,11 @@ namespace UIWidgets
     {
     public:
         Animation() = default;
-        Animation(uint8_t* buffer, uint8_t frameCount, uint8_t x, uint8_t y, uint8_t width, uint8_t height, bool transparent = false, bool loop = true)
-            : buffer(buffer), length(frameCount), x(x), y(y), width(width), height(height), transparent(transparent), loop(loop), index(0) {}
+        /**
+         * @param data Animation in the ui/AnimationCodec.hpp format (not copied).
+         * @param size Size of the animation data, in bytes.
+         */
+        Animation(const uint8_t* data, size_t size, uint8_t x, uint8_t y, bool transparent = false, bool loop = true);
         virtual ~Animation() = default;
 
         void update();
@@ -24,14 +28,14 @@ namespace UIWidgets
         uint8_t getFrameCount() const;
 
     private:
-        uint8_t* buffer = nullptr;
-        uint8_t length = 0;
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        AnimationCodec::Header header = {};
+        AnimationCodec::Decoder decoder; // frame allocated at the first render
         uint8_t x = 0;
         uint8_t y = 0;
-        uint8_t width = 0;
-        uint8_t height = 0;
         bool transparent = false;
         bool loop = true;
         uint8_t index = 0;
     };
-}
\ No newline at end of file
+}
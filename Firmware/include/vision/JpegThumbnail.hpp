@@ -0,0 +1,32 @@
+#pragma once
+#include "common/utils.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Grayscale thumbnails of JPEG frames, at 1/8 of their size, from the DC coefficients only.
+ *
+ * The DC coefficient of a block is its mean, so the luminance blocks give a box filtered 1/8 image without any IDCT :
+ * the entropy coded data is still Huffman decoded (AC coefficients are skipped, not dequantized), which is most of the
+ * cost of a full decode. VGA frames of the camera give 80x60 thumbnails, QVGA ones 40x30.
+ *
+ * Supports baseline and extended Huffman JPEG (SOF0 / SOF1, 8 bits), any sampling factors, restart intervals and
+ * grayscale images, as made by the OV2640 or libjpeg. Progressive and arithmetic coded images are refused.
+ */
+namespace JpegThumbnail
+{
+    /**
+     * @brief Size of the thumbnail of a JPEG image.
+     * @return Status::InvalidParameters if the data isn't a supported JPEG image.
+     */
+    Status GetSize(const uint8_t* jpeg, size_t size, uint16_t& width, uint16_t& height);
+
+    /**
+     * @brief Decode the thumbnail of a JPEG image.
+     * @param out Receives `width` * `height` pixels, row by row.
+     * @param capacity Size of `out` in bytes.
+     * @return Status::InvalidParameters if the data isn't a supported JPEG image (or is cut short), Status::OutOfBounds
+     *         if the thumbnail doesn't fit in `capacity`.
+     */
+    Status Decode(const uint8_t* jpeg, size_t size, uint8_t* out, size_t capacity, uint16_t& width, uint16_t& height);
+}
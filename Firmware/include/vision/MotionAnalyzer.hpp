@@ -0,0 +1,103 @@
+#pragma once
+#include "common/config.hpp"
+#include "common/utils.hpp"
+#include <cstdint>
+
+/**
+ * @brief Motion in a stream of small grayscale frames (JPEG thumbnails, see JpegThumbnail) : global image flow, moving
+ *        objects, and the events the decision loop reacts to.
+ *
+ * Each frame is resampled to a WIDTH x HEIGHT working grid, then compared to the previous one :
+ * - the global flow (the camera moving) is the median of the motion of a few blocks, found by block matching (sum of
+ *   absolute differences over +/-SEARCH pixels, refined to a fraction of pixel). Flat blocks don't vote
+ * - the previous frame, shifted by the global flow and with the mean brightness change removed, is subtracted : the
+ *   pixels changing by more than VISION_MOTION_THRESHOLD are moving objects, giving the motion part and its centroid
+ *
+ * Events (one per frame at most, each type then waits VISION_EVENT_COOLDOWN_MS) :
+ * - Covered : the mean level stays under VISION_DARK_LEVEL for VISION_COVERED_FRAMES frames
+ * - Lifted : the image flows down by VISION_LIFT_FLOW or more for VISION_LIFT_FRAMES frames (camera going up)
+ * - MotionLeft / MotionCenter / MotionRight : the motion part stays between VISION_MOTION_MIN and VISION_MOTION_MAX
+ *   for VISION_MOTION_FRAMES frames, on the side of its centroid
+ *
+ * The flow is given in grid pixels per 1 / VISION_FRAME_RATE, scaled by the time between the frames.
+ * @note Portable (no ESP-IDF call), times are in microseconds from any monotonic clock. Not thread safe.
+ */
+class MotionAnalyzer
+{
+public:
+    constexpr static uint16_t WIDTH = 40;
+    constexpr static uint16_t HEIGHT = 30;
+    /** Block matching : block size and search range, in grid pixels */
+    constexpr static int BLOCK = 8;
+    constexpr static int SEARCH = 3;
+
+    enum class Event : uint8_t
+    {
+        None,
+        MotionLeft,
+        MotionCenter,
+        MotionRight,
+        Lifted,
+        Covered,
+    };
+
+    /**
+     * Analysis of a frame
+     * - `valid`: false for the first frame (or after a size change), nothing to compare it with
+     * - `motion`: part of the image that changed (0 to 1), camera motion compensated
+     * - `x`, `y`: centroid of the changed pixels (-1 to 1, left to right and top to bottom), 0 without motion
+     * - `flow_x`, `flow_y`: global image flow in grid pixels per 1 / VISION_FRAME_RATE (positive to the right and down)
+     * - `flow_blocks`: blocks that voted for the flow (textured enough)
+     * - `brightness`: mean level (0 to 255)
+     * - `event`: event raised by this frame
+     */
+    struct Result
+    {
+        bool valid;
+        float motion;
+        float x;
+        float y;
+        float flow_x;
+        float flow_y;
+        uint8_t flow_blocks;
+        float brightness;
+        Event event;
+    };
+
+    static const char* EventName(Event event);
+
+    /**
+     * @brief Forget the previous frame and the event state.
+     */
+    void reset();
+
+    /**
+     * @brief Analyze a frame.
+     * @param pixels `width` * `height` grayscale pixels, row by row (any size, resampled to the grid).
+     * @param time_us Capture time of the frame.
+     * @return Status::InvalidParameters if the frame is empty.
+     */
+    Status process(const uint8_t* pixels, uint16_t width, uint16_t height, int64_t time_us, Result& result);
+
+private:
+    constexpr static int EVENT_TYPES = 3; // motion, lifted, covered
+
+    uint8_t current[WIDTH * HEIGHT];
+    uint8_t previous[WIDTH * HEIGHT];
+    int16_t delta[WIDTH * HEIGHT]; // frame difference, scratch of difference()
+    int64_t previous_us = 0;
+    bool has_previous = false;
+    uint16_t source_width = 0;
+    uint16_t source_height = 0;
+
+    uint8_t motion_frames = 0;
+    uint8_t lift_frames = 0;
+    uint8_t dark_frames = 0;
+    int64_t last_event_us[EVENT_TYPES] = {};
+    bool event_raised[EVENT_TYPES] = {};
+
+    void resample(const uint8_t* pixels, uint16_t width, uint16_t height);
+    uint8_t flow(float& flow_x, float& flow_y) const;
+    float difference(float shift_x, float shift_y, float& x, float& y);
+    bool cooled(int type, int64_t time_us) const;
+};
@@ -0,0 +1,56 @@
+#pragma once
+#include "common/config.hpp"
+#include "common/utils.hpp"
+#include "drivers/CameraStream.hpp"
+#include "vision/MotionAnalyzer.hpp"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+
+/**
+ * @brief Lightweight vision : the camera frames reduced to JPEG thumbnails (see JpegThumbnail) and analyzed for
+ *        motion (see MotionAnalyzer), at VISION_FRAME_RATE. Events are posted to the decision loop.
+ *
+ * The vision task is a client of the camera stream, like the remote viewers : it takes the same JPEG frames (no
+ * sensor mode change), so the camera captures all the time while it runs.
+ */
+class VisionLoop
+{
+public:
+    constexpr static const char* TAG = "VisionLoop";
+
+    /**
+     * @brief Start the vision task on a camera stream.
+     * @return Status::InvalidState if already running, Status::Failure if the task couldn't start.
+     */
+    Status start(CameraStream& stream);
+
+    /**
+     * @brief Stop the vision task (after the frame being analyzed).
+     */
+    Status stop();
+
+    bool isRunning() const { return running; }
+
+    /**
+     * @brief Analysis of the last frame.
+     */
+    MotionAnalyzer::Result getLastResult() const;
+
+private:
+    CameraStream* stream = nullptr;
+    TaskHandle_t task = nullptr;
+    std::atomic<bool> running = false;
+    MotionAnalyzer analyzer;
+    MotionAnalyzer::Result last_result = {};
+    int64_t next_frame_us = 0;
+    uint8_t thumbnail[VISION_MAX_THUMBNAIL_WIDTH * VISION_MAX_THUMBNAIL_HEIGHT];
+
+    static void vision_task(void* param);
+
+    /**
+     * @brief Stream sink : analyze the frame if one is due.
+     * @return false once stop() was called.
+     */
+    bool analyze(const CameraStream::Frame& frame);
+};
@@ -1,10 +1,12 @@
 #include "Robot.hpp"
 #include "common/Log.hpp"
 #include "common/LED.hpp"
+#include "audio/Tunes.hpp"
 
 Robot* Robot::instance = nullptr;
 
 Robot::Robot()
+    : control_loop(body)
 {
     instance = this;
 }
@@ -87,6 +89,7 @@ Status Robot::start()
 
     // robot is ready ! Turn green (low intensity to avoid using power for nothing)
     LED::SetColor(0, LED::Color(0, 1, 0), 0.1f);
+    audio_manager.play(Tunes::Boot);
 
     // Set the menu to face (face only displays when everything is working)
     Menus::SetCurrentMenu(Menus::GetMenuFace());
@@ -0,0 +1,95 @@
+#include "audio/Adpcm.hpp"
+
+namespace Adpcm
+{
+    static const int16_t STEP_TABLE[89] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+        50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+        337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+        2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+        15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+    };
+
+    static const int8_t INDEX_TABLE[16] = {
+        -1, -1, -1, -1, 2, 4, 6, 8,
+        -1, -1, -1, -1, 2, 4, 6, 8
+    };
+
+    /**
+     * @brief Apply one code to the predictor (shared by the encoder and the decoder, so both stay in sync).
+     */
+    static inline void step(uint8_t code, int32_t& predictor, int32_t& index)
+    {
+        int32_t stepSize = STEP_TABLE[index];
+        // diff = (code + 0.5) * step / 4, computed with shifts like the reference decoder (bit exact)
+        int32_t diff = stepSize >> 3;
+        if (code & 4) diff += stepSize;
+        if (code & 2) diff += stepSize >> 1;
+        if (code & 1) diff += stepSize >> 2;
+        if (code & 8) predictor -= diff;
+        else predictor += diff;
+
+        // branches rather than selects : the predictor rarely saturates, they are well predicted
+        if (predictor > INT16_MAX) predictor = INT16_MAX;
+        else if (predictor < INT16_MIN) predictor = INT16_MIN;
+
+        index += INDEX_TABLE[code];
+        if (index < 0) index = 0;
+        else if (index > 88) index = 88;
+    }
+
+    static inline uint8_t encode(int16_t sample, int32_t& predictor, int32_t& index)
+    {
+        int32_t stepSize = STEP_TABLE[index];
+        int32_t diff = sample - predictor;
+        uint8_t code = 0;
+        if (diff < 0)
+        {
+            code = 8;
+            diff = -diff;
+        }
+        if (diff >= stepSize) { code |= 4; diff -= stepSize; }
+        if (diff >= (stepSize >> 1)) { code |= 2; diff -= stepSize >> 1; }
+        if (diff >= (stepSize >> 2)) { code |= 1; }
+
+        step(code, predictor, index);
+        return code;
+    }
+
+    void EncodeBlock(const int16_t* in, uint8_t* out, size_t blockAlign, uint8_t& blockIndex)
+    {
+        int32_t predictor = in[0];
+        int32_t index = blockIndex > 88 ? 88 : blockIndex;
+
+        out[0] = static_cast<uint8_t>(predictor & 0xFF);
+        out[1] = static_cast<uint8_t>((predictor >> 8) & 0xFF);
+        out[2] = static_cast<uint8_t>(index);
+        out[3] = 0;
+
+        const int16_t* samples = in + 1;
+        for (size_t i = BLOCK_HEADER_SIZE; i < blockAlign; i++)
+        {
+            uint8_t low = encode(*samples++, predictor, index);
+            uint8_t high = encode(*samples++, predictor, index);
+            out[i] = static_cast<uint8_t>(low | (high << 4));
+        }
+
+        blockIndex = static_cast<uint8_t>(index);
+    }
+
+    void DecodeBlock(const uint8_t* in, int16_t* out, size_t blockAlign)
+    {
+        int32_t predictor = static_cast<int16_t>(in[0] | (in[1] << 8));
+        int32_t index = in[2] > 88 ? 88 : in[2];
+
+        *out++ = static_cast<int16_t>(predictor);
+        for (size_t i = BLOCK_HEADER_SIZE; i < blockAlign; i++)
+        {
+            uint8_t byte = in[i];
+            step(byte & 0x0F, predictor, index);
+            *out++ = static_cast<int16_t>(predictor);
+            step(byte >> 4, predictor, index);
+            *out++ = static_cast<int16_t>(predictor);
+        }
+    }
+}
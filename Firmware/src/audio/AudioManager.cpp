@@ -16,11 +16,14 @@ Status AudioManager::init()
         return err;
     }
 
+    initialized = true;
     return Status::Ok;
 }
 
 Status AudioManager::deinit()
 {
+    initialized = false;
+
     if (Status err = mixer.deinit(); err != Status::Ok)
     {
         return err;
@@ -33,3 +36,20 @@ Status AudioManager::deinit()
 
     return Status::Ok;
 }
+
+Status AudioManager::play(const ToneSequence& sequence, float gain)
+{
+    if (!initialized)
+    {
+        return Status::InvalidState;
+    }
+
+    ToneProvider* provider = new ToneProvider(sequence);
+    if (Status err = mixer.addSoundProvider(provider, gain); err != Status::Ok)
+    {
+        delete provider; // mixer full, the sound is dropped
+        return err;
+    }
+
+    return Status::Ok;
+}
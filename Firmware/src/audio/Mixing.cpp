@@ -0,0 +1,134 @@
+#include "audio/Mixing.hpp"
+#include "common/config.hpp"
+#include <cstdint>
+
+#ifdef ESP_PLATFORM
+#include <sdkconfig.h>
+#endif
+
+namespace Mixing
+{
+    constexpr int32_t LIMITER_HEADROOM = INT16_MAX - LIMITER_THRESHOLD;
+
+    // the knee product (headroom x excess) must fit in 32 bits for the loudest possible mix
+    static_assert(static_cast<int64_t>(SPEAKER_NB_AUDIO_PROVIDERS) * 32768 * LIMITER_HEADROOM < INT32_MAX,
+                  "Too many audio providers for the 32 bits limiter");
+
+    int16_t GainToQ15(float gain)
+    {
+        if (gain <= 0.0f) return 0;
+        if (gain >= 1.0f) return Q15_ONE;
+        return static_cast<int16_t>(gain * Q15_ONE + 0.5f);
+    }
+
+#if CONFIG_IDF_TARGET_ESP32S3
+    /**
+     * @brief Accumulate() on the PIE vector unit of the ESP32-S3, 8 samples per iteration.
+     * @param blocks Number of 8 samples blocks (at least one), acc and src being 16 bytes aligned.
+     * @note Samples are scaled by ee.vmul.s16 ((sample * scale) >> SAR, exact in 16 bits), widened to 32 bits by
+     *       interleaving them with their sign mask (ee.vcmp.lt.s16 against zero, then ee.vzip.16 : lane 2n is
+     *       sample n, lane 2n+1 its sign), and added to the accumulator by ee.vadds.s32 (which never saturates here).
+     */
+    static void AccumulateBlocksS3(int32_t* acc, const Speaker::Sample* src, int16_t gain, size_t blocks)
+    {
+        // unity gain is a multiply by 1 without shift, so both cases share the kernel
+        const int16_t scale = gain >= Q15_ONE ? 1 : gain;
+        const uint32_t shift = gain >= Q15_ONE ? 0 : 15;
+        int32_t* acc_out = acc;
+
+        asm volatile(
+            "wsr.sar         %[shift]                 \n"
+            "ee.vldbc.16     q7, %[scale]             \n" // scale in every lane
+            "ee.zero.q       q6                       \n"
+            "1:                                       \n"
+            "ee.vld.128.ip   q0, %[src], 16           \n"
+            "ee.vmul.s16     q0, q0, q7               \n"
+            "ee.vcmp.lt.s16  q1, q0, q6               \n"
+            "ee.vzip.16      q0, q1                   \n" // q0 : samples 0 to 3 in 32 bits, q1 : samples 4 to 7
+            "ee.vld.128.ip   q2, %[acc], 16           \n"
+            "ee.vld.128.ip   q3, %[acc], 16           \n"
+            "ee.vadds.s32    q2, q2, q0               \n"
+            "ee.vadds.s32    q3, q3, q1               \n"
+            "ee.vst.128.ip   q2, %[acc_out], 16       \n"
+            "ee.vst.128.ip   q3, %[acc_out], 16       \n"
+            "addi            %[blocks], %[blocks], -1 \n"
+            "bnez            %[blocks], 1b            \n"
+            : [src] "+r"(src), [acc] "+r"(acc), [acc_out] "+r"(acc_out), [blocks] "+r"(blocks)
+            : [scale] "r"(&scale), [shift] "r"(shift)
+            : "memory");
+    }
+#endif
+
+    void Accumulate(int32_t* __restrict acc, const Speaker::Sample* __restrict src, int16_t gain, size_t count)
+    {
+        size_t start = 0;
+
+#if CONFIG_IDF_TARGET_ESP32S3
+        // whole blocks of 8 samples on the vector unit when the buffers allow it (the SoundMixer ones do), the rest below
+        if (count >= 8 && (reinterpret_cast<uintptr_t>(acc) | reinterpret_cast<uintptr_t>(src)) % 16 == 0)
+        {
+            start = count & ~static_cast<size_t>(7);
+            AccumulateBlocksS3(acc, src, gain, start / 8);
+        }
+#endif
+
+        if (gain >= Q15_ONE)
+        {
+            for (size_t i = start; i < count; i++)
+            {
+                acc[i] += src[i];
+            }
+            return;
+        }
+
+        for (size_t i = start; i < count; i++)
+        {
+            acc[i] += (static_cast<int32_t>(src[i]) * gain) >> 15;
+        }
+    }
+
+    static inline int32_t knee(int32_t level)
+    {
+        int32_t excess = level - LIMITER_THRESHOLD;
+        return LIMITER_THRESHOLD + (LIMITER_HEADROOM * excess) / (excess + LIMITER_HEADROOM);
+    }
+
+    size_t SoftLimit(Speaker::Sample* __restrict out, const int32_t* __restrict acc, size_t count)
+    {
+        // most blocks stay below the threshold : find the peak first, so they only need a plain copy
+        int32_t peak = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            int32_t level = acc[i] < 0 ? -acc[i] : acc[i];
+            peak = level > peak ? level : peak;
+        }
+
+        if (peak <= LIMITER_THRESHOLD)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                out[i] = static_cast<Speaker::Sample>(acc[i]);
+            }
+            return 0;
+        }
+
+        // rare path : only the samples over the threshold go through the knee (and its divide)
+        size_t limited = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            int32_t sample = acc[i];
+            if (sample > LIMITER_THRESHOLD)
+            {
+                sample = knee(sample);
+                limited++;
+            }
+            else if (sample < -LIMITER_THRESHOLD)
+            {
+                sample = -knee(-sample);
+                limited++;
+            }
+            out[i] = static_cast<Speaker::Sample>(sample);
+        }
+        return limited;
+    }
+}
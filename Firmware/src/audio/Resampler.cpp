@@ -0,0 +1,270 @@
+#include "audio/Resampler.hpp"
+#include "common/config.hpp"
+#include "common/Log.hpp"
+#include <cmath>
+#include <memory.h>
+
+/**
+ * Filter design for each quality : taps per phase, Kaiser beta, and cutoff as a fraction of the lowest Nyquist frequency
+ */
+struct QualitySettings
+{
+    uint8_t taps;
+    float beta;
+    float cutoff;
+};
+
+static const QualitySettings QUALITY_SETTINGS[] = {
+    { 8, 4.5f, 0.95f },   // Low
+    { 16, 7.0f, 0.97f },  // Medium
+    { 32, 8.5f, 0.985f }, // High
+};
+
+static double bessel_i0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    for (int k = 1; k < 32; k++)
+    {
+        term *= (x / (2 * k)) * (x / (2 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+static uint32_t gcd(uint32_t a, uint32_t b)
+{
+    while (b != 0)
+    {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+Resampler::~Resampler()
+{
+    deinit();
+}
+
+Status Resampler::init(uint32_t inputRateHz, uint32_t outputRateHz, Quality quality)
+{
+    if (inputRateHz == 0 || outputRateHz == 0)
+    {
+        return Status::InvalidParameters;
+    }
+    deinit();
+
+    // reduce the ratio, or find the closest one with at most MAX_PHASES phases
+    uint32_t divisor = gcd(inputRateHz, outputRateHz);
+    uint32_t l = outputRateHz / divisor, m = inputRateHz / divisor;
+    double requested = static_cast<double>(outputRateHz) / inputRateHz;
+    if (l > MAX_PHASES || m > 0xFFFF)
+    {
+        double best_error = INFINITY;
+        for (uint32_t candidate = 1; candidate <= MAX_PHASES; candidate++)
+        {
+            uint32_t candidate_down = static_cast<uint32_t>(std::lround(candidate / requested));
+            if (candidate_down == 0 || candidate_down > 0xFFFF) continue;
+            double error = std::fabs(static_cast<double>(candidate) / candidate_down / requested - 1.0);
+            if (error < best_error)
+            {
+                best_error = error;
+                l = candidate;
+                m = candidate_down;
+            }
+        }
+    }
+    up = static_cast<uint16_t>(l);
+    down = static_cast<uint16_t>(m);
+    ratioError = static_cast<float>(static_cast<double>(up) / down / requested - 1.0);
+
+    // when decimating, the filter must reach the output Nyquist frequency, narrower : longer windows keep the same transition band
+    const QualitySettings& settings = QUALITY_SETTINGS[static_cast<size_t>(quality)];
+    uint32_t window = down > up ? (static_cast<uint32_t>(settings.taps) * down + up - 1) / up : settings.taps;
+    taps = static_cast<uint8_t>(window < MAX_TAPS ? window : MAX_TAPS);
+    capacity = taps + INPUT_BLOCK;
+    buffer = new Speaker::Sample[capacity];
+    reset();
+
+    if (isPassthrough())
+    {
+        return Status::Ok;
+    }
+
+    // prototype low-pass at the upsampled rate (up * input rate), gain `up` so each phase sums to ~1
+    size_t length = static_cast<size_t>(up) * taps;
+    double cutoff = 0.5 * settings.cutoff / (up > down ? up : down); // normalized to the upsampled rate
+    double center = (length - 1) / 2.0;
+    double i0_beta = bessel_i0(settings.beta);
+    coefficients = new int16_t[length];
+    for (size_t p = 0; p < up; p++)
+    {
+        for (size_t k = 0; k < taps; k++)
+        {
+            // input sample at window index k is multiplied by h[p + (taps - 1 - k) * up]
+            size_t n = p + (taps - 1 - k) * up;
+            double x = n - center;
+            double sinc = x == 0.0 ? 1.0 : std::sin(2.0 * M_PI * cutoff * x) / (2.0 * M_PI * cutoff * x);
+            double ratio = x / (center + 1.0);
+            double window = bessel_i0(settings.beta * std::sqrt(std::max(0.0, 1.0 - ratio * ratio))) / i0_beta;
+            double h = 2.0 * cutoff * sinc * window * up;
+            coefficients[p * taps + k] = static_cast<int16_t>(std::lround(std::max(-2.0, std::min(1.99993896, h)) * 16384.0));
+        }
+    }
+
+    return Status::Ok;
+}
+
+void Resampler::deinit()
+{
+    delete[] coefficients;
+    coefficients = nullptr;
+    delete[] buffer;
+    buffer = nullptr;
+    capacity = 0;
+    up = down = 1;
+}
+
+void Resampler::reset()
+{
+    // start with a window of silence, so the first outputs don't wait for `taps` input samples
+    filled = taps > 0 ? taps - 1 : 0;
+    if (buffer != nullptr) memset(buffer, 0, filled * sizeof(Speaker::Sample));
+    position = 0;
+    phase = 0;
+    sourceEnded = false;
+    flushLeft = 0;
+}
+
+size_t Resampler::produce(Speaker::Sample* out, size_t outCount)
+{
+    size_t produced = 0;
+    const size_t n = taps;
+    while (produced < outCount && position + n <= filled)
+    {
+        const Speaker::Sample* __restrict x = buffer + position;
+        const int16_t* __restrict c = coefficients + static_cast<size_t>(phase) * n;
+        // |sum| stays below 32768 * sum(|c|) < 2^31 : Q14 coefficients of a phase sum (in absolute value) below 4
+        int32_t acc = 0;
+        for (size_t k = 0; k < n; k++)
+        {
+            acc += static_cast<int32_t>(x[k]) * c[k];
+        }
+        acc = (acc + (1 << 13)) >> 14;
+        out[produced++] = static_cast<Speaker::Sample>(acc > INT16_MAX ? INT16_MAX : (acc < INT16_MIN ? INT16_MIN : acc));
+
+        phase += down;
+        if (phase >= up)
+        {
+            position += phase / up;
+            phase = phase % up;
+        }
+    }
+
+    // drop the input samples no window will use anymore
+    if (position > 0)
+    {
+        size_t kept = filled > position ? filled - position : 0;
+        memmove(buffer, buffer + position, kept * sizeof(Speaker::Sample));
+        position = position > filled ? position - filled : 0;
+        filled = kept;
+    }
+    return produced;
+}
+
+size_t Resampler::process(const Speaker::Sample* in, size_t inCount, size_t& consumed, Speaker::Sample* out, size_t outCount)
+{
+    consumed = 0;
+    if (buffer == nullptr)
+    {
+        return 0;
+    }
+    if (isPassthrough())
+    {
+        consumed = inCount < outCount ? inCount : outCount;
+        memcpy(out, in, consumed * sizeof(Speaker::Sample));
+        return consumed;
+    }
+
+    size_t produced = produce(out, outCount);
+    while (produced < outCount && consumed < inCount)
+    {
+        size_t count = capacity - filled;
+        if (count > inCount - consumed) count = inCount - consumed;
+        memcpy(buffer + filled, in + consumed, count * sizeof(Speaker::Sample));
+        filled += count;
+        consumed += count;
+        produced += produce(out + produced, outCount - produced);
+    }
+    return produced;
+}
+
+bool Resampler::provide(SoundProvider& source, Speaker::Sample* out, size_t count)
+{
+    if (buffer == nullptr)
+    {
+        return false;
+    }
+    if (isPassthrough())
+    {
+        return source.provideSamples(out, count);
+    }
+
+    size_t produced = 0;
+    while (true)
+    {
+        produced += produce(out + produced, count - produced);
+        if (produced == count) break;
+
+        size_t space = capacity - filled;
+        if (space > INPUT_BLOCK) space = INPUT_BLOCK;
+        if (!sourceEnded)
+        {
+            if (source.provideSamples(buffer + filled, space))
+            {
+                filled += space;
+                continue;
+            }
+            sourceEnded = true;
+            flushLeft = taps; // let the last input samples go through the filter
+        }
+        if (flushLeft == 0) break;
+
+        size_t zeros = flushLeft < space ? flushLeft : space;
+        memset(buffer + filled, 0, zeros * sizeof(Speaker::Sample));
+        filled += zeros;
+        flushLeft -= zeros;
+    }
+
+    if (produced < count)
+    {
+        memset(out + produced, 0, (count - produced) * sizeof(Speaker::Sample));
+    }
+    return produced > 0;
+}
+
+/** RESAMPLED PROVIDER **/
+
+ResampledProvider::ResampledProvider(SoundProvider* source, uint32_t sourceRateHz, Resampler::Quality quality)
+    : source(source)
+{
+    if (resampler.init(sourceRateHz, SPEAKER_SAMPLE_RATE_HZ, quality) != Status::Ok)
+    {
+        LOG_WARNING(Resampler::TAG, "Invalid source rate %u Hz", (unsigned) sourceRateHz);
+    }
+}
+
+ResampledProvider::~ResampledProvider()
+{
+    delete source;
+}
+
+bool ResampledProvider::provideSamples(Speaker::Sample* buffer, size_t sampleCount)
+{
+    if (source == nullptr)
+    {
+        return false;
+    }
+    return resampler.provide(*source, buffer, sampleCount);
+}
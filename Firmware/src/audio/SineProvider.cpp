@@ -1,25 +1,21 @@
 #include "audio/SineProvider.hpp"
 #include "audio/Speaker.hpp"
 #include "common/config.hpp"
-#include <cmath>
 
 SineProvider::SineProvider()
+    : oscillator(Synth::Waveform::Sine, frequency)
 {
-    phase = 0.0f;
-    phaseIncrement = (2.0f * M_PI * frequency) / static_cast<float>(SPEAKER_SAMPLE_RATE_HZ);
 }
 
 SineProvider::SineProvider(float frequencyHz, float volume)
-    : volume(volume), frequency(frequencyHz)
+    : volume(volume), frequency(frequencyHz), oscillator(Synth::Waveform::Sine, frequencyHz)
 {
-    phase = 0.0f;
-    phaseIncrement = (2.0f * M_PI * frequency) / static_cast<float>(SPEAKER_SAMPLE_RATE_HZ);
 }
 
 void SineProvider::setFrequency(float frequencyHz)
 {
     frequency = frequencyHz;
-    phaseIncrement = (2.0f * M_PI * frequency) / static_cast<float>(SPEAKER_SAMPLE_RATE_HZ);
+    oscillator.setFrequency(frequencyHz);
 }
 
 void SineProvider::setVolume(float volume)
@@ -29,18 +25,10 @@ void SineProvider::setVolume(float volume)
 
 bool SineProvider::provideSamples(Speaker::Sample* buffer, size_t sampleCount)
 {
-    const float amplitude = 20000.0f * volume;
+    float level = 20000.0f * volume;
+    const int16_t amplitude = static_cast<int16_t>(level > 32767.0f ? 32767.0f : (level < 0.0f ? 0.0f : level));
 
-    for (size_t i = 0; i < sampleCount; i++)
-    {
-        buffer[i] = static_cast<Speaker::Sample>(amplitude * std::sin(phase));
-        
-        phase += phaseIncrement;
-        
-        if (phase > 2.0f * M_PI) {
-            phase -= 2.0f * M_PI;
-        }
-    }
+    oscillator.render(buffer, sampleCount, amplitude);
 
     return true;
-}
\ No newline at end of file
+}
@@ -1,25 +1,31 @@
 #include "audio/SoundMixer.hpp"
+#include "audio/Mixing.hpp"
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <esp_timer.h>
 #include <memory.h>
 #include "common/Log.hpp"
 #include "common/Error.hpp"
 #include "audio/Speaker.Error.hpp"
 
-SoundMixer::SoundMixer(Speaker& speaker) : speaker(speaker)
+SoundMixer::SoundMixer(Speaker& speaker)
+    : masterGain(Mixing::GainToQ15(0.05f)), speaker(speaker)
 {
 }
 
 Status SoundMixer::init()
 {
-    std::lock_guard<std::mutex> lock(mixerMutex);
-    for (size_t i = 0; i < SPEAKER_NB_AUDIO_PROVIDERS; i++)
     {
-        providers[i] = nullptr;
+        std::lock_guard<std::mutex> lock(slotsMutex);
+        for (size_t i = 0; i < SPEAKER_NB_AUDIO_PROVIDERS; i++)
+        {
+            slots[i] = Slot();
+        }
+
+        masterGain = Mixing::GainToQ15(0.05f); // default volume
+        running = true; // start running
     }
-    
-    masterVolume = 0.05f; // default volume
-    running = true; // start running
+    resetStats();
 
     BaseType_t ret = xTaskCreatePinnedToCore([](void* pvParams) {
         SoundMixer* mixer = static_cast<SoundMixer*>(pvParams);
@@ -38,15 +44,16 @@ Status SoundMixer::init()
 
 Status SoundMixer::deinit()
 {
-    std::lock_guard<std::mutex> lock(mixerMutex);
+    std::lock_guard<std::mutex> render(renderMutex); // wait for the providers to be done
+    std::lock_guard<std::mutex> lock(slotsMutex);
     running = false; // ask task to stop
     // delete remaining audio providers
     for (size_t i = 0; i < SPEAKER_NB_AUDIO_PROVIDERS; i++)
     {
-        if (providers[i] != nullptr)
+        if (slots[i].provider != nullptr)
         {
-            delete providers[i];
-            providers[i] = nullptr;
+            delete slots[i].provider;
+            slots[i] = Slot();
         }
     }
     return Status::Ok;
@@ -54,23 +61,19 @@ Status SoundMixer::deinit()
 
 void SoundMixer::setVolume(float volume)
 {
-    std::lock_guard<std::mutex> lock(mixerMutex);
-    if (volume < 0.0f)
-        masterVolume = 0.0f;
-    else if (volume > 1.0f)
-        masterVolume = 1.0f;
-    else
-        masterVolume = volume;
+    std::lock_guard<std::mutex> lock(slotsMutex);
+    masterGain = Mixing::GainToQ15(volume);
 }
 
-Status SoundMixer::addSoundProvider(SoundProvider* provider)
+Status SoundMixer::addSoundProvider(SoundProvider* provider, float gain)
 {
-    std::lock_guard<std::mutex> lock(mixerMutex);
+    std::lock_guard<std::mutex> lock(slotsMutex);
     for (size_t i = 0; i < SPEAKER_NB_AUDIO_PROVIDERS; i++)
     {
-        if (providers[i] == nullptr)
+        if (slots[i].provider == nullptr)
         {
-            providers[i] = provider;
+            slots[i].provider = provider;
+            slots[i].gain = Mixing::GainToQ15(gain);
             return Status::Ok;
         }
     }
@@ -78,53 +81,99 @@ Status SoundMixer::addSoundProvider(SoundProvider* provider)
     return Status::NoMemory;
 }
 
-void SoundMixer::__internal_task(void* pvParams)
+Status SoundMixer::setProviderGain(SoundProvider* provider, float gain)
 {
-    while (running)
+    std::lock_guard<std::mutex> lock(slotsMutex);
+    for (size_t i = 0; i < SPEAKER_NB_AUDIO_PROVIDERS; i++)
+    {
+        if (slots[i].provider == provider && provider != nullptr)
+        {
+            slots[i].gain = Mixing::GainToQ15(gain);
+            return Status::Ok;
+        }
+    }
+    return Status::NotFound;
+}
+
+void SoundMixer::mix(Speaker::Sample* buffer, size_t sampleCount)
+{
+    int64_t start_us = esp_timer_get_time();
+
+    if (sampleCount > MIX_BUFFER_SIZE)
+        sampleCount = MIX_BUFFER_SIZE;
+
+    std::lock_guard<std::mutex> render(renderMutex);
+
+    // snapshot of the mix settings, providers render without the list locked
+    Slot active[SPEAKER_NB_AUDIO_PROVIDERS];
+    int16_t master;
     {
-        // empty mix buffer
-        memset(mixBuffer, 0, sizeof(mixBuffer));
+        std::lock_guard<std::mutex> lock(slotsMutex);
+        memcpy(active, slots, sizeof(active));
+        master = masterGain;
+    }
+
+    memset(accBuffer, 0, sampleCount * sizeof(int32_t));
 
-        { // lock source list during processing
-            std::lock_guard<std::mutex> lock(mixerMutex);
+    uint8_t mixed = 0;
+    for (size_t source_idx = 0; source_idx < SPEAKER_NB_AUDIO_PROVIDERS; source_idx++)
+    {
+        SoundProvider* provider = active[source_idx].provider;
+        if (provider == nullptr)
+            continue; // no provider in this slot, skip
 
-            for (int source_idx = 0; source_idx < SPEAKER_NB_AUDIO_PROVIDERS; source_idx++)
+        // ask for samples
+        bool hasSamples = provider->provideSamples(sourceBuffer, sampleCount);
+        if (!hasSamples) // no samples ? CIAO
+        {
             {
-                SoundProvider* provider = providers[source_idx];
-                if (provider == nullptr)
-                    continue; // no provider in this slot, skip
-
-                // ask for samples
-                bool hasSamples = provider->provideSamples(sourceBuffer, MIX_BUFFER_SIZE);
-                if (!hasSamples) // no samples ? CIAO
-                {
-                    // delete provider
-                    delete provider;
-                    providers[source_idx] = nullptr; // mark free
-                    continue;
-                }
-
-                // mix sourceBuffer into mixBuffer
-                for (size_t i = 0; i < MIX_BUFFER_SIZE; i++)
-                {
-                    int32_t mixedSample = static_cast<int32_t>(mixBuffer[i]) + static_cast<int32_t>(sourceBuffer[i]);
-                    // clamp to int16_t range
-                    if (mixedSample > INT16_MAX)
-                        mixedSample = INT16_MAX;
-                    else if (mixedSample < INT16_MIN)
-                        mixedSample = INT16_MIN;
-                    mixBuffer[i] = static_cast<int16_t>(mixedSample);
-                }
+                std::lock_guard<std::mutex> lock(slotsMutex);
+                slots[source_idx] = Slot(); // mark free
             }
+            delete provider;
+            continue;
         }
 
-        // apply master volume
-        for (size_t i = 0; i < MIX_BUFFER_SIZE; i++)
-        {
-            mixBuffer[i] = static_cast<int16_t>(
-                static_cast<float>(mixBuffer[i]) * masterVolume
-            );
-        }
+        int16_t gain = Mixing::MultiplyQ15(active[source_idx].gain, master);
+        if (gain == 0)
+            continue; // silent, but the provider keeps its pace
+
+        Mixing::Accumulate(accBuffer, sourceBuffer, gain, sampleCount);
+        mixed++;
+    }
+
+    size_t limited = Mixing::SoftLimit(buffer, accBuffer, sampleCount);
+
+    uint32_t elapsed_us = static_cast<uint32_t>(esp_timer_get_time() - start_us);
+    std::lock_guard<std::mutex> lock(slotsMutex);
+    stats.buffers++;
+    stats.last_mix_us = elapsed_us;
+    if (elapsed_us > stats.max_mix_us) stats.max_mix_us = elapsed_us;
+    totalMixUs += elapsed_us;
+    stats.avg_mix_us = static_cast<uint32_t>(totalMixUs / stats.buffers);
+    stats.limited_samples += limited;
+    stats.active_providers = mixed;
+}
+
+SoundMixer::Stats SoundMixer::getStats()
+{
+    std::lock_guard<std::mutex> lock(slotsMutex);
+    return stats;
+}
+
+void SoundMixer::resetStats()
+{
+    std::lock_guard<std::mutex> lock(slotsMutex);
+    stats = {};
+    stats.budget_us = static_cast<uint32_t>(MIX_BUFFER_SIZE * 1'000'000ull / SPEAKER_SAMPLE_RATE_HZ);
+    totalMixUs = 0;
+}
+
+void SoundMixer::__internal_task(void* pvParams)
+{
+    while (running)
+    {
+        mix(mixBuffer, MIX_BUFFER_SIZE);
 
         // send to speaker
         speaker.writeSamples(mixBuffer, MIX_BUFFER_SIZE); // blocking to sync to audio rate (DMA magic uwu)
@@ -132,4 +181,4 @@ void SoundMixer::__internal_task(void* pvParams)
 
     // cleanup on exit
     vTaskDelete(nullptr);
-}
\ No newline at end of file
+}
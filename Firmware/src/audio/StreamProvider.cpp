@@ -0,0 +1,314 @@
+#include "audio/StreamProvider.hpp"
+#include "audio/Adpcm.hpp"
+#include "common/Log.hpp"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <esp_timer.h>
+#include <memory.h>
+#include <mutex>
+
+/** LOADER TASK (shared by every stream) **/
+
+struct FillRequest
+{
+    StreamProvider* provider;
+    uint8_t chunk;
+};
+
+static QueueHandle_t loader_queue = nullptr;
+static std::mutex loader_mutex;
+
+static void loader_task(void* pvParams)
+{
+    FillRequest request;
+    while (true)
+    {
+        if (xQueueReceive(loader_queue, &request, portMAX_DELAY) == pdTRUE)
+        {
+            request.provider->__internal_fill(request.chunk);
+        }
+    }
+}
+
+static Status start_loader()
+{
+    std::lock_guard<std::mutex> lock(loader_mutex);
+    if (loader_queue != nullptr) return Status::Ok;
+
+    loader_queue = xQueueCreate(SPEAKER_NB_AUDIO_PROVIDERS * 2, sizeof(FillRequest));
+    if (loader_queue == nullptr)
+    {
+        return Status::NoMemory;
+    }
+
+    // below the mixer priority : a chunk read must never delay a mixed buffer
+    if (xTaskCreatePinnedToCore(loader_task, "StreamLoader", 4096, nullptr, tskIDLE_PRIORITY + 15, nullptr, CORE_BRAIN) != pdPASS)
+    {
+        LOG_ERROR(StreamProvider::TAG, "Failed to create stream loader task");
+        vQueueDelete(loader_queue);
+        loader_queue = nullptr;
+        return Status::Failure;
+    }
+    return Status::Ok;
+}
+
+/** STREAM PROVIDER **/
+
+StreamProvider::StreamProvider()
+{
+}
+
+StreamProvider::~StreamProvider()
+{
+    stopped = true;
+    // a fill may still be queued or running, wait for it before freeing the chunks
+    while (pending.load() != 0)
+    {
+        vTaskDelay(1);
+    }
+    release();
+}
+
+void StreamProvider::release()
+{
+    if (file != nullptr)
+    {
+        fclose(file);
+        file = nullptr;
+    }
+    for (Chunk& chunk : chunks)
+    {
+        delete[] chunk.data;
+        chunk.data = nullptr;
+        chunk.size = 0;
+        chunk.state = CHUNK_EMPTY;
+    }
+    delete[] decoded;
+    decoded = nullptr;
+}
+
+Status StreamProvider::open(const char* path, Resampler::Quality quality)
+{
+    if (file != nullptr)
+    {
+        return Status::InvalidState;
+    }
+
+    if (Status err = start_loader(); err != Status::Ok)
+    {
+        return err;
+    }
+
+    file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+        LOG_WARNING(TAG, "Cannot open %s", path);
+        return Status::NotFound;
+    }
+
+    if (Status err = Wav::ReadHeader(file, info); err != Status::Ok)
+    {
+        LOG_WARNING(TAG, "%s is not a supported WAV file", path);
+        release();
+        return err;
+    }
+
+    size_t blockSize = info.format == Wav::Format::PCM ? sizeof(Speaker::Sample) : info.block_align;
+    if (info.channels != 1 || blockSize > SPEAKER_STREAM_CHUNK_SIZE)
+    {
+        LOG_WARNING(TAG, "%s : only mono files with blocks up to %u bytes are supported", path, (unsigned) SPEAKER_STREAM_CHUNK_SIZE);
+        release();
+        return Status::InvalidParameters;
+    }
+    if (Status err = resampler.init(info.sample_rate, SPEAKER_SAMPLE_RATE_HZ, quality); err != Status::Ok)
+    {
+        LOG_WARNING(TAG, "%s : invalid sample rate %u Hz", path, (unsigned) info.sample_rate);
+        release();
+        return err;
+    }
+
+    chunkSize = SPEAKER_STREAM_CHUNK_SIZE / blockSize * blockSize; // chunks hold whole blocks
+    for (Chunk& chunk : chunks)
+    {
+        chunk.data = new uint8_t[chunkSize];
+    }
+    if (info.format == Wav::Format::ImaAdpcm)
+    {
+        decoded = new int16_t[info.samples_per_block];
+    }
+    bytesLeft = info.data_size;
+    samplesLeft = info.sample_count;
+    current = 0;
+    position = 0;
+    decodedCount = decodedPosition = 0;
+
+    // first chunk right now so the playback starts with data, the second one in the background
+    fill(0);
+    requestFill(1);
+
+    return Status::Ok;
+}
+
+void StreamProvider::stop()
+{
+    stopped = true;
+}
+
+StreamProvider::Stats StreamProvider::getStats() const
+{
+    return Stats{ chunksRead.load(), underruns, maxReadUs.load() };
+}
+
+Status StreamProvider::requestFill(uint8_t chunk)
+{
+    chunks[chunk].state.store(CHUNK_LOADING, std::memory_order_relaxed);
+    pending++;
+    FillRequest request = { this, chunk };
+    if (xQueueSend(loader_queue, &request, 0) != pdTRUE)
+    {
+        // loader busy with the other streams, retried on the next buffer
+        chunks[chunk].state.store(CHUNK_EMPTY, std::memory_order_relaxed);
+        pending--;
+        return Status::NoMemory;
+    }
+    return Status::Ok;
+}
+
+void StreamProvider::__internal_fill(uint8_t chunk)
+{
+    fill(chunk);
+    pending--; // last access to the provider, it may be deleted right after
+}
+
+void StreamProvider::fill(uint8_t index)
+{
+    Chunk& chunk = chunks[index];
+    if (!stopped)
+    {
+        int64_t start_us = esp_timer_get_time();
+        size_t toRead = bytesLeft < chunkSize ? bytesLeft : chunkSize;
+        size_t read = toRead > 0 ? fread(chunk.data, 1, toRead, file) : 0;
+        bytesLeft = read < toRead ? 0 : bytesLeft - read; // stop at the first read error
+
+        chunk.size = read;
+        chunksRead++;
+        uint32_t elapsed_us = static_cast<uint32_t>(esp_timer_get_time() - start_us);
+        if (elapsed_us > maxReadUs.load(std::memory_order_relaxed)) maxReadUs = elapsed_us;
+    }
+    else
+    {
+        chunk.size = 0;
+    }
+
+    chunk.state.store(CHUNK_READY, std::memory_order_release);
+}
+
+StreamProvider::Chunk* StreamProvider::currentChunk()
+{
+    for (int i = 0; i < 2; i++)
+    {
+        Chunk* chunk = &chunks[current];
+        uint8_t state = chunk->state.load(std::memory_order_acquire);
+        if (state != CHUNK_READY)
+        {
+            if (state == CHUNK_EMPTY) requestFill(current); // earlier request refused, try again
+            return nullptr;
+        }
+        if (position < chunk->size || chunk->size == 0)
+        {
+            return chunk;
+        }
+
+        // consumed : give it back to the loader, and move to the other one
+        requestFill(current);
+        current ^= 1;
+        position = 0;
+    }
+    return nullptr;
+}
+
+bool StreamProvider::provideSamples(Speaker::Sample* buffer, size_t sampleCount)
+{
+    if (file == nullptr)
+    {
+        return false;
+    }
+    return resampler.provide(reader, buffer, sampleCount);
+}
+
+bool StreamProvider::readSamples(Speaker::Sample* buffer, size_t sampleCount)
+{
+    if (stopped || file == nullptr || samplesLeft == 0)
+    {
+        return false;
+    }
+
+    size_t produced = 0;
+    while (produced < sampleCount && samplesLeft > 0)
+    {
+        size_t wanted = sampleCount - produced;
+        if (wanted > samplesLeft) wanted = samplesLeft;
+        size_t count;
+
+        if (info.format == Wav::Format::PCM)
+        {
+            Chunk* chunk = currentChunk();
+            if (chunk == nullptr)
+            {
+                underruns++;
+                break;
+            }
+            if (chunk->size == 0)
+            {
+                samplesLeft = 0; // file shorter than announced
+                break;
+            }
+            size_t available = (chunk->size - position) / sizeof(Speaker::Sample);
+            if (available == 0)
+            {
+                position = chunk->size; // odd trailing byte
+                continue;
+            }
+            count = wanted < available ? wanted : available;
+            memcpy(buffer + produced, chunk->data + position, count * sizeof(Speaker::Sample));
+            position += count * sizeof(Speaker::Sample);
+        }
+        else
+        {
+            if (decodedPosition >= decodedCount)
+            {
+                Chunk* chunk = currentChunk();
+                if (chunk == nullptr)
+                {
+                    underruns++;
+                    break;
+                }
+                size_t block = chunk->size - position;
+                if (block > info.block_align) block = info.block_align;
+                if (block <= Adpcm::BLOCK_HEADER_SIZE)
+                {
+                    samplesLeft = 0; // end of the file (or truncated last block)
+                    break;
+                }
+                Adpcm::DecodeBlock(chunk->data + position, decoded, block);
+                decodedCount = Adpcm::SamplesPerBlock(block);
+                decodedPosition = 0;
+                position += block;
+            }
+            size_t available = decodedCount - decodedPosition;
+            count = wanted < available ? wanted : available;
+            memcpy(buffer + produced, decoded + decodedPosition, count * sizeof(Speaker::Sample));
+            decodedPosition += count;
+        }
+
+        produced += count;
+        samplesLeft -= count;
+    }
+
+    if (produced < sampleCount)
+    {
+        memset(buffer + produced, 0, (sampleCount - produced) * sizeof(Speaker::Sample));
+    }
+    return true;
+}
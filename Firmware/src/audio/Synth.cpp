@@ -0,0 +1,210 @@
+#include "audio/Synth.hpp"
+#include "common/config.hpp"
+#include <cmath>
+
+namespace Synth
+{
+    constexpr int32_t FULL_LEVEL = 32767 << 16;
+    constexpr uint32_t FRACTION_BITS = 32 - TABLE_BITS;
+
+    static int16_t tables[static_cast<size_t>(Waveform::Count)][TABLE_SIZE + 1];
+
+    static bool build_tables()
+    {
+        uint32_t noise = 0x360u; // fixed seed, so the noise sounds the same at every boot
+        for (uint32_t i = 0; i < TABLE_SIZE; i++)
+        {
+            float t = static_cast<float>(i) / TABLE_SIZE;
+            tables[(int) Waveform::Sine][i] = static_cast<int16_t>(std::lround(32767.0 * std::sin(2.0 * M_PI * i / TABLE_SIZE)));
+            tables[(int) Waveform::Square][i] = i < TABLE_SIZE / 2 ? 32767 : -32767;
+            float triangle = t < 0.25f ? 4.0f * t : (t < 0.75f ? 2.0f - 4.0f * t : 4.0f * t - 4.0f);
+            tables[(int) Waveform::Triangle][i] = static_cast<int16_t>(std::lround(32767.0f * triangle));
+            // xorshift32
+            noise ^= noise << 13;
+            noise ^= noise >> 17;
+            noise ^= noise << 5;
+            tables[(int) Waveform::Noise][i] = static_cast<int16_t>(noise >> 16);
+        }
+        for (auto& table : tables)
+        {
+            table[TABLE_SIZE] = table[0];
+        }
+        return true;
+    }
+
+    const int16_t* GetTable(Waveform waveform)
+    {
+        static bool built = build_tables(); // thread-safe one time initialization
+        (void) built;
+        if (waveform >= Waveform::Count) waveform = Waveform::Sine;
+        return tables[static_cast<size_t>(waveform)];
+    }
+
+    uint32_t PhaseIncrement(float frequencyHz)
+    {
+        if (frequencyHz <= 0.0f) return 0;
+        double increment = static_cast<double>(frequencyHz) * 4294967296.0 / SPEAKER_SAMPLE_RATE_HZ;
+        if (increment >= 2147483648.0) return 0x7FFFFFFF; // Nyquist
+        return static_cast<uint32_t>(increment);
+    }
+
+    /** OSCILLATOR **/
+
+    Oscillator::Oscillator(Waveform waveform, float frequencyHz)
+    {
+        setWaveform(waveform);
+        setFrequency(frequencyHz);
+    }
+
+    void Oscillator::setWaveform(Waveform waveform)
+    {
+        table = GetTable(waveform);
+        interpolate = waveform == Waveform::Sine || waveform == Waveform::Triangle;
+    }
+
+    void Oscillator::setFrequency(float frequencyHz)
+    {
+        increment = PhaseIncrement(frequencyHz);
+    }
+
+    void Oscillator::render(Speaker::Sample* buffer, size_t sampleCount, int16_t amplitude)
+    {
+        const int16_t* __restrict t = table;
+        uint32_t p = phase;
+        if (interpolate)
+        {
+            for (size_t i = 0; i < sampleCount; i++)
+            {
+                uint32_t index = p >> FRACTION_BITS;
+                int32_t fraction = (p >> (FRACTION_BITS - 15)) & 0x7FFF; // Q15
+                int32_t a = t[index];
+                int32_t sample = a + (((t[index + 1] - a) * fraction) >> 15);
+                buffer[i] = static_cast<Speaker::Sample>((sample * amplitude) >> 15);
+                p += increment;
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < sampleCount; i++)
+            {
+                buffer[i] = static_cast<Speaker::Sample>((t[p >> FRACTION_BITS] * amplitude) >> 15);
+                p += increment;
+            }
+        }
+        phase = p;
+    }
+
+    /** ENVELOPE **/
+
+    static uint32_t ms_to_samples(uint16_t ms)
+    {
+        return static_cast<uint32_t>(ms) * SPEAKER_SAMPLE_RATE_HZ / 1000;
+    }
+
+    Envelope::Envelope(const EnvelopeSettings& settings)
+        : settings(settings)
+    {
+    }
+
+    void Envelope::setSettings(const EnvelopeSettings& settings)
+    {
+        this->settings = settings;
+    }
+
+    void Envelope::noteOn()
+    {
+        enterStage(Stage::Attack);
+    }
+
+    void Envelope::noteOff()
+    {
+        if (stage != Stage::Idle) enterStage(Stage::Release);
+    }
+
+    void Envelope::enterStage(Stage stage)
+    {
+        this->stage = stage;
+        int32_t target = 0;
+        switch (stage)
+        {
+        case Stage::Attack:
+            remaining = ms_to_samples(settings.attack_ms);
+            target = FULL_LEVEL;
+            break;
+        case Stage::Decay:
+            remaining = ms_to_samples(settings.decay_ms);
+            target = (FULL_LEVEL / 255) * settings.sustain;
+            break;
+        case Stage::Release:
+            remaining = ms_to_samples(settings.release_ms);
+            target = 0;
+            break;
+        default: // Idle and Sustain hold the level
+            remaining = 0;
+            step = 0;
+            return;
+        }
+
+        if (remaining == 0)
+        {
+            level = target; // zero length stage, jump right to its end
+            step = 0;
+        }
+        else
+        {
+            step = (target - level) / static_cast<int32_t>(remaining);
+        }
+    }
+
+    void Envelope::apply(Speaker::Sample* buffer, size_t sampleCount)
+    {
+        while (sampleCount > 0)
+        {
+            if (stage == Stage::Idle || stage == Stage::Sustain)
+            {
+                // constant level till the end of the block
+                int32_t gain = level >> 16;
+                for (size_t i = 0; i < sampleCount; i++)
+                {
+                    buffer[i] = static_cast<Speaker::Sample>((buffer[i] * gain) >> 15);
+                }
+                return;
+            }
+
+            size_t count = remaining < sampleCount ? remaining : sampleCount;
+            int32_t l = level;
+            for (size_t i = 0; i < count; i++)
+            {
+                buffer[i] = static_cast<Speaker::Sample>((buffer[i] * (l >> 16)) >> 15);
+                l += step;
+            }
+            level = l;
+            buffer += count;
+            sampleCount -= count;
+            remaining -= count;
+
+            if (remaining == 0)
+            {
+                // next stage (the ramps truncated step lands slightly off the target, snap to it)
+                switch (stage)
+                {
+                case Stage::Attack:
+                    level = FULL_LEVEL;
+                    enterStage(Stage::Decay);
+                    if (remaining == 0) enterStage(Stage::Sustain);
+                    break;
+                case Stage::Decay:
+                    level = (FULL_LEVEL / 255) * settings.sustain;
+                    enterStage(Stage::Sustain);
+                    break;
+                case Stage::Release:
+                    level = 0;
+                    enterStage(Stage::Idle);
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#include "audio/ToneProvider.hpp"
+#include "common/config.hpp"
+#include <memory.h>
+
+ToneProvider::ToneProvider(const ToneSequence& sequence)
+    : sequence(sequence), envelope(sequence.envelope)
+{
+    if (sequence.count > 0) startTone();
+}
+
+void ToneProvider::startTone()
+{
+    const Tone& tone = sequence.tones[index];
+
+    elapsed = 0;
+    duration = static_cast<uint32_t>(tone.duration_ms) * SPEAKER_SAMPLE_RATE_HZ / 1000;
+
+    if (tone.frequency_hz == 0)
+    {
+        // rest : the previous tone rings out at its last pitch
+        startIncrement = endIncrement = oscillator.getPhaseIncrement();
+        releaseAt = 0;
+        envelope.noteOff();
+        return;
+    }
+
+    oscillator.setWaveform(tone.waveform);
+    startIncrement = Synth::PhaseIncrement(tone.frequency_hz);
+    endIncrement = tone.end_frequency_hz != 0 ? Synth::PhaseIncrement(tone.end_frequency_hz) : startIncrement;
+    oscillator.setPhaseIncrement(startIncrement);
+    amplitude = static_cast<int16_t>(tone.volume * 32767 / 255);
+
+    uint32_t release = static_cast<uint32_t>(sequence.envelope.release_ms) * SPEAKER_SAMPLE_RATE_HZ / 1000;
+    releaseAt = duration > release ? duration - release : duration / 2; // short tone : half held, half released
+    envelope.noteOn();
+}
+
+bool ToneProvider::provideSamples(Speaker::Sample* buffer, size_t sampleCount)
+{
+    if (isFinished())
+        return false;
+
+    while (sampleCount > 0)
+    {
+        if (isFinished())
+        {
+            memset(buffer, 0, sampleCount * sizeof(Speaker::Sample));
+            break;
+        }
+
+        // render up to the next event : glide step, release, or end of tone
+        uint32_t count = duration - elapsed;
+        if (count > sampleCount) count = sampleCount;
+        if (elapsed < releaseAt && releaseAt - elapsed < count) count = releaseAt - elapsed;
+        if (startIncrement != endIncrement && count > GLIDE_STEP_SAMPLES) count = GLIDE_STEP_SAMPLES;
+
+        if (startIncrement != endIncrement)
+        {
+            // linear glide of the phase increment over the tone
+            int64_t delta = static_cast<int64_t>(endIncrement) - startIncrement;
+            oscillator.setPhaseIncrement(static_cast<uint32_t>(startIncrement + delta * elapsed / duration));
+        }
+
+        oscillator.render(buffer, count, amplitude);
+        envelope.apply(buffer, count);
+
+        buffer += count;
+        sampleCount -= count;
+        elapsed += count;
+
+        if (elapsed == releaseAt) envelope.noteOff();
+        if (elapsed >= duration)
+        {
+            index++;
+            if (!isFinished()) startTone();
+        }
+    }
+
+    return true;
+}
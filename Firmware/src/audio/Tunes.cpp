@@ -0,0 +1,91 @@
+#include "audio/Tunes.hpp"
+
+using Synth::Waveform;
+
+namespace Tunes
+{
+    // Shorthands for the tables below : NOTE(frequency, duration), GLIDE(from, to, duration), REST(duration)
+    #define NOTE(wave, hz, ms, vol) Tone{ Waveform::wave, hz, 0, ms, vol }
+    #define GLIDE(wave, from, to, ms, vol) Tone{ Waveform::wave, from, to, ms, vol }
+    #define REST(ms) Tone{ Waveform::Sine, 0, 0, ms, 0 }
+    #define SEQUENCE(tones, ...) ToneSequence{ tones, sizeof(tones) / sizeof(Tone), __VA_ARGS__ }
+
+    /** UI FEEDBACK **/
+
+    static const Tone ui_click[] = { NOTE(Square, 2093, 12, 90) };
+    static const Tone ui_select[] = { NOTE(Square, 1568, 30, 90), NOTE(Square, 2093, 40, 90) };
+    static const Tone ui_back[] = { NOTE(Square, 2093, 30, 90), NOTE(Square, 1568, 40, 90) };
+    static const Tone ui_error[] = { NOTE(Square, 392, 90, 140), REST(30), NOTE(Square, 392, 140, 140) };
+
+    const ToneSequence UiClick = SEQUENCE(ui_click, { 1, 4, 180, 4 });
+    const ToneSequence UiSelect = SEQUENCE(ui_select, { 1, 10, 180, 8 });
+    const ToneSequence UiBack = SEQUENCE(ui_back, { 1, 10, 180, 8 });
+    const ToneSequence UiError = SEQUENCE(ui_error, { 2, 20, 200, 20 });
+
+    /** JINGLES **/
+
+    static const Tone boot[] = {
+        NOTE(Triangle, 523, 110, 220), // C5
+        NOTE(Triangle, 659, 110, 220), // E5
+        NOTE(Triangle, 784, 110, 220), // G5
+        NOTE(Triangle, 1047, 260, 240), // C6
+    };
+    static const Tone shutdown[] = {
+        NOTE(Triangle, 1047, 110, 220),
+        NOTE(Triangle, 784, 110, 220),
+        NOTE(Triangle, 523, 260, 220),
+    };
+
+    const ToneSequence Boot = SEQUENCE(boot, { 5, 40, 170, 60 });
+    const ToneSequence Shutdown = SEQUENCE(shutdown, { 5, 40, 170, 80 });
+
+    /** VOICE **/
+
+    static const Tone happy[] = {
+        GLIDE(Sine, 900, 1500, 90, 220),
+        REST(30),
+        GLIDE(Sine, 1100, 1900, 110, 220),
+    };
+    static const Tone sad[] = {
+        GLIDE(Triangle, 700, 450, 280, 200),
+        GLIDE(Triangle, 500, 300, 360, 180),
+    };
+    static const Tone curious[] = {
+        NOTE(Sine, 800, 70, 200),
+        GLIDE(Sine, 800, 1700, 180, 220),
+    };
+    static const Tone surprised[] = {
+        GLIDE(Square, 600, 2400, 120, 140),
+        NOTE(Sine, 2400, 100, 200),
+    };
+    static const Tone alert[] = {
+        NOTE(Square, 1400, 70, 150), REST(40),
+        NOTE(Square, 1400, 70, 150), REST(40),
+        NOTE(Square, 1400, 70, 150),
+    };
+    static const Tone sleepy[] = {
+        GLIDE(Sine, 600, 350, 500, 160),
+        GLIDE(Noise, 120, 60, 400, 40), // breath
+    };
+
+    static const ToneSequence voices[] = {
+        SEQUENCE(happy, { 5, 20, 200, 30 }),
+        SEQUENCE(sad, { 30, 60, 170, 80 }),
+        SEQUENCE(curious, { 5, 20, 200, 30 }),
+        SEQUENCE(surprised, { 2, 20, 220, 40 }),
+        SEQUENCE(alert, { 2, 10, 220, 10 }),
+        SEQUENCE(sleepy, { 80, 100, 160, 150 }),
+    };
+    static_assert(sizeof(voices) / sizeof(voices[0]) == static_cast<size_t>(Voice::Count), "Missing voice sequence");
+
+    #undef NOTE
+    #undef GLIDE
+    #undef REST
+    #undef SEQUENCE
+
+    const ToneSequence& GetVoice(Voice voice)
+    {
+        if (voice >= Voice::Count) voice = Voice::Happy;
+        return voices[static_cast<size_t>(voice)];
+    }
+}
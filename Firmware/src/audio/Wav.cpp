@@ -0,0 +1,122 @@
+#include "audio/Wav.hpp"
+#include "audio/Adpcm.hpp"
+#include "common/Log.hpp"
+#include <cstring>
+
+namespace Wav
+{
+    constexpr const char* TAG = "Wav";
+
+    struct ChunkHeader
+    {
+        char id[4];
+        uint32_t size;
+    } __attribute__((packed));
+
+    struct FormatChunk
+    {
+        uint16_t format;
+        uint16_t channels;
+        uint32_t sample_rate;
+        uint32_t byte_rate;
+        uint16_t block_align;
+        uint16_t bits_per_sample;
+    } __attribute__((packed));
+
+    Status ReadHeader(FILE* file, Info& info)
+    {
+        char riff[12];
+        if (fread(riff, sizeof(riff), 1, file) != 1 || memcmp(riff, "RIFF", 4) != 0 || memcmp(riff + 8, "WAVE", 4) != 0)
+        {
+            return Status::InvalidParameters;
+        }
+
+        info = {};
+        bool has_format = false;
+        uint32_t fact_samples = 0;
+        uint16_t bits_per_sample = 0;
+        ChunkHeader chunk;
+        while (fread(&chunk, sizeof(chunk), 1, file) == 1)
+        {
+            long next = ftell(file) + chunk.size + (chunk.size & 1); // chunks are padded to even sizes
+            if (memcmp(chunk.id, "fmt ", 4) == 0 && chunk.size >= sizeof(FormatChunk))
+            {
+                FormatChunk fmt;
+                if (fread(&fmt, sizeof(fmt), 1, file) != 1) return Status::InvalidParameters;
+                info.format = static_cast<Format>(fmt.format);
+                info.channels = fmt.channels;
+                info.sample_rate = fmt.sample_rate;
+                info.block_align = fmt.block_align;
+                bits_per_sample = fmt.bits_per_sample;
+                has_format = true;
+            }
+            else if (memcmp(chunk.id, "fact", 4) == 0 && chunk.size >= 4)
+            {
+                if (fread(&fact_samples, sizeof(fact_samples), 1, file) != 1) return Status::InvalidParameters;
+            }
+            else if (memcmp(chunk.id, "data", 4) == 0)
+            {
+                info.data_offset = static_cast<uint32_t>(ftell(file));
+                info.data_size = chunk.size;
+                break;
+            }
+            fseek(file, next, SEEK_SET);
+        }
+
+        if (!has_format || info.data_offset == 0)
+        {
+            return Status::InvalidParameters;
+        }
+
+        if (info.format == Format::PCM && bits_per_sample == 16)
+        {
+            info.samples_per_block = 1;
+            info.sample_count = info.data_size / (2 * (info.channels ? info.channels : 1));
+        }
+        else if (info.format == Format::ImaAdpcm && bits_per_sample == 4 && info.block_align > Adpcm::BLOCK_HEADER_SIZE)
+        {
+            info.samples_per_block = static_cast<uint16_t>(Adpcm::SamplesPerBlock(info.block_align));
+            uint32_t blocks = (info.data_size + info.block_align - 1) / info.block_align;
+            info.sample_count = fact_samples != 0 ? fact_samples : blocks * info.samples_per_block;
+        }
+        else
+        {
+            LOG_WARNING(TAG, "Unsupported WAV format 0x%04x, %u bits", static_cast<unsigned>(info.format), bits_per_sample);
+            return Status::InvalidParameters;
+        }
+
+        return Status::Ok;
+    }
+
+    Status WriteHeader(FILE* file, const Info& info)
+    {
+        bool adpcm = info.format == Format::ImaAdpcm;
+        uint32_t fmt_size = adpcm ? sizeof(FormatChunk) + 4 : sizeof(FormatChunk); // + cbSize and samples per block
+        uint32_t riff_size = 4 + (8 + fmt_size) + (adpcm ? 8 + 4 : 0) + 8 + info.data_size + (info.data_size & 1);
+
+        FormatChunk fmt;
+        fmt.format = static_cast<uint16_t>(info.format);
+        fmt.channels = info.channels;
+        fmt.sample_rate = info.sample_rate;
+        fmt.block_align = info.block_align;
+        fmt.bits_per_sample = adpcm ? 4 : 16;
+        fmt.byte_rate = adpcm ? static_cast<uint32_t>(static_cast<uint64_t>(info.sample_rate) * info.block_align / info.samples_per_block)
+                              : info.sample_rate * info.block_align;
+
+        ChunkHeader riff = { { 'R', 'I', 'F', 'F' }, riff_size };
+        ChunkHeader fmt_header = { { 'f', 'm', 't', ' ' }, fmt_size };
+        ChunkHeader data_header = { { 'd', 'a', 't', 'a' }, info.data_size };
+        bool ok = fwrite(&riff, sizeof(riff), 1, file) == 1 && fwrite("WAVE", 4, 1, file) == 1 &&
+                  fwrite(&fmt_header, sizeof(fmt_header), 1, file) == 1 && fwrite(&fmt, sizeof(fmt), 1, file) == 1;
+        if (ok && adpcm)
+        {
+            uint16_t extra[2] = { 2, info.samples_per_block };
+            ChunkHeader fact_header = { { 'f', 'a', 'c', 't' }, 4 };
+            ok = fwrite(extra, sizeof(extra), 1, file) == 1 && fwrite(&fact_header, sizeof(fact_header), 1, file) == 1 &&
+                 fwrite(&info.sample_count, sizeof(info.sample_count), 1, file) == 1;
+        }
+        ok = ok && fwrite(&data_header, sizeof(data_header), 1, file) == 1;
+
+        return ok ? Status::Ok : Status::Failure;
+    }
+}
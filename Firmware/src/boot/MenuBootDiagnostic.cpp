@@ -9,9 +9,9 @@
 
 MenuBootDiagnostic::MenuBootDiagnostic(NetworkManager* networkManager)
     : Menu("Diagnostic"),
-    phone_spawn((uint8_t*)Animation::PhoneQRSpawn, 7, 0, 0, 64, 64, false, false),
-    phone_scan((uint8_t*)Animation::PhoneQRScan, 15, 0, 0, 64, 64, false, false),
-    phone_connected((uint8_t*)Animation::PhoneQRConnected, 6, 0, 0, 64, 64, false, false),
+    phone_spawn(Animation::PhoneQRSpawn, sizeof(Animation::PhoneQRSpawn), 0, 0, false, false),
+    phone_scan(Animation::PhoneQRScan, sizeof(Animation::PhoneQRScan), 0, 0, false, false),
+    phone_connected(Animation::PhoneQRConnected, sizeof(Animation::PhoneQRConnected), 0, 0, false, false),
     qr_code(nullptr, 64, 0, 64, 64),
     networkManager(networkManager)
     {
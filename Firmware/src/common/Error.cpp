@@ -1,7 +1,5 @@
 #include "common/utils.hpp"
 #include "common/config.hpp"
-#include "common/LED.hpp"
-#include "ui/Menus.hpp"
 #include <esp_timer.h>
 #include <mutex>
 
@@ -0,0 +1,322 @@
+#include "common/LED.Effects.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace LED
+{
+    namespace
+    {
+        constexpr Q8_8 MAX_BRIGHTNESS = 255 << 8;
+        constexpr int64_t FRAME_US = LED_FRAME_MS * 1000;
+        constexpr uint32_t ONE = 1 << 16; // phases and levels of the waves are in Q16
+
+        struct GammaTables
+        {
+            uint16_t levels[257]; // LED level (Q8.8) at each integer brightness, the last one repeated
+            Q8_8 brightness[256];
+        };
+
+        uint8_t to_level(const GammaTables& tables, Q8_8 brightness)
+        {
+            brightness = std::min(brightness, MAX_BRIGHTNESS);
+            uint8_t i = brightness >> 8;
+            uint32_t fraction = brightness & 0xFF;
+            uint32_t level = tables.levels[i] + (((tables.levels[i + 1] - tables.levels[i]) * fraction) >> 8);
+            return static_cast<uint8_t>(std::min<uint32_t>((level + 128) >> 8, 255));
+        }
+
+        GammaTables make_tables()
+        {
+            GammaTables tables = {};
+            for (uint16_t i = 0; i <= 255; i++)
+            {
+                tables.levels[i] = static_cast<uint16_t>(std::lround(MAX_BRIGHTNESS * std::pow(i / 255.0, LED_GAMMA)));
+            }
+            tables.levels[256] = tables.levels[255];
+
+            // middle of the brightness range giving each level, so it survives the round trip
+            for (uint16_t level = 0; level <= 255; level++)
+            {
+                uint32_t low = 0, high = MAX_BRIGHTNESS;
+                while (low < high) // first brightness reaching the level
+                {
+                    uint32_t middle = (low + high) / 2;
+                    if (to_level(tables, middle) < level) low = middle + 1;
+                    else high = middle;
+                }
+                uint32_t first = low;
+                high = MAX_BRIGHTNESS;
+                while (low < high) // last brightness giving it
+                {
+                    uint32_t middle = (low + high + 1) / 2;
+                    if (to_level(tables, middle) > level) high = middle - 1;
+                    else low = middle;
+                }
+                tables.brightness[level] = static_cast<Q8_8>((first + low) / 2);
+            }
+            return tables;
+        }
+
+        const GammaTables& tables()
+        {
+            static const GammaTables instance = make_tables();
+            return instance;
+        }
+
+        /// @brief Position in the current period, in Q16
+        uint32_t phase(int64_t elapsed_us, uint16_t period_ms)
+        {
+            int64_t period_us = static_cast<int64_t>(period_ms) * 1000;
+            return static_cast<uint32_t>(((elapsed_us % period_us) << 16) / period_us);
+        }
+
+        Q8_8 scale(Q8_8 brightness, uint32_t level)
+        {
+            return static_cast<Q8_8>((static_cast<uint32_t>(brightness) * level) >> 16);
+        }
+
+        void brightness_of(Color color, Q8_8 out[3])
+        {
+            out[0] = EffectEngine::ToBrightness(color.r);
+            out[1] = EffectEngine::ToBrightness(color.g);
+            out[2] = EffectEngine::ToBrightness(color.b);
+        }
+    }
+
+    /// EFFECTS
+
+    Effect Effect::Solid(Color color, uint32_t duration_ms)
+    {
+        return { EffectType::Solid, color, 0, 0, duration_ms };
+    }
+
+    Effect Effect::Fade(Color color, uint16_t transition_ms, uint32_t duration_ms)
+    {
+        return { EffectType::Fade, color, transition_ms, 0, duration_ms };
+    }
+
+    Effect Effect::Breathe(Color color, uint16_t period_ms, uint32_t duration_ms)
+    {
+        return { EffectType::Breathe, color, period_ms, 0, duration_ms };
+    }
+
+    Effect Effect::Pulse(Color color, uint16_t period_ms, uint32_t duration_ms)
+    {
+        return { EffectType::Pulse, color, period_ms, 0, duration_ms };
+    }
+
+    Effect Effect::Rainbow(uint8_t brightness, uint16_t period_ms, uint32_t duration_ms)
+    {
+        return { EffectType::Rainbow, Color(brightness, brightness, brightness), period_ms, 0, duration_ms };
+    }
+
+    Effect Effect::Blink(Color color, uint8_t count, uint16_t period_ms, uint32_t duration_ms)
+    {
+        return { EffectType::Blink, color, period_ms, count, duration_ms };
+    }
+
+    /// ENGINE
+
+    EffectEngine::EffectEngine()
+    {
+        tables(); // build the gamma tables now rather than in the first frame
+    }
+
+    Status EffectEngine::set(Id id, Layer layer, const Effect& effect, int64_t now_us)
+    {
+        if (id >= LED_COUNT || layer >= Layer::COUNT) return Status::InvalidParameters;
+
+        // a fade starts from what the LED shows at this layer
+        Q8_8 from[3] = { 0, 0, 0 };
+        for (int l = static_cast<int>(layer); l >= 0; l--)
+        {
+            if (active(slots[id][l], now_us))
+            {
+                value(slots[id][l], now_us, from);
+                break;
+            }
+        }
+
+        Slot& slot = slots[id][static_cast<uint8_t>(layer)];
+        slot.effect = effect;
+        slot.start_us = now_us;
+        memcpy(slot.from, from, sizeof(from));
+        if (effect.period_ms == 0 && effect.type != EffectType::Fade) slot.effect.type = EffectType::Solid;
+        return Status::Ok;
+    }
+
+    Status EffectEngine::clear(Id id, Layer layer)
+    {
+        if (id >= LED_COUNT || layer >= Layer::COUNT) return Status::InvalidParameters;
+        slots[id][static_cast<uint8_t>(layer)].effect.type = EffectType::None;
+        return Status::Ok;
+    }
+
+    Color EffectEngine::getColor(Id id, Layer layer, int64_t now_us) const
+    {
+        if (id >= LED_COUNT || layer >= Layer::COUNT) return Color();
+        const Slot& slot = slots[id][static_cast<uint8_t>(layer)];
+        return active(slot, now_us) ? slot.effect.color : Color();
+    }
+
+    bool EffectEngine::render(int64_t now_us, uint8_t frame[FRAME_SIZE], int64_t& deadline_us)
+    {
+        deadline_us = NO_DEADLINE;
+        for (Id id = 0; id < LED_COUNT; id++)
+        {
+            Q8_8 rgb[3] = { 0, 0, 0 };
+            for (int l = static_cast<int>(Layer::COUNT) - 1; l >= 0; l--)
+            {
+                const Slot& slot = slots[id][l];
+                if (!active(slot, now_us)) continue;
+                value(slot, now_us, rgb);
+                deadline_us = std::min(deadline_us, next_change(slot, now_us));
+                break;
+            }
+
+            frame[id * 3 + 0] = ToLevel(rgb[1]); // WS2812 expects GRB order
+            frame[id * 3 + 1] = ToLevel(rgb[0]);
+            frame[id * 3 + 2] = ToLevel(rgb[2]);
+        }
+
+        if (has_frame && memcmp(frame, last_frame, FRAME_SIZE) == 0)
+        {
+            stats.frames_skipped++;
+            return false;
+        }
+        memcpy(last_frame, frame, FRAME_SIZE);
+        has_frame = true;
+        stats.frames_sent++;
+        return true;
+    }
+
+    EffectEngine::Stats EffectEngine::getStats() const
+    {
+        return stats;
+    }
+
+    void EffectEngine::resetStats()
+    {
+        stats = {};
+    }
+
+    uint8_t EffectEngine::ToLevel(Q8_8 brightness)
+    {
+        return to_level(tables(), brightness);
+    }
+
+    Q8_8 EffectEngine::ToBrightness(uint8_t level)
+    {
+        return tables().brightness[level];
+    }
+
+    bool EffectEngine::active(const Slot& slot, int64_t now_us) const
+    {
+        if (slot.effect.type == EffectType::None) return false;
+        return slot.effect.duration_ms == 0 || now_us - slot.start_us < static_cast<int64_t>(slot.effect.duration_ms) * 1000;
+    }
+
+    void EffectEngine::value(const Slot& slot, int64_t now_us, Q8_8 out[3]) const
+    {
+        const Effect& effect = slot.effect;
+        int64_t elapsed_us = std::max<int64_t>(now_us - slot.start_us, 0);
+        Q8_8 target[3];
+        brightness_of(effect.color, target);
+
+        switch (effect.type)
+        {
+            case EffectType::Fade:
+            {
+                int64_t transition_us = static_cast<int64_t>(effect.period_ms) * 1000;
+                if (elapsed_us >= transition_us) break;
+                for (int c = 0; c < 3; c++)
+                {
+                    int64_t delta = static_cast<int64_t>(target[c]) - slot.from[c];
+                    out[c] = static_cast<Q8_8>(slot.from[c] + delta * elapsed_us / transition_us);
+                }
+                return;
+            }
+            case EffectType::Breathe:
+            {
+                // smoothstep of a triangle wave : off, up to the color and back, without a kink at the ends
+                uint32_t p = phase(elapsed_us, effect.period_ms);
+                uint32_t tri = p < ONE / 2 ? p * 2 : (ONE - p) * 2;
+                uint32_t level = static_cast<uint32_t>((static_cast<uint64_t>(tri) * tri >> 16) * (3 * ONE - 2 * tri) >> 16);
+                for (int c = 0; c < 3; c++) out[c] = scale(target[c], level);
+                return;
+            }
+            case EffectType::Pulse:
+            {
+                // linear attack on the first eighth of the period, quadratic decay on the rest
+                uint32_t p = phase(elapsed_us, effect.period_ms);
+                uint32_t level;
+                if (p < ONE / 8) level = p * 8;
+                else
+                {
+                    uint32_t decay = static_cast<uint32_t>((static_cast<uint64_t>(ONE - p) << 16) / (ONE - ONE / 8));
+                    level = static_cast<uint32_t>((static_cast<uint64_t>(decay) * decay) >> 16);
+                }
+                for (int c = 0; c < 3; c++) out[c] = scale(target[c], level);
+                return;
+            }
+            case EffectType::Rainbow:
+            {
+                Q8_8 bright = std::max({ target[0], target[1], target[2] });
+                uint32_t hue = phase(elapsed_us, effect.period_ms) * 6;
+                Q8_8 rising = scale(bright, hue & 0xFFFF);
+                Q8_8 falling = bright - rising;
+                const Q8_8 sectors[6][3] = {
+                    { bright, rising, 0 }, { falling, bright, 0 }, { 0, bright, rising },
+                    { 0, falling, bright }, { rising, 0, bright }, { bright, 0, falling },
+                };
+                memcpy(out, sectors[(hue >> 16) % 6], sizeof(sectors[0]));
+                return;
+            }
+            case EffectType::Blink:
+            {
+                uint32_t slots = 2 * std::max<uint32_t>(effect.count, 1) + 2;
+                int64_t slot_us = static_cast<int64_t>(effect.period_ms) * 1000 / slots;
+                int64_t k = (elapsed_us % (static_cast<int64_t>(effect.period_ms) * 1000)) / std::max<int64_t>(slot_us, 1);
+                bool on = k < slots - 2 && k % 2 == 0;
+                for (int c = 0; c < 3; c++) out[c] = on ? target[c] : 0;
+                return;
+            }
+            default:
+                break;
+        }
+        memcpy(out, target, sizeof(target));
+    }
+
+    int64_t EffectEngine::next_change(const Slot& slot, int64_t now_us) const
+    {
+        const Effect& effect = slot.effect;
+        int64_t end_us = effect.duration_ms == 0 ? NO_DEADLINE : slot.start_us + static_cast<int64_t>(effect.duration_ms) * 1000;
+        int64_t elapsed_us = std::max<int64_t>(now_us - slot.start_us, 0);
+        int64_t next_frame_us = slot.start_us + (elapsed_us / FRAME_US + 1) * FRAME_US;
+
+        switch (effect.type)
+        {
+            case EffectType::Fade:
+                if (elapsed_us >= static_cast<int64_t>(effect.period_ms) * 1000) return end_us;
+                return std::min({ next_frame_us, slot.start_us + static_cast<int64_t>(effect.period_ms) * 1000, end_us });
+            case EffectType::Breathe:
+            case EffectType::Pulse:
+            case EffectType::Rainbow:
+                return std::min(next_frame_us, end_us);
+            case EffectType::Blink:
+            {
+                // next blink edge, nothing to compute in between
+                int64_t period_us = static_cast<int64_t>(effect.period_ms) * 1000;
+                uint32_t slots = 2 * std::max<uint32_t>(effect.count, 1) + 2;
+                int64_t slot_us = std::max<int64_t>(period_us / slots, 1);
+                int64_t period_start_us = slot.start_us + elapsed_us / period_us * period_us;
+                int64_t k = (elapsed_us % period_us) / slot_us;
+                int64_t next_us = k + 1 >= slots - 2 ? period_start_us + period_us : period_start_us + (k + 1) * slot_us;
+                return std::min(next_us, end_us);
+            }
+            default:
+                return end_us;
+        }
+    }
+}
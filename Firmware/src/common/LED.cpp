@@ -1,8 +1,11 @@
 #include "common/LED.hpp"
+#include "common/LED.Effects.hpp"
 #include <freertos/FreeRTOS.h>
 #include <driver/rmt_tx.h>
-#include <cmath>
+#include <esp_timer.h>
+#include <algorithm>
 #include <memory.h>
+#include <mutex>
 #include "common/Log.hpp"
 #include "common/LED.Error.hpp"
 
@@ -20,9 +23,8 @@ namespace LED
 
     static bool is_initialized = false;
 
-    static uint8_t target_pixels[LED_COUNT * 3] = {0}; // target color to reach after all transitions
-    static uint8_t last_pixels[LED_COUNT * 3] = {0}; // current color shown on the strip (last one sent)
-    static uint8_t adder_pixels[LED_COUNT * 3] = {0}; // per update increment to reach target in desired time
+    static EffectEngine engine; // effects of every layer, and the last frame sent
+    static std::mutex engine_mutex;
 
     static TaskHandle_t task_handle;
     static rmt_channel_handle_t rmt_tx_channel = NULL;
@@ -35,11 +37,9 @@ namespace LED
         }
     };
 
-    static uint8_t rmt_buffer[2][LED_COUNT * 3] = {0}; 
+    static uint8_t rmt_buffer[2][EffectEngine::FRAME_SIZE] = {0}; 
     static int current_buffer_idx = 0;
 
-    static uint8_t UPDATE_TASK_INTERVAL_MS = 50; // Update task interval in milliseconds
-
     void _update_task(void* param); // forward declaration
 
     Status Init()
@@ -105,7 +105,7 @@ namespace LED
             return Status::Failure;
         }
 
-        // launch background task for led update at fixed interval
+        // launch background task for led update (wakes on effect changes)
         BaseType_t err = xTaskCreatePinnedToCore(_update_task, "updateLEDs", 4096, nullptr, 5, &task_handle, CORE_BRAIN);
         if (err != pdPASS)
         {
@@ -149,42 +149,55 @@ namespace LED
         return Status::Ok;
     }
 
-    Status SetColor(Id id, Color color)
+    static void notify_task()
+    {
+        if (task_handle != nullptr) xTaskNotifyGive(task_handle);
+    }
+
+    Status SetEffect(Id id, Layer layer, const Effect& effect)
     {
         if (!is_initialized) return Status::InvalidState;
-        if (id >= LED_COUNT) return Status::InvalidParameters;
-
-        target_pixels[id * 3 + 0] = color.g; // WS2812 expects GRB order
-        target_pixels[id * 3 + 1] = color.r;
-        target_pixels[id * 3 + 2] = color.b;
-        last_pixels[id * 3 + 0] = color.g; // apply immediately
-        last_pixels[id * 3 + 1] = color.r;
-        last_pixels[id * 3 + 2] = color.b;
-        return Status::Ok;
+
+        Status status;
+        {
+            std::lock_guard<std::mutex> lock(engine_mutex);
+            status = engine.set(id, layer, effect, esp_timer_get_time());
+        }
+        if (status == Status::Ok) notify_task();
+        return status;
     }
 
-    Status SetColor(Id id, Color color, float duration_s)
+    Status ClearEffect(Id id, Layer layer)
     {
         if (!is_initialized) return Status::InvalidState;
-        if (id >= LED_COUNT) return Status::InvalidParameters;
 
-        const float updates_count = duration_s * 1000.0f / static_cast<float>(UPDATE_TASK_INTERVAL_MS);
-        if (updates_count <= 0.0f) return SetColor(id, color); // apply immediately
+        Status status;
+        {
+            std::lock_guard<std::mutex> lock(engine_mutex);
+            status = engine.clear(id, layer);
+        }
+        if (status == Status::Ok) notify_task();
+        return status;
+    }
+
+    EffectEngine::Stats GetStats()
+    {
+        std::lock_guard<std::mutex> lock(engine_mutex);
+        return engine.getStats();
+    }
 
-        target_pixels[id * 3 + 0] = color.g; // WS2812 expects GRB order
-        target_pixels[id * 3 + 1] = color.r;
-        target_pixels[id * 3 + 2] = color.b;
-        
-        // calculate adder for each color component
-        const int16_t g_diff = std::abs(static_cast<int16_t>(target_pixels[id * 3 + 0]) - static_cast<int16_t>(last_pixels[id * 3 + 0]));
-        const int16_t r_diff = std::abs(static_cast<int16_t>(target_pixels[id * 3 + 1]) - static_cast<int16_t>(last_pixels[id * 3 + 1]));
-        const int16_t b_diff = std::abs(static_cast<int16_t>(target_pixels[id * 3 + 2]) - static_cast<int16_t>(last_pixels[id * 3 + 2]));
+    Status SetColor(Id id, Color color)
+    {
+        return SetEffect(id, Layer::Base, Effect::Solid(color));
+    }
 
-        adder_pixels[id * 3 + 0] = static_cast<uint8_t>(std::ceil(static_cast<float>(g_diff) / updates_count));
-        adder_pixels[id * 3 + 1] = static_cast<uint8_t>(std::ceil(static_cast<float>(r_diff) / updates_count));
-        adder_pixels[id * 3 + 2] = static_cast<uint8_t>(std::ceil(static_cast<float>(b_diff) / updates_count));
+    Status SetColor(Id id, Color color, float duration_s)
+    {
+        const float transition_ms = std::min(duration_s * 1000.0f, static_cast<float>(UINT16_MAX));
+        if (transition_ms < 1.0f) return SetColor(id, color); // apply immediately
 
-        return Status::Ok;
+        // fades from the color shown, in perceived brightness
+        return SetEffect(id, Layer::Base, Effect::Fade(color, static_cast<uint16_t>(transition_ms)));
     }
 
     Status SetColors(const Color colors[])
@@ -236,9 +249,8 @@ namespace LED
         if (!is_initialized) return Status::InvalidState;
         if (id >= LED_COUNT || outColor == nullptr) return Status::InvalidParameters;
 
-        outColor->g = target_pixels[id * 3 + 0]; // WS2812 stores in GRB order
-        outColor->r = target_pixels[id * 3 + 1];
-        outColor->b = target_pixels[id * 3 + 2];
+        std::lock_guard<std::mutex> lock(engine_mutex);
+        *outColor = engine.getColor(id, Layer::Base, esp_timer_get_time());
         return Status::Ok;
     }
 
@@ -247,11 +259,11 @@ namespace LED
         if (!is_initialized) return Status::InvalidState;
         if (outColors == nullptr) return Status::InvalidParameters;
 
+        std::lock_guard<std::mutex> lock(engine_mutex);
+        int64_t now_us = esp_timer_get_time();
         for (Id i = 0; i < LED_COUNT; ++i)
         {
-            outColors[i].g = target_pixels[i * 3 + 0]; // WS2812 stores in GRB order
-            outColors[i].r = target_pixels[i * 3 + 1];
-            outColors[i].b = target_pixels[i * 3 + 2];
+            outColors[i] = engine.getColor(i, Layer::Base, now_us);
         }
         return Status::Ok;
     }
@@ -261,97 +273,127 @@ namespace LED
         if (!is_initialized) return Status::InvalidState;
         if (ids == nullptr || outColors == nullptr) return Status::InvalidParameters;
 
+        std::lock_guard<std::mutex> lock(engine_mutex);
+        int64_t now_us = esp_timer_get_time();
         for (uint8_t i = 0; i < count; ++i)
         {
             Id id = ids[i];
             if (id >= LED_COUNT) return Status::InvalidParameters;
-            outColors[i].g = target_pixels[id * 3 + 0]; // WS2812 stores in GRB order
-            outColors[i].r = target_pixels[id * 3 + 1];
-            outColors[i].b = target_pixels[id * 3 + 2];
+            outColors[i] = engine.getColor(id, Layer::Base, now_us);
         }
         return Status::Ok;
     }
 
-    TaskHandle_t errorLoopTask = nullptr;
+    // The error code task owns the Error layer of the first LED. LoopErrorCode() and clearErrorCode() only notify it
+    // (the code to show, or ERROR_CODE_NONE) : it is never deleted in the middle of a SetEffect() holding the engine mutex.
+    static TaskHandle_t error_task_handle = nullptr;
+    static constexpr uint32_t ERROR_CODE_NONE = 0x100; // above every uint8_t code
+    static constexpr uint8_t ERROR_INTENSITY = 10; // Maybe this could be in the config ?
+
+    void _error_task(void* param)
+    {
+        uint32_t code = ERROR_CODE_NONE;
+
+        // shows an effect for some time, false if a notification came meanwhile (and changed the code)
+        auto step = [&code](const Effect& effect, uint32_t duration_ms) {
+            SetEffect(0, Layer::Error, effect);
+            uint32_t value; // also written on a timeout : only taken from a notification
+            if (xTaskNotifyWait(0, UINT32_MAX, &value, pdMS_TO_TICKS(duration_ms)) != pdTRUE) return true;
+            code = value;
+            return false;
+        };
+
+        // one display of the code, cut short by a notification
+        auto show = [&step](uint8_t shown) {
+            // turn off first led and wait for 2 seconds
+            if (!step(Effect::Solid({0, 0, 0}), 2000)) return;
+            // turn first led on during 2 seconds (start of error code display)
+            if (!step(Effect::Fade({ERROR_INTENSITY, 0, 0}, 50), 2000)) return;
+            // turn off first led for 500ms before displaying error code
+            if (!step(Effect::Fade({0, 0, 0}, 50), 500)) return;
+
+            // Show error code in red and blue blinks (500ms per bit, off between bits)
+            for (uint8_t i = 0; i < 8; ++i)
+            {
+                Color bit = (shown & (1 << (7 - i))) ? Color(ERROR_INTENSITY, 0, 0) : Color(0, 0, ERROR_INTENSITY);
+                if (!step(Effect::Fade(bit, 50), 500)) return;
+                if (!step(Effect::Fade({0, 0, 0}, 50), 100)) return;
+            }
+        };
+
+        while (true)
+        {
+            if (code == ERROR_CODE_NONE)
+            {
+                // uncover the status color until the next code
+                ClearEffect(0, Layer::Error);
+                while (xTaskNotifyWait(0, UINT32_MAX, &code, portMAX_DELAY) != pdTRUE) {}
+                continue;
+            }
+            show(static_cast<uint8_t>(code));
+        }
+    }
+
     void LoopErrorCode(uint8_t errCode)
     {
-        xTaskCreatePinnedToCore([](void* pvParams){
-            uint8_t code = *((uint8_t*) pvParams);
-            // Maybe this could be in the config ?
-            #define LIGHT_INTENSITY 10
-            while (1)
+        if (error_task_handle == nullptr)
+        {
+            BaseType_t err = xTaskCreatePinnedToCore(_error_task, "LoopErrorCode", 2048, nullptr, tskIDLE_PRIORITY + 1, &error_task_handle, CORE_BRAIN);
+            if (err != pdPASS)
             {
-                // turn off first led and wait for 2 seconds
-                vTaskDelay(pdMS_TO_TICKS(2000));
-                
-                // turn first led on during 2 seconds (start of error code display)
-                SetColor(0, {LIGHT_INTENSITY, 0, 0}, 0.05f);
-                vTaskDelay(pdMS_TO_TICKS(2000));
-
-                // turn off first led for 500ms before displaying error code
-                SetColor(0, {0, 0, 0}, 0.05f);
-                vTaskDelay(pdMS_TO_TICKS(500));
-
-                // Show error code in red blinks (500ms per byte)
-                for (uint8_t i = 0; i < 8; ++i) {
-                    if (code & (1 << (7 - i))) {
-                        SetColor(0, {LIGHT_INTENSITY, 0, 0}, 0.05f); // Red for '1'
-                    } else {
-                        SetColor(0, {0, 0, LIGHT_INTENSITY}, 0.05f); // Blue for '0'
-                    }
-                    vTaskDelay(pdMS_TO_TICKS(500));
-                    SetColor(0, {0, 0, 0}, 0.05f); // Off between bits
-                    vTaskDelay(pdMS_TO_TICKS(100));
-                }
+                Error::RegisterErrorEvent(ErrorEventTaskInit(err));
+                error_task_handle = nullptr;
+                return;
             }
-        }, "LoopErrorCode", 2048, &errCode, tskIDLE_PRIORITY + 1, &errorLoopTask, CORE_BRAIN);
+        }
+        xTaskNotify(error_task_handle, errCode, eSetValueWithOverwrite);
     }
 
     void clearErrorCode()
     {
-        if (errorLoopTask != nullptr)
+        if (error_task_handle != nullptr)
         {
-            // Delete loop code task
-            vTaskDelete(errorLoopTask);
-            errorLoopTask = nullptr;
-            // turn off LED
-            SetColor(0, {0,0,0});
+            xTaskNotify(error_task_handle, ERROR_CODE_NONE, eSetValueWithOverwrite);
         }
     }
 
     void _update_task(void* param)
     {
-        TickType_t xLastWakeTime = xTaskGetTickCount();
-        const TickType_t xFrequency = pdMS_TO_TICKS(UPDATE_TASK_INTERVAL_MS);
+        uint8_t frame[EffectEngine::FRAME_SIZE];
 
         while (true)
         {
-            for (size_t i = 0; i < LED_COUNT * 3; ++i)
+            int64_t deadline_us;
+            bool changed;
             {
-                if (last_pixels[i] != target_pixels[i])
-                {
-                    if (last_pixels[i] < target_pixels[i])
-                    {
-                        last_pixels[i] += std::min(adder_pixels[i], static_cast<uint8_t>(target_pixels[i] - last_pixels[i]));
-                    } else
-                    {
-                        last_pixels[i] -= std::min(adder_pixels[i], static_cast<uint8_t>(last_pixels[i] - target_pixels[i]));
-                    }
-                }
+                std::lock_guard<std::mutex> lock(engine_mutex);
+                changed = engine.render(esp_timer_get_time(), frame, deadline_us);
             }
 
-            ESP_ERROR_CHECK(rmt_tx_wait_all_done(rmt_tx_channel, portMAX_DELAY));
+            // the strip keeps its colors : only changes are sent
+            if (changed)
+            {
+                ESP_ERROR_CHECK(rmt_tx_wait_all_done(rmt_tx_channel, portMAX_DELAY));
+
+                memcpy(rmt_buffer[current_buffer_idx], frame, sizeof(frame));
+
+                esp_err_t err = rmt_transmit(rmt_tx_channel, rmt_bytes_encoder, rmt_buffer[current_buffer_idx], sizeof(frame), &transmit_config);
+                if (err != ESP_OK)
+                {
+                    LOG_ERROR(TAG, "RMT TX transmit failed: %s", esp_err_to_name(err));
+                }
 
-            memcpy(rmt_buffer[current_buffer_idx], last_pixels, sizeof(last_pixels));
+                current_buffer_idx = (current_buffer_idx + 1) % 2;
+            }
 
-            esp_err_t err = rmt_transmit(rmt_tx_channel, rmt_bytes_encoder, rmt_buffer[current_buffer_idx], sizeof(last_pixels), &transmit_config);
-            if (err != ESP_OK)
+            // sleep until the next change of an effect, or until a new effect is set
+            TickType_t wait = portMAX_DELAY;
+            if (deadline_us != EffectEngine::NO_DEADLINE)
             {
-                LOG_ERROR(TAG, "RMT TX transmit failed: %s", esp_err_to_name(err));
+                int64_t delay_us = deadline_us - esp_timer_get_time();
+                wait = delay_us <= 0 ? 0 : pdMS_TO_TICKS(static_cast<uint32_t>((delay_us + 999) / 1000));
             }
-            
-            current_buffer_idx = (current_buffer_idx + 1) % 2;
-            xTaskDelayUntil(&xLastWakeTime, xFrequency);
+            ulTaskNotifyTake(pdTRUE, wait);
         }
     }
 }
\ No newline at end of file
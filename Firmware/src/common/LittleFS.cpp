@@ -6,7 +6,6 @@
 namespace LittleFS
 {
     bool initialized = false;
-    constexpr const char* ROOT_FOLDER = "/storage";
     constexpr const char* TAG = "LittleFS";
 
     Status Init()
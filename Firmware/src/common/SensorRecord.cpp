@@ -0,0 +1,142 @@
+#include "common/SensorRecord.hpp"
+#include "common/Log.hpp"
+#include <algorithm>
+
+namespace SensorRecord
+{
+    constexpr const char* TAG = "SensorRecord";
+
+    Writer::~Writer()
+    {
+        close();
+    }
+
+    Status Writer::open(const char* path, uint16_t loop_freq_hz)
+    {
+        if (file != nullptr)
+        {
+            return Status::InvalidState;
+        }
+
+        file = fopen(path, "wb");
+        if (file == nullptr)
+        {
+            LOG_ERROR(TAG, "Cannot create recording file %s", path);
+            return Status::NotFound;
+        }
+
+        FileHeader header = {};
+        header.magic = MAGIC;
+        header.version = VERSION;
+        header.loop_freq_hz = loop_freq_hz;
+        header.analog_channels = 16;
+        if (fwrite(&header, sizeof(header), 1, file) != 1)
+        {
+            close();
+            return Status::Failure;
+        }
+        size = sizeof(header);
+        return Status::Ok;
+    }
+
+    Status Writer::write(Type type, int64_t timestamp_us, const void* payload, uint16_t length)
+    {
+        if (file == nullptr)
+        {
+            return Status::InvalidState;
+        }
+
+        RecordHeader header = { type, 0, length, timestamp_us };
+        if (fwrite(&header, sizeof(header), 1, file) != 1 ||
+            (length > 0 && fwrite(payload, length, 1, file) != 1))
+        {
+            return Status::Failure;
+        }
+        size += sizeof(header) + length;
+        return Status::Ok;
+    }
+
+    Status Writer::close()
+    {
+        if (file == nullptr)
+        {
+            return Status::Ok;
+        }
+        int err = fclose(file);
+        file = nullptr;
+        return err == 0 ? Status::Ok : Status::Failure;
+    }
+
+    Reader::~Reader()
+    {
+        close();
+    }
+
+    Status Reader::open(const char* path)
+    {
+        if (file != nullptr)
+        {
+            return Status::InvalidState;
+        }
+
+        file = fopen(path, "rb");
+        if (file == nullptr)
+        {
+            return Status::NotFound;
+        }
+
+        if (fread(&file_header, sizeof(file_header), 1, file) != 1 ||
+            file_header.magic != MAGIC || file_header.version != VERSION)
+        {
+            LOG_ERROR(TAG, "%s is not a sensor recording (or an unsupported version)", path);
+            close();
+            return Status::InvalidParameters;
+        }
+        return Status::Ok;
+    }
+
+    Status Reader::next(RecordHeader& header, void* payload)
+    {
+        if (file == nullptr)
+        {
+            return Status::InvalidState;
+        }
+
+        if (fread(&header, sizeof(header), 1, file) != 1)
+        {
+            return Status::NotFound;
+        }
+
+        uint16_t kept = std::min(header.length, MAX_PAYLOAD_SIZE);
+        if (kept > 0 && fread(payload, kept, 1, file) != 1)
+        {
+            return Status::NotFound; // truncated record, the recording was probably cut
+        }
+        if (header.length > kept && fseek(file, header.length - kept, SEEK_CUR) != 0)
+        {
+            return Status::NotFound;
+        }
+        header.length = kept;
+        return Status::Ok;
+    }
+
+    Status Reader::close()
+    {
+        if (file == nullptr)
+        {
+            return Status::Ok;
+        }
+        fclose(file);
+        file = nullptr;
+        return Status::Ok;
+    }
+
+    Status Reader::rewind()
+    {
+        if (file == nullptr)
+        {
+            return Status::InvalidState;
+        }
+        return fseek(file, sizeof(FileHeader), SEEK_SET) == 0 ? Status::Ok : Status::Failure;
+    }
+}
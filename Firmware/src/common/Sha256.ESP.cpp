@@ -0,0 +1,39 @@
+#include "common/Sha256.hpp"
+#include "mbedtls/sha256.h"
+
+struct Sha256::Context
+{
+    mbedtls_sha256_context sha;
+};
+
+Sha256::Sha256() : context(new Context)
+{
+    mbedtls_sha256_init(&context->sha);
+    mbedtls_sha256_starts(&context->sha, 0);
+}
+
+Sha256::~Sha256()
+{
+    mbedtls_sha256_free(&context->sha);
+    delete context;
+}
+
+void Sha256::reset()
+{
+    mbedtls_sha256_starts(&context->sha, 0);
+}
+
+void Sha256::update(const uint8_t* data, size_t size)
+{
+    mbedtls_sha256_update(&context->sha, data, size);
+}
+
+void Sha256::finish(uint8_t out[SIZE])
+{
+    mbedtls_sha256_finish(&context->sha, out);
+}
+
+void Sha256::Hash(const uint8_t* data, size_t size, uint8_t out[SIZE])
+{
+    mbedtls_sha256(data, size, out, 0);
+}
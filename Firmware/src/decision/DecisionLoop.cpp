@@ -2,9 +2,20 @@
 #include "esp_log_timestamp.h"
 #include "common/config.hpp"
 #include "common/Log.hpp"
+#include "Robot.hpp"
 
 Status DecisionLoop::init()
 {
+    if (vision_events == nullptr)
+    {
+        vision_events = xQueueCreate(VISION_EVENT_QUEUE_SIZE, sizeof(VisionEvent));
+        if (vision_events == nullptr)
+        {
+            LOG_ERROR(TAG, "Error creating the vision events queue");
+            return Status::NoMemory;
+        }
+    }
+
     // ErrorHandle(ErrorStruct::DecisionLoopInitFailed);
     // FIXME : Maybe we should create the task here and just keep it suspended until start() is called
     return Status::Ok;
@@ -17,6 +28,11 @@ Status DecisionLoop::deinit()
         vTaskDelete(decision_loop_task);
         decision_loop_task = nullptr;
     }
+    if (vision_events != nullptr)
+    {
+        vQueueDelete(vision_events);
+        vision_events = nullptr;
+    }
 
     return Status::Ok;
 }
@@ -114,6 +130,29 @@ Status DecisionLoop::askJointAngle(Joint::Id joint_id, float angle_rad, IPC::Ove
     return Status::Ok;
 }
 
+Status DecisionLoop::express(Tunes::Voice voice)
+{
+    if (voice >= Tunes::Voice::Count)
+    {
+        return Status::InvalidParameters;
+    }
+    return Robot::GetInstance().getAudioManager().play(Tunes::GetVoice(voice));
+}
+
+Status DecisionLoop::postVisionEvent(MotionAnalyzer::Event event, float x)
+{
+    if (vision_events == nullptr)
+    {
+        return Status::InvalidState;
+    }
+    VisionEvent vision_event = {event, x};
+    if (xQueueSend(vision_events, &vision_event, 0) != pdTRUE)
+    {
+        return Status::NoMemory;
+    }
+    return Status::Ok;
+}
+
 void DecisionLoop::decision_loop()
 {
     TickType_t xLastWakeTime = xTaskGetTickCount();
@@ -8,6 +8,8 @@
 
 void DecisionLoop::update(float dt, const IPC::RobotState& state)
 {
+    handleVisionEvents();
+
     // TODO : Implement
     // PowerDriver::ReadData();
     // PowerDriver::Data data = PowerDriver::GetData();
@@ -16,6 +18,37 @@ void DecisionLoop::update(float dt, const IPC::RobotState& state)
     // - The BMS on the battery pack cuts power at 9V
 }
 
+void DecisionLoop::handleVisionEvents()
+{
+    VisionEvent vision_event;
+    while (vision_events != nullptr && xQueueReceive(vision_events, &vision_event, 0) == pdTRUE)
+    {
+        LOG_INFO(TAG, "Vision : %s (x %.2f)", MotionAnalyzer::EventName(vision_event.event), vision_event.x);
+        if (!(auto_life_level & AutoLifeFlags::Animate))
+        {
+            continue;
+        }
+
+        // TODO : turn the head towards the motion once the head poses exist
+        switch (vision_event.event)
+        {
+            case MotionAnalyzer::Event::MotionLeft:
+            case MotionAnalyzer::Event::MotionCenter:
+            case MotionAnalyzer::Event::MotionRight:
+                express(Tunes::Voice::Curious);
+                break;
+            case MotionAnalyzer::Event::Lifted:
+                express(Tunes::Voice::Surprised);
+                break;
+            case MotionAnalyzer::Event::Covered:
+                express(Tunes::Voice::Sleepy);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
 void DecisionLoop::fillIntent(IPC::ControlIntent& intent, const IPC::RobotState& state)
 {
     // TODO : Implement
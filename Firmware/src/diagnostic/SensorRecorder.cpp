@@ -0,0 +1,215 @@
+#include "diagnostic/SensorRecorder.hpp"
+#include "common/SensorRecord.hpp"
+#include "common/config.hpp"
+#include "common/Log.hpp"
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include <esp_timer.h>
+#include <atomic>
+#include <cstring>
+
+namespace SensorRecorder
+{
+    struct Sample
+    {
+        SensorRecord::RecordHeader header;
+        uint8_t payload[SensorRecord::MAX_PAYLOAD_SIZE];
+    };
+
+    static uint8_t queue_buffer[RECORDER_QUEUE_SIZE * sizeof(Sample)];
+    static StaticQueue_t queue_struct;
+    QueueHandle_t queue = nullptr;
+
+    SensorRecord::Writer writer;
+    TaskHandle_t writer_task_handle = nullptr;
+
+    // shared between the control loop (producer) and the writer task
+    std::atomic<bool> accepting(false);
+    std::atomic<bool> recording(false);
+    std::atomic<bool> stop_requested(false);
+    std::atomic<uint32_t> dropped(0);
+
+    std::atomic<uint32_t> records(0);
+    std::atomic<uint32_t> bytes(0);
+    std::atomic<int64_t> last_us(0);
+    int64_t start_us = 0;
+    uint32_t max_duration_ms = 0;
+
+    /**
+     * @brief Read the power sensor and record it, every RECORDER_POWER_PERIOD_MS.
+     * @note Called by the writer task : the INA219 is read on the brain core like everywhere else, not in a control tick.
+     *       Queued behind the samples of the control loop, the record keeps the file in timestamp order.
+     */
+    static void sample_power(int64_t& next_power_us)
+    {
+        int64_t now_us = esp_timer_get_time();
+        if (!accepting || now_us < next_power_us)
+        {
+            return;
+        }
+        next_power_us = now_us + RECORDER_POWER_PERIOD_MS * 1000;
+
+        if (PowerDriver::ReadData() == Status::Ok)
+        {
+            PowerDriver::Data data = PowerDriver::GetData();
+            RecordPower(esp_timer_get_time(), data);
+        }
+    }
+
+    static void writer_task(void*)
+    {
+        Sample sample;
+        int64_t next_power_us = 0;
+        while (true)
+        {
+            sample_power(next_power_us);
+
+            if (xQueueReceive(queue, &sample, pdMS_TO_TICKS(50)) == pdTRUE)
+            {
+                if (writer.write(sample.header.type, sample.header.timestamp_us, sample.payload, sample.header.length) != Status::Ok)
+                {
+                    LOG_ERROR(TAG, "Failed to write to the recording file (file system full ?), stopping");
+                    stop_requested = true;
+                }
+                else
+                {
+                    records++;
+                    bytes = writer.getSize();
+                    last_us = sample.header.timestamp_us;
+                    if (max_duration_ms > 0 && (last_us - start_us) / 1000 >= max_duration_ms)
+                    {
+                        stop_requested = true;
+                    }
+                }
+            }
+            else if (stop_requested) // queue drained
+            {
+                break;
+            }
+
+            if (stop_requested)
+            {
+                accepting = false;
+            }
+        }
+
+        writer.close();
+        LOG_INFO(TAG, "Recording done : %lu records, %lu bytes, %lu dropped samples",
+            (unsigned long) records.load(), (unsigned long) bytes.load(), (unsigned long) dropped.load());
+        recording = false;
+        writer_task_handle = nullptr;
+        vTaskDelete(nullptr);
+    }
+
+    Status Start(const char* path, uint32_t duration_ms)
+    {
+        LOG_SCOPE(TAG, "SensorRecorder::Start [path=%s]", path);
+
+        if (recording)
+        {
+            return Status::InvalidState;
+        }
+
+        if (queue == nullptr)
+        {
+            queue = xQueueCreateStatic(RECORDER_QUEUE_SIZE, sizeof(Sample), queue_buffer, &queue_struct);
+            if (queue == nullptr)
+            {
+                return Status::NoMemory;
+            }
+        }
+        xQueueReset(queue);
+
+        if (Status err = writer.open(path, CONTROL_LOOP_FREQ_HZ); err != Status::Ok)
+        {
+            return err;
+        }
+
+        records = 0;
+        bytes = writer.getSize();
+        dropped = 0;
+        start_us = esp_timer_get_time();
+        last_us = start_us;
+        max_duration_ms = duration_ms;
+        stop_requested = false;
+        recording = true;
+
+        if (xTaskCreatePinnedToCore(writer_task, "SensorRecorder", 4096, nullptr, tskIDLE_PRIORITY + 1, &writer_task_handle, CORE_BRAIN) != pdPASS)
+        {
+            LOG_ERROR(TAG, "Failed to create the writer task");
+            writer.close();
+            recording = false;
+            return Status::Failure;
+        }
+
+        accepting = true;
+        return Status::Ok;
+    }
+
+    Status Stop()
+    {
+        if (!recording)
+        {
+            return Status::InvalidState;
+        }
+        accepting = false;
+        stop_requested = true;
+        return Status::Ok;
+    }
+
+    bool IsRecording()
+    {
+        return recording;
+    }
+
+    Stats GetStats()
+    {
+        Stats stats;
+        stats.recording = recording;
+        stats.records = records;
+        stats.dropped = dropped;
+        stats.pending = queue != nullptr ? uxQueueMessagesWaiting(queue) : 0;
+        stats.bytes = bytes;
+        stats.duration_ms = static_cast<uint32_t>((last_us - start_us) / 1000);
+        return stats;
+    }
+
+    static void push(SensorRecord::Type type, int64_t timestamp_us, const void* payload, uint16_t length)
+    {
+        if (!accepting)
+        {
+            return;
+        }
+
+        Sample sample;
+        sample.header = { type, 0, length, timestamp_us };
+        memcpy(sample.payload, payload, length);
+        if (xQueueSend(queue, &sample, 0) != pdTRUE)
+        {
+            dropped++;
+        }
+    }
+
+    void RecordAnalog(int64_t timestamp_us, const AnalogDriver::Value* raw_voltages)
+    {
+        static_assert(sizeof(AnalogDriver::Value) * AnalogDriver::CHANNEL_COUNT <= SensorRecord::MAX_PAYLOAD_SIZE);
+        push(SensorRecord::Type::Analog, timestamp_us, raw_voltages, sizeof(AnalogDriver::Value) * AnalogDriver::CHANNEL_COUNT);
+    }
+
+    void RecordIMU(int64_t timestamp_us, const IMUDriver::IMUData& data)
+    {
+        push(SensorRecord::Type::IMU, timestamp_us, &data, sizeof(data));
+    }
+
+    void RecordPower(int64_t timestamp_us, const PowerDriver::Data& data)
+    {
+        push(SensorRecord::Type::Power, timestamp_us, &data, sizeof(data));
+    }
+
+    void RecordMotor(int64_t timestamp_us, const MotorDriver::Value* duty_cycles)
+    {
+        static_assert(sizeof(MotorDriver::Value) * MotorDriver::CHANNEL_COUNT <= SensorRecord::MAX_PAYLOAD_SIZE);
+        push(SensorRecord::Type::Motor, timestamp_us, duty_cycles, sizeof(MotorDriver::Value) * MotorDriver::CHANNEL_COUNT);
+    }
+}
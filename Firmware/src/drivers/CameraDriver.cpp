@@ -3,6 +3,7 @@
 #include "common/I2C.hpp"
 #include "Robot.hpp"
 #include "drivers/CameraDriver.Error.hpp"
+#include "network/protocol/CameraFrames.hpp"
 #include "driver/i2c_master.h"
 #include "esp_timer.h"
 
@@ -35,9 +36,9 @@ static camera_config_t camera_config = {
     .frame_size = FRAMESIZE_VGA,
 
     .jpeg_quality = 20,
-    .fb_count = 1,
+    .fb_count = CAMERA_RING_SIZE + 1, // frames held by the stream clients, and one for the sensor
     .fb_location = CAMERA_FB_IN_PSRAM, // We have external PSRAM, use it :)
-    .grab_mode = CAMERA_GRAB_WHEN_EMPTY,
+    .grab_mode = CAMERA_GRAB_LATEST,
 
     .sccb_i2c_port = I2C_NUM_1, // using secondary i2c bus (the "slow" one)
 };
@@ -103,60 +104,284 @@ esp_err_t jpg_httpd_handler(httpd_req_t *req)
     return res;
 }
 
-esp_err_t stream_handler(httpd_req_t *req)
+/// @brief Frames of the camera driver, held in its frame buffers until every stream client sent them
+class EspCameraSource : public CameraStream::Source
 {
-    camera_fb_t *fb = nullptr;
-    esp_err_t res = ESP_OK;
-    char *part_buf[128];
-
-    // Send multipart header
-    res = httpd_resp_set_type(req, "multipart/x-mixed-replace;boundary=" "____boundary____");
-    if (res != ESP_OK) return res;
-
-    // int64_t last_frame_time = esp_timer_get_time();
-
-    while (true)
+public:
+    Status capture(CameraStream::Frame& out) override
     {
-        // Get the image
-        fb = esp_camera_fb_get();
+        camera_fb_t* fb = esp_camera_fb_get();
         if (!fb)
         {
             LOG_WARNING(TAG, "Failed to get camera capture");
-            res = ESP_FAIL;
             Error::RegisterErrorEvent(ErrorEventCameraCaptureFailed());
-            break;
+            return Status::Failure;
+        }
+
+        out.data = fb->buf;
+        out.size = fb->len;
+        out.width = fb->width;
+        out.height = fb->height;
+        // stamped by the camera driver with esp_timer_get_time() when the frame started
+        out.timestamp_us = fb->timestamp.tv_sec * 1000000ll + fb->timestamp.tv_usec;
+        out.handle = fb;
+        return Status::Ok;
+    }
+
+    void release(CameraStream::Frame& frame) override
+    {
+        esp_camera_fb_return(static_cast<camera_fb_t*>(frame.handle));
+    }
+};
+
+struct StreamClient
+{
+    CameraDriver* driver;
+    httpd_req_t* req;
+    int client;
+};
+
+esp_err_t CameraDriver::stream_handler(httpd_req_t *req)
+{
+    CameraDriver* self = static_cast<CameraDriver*>(req->user_ctx);
+
+    int client = self->stream->subscribe();
+    if (client < 0)
+    {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        return httpd_resp_send(req, "Too many stream clients", HTTPD_RESP_USE_STRLEN);
+    }
+
+    // the stream goes on in its own task, the server keeps handling the other clients
+    httpd_req_t* async_req = nullptr;
+    if (httpd_req_async_handler_begin(req, &async_req) != ESP_OK)
+    {
+        self->stream->unsubscribe(client);
+        return ESP_FAIL;
+    }
+    StreamClient* param = new StreamClient{ self, async_req, client };
+    if (xTaskCreatePinnedToCore(client_task, "cameraClient", CAMERA_CLIENT_STACK_SIZE, param, CAMERA_CLIENT_PRIORITY, nullptr, CORE_BRAIN) != pdPASS)
+    {
+        LOG_ERROR(TAG, "Failed to create stream client task");
+        self->stream->unsubscribe(client);
+        httpd_req_async_handler_complete(async_req);
+        delete param;
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+void CameraDriver::client_task(void* param)
+{
+    StreamClient* stream_client = static_cast<StreamClient*>(param);
+    httpd_req_t* req = stream_client->req;
+    CameraStream& stream = *stream_client->driver->stream;
+
+    httpd_resp_set_type(req, CameraStream::CONTENT_TYPE);
+    Status err = stream.serve(stream_client->client, [req](const uint8_t* data, size_t size) {
+        return httpd_resp_send_chunk(req, reinterpret_cast<const char*>(data), size) == ESP_OK;
+    });
+    if (err != Status::InvalidState)
+    {
+        httpd_resp_send_chunk(req, NULL, 0);
+    }
+
+    CameraStream::ClientStats stats;
+    if (stream.getClientStats(stream_client->client, stats))
+    {
+        LOG_INFO(TAG, "Stream client %d : %lu frames, %lu dropped", stream_client->client, static_cast<unsigned long>(stats.frames), static_cast<unsigned long>(stats.dropped));
+    }
+    stream.unsubscribe(stream_client->client);
+    httpd_req_async_handler_complete(req);
+    delete stream_client;
+    vTaskDelete(NULL);
+}
+
+Status CameraDriver::subscribe(Protocol::ITransport* transport, void* context, uint16_t chunk_size)
+{
+    ProtocolClient* slot = nullptr;
+    for (ProtocolClient& protocol_client : protocol_clients)
+    {
+        bool used = protocol_client.used;
+        if (used && protocol_client.active && protocol_client.transport == transport && protocol_client.context == context)
+        {
+            return Status::InvalidState;
+        }
+        if (!used && slot == nullptr) slot = &protocol_client;
+    }
+    if (slot == nullptr) return Status::OutOfBounds;
+
+    slot->used = true;
+    chunk_size = Protocol::CameraFrames::ChunkSize(chunk_size);
+    if (slot->sent == nullptr) slot->sent = xSemaphoreCreateBinary();
+    slot->buffer = static_cast<uint8_t*>(heap_caps_malloc(Protocol::CameraFrames::MessageSize(chunk_size), MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL));
+    if (slot->sent == nullptr || slot->buffer == nullptr)
+    {
+        heap_caps_free(slot->buffer);
+        slot->buffer = nullptr;
+        slot->used = false;
+        return Status::NoMemory;
+    }
+    xSemaphoreTake(slot->sent, 0); // given late by a chunk of the previous client
+
+    slot->client = stream->subscribe();
+    if (slot->client < 0)
+    {
+        heap_caps_free(slot->buffer);
+        slot->buffer = nullptr;
+        slot->used = false;
+        return Status::OutOfBounds;
+    }
+    slot->driver = this;
+    slot->transport = transport;
+    slot->context = context;
+    slot->chunk_size = chunk_size;
+    slot->active = true;
+    slot->refs = 1;
+    if (xTaskCreatePinnedToCore(protocol_client_task, "cameraProtocol", CAMERA_CLIENT_STACK_SIZE, slot, CAMERA_CLIENT_PRIORITY, nullptr, CORE_BRAIN) != pdPASS)
+    {
+        LOG_ERROR(TAG, "Failed to create protocol stream client task");
+        stream->unsubscribe(slot->client);
+        release(*slot);
+        return Status::Failure;
+    }
+    return Status::Ok;
+}
+
+Status CameraDriver::unsubscribe(Protocol::ITransport* transport, void* context)
+{
+    for (ProtocolClient& protocol_client : protocol_clients)
+    {
+        if (protocol_client.used && protocol_client.active && protocol_client.transport == transport && protocol_client.context == context)
+        {
+            protocol_client.active = false;
+            return Status::Ok;
         }
+    }
+    return Status::NotFound;
+}
 
-        size_t hlen = snprintf((char *)part_buf, 128, 
-            "--%s\r\nContent-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n", 
-            "____boundary____", fb->len);
-        
-        // Send image header
-        res = httpd_resp_send_chunk(req, (const char *)part_buf, hlen);
-        if (res != ESP_OK)
+bool CameraDriver::getSubscriptionStats(Protocol::ITransport* transport, void* context, CameraStream::ClientStats& out) const
+{
+    for (const ProtocolClient& protocol_client : protocol_clients)
+    {
+        if (protocol_client.used && protocol_client.active && protocol_client.transport == transport && protocol_client.context == context)
         {
-            esp_camera_fb_return(fb);
-            break; // disconnected
+            return stream->getClientStats(protocol_client.client, out);
         }
+    }
+    return false;
+}
+
+void CameraDriver::protocol_client_task(void* param)
+{
+    ProtocolClient& protocol_client = *static_cast<ProtocolClient*>(param);
+    CameraStream& stream = *protocol_client.driver->stream;
+
+    Status err = Protocol::CameraFrames::Serve(stream, protocol_client.client, protocol_client.chunk_size, protocol_client.buffer,
+        [](uint32_t& tick, int64_t& tick_us) {
+            const IPC::RobotState& state = Robot::GetInstance().getDecisionLoop().getRobotState();
+            tick = state.tick;
+            tick_us = state.timestamp_us;
+        },
+        [&protocol_client](const uint8_t* message, size_t size) {
+            if (!protocol_client.active) return false;
+
+            // the buffer is held by the transport until the chunk is sent, even after a timeout
+            protocol_client.refs++;
+            if (protocol_client.transport->sendMessage(protocol_client.context, message, size, chunk_sent, &protocol_client) != Status::Ok)
+            {
+                protocol_client.refs--;
+                return false;
+            }
+            if (xSemaphoreTake(protocol_client.sent, pdMS_TO_TICKS(CAMERA_CHUNK_TIMEOUT_MS)) != pdTRUE)
+            {
+                LOG_WARNING(TAG, "Protocol stream client %d : chunk not sent in time", protocol_client.client);
+                return false;
+            }
+            return protocol_client.sent_ok;
+        });
+
+    CameraStream::ClientStats stats;
+    if (stream.getClientStats(protocol_client.client, stats))
+    {
+        LOG_INFO(TAG, "Protocol stream client %d (%s) : %lu frames, %lu dropped", protocol_client.client, err == Status::Ok ? "stopped" : "ended",
+                 static_cast<unsigned long>(stats.frames), static_cast<unsigned long>(stats.dropped));
+    }
+    stream.unsubscribe(protocol_client.client);
+    protocol_client.active = false;
+    release(protocol_client);
+    vTaskDelete(NULL);
+}
+
+void CameraDriver::chunk_sent(void* param, bool sent)
+{
+    ProtocolClient& protocol_client = *static_cast<ProtocolClient*>(param);
+    protocol_client.sent_ok = sent;
+    xSemaphoreGive(protocol_client.sent);
+    release(protocol_client);
+}
+
+void CameraDriver::release(ProtocolClient& protocol_client)
+{
+    if (--protocol_client.refs > 0) return;
+    heap_caps_free(protocol_client.buffer);
+    protocol_client.buffer = nullptr;
+    protocol_client.used = false;
+}
+
+static framesize_t frame_size(uint16_t width)
+{
+    switch (width)
+    {
+        case 160: return FRAMESIZE_QQVGA;
+        case 320: return FRAMESIZE_QVGA;
+        case 480: return FRAMESIZE_HVGA;
+        default: return FRAMESIZE_VGA;
+    }
+}
 
-        // Send image data
-        res = httpd_resp_send_chunk(req, (const char *)fb->buf, fb->len);
-        
-        // Free camera buffer
-        esp_camera_fb_return(fb);
-        
-        if (res != ESP_OK)
+void CameraDriver::run_rate_control()
+{
+    // notified by stop()
+    while (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(CAMERA_CONTROL_INTERVAL_MS)) == 0)
+    {
+        for (int i = 0; i < CAMERA_MAX_CLIENTS; i++)
         {
-            break;
+            CameraStream::ClientStats stats;
+            if (stream->getClientStats(i, stats)) rate_controller.observe(i, stats);
         }
 
-        // TODO : Fixed framerate with delay
+        CameraRateController::Settings previous = rate_controller.getSettings();
+        CameraRateController::Settings settings = rate_controller.update(esp_timer_get_time(), Robot::GetInstance().getControlLoop().getLoad());
+        apply(settings, previous);
     }
+}
 
-    return res;
+void CameraDriver::apply(const CameraRateController::Settings& settings, const CameraRateController::Settings& previous)
+{
+    if (settings.level != previous.level)
+    {
+        const CameraRateController::Level& level = CameraRateController::LEVELS[settings.level];
+        CameraRateController::Measures measures = rate_controller.getMeasures();
+        LOG_INFO(TAG, "Stream level %u -> %u (%ux%u, quality %u), link %.0f KB/s, frames %.1f KB", previous.level, settings.level,
+                 level.width, level.height, level.quality, measures.link_bytes_per_s / 1024.0f, measures.frame_bytes / 1024.0f);
+        sensor->set_framesize(sensor, frame_size(level.width));
+        sensor->set_quality(sensor, level.quality);
+    }
+    if (settings.frame_rate != previous.frame_rate)
+    {
+        stream->setFrameRate(settings.frame_rate);
+    }
+    if (settings.pressure != previous.pressure && capture_task != nullptr)
+    {
+        LOG_INFO(TAG, "Control loop %s, stream at %.0f fps", settings.pressure ? "late" : "relieved", settings.frame_rate);
+        vTaskPrioritySet(capture_task, settings.pressure ? CAMERA_PRESSURE_TASK_PRIORITY : CAMERA_TASK_PRIORITY);
+    }
 }
 
 CameraDriver::CameraDriver()
+    : source(std::make_unique<EspCameraSource>()), stream(std::make_unique<CameraStream>(*source))
 {
 }
 
@@ -211,11 +436,32 @@ Status CameraDriver::deinit()
 
 Status CameraDriver::start()
 {
+    // Start the capture task, idle until a client comes
+    stream->restart();
+    if (xTaskCreatePinnedToCore([](void* param) {
+        static_cast<CameraDriver*>(param)->stream->runCapture();
+        static_cast<CameraDriver*>(param)->capture_task = nullptr;
+        vTaskDelete(NULL);
+    }, "cameraCapture", CAMERA_TASK_STACK_SIZE, this, CAMERA_TASK_PRIORITY, &capture_task, CORE_BRAIN) != pdPASS)
+    {
+        LOG_ERROR(TAG, "Failed to create capture task");
+        return Status::Failure;
+    }
+    if (xTaskCreatePinnedToCore([](void* param) {
+        static_cast<CameraDriver*>(param)->run_rate_control();
+        static_cast<CameraDriver*>(param)->control_task = nullptr;
+        vTaskDelete(NULL);
+    }, "cameraControl", CAMERA_TASK_STACK_SIZE, this, CAMERA_TASK_PRIORITY, &control_task, CORE_BRAIN) != pdPASS)
+    {
+        LOG_ERROR(TAG, "Failed to create camera control task");
+        return Status::Failure;
+    }
+
     // Start the camera stream server
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-    config.server_port = 90; // FIXME : This port shouldn't be hardcoded
+    config.server_port = CAMERA_STREAM_PORT;
     config.max_uri_handlers = 8;
-    config.ctrl_port = 90 + 1;
+    config.ctrl_port = CAMERA_STREAM_PORT + 1;
     config.uri_match_fn = httpd_uri_match_wildcard;
     config.max_open_sockets = 6;
     config.lru_purge_enable = true;
@@ -233,7 +479,7 @@ Status CameraDriver::start()
     httpd_uri_t catch_all_uri = {
         .uri       = "/*", // Wildcard
         .method    = HTTP_GET,
-        .handler   = stream_handler,
+        .handler   = CameraDriver::stream_handler,
         .user_ctx  = this,
         .is_websocket = false,
         .handle_ws_control_frames = false,
@@ -251,6 +497,14 @@ Status CameraDriver::start()
 
 Status CameraDriver::stop()
 {
+    // the client tasks end their streams and the capture task returns
+    stream->stop();
+    if (control_task != nullptr) xTaskNotifyGive(control_task);
+    for (int i = 0; i < 100 && (stream->getStats().clients > 0 || capture_task != nullptr || control_task != nullptr); i++)
+    {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+
     if (server)
     {
         if (esp_err_t err = httpd_stop(server); err != ESP_OK)
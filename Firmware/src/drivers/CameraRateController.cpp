@@ -0,0 +1,143 @@
+#include "drivers/CameraRateController.hpp"
+#include <algorithm>
+
+// weight of the last update in the measured frame size scale, and its bounds
+constexpr float SCALE_SMOOTHING = 0.3f;
+constexpr float SCALE_MIN = 0.3f;
+constexpr float SCALE_MAX = 3.0f;
+// the slowest client is late when it sends less than this part of the frame rate while busy sending that part of the time
+constexpr float LATE_FPS = 0.85f;
+constexpr float BUSY_LINK = 0.9f;
+
+CameraRateController::CameraRateController(float frame_rate, uint8_t level)
+    : target_fps(frame_rate)
+{
+    settings = { std::min<uint8_t>(level, LEVEL_COUNT - 1), frame_rate, false };
+    measures.scale = 1.0f;
+}
+
+void CameraRateController::observe(int client, const CameraStream::ClientStats& client_stats)
+{
+    if (client < 0 || client >= CAMERA_MAX_CLIENTS) return;
+    clients[client].seen = true;
+    clients[client].current = client_stats;
+}
+
+CameraRateController::Settings CameraRateController::update(int64_t now_us, float control_load)
+{
+    int64_t dt_us = last_update_us < 0 ? 0 : now_us - last_update_us;
+    last_update_us = now_us;
+
+    // deadline pressure, entered at once and left once the control loop stays relieved
+    if (!settings.pressure && control_load >= CAMERA_PRESSURE_LOAD)
+    {
+        settings.pressure = true;
+        release_count = 0;
+    }
+    else if (settings.pressure)
+    {
+        release_count = control_load < CAMERA_PRESSURE_RELEASE_LOAD ? release_count + 1 : 0;
+        if (release_count >= CAMERA_UP_UPDATES) settings.pressure = false;
+    }
+    if (settings.pressure) stats.pressure_updates++;
+    settings.frame_rate = settings.pressure ? std::min(CAMERA_PRESSURE_FRAME_RATE, target_fps) : target_fps;
+
+    // what each client sent since the last update
+    float slowest_fps = 0.0f;
+    float slowest_link = 0.0f;
+    float slowest_busy = 0.0f;
+    uint64_t bytes = 0;
+    uint32_t frames = 0;
+    uint32_t latency_us = 0;
+    bool measured = false;
+    for (Observed& c : clients)
+    {
+        if (!c.seen)
+        {
+            c.has_baseline = false;
+            continue;
+        }
+
+        if (c.has_baseline && c.last.since_us == c.current.since_us && dt_us > 0)
+        {
+            uint32_t df = c.current.frames - c.last.frames;
+            uint64_t db = c.current.bytes - c.last.bytes;
+            uint64_t dbusy = c.current.busy_us - c.last.busy_us;
+            float fps = df * 1e6f / dt_us;
+            float link = dbusy > 0 ? db * 1e6f / dbusy : 0.0f;
+            if (!measured || fps < slowest_fps)
+            {
+                slowest_fps = fps;
+                slowest_busy = static_cast<float>(dbusy) / dt_us;
+            }
+            if (df > 0 && (slowest_link == 0.0f || link < slowest_link)) slowest_link = link;
+            if (df > 0) latency_us = std::max(latency_us, c.current.latency_us);
+            bytes += db;
+            frames += df;
+            measured = true;
+        }
+        c.last = c.current;
+        c.has_baseline = true;
+        c.seen = false;
+    }
+    if (!measured || frames == 0 || slowest_link <= 0.0f) return settings;
+
+    measures.link_bytes_per_s = slowest_link;
+    measures.fps = slowest_fps;
+    measures.frame_bytes = static_cast<float>(bytes) / frames;
+    measures.latency_us = latency_us;
+    if (!level_changed)
+    {
+        float scale = measures.frame_bytes / LEVELS[settings.level].nominal_bytes;
+        measures.scale = std::clamp(measures.scale + SCALE_SMOOTHING * (scale - measures.scale), SCALE_MIN, SCALE_MAX);
+    }
+    level_changed = false;
+
+    // bytes a frame can take at the frame rate
+    float budget = slowest_link * CAMERA_LINK_HEADROOM / settings.frame_rate;
+    int fitting = fitting_level(budget);
+    bool late = slowest_fps < LATE_FPS * settings.frame_rate && slowest_busy > BUSY_LINK;
+    bool slow = latency_us > CAMERA_MAX_LATENCY_MS * 1000;
+
+    if (settings.level > 0 && (fitting < settings.level || late || slow))
+    {
+        settings.level = static_cast<uint8_t>(std::min(fitting, settings.level - 1));
+        stats.downs++;
+        level_changed = true;
+        cooldown = CAMERA_DOWN_COOLDOWN_UPDATES;
+        up_count = 0;
+    }
+    else if (cooldown > 0)
+    {
+        cooldown--;
+    }
+    else if (settings.level + 1 < LEVEL_COUNT && predictBytes(settings.level + 1) * CAMERA_UP_MARGIN <= budget)
+    {
+        if (++up_count >= CAMERA_UP_UPDATES)
+        {
+            settings.level++;
+            stats.ups++;
+            level_changed = true;
+            up_count = 0;
+        }
+    }
+    else
+    {
+        up_count = 0;
+    }
+    return settings;
+}
+
+float CameraRateController::predictBytes(uint8_t level) const
+{
+    return LEVELS[level].nominal_bytes * measures.scale;
+}
+
+int CameraRateController::fitting_level(float budget) const
+{
+    for (int level = LEVEL_COUNT - 1; level > 0; level--)
+    {
+        if (predictBytes(level) <= budget) return level;
+    }
+    return 0;
+}
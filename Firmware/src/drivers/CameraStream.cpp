@@ -0,0 +1,265 @@
+#include "drivers/CameraStream.hpp"
+#include <esp_timer.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+// weight of the last interval in the smoothed client frame rate
+constexpr float FPS_SMOOTHING = 0.2f;
+
+CameraStream::CameraStream(Source& source, uint8_t ring_size, float frame_rate)
+    : source(source), ring_size(std::clamp<uint8_t>(ring_size, 1, CAMERA_RING_SIZE))
+{
+    setFrameRate(frame_rate);
+}
+
+CameraStream::~CameraStream()
+{
+    stop();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (newest >= 0) unref(newest);
+    newest = -1;
+}
+
+void CameraStream::setFrameRate(float frame_rate)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    period_us = static_cast<int64_t>(1e6f / std::max(frame_rate, 0.1f));
+    wake.notify_all();
+}
+
+float CameraStream::getFrameRate() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return 1e6f / period_us;
+}
+
+void CameraStream::runCapture()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopped)
+    {
+        if (client_count == 0)
+        {
+            wake.wait(lock, [this]() { return stopped || client_count > 0; });
+            next_capture_us = esp_timer_get_time(); // first frame right away
+            continue;
+        }
+
+        int64_t now = esp_timer_get_time();
+        if (now < next_capture_us)
+        {
+            wake.wait_for(lock, std::chrono::microseconds(next_capture_us - now));
+            continue;
+        }
+
+        lock.unlock();
+        capture(now);
+        lock.lock();
+    }
+}
+
+Status CameraStream::capture(int64_t now_us)
+{
+    int slot = -1;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (client_count == 0 || now_us < next_capture_us) return Status::Ok;
+
+        // paced from the previous deadline, or from now when late (no burst to catch up)
+        next_capture_us += period_us;
+        if (next_capture_us <= now_us) next_capture_us = now_us + period_us;
+
+        for (int i = 0; i < ring_size; i++)
+        {
+            if (!slots[i].used)
+            {
+                slot = i;
+                break;
+            }
+        }
+        if (slot < 0)
+        {
+            stats.ring_full++;
+            return Status::Ok;
+        }
+        slots[slot].used = true; // filled outside of the lock, clients keep reading the older frames
+    }
+
+    Frame frame = {};
+    Status err = source.capture(frame);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (err != Status::Ok)
+    {
+        slots[slot].used = false;
+        stats.failures++;
+        return Status::Failure;
+    }
+    if (client_count == 0)
+    {
+        // the last client left during the capture
+        source.release(frame);
+        slots[slot].used = false;
+        return Status::Ok;
+    }
+
+    frame.sequence = ++sequence;
+    slots[slot].frame = frame;
+    slots[slot].refs = 1;
+    if (newest >= 0) unref(newest);
+    newest = slot;
+    stats.captured++;
+    frame_ready.notify_all();
+    return Status::Ok;
+}
+
+int64_t CameraStream::deadline() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return client_count == 0 ? NO_DEADLINE : next_capture_us;
+}
+
+void CameraStream::stop()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    stopped = true;
+    wake.notify_all();
+    frame_ready.notify_all();
+}
+
+void CameraStream::restart()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    stopped = false;
+}
+
+int CameraStream::subscribe()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for (int i = 0; i < CAMERA_MAX_CLIENTS; i++)
+    {
+        if (clients[i].active) continue;
+
+        // starts with the next frame : the newest one may be old if the capture was idle
+        clients[i] = {};
+        clients[i].active = true;
+        clients[i].last_sequence = sequence;
+        clients[i].stats.since_us = esp_timer_get_time();
+        client_count++;
+        stats.clients = client_count;
+        wake.notify_all();
+        return i;
+    }
+    return -1;
+}
+
+void CameraStream::unsubscribe(int client)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (client < 0 || client >= CAMERA_MAX_CLIENTS || !clients[client].active) return;
+    clients[client].active = false;
+    client_count--;
+    stats.clients = client_count;
+
+    // nobody watches : the newest frame goes back to the camera
+    if (client_count == 0 && newest >= 0)
+    {
+        unref(newest);
+        newest = -1;
+    }
+}
+
+const CameraStream::Frame* CameraStream::acquire(int client, uint32_t timeout_ms)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    if (client < 0 || client >= CAMERA_MAX_CLIENTS || !clients[client].active) return nullptr;
+    Client& c = clients[client];
+
+    bool ready = frame_ready.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this, &c]() {
+        return stopped || (newest >= 0 && slots[newest].frame.sequence > c.last_sequence);
+    });
+    if (!ready || stopped) return nullptr;
+
+    Slot& slot = slots[newest];
+    c.stats.dropped += slot.frame.sequence - c.last_sequence - 1;
+    c.last_sequence = slot.frame.sequence;
+    slot.refs++;
+    return &slot.frame;
+}
+
+void CameraStream::release(int client, const Frame* frame, int64_t send_start_us)
+{
+    int64_t now = esp_timer_get_time();
+    std::lock_guard<std::mutex> lock(mutex);
+
+    int slot = static_cast<int>(reinterpret_cast<const Slot*>(frame) - slots);
+    if (slot < 0 || slot >= ring_size) return;
+
+    if (client >= 0 && client < CAMERA_MAX_CLIENTS && clients[client].active)
+    {
+        Client& c = clients[client];
+        c.stats.frames++;
+        c.stats.bytes += frame->size;
+        c.stats.send_us = static_cast<uint32_t>(now - send_start_us);
+        c.stats.busy_us += c.stats.send_us;
+        c.stats.latency_us = static_cast<uint32_t>(now - frame->timestamp_us);
+        if (c.last_send_us != 0 && now > c.last_send_us)
+        {
+            float fps = 1e6f / (now - c.last_send_us);
+            c.stats.fps = c.stats.frames <= 2 ? fps : c.stats.fps + FPS_SMOOTHING * (fps - c.stats.fps);
+        }
+        c.last_send_us = now;
+    }
+    unref(slot);
+}
+
+Status CameraStream::serve(int client, const Sink& sink)
+{
+    char header[128];
+    return serveFrames(client, [&sink, &header](const Frame& frame) {
+        int length = snprintf(header, sizeof(header), "--%s\r\nContent-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n",
+                              BOUNDARY, static_cast<unsigned>(frame.size));
+        return sink(reinterpret_cast<const uint8_t*>(header), length) && sink(frame.data, frame.size) &&
+               sink(reinterpret_cast<const uint8_t*>("\r\n"), 2);
+    });
+}
+
+Status CameraStream::serveFrames(int client, const FrameSink& sink)
+{
+    while (true)
+    {
+        const Frame* frame = acquire(client, CAMERA_CLIENT_TIMEOUT_MS);
+        if (frame == nullptr)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return stopped ? Status::Ok : Status::Failure;
+        }
+
+        int64_t start = esp_timer_get_time();
+        bool sent = sink(*frame);
+        release(client, frame, start);
+        if (!sent) return Status::InvalidState;
+    }
+}
+
+bool CameraStream::getClientStats(int client, ClientStats& out) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (client < 0 || client >= CAMERA_MAX_CLIENTS || !clients[client].active) return false;
+    out = clients[client].stats;
+    return true;
+}
+
+CameraStream::Stats CameraStream::getStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+void CameraStream::unref(int slot)
+{
+    if (--slots[slot].refs > 0) return;
+    source.release(slots[slot].frame);
+    slots[slot].used = false;
+}
@@ -0,0 +1,111 @@
+#include <freertos/FreeRTOS.h>
+#include "drivers/MotorDriver.hpp"
+#include "common/I2C.hpp"
+#include "common/Log.hpp"
+#include "common/config.hpp"
+#include "drivers/MotorDriver.Error.hpp"
+#include "pca9685.h"
+
+namespace MotorDriver
+{
+    class PCA9685Backend : public Backend
+    {
+    public:
+        constexpr static const char* TAG = "MotorDriver";
+
+        Status init() override
+        {
+            if (Status err = I2C::Init(); err != Status::Ok)
+            {
+                LOG_ERROR(TAG, "Failed to initialize I2C for motor driver");
+                Error::RegisterErrorEvent(ErrorEventI2CInitFailed());
+                return err;
+            }
+
+            // Create PCA9685 handle
+            {
+                pca9685_info_t pca_info = {
+                    .address = MOTOR_DRIVER_I2C_ADDR,
+                    .clock_speed = MOTOR_DRIVER_I2C_CLOCK,
+                };
+                esp_err_t err = pca9685_create(I2C::handle_primary, pca_info, &pca_handle);
+                if (err != ESP_OK)
+                {
+                    LOG_ERROR(TAG, "Failed to create PCA9685 handle with error : 0x%0x", err);
+                    Error::RegisterErrorEvent(ErrorEventCreateFailed(err));
+                    return Status::Failure;
+                }
+            }
+
+            // Reset PCA9685 to ensure it's in a known state
+            {
+                esp_err_t err = pca9685_reset(pca_handle);
+                if (err != ESP_OK)
+                {
+                    LOG_ERROR(TAG, "Failed to reset PCA9685 with error : 0x%0x", err);
+                    Error::RegisterErrorEvent(ErrorEventResetFailed(err));
+                    return Status::Failure;
+                }
+            }
+
+            // Configure PCA9685
+            {
+                pca9685_config_t pca_config = {
+                    .frequency_hz = (uint16_t) MOTOR_DRIVER_PWM_FREQUENCY_HZ
+                };
+                esp_err_t err = pca9685_config(pca_handle, pca_config);
+                if (err != ESP_OK)
+                {
+                    LOG_ERROR(TAG, "Failed to configure PCA9685 with error : 0x%0x", err);
+                    Error::RegisterErrorEvent(ErrorEventConfigFailed(err));
+                    return Status::Failure;
+                }
+            }
+
+            // Wake up the motor driver to be sure it's ready
+            {
+                esp_err_t err = pca9685_wake_up(pca_handle);
+                if (err != ESP_OK)
+                {
+                    LOG_ERROR(TAG, "Failed to wake up PCA9685 with error : 0x%0x", err);
+                    Error::RegisterErrorEvent(ErrorEventWakeUpFailed(err));
+                    return Status::Failure;
+                }
+            }
+
+            return Status::Ok;
+        }
+
+        Status deinit() override
+        {
+            if (esp_err_t err = pca9685_delete(pca_handle); err != ESP_OK)
+            {
+                LOG_ERROR(TAG, "Failed to delete PCA9685 handle with error : 0x%0x", err);
+                Error::RegisterErrorEvent(ErrorEventDeleteFailed(err));
+                return Status::Failure;
+            }
+            return Status::Ok;
+        }
+
+        Status sendPWMs(const uint16_t* pwm_values) override
+        {
+            // the pca9685 component takes a mutable pointer but doesn't write to it
+            if (esp_err_t err = pca9685_set_pwms(pca_handle, const_cast<uint16_t*>(pwm_values)); err != ESP_OK)
+            {
+                LOG_ERROR(TAG, "Failed to set PWM values with error : 0x%0x", err);
+                Error::RegisterErrorEvent(ErrorEventSendDataFailed(err));
+                return Status::Failure;
+            }
+            return Status::Ok;
+        }
+
+    private:
+        pca9685_handle_t pca_handle;
+    };
+
+    Backend& GetDefaultBackend()
+    {
+        static PCA9685Backend backend;
+        return backend;
+    }
+}
@@ -1,10 +1,6 @@
-#include <freertos/FreeRTOS.h>
 #include "drivers/MotorDriver.hpp"
-#include "common/I2C.hpp"
 #include "common/Log.hpp"
 #include "common/config.hpp"
-#include "drivers/MotorDriver.Error.hpp"
-#include "pca9685.h"
 #include <cmath>
 #include <memory.h>
 
@@ -13,71 +9,34 @@ namespace MotorDriver
     constexpr const char* TAG = "MotorDriver";
 
     bool initialized = false;
-    pca9685_handle_t pca_handle;
+    Backend* backend = nullptr;
     uint16_t pwm_buffer[CHANNEL_COUNT] = {0};
 
-    Status Init()
+    Status SetBackend(Backend* new_backend)
     {
-        LOG_SCOPE(TAG, "MotorDriver::Init");
-
-        if (initialized) return Status::Ok;
-
-        if (Status err = I2C::Init(); err != Status::Ok)
+        if (initialized)
         {
-            LOG_ERROR(TAG, "Failed to initialize I2C for motor driver");
-            Error::RegisterErrorEvent(ErrorEventI2CInitFailed());
-            return err;
+            LOG_ERROR(TAG, "Cannot change backend while the driver is initialized");
+            return Status::InvalidState;
         }
+        backend = new_backend;
+        return Status::Ok;
+    }
 
-        // Create PCA9685 handle
-        {
-            pca9685_info_t pca_info = {
-                .address = MOTOR_DRIVER_I2C_ADDR,
-                .clock_speed = MOTOR_DRIVER_I2C_CLOCK,
-            };
-            esp_err_t err = pca9685_create(I2C::handle_primary, pca_info, &pca_handle);
-            if (err != ESP_OK)
-            {
-                LOG_ERROR(TAG, "Failed to create PCA9685 handle with error : 0x%0x", err);
-                Error::RegisterErrorEvent(ErrorEventCreateFailed(err));
-                return Status::Failure;
-            }
-        }
+    Status Init()
+    {
+        LOG_SCOPE(TAG, "MotorDriver::Init");
 
-        // Reset PCA9685 to ensure it's in a known state
-        {
-            esp_err_t err = pca9685_reset(pca_handle);
-            if (err != ESP_OK)
-            {
-                LOG_ERROR(TAG, "Failed to reset PCA9685 with error : 0x%0x", err);
-                Error::RegisterErrorEvent(ErrorEventResetFailed(err));
-                return Status::Failure;
-            }
-        }
+        if (initialized) return Status::Ok;
 
-        // Configure PCA9685
+        if (backend == nullptr)
         {
-            pca9685_config_t pca_config = {
-                .frequency_hz = (uint16_t) MOTOR_DRIVER_PWM_FREQUENCY_HZ
-            };
-            esp_err_t err = pca9685_config(pca_handle, pca_config);
-            if (err != ESP_OK)
-            {
-                LOG_ERROR(TAG, "Failed to configure PCA9685 with error : 0x%0x", err);
-                Error::RegisterErrorEvent(ErrorEventConfigFailed(err));
-                return Status::Failure;
-            }
+            backend = &GetDefaultBackend();
         }
 
-        // Wake up the motor driver to be sure it's ready
+        if (Status err = backend->init(); err != Status::Ok)
         {
-            esp_err_t err = pca9685_wake_up(pca_handle);
-            if (err != ESP_OK)
-            {
-                LOG_ERROR(TAG, "Failed to wake up PCA9685 with error : 0x%0x", err);
-                Error::RegisterErrorEvent(ErrorEventWakeUpFailed(err));
-                return Status::Failure;
-            }
+            return err;
         }
 
         initialized = true;
@@ -91,11 +50,9 @@ namespace MotorDriver
         // Disable all motors before deinitializing
         DisableAllMotors();
 
-        if (esp_err_t err = pca9685_delete(pca_handle); err != ESP_OK)
+        if (Status err = backend->deinit(); err != Status::Ok)
         {
-            LOG_ERROR(TAG, "Failed to delete PCA9685 handle with error : 0x%0x", err);
-            Error::RegisterErrorEvent(ErrorEventDeleteFailed(err));
-            return Status::Failure;
+            return err;
         }
 
         initialized = false;
@@ -167,12 +124,10 @@ namespace MotorDriver
     
     Status SendData()
     {
-        if (esp_err_t err = pca9685_set_pwms(pca_handle, pwm_buffer); err != ESP_OK)
+        if (!initialized)
         {
-            LOG_ERROR(TAG, "Failed to set PWM values with error : 0x%0x", err);
-            Error::RegisterErrorEvent(ErrorEventSendDataFailed(err));
-            return Status::Failure;
+            return Status::InvalidState;
         }
-        return Status::Ok;
+        return backend->sendPWMs(pwm_buffer);
     }
-}
\ No newline at end of file
+}
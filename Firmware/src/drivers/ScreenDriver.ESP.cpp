@@ -0,0 +1,119 @@
+#include "drivers/ScreenDriver.hpp"
+#include "common/I2C.hpp"
+#include "common/Log.hpp"
+#include "drivers/ScreenDriver.Error.hpp"
+#include "esp_lcd_panel_sh1106.h"
+#include <esp_lcd_io_i2c.h>
+#include <esp_lcd_panel_io.h>
+#include <esp_lcd_panel_ops.h>
+
+namespace ScreenDriver
+{
+    class SH1106Backend : public Backend
+    {
+    public:
+        Status init() override
+        {
+            if (Status err = I2C::Init(); err != Status::Ok)
+            {
+                Error::RegisterErrorEvent(ErrorEventI2CInitFailed());
+                return err;
+            }
+
+            esp_lcd_panel_io_handle_t io_handle = NULL;
+            esp_lcd_panel_io_i2c_config_t io_config = ESP_SH1106_DEFAULT_IO_CONFIG;
+            if (esp_err_t err = esp_lcd_new_panel_io_i2c(I2C::handle_secondary, &io_config, &io_handle); err != ESP_OK)
+            {
+                LOG_ERROR(TAG, "Couldn't create panel IO");
+                
+                return Status::Failure;
+            }
+
+            esp_lcd_panel_dev_config_t panel_config = {
+                .rgb_ele_order = LCD_RGB_ELEMENT_ORDER_RGB,
+                .data_endian = LCD_RGB_DATA_ENDIAN_LITTLE,
+                .bits_per_pixel = SH1106_PIXELS_PER_BYTE / 8,
+                .reset_gpio_num = GPIO_NUM_NC,
+                .vendor_config = NULL,
+                .flags = {
+                    .reset_active_high = false,
+                },
+            };
+            if (esp_err_t err = esp_lcd_new_panel_sh1106(io_handle, &panel_config, &panel_handle); err != ESP_OK)
+            {
+                LOG_ERROR(TAG, "Couldn't create sh1106 panel");
+                Error::RegisterErrorEvent(ErrorEventPanelCreateFailed(err));
+                return Status::Failure;
+            }
+            if (esp_err_t err = esp_lcd_panel_reset(panel_handle); err != ESP_OK)
+            {
+                LOG_ERROR(TAG, "Couln't reset panel");
+                Error::RegisterErrorEvent(ErrorEventPanelResetFailed(err));
+                return Status::Failure;
+            }
+            if (esp_err_t err = esp_lcd_panel_init(panel_handle); err != ESP_OK)
+            {
+                LOG_ERROR(TAG, "Couldn't init panel");
+                Error::RegisterErrorEvent(ErrorEventPanelInitFailed(err));
+                return Status::Failure;
+            }
+            return Status::Ok;
+        }
+
+        Status deinit() override
+        {
+            if (esp_err_t err = esp_lcd_panel_del(panel_handle); err != ESP_OK)
+            {
+                LOG_ERROR(TAG, "Couldn't delete panel");
+                Error::RegisterErrorEvent(ErrorEventPanelDeleteFailed(err));
+                return Status::Failure;
+            }
+            panel_handle = NULL;
+            return Status::Ok;
+        }
+
+        Status setPower(bool on) override
+        {
+            if (esp_err_t err = esp_lcd_panel_disp_on_off(panel_handle, on); err != ESP_OK)
+            {
+                LOG_ERROR(TAG, "Couldn't turn the display %s", on ? "on" : "off");
+                Error::RegisterErrorEvent(ErrorEventPanelDisplayOnFailed(err));
+                return Status::Failure;
+            }
+            return Status::Ok;
+        }
+
+        Status upload(const uint8_t* buffer, uint16_t width, uint16_t height) override
+        {
+            esp_err_t err = esp_lcd_panel_draw_bitmap(panel_handle, 0, 0, width, height, buffer);
+            if (err != ESP_OK) {
+                LOG_ERROR(TAG, "Couldn't draw bitmap on panel");
+                Error::RegisterErrorEvent(ErrorEventUploadFailed(err));
+                return Status::Failure;
+            }
+            return Status::Ok;
+        }
+
+        Status uploadSpan(uint16_t page, uint16_t x, const uint8_t* data, uint16_t length) override
+        {
+            // a one page high region is `length` column bytes, the same layout as the span
+            uint16_t y = page * PAGE_HEIGHT;
+            esp_err_t err = esp_lcd_panel_draw_bitmap(panel_handle, x, y, x + length, y + PAGE_HEIGHT, data);
+            if (err != ESP_OK) {
+                LOG_ERROR(TAG, "Couldn't draw span on panel");
+                Error::RegisterErrorEvent(ErrorEventUploadFailed(err));
+                return Status::Failure;
+            }
+            return Status::Ok;
+        }
+
+    private:
+        esp_lcd_panel_handle_t panel_handle = NULL;
+    };
+
+    Backend& GetDefaultBackend()
+    {
+        static SH1106Backend backend;
+        return backend;
+    }
+}
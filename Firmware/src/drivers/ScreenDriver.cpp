@@ -1,138 +1,357 @@
 #include "drivers/ScreenDriver.hpp"
-#include "common/I2C.hpp"
+#include "common/config.hpp"
 #include "common/Log.hpp"
-#include "common/LED.hpp"
-#include "drivers/ScreenDriver.Error.hpp"
-#include "esp_lcd_panel_sh1106.h"
-#include <esp_lcd_io_i2c.h>
-#include <esp_lcd_panel_io.h>
-#include <esp_lcd_panel_ops.h>
+#include <algorithm>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
 namespace ScreenDriver
 {
     Info info;
-    
-    constexpr uint16_t SH1106_PAGE_HEIGHT = 8;
 
-    esp_lcd_panel_handle_t panel_handle = NULL;
-    
-    bool screen_data[SH1106_HEIGHT * SH1106_WIDTH];
-    uint8_t buffer_data[SH1106_BUFFER_SIZE];
+    constexpr size_t BUFFER_SIZE = SCREEN_WIDTH * SCREEN_HEIGHT / PAGE_HEIGHT;
+    static_assert(SCREEN_HEIGHT % PAGE_HEIGHT == 0, "Screen height must be a multiple of the page height");
 
-    /* Convert a screen buffer data to a lcd-format image buffer (e.g. SH1106)
-    * @param screen_info: the screen buffer information, see screen_info_t
-    * @param buffer_info: the buffer information, see buffer_info_t
-    */
-    void screen_to_buffer(Info* screen_info, uint8_t* buffer_data)
+    static bool initialized = false;
+    static Backend* backend = nullptr;
+
+    /**
+     * A frame and the columns drawn in it. Three of them rotate between the drawing side (back), the last presented
+     * frame (ready) and the upload side (front) : swapping is a single atomic exchange, nobody ever waits.
+     */
+    struct Frame
+    {
+        // word aligned, so the drawing fills (memset) can use word stores
+        alignas(4) uint8_t data[BUFFER_SIZE];
+        DirtySpan dirty[PAGE_COUNT];
+        uint32_t sequence;
+    };
+    constexpr uint32_t FRAME_COUNT = 3;
+    constexpr uint32_t FRAME_INDEX_MASK = 0x3;
+    constexpr uint32_t FRAME_FRESH = 0x4; // set on `ready_frame` until the upload side takes it
+
+    static Frame frames[FRAME_COUNT];
+    static uint32_t back_frame = 0; // drawing side only
+    static uint32_t front_frame = 2; // upload side only
+    static std::atomic<uint32_t> ready_frame{1};
+
+    static uint32_t presented_sequence = 0; // drawing side only
+    static std::atomic<uint32_t> shown_sequence{0};
+
+    // what the panel shows, to only send the columns that changed (upload side only)
+    static uint8_t panel_data[BUFFER_SIZE];
+    static std::atomic<bool> panel_synced{false};
+
+    static TaskHandle_t upload_task_handle = nullptr;
+    static std::atomic<bool> upload_task_running{false};
+    static std::atomic<bool> upload_task_stop{false};
+
+    constexpr DirtySpan CLEAN_SPAN = { 0xFFFF, 0 };
+    DirtySpan* dirty = frames[0].dirty;
+
+    static UploadStats stats = {};
+
+    static void count_frame(uint32_t bytes)
+    {
+        stats.frames++;
+        stats.bytes += bytes;
+        stats.last_frame_bytes = bytes;
+        if (bytes > stats.max_frame_bytes) stats.max_frame_bytes = bytes;
+    }
+
+    /// @brief First column from `x` where `drawn` and `shown` differ (`end` if none), 4 columns at a time
+    static uint16_t first_difference(const uint8_t* drawn, const uint8_t* shown, uint16_t x, uint16_t end)
     {
-        uint16_t page_count = screen_info->height / SH1106_PAGE_HEIGHT;
-        for (uint16_t i = 0; i < page_count; i++)
+        for (; x + 4 <= end; x += 4)
         {
-            for (uint16_t j = 0; j < screen_info->width; j++)
+            uint32_t a, b;
+            memcpy(&a, drawn + x, 4);
+            memcpy(&b, shown + x, 4);
+            if (a != b) break;
+        }
+        while (x < end && drawn[x] == shown[x]) x++;
+        return x;
+    }
+
+    static Status upload_full(const Frame& frame)
+    {
+        if (Status err = backend->upload(frame.data, SCREEN_WIDTH, SCREEN_HEIGHT); err != Status::Ok)
+        {
+            return err;
+        }
+        memcpy(panel_data, frame.data, sizeof(panel_data));
+        panel_synced = true;
+
+        stats.full_frames++;
+        count_frame(PAGE_COUNT * (SCREEN_WIDTH + SPAN_OVERHEAD_BYTES));
+        return Status::Ok;
+    }
+
+    /**
+     * @brief Send the changed columns of a frame to the panel.
+     */
+    static Status upload_frame(const Frame& frame)
+    {
+        if (!panel_synced)
+        {
+            return upload_full(frame);
+        }
+
+        uint32_t frame_bytes = 0;
+        for (uint16_t page = 0; page < PAGE_COUNT; page++)
+        {
+            const DirtySpan& span = frame.dirty[page];
+            const uint8_t* drawn = &frame.data[page * SCREEN_WIDTH];
+            uint8_t* shown = &panel_data[page * SCREEN_WIDTH];
+
+            uint16_t span_end = span.first <= span.last ? span.last + 1 : 0;
+            uint16_t x = span.first;
+            while ((x = first_difference(drawn, shown, x, span_end)) < span_end)
             {
-                uint8_t byte = 0;
-                for (uint16_t k = 0; k < SH1106_PAGE_HEIGHT; k++)
+                // extend the span up to the last changed column not followed by too many unchanged ones
+                uint16_t start = x;
+                uint16_t end = x;
+                while (x + 1 < span_end)
                 {
-                    byte |= (screen_info->data[(i * SH1106_PAGE_HEIGHT + k) * screen_info->width + j] ? 1 : 0) << k;
+                    uint16_t next = first_difference(drawn, shown, x + 1, span_end);
+                    if (next >= span_end || next - end - 1 > SPAN_OVERHEAD_BYTES) break;
+                    end = x = next;
                 }
-                buffer_data[i * screen_info->width + j] = byte;
+
+                uint16_t length = end - start + 1;
+                if (Status err = backend->uploadSpan(page, start, drawn + start, length); err != Status::Ok)
+                {
+                    panel_synced = false; // partly sent, the next upload sends everything again
+                    return err;
+                }
+                memcpy(shown + start, drawn + start, length);
+                frame_bytes += length + SPAN_OVERHEAD_BYTES;
+                stats.spans++;
+                x = end + 1;
             }
         }
+
+        count_frame(frame_bytes);
+        return Status::Ok;
     }
 
-    Status Init()
+    /**
+     * @brief Upload side : take the last presented frame, if not sent yet, and send it.
+     */
+    static Status upload_ready()
     {
-        if (Status err = I2C::Init(); err != Status::Ok)
+        if ((ready_frame.load(std::memory_order_acquire) & FRAME_FRESH) == 0) return Status::Ok;
+
+        front_frame = ready_frame.exchange(front_frame, std::memory_order_acq_rel) & FRAME_INDEX_MASK;
+        const Frame& frame = frames[front_frame];
+        if (Status err = upload_frame(frame); err != Status::Ok)
         {
-            Error::RegisterErrorEvent(ErrorEventI2CInitFailed());
             return err;
         }
+        shown_sequence.store(frame.sequence, std::memory_order_release);
+        return Status::Ok;
+    }
 
-        esp_lcd_panel_io_handle_t io_handle = NULL;
-        esp_lcd_panel_io_i2c_config_t io_config = ESP_SH1106_DEFAULT_IO_CONFIG;
-        if (esp_err_t err = esp_lcd_new_panel_io_i2c(I2C::handle_secondary, &io_config, &io_handle); err != ESP_OK)
+    /**
+     * @brief Drawing side : hand the back frame to the upload side, and keep drawing on a copy of it.
+     */
+    static void present()
+    {
+        Frame& presented = frames[back_frame];
+        presented.sequence = ++presented_sequence;
+
+        // columns of a frame still waiting to be sent are added to this one, which replaces it if it's not taken in time
+        uint32_t waiting = ready_frame.load(std::memory_order_acquire);
+        if (waiting & FRAME_FRESH)
         {
-            LOG_ERROR(TAG, "Couldn't create panel IO");
-            
-            return Status::Failure;
+            const DirtySpan* waiting_dirty = frames[waiting & FRAME_INDEX_MASK].dirty;
+            for (uint16_t page = 0; page < PAGE_COUNT; page++)
+            {
+                presented.dirty[page].first = std::min(presented.dirty[page].first, waiting_dirty[page].first);
+                presented.dirty[page].last = std::max(presented.dirty[page].last, waiting_dirty[page].last);
+            }
         }
 
-        esp_lcd_panel_dev_config_t panel_config = {
-            .rgb_ele_order = LCD_RGB_ELEMENT_ORDER_RGB,
-            .data_endian = LCD_RGB_DATA_ENDIAN_LITTLE,
-            .bits_per_pixel = SH1106_PIXELS_PER_BYTE / 8,
-            .reset_gpio_num = GPIO_NUM_NC,
-            .vendor_config = NULL,
-            .flags = {
-                .reset_active_high = false,
-            },
-        };
-        if (esp_err_t err = esp_lcd_new_panel_sh1106(io_handle, &panel_config, &panel_handle); err != ESP_OK)
+        uint32_t previous = ready_frame.exchange(back_frame | FRAME_FRESH, std::memory_order_acq_rel);
+        stats.presented++;
+        if (previous & FRAME_FRESH) stats.dropped++; // replaced before the upload side took it
+
+        back_frame = previous & FRAME_INDEX_MASK;
+        Frame& back = frames[back_frame];
+        memcpy(back.data, presented.data, sizeof(back.data));
+        for (DirtySpan& span : back.dirty) span = CLEAN_SPAN;
+
+        info.data = back.data;
+        dirty = back.dirty;
+    }
+
+    static void upload_task(void* pvParams)
+    {
+        while (!upload_task_stop)
         {
-            LOG_ERROR(TAG, "Couldn't create sh1106 panel");
-            Error::RegisterErrorEvent(ErrorEventPanelCreateFailed(err));
-            return Status::Failure;
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            upload_ready(); // errors are already logged and registered by the backend, the next frame is sent in full
         }
-        if (esp_err_t err = esp_lcd_panel_reset(panel_handle); err != ESP_OK)
+        upload_task_running = false;
+        vTaskDelete(nullptr);
+    }
+
+    Status SetBackend(Backend* new_backend)
+    {
+        if (initialized)
         {
-            LOG_ERROR(TAG, "Couln't reset panel");
-            Error::RegisterErrorEvent(ErrorEventPanelResetFailed(err));
-            return Status::Failure;
+            LOG_ERROR(TAG, "Cannot change backend while the driver is initialized");
+            return Status::InvalidState;
         }
-        if (esp_err_t err = esp_lcd_panel_init(panel_handle); err != ESP_OK)
+        backend = new_backend;
+        return Status::Ok;
+    }
+
+    Status Init()
+    {
+        if (initialized) return Status::Ok;
+
+        if (backend == nullptr)
         {
-            LOG_ERROR(TAG, "Couldn't init panel");
-            Error::RegisterErrorEvent(ErrorEventPanelInitFailed(err));
-            return Status::Failure;
+            backend = &GetDefaultBackend();
         }
 
-        if (Status err = Clear(); err != Status::Ok) return err;
-        if (Status err = Upload(); err != Status::Ok) return err;
-
-        if (esp_err_t err = esp_lcd_panel_disp_on_off(panel_handle, true); err != ESP_OK)
+        if (Status err = backend->init(); err != Status::Ok)
         {
-            LOG_ERROR(TAG, "Couldn't turn the display on");
-            Error::RegisterErrorEvent(ErrorEventPanelDisplayOnFailed(err));
-            return Status::Failure;
+            return err;
         }
-        
+        initialized = true;
+        panel_synced = false;
+
         info = {
-            .data = screen_data,
-            .width = SH1106_WIDTH,
-            .height = SH1106_HEIGHT,
+            .data = frames[back_frame].data,
+            .width = SCREEN_WIDTH,
+            .height = SCREEN_HEIGHT,
         };
+        dirty = frames[back_frame].dirty;
 
-        return Status::Ok;
+        if (Status err = Clear(); err != Status::Ok) return err;
+        if (Status err = Upload(); err != Status::Ok) return err;
+
+        return backend->setPower(true);
     }
 
     Status Deinit()
     {
-        if (esp_err_t err = esp_lcd_panel_del(panel_handle); err != ESP_OK)
+        if (!initialized) return Status::Ok;
+
+        if (Status err = StopUploadTask(); err != Status::Ok)
+        {
+            return err;
+        }
+        if (Status err = backend->deinit(); err != Status::Ok)
         {
-            LOG_ERROR(TAG, "Couldn't delete panel");
-            Error::RegisterErrorEvent(ErrorEventPanelDeleteFailed(err));
+            return err;
+        }
+        initialized = false;
+        return Status::Ok;
+    }
+
+    Status StartUploadTask()
+    {
+        if (!initialized) return Status::InvalidState;
+        if (upload_task_running) return Status::Ok;
+
+        upload_task_stop = false;
+        upload_task_running = true;
+        if (xTaskCreatePinnedToCore(upload_task, "ScreenUpload", SCREEN_UPLOAD_TASK_STACK_SIZE, nullptr, SCREEN_UPLOAD_TASK_PRIORITY,
+                                    &upload_task_handle, CORE_BRAIN) != pdPASS)
+        {
+            LOG_ERROR(TAG, "Failed to create the upload task");
+            upload_task_running = false;
             return Status::Failure;
         }
-        panel_handle = NULL;
+        return Status::Ok;
+    }
+
+    Status StopUploadTask()
+    {
+        if (!upload_task_running) return Status::Ok;
+
+        Flush(SCREEN_FLUSH_TIMEOUT_MS);
+        upload_task_stop = true;
+        xTaskNotifyGive(upload_task_handle);
+        for (uint32_t waited_ms = 0; upload_task_running; waited_ms++)
+        {
+            if (waited_ms >= SCREEN_FLUSH_TIMEOUT_MS)
+            {
+                LOG_ERROR(TAG, "Upload task didn't stop");
+                return Status::Failure;
+            }
+            vTaskDelay(pdMS_TO_TICKS(1));
+        }
         return Status::Ok;
     }
 
     Status Clear()
     {
-        memset(screen_data, 0, SH1106_HEIGHT * SH1106_WIDTH);
-        memset(buffer_data, 0, SH1106_BUFFER_SIZE);
+        memset(info.data, 0, BUFFER_SIZE);
+        MarkDirty(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
         return Status::Ok;
     }
 
     Status Upload()
     {
-        screen_to_buffer(&info, buffer_data);
-        esp_err_t err = esp_lcd_panel_draw_bitmap(panel_handle, 0, 0, SH1106_WIDTH, SH1106_HEIGHT, buffer_data);
-        if (err != ESP_OK) {
-            LOG_ERROR(TAG, "Couldn't draw bitmap on panel");
-            Error::RegisterErrorEvent(ErrorEventUploadFailed(err));
-            return Status::Failure;
+        if (!initialized)
+        {
+            return Status::InvalidState;
+        }
+
+        present();
+        if (upload_task_running)
+        {
+            xTaskNotifyGive(upload_task_handle);
+            return Status::Ok;
+        }
+        return upload_ready();
+    }
+
+    Status Flush(uint32_t timeout_ms)
+    {
+        if (!initialized)
+        {
+            return Status::InvalidState;
+        }
+
+        for (uint32_t waited_ms = 0; static_cast<int32_t>(presented_sequence - shown_sequence.load(std::memory_order_acquire)) > 0; waited_ms++)
+        {
+            if (!upload_task_running || waited_ms >= timeout_ms)
+            {
+                return Status::Failure; // last upload failed (without the task), or still not sent
+            }
+            vTaskDelay(pdMS_TO_TICKS(1));
         }
         return Status::Ok;
     }
+
+    void Invalidate()
+    {
+        panel_synced = false;
+    }
+
+    uint32_t GetPresentedFrame()
+    {
+        return presented_sequence;
+    }
+
+    uint32_t GetShownFrame()
+    {
+        return shown_sequence.load(std::memory_order_acquire);
+    }
+
+    UploadStats GetUploadStats()
+    {
+        return stats;
+    }
+
+    void ResetUploadStats()
+    {
+        stats = {};
+    }
 }
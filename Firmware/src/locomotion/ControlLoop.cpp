@@ -1,8 +1,6 @@
 #include "locomotion/ControlLoop.hpp"
-#include <freertos/FreeRTOS.h>
-#include <freertos/task.h>
 #include "esp_log_timestamp.h"
-#include "Robot.hpp"
+#include "locomotion/Body.hpp"
 #include "common/Log.hpp"
 #include "common/config.hpp"
 #include "common/RPC.hpp"
@@ -10,6 +8,9 @@
 #include "drivers/AnalogDriver.hpp"
 #include "drivers/MotorDriver.hpp"
 #include "drivers/IMUDriver.hpp"
+#include "diagnostic/SensorRecorder.hpp"
+#include <esp_timer.h>
+#include <algorithm>
 #include "common/analysis/PerfMonitor.hpp"
 
 // Perf monitoring : Remove this when control loop is optimized and stable
@@ -23,29 +24,10 @@ PerfMonitor perf_command;
 PerfMonitor perf_driver;
 uint16_t perf_counter = 0;
 
-TaskHandle_t timer_task_handle;
-bool running = false;
-
-static bool IRAM_ATTR timer_on_alarm_cb(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *user_ctx)
-{
-    BaseType_t high_task_awoken = pdFALSE;
-    vTaskNotifyGiveFromISR(timer_task_handle, &high_task_awoken);
-    return (high_task_awoken == pdTRUE); // return true if a higher priority task was awoken
-}
-
-ControlLoop::ControlLoop()
-    : initialized(false)
+ControlLoop::ControlLoop(Body& body)
+    : initialized(false), body(body)
 {
-}
-
-Status ControlLoop::init()
-{
-    // FIXME : It would really be better if we made sure everything is in DRAM
-    //         to avoid cache issues and delays in the control loop when brain core is doing heavy operations
-
-    if (initialized) return Status::Ok;
-
-    // Initialize kinematics engine with the right config
+    // Initialize kinematics engine with the right config (legs are built by the body constructor)
     kinematics_engine = KinematicsEngine(KinematicsEngine::KinematicsConfig{
         .hip_shift_x = HIP_POS_X_M,
         .hip_shift_y = HIP_POS_Y_M,
@@ -53,132 +35,20 @@ Status ControlLoop::init()
         .length_thigh = LEG_THIGH_LENGTH_M,
         .length_calf = LEG_CALF_LENGTH_M,
         .leg_inverted = {
-            Robot::GetInstance().getBody().getLeg(Leg::Id::FrontLeft).isInverted(),
-            Robot::GetInstance().getBody().getLeg(Leg::Id::BackLeft).isInverted(),
-            Robot::GetInstance().getBody().getLeg(Leg::Id::BackRight).isInverted(),
-            Robot::GetInstance().getBody().getLeg(Leg::Id::FrontRight).isInverted(),
+            body.getLeg(Leg::Id::FrontLeft).isInverted(),
+            body.getLeg(Leg::Id::BackLeft).isInverted(),
+            body.getLeg(Leg::Id::BackRight).isInverted(),
+            body.getLeg(Leg::Id::FrontRight).isInverted(),
         },
     });
-
-    if (Status err = create_internal_task(); err != Status::Ok)
-    {
-        return err;
-    }
-    running = true; // allow the control loop task to run
-
-    // Configure the timer
-    gptimer_config_t timer_config = {
-        .clk_src = GPTIMER_CLK_SRC_DEFAULT,
-        .direction = GPTIMER_COUNT_UP,
-        .resolution_hz = TIMER_RESOLUTION,
-        .intr_priority = 0, // Let driver choose a low priority
-        .flags = {
-            .intr_shared = false, // Don't share the interrupt
-            .allow_pd = false, // Don't allow power down
-        },
-    };
-    if (esp_err_t err = gptimer_new_timer(&timer_config, &timer); err != ESP_OK)
-    {
-        LOG_ERROR(TAG, "gptimer_new_timer failed");
-        return Status::Failure;
-    }
-
-    gptimer_event_callbacks_t cbs = {
-        .on_alarm = timer_on_alarm_cb, // link the alarm callback
-    };
-    if (esp_err_t err = gptimer_register_event_callbacks(timer, &cbs, NULL); err != ESP_OK)
-    {
-        LOG_ERROR(TAG, "gptimer_register_event_callbacks failed");
-        return Status::Failure;
-    }
-
-    gptimer_alarm_config_t alarm_config = {
-        .alarm_count = TIMER_ALARM_COUNT,
-        .reload_count = 0,
-        .flags = {
-            .auto_reload_on_alarm = true,
-        },
-    };
-    if (esp_err_t err = gptimer_set_alarm_action(timer, &alarm_config); err != ESP_OK)
-    {
-        LOG_ERROR(TAG, "gptimer_set_alarm_action failed");
-        return Status::Failure;
-    }
-
-    // Enable the timer
-    if (esp_err_t err = gptimer_enable(timer); err != ESP_OK)
-    {
-        LOG_ERROR(TAG, "gptimer_enable failed");
-        return Status::Failure;
-    }
-
-    initialized = true;
-    return Status::Ok;
-}
-
-Status ControlLoop::start()
-{
-    if (Status err = create_internal_task(); err != Status::Ok)
-    {
-        return err;
-    }
-    running = true; // allow the control loop task to run
-
-    if (esp_err_t err = gptimer_start(timer); err != ESP_OK)
-    {
-        LOG_ERROR(TAG, "Error starting Control Loop timer : 0x%0X", err);
-        return Status::Failure;
-    }
-
-    return Status::Ok;
-}
-
-
-Status ControlLoop::stop()
-{
-    running = false; // ask the control loop to end
-    if (esp_err_t err = gptimer_stop(timer); err != ESP_OK)
-    {
-        LOG_ERROR(TAG, "Error stopping Control Loop timer : 0x%0X", err);
-        return Status::Failure;
-    }
-
-    return Status::Ok;
-}
-
-bool ControlLoop::isRunning() const
-{
-    return running;
-}
-
-Status ControlLoop::deinit()
-{
-    if (!initialized) return Status::Ok;
-
-    running = false; // ask the control loop to end
-
-    // wait 2 control cycle to be sure the control loop is stopped
-    vTaskDelay(pdMS_TO_TICKS(CONTROL_LOOP_DT_MS*2));
-
-    if (timer_task_handle != nullptr)
-    {
-        vTaskDelete(timer_task_handle);
-        timer_task_handle = nullptr;
-    }
-
-    if (esp_err_t err = gptimer_disable(timer); err != ESP_OK)
-    {
-        LOG_ERROR(TAG, "Error disabling Control Loop gptimer ; 0x%0X", err);
-        return Status::Failure;
-    }
-
-    initialized = false;
-    return Status::Ok;
 }
 
 Status ControlLoop::control_task()
 {
     perf_global.start();
+    int64_t tick_us = esp_timer_get_time();
+    static uint32_t tick = 0;
+    tick++;
 
     static bool watchdog_active = false;
 
@@ -225,9 +95,16 @@ Status ControlLoop::control_task()
     }
     perf_imu.stop();
 
+    // Raw sensors capture, for offline replay (see SensorRecorder)
+    bool recording = SensorRecorder::IsRecording();
+    if (recording)
+    {
+        record_sensors();
+    }
+
     // Estimate body state from new IMU and Analog data (calls Legs, Joint, IMU estimateState functions)
     perf_estimation.start();
-    if (Status err = Robot::GetInstance().getBody().estimateState(CONTROL_LOOP_DT_S); err != Status::Ok)
+    if (Status err = body.estimateState(CONTROL_LOOP_DT_S); err != Status::Ok)
     {
         LOG_ERROR(TAG, "Error estimating body state");
     }
@@ -236,6 +113,8 @@ Status ControlLoop::control_task()
     /// Store the state in the IPC to be read by the Brain core (we don't check return error here, no time to manage them)
     IPC::RobotState state;
     state.timestamp_ms = current_time;
+    state.tick = tick;
+    state.timestamp_us = tick_us;
     for (int i = 0; i < (int) Joint::Id::Count; i++)
     {
         Joint::Id joint_id = static_cast<Joint::Id>(i);
@@ -246,8 +125,8 @@ Status ControlLoop::control_task()
         joint->getPrediction(state.joints[i].model_angle_rad);
         joint->getPosition(state.joints[i].estimated_angle_rad);
     }
-    state.body_orientation = Robot::GetInstance().getBody().getIMU().getOrientation();
-    state.imu_down_vector = Robot::GetInstance().getBody().getIMU().getDownVector();
+    state.body_orientation = body.getIMU().getOrientation();
+    state.imu_down_vector = body.getIMU().getDownVector();
     IPC::setState(state);
 
     /*** 2 - RUN CARTESIAN CONTROL (USING BRAIN CONTROL INTENT) ***/
@@ -259,7 +138,7 @@ Status ControlLoop::control_task()
     for (int i = 0; i < (int) Leg::Id::Count; i++)
     {
         Leg::Id leg_id = static_cast<Leg::Id>(i);
-        cartesian_state.legs[i].is_grounded = Robot::GetInstance().getBody().getLeg(leg_id).isGrounded();
+        cartesian_state.legs[i].is_grounded = body.getLeg(leg_id).isGrounded();
     }
 
     // Gait planner (ideal movement)
@@ -350,7 +229,7 @@ Status ControlLoop::control_task()
 
     // Update the body (this updates all joints in the body)
     perf_command.start();
-    if (Status err = Robot::GetInstance().getBody().applyCommand(joint_state, CONTROL_LOOP_DT_S); err != Status::Ok)
+    if (Status err = body.applyCommand(joint_state, CONTROL_LOOP_DT_S); err != Status::Ok)
     {
         // LOG_ERROR(TAG, "Failed to apply command in control task with error: %s", ErrorToString(err));
         // return err;
@@ -365,6 +244,16 @@ Status ControlLoop::control_task()
     }
     perf_driver.stop();
 
+    if (recording)
+    {
+        MotorDriver::Value duty_cycles[MotorDriver::CHANNEL_COUNT];
+        for (MotorDriver::Channel i = 0; i < MotorDriver::CHANNEL_COUNT; i++)
+        {
+            MotorDriver::GetDutyCycle(i, duty_cycles[i]);
+        }
+        SensorRecorder::RecordMotor(esp_timer_get_time(), duty_cycles);
+    }
+
     /*** 6 - OTHER CORE1 JOBS ***/
 
     // All done, we can execute pending jobs if there's any (Handle RPC Calls)
@@ -372,8 +261,13 @@ Status ControlLoop::control_task()
     
     // Performance tracking (as lightweight as possible)
     perf_global.stop();
+    static int64_t worst_tick_us = 0;
+    worst_tick_us = std::max(worst_tick_us, esp_timer_get_time() - perf_global.start_time);
     if (perf_counter++ == CONTROL_LOOP_FREQ_HZ)
     {
+        load.store(worst_tick_us / (CONTROL_LOOP_DT_S * 1e6f), std::memory_order_relaxed);
+        worst_tick_us = 0;
+
         // float ms_global = perf_global.get_avg_ms();
         // float ms_reader = perf_reader.get_avg_ms();
         // float ms_imu = perf_imu.get_avg_ms();
@@ -401,37 +295,15 @@ Status ControlLoop::control_task()
     return Status::Ok;
 }
 
-Status ControlLoop::create_internal_task()
+void ControlLoop::record_sensors()
 {
-    // Create the control loop task ON REFLEX CORE
-    BaseType_t err = xTaskCreatePinnedToCore([](void* PvParams){
-        ControlLoop* control_loop = static_cast<ControlLoop*>(PvParams);
-        running = true;
-        
-        // Main loop
-        while (running)
-        {
-            // wait for timer interrupt notification
-            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-
-            control_loop->control_task();
-        }
-
-        // clean up and delete task
-        running = false;
-        if (timer_task_handle != nullptr)
-        {
-            vTaskDelete(nullptr);
-            timer_task_handle = nullptr;
-        }
-    },  "timer_task", 8192, this, configMAX_PRIORITIES - 1, &timer_task_handle, CORE_REFLEX);
+    int64_t timestamp_us = esp_timer_get_time();
 
-    if (err != pdPASS)
+    AnalogDriver::Value raw_voltages[AnalogDriver::CHANNEL_COUNT];
+    if (AnalogDriver::GetRawVoltages(raw_voltages) == Status::Ok)
     {
-        LOG_ERROR(TAG, "Failed to create timer task");
-        // ErrorHandle(ErrorStruct::ControlLoopInitFailed);
-        return Status::Failure;
+        SensorRecorder::RecordAnalog(timestamp_us, raw_voltages);
     }
-
-    return Status::Ok;
-}
\ No newline at end of file
+    SensorRecorder::RecordIMU(timestamp_us, IMUDriver::GetData());
+    // power is sampled by the recorder itself, on the brain core (see SensorRecorder::RecordPower())
+}
@@ -1,6 +1,5 @@
 #include "locomotion/GaitPlanner.hpp"
 #include "common/Log.hpp"
-#include "Robot.hpp"
 #include <cmath>
 
 GaitPlanner::GaitPlanner()
@@ -15,13 +15,6 @@ Status KinematicsEngine::computeBodyIK(const BodyCartesianState& cartesian, Body
 {
     Transformf body_transform(cartesian.body_pos, Quatf::FromEulerAngles(cartesian.body_rot));
 
-    Vec3f hip_positions[4] = {
-        Vec3f( config.hip_shift_x,  config.hip_shift_y, 0.f), // FL
-        Vec3f(-config.hip_shift_x,  config.hip_shift_y, 0.f), // BL
-        Vec3f(-config.hip_shift_x, -config.hip_shift_y, 0.f), // BR
-        Vec3f( config.hip_shift_x, -config.hip_shift_y, 0.f), // FR
-    };
-
     for (int i = 0; i < 4; i++)
     {
         // Feet position in world frame (from gait planner)
@@ -29,7 +22,7 @@ Status KinematicsEngine::computeBodyIK(const BodyCartesianState& cartesian, Body
         // Feet position from world frame to body frame
         Vec3f foot_in_body_frame = body_transform.worldToLocal(foot_target);
         // Feet position from body frame to hip frame
-        Vec3f target_hip_frame = foot_in_body_frame - hip_positions[i];
+        Vec3f target_hip_frame = foot_in_body_frame - getHipPosition(i);
 
         // Invert target y position if leg is inverted
         if (config.leg_inverted[i])
@@ -85,3 +78,33 @@ Status KinematicsEngine::computeLegIK(const Vec3f& target, LegJointState& joints
     
     return Status::Ok;
 }
+
+
+Status KinematicsEngine::computeLegFK(const LegJointState& joints, Vec3f& feet)
+{
+    float hip_roll = joints.joint_angles_rad[0];
+    float hip_pitch = joints.joint_angles_rad[1];
+    float knee = joints.joint_angles_rad[2];
+
+    // Leg plane : x forward, d along the (rolled) leg axis, pointing down
+    float x = config.length_thigh * sinf(hip_pitch) + config.length_calf * sinf(hip_pitch + knee);
+    float d = config.length_thigh * cosf(hip_pitch) + config.length_calf * cosf(hip_pitch + knee);
+
+    // Hip roll moves the leg plane (shifted by the hip offset) around the x axis
+    float dist_zy = sqrtf(d * d + config.hip_offset * config.hip_offset);
+    float angle_zy = hip_roll + atan2f(config.hip_offset, d);
+
+    feet = Vec3f(x, -dist_zy * sinf(angle_zy), -dist_zy * cosf(angle_zy));
+    return Status::Ok;
+}
+
+Vec3f KinematicsEngine::getHipPosition(int leg_index) const
+{
+    switch (leg_index)
+    {
+        case 0: return Vec3f( config.hip_shift_x,  config.hip_shift_y, 0.f); // FL
+        case 1: return Vec3f(-config.hip_shift_x,  config.hip_shift_y, 0.f); // BL
+        case 2: return Vec3f(-config.hip_shift_x, -config.hip_shift_y, 0.f); // BR
+        default: return Vec3f( config.hip_shift_x, -config.hip_shift_y, 0.f); // FR
+    }
+}
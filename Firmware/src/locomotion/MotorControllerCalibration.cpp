@@ -7,9 +7,92 @@
 #include "locomotion/calibration/get_deadband_size.hpp"
 #include "locomotion/calibration/get_physical_bound.hpp"
 #include "locomotion/MotorController.Errors.hpp"
+#include "Robot.hpp"
 
 constexpr const char* TAG = "MtrCtrl-Calib";
 
+Status MotorController::startCalibration()
+{
+    LOG_INFO(TAG, "Starting motor calibration");
+
+    if (calibration_state == CalibrationState::CALIBRATING)
+    {
+        LOG_WARNING(TAG, "Motor is already in calibration mode");
+        return Status::InvalidState;
+    }
+
+    if (BaseType_t err = xTaskCreatePinnedToCore([](void* param) {
+            // Stop the control loop and take over for the calibration
+            ControlLoop& ctrl = Robot::GetInstance().getControlLoop();
+            bool wasRunning = ctrl.isRunning();
+            if (wasRunning)
+            {
+                LOG_DEBUG(TAG, "Disabling control loop");
+                if (Status err = ctrl.stop(); err != Status::Ok)
+                {
+                    // LOG_ERROR(TAG, "Failed to stop control loop for motor calibration. Error [%s]", ErrorToString(err));
+                    return;
+                }
+            }
+
+            MotorController* controller = static_cast<MotorController*>(param);
+            controller->calibration_state = CalibrationState::CALIBRATING;
+            Status err = controller->run_calibration_sequence();
+            if (err != Status::Ok)
+            {
+                Error::RegisterErrorEvent(ErrorEventMotorCalibrationFailed(controller->motor_channel, controller->analog_channel));
+                controller->calibration_state = CalibrationState::ERROR;
+            }
+            else
+            {
+                LOG_INFO(TAG, "Motor calibrated");
+                controller->calibration_state = CalibrationState::CALIBRATED;
+            }
+            // disable motor for safety
+            if (Status err = controller->disable(); err != Status::Ok)
+            {
+                // LOG_ERROR(TAG, "Failed to disable motor after calibration. Error [%s]", ErrorToString(err));
+            }
+
+            // Restart the control loop (back to normal operation)
+            if (wasRunning)
+            {
+                LOG_DEBUG(TAG, "Restarting control loop");
+                if (Status err = Robot::GetInstance().getControlLoop().start(); err != Status::Ok)
+                {
+                    // LOG_ERROR(TAG, "Failed to start control loop after motor calibration. Error [%s]", ErrorToString(err));
+                    return;
+                }
+            }
+
+            // clean up task handle
+            vTaskDelete(nullptr);
+        }, "MotorCalib", 4096, this, tskIDLE_PRIORITY + 1, &calibration_task_handle, CORE_BRAIN); err != pdPASS)
+    {
+        LOG_ERROR(TAG, "Failed to create motor calibration task. Error %d", err);
+        return Status::Failure;
+    }
+
+    return Status::Ok;
+}
+
+Status MotorController::stopCalibration()
+{
+    if (calibration_state != MotorController::CalibrationState::CALIBRATING)
+    {
+        return Status::InvalidState;
+    }
+
+    if (calibration_task_handle != NULL)
+    {
+        vTaskDelete(calibration_task_handle);
+        deleteCalibrationData(false); // reset calibration data but don't save to NVS
+        LOG_WARNING(TAG, "Stopped motor calibration. This could lead to unexpected behavior.");
+    }
+
+    return Status::Ok;
+}
+
 Status MotorController::run_calibration_sequence()
 {
     MotorDriver::Value dc_center = (motor_attributes.dc_min + motor_attributes.dc_max) / 2;
@@ -0,0 +1,264 @@
+#include "network/OtaDownload.hpp"
+#include "common/Log.hpp"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+OtaDownload::OtaDownload(size_t ring_size, size_t chunk_size, uint32_t resume_delay_ms)
+    : ring_size(ring_size), chunk_size(std::min(chunk_size, ring_size / 2)), resume_delay_ms(resume_delay_ms)
+{
+    ring = static_cast<uint8_t*>(heap_caps_malloc(ring_size, MALLOC_CAP_8BIT | MALLOC_CAP_SPIRAM));
+}
+
+OtaDownload::~OtaDownload()
+{
+    free(ring);
+}
+
+OtaDownload::Progress OtaDownload::getProgress() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return progress;
+}
+
+void OtaDownload::update_rate()
+{
+    float elapsed_s = (esp_timer_get_time() - start_us) / 1e6f;
+    progress.bytes_per_s = elapsed_s > 0 ? progress.received / elapsed_s : 0.0f;
+}
+
+Status OtaDownload::run(Source& image_source, Target& target, const OtaManifest::Image& image, const ProgressCallback& on_progress)
+{
+    if (ring == nullptr || chunk_size == 0)
+    {
+        LOG_ERROR(TAG, "No ring buffer");
+        return Status::NoMemory;
+    }
+    if (image.size == 0) LOG_WARNING(TAG, "No size nor hash in the manifest (legacy) : one connection, no resume, no hash check");
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        source = &image_source;
+        size = image.size;
+        sized = image.size != 0;
+        head = 0;
+        tail = 0;
+        cancelled = false;
+        reader_done = false;
+        reader_status = Status::Ok;
+        progress = {};
+        progress.size = image.size;
+        start_us = esp_timer_get_time();
+    }
+
+    if (Status err = target.begin(image.size); err != Status::Ok)
+    {
+        LOG_ERROR(TAG, "Target refused the image (%lu bytes)", static_cast<unsigned long>(image.size));
+        return err;
+    }
+
+    if (xTaskCreatePinnedToCore([](void* param) {
+        static_cast<OtaDownload*>(param)->read_loop();
+        vTaskDelete(NULL);
+    }, "otaReader", OTA_READER_STACK_SIZE, this, OTA_READER_TASK_PRIORITY, nullptr, CORE_BRAIN) != pdPASS)
+    {
+        LOG_ERROR(TAG, "Failed to create the reader task");
+        target.abort();
+        return Status::Failure;
+    }
+
+    // ring to flash, hashing on the way
+    Sha256 sha;
+    Status status = Status::Ok;
+    int64_t next_report_us = 0;
+    while (true)
+    {
+        uint32_t index, length;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [this] { return head - tail >= chunk_size || (sized && head == size) || reader_done; });
+            if (reader_done && reader_status != Status::Ok)
+            {
+                status = reader_status;
+                break;
+            }
+            if (sized ? tail == size : (reader_done && tail == head)) break;
+            if (head == tail)
+            {
+                status = Status::Failure; // reader ended early without error
+                break;
+            }
+            index = tail % ring_size;
+            length = std::min<uint32_t>({ head - tail, static_cast<uint32_t>(ring_size - index), static_cast<uint32_t>(chunk_size) });
+        }
+
+        sha.update(ring + index, length);
+        if (status = target.write(ring + index, length); status != Status::Ok)
+        {
+            LOG_ERROR(TAG, "Write failed at %lu", static_cast<unsigned long>(tail));
+            break;
+        }
+
+        Progress report;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tail += length;
+            progress.written = tail;
+            update_rate();
+            report = progress;
+        }
+        changed.notify_all();
+
+        int64_t now = esp_timer_get_time();
+        if (on_progress && now >= next_report_us)
+        {
+            next_report_us = now + OTA_PROGRESS_INTERVAL_MS * 1000LL;
+            on_progress(report);
+        }
+    }
+
+    // the reader stops at its next read (or resume delay) and must be gone before the source is released
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cancelled = true;
+        changed.notify_all();
+        changed.wait(lock, [this] { return reader_done; });
+    }
+
+    if (status == Status::Ok && sized)
+    {
+        uint8_t digest[Sha256::SIZE];
+        sha.finish(digest);
+        if (memcmp(digest, image.sha256, Sha256::SIZE) != 0)
+        {
+            LOG_ERROR(TAG, "Image hash doesn't match the manifest");
+            status = Status::InvalidParameters;
+        }
+    }
+    if (status == Status::Ok) status = target.finish();
+    else target.abort();
+
+    Progress report = getProgress();
+    if (on_progress) on_progress(report);
+    LOG_INFO(TAG, "%s : %lu / %lu bytes at %.1f KB/s, %u resumes, %lu bytes fetched", status == Status::Ok ? "Done" : "Failed",
+             static_cast<unsigned long>(report.written), static_cast<unsigned long>(report.size), report.bytes_per_s / 1024.0f,
+             report.resumes, static_cast<unsigned long>(report.fetched));
+    return status;
+}
+
+void OtaDownload::read_loop()
+{
+    Status status = read_image();
+    std::lock_guard<std::mutex> lock(mutex);
+    reader_status = status;
+    reader_done = true;
+    changed.notify_all();
+}
+
+Status OtaDownload::read_image()
+{
+    bool opened = false;
+    uint32_t skip = 0;    // bytes before the resume offset, sent again by a server ignoring the range
+    uint8_t losses = 0;   // in a row, without new data
+    uint32_t expected = 0; // image size told by the server, for the images the manifest doesn't give the size of
+
+    auto lost = [&](const char* what) {
+        LOG_WARNING(TAG, "Connection %s at %lu", what, static_cast<unsigned long>(head));
+        source->close();
+        opened = false;
+        losses++;
+    };
+
+    while (true)
+    {
+        if (!opened)
+        {
+            uint32_t offset;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (losses > (sized ? OTA_MAX_RESUMES : 0))
+                {
+                    LOG_ERROR(TAG, "Giving up after %u losses in a row", losses);
+                    return Status::Failure;
+                }
+                if (losses > 0)
+                {
+                    progress.resumes++;
+                    changed.wait_for(lock, std::chrono::milliseconds(losses * resume_delay_ms), [this] { return cancelled; });
+                }
+                if (cancelled) return Status::Ok;
+                offset = head;
+            }
+
+            uint32_t start = 0, total = 0;
+            Status err = source->open(offset, start, total);
+            if (err == Status::Failure)
+            {
+                LOG_WARNING(TAG, "Can't reach the server (resume at %lu)", static_cast<unsigned long>(offset));
+                losses++;
+                continue;
+            }
+            if (err != Status::Ok) return err;
+            opened = true;
+            if ((sized && total != 0 && total != size) || start > offset)
+            {
+                LOG_ERROR(TAG, "Server sends %lu bytes from %lu, the manifest says %lu", static_cast<unsigned long>(total),
+                          static_cast<unsigned long>(start), static_cast<unsigned long>(size));
+                source->close();
+                return Status::InvalidParameters;
+            }
+            if (offset > 0) LOG_INFO(TAG, "Resumed at %lu%s", static_cast<unsigned long>(offset), start < offset ? " (range ignored)" : "");
+            skip = offset - start;
+            if (!sized)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                progress.size = expected = total;
+            }
+        }
+
+        // free part of the ring after head (also takes the dropped bytes, without committing them)
+        uint8_t* destination;
+        size_t room;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            changed.wait(lock, [this] { return cancelled || head - tail < ring_size; });
+            if (cancelled) break;
+            if (sized && head == size) break;
+            uint32_t index = head % ring_size;
+            destination = ring + index;
+            room = std::min({ ring_size - (head - tail), ring_size - index, chunk_size });
+            if (skip) room = std::min<size_t>(room, skip);
+            else if (sized) room = std::min<size_t>(room, size - head);
+        }
+
+        int length = source->read(destination, room);
+        if (length == 0 && !sized && (expected == 0 || head == expected)) break; // end of an image of unknown size
+        if (length <= 0)
+        {
+            lost(length < 0 ? "lost" : "closed early");
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            progress.fetched += length;
+            if (skip)
+            {
+                skip -= length;
+                continue;
+            }
+            head += length;
+            progress.received = head;
+            update_rate();
+            losses = 0;
+        }
+        changed.notify_all();
+    }
+
+    if (opened) source->close();
+    return Status::Ok;
+}
@@ -0,0 +1,92 @@
+#include "network/OtaManifest.hpp"
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    void AppendImage(std::string& text, const char* name, const OtaManifest::Image& image)
+    {
+        char line[32 + 2 * Sha256::SIZE];
+        int length = snprintf(line, sizeof(line), "%s %lu ", name, static_cast<unsigned long>(image.size));
+        for (size_t i = 0; i < Sha256::SIZE; i++) length += snprintf(line + length, sizeof(line) - length, "%02x", image.sha256[i]);
+        text.append(line, length);
+        text += '\n';
+    }
+
+    int HexDigit(char c)
+    {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    int Base64Digit(char c)
+    {
+        if (c >= 'A' && c <= 'Z') return c - 'A';
+        if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+        if (c >= '0' && c <= '9') return c - '0' + 52;
+        if (c == '+') return 62;
+        if (c == '/') return 63;
+        return -1;
+    }
+}
+
+std::string OtaManifest::SignedText(const Manifest& manifest, const char* model)
+{
+    std::string text;
+    text.reserve(64 + 2 * (32 + 2 * Sha256::SIZE));
+    text += model;
+    text += '\n';
+    text += manifest.version;
+    text += '\n';
+    AppendImage(text, "firmware", manifest.firmware);
+    AppendImage(text, "filesystem", manifest.filesystem);
+    return text;
+}
+
+Status OtaManifest::Verify(const Manifest& manifest, const char* model, const uint8_t* signature, size_t size, const Verifier& verifier)
+{
+    if (signature == nullptr || size == 0) return Status::InvalidParameters;
+
+    std::string text = SignedText(manifest, model);
+    uint8_t digest[Sha256::SIZE];
+    Sha256::Hash(reinterpret_cast<const uint8_t*>(text.data()), text.size(), digest);
+    return verifier(digest, signature, size) ? Status::Ok : Status::InvalidParameters;
+}
+
+bool OtaManifest::ParseHash(const char* hex, uint8_t out[Sha256::SIZE])
+{
+    if (hex == nullptr || strlen(hex) != 2 * Sha256::SIZE) return false;
+    for (size_t i = 0; i < Sha256::SIZE; i++)
+    {
+        int high = HexDigit(hex[2 * i]);
+        int low = HexDigit(hex[2 * i + 1]);
+        if (high < 0 || low < 0) return false;
+        out[i] = static_cast<uint8_t>((high << 4) | low);
+    }
+    return true;
+}
+
+size_t OtaManifest::DecodeBase64(const char* text, uint8_t* out, size_t capacity)
+{
+    if (text == nullptr) return 0;
+    size_t size = 0;
+    uint32_t bits = 0;
+    int count = 0;
+    for (; *text && *text != '='; text++)
+    {
+        int digit = Base64Digit(*text);
+        if (digit < 0) return 0;
+        bits = (bits << 6) | digit;
+        count += 6;
+        if (count >= 8)
+        {
+            count -= 8;
+            if (size >= capacity) return 0;
+            out[size++] = static_cast<uint8_t>(bits >> count);
+        }
+    }
+    for (; *text == '='; text++) {}
+    return *text ? 0 : size;
+}
@@ -0,0 +1,265 @@
+#include "network/StaticAssets.hpp"
+#include <esp_heap_caps.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+StaticAssets::~StaticAssets()
+{
+    deinit();
+}
+
+Status StaticAssets::init(const char* web_root)
+{
+    deinit();
+    root = web_root;
+    while (!root.empty() && root.back() == '/') root.pop_back();
+
+    // one buffer for every request : the server handles them one at a time
+    buffer = static_cast<uint8_t*>(heap_caps_malloc(WEB_CHUNK_SIZE, MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL));
+    if (buffer == nullptr) return Status::NoMemory;
+
+    load_manifest();
+    return Status::Ok;
+}
+
+void StaticAssets::deinit()
+{
+    for (CacheEntry& entry : cache)
+    {
+        heap_caps_free(entry.data);
+        entry.data = nullptr;
+    }
+    cached_bytes = 0;
+    heap_caps_free(buffer);
+    buffer = nullptr;
+    manifest.clear();
+}
+
+Status StaticAssets::resolve(const char* uri, Asset& out)
+{
+    std::string request(uri, strcspn(uri, "?#"));
+    if (request.find("..") != std::string::npos) return Status::InvalidParameters;
+    while (!request.empty() && request.back() == '/') request.pop_back();
+    std::string filepath = root + request;
+
+    struct stat st;
+    bool found;
+    if (stat((filepath + ".gz").c_str(), &st) == 0 && S_ISREG(st.st_mode))
+    {
+        found = fill(filepath + ".gz", true, MimeType(filepath.c_str()), out);
+    }
+    else if (stat(filepath.c_str(), &st) != 0)
+    {
+        // unknown path : the single page app routes it
+        found = fill(root + "/index.html.gz", true, "text/html", out);
+    }
+    else if (S_ISDIR(st.st_mode))
+    {
+        found = fill(filepath + "/index.html.gz", true, "text/html", out) || fill(filepath + "/index.html", false, "text/html", out);
+    }
+    else
+    {
+        found = fill(filepath, false, MimeType(filepath.c_str()), out);
+    }
+
+    if (!found) return Status::NotFound;
+    stats.requests++;
+    return Status::Ok;
+}
+
+bool StaticAssets::notModified(const Asset& asset, const char* if_none_match)
+{
+    if (if_none_match == nullptr || !MatchesETag(if_none_match, asset.etag)) return false;
+    stats.not_modified++;
+    return true;
+}
+
+const uint8_t* StaticAssets::getCached(const Asset& asset)
+{
+    for (CacheEntry& entry : cache)
+    {
+        if (entry.data != nullptr && entry.size == asset.size && strcmp(entry.path, asset.path) == 0)
+        {
+            entry.last_use = ++use_clock;
+            stats.cache_hits++;
+            return entry.data;
+        }
+    }
+    return nullptr;
+}
+
+Status StaticAssets::stream(const Asset& asset, const Sink& sink)
+{
+    if (buffer == nullptr) return Status::InvalidState;
+
+    FILE* fd = fopen(asset.path, "rb");
+    if (!fd) return Status::Failure;
+    stats.cache_misses++;
+
+    bool cacheable = asset.gzip && asset.size > 0 && asset.size <= WEB_ASSET_CACHE_MAX_FILE && asset.size <= WEB_ASSET_CACHE_SIZE;
+    CacheEntry* entry = cacheable ? reserve(asset) : nullptr;
+    auto drop = [this](CacheEntry*& e) {
+        if (e == nullptr) return;
+        cached_bytes -= e->size;
+        heap_caps_free(e->data);
+        e->data = nullptr;
+        e = nullptr;
+    };
+
+    size_t offset = 0;
+    size_t chunk_size;
+    while ((chunk_size = fread(buffer, 1, WEB_CHUNK_SIZE, fd)) > 0)
+    {
+        stats.bytes_read += chunk_size;
+        if (entry != nullptr)
+        {
+            if (offset + chunk_size <= entry->size) memcpy(entry->data + offset, buffer, chunk_size);
+            else drop(entry); // the file grew since resolve()
+        }
+        offset += chunk_size;
+
+        if (!sink(buffer, chunk_size))
+        {
+            drop(entry);
+            fclose(fd);
+            return Status::InvalidState;
+        }
+    }
+    fclose(fd);
+
+    if (entry != nullptr && offset != entry->size) drop(entry);
+    return Status::Ok;
+}
+
+StaticAssets::Stats StaticAssets::getStats() const
+{
+    Stats current = stats;
+    current.cached_bytes = cached_bytes;
+    return current;
+}
+
+const char* StaticAssets::CacheControl(const Asset& asset)
+{
+    static char immutable[64];
+    if (immutable[0] == '\0') snprintf(immutable, sizeof(immutable), "public, max-age=%lu, immutable", static_cast<unsigned long>(WEB_IMMUTABLE_MAX_AGE));
+
+    // the others may change with a new build : the browser asks again, a 304 is cheap
+    return asset.immutable ? immutable : "no-cache";
+}
+
+bool StaticAssets::MatchesETag(const char* if_none_match, const char* etag)
+{
+    if (etag == nullptr || etag[0] == '\0') return false;
+    size_t etag_length = strlen(etag);
+
+    const char* p = if_none_match;
+    while (*p != '\0')
+    {
+        while (*p == ' ' || *p == '\t' || *p == ',') p++;
+        const char* end = p + strcspn(p, ",");
+        const char* last = end;
+        while (last > p && (last[-1] == ' ' || last[-1] == '\t')) last--;
+
+        // weak comparison : a weak ETag of the same content matches
+        const char* tag = p;
+        if (last - tag >= 2 && tag[0] == 'W' && tag[1] == '/') tag += 2;
+        size_t length = last - tag;
+        if ((length == 1 && tag[0] == '*') || (length == etag_length && memcmp(tag, etag, length) == 0)) return true;
+        p = end;
+    }
+    return false;
+}
+
+const char* StaticAssets::MimeType(const char* path)
+{
+    const char* ext = strrchr(path, '.');
+    if (!ext) return "application/octet-stream";
+
+    if (strcmp(ext, ".html") == 0) return "text/html";
+    if (strcmp(ext, ".js") == 0)   return "application/javascript";
+    if (strcmp(ext, ".css") == 0)  return "text/css";
+    if (strcmp(ext, ".png") == 0)  return "image/png";
+    if (strcmp(ext, ".jpg") == 0)  return "image/jpeg";
+    if (strcmp(ext, ".ico") == 0)  return "image/x-icon";
+    if (strcmp(ext, ".svg") == 0)  return "image/svg+xml";
+    if (strcmp(ext, ".json") == 0) return "application/json";
+    if (strcmp(ext, ".woff2") == 0) return "font/woff2";
+    if (strcmp(ext, ".glb") == 0)  return "model/gltf-binary";
+
+    return "text/plain";
+}
+
+Status StaticAssets::load_manifest()
+{
+    FILE* fd = fopen((root + WEB_ASSETS_MANIFEST).c_str(), "r");
+    if (!fd) return Status::NotFound;
+
+    char line[PATH_SIZE + ETAG_SIZE + 4];
+    while (fgets(line, sizeof(line), fd))
+    {
+        char* separator = strrchr(line, ' ');
+        if (separator == nullptr || line[0] != '/') continue;
+        *separator = '\0';
+        char* hash = separator + 1;
+        hash[strcspn(hash, "\r\n")] = '\0';
+        if (hash[0] == '\0' || strlen(hash) + 2 >= ETAG_SIZE) continue;
+        manifest.push_back({ line, std::string("\"") + hash + "\"" });
+    }
+    fclose(fd);
+
+    std::sort(manifest.begin(), manifest.end(), [](const ManifestEntry& a, const ManifestEntry& b) { return a.path < b.path; });
+    return Status::Ok;
+}
+
+bool StaticAssets::fill(const std::string& path, bool gzip, const char* mime, Asset& out)
+{
+    struct stat st;
+    if (path.size() >= PATH_SIZE || stat(path.c_str(), &st) != 0 || !S_ISREG(st.st_mode)) return false;
+
+    memcpy(out.path, path.c_str(), path.size() + 1);
+    out.mime = mime;
+    out.gzip = gzip;
+    out.size = st.st_size;
+
+    std::string key = path.substr(root.size());
+    auto it = std::lower_bound(manifest.begin(), manifest.end(), key,
+                               [](const ManifestEntry& entry, const std::string& k) { return entry.path < k; });
+    out.etag[0] = '\0';
+    if (it != manifest.end() && it->path == key) memcpy(out.etag, it->etag.c_str(), it->etag.size() + 1);
+
+    // hashed names sit right in the build assets folder (not in its subfolders, like builds/latest.json)
+    size_t prefix = strlen(WEB_IMMUTABLE_DIR);
+    out.immutable = key.compare(0, prefix, WEB_IMMUTABLE_DIR) == 0 && key.find('/', prefix) == std::string::npos;
+    return true;
+}
+
+StaticAssets::CacheEntry* StaticAssets::reserve(const Asset& asset)
+{
+    // free entry, evicting the least recently used ones until the asset fits
+    while (true)
+    {
+        CacheEntry* free_entry = nullptr;
+        CacheEntry* oldest = nullptr;
+        for (CacheEntry& entry : cache)
+        {
+            if (entry.data == nullptr) free_entry = free_entry ? free_entry : &entry;
+            else if (oldest == nullptr || entry.last_use < oldest->last_use) oldest = &entry;
+        }
+        if (free_entry != nullptr && cached_bytes + asset.size <= WEB_ASSET_CACHE_SIZE)
+        {
+            free_entry->data = static_cast<uint8_t*>(heap_caps_malloc(asset.size, MALLOC_CAP_8BIT | MALLOC_CAP_SPIRAM));
+            if (free_entry->data == nullptr) return nullptr;
+            memcpy(free_entry->path, asset.path, sizeof(free_entry->path));
+            free_entry->size = asset.size;
+            free_entry->last_use = ++use_clock;
+            cached_bytes += asset.size;
+            return free_entry;
+        }
+        if (oldest == nullptr) return nullptr;
+        cached_bytes -= oldest->size;
+        heap_caps_free(oldest->data);
+        oldest->data = nullptr;
+    }
+}
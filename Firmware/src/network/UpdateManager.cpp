@@ -1,16 +1,283 @@
 #include "network/UpdateManager.hpp"
+#include "network/OtaDownload.hpp"
 #include "esp_http_client.h"
 #include "esp_partition.h"
-#include "esp_https_ota.h"
 #include "esp_ota_ops.h"
+#include "mbedtls/pk.h"
 #include "common/Log.hpp"
 #include "common/config.hpp"
 #include "ArduinoJson.hpp"
+#include <algorithm>
+#include <cstring>
 
 // Code-embeded root CA certificate (PEM format)
 extern const uint8_t root_ca_pem_start[] asm("_binary_root_ca_pem_start");
 extern const uint8_t root_ca_pem_end[]   asm("_binary_root_ca_pem_end");
 
+// Code-embeded public key of the update manifest signatures (PEM format, just a note until a key is put there)
+extern const uint8_t ota_manifest_key_pem_start[] asm("_binary_ota_manifest_key_pem_start");
+extern const uint8_t ota_manifest_key_pem_end[]   asm("_binary_ota_manifest_key_pem_end");
+
+#if OTA_REQUIRE_SIGNED_MANIFEST
+#warning "OTA_REQUIRE_SIGNED_MANIFEST is set : without a manifest key in certs/ota_manifest_key.pem, this build refuses every update"
+#endif
+
+namespace
+{
+    /**
+     * @brief Image on the update server or CDN, requested from an offset with a Range header to resume.
+     */
+    class HttpSource : public OtaDownload::Source
+    {
+    public:
+        explicit HttpSource(const std::string& url) : url(url) {}
+        ~HttpSource() override { close(); }
+
+        ::Status open(uint32_t offset, uint32_t& start, uint32_t& total) override
+        {
+            esp_http_client_config_t config = {};
+            config.url = url.c_str();
+            config.cert_pem = (char *)root_ca_pem_start;
+            config.timeout_ms = OTA_UPDATE_TIMEOUT_MS;
+            config.buffer_size = OTA_CHUNK_SIZE;
+            config.event_handler = OnEvent;
+            config.user_data = this;
+
+            content_range.clear();
+            client = esp_http_client_init(&config);
+            if (!client)
+            {
+                LOG_ERROR(UpdateManager::TAG, "Failed to initialize HTTP client.");
+                return ::Status::NoMemory;
+            }
+            if (offset > 0)
+            {
+                char range[24];
+                snprintf(range, sizeof(range), "bytes=%lu-", static_cast<unsigned long>(offset));
+                esp_http_client_set_header(client, "Range", range);
+            }
+
+            if (esp_err_t err = esp_http_client_open(client, 0); err != ESP_OK)
+            {
+                LOG_WARNING(UpdateManager::TAG, "Failed to open HTTP connection: %d", err);
+                close();
+                return ::Status::Failure;
+            }
+            int64_t length = esp_http_client_fetch_headers(client);
+            int code = esp_http_client_get_status_code(client);
+            if (code == 206)
+            {
+                unsigned long first, last, size;
+                if (sscanf(content_range.c_str(), "bytes %lu-%lu/%lu", &first, &last, &size) != 3)
+                {
+                    LOG_ERROR(UpdateManager::TAG, "Invalid Content-Range: '%s'", content_range.c_str());
+                    close();
+                    return ::Status::InvalidState;
+                }
+                start = first;
+                total = size;
+                return ::Status::Ok;
+            }
+            if (code == 200)
+            {
+                start = 0;
+                total = length > 0 ? static_cast<uint32_t>(length) : 0;
+                return ::Status::Ok;
+            }
+
+            LOG_ERROR(UpdateManager::TAG, "HTTP %d for %s", code, url.c_str());
+            close();
+            return code >= 500 ? ::Status::Failure : ::Status::NotFound;
+        }
+
+        int read(uint8_t* buffer, size_t size) override
+        {
+            return esp_http_client_read(client, reinterpret_cast<char*>(buffer), size);
+        }
+
+        void close() override
+        {
+            if (!client) return;
+            esp_http_client_close(client);
+            esp_http_client_cleanup(client);
+            client = nullptr;
+        }
+
+    private:
+        std::string url;
+        std::string content_range;
+        esp_http_client_handle_t client = nullptr;
+
+        // esp_http_client_get_header() only reads request headers, response ones come through events
+        static esp_err_t OnEvent(esp_http_client_event_t* event)
+        {
+            if (event->event_id == HTTP_EVENT_ON_HEADER && strcasecmp(event->header_key, "Content-Range") == 0)
+            {
+                static_cast<HttpSource*>(event->user_data)->content_range = event->header_value;
+            }
+            return ESP_OK;
+        }
+    };
+
+    /**
+     * @brief Next OTA app partition, marked as boot partition once the image is complete (esp_ota_end validates it).
+     */
+    class FirmwarePartition : public OtaDownload::Target
+    {
+    public:
+        ::Status begin(uint32_t size) override
+        {
+            partition = esp_ota_get_next_update_partition(nullptr);
+            if (!partition)
+            {
+                LOG_ERROR(UpdateManager::TAG, "Failed to find OTA partition.");
+                return ::Status::NotFound;
+            }
+            if (size > partition->size)
+            {
+                LOG_ERROR(UpdateManager::TAG, "Update size (%lu) exceeds partition size (%lu).", static_cast<unsigned long>(size), static_cast<unsigned long>(partition->size));
+                return ::Status::OutOfBounds;
+            }
+            // sequential writes erase sector by sector while writing, instead of the whole partition upfront
+            if (esp_err_t err = esp_ota_begin(partition, OTA_WITH_SEQUENTIAL_WRITES, &handle); err != ESP_OK)
+            {
+                LOG_ERROR(UpdateManager::TAG, "OTA begin failed: %d", err);
+                return ::Status::Failure;
+            }
+            return ::Status::Ok;
+        }
+
+        ::Status write(const uint8_t* data, size_t size) override
+        {
+            if (esp_err_t err = esp_ota_write(handle, data, size); err != ESP_OK)
+            {
+                LOG_ERROR(UpdateManager::TAG, "OTA write failed: %d", err);
+                return ::Status::Failure;
+            }
+            return ::Status::Ok;
+        }
+
+        ::Status finish() override
+        {
+            esp_err_t err = esp_ota_end(handle);
+            handle = 0;
+            if (err != ESP_OK)
+            {
+                LOG_ERROR(UpdateManager::TAG, "Firmware update finish failed: %d", err);
+                if (err == ESP_ERR_OTA_VALIDATE_FAILED) LOG_ERROR(UpdateManager::TAG, "Image validation failed, image is corrupted.");
+                return ::Status::Failure;
+            }
+            if (err = esp_ota_set_boot_partition(partition); err != ESP_OK)
+            {
+                LOG_ERROR(UpdateManager::TAG, "Failed to set boot partition: %d", err);
+                return ::Status::Failure;
+            }
+            return ::Status::Ok;
+        }
+
+        void abort() override
+        {
+            if (handle) esp_ota_abort(handle);
+            handle = 0;
+        }
+
+    private:
+        const esp_partition_t* partition = nullptr;
+        esp_ota_handle_t handle = 0;
+    };
+
+    /**
+     * @brief Storage data partition (filesystem image), erased sector by sector ahead of the writes.
+     */
+    class StoragePartition : public OtaDownload::Target
+    {
+    public:
+        ::Status begin(uint32_t size) override
+        {
+            partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "storage");
+            if (!partition)
+            {
+                LOG_ERROR(UpdateManager::TAG, "Failed to find storage partition.");
+                return ::Status::NotFound;
+            }
+            if (size > partition->size)
+            {
+                LOG_ERROR(UpdateManager::TAG, "Update size (%lu) exceeds partition size (%lu).", static_cast<unsigned long>(size), static_cast<unsigned long>(partition->size));
+                return ::Status::OutOfBounds;
+            }
+            written = 0;
+            erased = 0;
+            return ::Status::Ok;
+        }
+
+        ::Status write(const uint8_t* data, size_t size) override
+        {
+            if (::Status err = erase_to(written + size); err != ::Status::Ok) return err;
+            if (esp_err_t err = esp_partition_write(partition, written, data, size); err != ESP_OK)
+            {
+                LOG_ERROR(UpdateManager::TAG, "Failed to write to partition at offset %lu: %d", static_cast<unsigned long>(written), err);
+                return ::Status::Failure;
+            }
+            written += size;
+            return ::Status::Ok;
+        }
+
+        ::Status finish() override
+        {
+            // the rest of the partition is left erased, like the full erase before the download used to
+            return erase_to(partition->size);
+        }
+
+        void abort() override {}
+
+    private:
+        const esp_partition_t* partition = nullptr;
+        uint32_t written = 0;
+        uint32_t erased = 0;
+
+        ::Status erase_to(uint32_t end)
+        {
+            if (end <= erased) return ::Status::Ok;
+            uint32_t sector = partition->erase_size;
+            end = std::min<uint32_t>((end + sector - 1) / sector * sector, partition->size);
+            if (esp_err_t err = esp_partition_erase_range(partition, erased, end - erased); err != ESP_OK)
+            {
+                LOG_ERROR(UpdateManager::TAG, "Failed to erase storage partition: %d", err);
+                return ::Status::Failure;
+            }
+            erased = end;
+            return ::Status::Ok;
+        }
+    };
+
+    const char* ManifestKey()
+    {
+        return reinterpret_cast<const char*>(ota_manifest_key_pem_start);
+    }
+
+    /**
+     * @brief If the build embedded a manifest key (certs/ota_manifest_key.pem holds a PEM block, not only its note).
+     */
+    bool HasManifestKey()
+    {
+        return strstr(ManifestKey(), "-----BEGIN") != nullptr;
+    }
+
+    /**
+     * @brief Check a manifest signature with the key of the update server (certs/ota_manifest_key.pem).
+     */
+    bool VerifySignature(const uint8_t digest[Sha256::SIZE], const uint8_t* signature, size_t size)
+    {
+        mbedtls_pk_context key;
+        mbedtls_pk_init(&key);
+        int ret = mbedtls_pk_parse_public_key(&key, reinterpret_cast<const unsigned char*>(ManifestKey()), strlen(ManifestKey()) + 1);
+        if (ret != 0) LOG_ERROR(UpdateManager::TAG, "Invalid manifest public key: -0x%04X", -ret);
+        else ret = mbedtls_pk_verify(&key, MBEDTLS_MD_SHA256, digest, Sha256::SIZE, signature, size);
+        mbedtls_pk_free(&key);
+        return ret == 0;
+    }
+}
+
 UpdateManager::UpdateManager()
 {
 }
@@ -19,6 +286,12 @@ Status UpdateManager::init()
 {
     LOG_SCOPE(TAG, "UpdateManager::init");
 
+    if (!HasManifestKey())
+    {
+        if (OTA_REQUIRE_SIGNED_MANIFEST) LOG_ERROR(TAG, "No manifest key and OTA_REQUIRE_SIGNED_MANIFEST set : updates are disabled");
+        else LOG_WARNING(TAG, "No manifest key in this build : update manifests are not authenticated");
+    }
+
     return ::Status::Ok;
 }
 
@@ -37,6 +310,11 @@ float UpdateManager::getProgress()
     return progress;
 }
 
+float UpdateManager::getThroughput()
+{
+    return throughput;
+}
+
 std::string UpdateManager::getLatestVersion()
 {
     return latest_version;
@@ -86,18 +364,18 @@ Status UpdateManager::startUpdate()
     BaseType_t ret = xTaskCreatePinnedToCore([](void* param) {
         UpdateManager* self = static_cast<UpdateManager*>(param);
         // First download the firmware
-        if (self->download_firmware() != ::Status::Ok)
+        if (::Status err = self->download_firmware(); err != ::Status::Ok)
         {
             LOG_ERROR(TAG, "Firmware update failed, aborting update process");
-            self->status = Status::ErrorFirmwareUpdateFailed;
+            self->status = err == ::Status::InvalidParameters ? Status::ErrorIntegrity : Status::ErrorFirmwareUpdateFailed;
             vTaskDelete(nullptr);
             return;
         }
         // Then download the filesystem
-        if (self->download_filesystem() != ::Status::Ok)
+        if (::Status err = self->download_filesystem(); err != ::Status::Ok)
         {
             LOG_ERROR(TAG, "Filesystem update failed, aborting update process");
-            self->status = Status::ErrorFilesystemUpdateFailed;
+            self->status = err == ::Status::InvalidParameters ? Status::ErrorIntegrity : Status::ErrorFilesystemUpdateFailed;
             vTaskDelete(nullptr);
             return;
         }
@@ -159,6 +437,16 @@ Status UpdateManager::check_update()
     config.timeout_ms = OTA_UPDATE_TIMEOUT_MS;
 
     esp_http_client_handle_t client = esp_http_client_init(&config);
+    if (!client)
+    {
+        LOG_ERROR(TAG, "Failed to initialize HTTP client.");
+        status = Status::ErrorHTTPClient;
+        return ::Status::Failure;
+    }
+    struct ClientCleaner {
+        esp_http_client_handle_t c;
+        ~ClientCleaner() { esp_http_client_cleanup(c); }
+    } cleaner{client};
     esp_http_client_set_header(client, "x-robot-model", OTA_ROBOT_MODEL);
 
     if (esp_err_t err = esp_http_client_open(client, 0); err != ESP_OK)
@@ -169,16 +457,24 @@ Status UpdateManager::check_update()
     }
 
     esp_http_client_fetch_headers(client);
-    
-    char buffer[1024];
-    int read_len = esp_http_client_read(client, buffer, sizeof(buffer) - 1);
+
+    // the manifest may take several reads (hashes and signature)
+    char buffer[1536];
+    int read_len = 0;
+    while (read_len < static_cast<int>(sizeof(buffer)) - 1)
+    {
+        int len = esp_http_client_read(client, buffer + read_len, sizeof(buffer) - 1 - read_len);
+        if (len <= 0) break;
+        read_len += len;
+    }
+    esp_http_client_close(client);
     if (read_len <= 0)
     {
         LOG_ERROR(TAG, "Failed to read response from API");
         status = Status::ErrorEmptyResponse;
         return ::Status::Unknown;
     }
-    
+
     buffer[read_len] = 0; // Null terminate for safety
 
     ArduinoJson::JsonDocument json;
@@ -193,25 +489,80 @@ Status UpdateManager::check_update()
     const char *ver = json["version"];
     const char *fw_url = json["firmwareDownloadUrl"];
     const char *fs_url = json["filesystemDownloadUrl"];
+    const char *fw_hash = json["firmwareSha256"];
+    const char *fs_hash = json["filesystemSha256"];
+    const char *signature = json["signature"];
 
+    OtaManifest::Manifest latest = {};
     if (!ver || !fw_url || !fs_url)
     {
         LOG_ERROR(TAG, "API response is missing required fields");
         status = Status::ErrorInvalidJson;
         return ::Status::Unknown;
     }
+    latest.version = ver;
+    latest.firmware.url = fw_url;
+    latest.firmware.size = json["firmwareSize"] | 0u;
+    latest.filesystem.url = fs_url;
+    latest.filesystem.size = json["filesystemSize"] | 0u;
+
+    // servers before the signed manifests give no size nor hash : kept working, but without resume nor hash check
+    bool legacy = !fw_hash && !fs_hash && latest.firmware.size == 0 && latest.filesystem.size == 0;
+    if (legacy)
+    {
+        // a signature would only cover the version, the images themselves stay unchecked : never with a key
+        if (HasManifestKey())
+        {
+            LOG_ERROR(TAG, "Legacy manifest (no image sizes nor hashes) refused : this build checks the images");
+            update_available = false;
+            status = Status::ErrorIntegrity;
+            return ::Status::InvalidParameters;
+        }
+        LOG_WARNING(TAG, "Legacy manifest (no image sizes nor hashes) : images won't be resumed nor checked");
+    }
+    else if (!OtaManifest::ParseHash(fw_hash, latest.firmware.sha256) || !OtaManifest::ParseHash(fs_hash, latest.filesystem.sha256)
+             || latest.firmware.size == 0 || latest.filesystem.size == 0)
+    {
+        LOG_ERROR(TAG, "API response has invalid or partial image sizes and hashes");
+        status = Status::ErrorInvalidJson;
+        return ::Status::Unknown;
+    }
+
+    // with a key every manifest must be signed by it, without one they are accepted unsigned unless a signature is required
+    if (HasManifestKey())
+    {
+        uint8_t raw_signature[512];
+        size_t signature_size = OtaManifest::DecodeBase64(signature, raw_signature, sizeof(raw_signature));
+        if (OtaManifest::Verify(latest, OTA_ROBOT_MODEL, raw_signature, signature_size, VerifySignature) != ::Status::Ok)
+        {
+            LOG_ERROR(TAG, "Manifest signature is missing or invalid");
+            update_available = false;
+            status = Status::ErrorIntegrity;
+            return ::Status::InvalidParameters;
+        }
+    }
+    else if (OTA_REQUIRE_SIGNED_MANIFEST)
+    {
+        LOG_ERROR(TAG, "No manifest key in this build (certs/ota_manifest_key.pem), updates are refused");
+        update_available = false;
+        status = Status::ErrorNoManifestKey;
+        return ::Status::InvalidState;
+    }
+    else
+    {
+        LOG_WARNING(TAG, "Unsigned manifest accepted : no manifest key in this build");
+    }
 
-    // copy in member variables
-    latest_version = ver;
-    firmware_download_url = fw_url;
-    filesystem_download_url = fs_url;
-    
     json.clear(); // Free JSON document memory
 
-    LOG_DEBUG(TAG, "Comparing version strings: %s vs %s", ver, FIRMWARE_VERSION);
+    // copy in member variables
+    latest_version = latest.version;
+    manifest = std::move(latest);
+
+    LOG_DEBUG(TAG, "Comparing version strings: %s vs %s", latest_version.c_str(), FIRMWARE_VERSION);
     if (latest_version.compare(FIRMWARE_VERSION) != 0) // if not matching, probably higher.
     {
-        LOG_DEBUG(TAG, "New version found: %s", ver);
+        LOG_DEBUG(TAG, "New version found: %s", latest_version.c_str());
         update_available = true;
     }
     else
@@ -221,199 +572,49 @@ Status UpdateManager::check_update()
     }
     status = Status::Done;
 
-    return ::Status::Unknown;
+    return ::Status::Ok;
 }
 
 Status UpdateManager::download_firmware()
 {
-    if (firmware_download_url.empty())
-    {
-        LOG_ERROR(TAG, "Firmware download URL is empty");
-        return ::Status::InvalidState;
-    }
-
     status = Status::DownloadingFirmware;
-    progress = 0.0f;
-
-    LOG_DEBUG(TAG, "Starting firmware update from URL: %s", firmware_download_url);
-    esp_http_client_config_t config = {};
-    config.url = firmware_download_url.c_str();
-    config.cert_pem = (char *)root_ca_pem_start;
-    config.keep_alive_enable = true;
-    config.timeout_ms = OTA_UPDATE_TIMEOUT_MS;
-
-    esp_https_ota_config_t ota_config = {};
-    ota_config.http_config = &config;
-
-    // 1. Initialize OTA session
-    esp_https_ota_handle_t https_ota_handle = nullptr;
-    esp_err_t err = esp_https_ota_begin(&ota_config, &https_ota_handle);
-    if (err != ESP_OK)
-    {
-        LOG_ERROR(TAG, "ESP HTTPS OTA Begin failed: %d", err);
-        status = Status::ErrorFirmwareUpdateFailed;
-        return ::Status::Failure;
-    }
-
-    status = Status::UpdatingFirmware;
-    LOG_INFO(TAG, "OTA session started, downloading...");
-
-    // 2. Loop for downloading and writing firmware in chunks, while updating progress
-    while (true)
-    {
-        err = esp_https_ota_perform(https_ota_handle);
-        
-        if (err != ESP_ERR_HTTPS_OTA_IN_PROGRESS)
-            break; // Download is either complete or failed
+    FirmwarePartition target;
+    if (::Status err = download_image(manifest.firmware, target, Status::UpdatingFirmware); err != ::Status::Ok) return err;
 
-        // Update progress
-        int len_read = esp_https_ota_get_image_len_read(https_ota_handle);
-        int total_len = esp_https_ota_get_image_size(https_ota_handle);
-
-        if (total_len > 0)
-        {
-            progress = static_cast<float>(len_read) / static_cast<float>(total_len);
-        }
-    }
-
-    // 3. Verify if the data is correct
-    if (esp_https_ota_is_complete_data_received(https_ota_handle) != true)
-    {
-        LOG_ERROR(TAG, "Complete data was not received.");
-        esp_https_ota_abort(https_ota_handle); // Cancel OTA session and free resources
-        status = Status::ErrorFirmwareUpdateFailed;
-        return ::Status::Failure;
-    }
-
-    // 4. Finishing OTA update
-    err = esp_https_ota_finish(https_ota_handle);
-    if (err != ESP_OK)
-    {
-        LOG_ERROR(TAG, "Firmware update finish failed: %d", err);
-        if (err == ESP_ERR_OTA_VALIDATE_FAILED) {
-            LOG_ERROR(TAG, "Image validation failed, image is corrupted.");
-        }
-        status = Status::ErrorFirmwareUpdateFailed;
-        return ::Status::Failure;
-    }
-    
     LOG_INFO(TAG, "Firmware update applied successfully.");
-    
     status = Status::Done;
     return ::Status::Ok;
 }
 
 Status UpdateManager::download_filesystem()
 {
-    if (filesystem_download_url.empty())
-    {
-        LOG_ERROR(TAG, "Filesystem download URL is empty");
-        return ::Status::InvalidState;
-    }
-
     status = Status::DownloadingFilesystem;
-    progress = 0.0f;
-
-    LOG_DEBUG(TAG, "Starting filesystem update from URL: %s", filesystem_download_url.c_str());
-
-    // 1. Find Partition
-    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, "storage");
-    if (!part) {
-        LOG_ERROR(TAG, "Failed to find storage partition.");
-        status = Status::ErrorPartitionNotFound;
-        return ::Status::Failure; 
-    }
-    LOG_DEBUG(TAG, "Storage partition found: addr 0x%X, size %d bytes.", part->address, part->size);
+    StoragePartition target;
+    if (::Status err = download_image(manifest.filesystem, target, Status::UpdatingFilesystem); err != ::Status::Ok) return err;
 
-    // 2. Setup HTTP Client
-    esp_http_client_config_t config = {};
-    config.url = filesystem_download_url.c_str();
-    config.cert_pem = (char *)root_ca_pem_start;
-    config.timeout_ms = OTA_UPDATE_TIMEOUT_MS;
-    
-    esp_http_client_handle_t client = esp_http_client_init(&config);
-    if (!client) {
-        LOG_ERROR(TAG, "Failed to initialize HTTP client.");
-        status = Status::ErrorHTTPClient;
-        return ::Status::Failure;
-    }
-
-    // Auto-cleanup macro for the client (RAII-like pattern)
-    // Ensures client is cleaned up even if we return early
-    struct ClientCleaner {
-        esp_http_client_handle_t c;
-        ~ClientCleaner() { if (c) esp_http_client_cleanup(c); }
-    } cleaner{client};
-
-    // 3. Open Connection & Fetch Headers
-    if (esp_err_t err = esp_http_client_open(client, 0); err != ESP_OK) {
-        LOG_ERROR(TAG, "Failed to open HTTP connection: %d", err);
-        status = Status::ErrorUnreachable;
-        return ::Status::Failure;
-    }
-
-    int content_len = esp_http_client_fetch_headers(client);
-    if (content_len <= 0) {
-        LOG_ERROR(TAG, "Invalid content length from server: %d", content_len);
-        status = Status::ErrorEmptyResponse;
-        return ::Status::Failure;
-    }
+    LOG_INFO(TAG, "Filesystem update completed successfully.");
+    status = Status::Done;
+    return ::Status::Ok;
+}
 
-    // 4. Verify Size constraints
-    if (content_len > part->size) {
-        LOG_ERROR(TAG, "Update size (%d) exceeds partition size (%d).", content_len, part->size);
-        status = Status::ErrorOutOfBounds;
+Status UpdateManager::download_image(const OtaManifest::Image& image, OtaDownload::Target& target, Status updating)
+{
+    if (image.url.empty())
+    {
+        LOG_ERROR(TAG, "Download URL is empty");
         return ::Status::InvalidState;
     }
-    
-    // 5. Erase Partition
-    LOG_INFO(TAG, "Erasing storage partition (size: %d bytes)...", part->size);
-    if (esp_err_t err = esp_partition_erase_range(part, 0, part->size); err != ESP_OK) {
-        LOG_ERROR(TAG, "Failed to erase storage partition: %d", err);
-        status = Status::ErrorEraseStorage;
-        return ::Status::Failure;
-    }
-
-    // 6. Download and Write Loop
-    status = Status::UpdatingFilesystem;
-    char buffer[OTA_UPDATE_FILESYSTEM_BUFFER_SIZE];
-    size_t total_read = 0;
-    esp_err_t write_err = ESP_OK;
-
-    LOG_INFO(TAG, "Downloading and writing filesystem...");
-    
-    while (total_read < content_len) {
-        int read_len = esp_http_client_read(client, buffer, sizeof(buffer));
-        
-        if (read_len < 0) {
-            LOG_ERROR(TAG, "Error reading from HTTP stream.");
-            status = Status::ErrorFilesystemUpdateFailed;
-            return ::Status::Failure;
-        } else if (read_len == 0) {
-            LOG_WARNING(TAG, "Connection closed prematurely by server.");
-            break; 
-        }
-
-        write_err = esp_partition_write(part, total_read, buffer, read_len);
-        if (write_err != ESP_OK) {
-            LOG_ERROR(TAG, "Failed to write to partition at offset %d: %d", total_read, write_err);
-            status = Status::ErrorFilesystemUpdateFailed;
-            return ::Status::Failure;
-        }
 
-        total_read += read_len;
-        progress = static_cast<float>(total_read) / static_cast<float>(content_len);
-    }
-
-    // 7. Final Validation
-    if (total_read != content_len || write_err != ESP_OK) {
-        LOG_ERROR(TAG, "Filesystem update incomplete. Expected %d, got %d bytes.", content_len, total_read);
-        status = Status::ErrorFilesystemUpdateFailed;
-        return ::Status::Failure;
-    }
-
-    LOG_INFO(TAG, "Filesystem update completed successfully.");
-    status = Status::Done;
-    
-    return ::Status::Ok;
-}
\ No newline at end of file
+    progress = 0.0f;
+    throughput = 0.0f;
+    LOG_INFO(TAG, "Downloading %s (%lu bytes)", image.url.c_str(), static_cast<unsigned long>(image.size));
+
+    // network reads (reader task) overlap the hashing and flash writes (this task)
+    HttpSource source(image.url);
+    OtaDownload download;
+    return download.run(source, target, image, [this, updating](const OtaDownload::Progress& current) {
+        if (current.written > 0) status = updating;
+        progress = current.size > 0 ? static_cast<float>(current.written) / static_cast<float>(current.size) : 0.0f;
+        throughput = current.bytes_per_s;
+    });
+}
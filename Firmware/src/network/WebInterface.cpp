@@ -45,6 +45,11 @@ Status WebInterface::init()
     {
         return err;
     }
+    if (Status err = assets.init(MOUNT_POINT); err != Status::Ok)
+    {
+        LOG_ERROR(TAG, "Failed to initialize the static assets");
+        return err;
+    }
 
     // check if website files are present
     bool files_present = false;
@@ -106,6 +111,7 @@ Status WebInterface::deinit()
         httpd_stop(server);
         server = nullptr;
     }
+    assets.deinit();
     running = false;
     return Status::Ok;
 }
@@ -140,67 +146,47 @@ void WebInterface::registerURIHandlers()
     });
 }
 
-const char* WebInterface::get_mime_type(const char* filepath) {
-    const char* ext = strrchr(filepath, '.');
-    if (!ext) return "application/octet-stream";
-    
-    if (strcmp(ext, ".html") == 0) return "text/html";
-    if (strcmp(ext, ".js") == 0)   return "application/javascript";
-    if (strcmp(ext, ".css") == 0)  return "text/css";
-    if (strcmp(ext, ".png") == 0)  return "image/png";
-    if (strcmp(ext, ".jpg") == 0)  return "image/jpeg";
-    if (strcmp(ext, ".ico") == 0)  return "image/x-icon";
-    if (strcmp(ext, ".svg") == 0)  return "image/svg+xml";
-    if (strcmp(ext, ".json") == 0) return "application/json";
-    if (strcmp(ext, ".woff2") == 0) return "font/woff2";
-    if (strcmp(ext, ".glb") == 0)  return "model/gltf-binary";
-
-    return "text/plain";
-}
-
-esp_err_t WebInterface::send_file_chunked(httpd_req_t *req, const char *filepath, const char *mime_type, bool is_gzip)
+esp_err_t WebInterface::send_asset(httpd_req_t *req, const StaticAssets::Asset& asset)
 {
-    FILE *fd = fopen(filepath, "r");
-    if (!fd)
+    if (asset.etag[0] != '\0') httpd_resp_set_hdr(req, "ETag", asset.etag);
+    httpd_resp_set_hdr(req, "Cache-Control", StaticAssets::CacheControl(asset));
+
+    // the browser's copy is still the right one : no body, no file read
+    char if_none_match[128];
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", if_none_match, sizeof(if_none_match)) == ESP_OK
+        && assets.notModified(asset, if_none_match))
     {
-        LOG_ERROR(TAG, "Failed to read file: %s", filepath);
-        return HTTPD_500_INTERNAL_SERVER_ERROR;
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, nullptr, 0);
     }
 
-    httpd_resp_set_type(req, mime_type);
-    if (is_gzip)
+    httpd_resp_set_type(req, asset.mime);
+    if (asset.gzip)
     {
         httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
     }
 
-    char *chunk = (char*)malloc(4096); // 4KB buffer
-    if (!chunk)
+    // sent at once with its Content-Length, the connection stays open for the next request
+    if (const uint8_t* cached = assets.getCached(asset); cached != nullptr)
     {
-        fclose(fd);
-        return HTTPD_500_INTERNAL_SERVER_ERROR;
+        return httpd_resp_send(req, reinterpret_cast<const char*>(cached), asset.size);
     }
 
-    size_t chunksize;
-    do
+    Status err = assets.stream(asset, [req](const uint8_t* data, size_t size) {
+        return httpd_resp_send_chunk(req, reinterpret_cast<const char*>(data), size) == ESP_OK;
+    });
+    if (err == Status::Failure)
     {
-        chunksize = fread(chunk, 1, 4096, fd);
-        if (chunksize > 0)
-        {
-            if (httpd_resp_send_chunk(req, chunk, chunksize) != ESP_OK)
-            {
-                fclose(fd);
-                free(chunk);
-                return ESP_FAIL;
-            }
-        }
-    } while (chunksize != 0);
+        LOG_ERROR(TAG, "Failed to read file: %s", asset.path);
+        return httpd_resp_send_500(req);
+    }
+    if (err != Status::Ok)
+    {
+        return ESP_FAIL;
+    }
 
-    fclose(fd);
-    free(chunk);
-    
     // Indicate the end of the response
-    httpd_resp_send_chunk(req, NULL, 0);
-    return ESP_OK;
+    return httpd_resp_send_chunk(req, NULL, 0);
 }
 
 esp_err_t WebInterface::main_request_handler(httpd_req_t *req)
@@ -222,53 +208,12 @@ esp_err_t WebInterface::main_request_handler(httpd_req_t *req)
         }
     }
 
-    std::string filepath = MOUNT_POINT;
-    filepath += req->uri;
-
-    // Cleaning the URI by removing query parameters (if any)
-    size_t query_pos = filepath.find('?');
-    if (query_pos != std::string::npos) {
-        filepath = filepath.substr(0, query_pos);
-    }
-
-    struct stat st;
-
-    // Checking for a gzipped version of the file first (e.g., index.html.gz for index.html)
-    std::string filepath_gz = filepath + ".gz";
-    if (stat(filepath_gz.c_str(), &st) == 0)
-    {
-        return send_file_chunked(req, filepath_gz.c_str(), get_mime_type(filepath.c_str()), true);
-    }
-
-    // Checking if the file/folder exists (otherwise fallback to SPA)
-    if (stat(filepath.c_str(), &st) != 0)
-    {        
-        std::string index_path = std::string(MOUNT_POINT) + "/index.html.gz";
-        if (stat(index_path.c_str(), &st) == 0) {
-            return send_file_chunked(req, index_path.c_str(), "text/html", true);
-        }
-
-        return httpd_resp_send_404(req);
-    }
-
-    // If it's a directory, try to serve index.html.gz or index.html
-    if (S_ISDIR(st.st_mode))
+    StaticAssets::Asset asset;
+    if (assets.resolve(req->uri, asset) != Status::Ok)
     {
-        std::string index_gz_path = filepath + "/index.html.gz";
-        if (stat(index_gz_path.c_str(), &st) == 0) {
-            return send_file_chunked(req, index_gz_path.c_str(), "text/html", true);
-        }
-
-        std::string index_path = filepath + "/index.html";
-        if (stat(index_path.c_str(), &st) == 0) {
-            return send_file_chunked(req, index_path.c_str(), "text/html", false);
-        }
-
         return httpd_resp_send_404(req);
     }
-    
-    // Last option : serve the file directly
-    return send_file_chunked(req, filepath.c_str(), get_mime_type(filepath.c_str()), false);
+    return send_asset(req, asset);
 }
 
 esp_err_t WebInterface::safe_request_handler(httpd_req_t *req)
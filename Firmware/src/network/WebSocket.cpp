@@ -1,5 +1,6 @@
 #include "network/WebSocket.hpp"
 #include "common/Log.hpp"
+#include "common/Pool.hpp"
 #include "Robot.hpp"
 #include <esp_wifi.h>
 
@@ -12,6 +13,36 @@ namespace WebSocketUtils
         size_t len;
     };
 
+    // Message of the caller, sent without a copy (WebSocket::sendMessage)
+    struct AsyncWebsocketMessage {
+        httpd_handle_t hd;
+        int fd;
+        const uint8_t* payload;
+        size_t len;
+        Protocol::ITransport::SentCallback sent;
+        void* arg;
+    };
+
+    // Response messages (with their AsyncWebsocketResponse in front) and received frames, so that the
+    // protocol traffic doesn't fragment the internal RAM. Bigger messages use the heap.
+    using MessagePool = Pool<sizeof(AsyncWebsocketResponse) + sizeof(Protocol::MessageHeader) + WEBSOCKET_MAX_MSG_SIZE, WEBSOCKET_POOL_BLOCKS>;
+    static MessagePool message_pool;
+
+    static void* alloc_message(size_t size)
+    {
+        if (size <= MessagePool::BLOCK_SIZE)
+        {
+            if (void* block = message_pool.allocate()) return block;
+        }
+        return malloc(size);
+    }
+
+    static void free_message(void* message)
+    {
+        if (message_pool.owns(message)) message_pool.deallocate(message);
+        else free(message);
+    }
+
     static void ws_async_send_worker(void *arg) {
         AsyncWebsocketResponse* resp = static_cast<AsyncWebsocketResponse*>(arg);
         
@@ -27,8 +58,26 @@ namespace WebSocketUtils
             LOG_ERROR("WebSocket", "httpd_ws_send_frame_async failed with error 0x%0x", err);
         }
         
-        free(resp->payload);
-        delete resp;
+        free_message(resp); // payload is in the same allocation
+    }
+
+    static void ws_async_message_worker(void *arg) {
+        AsyncWebsocketMessage* msg = static_cast<AsyncWebsocketMessage*>(arg);
+
+        httpd_ws_frame_t ws_pkt;
+        memset(&ws_pkt, 0, sizeof(httpd_ws_frame_t));
+        ws_pkt.type = HTTPD_WS_TYPE_BINARY;
+        ws_pkt.payload = const_cast<uint8_t*>(msg->payload);
+        ws_pkt.len = msg->len;
+        ws_pkt.final = true;
+
+        esp_err_t err = httpd_ws_send_frame_async(msg->hd, msg->fd, &ws_pkt);
+        if (err != ESP_OK) {
+            LOG_DEBUG("WebSocket", "httpd_ws_send_frame_async failed with error 0x%0x", err);
+        }
+
+        msg->sent(msg->arg, err == ESP_OK);
+        free_message(msg);
     }
 }
 
@@ -39,6 +88,12 @@ WebSocket::WebSocket(uint16_t port) : server_port(port)
 Status WebSocket::init()
 {
     LOG_SCOPE(TAG, "WebSocket::init");
+
+    if (Status err = WebSocketUtils::message_pool.init(PoolPlacement::Internal); err != Status::Ok)
+    {
+        LOG_ERROR(TAG, "Failed to allocate the message pool");
+        return err;
+    }
     
     // create the web server
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
@@ -96,18 +151,20 @@ void WebSocket::sendResponse(void* context, const Protocol::MessageHeader& heade
 
     size_t total_len = sizeof(Protocol::MessageHeader) + header.length;
 
-    uint8_t* packet = (uint8_t*)malloc(total_len);
-    if (!packet) {
+    // response descriptor and packet share the same allocation
+    void* message = WebSocketUtils::alloc_message(sizeof(WebSocketUtils::AsyncWebsocketResponse) + total_len);
+    if (!message) {
         LOG_ERROR(TAG, "WebSocket::sendResponse malloc failed");
         return;
     }
+    uint8_t* packet = static_cast<uint8_t*>(message) + sizeof(WebSocketUtils::AsyncWebsocketResponse);
 
     memcpy(packet, &header, sizeof(Protocol::MessageHeader));
     if (header.length > 0 && payload != nullptr) {
         memcpy(packet + sizeof(Protocol::MessageHeader), payload, header.length);
     }
 
-    WebSocketUtils::AsyncWebsocketResponse* work_arg = new WebSocketUtils::AsyncWebsocketResponse{
+    WebSocketUtils::AsyncWebsocketResponse* work_arg = new (message) WebSocketUtils::AsyncWebsocketResponse{
         .hd = this->server_handle,
         .fd = fd,
         .payload = packet,
@@ -116,9 +173,36 @@ void WebSocket::sendResponse(void* context, const Protocol::MessageHeader& heade
 
     if (esp_err_t err = httpd_queue_work(this->server_handle, WebSocketUtils::ws_async_send_worker, work_arg); err != ESP_OK) {
         LOG_ERROR(TAG, "httpd_queue_work failed with error 0x%0x", err);
-        free(packet);
-        delete work_arg;
+        WebSocketUtils::free_message(message);
+    }
+}
+
+Status WebSocket::sendMessage(void* context, const uint8_t* message, size_t len, SentCallback sent, void* arg)
+{
+    if (!server_handle) {
+        return Status::InvalidState;
+    }
+
+    void* block = WebSocketUtils::alloc_message(sizeof(WebSocketUtils::AsyncWebsocketMessage));
+    if (!block) {
+        LOG_ERROR(TAG, "WebSocket::sendMessage malloc failed");
+        return Status::NoMemory;
+    }
+    WebSocketUtils::AsyncWebsocketMessage* work_arg = new (block) WebSocketUtils::AsyncWebsocketMessage{
+        .hd = this->server_handle,
+        .fd = (int)(uintptr_t)context,
+        .payload = message,
+        .len = len,
+        .sent = sent,
+        .arg = arg
+    };
+
+    if (esp_err_t err = httpd_queue_work(this->server_handle, WebSocketUtils::ws_async_message_worker, work_arg); err != ESP_OK) {
+        LOG_ERROR(TAG, "httpd_queue_work failed with error 0x%0x", err);
+        WebSocketUtils::free_message(block);
+        return Status::Failure;
     }
+    return Status::Ok;
 }
 
 uint8_t WebSocket::getNbClients() const
@@ -171,7 +255,7 @@ esp_err_t WebSocket::ws_handler(httpd_req_t* ws_req)
         return ESP_ERR_NO_MEM;
     }
 
-    ws_pkt.payload = (uint8_t*) malloc(ws_pkt.len + 1);
+    ws_pkt.payload = (uint8_t*) WebSocketUtils::alloc_message(ws_pkt.len + 1);
     if (!ws_pkt.payload) {
         LOG_ERROR(TAG, "WebSocket::ws_handler malloc failed");
         return ESP_ERR_NO_MEM;
@@ -180,7 +264,7 @@ esp_err_t WebSocket::ws_handler(httpd_req_t* ws_req)
     ret = httpd_ws_recv_frame(ws_req, &ws_pkt, ws_pkt.len);
     if (ret != ESP_OK) {
         LOG_ERROR(TAG, "httpd_ws_recv_frame failed with error 0x%X", ret);
-        free(ws_pkt.payload);
+        WebSocketUtils::free_message(ws_pkt.payload);
         return ESP_FAIL;
     }
 
@@ -189,6 +273,6 @@ esp_err_t WebSocket::ws_handler(httpd_req_t* ws_req)
     int fd = httpd_req_to_sockfd(ws_req);
     Protocol::GetDispatcher().handlePacket(this, (void*)(uintptr_t)fd, ws_pkt.payload, ws_pkt.len);
 
-    free(ws_pkt.payload);
+    WebSocketUtils::free_message(ws_pkt.payload);
     return ESP_OK;
 }
@@ -2,6 +2,7 @@
 #include "common/Log.hpp"
 #include "common/NVS.hpp"
 #include "Robot.hpp"
+#include <algorithm>
 
 static void wifi_event_handler(void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data)
 {
@@ -9,34 +10,42 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base, int32_t e
     self->__wifi_event_handler(event_base, event_id, event_data);
 }
 
+static void retry_timer_callback(void* arg)
+{
+    WiFiManager* self = static_cast<WiFiManager*>(arg);
+    self->__on_retry_timer();
+}
+
 void WiFiManager::__wifi_event_handler(esp_event_base_t event_base, int32_t event_id, void* event_data)
 {
+    std::lock_guard<std::mutex> lock(reconnect_mutex);
+    int64_t now_us = esp_timer_get_time();
+
     if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_START)
     {
         LOG_DEBUG(TAG, "STA started, attempting to connect");
-        esp_wifi_connect();
         mode = Station;
         state = Connecting;
+        run_command(reconnect.start(has_cached_ap(), now_us));
+    }
+    else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_SCAN_DONE)
+    {
+        on_scan_done();
+    }
+    else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_CONNECTED)
+    {
+        // access point actually joined, cached once the IP address comes
+        wifi_event_sta_connected_t* event = (wifi_event_sta_connected_t*) event_data;
+        memcpy(scanned_ap.bssid, event->bssid, sizeof(scanned_ap.bssid));
+        scanned_ap.channel = event->channel;
+        run_command(reconnect.onAssociated(now_us));
     }
     else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED)
     {
-        this->state = WiFiManager::Disconnected;
         memset(ip_address, 0, sizeof(ip_address));
         LOG_DEBUG(TAG, "WiFi disconnected, reason: %d", ((wifi_event_sta_disconnected_t*)event_data)->reason);
-
-        if (retry_count < WIFI_MAX_RETRIES)
-        {
-            esp_wifi_connect();
-            retry_count++;
-            LOG_DEBUG(TAG, "Reconnecting to WiFi (attempt %d)", retry_count);
-        }
-        else
-        {
-            LOG_DEBUG(TAG, "Failed to connect to WiFi after %d attempts", WIFI_MAX_RETRIES);
-            mode = Station;
-            state = Disconnected;
-            on_ap_disconnected();
-        }
+        run_command(reconnect.onDisconnected(now_us));
+        if (reconnect.getState() != WiFiReconnect::State::GaveUp) state = Connecting;
     }
     else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP)
     {
@@ -44,7 +53,25 @@ void WiFiManager::__wifi_event_handler(esp_event_base_t event_base, int32_t even
         state = Connected;
         ip_event_got_ip_t* event = (ip_event_got_ip_t*) event_data;
         snprintf(ip_address, sizeof(ip_address), IPSTR, IP2STR(&event->ip_info.ip));
-        LOG_DEBUG(TAG, "WiFi connected, IP obtained (%s)", ip_address);
+        run_command(reconnect.onGotIP(now_us));
+
+        WiFiReconnect::Timings timings = reconnect.getTimings();
+        LOG_DEBUG(TAG, "WiFi connected, IP obtained (%s) : scan %lu ms, assoc %lu ms, DHCP %lu ms, total %lu ms%s", ip_address,
+                  timings.scan_ms, timings.assoc_ms, timings.dhcp_ms, timings.total_ms, timings.fast ? " (cached AP)" : "");
+
+        // cache the access point for the next connection
+        if (nvs_handle_ptr && strlen(ssid) > 0)
+        {
+            strncpy(scanned_ap.ssid, ssid, sizeof(scanned_ap.ssid) - 1);
+            if (memcmp(&scanned_ap, &cached_ap, sizeof(cached_ap)) != 0)
+            {
+                cached_ap = scanned_ap;
+                if (nvs_handle_ptr->set("ap_cache", cached_ap) != Status::Ok)
+                {
+                    LOG_ERROR(TAG, "Failed to store the access point in NVS");
+                }
+            }
+        }
 
         // store if needed
         if (should_store_credentials)
@@ -80,11 +107,11 @@ void WiFiManager::__wifi_event_handler(esp_event_base_t event_base, int32_t even
             }
         }
         
-        retry_count = 0;
         on_ap_connected();
     }
     else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_AP_START)
     {
+        reconnect.stop();
         mode = AccessPoint;
         state = Connected;
         LOG_DEBUG(TAG, "WiFi AP started");
@@ -99,6 +126,15 @@ void WiFiManager::__wifi_event_handler(esp_event_base_t event_base, int32_t even
         memset(ip_address, 0, sizeof(ip_address));
         on_ap_stopped();
     }
+
+    arm_retry_timer();
+}
+
+void WiFiManager::__on_retry_timer()
+{
+    std::lock_guard<std::mutex> lock(reconnect_mutex);
+    run_command(reconnect.poll(esp_timer_get_time()));
+    arm_retry_timer();
 }
 
 WiFiManager::WiFiManager()
@@ -107,6 +143,18 @@ WiFiManager::WiFiManager()
     mode = Station;
 }
 
+WiFiReconnect::Timings WiFiManager::getTimings()
+{
+    std::lock_guard<std::mutex> lock(reconnect_mutex);
+    return reconnect.getTimings();
+}
+
+WiFiReconnect::Stats WiFiManager::getStats()
+{
+    std::lock_guard<std::mutex> lock(reconnect_mutex);
+    return reconnect.getStats();
+}
+
 Status WiFiManager::init()
 {
     LOG_SCOPE(TAG, "WiFiManager::init");
@@ -155,6 +203,17 @@ Status WiFiManager::init()
         return Status::Failure;
     }
 
+    // retries after a backoff and phase timeouts of the station connection
+    esp_timer_create_args_t timer_args = {};
+    timer_args.callback = &retry_timer_callback;
+    timer_args.arg = this;
+    timer_args.name = "wifi_retry";
+    if (esp_timer_create(&timer_args, &retry_timer) != ESP_OK)
+    {
+        LOG_ERROR(TAG, "Failed to create the WiFi retry timer");
+        return Status::Failure;
+    }
+
     if (Status err = NVS::Open("WiFi", &nvs_handle_ptr); err != Status::Ok)
     {
         LOG_ERROR(TAG, "Failed to open NVS namespace for WiFi: %d", static_cast<int>(err));
@@ -172,6 +231,11 @@ Status WiFiManager::init()
         LOG_DEBUG(TAG, "No stored password found in NVS");
         password[0] = '\0';
     }
+    if (nvs_handle_ptr->get("ap_cache", cached_ap) != Status::Ok)
+    {
+        LOG_DEBUG(TAG, "No cached access point found in NVS");
+        memset(&cached_ap, 0, sizeof(cached_ap));
+    }
 
     if (strlen(ssid) > 0)
     {
@@ -197,6 +261,13 @@ Status WiFiManager::init()
 
 Status WiFiManager::deinit()
 {
+    if (retry_timer)
+    {
+        esp_timer_stop(retry_timer);
+        esp_timer_delete(retry_timer);
+        retry_timer = nullptr;
+    }
+
     if (nvs_handle_ptr)
     {
         NVS::Close(nvs_handle_ptr);
@@ -213,6 +284,8 @@ Status WiFiManager::connect(const char* _ssid, const char* _password, bool store
         return Status::InvalidParameters;
     }
 
+    std::lock_guard<std::mutex> lock(reconnect_mutex);
+    reconnect.stop(); // restarts on WIFI_EVENT_STA_START
     strncpy(ssid, _ssid, sizeof(ssid) - 1);
     strncpy(password, _password, sizeof(password) - 1);
     should_store_credentials = store_credentials;
@@ -238,6 +311,8 @@ Status WiFiManager::createAccessPoint(const char* _ssid, const char* _password)
         return Status::InvalidParameters;
     }
 
+    std::lock_guard<std::mutex> lock(reconnect_mutex);
+    reconnect.stop();
     strncpy(ssid, _ssid, sizeof(ssid) - 1);
     strncpy(password, _password, sizeof(password) - 1);
 
@@ -300,6 +375,108 @@ Status WiFiManager::__connect_to_ap()
     return Status::Ok;
 }
 
+bool WiFiManager::has_cached_ap() const
+{
+    return cached_ap.channel != 0 && strncmp(cached_ap.ssid, ssid, sizeof(cached_ap.ssid)) == 0;
+}
+
+void WiFiManager::run_command(WiFiReconnect::Command command)
+{
+    switch (command)
+    {
+        case WiFiReconnect::Command::DropCache:
+        {
+            LOG_DEBUG(TAG, "Cached access point unreachable, forgetting it");
+            memset(&cached_ap, 0, sizeof(cached_ap));
+            if (nvs_handle_ptr) nvs_handle_ptr->erase("ap_cache");
+            [[fallthrough]];
+        }
+        case WiFiReconnect::Command::Scan:
+        {
+            wifi_scan_config_t scan_config = {};
+            scan_config.ssid = reinterpret_cast<uint8_t*>(ssid);
+            scan_config.show_hidden = true;
+            if (esp_err_t err = esp_wifi_scan_start(&scan_config, false); err != ESP_OK)
+            {
+                LOG_ERROR(TAG, "esp_wifi_scan_start failed with code 0x%x", err); // the phase timeout retries
+            }
+            break;
+        }
+        case WiFiReconnect::Command::Connect:
+            connect_to(scanned_ap);
+            break;
+        case WiFiReconnect::Command::ConnectCached:
+            LOG_DEBUG(TAG, "Connecting to the cached access point (channel %d)", cached_ap.channel);
+            connect_to(cached_ap);
+            break;
+        case WiFiReconnect::Command::Disconnect:
+            esp_wifi_scan_stop();
+            esp_wifi_disconnect();
+            break;
+        case WiFiReconnect::Command::GiveUp:
+            LOG_DEBUG(TAG, "Failed to connect to WiFi after %d retries", WIFI_MAX_RETRIES);
+            mode = Station;
+            state = Disconnected;
+            on_ap_disconnected();
+            break;
+        case WiFiReconnect::Command::None:
+            break;
+    }
+}
+
+void WiFiManager::connect_to(const CachedAP& ap)
+{
+    // a known BSSID and channel skip the scan of every channel done by esp_wifi_connect()
+    wifi_config_t wifi_config = {};
+    strncpy((char*)wifi_config.sta.ssid, ssid, sizeof(wifi_config.sta.ssid) - 1);
+    strncpy((char*)wifi_config.sta.password, password, sizeof(wifi_config.sta.password) - 1);
+    memcpy(wifi_config.sta.bssid, ap.bssid, sizeof(wifi_config.sta.bssid));
+    wifi_config.sta.bssid_set = true;
+    wifi_config.sta.channel = ap.channel;
+
+    if (esp_err_t err = esp_wifi_set_config(WIFI_IF_STA, &wifi_config); err != ESP_OK)
+    {
+        LOG_ERROR(TAG, "esp_wifi_set_config failed with code 0x%x", err);
+        return;
+    }
+    if (esp_err_t err = esp_wifi_connect(); err != ESP_OK)
+    {
+        LOG_ERROR(TAG, "esp_wifi_connect failed with code 0x%x", err); // the phase timeout retries
+    }
+}
+
+void WiFiManager::on_scan_done()
+{
+    uint16_t count = WIFI_SCAN_MAX_RECORDS;
+    wifi_ap_record_t records[WIFI_SCAN_MAX_RECORDS];
+    if (esp_wifi_scan_get_ap_records(&count, records) != ESP_OK) count = 0;
+
+    // strongest access point of the network
+    const wifi_ap_record_t* best = nullptr;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        if (strncmp((const char*)records[i].ssid, ssid, sizeof(records[i].ssid)) != 0) continue;
+        if (best == nullptr || records[i].rssi > best->rssi) best = &records[i];
+    }
+
+    if (best != nullptr)
+    {
+        memcpy(scanned_ap.bssid, best->bssid, sizeof(scanned_ap.bssid));
+        scanned_ap.channel = best->primary;
+    }
+    run_command(reconnect.onScanDone(best != nullptr, esp_timer_get_time()));
+}
+
+void WiFiManager::arm_retry_timer()
+{
+    if (retry_timer == nullptr) return;
+    esp_timer_stop(retry_timer);
+
+    int64_t deadline_us = reconnect.deadline();
+    if (deadline_us == WiFiReconnect::NO_DEADLINE) return;
+    esp_timer_start_once(retry_timer, std::max<int64_t>(deadline_us - esp_timer_get_time(), 0));
+}
+
 Status WiFiManager::__create_ap()
 {
     // Stop current WiFi mode if running
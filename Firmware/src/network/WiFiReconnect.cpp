@@ -0,0 +1,191 @@
+#include "network/WiFiReconnect.hpp"
+#include <algorithm>
+
+WiFiReconnect::WiFiReconnect(const Policy& policy, uint32_t seed)
+    : policy(policy), random_state(seed != 0 ? seed : 1)
+{
+}
+
+WiFiReconnect::Command WiFiReconnect::start(bool cached, int64_t now_us)
+{
+    has_cache = cached;
+    failures = 0;
+    fast_failures = 0;
+    first_attempt_us = now_us;
+    return attempt(now_us);
+}
+
+void WiFiReconnect::stop()
+{
+    state = State::Idle;
+}
+
+WiFiReconnect::Command WiFiReconnect::onScanDone(bool found, int64_t now_us)
+{
+    if (state != State::Scanning)
+    {
+        stats.ignored_events++;
+        return Command::None;
+    }
+
+    scan_us = now_us - phase_start_us;
+    if (!found) return fail(now_us, false);
+
+    state = State::Associating;
+    phase_start_us = now_us;
+    return Command::Connect;
+}
+
+WiFiReconnect::Command WiFiReconnect::onAssociated(int64_t now_us)
+{
+    if (state != State::Associating)
+    {
+        stats.ignored_events++;
+        return Command::None;
+    }
+
+    assoc_us = now_us - phase_start_us;
+    state = State::ObtainingIP;
+    phase_start_us = now_us;
+    return Command::None;
+}
+
+WiFiReconnect::Command WiFiReconnect::onGotIP(int64_t now_us)
+{
+    if (state != State::ObtainingIP)
+    {
+        stats.ignored_events++;
+        return Command::None;
+    }
+
+    timings = {
+        static_cast<uint32_t>(scan_us / 1000),
+        static_cast<uint32_t>(assoc_us / 1000),
+        static_cast<uint32_t>((now_us - phase_start_us) / 1000),
+        static_cast<uint32_t>((now_us - first_attempt_us) / 1000),
+        fast,
+    };
+    state = State::Connected;
+    connected_at_us = now_us;
+    failures = 0;
+    fast_failures = 0;
+    has_cache = true;
+    stats.connections++;
+    return Command::None;
+}
+
+WiFiReconnect::Command WiFiReconnect::onDisconnected(int64_t now_us)
+{
+    switch (state)
+    {
+        case State::Connected:
+            stats.link_losses++;
+            first_attempt_us = now_us;
+            fast = false; // the cached access point did work
+            if (now_us - connected_at_us < policy.stable_link_us) return fail(now_us, false);
+            return attempt(now_us); // a lost link that worked : back on the cached access point right away
+        case State::Associating:
+        case State::ObtainingIP:
+            return fail(now_us, false);
+        default:
+            // the end of an aborted attempt, or a storm while waiting / scanning
+            stats.ignored_events++;
+            return Command::None;
+    }
+}
+
+WiFiReconnect::Command WiFiReconnect::poll(int64_t now_us)
+{
+    switch (state)
+    {
+        case State::Waiting:
+            if (now_us >= retry_at_us) return attempt(now_us);
+            return Command::None;
+        case State::Scanning:
+        case State::Associating:
+        case State::ObtainingIP:
+            if (now_us - phase_start_us >= policy.phase_timeout_us) return fail(now_us, true);
+            return Command::None;
+        default:
+            return Command::None;
+    }
+}
+
+int64_t WiFiReconnect::deadline() const
+{
+    switch (state)
+    {
+        case State::Waiting:
+            return retry_at_us;
+        case State::Scanning:
+        case State::Associating:
+        case State::ObtainingIP:
+            return phase_start_us + policy.phase_timeout_us;
+        default:
+            return NO_DEADLINE;
+    }
+}
+
+int64_t WiFiReconnect::backoffDelay(uint8_t failure_count) const
+{
+    if (failure_count == 0) return 0;
+    int64_t delay_us = policy.backoff_base_us << std::min<uint8_t>(failure_count - 1, 30);
+    return std::min(delay_us, policy.backoff_max_us);
+}
+
+WiFiReconnect::Command WiFiReconnect::attempt(int64_t now_us)
+{
+    stats.attempts++;
+    phase_start_us = now_us;
+    scan_us = 0;
+    assoc_us = 0;
+
+    if (has_cache && fast_failures < policy.fast_attempts)
+    {
+        fast = true;
+        stats.fast_attempts++;
+        state = State::Associating;
+        return Command::ConnectCached;
+    }
+
+    fast = false;
+    state = State::Scanning;
+    if (has_cache)
+    {
+        has_cache = false;
+        return Command::DropCache;
+    }
+    return Command::Scan;
+}
+
+WiFiReconnect::Command WiFiReconnect::fail(int64_t now_us, bool abort)
+{
+    if (fast) fast_failures++;
+    if (++failures > policy.max_retries)
+    {
+        state = State::GaveUp;
+        return Command::GiveUp;
+    }
+
+    state = State::Waiting;
+    if (fast && fast_failures >= policy.fast_attempts)
+    {
+        // the access point may have moved : scan right away rather than waiting to try the cache again
+        retry_at_us = now_us;
+        return abort ? Command::Disconnect : attempt(now_us);
+    }
+
+    int64_t delay_us = backoffDelay(failures);
+    int64_t jitter_us = static_cast<int64_t>(delay_us * policy.jitter * (next_random() / 4294967296.0));
+    retry_at_us = now_us + delay_us - jitter_us;
+    return abort ? Command::Disconnect : Command::None;
+}
+
+uint32_t WiFiReconnect::next_random()
+{
+    // xorshift32, only spreads the retries
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
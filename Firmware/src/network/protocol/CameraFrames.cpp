@@ -0,0 +1,63 @@
+#include "network/protocol/CameraFrames.hpp"
+#include <algorithm>
+#include <cstring>
+
+constexpr int64_t TICK_PERIOD_US = static_cast<int64_t>(CONTROL_LOOP_DT_S * 1e6f);
+
+uint16_t Protocol::CameraFrames::ChunkSize(uint16_t asked)
+{
+    if (asked == 0) return CAMERA_CHUNK_SIZE;
+    return std::clamp(asked, CAMERA_CHUNK_MIN_SIZE, CAMERA_CHUNK_MAX_SIZE);
+}
+
+uint32_t Protocol::CameraFrames::NearestTick(uint32_t tick, int64_t tick_us, int64_t time_us)
+{
+    // rounded to the nearest tick, on both sides (frames are usually older than the last tick)
+    int64_t delta = time_us - tick_us;
+    int64_t ticks = (delta >= 0 ? delta + TICK_PERIOD_US / 2 : delta - TICK_PERIOD_US / 2) / TICK_PERIOD_US;
+    return static_cast<uint32_t>(std::max<int64_t>(0, tick + ticks));
+}
+
+size_t Protocol::CameraFrames::WriteChunk(const CameraStream::Frame& frame, uint32_t tick, uint32_t offset, uint16_t chunk_size, uint8_t* out)
+{
+    if (offset >= frame.size) return 0;
+    uint16_t size = static_cast<uint16_t>(std::min<size_t>(chunk_size, frame.size - offset));
+
+    MessageHeader header = {
+        .type = MessageType::Event,
+        .flags = MessageFlag::None,
+        .msg_id = 0,
+        .event_id = EVENT_FRAME_CHUNK,
+        .length = static_cast<uint16_t>(sizeof(ChunkHeader) + size),
+    };
+    ChunkHeader chunk = {
+        .sequence = frame.sequence,
+        .frame_size = static_cast<uint32_t>(frame.size),
+        .offset = offset,
+        .timestamp_us = frame.timestamp_us,
+        .tick = tick,
+        .width = frame.width,
+        .height = frame.height,
+    };
+    memcpy(out, &header, sizeof(header));
+    memcpy(out + sizeof(header), &chunk, sizeof(chunk));
+    memcpy(out + sizeof(header) + sizeof(chunk), frame.data + offset, size);
+    return sizeof(header) + sizeof(chunk) + size;
+}
+
+Status Protocol::CameraFrames::Serve(CameraStream& stream, int client, uint16_t chunk_size, uint8_t* buffer, const TickSource& ticks, const Send& send)
+{
+    return stream.serveFrames(client, [&](const CameraStream::Frame& frame) {
+        uint32_t tick = 0;
+        int64_t tick_us = 0;
+        ticks(tick, tick_us);
+        tick = tick_us > 0 ? NearestTick(tick, tick_us, frame.timestamp_us) : 0;
+
+        for (uint32_t offset = 0; offset < frame.size; offset += chunk_size)
+        {
+            size_t size = WriteChunk(frame, tick, offset, chunk_size, buffer);
+            if (!send(buffer, size)) return false;
+        }
+        return true;
+    });
+}
@@ -15,6 +15,8 @@
 #include "network/protocol/modules/wifi.hpp"
 #include "network/protocol/modules/error.hpp"
 #include "network/protocol/modules/diagnostic.hpp"
+#include "network/protocol/modules/record.hpp"
+#include "network/protocol/modules/camera.hpp"
 
 namespace Protocol
 {
@@ -37,6 +39,8 @@ Status Protocol::Init()
     WiFi::Register(dispatcher);
     Error::Register(dispatcher);
     Diagnostic::Register(dispatcher);
+    Record::Register(dispatcher);
+    Camera::Register(dispatcher);
     // ErrorHandle(ErrorStruct::ProtocolInitFailed);
     return Status::Ok;
 }
@@ -50,51 +54,3 @@ Protocol::Dispatcher& Protocol::GetDispatcher()
 {
     return dispatcher;
 }
-
-
-void Protocol::Dispatcher::registerModule(uint8_t module_id, ActionCallback* actions, uint8_t nb_actions) {
-    this->modules[module_id].actions = actions;
-    this->modules[module_id].nb_actions = nb_actions;
-}
-
-void Protocol::Dispatcher::handlePacket(ITransport* transport, void* context, const uint8_t* buffer, size_t len) {
-    if (len < sizeof(MessageHeader))
-    {
-        LOG_DEBUG(TAG, "Packet is too small (%u < %d)", len, sizeof(MessageHeader));
-        return;
-    }
-
-    const MessageHeader* header = reinterpret_cast<const MessageHeader*>(buffer);
-    
-    if (header->type != MessageType::Request)
-    {
-        LOG_DEBUG(TAG, "Packet isn't of type request (%u != 1)", header->type);
-        return;
-    }
-
-    RequestContext ctx = {
-        .transport = transport,
-        .transport_context = context,
-        .msg_id = header->msg_id,
-        .expected_len = header->length
-    };
-    
-    uint8_t module_id = header->cmd_id & 0xFF;
-    uint8_t action_id = (header->cmd_id >> 8) & 0xFF;
-
-    Module& mod = modules[module_id];
-    if (mod.actions == nullptr) {
-        LOG_DEBUG(TAG, "Module %u not found", module_id);
-        ctx.respond(ResponseStatus::UnknownModule);
-        return; 
-    }
-
-    if (action_id >= mod.nb_actions || mod.actions[action_id] == nullptr) {
-        LOG_DEBUG(TAG, "Action %u not found in module %u", action_id, module_id);
-        ctx.respond(ResponseStatus::UnknownAction);
-        return;
-    }
-    const uint8_t* payload = buffer + sizeof(MessageHeader);
-
-    mod.actions[action_id](ctx, payload);
-}
\ No newline at end of file
@@ -0,0 +1,242 @@
+#include "ui/AnimationCodec.hpp"
+#include "common/Log.hpp"
+#include "esp_heap_caps.h"
+#include <cstring>
+
+namespace AnimationCodec
+{
+    constexpr uint8_t MAGIC[4] = { 'T', 'N', 'Y', 'A' };
+    constexpr uint8_t MAX_LITERAL = 0x80;
+    constexpr uint8_t MIN_RUN = 2;
+    constexpr uint8_t MAX_RUN = 0x7F + MIN_RUN;
+
+    static uint32_t read_u32(const uint8_t* ptr)
+    {
+        return ptr[0] | (ptr[1] << 8) | (ptr[2] << 16) | (static_cast<uint32_t>(ptr[3]) << 24);
+    }
+
+    static void write_u32(uint8_t* ptr, uint32_t value)
+    {
+        ptr[0] = value;
+        ptr[1] = value >> 8;
+        ptr[2] = value >> 16;
+        ptr[3] = value >> 24;
+    }
+
+    /**
+     * @brief Decode the runs of a frame into `out` (written, or XORed for a delta frame).
+     * @return Status::InvalidParameters if the runs go past the data or the frame.
+     */
+    static Status decode_runs(const uint8_t* src, const uint8_t* src_end, uint8_t* out, size_t out_size, bool delta)
+    {
+        size_t pos = 0;
+        while (pos < out_size)
+        {
+            if (src >= src_end) return Status::InvalidParameters;
+            uint8_t control = *src++;
+            if (control < MAX_LITERAL)
+            {
+                size_t count = control + 1;
+                if (pos + count > out_size || src + count > src_end) return Status::InvalidParameters;
+                if (delta)
+                {
+                    for (size_t i = 0; i < count; i++) out[pos + i] ^= src[i];
+                }
+                else
+                {
+                    memcpy(out + pos, src, count);
+                }
+                src += count;
+                pos += count;
+            }
+            else
+            {
+                size_t count = control - MAX_LITERAL + MIN_RUN;
+                if (pos + count > out_size || src >= src_end) return Status::InvalidParameters;
+                uint8_t value = *src++;
+                if (!delta) memset(out + pos, value, count);
+                else if (value != 0)
+                {
+                    for (size_t i = 0; i < count; i++) out[pos + i] ^= value;
+                }
+                pos += count;
+            }
+        }
+        return Status::Ok;
+    }
+
+    static void encode_runs(const uint8_t* data, size_t size, std::vector<uint8_t>& out)
+    {
+        size_t literal_start = 0;
+        size_t literal_count = 0;
+        auto flush_literal = [&]() {
+            if (literal_count == 0) return;
+            out.push_back(literal_count - 1);
+            out.insert(out.end(), data + literal_start, data + literal_start + literal_count);
+            literal_count = 0;
+        };
+
+        size_t i = 0;
+        while (i < size)
+        {
+            size_t run = 1;
+            while (i + run < size && run < MAX_RUN && data[i + run] == data[i]) run++;
+
+            // two equal bytes cost the same as a run or as literals, keep them in the literal being built
+            if (run > MIN_RUN || (run == MIN_RUN && literal_count == 0))
+            {
+                flush_literal();
+                out.push_back(MAX_LITERAL + run - MIN_RUN);
+                out.push_back(data[i]);
+                i += run;
+                continue;
+            }
+            if (literal_count == 0) literal_start = i;
+            literal_count++;
+            i++;
+            if (literal_count == MAX_LITERAL) flush_literal();
+        }
+        flush_literal();
+    }
+
+    Status ParseHeader(const uint8_t* data, size_t size, Header& header)
+    {
+        if (data == nullptr || size < HEADER_SIZE || memcmp(data, MAGIC, sizeof(MAGIC)) != 0 || data[4] != VERSION)
+        {
+            return Status::InvalidParameters;
+        }
+        header.width = data[5];
+        header.height = data[6];
+        header.frame_count = data[7];
+        if (header.width == 0 || header.height == 0 || header.frame_count == 0 || size < HEADER_SIZE + 4 * header.frame_count)
+        {
+            return Status::InvalidParameters;
+        }
+        for (uint8_t i = 0; i < header.frame_count; i++)
+        {
+            if (read_u32(data + HEADER_SIZE + 4 * i) >= size) return Status::InvalidParameters;
+        }
+        if (data[read_u32(data + HEADER_SIZE)] != FRAME_KEY) return Status::InvalidParameters; // starts somewhere
+        return Status::Ok;
+    }
+
+    Status Encode(const uint8_t* frames, uint8_t width, uint8_t height, uint8_t frame_count, uint8_t keyframe_interval,
+                  std::vector<uint8_t>& out)
+    {
+        if (frames == nullptr || width == 0 || height == 0 || frame_count == 0) return Status::InvalidParameters;
+
+        const size_t frame_size = FrameSize(width, height);
+        out.assign(HEADER_SIZE + 4 * frame_count, 0);
+        memcpy(out.data(), MAGIC, sizeof(MAGIC));
+        out[4] = VERSION;
+        out[5] = width;
+        out[6] = height;
+        out[7] = frame_count;
+
+        std::vector<uint8_t> delta(frame_size);
+        std::vector<uint8_t> key_runs, delta_runs;
+        uint16_t since_key = 0;
+        for (uint8_t i = 0; i < frame_count; i++)
+        {
+            const uint8_t* current = frames + i * frame_size;
+            key_runs.clear();
+            encode_runs(current, frame_size, key_runs);
+
+            bool key = i == 0 || (keyframe_interval != 0 && since_key + 1 >= keyframe_interval);
+            if (!key)
+            {
+                const uint8_t* previous = current - frame_size;
+                for (size_t j = 0; j < frame_size; j++) delta[j] = current[j] ^ previous[j];
+                delta_runs.clear();
+                encode_runs(delta.data(), frame_size, delta_runs);
+                key = key_runs.size() <= delta_runs.size();
+            }
+
+            write_u32(&out[HEADER_SIZE + 4 * i], out.size());
+            out.push_back(key ? FRAME_KEY : FRAME_DELTA);
+            const std::vector<uint8_t>& runs = key ? key_runs : delta_runs;
+            out.insert(out.end(), runs.begin(), runs.end());
+            since_key = key ? 0 : since_key + 1;
+        }
+        return Status::Ok;
+    }
+
+    void RowsToPages(const uint8_t* rows, uint8_t width, uint8_t height, uint8_t* pages)
+    {
+        memset(pages, 0, FrameSize(width, height));
+        for (uint16_t y = 0; y < height; y++)
+        {
+            for (uint16_t x = 0; x < width; x++)
+            {
+                uint32_t bit = y * width + x;
+                if (rows[bit / 8] & (0x80 >> (bit % 8)))
+                {
+                    pages[(y / 8) * width + x] |= 1 << (y % 8);
+                }
+            }
+        }
+    }
+
+    Status Decoder::open(const uint8_t* data, size_t size)
+    {
+        close();
+        if (Status err = ParseHeader(data, size, header); err != Status::Ok)
+        {
+            LOG_ERROR(TAG, "Invalid animation data");
+            return err;
+        }
+
+        frame = static_cast<uint8_t*>(heap_caps_malloc(FrameSize(header.width, header.height), MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL));
+        if (frame == nullptr)
+        {
+            return Status::NoMemory;
+        }
+        this->data = data;
+        this->size = size;
+        index = -1;
+        return Status::Ok;
+    }
+
+    void Decoder::close()
+    {
+        heap_caps_free(frame);
+        frame = nullptr;
+        data = nullptr;
+        index = -1;
+    }
+
+    Status Decoder::seek(uint8_t target)
+    {
+        if (frame == nullptr || target >= header.frame_count) return Status::InvalidParameters;
+        if (target == index) return Status::Ok;
+
+        // next frame : apply it to the current one, otherwise start again from the last key frame before the target
+        uint8_t from = target;
+        if (target != index + 1)
+        {
+            while (from > 0 && data[read_u32(data + HEADER_SIZE + 4 * from)] != FRAME_KEY) from--;
+        }
+        for (uint8_t i = from; i <= target; i++)
+        {
+            if (Status err = apply(i); err != Status::Ok)
+            {
+                memset(frame, 0, FrameSize(header.width, header.height));
+                index = -1;
+                return err;
+            }
+        }
+        index = target;
+        return Status::Ok;
+    }
+
+    Status Decoder::apply(uint8_t frame_index)
+    {
+        uint32_t offset = read_u32(data + HEADER_SIZE + 4 * frame_index);
+        uint32_t end = frame_index + 1 < header.frame_count ? read_u32(data + HEADER_SIZE + 4 * (frame_index + 1)) : size;
+        if (end <= offset || end > size) return Status::InvalidParameters;
+
+        uint8_t type = data[offset];
+        if (type != FRAME_KEY && type != FRAME_DELTA) return Status::InvalidParameters;
+        return decode_runs(data + offset + 1, data + end, frame, FrameSize(header.width, header.height), type == FRAME_DELTA);
+    }
+}
@@ -1,71 +1,71 @@
 #include "ui/Button.hpp"
 #include "common/Log.hpp"
-#include <freertos/FreeRTOS.h>
+#include "common/SpscQueue.hpp"
+#include "common/config.hpp"
 #include <driver/gpio.h>
+#include <esp_timer.h>
+#include <algorithm>
+#include <atomic>
 
 namespace Button
 {
-    bool btn_states[2] = {false, false};
-    bool long_pressed[2] = {0, 0};
-    TickType_t last_press[2] = {0, 0};
+    /// @brief A pin edge, as seen by the interrupt
+    struct Edge
+    {
+        uint8_t button;
+        bool level;
+        int64_t time_us;
+    };
+
+    const gpio_num_t pins[COUNT] = { BTN_LEFT_PIN, BTN_RIGHT_PIN };
 
-    CallbackSet callbacks = { {nullptr, nullptr}, {nullptr, nullptr}, {nullptr, nullptr} };
+    SpscQueue<Edge, BTN_EDGE_QUEUE_SIZE> edges;         // interrupt -> Process()
+    SpscQueue<InputEvent, BTN_EVENT_QUEUE_SIZE> events; // Process() -> PopEvent()
+    ButtonDebouncer debouncers[COUNT];
+    TaskHandle_t wake_task = nullptr;
+    std::atomic<bool> armed[COUNT] = { true, true }; // the next edge wakes the task (not while bouncing)
+    uint32_t edge_count = 0;
+    uint32_t event_count = 0;
 
     bool initialized = false;
 
-    void update_task(void* pvParams)
+    /// @brief Runs in the GPIO ISR service (not IRAM-safe, so flash code is fine here)
+    static void on_edge(void* arg)
     {
-        while (true)
-        {
-            bool btn_states_now[2] = {
-                (bool) gpio_get_level(BTN_LEFT_PIN),
-                (bool) gpio_get_level(BTN_RIGHT_PIN),
-            };
-            
-            for (int i = 0; i < 2; i++)
-            {
-                if (btn_states_now[i] && !btn_states[i])
-                {
-                    last_press[i] = xTaskGetTickCount();
-                    if (callbacks.onPressed[i]) callbacks.onPressed[i]();
-                }
-                else if (!btn_states_now[i] && btn_states[i])
-                {
-                    if (callbacks.onReleased[i]) callbacks.onReleased[i]();
-                    long_pressed[i] = false;
-                }
-                else
-                {
-                    int32_t press_duration = xTaskGetTickCount() - (int32_t)last_press[i]; // casting to int32_t to avoid overflow
-                    if (btn_states[i] && press_duration > pdMS_TO_TICKS(BTN_LONG_PRESS_MS) && !long_pressed[i])
-                    {
-                        if (callbacks.onLongPressed[i]) callbacks.onLongPressed[i]();
-                        long_pressed[i] = true;
-                    }
-                }
-            }
+        uint8_t button = static_cast<uint8_t>(reinterpret_cast<uintptr_t>(arg));
+        edges.push({ button, gpio_get_level(pins[button]) != 0, esp_timer_get_time() });
+        edge_count++;
 
-            for (int i = 0; i < 2; i++)
-            {
-                btn_states[i] = btn_states_now[i];
-                long_pressed[i] &= btn_states[i];
-            }
+        // the bounces after the first edge only delay the debounce deadline the task already sleeps until
+        if (!armed[button].exchange(false)) return;
+        BaseType_t high_task_awoken = pdFALSE;
+        vTaskNotifyGiveFromISR(wake_task, &high_task_awoken);
+        portYIELD_FROM_ISR(high_task_awoken);
+    }
 
-            vTaskDelay(pdMS_TO_TICKS(BTN_POLL_INT_MS));
+    static void queue_events(uint8_t button, int64_t now_us)
+    {
+        ButtonDebouncer::Output output;
+        while (debouncers[button].poll(now_us, output))
+        {
+            events.push({ button, output.event, output.time_us });
+            event_count++;
         }
     }
 
-    Status Init()
+    Status Init(TaskHandle_t task)
     {
         if (initialized) return Status::Ok;
+        if (task == nullptr) return Status::InvalidParameters;
+        wake_task = task;
 
         gpio_config_t io_conf;
-        io_conf.intr_type = GPIO_INTR_DISABLE;
+        io_conf.intr_type = GPIO_INTR_ANYEDGE;
         io_conf.mode = GPIO_MODE_INPUT;
         io_conf.pin_bit_mask = (1ULL << BTN_LEFT_PIN) | (1ULL << BTN_RIGHT_PIN);
         io_conf.pull_down_en = GPIO_PULLDOWN_DISABLE; // should have external pull-down
         io_conf.pull_up_en = GPIO_PULLUP_DISABLE;
-        
+
         if (gpio_config(&io_conf) != ESP_OK)
         {
             LOG_ERROR(TAG, "Buttons: Failed to configure GPIO pins");
@@ -73,21 +73,71 @@ namespace Button
             return Status::Unknown;
         }
 
-        if (xTaskCreatePinnedToCore(update_task, "Buttons::update_task", 8192, nullptr, tskIDLE_PRIORITY + 1, nullptr, CORE_BRAIN) != pdPASS)
+        int64_t now_us = esp_timer_get_time();
+        for (uint8_t i = 0; i < COUNT; i++)
         {
-            LOG_ERROR(TAG, "Buttons: Failed to create Buttons update task");
-            // ErrorHandle(ErrorStruct::ButtonsInitFailed);
+            debouncers[i].reset(gpio_get_level(pins[i]) != 0, now_us);
+        }
+
+        // the service may already be installed by another driver
+        if (esp_err_t err = gpio_install_isr_service(0); err != ESP_OK && err != ESP_ERR_INVALID_STATE)
+        {
+            LOG_ERROR(TAG, "Buttons: Failed to install the GPIO ISR service : 0x%0X", err);
             return Status::Unknown;
         }
 
+        for (uint8_t i = 0; i < COUNT; i++)
+        {
+            if (gpio_isr_handler_add(pins[i], on_edge, reinterpret_cast<void*>(static_cast<uintptr_t>(i))) != ESP_OK)
+            {
+                LOG_ERROR(TAG, "Buttons: Failed to add the interrupt handler of GPIO %d", pins[i]);
+                return Status::Unknown;
+            }
+        }
+
         initialized = true;
 
         return Status::Ok;
     }
 
-    Status SetCallbacks(const CallbackSet& cb)
+    int64_t Process(int64_t now_us)
     {
-        callbacks = cb;
-        return Status::Ok;
+        Edge edge;
+        while (edges.pop(edge))
+        {
+            // events due before the edge come first
+            queue_events(edge.button, edge.time_us);
+            debouncers[edge.button].edge(edge.level, edge.time_us);
+        }
+
+        int64_t deadline = ButtonDebouncer::NO_DEADLINE;
+        bool rearmed = false;
+        for (uint8_t i = 0; i < COUNT; i++)
+        {
+            // catch up on an edge the interrupt read too late (a bounce faster than the ISR latency)
+            if (debouncers[i].deadline() <= now_us)
+            {
+                bool level = gpio_get_level(pins[i]) != 0;
+                if (level != debouncers[i].getLevel()) debouncers[i].edge(level, now_us);
+            }
+
+            queue_events(i, now_us);
+            deadline = std::min(deadline, debouncers[i].deadline());
+            if (!debouncers[i].isBouncing() && !armed[i].exchange(true)) rearmed = true;
+        }
+
+        // an edge queued while disarmed, after the queue was drained : no notification came for it
+        if (rearmed && !edges.empty()) return now_us;
+        return deadline;
+    }
+
+    bool PopEvent(InputEvent& event)
+    {
+        return events.pop(event);
+    }
+
+    Stats GetStats()
+    {
+        return { edge_count, edges.dropped(), event_count, events.dropped() };
     }
-}
\ No newline at end of file
+}
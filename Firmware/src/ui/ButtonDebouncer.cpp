@@ -0,0 +1,142 @@
+#include "ui/ButtonDebouncer.hpp"
+#include <algorithm>
+
+ButtonDebouncer::ButtonDebouncer(const Timing& timing)
+    : timing(timing)
+{
+}
+
+void ButtonDebouncer::reset(bool level, int64_t time_us)
+{
+    stable_level = level;
+    raw_level = level;
+    last_edge_us = time_us;
+    bouncing = false;
+    bounce_start_us = time_us;
+    pressed_us = time_us;
+    next_hold_us = time_us;
+    long_pressed = false;
+    ignored = level;
+    last_click_us = NO_TIME;
+    pending_count = 0;
+    pending_read = 0;
+}
+
+void ButtonDebouncer::edge(bool level, int64_t time_us)
+{
+    // the first edge away from the kept level dates the event, the ones after it only delay the settling
+    if (!bouncing && level != stable_level)
+    {
+        bouncing = true;
+        bounce_start_us = time_us;
+    }
+    raw_level = level;
+    last_edge_us = time_us;
+}
+
+bool ButtonDebouncer::poll(int64_t now_us, Output& output)
+{
+    if (pending_read < pending_count)
+    {
+        output = pending[pending_read++];
+        return true;
+    }
+    pending_count = 0;
+    pending_read = 0;
+
+    int64_t settle_at = settle_time();
+    int64_t hold_at = hold_time();
+    if (hold_at <= settle_at)
+    {
+        if (hold_at > now_us) return false;
+
+        output = { long_pressed ? Event::Repeat : Event::LongPressed, hold_at };
+        long_pressed = true;
+        next_hold_us = hold_at + timing.repeat_us;
+        return true;
+    }
+    if (settle_at > now_us) return false;
+
+    settle();
+    if (pending_count == 0) return poll(now_us, output); // glitch, or end of an ignored press
+    output = pending[pending_read++];
+    return true;
+}
+
+int64_t ButtonDebouncer::deadline() const
+{
+    if (pending_read < pending_count) return pending[pending_read].time_us;
+    return std::min(settle_time(), hold_time());
+}
+
+bool ButtonDebouncer::isPressed() const
+{
+    return stable_level && !ignored;
+}
+
+bool ButtonDebouncer::getLevel() const
+{
+    return raw_level;
+}
+
+bool ButtonDebouncer::isBouncing() const
+{
+    return bouncing;
+}
+
+int64_t ButtonDebouncer::settle_time() const
+{
+    if (!bouncing) return NO_DEADLINE;
+    return last_edge_us + timing.debounce_us;
+}
+
+int64_t ButtonDebouncer::hold_time() const
+{
+    if (!stable_level || ignored) return NO_DEADLINE;
+    if (long_pressed && timing.repeat_us == 0) return NO_DEADLINE;
+    // a release started before the hold cancels it (unless it turns out to be a glitch)
+    if (bouncing && bounce_start_us <= next_hold_us) return NO_DEADLINE;
+    return next_hold_us;
+}
+
+void ButtonDebouncer::settle()
+{
+    bouncing = false;
+    if (raw_level == stable_level) return;
+    stable_level = raw_level;
+    int64_t time_us = bounce_start_us;
+
+    if (ignored)
+    {
+        ignored = stable_level;
+        return;
+    }
+
+    if (stable_level)
+    {
+        pressed_us = time_us;
+        next_hold_us = time_us + timing.long_press_us;
+        long_pressed = false;
+        pending[pending_count++] = { Event::Pressed, time_us };
+        return;
+    }
+
+    pending[pending_count++] = { Event::Released, time_us };
+    if (long_pressed)
+    {
+        last_click_us = NO_TIME;
+        long_pressed = false;
+        return;
+    }
+
+    pending[pending_count++] = { Event::Clicked, time_us };
+    if (timing.double_click_us != 0 && last_click_us != NO_TIME && pressed_us - last_click_us <= timing.double_click_us)
+    {
+        pending[pending_count++] = { Event::DoubleClicked, time_us };
+        last_click_us = NO_TIME; // a third click starts a new pair
+    }
+    else
+    {
+        last_click_us = time_us;
+    }
+}
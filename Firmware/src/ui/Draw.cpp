@@ -1,18 +1,24 @@
 #include "ui/Draw.hpp"
 #include "ui/font8x8_basic.h"
 
-char (*screen_font)[8] = font8x8_basic;
+const char (*screen_font)[8] = font8x8_basic;
 
 namespace Draw
 {
-    uint16_t GetTextWidth(const char* text)
+    static TextCache text_cache;
+
+    TextCache& GetTextCache()
     {
+        return text_cache;
+    }
+
+    uint16_t GetTextWidth(const char* text, const Font& font)
+    {
+        if (*text == '\0') return 0;
+        if (font.fixed_width != 0) return strlen(text) * (font.fixed_width + font.spacing) - font.spacing;
+
         uint16_t width = 0;
-        while (*text)
-        {
-            width += 8;
-            text++;
-        }
-        return width;
+        for (; *text; text++) width += font.advance(*text);
+        return width - font.spacing;
     }
 }
@@ -0,0 +1,189 @@
+#include "ui/FaceEyes.hpp"
+#include "ui/Draw.hpp"
+#include "common/config.hpp"
+#include "common/Log.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace FaceEyes
+{
+    constexpr const char* TAG = "FaceEyes";
+
+    constexpr uint8_t EYES_SIZE = 30;
+    constexpr uint16_t EYES_RADIUS = 7;
+    constexpr float LID_MIN = 0.001f; // lids below this ratio aren't drawn
+
+    constexpr uint8_t LID_IN = 0;
+    constexpr uint8_t LID_OUT = 1;
+    constexpr uint8_t LID_BOTTOM = 2;
+    constexpr uint8_t LID_COUNT = 3;
+
+    /**
+     * Eye in screen pixels : rounded rectangle and the three corners of each drawn lid
+     */
+    struct EyeShape
+    {
+        int16_t x;
+        int16_t y;
+        uint16_t width;
+        uint16_t height;
+        uint8_t lids; // bit per drawn lid
+        int16_t lid_points[LID_COUNT][6];
+    };
+
+    /**
+     * Cache key of an eye : its shape relative to the rectangle corner (where it's drawn doesn't matter)
+     */
+    struct EyeKey
+    {
+        uint8_t width;
+        uint8_t height;
+        uint8_t lids;
+        int8_t lid_points[LID_COUNT][6];
+    };
+
+    static SpriteCache cache;
+    static bool cache_enabled = true;
+
+    /**
+     * @brief Eye geometry, with the pixel coordinates rounded exactly like the primitives are fed when drawing directly.
+     * @param left Left eye (mirrored lids, opposite skew).
+     */
+    static EyeShape compute_eye(const FaceEyesInfo& eyes_info, bool left)
+    {
+        const uint16_t width = ScreenDriver::info.width;
+        const uint16_t height = ScreenDriver::info.height;
+
+        uint8_t size = EYES_SIZE * eyes_info.size;
+        float look_x = left ? eyes_info.look_x * 2 - eyes_info.look_x * eyes_info.look_x
+                            : -(-eyes_info.look_x * 2 - eyes_info.look_x * eyes_info.look_x);
+        float open = left ? eyes_info.open_left : eyes_info.open_right;
+        float skew = left ? eyes_info.skew * 5.0f : -(eyes_info.skew * 5.0f);
+
+        float center_x = (left ? width * 3 / 4 : width / 4) + look_x * 10.0f;
+        float center_y = height / 2 + eyes_info.look_y * 10.0f;
+        float x_min = center_x - size / 2;
+        float x_max = center_x + size / 2;
+        float top = center_y - (size * open) / 2 + skew;
+        float bottom = center_y + (size * open) / 2 + skew;
+
+        EyeShape shape = {};
+        shape.x = x_min;
+        shape.y = top;
+        shape.width = size;
+        shape.height = size * open;
+
+        float lid_in = left ? eyes_info.lid_in_left : eyes_info.lid_in_right;
+        float lid_out = left ? eyes_info.lid_out_left : eyes_info.lid_out_right;
+        float lid_bottom = left ? eyes_info.lid_bottom_left : eyes_info.lid_bottom_right;
+        auto set_lid = [&shape](uint8_t lid, float x0, float y0, float x1, float y1, float x2, float y2) {
+            shape.lids |= 1 << lid;
+            int16_t* p = shape.lid_points[lid];
+            p[0] = x0; p[1] = y0; p[2] = x1; p[3] = y1; p[4] = x2; p[5] = y2;
+        };
+        if (lid_in > LID_MIN)
+        {
+            set_lid(LID_IN, x_min, top, x_max, top, left ? x_min : x_max, top + lid_in * size * open);
+        }
+        if (lid_out > LID_MIN)
+        {
+            if (left) set_lid(LID_OUT, x_min, top, x_max, top + lid_out * size * open, x_max, top);
+            else set_lid(LID_OUT, x_min, top, x_min, top + lid_out * size * open, x_max, top);
+        }
+        if (lid_bottom > LID_MIN)
+        {
+            set_lid(LID_BOTTOM, x_max, bottom, x_min, bottom, center_x, bottom - lid_bottom * size * open);
+        }
+        return shape;
+    }
+
+    /**
+     * @brief Draw an eye with the primitives, shifted by (dx, dy).
+     * @param coverage Draw the lids in white too (mask of the painted pixels).
+     */
+    static void draw_eye(const EyeShape& shape, int16_t dx, int16_t dy, bool coverage = false)
+    {
+        Draw::RectRounded(shape.x + dx, shape.y + dy, shape.width, shape.height, EYES_RADIUS, ScreenDriver::COLOR_WHITE);
+        for (uint8_t lid = 0; lid < LID_COUNT; lid++)
+        {
+            if ((shape.lids & (1 << lid)) == 0) continue;
+            const int16_t* p = shape.lid_points[lid];
+            Draw::TriangleFilled(p[0] + dx, p[1] + dy, p[2] + dx, p[3] + dy, p[4] + dx, p[5] + dy,
+                                 coverage ? ScreenDriver::COLOR_WHITE : ScreenDriver::COLOR_BLACK);
+        }
+    }
+
+    /**
+     * @brief Draw an eye from its cached sprite (rasterized first if missing).
+     * @return false if the eye can't be cached (the caller draws it directly).
+     */
+    static bool draw_eye_cached(const EyeShape& shape)
+    {
+        if (shape.width > 0xFF || shape.height > 0xFF) return false;
+
+        EyeKey key;
+        memset(&key, 0, sizeof(key)); // padding is part of the key
+        key.width = shape.width;
+        key.height = shape.height;
+        key.lids = shape.lids;
+
+        // sprite bounds, relative to the rectangle corner : the lids can stick out of the rectangle by a pixel
+        int16_t min_x = 0, min_y = 0;
+        int16_t max_x = shape.width - 1, max_y = shape.height - 1;
+        for (uint8_t lid = 0; lid < LID_COUNT; lid++)
+        {
+            if ((shape.lids & (1 << lid)) == 0) continue;
+            for (uint8_t i = 0; i < 6; i++)
+            {
+                int16_t point = shape.lid_points[lid][i] - (i % 2 == 0 ? shape.x : shape.y);
+                if (point < INT8_MIN || point > INT8_MAX) return false;
+                key.lid_points[lid][i] = point;
+                if (i % 2 == 0) { min_x = std::min(min_x, point); max_x = std::max(max_x, point); }
+                else { min_y = std::min(min_y, point); max_y = std::max(max_y, point); }
+            }
+        }
+        if (max_x < min_x || max_y < min_y) return true; // closed eye without lids, nothing to draw
+
+        const SpriteCache::Sprite* sprite = cache.get(&key, sizeof(key), max_x - min_x + 1, max_y - min_y + 1, [&](bool coverage) {
+            draw_eye(shape, -shape.x - min_x, -shape.y - min_y, coverage);
+        });
+        if (sprite == nullptr) return false;
+
+        Draw::BlitMasked<true>(shape.x + min_x, shape.y + min_y, sprite->width, sprite->height, sprite->value, sprite->mask);
+        return true;
+    }
+
+    void Render(const FaceEyesInfo& eyes_info)
+    {
+        if (cache_enabled && !cache.isInitialized() && cache.init(FACE_SPRITE_CACHE_SIZE, FACE_SPRITE_CACHE_ENTRIES) != Status::Ok)
+        {
+            LOG_WARNING(TAG, "Failed to allocate the sprite cache, drawing the eyes directly");
+            cache_enabled = false;
+        }
+
+        for (bool left : { false, true }) // right eye first, as the menu always did (matters if both eyes overlap)
+        {
+            EyeShape shape = compute_eye(eyes_info, left);
+            if (!cache_enabled || !draw_eye_cached(shape))
+            {
+                draw_eye(shape, 0, 0);
+            }
+        }
+    }
+
+    void SetCacheEnabled(bool enabled)
+    {
+        cache_enabled = enabled;
+        if (!enabled) cache.deinit();
+    }
+
+    SpriteCache::Stats GetCacheStats()
+    {
+        return cache.getStats();
+    }
+
+    void ResetCacheStats()
+    {
+        cache.resetStats();
+    }
+}
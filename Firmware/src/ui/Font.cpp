@@ -0,0 +1,95 @@
+#include "ui/Font.hpp"
+#include "ui/font8x8_basic.h"
+
+// The tables are built at compile time from font8x8_basic (rows, bit 0 on the left) and stay in flash.
+namespace
+{
+    constexpr uint8_t GLYPH_COUNT = 128;
+    constexpr uint8_t SPACE_WIDTH = 3; // width of the blank glyphs of the narrow font
+
+    /// @brief Column `k` of a glyph of font8x8_basic (bit j is row j)
+    constexpr uint8_t basic_column(uint8_t glyph, uint8_t k)
+    {
+        uint8_t column = 0;
+        for (uint8_t j = 0; j < Font::HEIGHT; j++)
+        {
+            column |= ((static_cast<uint8_t>(font8x8_basic[glyph][j]) >> k) & 1) << j;
+        }
+        return column;
+    }
+
+    struct BasicTable
+    {
+        uint8_t columns[GLYPH_COUNT * 8];
+    };
+
+    constexpr BasicTable make_basic()
+    {
+        BasicTable table = {};
+        for (uint8_t glyph = 0; glyph < GLYPH_COUNT; glyph++)
+        {
+            for (uint8_t k = 0; k < 8; k++) table.columns[glyph * 8 + k] = basic_column(glyph, k);
+        }
+        return table;
+    }
+
+    constexpr BasicTable BASIC = make_basic();
+
+    struct NarrowLayout
+    {
+        uint8_t first_column[GLYPH_COUNT]; // first non blank column in the basic glyph
+        uint8_t widths[GLYPH_COUNT];
+        uint16_t offsets[GLYPH_COUNT];
+        uint16_t size;
+    };
+
+    constexpr NarrowLayout make_narrow_layout()
+    {
+        NarrowLayout layout = {};
+        for (uint8_t glyph = 0; glyph < GLYPH_COUNT; glyph++)
+        {
+            int first = -1, last = -1;
+            for (uint8_t k = 0; k < 8; k++)
+            {
+                if (BASIC.columns[glyph * 8 + k] == 0) continue;
+                if (first < 0) first = k;
+                last = k;
+            }
+            layout.first_column[glyph] = first < 0 ? 0 : first;
+            layout.widths[glyph] = first < 0 ? SPACE_WIDTH : last - first + 1;
+            layout.offsets[glyph] = layout.size;
+            layout.size += layout.widths[glyph];
+        }
+        return layout;
+    }
+
+    constexpr NarrowLayout NARROW_LAYOUT = make_narrow_layout();
+
+    struct NarrowTable
+    {
+        uint8_t columns[NARROW_LAYOUT.size];
+    };
+
+    constexpr NarrowTable make_narrow()
+    {
+        NarrowTable table = {};
+        for (uint8_t glyph = 0; glyph < GLYPH_COUNT; glyph++)
+        {
+            for (uint8_t k = 0; k < NARROW_LAYOUT.widths[glyph]; k++)
+            {
+                uint8_t column = NARROW_LAYOUT.first_column[glyph] + k;
+                table.columns[NARROW_LAYOUT.offsets[glyph] + k] = column < 8 ? BASIC.columns[glyph * 8 + column] : 0;
+            }
+        }
+        return table;
+    }
+
+    constexpr NarrowTable NARROW = make_narrow();
+}
+
+namespace Fonts
+{
+    const Font Basic = { 0, GLYPH_COUNT, 8, 0, 8 + 2, BASIC.columns, nullptr, nullptr };
+
+    const Font Narrow = { 0, GLYPH_COUNT, 0, 1, 8 + 2, NARROW.columns, NARROW_LAYOUT.offsets, NARROW_LAYOUT.widths };
+}
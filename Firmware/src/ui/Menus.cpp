@@ -4,10 +4,15 @@
 #include "ui/menus/Splash.hpp"
 #include "ui/menus/Face.hpp"
 #include "ui/menus/Error.hpp"
+#include "audio/Tunes.hpp"
+#include "Robot.hpp"
 #include "common/config.hpp"
 #include "common/Log.hpp"
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <esp_timer.h>
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 
 namespace Menus
@@ -42,28 +47,39 @@ namespace Menus
         memcpy(m_icon, icon, 8);
     }
 
+    /// @brief Button feedback sound (ignored while the audio isn't running)
+    static void play_feedback(const ToneSequence& sequence)
+    {
+        Robot::GetInstance().getAudioManager().play(sequence, 0.5f);
+    }
+
     void Menu::onLeftPressed()
     {
-        if (onPrev()) return;
+        if (onPrev()) play_feedback(Tunes::UiClick);
     }
 
     void Menu::onLeftLongPressed()
     {
-        if (onBack()) return;
+        if (onBack())
+        {
+            play_feedback(Tunes::UiBack);
+            return;
+        }
         if (parent)
         {
+            play_feedback(Tunes::UiBack);
             Menus::SetCurrentMenu(parent);
         }
     }
 
     void Menu::onRightPressed()
     {
-        if (onNext()) return;
+        if (onNext()) play_feedback(Tunes::UiClick);
     }
 
     void Menu::onRightLongPressed()
     {
-        if (onSelect()) return;
+        if (onSelect()) play_feedback(Tunes::UiSelect);
     }
 
     void Menu::show()
@@ -107,6 +123,16 @@ namespace Menus
         onUpdate();
     }
 
+    bool Menu::needsUpdate()
+    {
+        return m_need_render || m_title_shift != 0 || !isIdle();
+    }
+
+    bool Menu::isIdle()
+    {
+        return false;
+    }
+
     const char* Menu::getTitle()
     {
         return m_title;
@@ -133,69 +159,128 @@ namespace Menus
 
     /// MENU NAMESPACE FUNCTIONS / VARIABLES
 
-    bool btn_long_pressed[2] = {0, 0}; // just not to activate release if long pressed
     Menu* currentMenu = nullptr;
+    TaskHandle_t task_handle = nullptr;
+    std::atomic<bool> wake_requested = false;
+    Stats stats = {};
+
+    /// @brief Ticks to wait from now to an esp_timer time, rounded up so the deadline has passed on wake up
+    static TickType_t ticks_until(int64_t time_us, int64_t now_us)
+    {
+        if (time_us == ButtonDebouncer::NO_DEADLINE) return portMAX_DELAY;
+        if (time_us <= now_us) return 0;
+        return pdMS_TO_TICKS((time_us - now_us + 999) / 1000);
+    }
 
     void update_task(void* pvParams)
     {
-        TickType_t xLastWakeTime = xTaskGetTickCount();
-        const TickType_t xFrequency = pdMS_TO_TICKS(SCREEN_REFRESH_RATE);
+        const int64_t frame_us = SCREEN_REFRESH_RATE * 1000;
+        int64_t next_frame_us = esp_timer_get_time();
+        TickType_t wait = 0;
 
         while (true)
         {
-            if (currentMenu)
+            ulTaskNotifyTake(pdTRUE, wait);
+            stats.wakeups++;
+
+            int64_t now_us = esp_timer_get_time();
+            int64_t deadline_us = Button::Process(now_us);
+
+            bool input = false;
+            Button::InputEvent event;
+            while (Button::PopEvent(event))
             {
-                currentMenu->update();
-                currentMenu->render();
+                HandleInput(event.button, event.event);
+                uint32_t latency_us = static_cast<uint32_t>(esp_timer_get_time() - event.time_us);
+                stats.input_latency_last_us = latency_us;
+                stats.input_latency_max_us = std::max(stats.input_latency_max_us, latency_us);
+                input = true;
             }
-            xTaskDelayUntil(&xLastWakeTime, xFrequency);
+
+            // inputs and Wake() are shown right away, animations at the frame rate
+            bool needs_frame = currentMenu && currentMenu->needsUpdate();
+            if (input || wake_requested.exchange(false) || (needs_frame && now_us >= next_frame_us))
+            {
+                Update();
+                stats.cycles++;
+                next_frame_us = std::max(next_frame_us + frame_us, now_us);
+                needs_frame = currentMenu && currentMenu->needsUpdate();
+            }
+
+            if (needs_frame) deadline_us = std::min(deadline_us, next_frame_us);
+            wait = ticks_until(deadline_us, esp_timer_get_time());
         }
     }
 
     Status Init()
     {
-        // setup button callbacks
-        if (Status err = Button::Init(); err != Status::Ok)
+        // Start update loop, the buttons wake it up
+        if (xTaskCreatePinnedToCore(update_task, "updateMenu", 8192, nullptr, 1, &task_handle, CORE_BRAIN) != pdPASS)
         {
-            return err;
+            // ErrorHandle(ErrorStruct::MenusInitFailed);
+            return Status::Unknown;
         }
 
-        Button::SetCallbacks({
-            .onPressed = {
-                []() { Menus::btn_long_pressed[0] = false; },
-                []() { Menus::btn_long_pressed[1] = false; }
-            },
-            .onReleased = {
-                []() { if (!Menus::btn_long_pressed[0]) GetCurrentMenu()->onLeftPressed(); },
-                []() { if (!Menus::btn_long_pressed[1]) GetCurrentMenu()->onRightPressed(); }
-            },
-            .onLongPressed = {
-                []() { Menus::btn_long_pressed[0] = true; GetCurrentMenu()->onLeftLongPressed(); },
-                []() { Menus::btn_long_pressed[1] = true; GetCurrentMenu()->onRightLongPressed(); }
-            }
-        });
-
-        // Start update loop
-        TaskHandle_t xTaskHandle = nullptr;
-        if (xTaskCreatePinnedToCore(update_task, "updateMenu", 8192, nullptr, 1, &xTaskHandle, CORE_BRAIN) != pdPASS)
+        if (Status err = Button::Init(task_handle); err != Status::Ok)
         {
-            // ErrorHandle(ErrorStruct::MenusInitFailed);
-            return Status::Unknown;
+            return err;
         }
 
         return Status::Ok;
     }
 
+    void Update()
+    {
+        if (currentMenu)
+        {
+            currentMenu->update();
+            currentMenu->render();
+        }
+    }
+
     Menu* GetCurrentMenu()
     {
         return currentMenu;
     }
 
+    void HandleInput(uint8_t button, ButtonDebouncer::Event event)
+    {
+        if (currentMenu == nullptr) return;
+        stats.inputs++;
+
+        // short presses act on release, so a long press never gives a short one too
+        switch (event)
+        {
+            case ButtonDebouncer::Event::Clicked:
+                if (button == Button::LEFT) currentMenu->onLeftPressed();
+                else currentMenu->onRightPressed();
+                break;
+            case ButtonDebouncer::Event::LongPressed:
+                if (button == Button::LEFT) currentMenu->onLeftLongPressed();
+                else currentMenu->onRightLongPressed();
+                break;
+            default:
+                break;
+        }
+    }
+
+    void Wake()
+    {
+        wake_requested = true;
+        if (task_handle) xTaskNotifyGive(task_handle);
+    }
+
+    Stats GetStats()
+    {
+        return stats;
+    }
+
     void SetCurrentMenu(Menu* menu)
     {
         if (currentMenu) currentMenu->hide();
         currentMenu = menu;
         if (currentMenu) currentMenu->show();
+        Wake();
     }
 
     // void DisplayError(ErrorStruct::ErrorStruct err)
@@ -0,0 +1,172 @@
+#include "ui/SpriteCache.hpp"
+#include "common/Log.hpp"
+#include "esp_heap_caps.h"
+#include <cstring>
+
+constexpr const char* TAG = "SpriteCache";
+
+Status SpriteCache::init(size_t budget, uint16_t max_entries)
+{
+    if (entries != nullptr) return Status::Ok;
+    if (max_entries == 0) return Status::InvalidParameters;
+
+    entries = static_cast<Entry*>(heap_caps_malloc(sizeof(Entry) * max_entries, MALLOC_CAP_8BIT | MALLOC_CAP_INTERNAL));
+    if (entries == nullptr)
+    {
+        LOG_ERROR(TAG, "Failed to allocate %u entries", max_entries);
+        return Status::NoMemory;
+    }
+    memset(entries, 0, sizeof(Entry) * max_entries);
+    this->max_entries = max_entries;
+    this->budget = budget;
+    last_hit = 0;
+    use_clock = 0;
+    stats = {};
+    return Status::Ok;
+}
+
+void SpriteCache::deinit()
+{
+    if (entries == nullptr) return;
+
+    clear();
+    heap_caps_free(entries);
+    entries = nullptr;
+    max_entries = 0;
+}
+
+void SpriteCache::clear()
+{
+    for (uint16_t i = 0; i < max_entries; i++)
+    {
+        if (entries[i].last_use != 0) evict(entries[i]);
+    }
+}
+
+SpriteCache::Stats SpriteCache::getStats() const
+{
+    return stats;
+}
+
+void SpriteCache::resetStats()
+{
+    stats.hits = 0;
+    stats.misses = 0;
+    stats.evictions = 0;
+    stats.failures = 0;
+}
+
+uint32_t SpriteCache::hash_key(const void* key, size_t key_size)
+{
+    // FNV-1a
+    const uint8_t* bytes = static_cast<const uint8_t*>(key);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < key_size; i++)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+const SpriteCache::Sprite* SpriteCache::find(uint32_t hash, const void* key, size_t key_size)
+{
+    for (uint16_t n = 0; n < max_entries; n++)
+    {
+        uint16_t i = n == 0 ? last_hit : (n == last_hit ? 0 : n);
+        Entry& entry = entries[i];
+        if (entry.last_use != 0 && entry.hash == hash && entry.key_size == key_size && memcmp(entry.key, key, key_size) == 0)
+        {
+            entry.last_use = ++use_clock;
+            last_hit = i;
+            stats.hits++;
+            return &entry.sprite;
+        }
+    }
+    return nullptr;
+}
+
+SpriteCache::Sprite* SpriteCache::insert(uint32_t hash, const void* key, size_t key_size, uint16_t width, uint16_t height)
+{
+    uint16_t pages = (height + ScreenDriver::PAGE_HEIGHT - 1) / ScreenDriver::PAGE_HEIGHT;
+    size_t plane_size = width * pages;
+    if (entries == nullptr || key_size > MAX_KEY_SIZE || width == 0 || height == 0 ||
+        width > SCREEN_WIDTH || height > SCREEN_HEIGHT || 2 * plane_size > budget)
+    {
+        stats.failures++;
+        return nullptr;
+    }
+    stats.misses++;
+
+    // make room : free entry and enough budget left, dropping the least recently used sprites
+    Entry* slot = nullptr;
+    while (true)
+    {
+        Entry* oldest = nullptr;
+        slot = nullptr;
+        for (uint16_t i = 0; i < max_entries; i++)
+        {
+            Entry& entry = entries[i];
+            if (entry.last_use == 0)
+            {
+                if (slot == nullptr) slot = &entry;
+            }
+            else if (oldest == nullptr || entry.last_use < oldest->last_use)
+            {
+                oldest = &entry;
+            }
+        }
+        if (slot != nullptr && stats.bytes + 2 * plane_size <= budget) break;
+
+        evict(*oldest); // can't be null : the cache is full, or holds the budget
+        stats.evictions++;
+    }
+
+    // both planes in one block, in PSRAM (internal RAM is kept for DMA and Wi-Fi buffers)
+    uint8_t* planes = static_cast<uint8_t*>(heap_caps_malloc(2 * plane_size, MALLOC_CAP_8BIT | MALLOC_CAP_SPIRAM));
+    if (planes == nullptr)
+    {
+        stats.failures++;
+        return nullptr;
+    }
+    memset(planes, 0, 2 * plane_size);
+
+    slot->sprite = { width, height, pages, planes, planes + plane_size };
+    slot->hash = hash;
+    slot->last_use = ++use_clock;
+    slot->key_size = key_size;
+    memcpy(slot->key, key, key_size);
+    stats.entries++;
+    stats.bytes += 2 * plane_size;
+    return &slot->sprite;
+}
+
+void SpriteCache::evict(Entry& entry)
+{
+    heap_caps_free(entry.sprite.value);
+    stats.entries--;
+    stats.bytes -= 2 * entry.sprite.width * entry.sprite.pages;
+    entry.last_use = 0;
+}
+
+void SpriteCache::begin_canvas(const Sprite& sprite, uint8_t* plane)
+{
+    if (!canvas_active)
+    {
+        saved_info = ScreenDriver::info;
+        saved_dirty = ScreenDriver::dirty;
+        canvas_active = true;
+    }
+    ScreenDriver::info = {
+        .data = plane,
+        .width = sprite.width,
+        .height = static_cast<uint16_t>(sprite.pages * ScreenDriver::PAGE_HEIGHT),
+    };
+    ScreenDriver::dirty = canvas_dirty; // the spans are meaningless here, but the primitives record them
+}
+
+void SpriteCache::end_canvas()
+{
+    ScreenDriver::info = saved_info;
+    ScreenDriver::dirty = saved_dirty;
+    canvas_active = false;
+}
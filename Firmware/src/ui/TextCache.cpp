@@ -0,0 +1,107 @@
+#include "ui/TextCache.hpp"
+#include <algorithm>
+#include <cstring>
+
+const TextCache::Raster* TextCache::get(const char* text, const Font& font)
+{
+    // FNV-1a, stopping at the first character that can't be cached
+    uint32_t hash = 2166136261u;
+    size_t length = 0;
+    for (; text[length] != '\0'; length++)
+    {
+        if (length == TEXT_CACHE_MAX_LENGTH)
+        {
+            stats.uncached++;
+            return nullptr;
+        }
+        hash = (hash ^ static_cast<uint8_t>(text[length])) * 16777619u;
+    }
+
+    for (uint8_t n = 0; n < TEXT_CACHE_ENTRIES; n++)
+    {
+        uint8_t i = n == 0 ? last_hit : (n == last_hit ? 0 : n);
+        Entry& entry = entries[i];
+        if (entry.last_use != 0 && entry.hash == hash && entry.font == &font && entry.length == length &&
+            memcmp(entry.text, text, length) == 0)
+        {
+            entry.last_use = ++use_clock;
+            last_hit = i;
+            stats.hits++;
+            return &entry.raster;
+        }
+    }
+
+    // free entry, or the least recently used one
+    Entry* slot = &entries[0];
+    for (Entry& entry : entries)
+    {
+        if (entry.last_use == 0)
+        {
+            slot = &entry;
+            break;
+        }
+        if (entry.last_use < slot->last_use) slot = &entry;
+    }
+    if (slot->last_use != 0)
+    {
+        stats.evictions++;
+        stats.entries--;
+    }
+
+    uint16_t width = Rasterize(text, length, font, slot->raster.columns, MAX_COLUMNS);
+    if (width == 0 && length > 0)
+    {
+        slot->last_use = 0;
+        stats.uncached++;
+        return nullptr;
+    }
+    slot->raster.width = width;
+    slot->font = &font;
+    slot->hash = hash;
+    slot->last_use = ++use_clock;
+    slot->length = length;
+    memcpy(slot->text, text, length);
+    last_hit = slot - entries;
+    stats.misses++;
+    stats.entries++;
+    return &slot->raster;
+}
+
+void TextCache::clear()
+{
+    for (Entry& entry : entries) entry.last_use = 0;
+    stats.entries = 0;
+}
+
+TextCache::Stats TextCache::getStats() const
+{
+    return stats;
+}
+
+void TextCache::resetStats()
+{
+    stats.hits = 0;
+    stats.misses = 0;
+    stats.evictions = 0;
+    stats.uncached = 0;
+}
+
+uint16_t TextCache::Rasterize(const char* text, size_t length, const Font& font, uint8_t* out, uint16_t max_columns)
+{
+    uint16_t column = 0;
+    uint16_t width = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+        uint8_t glyph_width;
+        const uint8_t* glyph = font.glyph(text[i], glyph_width);
+        if (column + glyph_width > max_columns) return 0;
+
+        memcpy(out + column, glyph, glyph_width);
+        width = column + glyph_width;
+        column = width;
+        uint16_t spacing = std::min<uint16_t>(font.spacing, max_columns - column);
+        memset(out + column, 0, spacing); // blank, so a line is painted in one go
+        column += spacing;
+    }
+    return width;
+}
@@ -17,6 +17,12 @@ Status UIManager::init()
         return err;
     }
 
+    if (Status err = ScreenDriver::StartUploadTask(); err != Status::Ok)
+    {
+        // not critical, the menus then wait for each frame to be sent
+        LOG_WARNING(TAG, "Screen upload task not started, uploading synchronously");
+    }
+
     if (Status err = Menus::Init(); err != Status::Ok)
     {
         return err;
@@ -31,6 +37,11 @@ Status UIManager::init()
     {
         // not critical, we can still use the ui without camera features
     }
+    else if (Status err = vision.start(camera.getStream()); err != Status::Ok)
+    {
+        // not critical, the robot just doesn't react to what it sees
+        LOG_WARNING(TAG, "Vision not started");
+    }
     
     // Display splash screen
     Menus::SetCurrentMenu(Menus::GetMenuSplash());
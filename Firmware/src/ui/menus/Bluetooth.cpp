@@ -48,3 +48,8 @@ void MenuBluetooth::onRender()
 void MenuBluetooth::onUpdate()
 {
 }
+
+bool MenuBluetooth::isIdle()
+{
+    return true; // only changes on button presses
+}
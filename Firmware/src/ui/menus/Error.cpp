@@ -2,6 +2,7 @@
 #include "ui/Draw.hpp"
 #include "common/LED.hpp"
 #include "ui/Icons.hpp"
+#include <cstdio>
 
 MenuError::MenuError()
     : Menu("Error", nullptr, Icons::ErrorMenu)
@@ -57,6 +58,11 @@ void MenuError::onUpdate()
     
 }
 
+bool MenuError::isIdle()
+{
+    return true; // static screen
+}
+
 // void MenuError::setError(ErrorStruct::ErrorStruct err)
 // {
 //     error = err;
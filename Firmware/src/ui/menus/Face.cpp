@@ -1,12 +1,10 @@
 #include "ui/menus/Face.hpp"
-#include "ui/Draw.hpp"
 #include "common/Log.hpp"
 #include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 #include <esp_random.h>
 #include <cmath>
 
-constexpr uint8_t EYES_SIZE = 30;
-
 MenuFace* MenuFace::instance = nullptr;
 
 MenuFace::MenuFace()
@@ -81,83 +79,8 @@ void MenuFace::onRender()
         m_behavior(base_infos, xTaskGetTickCount() * portTICK_PERIOD_MS);
     }
 
-    // Display the eyes based on eyes_info
-
-    uint8_t m_eyes_size = EYES_SIZE * base_infos.size;
-    float look_x_right = -(-base_infos.look_x*2 - base_infos.look_x*base_infos.look_x);
-    float look_x_left = base_infos.look_x*2 - base_infos.look_x*base_infos.look_x;
-    
-    Draw::RectRounded( // right eye white
-        ScreenDriver::info.width / 4  + look_x_right * 10.0f - m_eyes_size / 2,
-        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f,
-        m_eyes_size,
-        m_eyes_size * base_infos.open_right,
-        7,
-        ScreenDriver::COLOR_WHITE
-    );
-    if (eyes_info.lid_in_right > 0.001f) Draw::TriangleFilled( // right eyelid in
-        ScreenDriver::info.width / 4  + look_x_right * 10.0f - m_eyes_size / 2,
-        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f,
-        ScreenDriver::info.width / 4  + look_x_right * 10.0f + m_eyes_size / 2,
-        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f,
-        ScreenDriver::info.width / 4  + look_x_right * 10.0f + m_eyes_size / 2,
-        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f + (base_infos.lid_in_right * m_eyes_size * base_infos.open_right),
-        ScreenDriver::COLOR_BLACK
-    );
-    if (eyes_info.lid_out_right > 0.001f) Draw::TriangleFilled( // right eyelid out
-        ScreenDriver::info.width / 4  + look_x_right * 10.0f - m_eyes_size / 2,
-        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f,
-        ScreenDriver::info.width / 4  + look_x_right * 10.0f - m_eyes_size / 2,
-        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f + (base_infos.lid_out_right * m_eyes_size * base_infos.open_right),
-        ScreenDriver::info.width / 4  + look_x_right * 10.0f + m_eyes_size / 2,
-        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f,
-        ScreenDriver::COLOR_BLACK
-    );
-    if (eyes_info.lid_bottom_right > 0.001f) Draw::TriangleFilled( // right eyelid bottom
-        ScreenDriver::info.width / 4  + look_x_right * 10.0f + m_eyes_size / 2,
-        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f + (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f,
-        ScreenDriver::info.width / 4  + look_x_right * 10.0f - m_eyes_size / 2,
-        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f + (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f,
-        ScreenDriver::info.width / 4  + look_x_right * 10.0f,
-        ScreenDriver::info.height / 2 + base_infos.look_y * 10.0f + (m_eyes_size * base_infos.open_right) / 2 - base_infos.skew * 5.0f - (base_infos.lid_bottom_right * m_eyes_size * base_infos.open_right),
-        ScreenDriver::COLOR_BLACK
-    );
-
-    Draw::RectRounded( // left eye white
-        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f - m_eyes_size / 2,
-        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f,
-        m_eyes_size,
-        m_eyes_size * base_infos.open_left,
-        7,
-        ScreenDriver::COLOR_WHITE
-    );
-    if (eyes_info.lid_in_left > 0.001f) Draw::TriangleFilled( // left eyelid in
-        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f - m_eyes_size / 2,
-        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f,
-        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f + m_eyes_size / 2,
-        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f,
-        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f - m_eyes_size / 2,
-        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f + (base_infos.lid_in_left * m_eyes_size * base_infos.open_left),
-        ScreenDriver::COLOR_BLACK
-    );
-    if (eyes_info.lid_out_left > 0.001f) Draw::TriangleFilled( // left eyelid out
-        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f - m_eyes_size / 2,
-        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f,
-        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f + m_eyes_size / 2,
-        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f + (base_infos.lid_out_left * m_eyes_size * base_infos.open_left),
-        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f + m_eyes_size / 2,
-        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f - (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f,
-        ScreenDriver::COLOR_BLACK
-    );
-    if (eyes_info.lid_bottom_left > 0.001f) Draw::TriangleFilled( // left eyelid bottom
-        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f + m_eyes_size / 2,
-        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f + (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f,
-        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f - m_eyes_size / 2,
-        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f + (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f,
-        ScreenDriver::info.width * 3 / 4 + look_x_left * 10.0f,
-        ScreenDriver::info.height / 2    + base_infos.look_y * 10.0f + (m_eyes_size * base_infos.open_left) / 2 + base_infos.skew * 5.0f - (base_infos.lid_bottom_left * m_eyes_size * base_infos.open_left),
-        ScreenDriver::COLOR_BLACK
-    );
+    // Display the eyes based on eyes_info (eye shapes are cached as sprites, see ui/FaceEyes.hpp)
+    FaceEyes::Render(base_infos);
 }
 
 void MenuFace::onUpdate()
@@ -4,6 +4,7 @@
 #include "common/config.hpp"
 #include "common/I2C.hpp"
 #include <cmath>
+#include <cstdio>
 
 MenuI2C::MenuI2C(Menu* parent)
     : Menu("I2C Scan", parent, Icons::I2CMenu)
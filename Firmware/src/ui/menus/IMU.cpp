@@ -3,6 +3,7 @@
 #include "ui/Draw.hpp"
 #include "common/config.hpp"
 #include "drivers/IMUDriver.hpp"
+#include <cstdio>
 
 MenuIMU::MenuIMU(Menu* parent)
     : Menu("IMU", parent, Icons::IMUMenu)
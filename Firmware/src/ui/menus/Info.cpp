@@ -46,3 +46,8 @@ void MenuInfo::onRender()
 void MenuInfo::onUpdate()
 {
 }
+
+bool MenuInfo::isIdle()
+{
+    return true; // only changes on button presses
+}
@@ -1,6 +1,7 @@
 #include "ui/menus/List.hpp"
 #include "ui/Draw.hpp"
 #include "common/config.hpp"
+#include <cmath>
 
 MenuList::MenuList()
     : Menu()
@@ -84,6 +85,9 @@ void MenuList::onRender()
 
     m_view_shift_current += (m_selected_index - m_view_shift_current) * 0.25f;
     m_selected_index_current += (m_selected_index - m_selected_index_current) * 0.5f;
+    // snap the end of the easing (less than a pixel away), so the list ends up idle
+    if (std::fabs(m_selected_index - m_view_shift_current) < ANIMATION_SNAP) m_view_shift_current = m_selected_index;
+    if (std::fabs(m_selected_index - m_selected_index_current) < ANIMATION_SNAP) m_selected_index_current = m_selected_index;
 
     const uint8_t text_height = 8;
     const uint8_t padding = 4;
@@ -110,4 +114,10 @@ void MenuList::onRender()
 void MenuList::onUpdate()
 {
     triggerRender();
-}
\ No newline at end of file
+}
+
+bool MenuList::isIdle()
+{
+    return m_selected_shift >= MENU_LIST_ITEM_SELECTED_SHIFT && m_view_shift_current == m_selected_index &&
+           m_selected_index_current == m_selected_index;
+}
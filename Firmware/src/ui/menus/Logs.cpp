@@ -2,6 +2,7 @@
 #include "ui/Icons.hpp"
 #include "ui/Draw.hpp"
 #include "common/Log.hpp"
+#include <cstdio>
 
 MenuLogs::MenuLogs(Menu* parent)
     : Menu("Logs", parent, Icons::LogsMenu)
@@ -31,6 +32,7 @@ bool MenuLogs::onPrev()
 
 void MenuLogs::onShow()
 {
+    scrollOffset = 0;
 }
 
 void MenuLogs::onHide()
@@ -42,18 +44,35 @@ void MenuLogs::onRender()
     renderHeader();
 
     const uint16_t NB_LINES = 4;
+    const uint16_t MESSAGE_X = 28; // after the level
+    const uint16_t message_width = ScreenDriver::info.width - MESSAGE_X;
+    scrolling = false;
     for (size_t i = 0; i < NB_LINES; i++)
     {
         uint16_t index = NB_LINES - i - 1;
         const Log::LineInfo& line = Log::GetLine(index);
-        char str[128/8 + 1];
-        snprintf(str, sizeof(str), "[%c] %.12s", "IWEDS"[static_cast<uint8_t>(line.level)], line.message);
-        Draw::Text(0, Menu::HEADER_HEIGHT + i * 12 + 4, str);
+        uint16_t y = Menu::HEADER_HEIGHT + i * 12 + 4;
+        char level[4];
+        snprintf(level, sizeof(level), "[%c]", "IWEDS"[static_cast<uint8_t>(line.level)]);
+        Draw::Text(0, y, level);
+
+        // long messages scroll, in the narrow font to show more of them
+        Draw::TextScroll(MESSAGE_X, y, message_width, line.message, scrollOffset, ScreenDriver::COLOR_WHITE, false,
+                         Fonts::Narrow);
+        scrolling |= Draw::GetTextWidth(line.message, Fonts::Narrow) > message_width;
     }
 }
 
 void MenuLogs::onUpdate()
 {
+    if (scrolling)
+    {
+        // one column per frame
+        scrollOffset++;
+        triggerRender();
+        return;
+    }
+
     // update every second to get new logs
     if (updateCounter++ > SCREEN_REFRESH_RATE / updateFrequency)
     {
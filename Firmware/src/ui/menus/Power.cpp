@@ -3,6 +3,7 @@
 #include "ui/Draw.hpp"
 #include "common/config.hpp"
 #include "drivers/PowerDriver.hpp"
+#include <cstdio>
 
 MenuPower::MenuPower(Menu* parent)
     : Menu("Power", parent, Icons::PowerMenu)
@@ -47,6 +47,7 @@ void MenuReboot::onRender()
         uint16_t width = Draw::GetTextWidth(text);
         Draw::Text(ScreenDriver::info.width / 2 - width / 2, HEADER_HEIGHT + 4, text);
         ScreenDriver::Upload(); // send data now
+        ScreenDriver::Flush();
 
         // Restart
         esp_restart();
@@ -48,6 +48,7 @@ void MenuReset::onRender()
         uint16_t width = Draw::GetTextWidth(text);
         Draw::Text(ScreenDriver::info.width / 2 - width / 2, HEADER_HEIGHT + 4, text);
         ScreenDriver::Upload(); // send data now
+        ScreenDriver::Flush();
 
         // reset NVS and restart robot here
         // (not in update, so that the screen displayes the "resetting" message)
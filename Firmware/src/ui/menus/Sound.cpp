@@ -2,6 +2,7 @@
 #include "ui/Icons.hpp"
 #include "ui/Draw.hpp"
 #include "Robot.hpp"
+#include <cstdio>
 
 MenuSound::MenuSound(Menu* parent)
     : Menu("Sound", parent, Icons::SoundMenu)
@@ -137,6 +138,11 @@ void MenuSound::onUpdate()
 {
 }
 
+bool MenuSound::isIdle()
+{
+    return true; // only changes on button presses
+}
+
 void MenuSound::applySoundSettings()
 {
     AudioManager& man = Robot::GetInstance().getAudioManager();
@@ -40,3 +40,8 @@ void MenuSplash::onRender()
 void MenuSplash::onUpdate()
 {
 }
+
+bool MenuSplash::isIdle()
+{
+    return true; // static screen
+}
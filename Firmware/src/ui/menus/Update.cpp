@@ -59,7 +59,8 @@ void MenuUpdate::onRender()
             if (updt.isUpdateAvailable())
             {
                 const char* text = "New update!";
-                const char* text_ver = updt.getLatestVersion().c_str();
+                std::string version = updt.getLatestVersion(); // returned by value, keep it alive while drawing
+                const char* text_ver = version.c_str();
                 uint16_t text_width = Draw::GetTextWidth(text);
                 uint16_t ver_width = Draw::GetTextWidth(text_ver);
                 Draw::RectRounded(
@@ -189,6 +190,28 @@ void MenuUpdate::onRender()
             Draw::Text(ScreenDriver::info.width / 2 - width / 2, ScreenDriver::info.height / 2 - height / 2, text);
             break;
         }
+        case UpdateManager::Status::ErrorIntegrity : {
+            const char* text = "Corrupted";
+            uint16_t width = Draw::GetTextWidth(text);
+            uint16_t height = 8;
+            Draw::Text(ScreenDriver::info.width / 2 - width / 2, ScreenDriver::info.height / 2 - height / 2 - 6, text);
+            const char* text2 = "update";
+            uint16_t width2 = Draw::GetTextWidth(text2);
+            uint16_t height2 = 8;
+            Draw::Text(ScreenDriver::info.width / 2 - width2 / 2, ScreenDriver::info.height / 2 - height2 / 2 + 6, text2);
+            break;
+        }
+        case UpdateManager::Status::ErrorNoManifestKey : {
+            const char* text = "Updates";
+            uint16_t width = Draw::GetTextWidth(text);
+            uint16_t height = 8;
+            Draw::Text(ScreenDriver::info.width / 2 - width / 2, ScreenDriver::info.height / 2 - height / 2 - 6, text);
+            const char* text2 = "disabled";
+            uint16_t width2 = Draw::GetTextWidth(text2);
+            uint16_t height2 = 8;
+            Draw::Text(ScreenDriver::info.width / 2 - width2 / 2, ScreenDriver::info.height / 2 - height2 / 2 + 6, text2);
+            break;
+        }
         default: {
             const char* text = "Error :(";
             uint16_t width = Draw::GetTextWidth(text);
@@ -5,6 +5,7 @@
 #include "Robot.hpp"
 
 #include "qrcodegen.hpp"
+#include <cstdio>
 
 MenuWiFi::MenuWiFi(Menu* parent)
     : Menu("WiFi", parent, Icons::WiFiMenu)
@@ -1,16 +1,33 @@
 #include "ui/widgets/animation.hpp"
+#include "common/Log.hpp"
 
 namespace UIWidgets
 {
+    Animation::Animation(const uint8_t* data, size_t size, uint8_t x, uint8_t y, bool transparent, bool loop)
+        : data(data), size(size), x(x), y(y), transparent(transparent), loop(loop), index(0)
+    {
+        if (AnimationCodec::ParseHeader(data, size, header) != Status::Ok)
+        {
+            LOG_ERROR(AnimationCodec::TAG, "Invalid animation, it won't be drawn");
+            this->data = nullptr;
+            header = {};
+        }
+    }
+
     void Animation::update()
     {
+        if (header.frame_count == 0)
+        {
+            return;
+        }
+
         if (loop)
         {
-            index = (index + 1) % length;
+            index = (index + 1) % header.frame_count;
         }
         else
         {
-            if (index < length - 1)
+            if (index < header.frame_count - 1)
             {
                 index++;
             }
@@ -19,13 +36,22 @@ namespace UIWidgets
 
     void Animation::render()
     {
-        if (buffer == nullptr || length == 0)
+        if (data == nullptr)
+        {
+            return;
+        }
+        if (!decoder.isOpen() && decoder.open(data, size) != Status::Ok)
         {
             return;
         }
 
-        uint8_t* frameData = buffer + (index * (width * height) / 8); // 1 bit per pixel, so divide by 8
-        Draw::Blit(x, y, width, height, frameData, ScreenDriver::COLOR_WHITE, transparent);
+        // one delta per frame while playing, the frame is kept while the index doesn't change
+        if (decoder.seek(index) != Status::Ok)
+        {
+            return;
+        }
+        const uint8_t* frame = decoder.getFrame();
+        Draw::BlitMasked<true>(x, y, header.width, header.height, frame, transparent ? frame : nullptr);
     }
 
     bool Animation::isLooping() const
@@ -40,12 +66,12 @@ namespace UIWidgets
 
     bool Animation::isFinished() const
     {
-        return !loop && index >= length - 1;
+        return !loop && index + 1 >= header.frame_count;
     }
 
     void Animation::setFrameIndex(uint8_t newIndex)
     {
-        if (newIndex < length)
+        if (newIndex < header.frame_count)
         {
             index = newIndex;
         }
@@ -58,6 +84,6 @@ namespace UIWidgets
 
     uint8_t Animation::getFrameCount() const
     {
-        return length;
+        return header.frame_count;
     }
 }
\ No newline at end of file
@@ -0,0 +1,470 @@
+#include "vision/JpegThumbnail.hpp"
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace
+{
+    constexpr int LOOKUP_BITS = 9;
+
+    struct HuffmanTable
+    {
+        bool defined = false;
+        uint8_t values[256];
+        int32_t min_code[17];
+        int32_t max_code[17];   // -1 when no code of that length
+        int32_t value_index[17];
+        uint16_t lookup[1 << LOOKUP_BITS]; // (length << 8) | value of the codes up to LOOKUP_BITS bits, 0 for longer ones
+        uint16_t skip[1 << LOOKUP_BITS];   // AC : 0x8000 | (length + coefficient bits) << 8 | value, when they fit LOOKUP_BITS
+    };
+
+    struct Component
+    {
+        uint8_t id;
+        uint8_t h;
+        uint8_t v;
+        uint8_t quant_table;
+        uint8_t dc_table;
+        uint8_t ac_table;
+        int32_t predictor;
+    };
+
+    /** Bits of the entropy coded data, stops at the first marker (then gives zeros) */
+    struct BitReader
+    {
+        const uint8_t* data;
+        size_t size;
+        size_t pos;
+        uint32_t bits = 0; // MSB first
+        int count = 0;
+        bool marker = false;
+        bool truncated = false;
+
+        void fill()
+        {
+            while (count <= 24)
+            {
+                uint32_t byte = 0;
+                if (!marker)
+                {
+                    if (pos + 1 >= size)
+                    {
+                        truncated = true;
+                        marker = true;
+                    }
+                    else if (data[pos] != 0xFF)
+                    {
+                        byte = data[pos++];
+                    }
+                    else if (data[pos + 1] == 0x00) // stuffed byte
+                    {
+                        byte = 0xFF;
+                        pos += 2;
+                    }
+                    else
+                    {
+                        marker = true;
+                    }
+                }
+                bits |= byte << (24 - count);
+                count += 8;
+            }
+        }
+
+        uint32_t take(int n)
+        {
+            uint32_t value = bits >> (32 - n);
+            bits <<= n;
+            count -= n;
+            return value;
+        }
+
+        /** Skips to the data after the next restart marker */
+        bool restart()
+        {
+            bits = 0;
+            count = 0;
+            marker = false;
+            for (; pos + 1 < size; pos++)
+            {
+                if (data[pos] == 0xFF && data[pos + 1] >= 0xD0 && data[pos + 1] <= 0xD7)
+                {
+                    pos += 2;
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    struct Decoder
+    {
+        const uint8_t* data;
+        size_t size;
+        size_t pos = 0;
+
+        uint16_t quant[4] = {0, 0, 0, 0}; // DC quantization of each table
+        HuffmanTable dc[4] = {};
+        HuffmanTable ac[4] = {};
+        Component components[4] = {};
+        uint8_t component_count = 0;
+        uint16_t width = 0;
+        uint16_t height = 0;
+        uint16_t restart_interval = 0;
+
+        uint16_t read16(size_t at) const
+        {
+            return static_cast<uint16_t>((data[at] << 8) | data[at + 1]);
+        }
+
+        Status parseQuantization(size_t at, size_t end)
+        {
+            while (at < end)
+            {
+                uint8_t precision = data[at] >> 4;
+                uint8_t table = data[at] & 0x0F;
+                size_t length = 1 + 64 * (precision ? 2 : 1);
+                if (table > 3 || precision > 1 || at + length > end) return Status::InvalidParameters;
+                quant[table] = precision ? read16(at + 1) : data[at + 1]; // DC first in zigzag order
+                at += length;
+            }
+            return Status::Ok;
+        }
+
+        Status parseHuffman(size_t at, size_t end)
+        {
+            while (at < end)
+            {
+                if (at + 17 > end) return Status::InvalidParameters;
+                uint8_t type = data[at] >> 4;
+                uint8_t index = data[at] & 0x0F;
+                if (type > 1 || index > 3) return Status::InvalidParameters;
+                const uint8_t* counts = data + at + 1;
+                size_t total = 0;
+                for (int i = 0; i < 16; i++) total += counts[i];
+                if (total > 256 || at + 17 + total > end) return Status::InvalidParameters;
+
+                HuffmanTable& table = type ? ac[index] : dc[index];
+                memcpy(table.values, data + at + 17, total);
+                memset(table.lookup, 0, sizeof(table.lookup));
+                memset(table.skip, 0, sizeof(table.skip));
+                int32_t code = 0;
+                int32_t k = 0;
+                for (int length = 1; length <= 16; length++)
+                {
+                    table.min_code[length] = code;
+                    table.value_index[length] = k;
+                    for (int i = 0; i < counts[length - 1]; i++, code++, k++)
+                    {
+                        if (code >= (1 << length)) return Status::InvalidParameters;
+                        if (length > LOOKUP_BITS) continue;
+                        int shift = LOOKUP_BITS - length;
+                        uint16_t entry = static_cast<uint16_t>((length << 8) | table.values[k]);
+                        for (int j = 0; j < (1 << shift); j++) table.lookup[(code << shift) | j] = entry;
+
+                        // AC codes and the bits of their coefficient skipped in one go
+                        int total = length + (table.values[k] & 0x0F);
+                        if (type == 0 || total > LOOKUP_BITS) continue;
+                        entry = static_cast<uint16_t>(0x8000 | (total << 8) | table.values[k]);
+                        for (int j = 0; j < (1 << shift); j++) table.skip[(code << shift) | j] = entry;
+                    }
+                    table.max_code[length] = counts[length - 1] ? code - 1 : -1;
+                    code <<= 1;
+                }
+                table.defined = true;
+                at += 17 + total;
+            }
+            return Status::Ok;
+        }
+
+        Status parseFrame(size_t at, size_t end)
+        {
+            if (end - at < 6 || data[at] != 8) return Status::InvalidParameters;
+            height = read16(at + 1);
+            width = read16(at + 3);
+            component_count = data[at + 5];
+            if (width == 0 || height == 0 || component_count == 0 || component_count > 4) return Status::InvalidParameters;
+            if (end - at < 6 + 3u * component_count) return Status::InvalidParameters;
+
+            for (int i = 0; i < component_count; i++)
+            {
+                const uint8_t* c = data + at + 6 + 3 * i;
+                components[i] = { c[0], static_cast<uint8_t>(c[1] >> 4), static_cast<uint8_t>(c[1] & 0x0F), c[2], 0, 0, 0 };
+                if (components[i].h < 1 || components[i].h > 4 || components[i].v < 1 || components[i].v > 4 || c[2] > 3)
+                    return Status::InvalidParameters;
+            }
+            return Status::Ok;
+        }
+
+        /**
+         * @brief Walk the markers up to the start of the entropy coded data of the next scan.
+         * @param scan_at Receives the offset of the scan header, 0 at the end of the image.
+         */
+        Status nextScan(size_t& scan_at, bool frame_only)
+        {
+            scan_at = 0;
+            while (true)
+            {
+                // entropy coded data and fill bytes until the next marker
+                while (pos + 1 < size && !(data[pos] == 0xFF && data[pos + 1] != 0x00 && data[pos + 1] != 0xFF
+                                           && (data[pos + 1] < 0xD0 || data[pos + 1] > 0xD7)))
+                    pos++;
+                if (pos + 1 >= size) return Status::InvalidParameters;
+
+                uint8_t marker = data[pos + 1];
+                pos += 2;
+                if (marker == 0xD8 || marker == 0x01) continue; // SOI, TEM : no length
+                if (marker == 0xD9) return Status::Ok;          // EOI
+
+                if (pos + 2 > size) return Status::InvalidParameters;
+                size_t length = read16(pos);
+                if (length < 2 || pos + length > size) return Status::InvalidParameters;
+                size_t at = pos + 2;
+                size_t end = pos + length;
+                pos = end;
+
+                Status err = Status::Ok;
+                switch (marker)
+                {
+                    case 0xC0: // baseline
+                    case 0xC1: // extended, huffman
+                        err = parseFrame(at, end);
+                        if (err == Status::Ok && frame_only) return Status::Ok;
+                        break;
+                    case 0xC2: case 0xC3: case 0xC5: case 0xC6: case 0xC7: // progressive, lossless, hierarchical
+                    case 0xC9: case 0xCA: case 0xCB: case 0xCD: case 0xCE: case 0xCF: // arithmetic
+                        return Status::InvalidParameters;
+                    case 0xC4:
+                        err = parseHuffman(at, end);
+                        break;
+                    case 0xDB:
+                        err = parseQuantization(at, end);
+                        break;
+                    case 0xDD:
+                        if (end - at < 2) return Status::InvalidParameters;
+                        restart_interval = read16(at);
+                        break;
+                    case 0xDA:
+                        if (component_count == 0) return Status::InvalidParameters; // scan before the frame
+                        scan_at = at;
+                        return Status::Ok;
+                    default: // APPn, COM, ...
+                        break;
+                }
+                if (err != Status::Ok) return err;
+            }
+        }
+
+        bool decodeSymbol(BitReader& reader, const HuffmanTable& table, uint8_t& symbol)
+        {
+            reader.fill();
+            uint16_t entry = table.lookup[reader.bits >> (32 - LOOKUP_BITS)];
+            if (entry)
+            {
+                reader.take(entry >> 8);
+                symbol = entry & 0xFF;
+                return true;
+            }
+            for (int length = LOOKUP_BITS + 1; length <= 16; length++)
+            {
+                int32_t code = static_cast<int32_t>(reader.bits >> (32 - length));
+                if (code <= table.max_code[length])
+                {
+                    reader.take(length);
+                    symbol = table.values[table.value_index[length] + code - table.min_code[length]];
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /** Decodes a block, keeps its DC coefficient (quantized) in the predictor of the component */
+        bool decodeBlock(BitReader& reader, Component& component)
+        {
+            uint8_t size;
+            if (!decodeSymbol(reader, dc[component.dc_table], size) || size > 11) return false;
+            if (size)
+            {
+                reader.fill();
+                int32_t diff = static_cast<int32_t>(reader.take(size));
+                if (diff < (1 << (size - 1))) diff -= (1 << size) - 1;
+                component.predictor += diff;
+            }
+
+            const HuffmanTable& table = ac[component.ac_table];
+            for (int k = 1; k < 64; k++)
+            {
+                if (reader.count < 16) reader.fill();
+                uint8_t rs;
+                uint16_t skip = table.skip[reader.bits >> (32 - LOOKUP_BITS)];
+                if (skip)
+                {
+                    reader.take((skip >> 8) & 0x0F);
+                    rs = skip & 0xFF;
+                }
+                else
+                {
+                    if (!decodeSymbol(reader, table, rs)) return false;
+                    if (rs & 0x0F)
+                    {
+                        reader.fill();
+                        reader.take(rs & 0x0F);
+                    }
+                }
+
+                if ((rs & 0x0F) == 0)
+                {
+                    if (rs != 0xF0) break; // end of block
+                    k += 15;
+                    continue;
+                }
+                k += rs >> 4;
+            }
+            return true;
+        }
+
+        Status decodeScan(size_t at, uint8_t* out, uint16_t out_width, uint16_t out_height, bool& decoded)
+        {
+            decoded = false;
+            uint8_t count = data[at];
+            if (count < 1 || count > component_count || 1 + 2u * count + 3 > pos - at) return Status::InvalidParameters;
+
+            Component* scan[4];
+            bool has_luma = false;
+            for (int i = 0; i < count; i++)
+            {
+                uint8_t id = data[at + 1 + 2 * i];
+                uint8_t tables = data[at + 2 + 2 * i];
+                Component* component = nullptr;
+                for (int j = 0; j < component_count; j++)
+                    if (components[j].id == id) component = &components[j];
+                if (!component) return Status::InvalidParameters;
+                component->dc_table = tables >> 4;
+                component->ac_table = tables & 0x0F;
+                if (component->dc_table > 3 || component->ac_table > 3) return Status::InvalidParameters;
+                if (!dc[component->dc_table].defined || !ac[component->ac_table].defined) return Status::InvalidParameters;
+                component->predictor = 0;
+                scan[i] = component;
+                has_luma |= component == &components[0];
+            }
+            if (!has_luma) return Status::Ok; // chroma only scan, skipped by nextScan()
+
+            uint8_t h_max = 1, v_max = 1;
+            for (int i = 0; i < component_count; i++)
+            {
+                h_max = std::max(h_max, components[i].h);
+                v_max = std::max(v_max, components[i].v);
+            }
+            const Component& luma = components[0];
+            const int32_t luma_quant = quant[luma.quant_table];
+            if (luma_quant == 0) return Status::InvalidParameters; // no quantization table
+
+            uint32_t mcu_columns, mcu_rows;
+            if (count == 1)
+            {
+                // not interleaved : one block per MCU, over the size of the component
+                uint32_t component_width = (static_cast<uint32_t>(width) * luma.h + h_max - 1) / h_max;
+                uint32_t component_height = (static_cast<uint32_t>(height) * luma.v + v_max - 1) / v_max;
+                mcu_columns = (component_width + 7) / 8;
+                mcu_rows = (component_height + 7) / 8;
+            }
+            else
+            {
+                mcu_columns = (width + 8u * h_max - 1) / (8u * h_max);
+                mcu_rows = (height + 8u * v_max - 1) / (8u * v_max);
+            }
+            if (luma.h != h_max || luma.v != v_max) return Status::InvalidParameters; // subsampled luma, never seen
+
+            BitReader reader = { data, size, pos };
+            uint32_t mcu_count = mcu_columns * mcu_rows;
+            for (uint32_t mcu = 0; mcu < mcu_count; mcu++)
+            {
+                if (restart_interval && mcu && mcu % restart_interval == 0)
+                {
+                    if (!reader.restart()) return Status::InvalidParameters;
+                    for (int i = 0; i < count; i++) scan[i]->predictor = 0;
+                }
+
+                uint32_t mcu_x = mcu % mcu_columns;
+                uint32_t mcu_y = mcu / mcu_columns;
+                for (int i = 0; i < count; i++)
+                {
+                    Component& component = *scan[i];
+                    int h = count == 1 ? 1 : component.h;
+                    int v = count == 1 ? 1 : component.v;
+                    for (int by = 0; by < v; by++)
+                    {
+                        for (int bx = 0; bx < h; bx++)
+                        {
+                            if (!decodeBlock(reader, component)) return Status::InvalidParameters;
+                            if (&component != &components[0]) continue;
+
+                            uint32_t x = mcu_x * h + bx;
+                            uint32_t y = mcu_y * v + by;
+                            if (x >= out_width || y >= out_height) continue; // padding blocks
+
+                            // DC = 8 * (mean - 128)
+                            int32_t dc = component.predictor * luma_quant;
+                            int32_t value = 128 + (dc >= 0 ? dc + 4 : dc - 4) / 8;
+                            out[y * out_width + x] = static_cast<uint8_t>(std::clamp<int32_t>(value, 0, 255));
+                        }
+                    }
+                }
+            }
+            if (reader.truncated) return Status::InvalidParameters;
+            decoded = true;
+            return Status::Ok;
+        }
+    };
+}
+
+Status JpegThumbnail::GetSize(const uint8_t* jpeg, size_t size, uint16_t& width, uint16_t& height)
+{
+    if (!jpeg || size < 4 || jpeg[0] != 0xFF || jpeg[1] != 0xD8) return Status::InvalidParameters;
+
+    Decoder* decoder = new (std::nothrow) Decoder{ jpeg, size, 2 };
+    if (!decoder) return Status::NoMemory;
+    size_t scan_at;
+    Status err = decoder->nextScan(scan_at, true);
+    if (err == Status::Ok && decoder->component_count == 0) err = Status::InvalidParameters;
+    if (err == Status::Ok)
+    {
+        width = (decoder->width + 7) / 8;
+        height = (decoder->height + 7) / 8;
+    }
+    delete decoder;
+    return err;
+}
+
+Status JpegThumbnail::Decode(const uint8_t* jpeg, size_t size, uint8_t* out, size_t capacity, uint16_t& width, uint16_t& height)
+{
+    if (!jpeg || !out || size < 4 || jpeg[0] != 0xFF || jpeg[1] != 0xD8) return Status::InvalidParameters;
+
+    // ~20 KB of tables, kept off the stack of the caller
+    Decoder* decoder = new (std::nothrow) Decoder{ jpeg, size, 2 };
+    if (!decoder) return Status::NoMemory;
+
+    Status err = Status::Ok;
+    bool decoded = false;
+    while (!decoded)
+    {
+        size_t scan_at;
+        if ((err = decoder->nextScan(scan_at, false)) != Status::Ok) break;
+        if (scan_at == 0) // end of the image without a luma scan
+        {
+            err = Status::InvalidParameters;
+            break;
+        }
+
+        width = (decoder->width + 7) / 8;
+        height = (decoder->height + 7) / 8;
+        if (static_cast<size_t>(width) * height > capacity)
+        {
+            err = Status::OutOfBounds;
+            break;
+        }
+        if ((err = decoder->decodeScan(scan_at, out, width, height, decoded)) != Status::Ok) break;
+    }
+    delete decoder;
+    return err;
+}
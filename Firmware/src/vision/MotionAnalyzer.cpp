@@ -0,0 +1,286 @@
+#include "vision/MotionAnalyzer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    enum EventType { MOTION = 0, LIFTED = 1, COVERED = 2 };
+
+    constexpr int BLOCK_COLUMNS = (MotionAnalyzer::WIDTH - 2 * MotionAnalyzer::SEARCH) / MotionAnalyzer::BLOCK;
+    constexpr int BLOCK_ROWS = (MotionAnalyzer::HEIGHT - 2 * MotionAnalyzer::SEARCH) / MotionAnalyzer::BLOCK;
+    constexpr int BLOCK_X = (MotionAnalyzer::WIDTH - BLOCK_COLUMNS * MotionAnalyzer::BLOCK) / 2;
+    constexpr int BLOCK_Y = (MotionAnalyzer::HEIGHT - BLOCK_ROWS * MotionAnalyzer::BLOCK) / 2;
+    constexpr int SEARCH_SIZE = 2 * MotionAnalyzer::SEARCH + 1;
+    // mean absolute deviation under which a block is too flat to match
+    constexpr int MIN_TEXTURE = 4;
+    // blocks needed to trust the global flow
+    constexpr int MIN_FLOW_BLOCKS = 3;
+
+    float median(float* values, int count)
+    {
+        std::sort(values, values + count);
+        return count % 2 ? values[count / 2] : (values[count / 2 - 1] + values[count / 2]) / 2.0f;
+    }
+
+    /** Vertex of the parabola through three costs around a minimum, -0.5 to 0.5 */
+    float refine(int before, int at, int after)
+    {
+        int curvature = before - 2 * at + after;
+        if (curvature <= 0) return 0.0f;
+        return std::clamp(0.5f * (before - after) / curvature, -0.5f, 0.5f);
+    }
+}
+
+const char* MotionAnalyzer::EventName(Event event)
+{
+    switch (event)
+    {
+        case Event::None: return "none";
+        case Event::MotionLeft: return "motion left";
+        case Event::MotionCenter: return "motion center";
+        case Event::MotionRight: return "motion right";
+        case Event::Lifted: return "lifted";
+        case Event::Covered: return "covered";
+    }
+    return "?";
+}
+
+void MotionAnalyzer::reset()
+{
+    has_previous = false;
+    source_width = 0;
+    source_height = 0;
+    motion_frames = 0;
+    lift_frames = 0;
+    dark_frames = 0;
+    for (int i = 0; i < EVENT_TYPES; i++) event_raised[i] = false;
+}
+
+Status MotionAnalyzer::process(const uint8_t* pixels, uint16_t width, uint16_t height, int64_t time_us, Result& result)
+{
+    if (pixels == nullptr || width == 0 || height == 0) return Status::InvalidParameters;
+
+    if (width != source_width || height != source_height)
+    {
+        // frame size changed (camera level), the grids wouldn't match
+        has_previous = false;
+        source_width = width;
+        source_height = height;
+    }
+    resample(pixels, width, height);
+
+    result = {};
+    uint32_t sum = 0;
+    for (uint8_t pixel : current) sum += pixel;
+    result.brightness = static_cast<float>(sum) / (WIDTH * HEIGHT);
+    bool dark = result.brightness < VISION_DARK_LEVEL;
+
+    if (has_previous && !dark)
+    {
+        float flow_x, flow_y;
+        result.valid = true;
+        result.flow_blocks = flow(flow_x, flow_y);
+        result.motion = difference(flow_x, flow_y, result.x, result.y);
+
+        // flow over one analysis period, the frames may come a bit early or late
+        float period_us = 1e6f / VISION_FRAME_RATE;
+        float scale = period_us / std::clamp(static_cast<float>(time_us - previous_us), period_us / 4, period_us * 4);
+        result.flow_x = flow_x * scale;
+        result.flow_y = flow_y * scale;
+    }
+    memcpy(previous, current, sizeof(previous));
+    previous_us = time_us;
+    has_previous = true;
+
+    // counters of the conditions held frame after frame
+    dark_frames = dark ? std::min(dark_frames + 1, 255) : 0;
+    bool lifting = result.flow_blocks >= MIN_FLOW_BLOCKS && result.flow_y >= VISION_LIFT_FLOW && result.flow_y > 2.0f * std::fabs(result.flow_x);
+    lift_frames = lifting ? std::min(lift_frames + 1, 255) : 0;
+    bool moving = result.valid && result.motion >= VISION_MOTION_MIN && result.motion <= VISION_MOTION_MAX;
+    motion_frames = moving ? std::min(motion_frames + 1, 255) : 0;
+
+    // covered and lifted are raised once when they start, motion again after the cooldown while it lasts
+    int type = -1;
+    if (dark_frames == VISION_COVERED_FRAMES)
+    {
+        if (cooled(COVERED, time_us)) type = COVERED;
+    }
+    else if (lift_frames == VISION_LIFT_FRAMES)
+    {
+        if (cooled(LIFTED, time_us)) type = LIFTED;
+    }
+    else if (motion_frames >= VISION_MOTION_FRAMES && lift_frames == 0)
+    {
+        if (cooled(MOTION, time_us)) type = MOTION;
+    }
+
+    if (type >= 0)
+    {
+        event_raised[type] = true;
+        last_event_us[type] = time_us;
+        switch (type)
+        {
+            case COVERED: result.event = Event::Covered; break;
+            case LIFTED: result.event = Event::Lifted; break;
+            default:
+                result.event = result.x < -1.0f / 3.0f ? Event::MotionLeft : result.x > 1.0f / 3.0f ? Event::MotionRight : Event::MotionCenter;
+                break;
+        }
+    }
+    return Status::Ok;
+}
+
+void MotionAnalyzer::resample(const uint8_t* pixels, uint16_t width, uint16_t height)
+{
+    // box average when downscaling, nearest pixel when upscaling
+    for (int y = 0; y < HEIGHT; y++)
+    {
+        int y0 = y * height / HEIGHT;
+        int y1 = std::max(y0 + 1, (y + 1) * height / HEIGHT);
+        for (int x = 0; x < WIDTH; x++)
+        {
+            int x0 = x * width / WIDTH;
+            int x1 = std::max(x0 + 1, (x + 1) * width / WIDTH);
+            uint32_t sum = 0;
+            for (int sy = y0; sy < y1; sy++)
+                for (int sx = x0; sx < x1; sx++)
+                    sum += pixels[sy * width + sx];
+            uint32_t count = (y1 - y0) * (x1 - x0);
+            current[y * WIDTH + x] = static_cast<uint8_t>((sum + count / 2) / count);
+        }
+    }
+}
+
+uint8_t MotionAnalyzer::flow(float& flow_x, float& flow_y) const
+{
+    float vectors_x[BLOCK_COLUMNS * BLOCK_ROWS];
+    float vectors_y[BLOCK_COLUMNS * BLOCK_ROWS];
+    int count = 0;
+
+    for (int row = 0; row < BLOCK_ROWS; row++)
+    {
+        for (int column = 0; column < BLOCK_COLUMNS; column++)
+        {
+            int bx = BLOCK_X + column * BLOCK;
+            int by = BLOCK_Y + row * BLOCK;
+
+            int block_sum = 0;
+            for (int y = 0; y < BLOCK; y++)
+                for (int x = 0; x < BLOCK; x++)
+                    block_sum += current[(by + y) * WIDTH + bx + x];
+            int block_mean = block_sum / (BLOCK * BLOCK);
+            int texture = 0;
+            for (int y = 0; y < BLOCK; y++)
+                for (int x = 0; x < BLOCK; x++)
+                    texture += std::abs(current[(by + y) * WIDTH + bx + x] - block_mean);
+            if (texture < MIN_TEXTURE * BLOCK * BLOCK) continue;
+
+            // the block came from (bx - dx, by - dy) in the previous frame, means removed (exposure changes)
+            int costs[SEARCH_SIZE][SEARCH_SIZE];
+            int best_x = SEARCH, best_y = SEARCH;
+            for (int dy = -SEARCH; dy <= SEARCH; dy++)
+            {
+                for (int dx = -SEARCH; dx <= SEARCH; dx++)
+                {
+                    const uint8_t* source = previous + (by - dy) * WIDTH + bx - dx;
+                    int source_sum = 0;
+                    for (int y = 0; y < BLOCK; y++)
+                        for (int x = 0; x < BLOCK; x++)
+                            source_sum += source[y * WIDTH + x];
+                    int offset = (block_sum - source_sum) / (BLOCK * BLOCK);
+
+                    int cost = 0;
+                    for (int y = 0; y < BLOCK; y++)
+                        for (int x = 0; x < BLOCK; x++)
+                            cost += std::abs(current[(by + y) * WIDTH + bx + x] - source[y * WIDTH + x] - offset);
+                    costs[dy + SEARCH][dx + SEARCH] = cost;
+                    if (cost < costs[best_y][best_x]) { best_x = dx + SEARCH; best_y = dy + SEARCH; }
+                }
+            }
+
+            float vx = best_x - SEARCH;
+            float vy = best_y - SEARCH;
+            if (best_x > 0 && best_x < SEARCH_SIZE - 1)
+                vx += refine(costs[best_y][best_x - 1], costs[best_y][best_x], costs[best_y][best_x + 1]);
+            if (best_y > 0 && best_y < SEARCH_SIZE - 1)
+                vy += refine(costs[best_y - 1][best_x], costs[best_y][best_x], costs[best_y + 1][best_x]);
+            vectors_x[count] = vx;
+            vectors_y[count] = vy;
+            count++;
+        }
+    }
+
+    if (count < MIN_FLOW_BLOCKS)
+    {
+        flow_x = 0.0f;
+        flow_y = 0.0f;
+        return count;
+    }
+    flow_x = median(vectors_x, count);
+    flow_y = median(vectors_y, count);
+    return count;
+}
+
+float MotionAnalyzer::difference(float shift_x, float shift_y, float& cx, float& cy)
+{
+    // previous frame sampled where each pixel came from (bilinear), over the part seen in both frames
+    int ix = static_cast<int>(std::floor(shift_x));
+    int iy = static_cast<int>(std::floor(shift_y));
+    int fx = static_cast<int>((shift_x - ix) * 256.0f);
+    int fy = static_cast<int>((shift_y - iy) * 256.0f);
+    int x_begin = std::max(0, ix + 1), x_end = std::min<int>(WIDTH, WIDTH + ix);
+    int y_begin = std::max(0, iy + 1), y_end = std::min<int>(HEIGHT, HEIGHT + iy);
+    if (x_end <= x_begin || y_end <= y_begin)
+    {
+        cx = cy = 0.0f;
+        return 0.0f;
+    }
+
+    // the source of (x, y) is (x - shift_x, y - shift_y), between (x - ix - 1, y - iy - 1) and (x - ix, y - iy)
+    int32_t delta_sum = 0;
+    for (int y = y_begin; y < y_end; y++)
+    {
+        const uint8_t* row0 = previous + (y - iy - 1) * WIDTH;
+        const uint8_t* row1 = row0 + WIDTH;
+        for (int x = x_begin; x < x_end; x++)
+        {
+            int sx = x - ix - 1;
+            int top = row0[sx] * fx + row0[sx + 1] * (256 - fx);
+            int bottom = row1[sx] * fx + row1[sx + 1] * (256 - fx);
+            int source = (top * fy + bottom * (256 - fy) + (1 << 15)) >> 16;
+            int d = current[y * WIDTH + x] - source;
+            delta[y * WIDTH + x] = static_cast<int16_t>(d);
+            delta_sum += d;
+        }
+    }
+    int area = (x_end - x_begin) * (y_end - y_begin);
+    int offset = delta_sum / area; // exposure change
+
+    int changed = 0;
+    int32_t sum_x = 0, sum_y = 0;
+    for (int y = y_begin; y < y_end; y++)
+    {
+        for (int x = x_begin; x < x_end; x++)
+        {
+            if (std::abs(delta[y * WIDTH + x] - offset) <= VISION_MOTION_THRESHOLD) continue;
+            changed++;
+            sum_x += x;
+            sum_y += y;
+        }
+    }
+    if (changed == 0)
+    {
+        cx = cy = 0.0f;
+        return 0.0f;
+    }
+    cx = (static_cast<float>(sum_x) / changed + 0.5f) * 2.0f / WIDTH - 1.0f;
+    cy = (static_cast<float>(sum_y) / changed + 0.5f) * 2.0f / HEIGHT - 1.0f;
+    return static_cast<float>(changed) / area;
+}
+
+bool MotionAnalyzer::cooled(int type, int64_t time_us) const
+{
+    return !event_raised[type] || time_us - last_event_us[type] >= static_cast<int64_t>(VISION_EVENT_COOLDOWN_MS) * 1000;
+}
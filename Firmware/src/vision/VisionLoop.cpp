@@ -0,0 +1,98 @@
+#include "vision/VisionLoop.hpp"
+#include "vision/JpegThumbnail.hpp"
+#include "common/Log.hpp"
+#include "Robot.hpp"
+#include <algorithm>
+
+constexpr int64_t FRAME_PERIOD_US = static_cast<int64_t>(1e6f / VISION_FRAME_RATE);
+
+Status VisionLoop::start(CameraStream& camera_stream)
+{
+    if (running) return Status::InvalidState;
+
+    stream = &camera_stream;
+    analyzer.reset();
+    next_frame_us = 0;
+    running = true;
+    if (xTaskCreatePinnedToCore(vision_task, "vision", VISION_TASK_STACK_SIZE, this, VISION_TASK_PRIORITY, &task, CORE_BRAIN) != pdPASS)
+    {
+        running = false;
+        LOG_ERROR(TAG, "Failed to create vision task");
+        return Status::Failure;
+    }
+    return Status::Ok;
+}
+
+Status VisionLoop::stop()
+{
+    running = false;
+    // the task ends at its next frame, or once the stream waited CAMERA_CLIENT_TIMEOUT_MS for one
+    for (uint32_t i = 0; i < CAMERA_CLIENT_TIMEOUT_MS / 10 + 10 && task != nullptr; i++)
+    {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    return task == nullptr ? Status::Ok : Status::Failure;
+}
+
+MotionAnalyzer::Result VisionLoop::getLastResult() const
+{
+    return last_result;
+}
+
+void VisionLoop::vision_task(void* param)
+{
+    VisionLoop& vision = *static_cast<VisionLoop*>(param);
+    while (vision.running)
+    {
+        int client = vision.stream->subscribe();
+        if (client < 0)
+        {
+            // every stream client is taken by viewers, try again later
+            vTaskDelay(pdMS_TO_TICKS(CAMERA_CLIENT_TIMEOUT_MS));
+            continue;
+        }
+
+        Status err = vision.stream->serveFrames(client, [&vision](const CameraStream::Frame& frame) {
+            return vision.analyze(frame);
+        });
+        vision.stream->unsubscribe(client);
+        if (err == Status::Ok) break; // camera stopped
+
+        if (err == Status::Failure)
+        {
+            LOG_WARNING(TAG, "No camera frame for %lu ms, subscribing again", static_cast<unsigned long>(CAMERA_CLIENT_TIMEOUT_MS));
+            vision.analyzer.reset();
+        }
+    }
+    vision.running = false;
+    vision.task = nullptr;
+    vTaskDelete(NULL);
+}
+
+bool VisionLoop::analyze(const CameraStream::Frame& frame)
+{
+    if (!running) return false;
+
+    // every other camera frame or so, the analyzer scales the flow with the actual frame times
+    if (frame.timestamp_us < next_frame_us) return true;
+    next_frame_us = std::max(next_frame_us + FRAME_PERIOD_US, frame.timestamp_us);
+
+    uint16_t width, height;
+    if (Status err = JpegThumbnail::Decode(frame.data, frame.size, thumbnail, sizeof(thumbnail), width, height); err != Status::Ok)
+    {
+        LOG_DEBUG(TAG, "Frame %lu not decoded (%d)", static_cast<unsigned long>(frame.sequence), static_cast<int>(err));
+        return true;
+    }
+
+    MotionAnalyzer::Result result;
+    if (analyzer.process(thumbnail, width, height, frame.timestamp_us, result) != Status::Ok) return true;
+    last_result = result;
+
+    if (result.event != MotionAnalyzer::Event::None)
+    {
+        LOG_DEBUG(TAG, "%s (motion %.0f%% at %.2f, flow %.1f %.1f)", MotionAnalyzer::EventName(result.event), result.motion * 100,
+                  result.x, result.flow_x, result.flow_y);
+        Robot::GetInstance().getDecisionLoop().postVisionEvent(result.event, result.x);
+    }
+    return true;
+}